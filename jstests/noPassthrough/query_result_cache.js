@@ -0,0 +1,47 @@
+/**
+ * Test that when queryResultCacheTTLSeconds is set, a second identical find command is served
+ * from the query result cache, and that writes to the collection invalidate cached entries.
+ */
+(function() {
+"use strict";
+const conn = MongoRunner.runMongod({setParameter: {queryResultCacheTTLSeconds: 3600}});
+const db = conn.getDB('test');
+const coll = db.query_result_cache;
+
+assert.commandWorked(coll.insert([{_id: 1, x: 1}, {_id: 2, x: 2}]));
+
+function getCacheMetrics() {
+    const serverStatus = assert.commandWorked(db.serverStatus());
+    return serverStatus.metrics.queryResultCache;
+}
+
+// The first run of the query misses the cache and stores its result.
+const before = getCacheMetrics();
+assert.eq(2, coll.find({x: {$gte: 1}}).itcount());
+let metrics = getCacheMetrics();
+assert.eq(before.hits, metrics.hits, metrics);
+assert.eq(before.misses + 1, metrics.misses, metrics);
+
+// An identical query is served from the cache and still returns the same result.
+assert.eq(2, coll.find({x: {$gte: 1}}).itcount());
+metrics = getCacheMetrics();
+assert.eq(before.hits + 1, metrics.hits, metrics);
+assert.eq(before.misses + 1, metrics.misses, metrics);
+
+// A write to the collection invalidates the cached entry, so the next run misses and observes
+// the new document.
+assert.commandWorked(coll.insert({_id: 3, x: 3}));
+assert.eq(3, coll.find({x: {$gte: 1}}).itcount());
+metrics = getCacheMetrics();
+assert.eq(before.hits + 1, metrics.hits, metrics);
+assert.eq(before.misses + 2, metrics.misses, metrics);
+
+// Disabling the cache turns lookups back into no-ops.
+assert.commandWorked(db.adminCommand({setParameter: 1, queryResultCacheTTLSeconds: 0}));
+assert.eq(3, coll.find({x: {$gte: 1}}).itcount());
+metrics = getCacheMetrics();
+assert.eq(before.hits + 1, metrics.hits, metrics);
+assert.eq(before.misses + 2, metrics.misses, metrics);
+
+MongoRunner.stopMongod(conn);
+})();
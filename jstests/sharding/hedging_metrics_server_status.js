@@ -26,6 +26,14 @@ function verifyServerStatusFields(serverStatusResponse) {
         serverStatusResponse.hedgingMetrics.hasOwnProperty("numAdvantageouslyHedgedOperations"),
         "The 'hedgingMetrics' field in serverStatus did not have the 'numAdvantageouslyHedgedOperations' field\n" +
             tojson(serverStatusResponse.hedgingMetrics));
+    assert(
+        serverStatusResponse.hedgingMetrics.hasOwnProperty("numDeferredHedgedOperations"),
+        "The 'hedgingMetrics' field in serverStatus did not have the 'numDeferredHedgedOperations' field\n" +
+            tojson(serverStatusResponse.hedgingMetrics));
+    assert(
+        serverStatusResponse.hedgingMetrics.hasOwnProperty("numSkippedHedgedOperations"),
+        "The 'hedgingMetrics' field in serverStatus did not have the 'numSkippedHedgedOperations' field\n" +
+            tojson(serverStatusResponse.hedgingMetrics));
 }
 
 /*
@@ -105,7 +113,9 @@ let sortedNodes = [...st.rs0.nodes].sort((node1, node2) => node1.host.localeComp
 let expectedHedgingMetrics = {
     numTotalOperations: 0,
     numTotalHedgedOperations: 0,
-    numAdvantageouslyHedgedOperations: 0
+    numAdvantageouslyHedgedOperations: 0,
+    numDeferredHedgedOperations: 0,
+    numSkippedHedgedOperations: 0
 };
 
 jsTestLog("Run a command with hedging disabled, and verify the metrics does not change");
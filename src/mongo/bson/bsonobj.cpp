@@ -273,6 +273,13 @@ int BSONObj::woCompare(const BSONObj& r,
                        const Ordering& o,
                        ComparisonRulesSet rules,
                        const StringData::ComparatorInterface* comparator) const {
+    // Identical bytes compare equal under any ordering, comparison rules or string comparator, so
+    // equality checks can short-circuit to a memcmp without element-by-element type dispatch. The
+    // memcmp bails out at the first differing byte, so unequal objects pay only for their common
+    // prefix before falling through to the full comparison.
+    if (binaryEqual(r))
+        return 0;
+
     if (isEmpty())
         return r.isEmpty() ? 0 : -1;
     if (r.isEmpty())
@@ -309,6 +316,10 @@ int BSONObj::woCompare(const BSONObj& r,
                        const BSONObj& idxKey,
                        ComparisonRulesSet rules,
                        const StringData::ComparatorInterface* comparator) const {
+    // See the comment in the Ordering overload above; this also holds when field order is ignored.
+    if (binaryEqual(r))
+        return 0;
+
     return (rules & ComparisonRules::kIgnoreFieldOrder)
         ? compareObjects<BSONObjIteratorSorted>(*this, r, idxKey, rules, comparator)
         : compareObjects<BSONObjIterator>(*this, r, idxKey, rules, comparator);
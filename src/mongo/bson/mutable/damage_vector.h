@@ -35,10 +35,14 @@
 namespace mongo {
 namespace mutablebson {
 
-// A damage event represents a change of size 'size' byte at starting at offset
-// 'target_offset' in some target buffer, with the replacement data being 'size' bytes of
-// data from the 'source' offset. The base addresses against which these offsets are to be
-// applied are not captured here.
+// A damage event represents a change to 'targetSize' bytes starting at offset
+// 'targetOffset' in some target buffer, with the replacement data being 'size' bytes of
+// data from the 'source' offset. When 'targetSize' differs from 'size' the target grows
+// or shrinks; in particular a 'targetSize' of zero splices the source bytes in at
+// 'targetOffset' without replacing anything. Events are applied in order and offsets are
+// cumulative: an event that changes the target's size shifts the bytes that follow it, and
+// later events' target offsets must account for that. The base addresses against which
+// these offsets are to be applied are not captured here.
 struct DamageEvent {
     typedef uint32_t OffsetSizeType;
 
@@ -48,8 +52,12 @@ struct DamageEvent {
     // Offset of target data (in some buffer held elsewhere).
     OffsetSizeType targetOffset;
 
-    // Size of the damage region.
+    // Size of the replacement data in the source buffer.
     size_t size;
+
+    // Number of bytes replaced in the target buffer. Equal to 'size' for an in-place
+    // overwrite.
+    size_t targetSize;
 };
 
 typedef std::vector<DamageEvent> DamageVector;
@@ -643,6 +643,8 @@ public:
         _fieldNameScratch.clear();
         _damages.clear();
         _inPlaceMode = inPlaceMode;
+        _inPlaceAppendedBytes = 0;
+        _inPlaceAppendsEnabled = false;
 
         // Ensure that we start in the same state as the ctor would leave us in.
         _objects.push_back(_leafBuilder.asTempObj());
@@ -1002,6 +1004,23 @@ public:
             return false;
         }
 
+        // If any elements were appended to the root in place, the root object's length
+        // header must be rewritten to cover the appended bytes. The final length is only
+        // known once all modifications have been made, so this event is emitted here
+        // rather than when the appends are recorded. It is safe to append raw bytes to
+        // the leaf builder's buffer at this point: damage sources are located by offset,
+        // never by walking the leaf object.
+        if (_inPlaceAppendedBytes > 0) {
+            const ElementRep& rootRep = getElementRep(kRootRepIdx);
+            const int32_t newLength =
+                static_cast<int32_t>(getObject(rootRep.objIdx).objsize() + _inPlaceAppendedBytes);
+            const DamageEvent::OffsetSizeType sourceOffset = _leafBuf.len();
+            _leafBuf.appendNum(newLength);
+            _objects[kLeafObjIdx] = _leafBuilder.asTempObj();
+            recordDamageEvent(0, sourceOffset, sizeof(newLength), sizeof(newLength));
+            _inPlaceAppendedBytes = 0;
+        }
+
         // Set up the source and source size out parameters.
         *source = _objects[0].objdata();
         if (size)
@@ -1017,6 +1036,11 @@ public:
 
     void disableInPlaceUpdates() {
         _inPlaceMode = Document::kInPlaceDisabled;
+        _inPlaceAppendedBytes = 0;
+    }
+
+    void enableInPlaceAppends() {
+        _inPlaceAppendsEnabled = true;
     }
 
     Document::InPlaceMode getCurrentInPlaceMode() const {
@@ -1029,11 +1053,13 @@ public:
 
     void recordDamageEvent(DamageEvent::OffsetSizeType targetOffset,
                            DamageEvent::OffsetSizeType sourceOffset,
-                           size_t size) {
+                           size_t size,
+                           size_t targetSize) {
         _damages.push_back(DamageEvent());
         _damages.back().targetOffset = targetOffset;
         _damages.back().sourceOffset = sourceOffset;
         _damages.back().size = size;
+        _damages.back().targetSize = targetSize;
         if (kDebugBuild && paranoid) {
             // Force damage events to new addresses to catch invalidation errors.
             DamageVector new_damages(_damages);
@@ -1041,6 +1067,32 @@ public:
         }
     }
 
+    // Returns true if the element representation 'rep' can be appended to the end of the
+    // root object without giving up in-place updates: its entire serialization, field name
+    // included, must be a contiguous run of bytes in the leaf buffer that can serve as a
+    // damage source.
+    bool canAppendInPlace(const ElementRep& rep) const {
+        // The root must be backed by a serialized object whose layout the damage offsets
+        // describe.
+        return _inPlaceAppendsEnabled && isInPlaceModeEnabled() && hasValue(rep) &&
+            rep.objIdx == kLeafObjIdx && getElementRep(kRootRepIdx).objIdx != kInvalidObjIdx;
+    }
+
+    // Records a damage event splicing the serialized bytes of 'rep' in just ahead of the
+    // root object's terminating EOO byte. Must be called before 'rep' is wired into the
+    // tree, while the serialized root object still describes the layout being damaged.
+    void recordInPlaceAppend(const ElementRep& rep) {
+        dassert(canAppendInPlace(rep));
+        const BSONElement newElt = getSerializedElement(rep);
+        const ElementRep& rootRep = getElementRep(kRootRepIdx);
+        // Offset of the root's EOO byte, adjusted for any elements already appended in
+        // place ahead of us.
+        const auto eooOffset = static_cast<DamageEvent::OffsetSizeType>(
+            getObject(rootRep.objIdx).objsize() - 1 + _inPlaceAppendedBytes);
+        recordDamageEvent(eooOffset, rep.offset, newElt.size(), 0);
+        _inPlaceAppendedBytes += newElt.size();
+    }
+
     // Check all preconditions on doing an in-place update, except for size match.
     bool canUpdateInPlace(const ElementRep& sourceRep, const ElementRep& targetRep) {
         // NOTE: CodeWScope might arguably be excluded since it has substructure, but
@@ -1125,6 +1177,15 @@ private:
     // Queue of damage events and status bit for whether  in-place updates are possible.
     DamageVector _damages;
     Document::InPlaceMode _inPlaceMode;
+
+    // Total size of the elements appended in place to the end of the root object, used to
+    // place subsequent append damage events and to rewrite the root's length header.
+    size_t _inPlaceAppendedBytes = 0;
+
+    // Whether appends to the end of the root object may be recorded as growing damage
+    // events. Off by default because not all damage consumers understand events whose
+    // target size differs from their source size.
+    bool _inPlaceAppendsEnabled = false;
 };
 
 Status Element::addSiblingLeft(Element e) {
@@ -1179,6 +1240,10 @@ Status Element::addSiblingLeft(Element e) {
 }
 
 Status Element::addSiblingRight(Element e) {
+    return addSiblingRightInternal(e, false);
+}
+
+Status Element::addSiblingRightInternal(Element e, bool retainInPlaceUpdates) {
     invariant(ok());
     invariant(e.ok());
     invariant(_doc == e._doc);
@@ -1200,7 +1265,11 @@ Status Element::addSiblingRight(Element e) {
     ElementRep* parentRep = &impl.getElementRep(thisRep->parent);
     dassert(!impl.isLeaf(*parentRep));
 
-    impl.disableInPlaceUpdates();
+    // 'retainInPlaceUpdates' is only set by addChild when the structural change has already
+    // been recorded as an append damage event; any other addition invalidates in-place
+    // updates.
+    if (!retainInPlaceUpdates)
+        impl.disableInPlaceUpdates();
 
     // If our current right sibling is opaque it needs to be resolved. This will invalidate
     // our reps so we need to reacquire them.
@@ -2016,7 +2085,15 @@ Status Element::addChild(Element e, bool front) {
         return Status(ErrorCodes::IllegalOperation,
                       "Attempt to add a child element to a non-object element");
 
-    impl.disableInPlaceUpdates();
+    // Appending a fully serialized element to the end of the root object can be expressed
+    // as a damage event that splices the new bytes in just ahead of the root's terminating
+    // EOO byte, so it does not forfeit in-place updates. Any other structural change does.
+    const bool inPlaceAppend = !front && _repIdx == kRootRepIdx && impl.canAppendInPlace(newRep);
+    if (inPlaceAppend) {
+        impl.recordInPlaceAppend(newRep);
+    } else {
+        impl.disableInPlaceUpdates();
+    }
 
     // TODO: In both of the following cases, we call two public API methods each. We can
     // probably do better by writing this explicitly here and drying it with the public
@@ -2036,7 +2113,7 @@ Status Element::addChild(Element e, bool front) {
         // quite common operation, so it would be nice if we could do this efficiently.
         Element rc = rightChild();
         if (rc.ok())
-            return rc.addSiblingRight(e);
+            return rc.addSiblingRightInternal(e, inPlaceAppend);
     }
 
     // It must be the case that we have no children, so the new element becomes both the
@@ -2086,7 +2163,7 @@ Status Element::setValue(const Element::RepIdx newValueIdx) {
 
             // If this is a type change, record a damage event for the new type.
             if (thisElt.type() != valueElt.type()) {
-                impl.recordDamageEvent(targetBaseOffset, sourceBaseOffset, 1);
+                impl.recordDamageEvent(targetBaseOffset, sourceBaseOffset, 1, 1);
             }
 
             dassert(thisElt.fieldNameSize() == valueElt.fieldNameSize());
@@ -2095,11 +2172,17 @@ Status Element::setValue(const Element::RepIdx newValueIdx) {
             // Record a damage event for the new value data.
             impl.recordDamageEvent(targetBaseOffset + thisElt.fieldNameSize() + 1,
                                    sourceBaseOffset + thisElt.fieldNameSize() + 1,
+                                   thisElt.valuesize(),
                                    thisElt.valuesize());
         } else {
             // We couldn't do it in place, so disable future in-place updates.
             impl.disableInPlaceUpdates();
         }
+    } else if (impl.isInPlaceModeEnabled()) {
+        // The target cannot be damaged in place (for instance, it was itself appended in
+        // place and lives in the leaf heap). Updating it while continuing to queue damage
+        // events would let the queued events go stale, so give up on in-place updates.
+        impl.disableInPlaceUpdates();
     }
 
     // If we are not rootish, then wire in the new value among our relations.
@@ -2295,6 +2378,10 @@ void Document::disableInPlaceUpdates() {
     return getImpl().disableInPlaceUpdates();
 }
 
+void Document::enableInPlaceAppends() {
+    return getImpl().enableInPlaceAppends();
+}
+
 Document::InPlaceMode Document::getCurrentInPlaceMode() const {
     return getImpl().getCurrentInPlaceMode();
 }
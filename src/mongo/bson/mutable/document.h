@@ -487,6 +487,14 @@ public:
      */
     void disableInPlaceUpdates();
 
+    /** Permit appends of fully serialized elements at the end of the root object to be
+     *  recorded as growing damage events instead of disabling in-place updates. The
+     *  resulting damage vector may contain events whose target size differs from their
+     *  source size, which not all damage consumers understand, so this behavior is
+     *  opt-in. Cleared by reset().
+     */
+    void enableInPlaceAppends();
+
     /** Returns the current in-place mode for the document. Note that for some documents,
      *  like those created without any backing BSONObj, this will always return kForbidden,
      *  since in-place updates make no sense for such an object. In other cases, an object
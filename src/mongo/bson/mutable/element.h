@@ -619,6 +619,8 @@ private:
 
     Status addChild(Element e, bool front);
 
+    Status addSiblingRightInternal(Element e, bool retainInPlaceUpdates);
+
     StringData getValueStringOrSymbol() const;
 
     Status setValue(Element::RepIdx newValueIdx);
@@ -950,12 +950,14 @@ TEST(Documentation, Example2) {
 
 namespace {
 void apply(mongo::BSONObj* obj, const mmb::DamageVector& damages, const char* source) {
+    std::string target(obj->objdata(), obj->objsize());
     const mmb::DamageVector::const_iterator end = damages.end();
     mmb::DamageVector::const_iterator where = damages.begin();
-    char* const target = const_cast<char*>(obj->objdata());
     for (; where != end; ++where) {
-        std::memcpy(target + where->targetOffset, source + where->sourceOffset, where->size);
+        target.replace(
+            where->targetOffset, where->targetSize, source + where->sourceOffset, where->size);
     }
+    *obj = mongo::BSONObj(target.c_str()).getOwned();
 }
 }  // namespace
 
@@ -2922,6 +2924,70 @@ TEST(DocumentInPlace, DisablingInPlaceDoesNotDiscardUpdates) {
     ASSERT_BSONOBJ_EQ(mongo::fromjson(outJson), doc.getObject());
 }
 
+TEST(DocumentInPlace, InPlaceAppendsKeepInPlaceModeEnabled) {
+    mongo::BSONObj obj(mongo::fromjson("{ foo : false, bar : true }"));
+    mmb::Document doc(obj, mmb::Document::kInPlaceEnabled);
+    doc.enableInPlaceAppends();
+    ASSERT_TRUE(doc.isInPlaceModeEnabled());
+
+    ASSERT_OK(doc.root().appendString("baz", "baz"));
+    ASSERT_TRUE(doc.isInPlaceModeEnabled());
+    ASSERT_OK(doc.root().appendInt("qux", 42));
+    ASSERT_TRUE(doc.isInPlaceModeEnabled());
+
+    mmb::DamageVector damages;
+    const char* source = nullptr;
+    ASSERT_TRUE(doc.getInPlaceUpdates(&damages, &source));
+    // One event per spliced-in element, plus one rewriting the root's length header.
+    ASSERT_EQUALS(3U, damages.size());
+    ASSERT_EQUALS(0U, damages[0].targetSize);
+    ASSERT_EQUALS(0U, damages[1].targetSize);
+    apply(&obj, damages, source);
+
+    static const char outJson[] = "{ foo : false, bar : true, baz : 'baz', qux : 42 }";
+    ASSERT_BSONOBJ_EQ(mongo::fromjson(outJson), obj);
+    ASSERT_BSONOBJ_EQ(obj, doc.getObject());
+}
+
+TEST(DocumentInPlace, InPlaceAppendsCombineWithSetValue) {
+    mongo::BSONObj obj(mongo::fromjson("{ foo : false }"));
+    mmb::Document doc(obj, mmb::Document::kInPlaceEnabled);
+    doc.enableInPlaceAppends();
+
+    ASSERT_OK(doc.root().leftChild().setValueBool(true));
+    ASSERT_TRUE(doc.isInPlaceModeEnabled());
+    ASSERT_OK(doc.root().appendInt("count", 42));
+    ASSERT_TRUE(doc.isInPlaceModeEnabled());
+
+    mmb::DamageVector damages;
+    const char* source = nullptr;
+    ASSERT_TRUE(doc.getInPlaceUpdates(&damages, &source));
+    ASSERT_EQUALS(3U, damages.size());
+    apply(&obj, damages, source);
+
+    static const char outJson[] = "{ foo : true, count : 42 }";
+    ASSERT_BSONOBJ_EQ(mongo::fromjson(outJson), obj);
+    ASSERT_BSONOBJ_EQ(obj, doc.getObject());
+}
+
+TEST(DocumentInPlace, InPlaceAppendsOnlyApplyToTheRootObject) {
+    mongo::BSONObj obj(mongo::fromjson("{ foo : { bar : 1 } }"));
+    mmb::Document doc(obj, mmb::Document::kInPlaceEnabled);
+    doc.enableInPlaceAppends();
+    ASSERT_TRUE(doc.isInPlaceModeEnabled());
+    ASSERT_OK(doc.root().leftChild().appendInt("baz", 2));
+    ASSERT_FALSE(doc.isInPlaceModeEnabled());
+}
+
+TEST(DocumentInPlace, InPlaceAppendsDoNotApplyToPushFront) {
+    mongo::BSONObj obj = mongo::fromjson("{ foo : 'foo' }");
+    mmb::Document doc(obj, mmb::Document::kInPlaceEnabled);
+    doc.enableInPlaceAppends();
+    mmb::Element newElt = doc.makeElementInt("bar", 42);
+    ASSERT_OK(doc.root().pushFront(newElt));
+    ASSERT_FALSE(doc.isInPlaceModeEnabled());
+}
+
 TEST(DocumentInPlace, StringLifecycle) {
     mongo::BSONObj obj(mongo::fromjson("{ x : 'foo' }"));
     mmb::Document doc(obj, mmb::Document::kInPlaceEnabled);
@@ -0,0 +1,93 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/admission_control.h"
+
+#include "mongo/db/admission_control_gen.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/service_context.h"
+#include "mongo/util/str.h"
+
+namespace mongo {
+
+namespace {
+const auto getAdmissionControl = ServiceContext::declareDecoration<AdmissionControl>();
+}  // namespace
+
+AdmissionControl& AdmissionControl::get(ServiceContext* svcCtx) {
+    return getAdmissionControl(svcCtx);
+}
+
+AdmissionControl::Ticket AdmissionControl::admit(OperationContext* opCtx, StringData className) {
+    const int32_t limit = gAdmissionControlMaxConcurrentOpsPerClass.load();
+    if (limit == 0 || className.empty()) {
+        return Ticket();
+    }
+
+    auto key = className.toString();
+    stdx::unique_lock<Latch> lk(_mutex);
+
+    // The limit is re-read inside the predicate so disabling admission control at runtime
+    // releases queued operations instead of holding them until their queue deadline.
+    auto hasFreeSlot = [&] {
+        const int32_t limitNow = gAdmissionControlMaxConcurrentOpsPerClass.load();
+        return limitNow == 0 || _classes[key].active < limitNow;
+    };
+
+    if (!hasFreeSlot()) {
+        const auto deadline = opCtx->getServiceContext()->getFastClockSource()->now() +
+            Milliseconds(gAdmissionControlMaxQueueTimeMillis.load());
+        if (!opCtx->waitForConditionOrInterruptUntil(_slotFreed, lk, deadline, hasFreeSlot)) {
+            uasserted(ErrorCodes::TooManyConcurrentOperations,
+                      str::stream()
+                          << "admission class \"" << key << "\" has reached its limit of " << limit
+                          << " concurrent operations");
+        }
+    }
+
+    _classes[key].active++;
+    return Ticket(this, std::move(key));
+}
+
+void AdmissionControl::_release(const std::string& className) {
+    stdx::lock_guard<Latch> lk(_mutex);
+    auto it = _classes.find(className);
+    invariant(it != _classes.end());
+    invariant(it->second.active > 0);
+    if (--it->second.active == 0) {
+        _classes.erase(it);
+    }
+    // Queued operations of any class share the condition variable, so wake them all and let each
+    // re-check its own class's occupancy.
+    _slotFreed.notify_all();
+}
+
+}  // namespace mongo
@@ -0,0 +1,131 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <string>
+#include <utility>
+
+#include "mongo/base/string_data.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/util/string_map.h"
+
+namespace mongo {
+
+class OperationContext;
+class ServiceContext;
+
+/**
+ * Bounds the number of concurrently executing commands per admission class so that a single
+ * misbehaving tenant cannot monopolize the node. Operations are classified by the application
+ * name supplied in the driver's client metadata; operations without an application name, internal
+ * clients, and a small set of diagnostic commands bypass admission entirely.
+ *
+ * When a class is at its limit, new operations queue for up to
+ * 'admissionControlMaxQueueTimeMillis' for a slot to free up and are then failed with
+ * TooManyConcurrentOperations so the client sheds load instead of piling onto the node. The whole
+ * mechanism is disabled when 'admissionControlMaxConcurrentOpsPerClass' is zero (the default).
+ */
+class AdmissionControl {
+    AdmissionControl(const AdmissionControl&) = delete;
+    AdmissionControl& operator=(const AdmissionControl&) = delete;
+
+public:
+    AdmissionControl() = default;
+
+    static AdmissionControl& get(ServiceContext* svcCtx);
+
+    /**
+     * RAII handle for an admitted operation. Releases the class's execution slot on destruction.
+     * A default-constructed Ticket represents an operation that bypassed admission and releases
+     * nothing.
+     */
+    class Ticket {
+    public:
+        Ticket() = default;
+        Ticket(Ticket&& other) noexcept
+            : _control(std::exchange(other._control, nullptr)),
+              _className(std::move(other._className)) {}
+        Ticket& operator=(Ticket&& other) noexcept {
+            if (this != &other) {
+                reset();
+                _control = std::exchange(other._control, nullptr);
+                _className = std::move(other._className);
+            }
+            return *this;
+        }
+        ~Ticket() {
+            reset();
+        }
+
+        void reset() {
+            if (_control) {
+                _control->_release(_className);
+                _control = nullptr;
+            }
+        }
+
+    private:
+        friend class AdmissionControl;
+        Ticket(AdmissionControl* control, std::string className)
+            : _control(control), _className(std::move(className)) {}
+
+        AdmissionControl* _control = nullptr;
+        std::string _className;
+    };
+
+    /**
+     * Admits the operation into the class named 'className', blocking for up to
+     * 'admissionControlMaxQueueTimeMillis' when the class is at its concurrency limit.
+     *
+     * Throws TooManyConcurrentOperations when no slot frees up in time, or the interruption error
+     * if 'opCtx' is interrupted or reaches its deadline while queued.
+     */
+    Ticket admit(OperationContext* opCtx, StringData className);
+
+private:
+    struct ClassState {
+        int32_t active = 0;
+    };
+
+    void _release(const std::string& className);
+
+    Mutex _mutex = MONGO_MAKE_LATCH("AdmissionControl::_mutex");
+
+    // Signalled whenever any class releases a slot. Queued operations re-check their own class's
+    // occupancy under '_mutex'.
+    stdx::condition_variable _slotFreed;
+
+    // Only classes with at least one active operation have an entry; entries are erased when the
+    // last operation in the class completes.
+    StringMap<ClassState> _classes;
+};
+
+}  // namespace mongo
@@ -0,0 +1,109 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/admission_control.h"
+
+#include "mongo/db/admission_control_gen.h"
+#include "mongo/db/service_context_test_fixture.h"
+#include "mongo/unittest/unittest.h"
+#include "mongo/util/scopeguard.h"
+
+namespace mongo {
+namespace {
+
+class AdmissionControlTest : public ServiceContextTest {
+protected:
+    AdmissionControl& admissionControl() {
+        return AdmissionControl::get(getServiceContext());
+    }
+};
+
+TEST_F(AdmissionControlTest, DisabledByDefault) {
+    auto opCtx = makeOperationContext();
+    std::vector<AdmissionControl::Ticket> tickets;
+    for (int i = 0; i < 10; i++) {
+        tickets.push_back(admissionControl().admit(opCtx.get(), "app"));
+    }
+}
+
+TEST_F(AdmissionControlTest, OverLimitOperationsAreFastFailed) {
+    gAdmissionControlMaxConcurrentOpsPerClass.store(1);
+    ON_BLOCK_EXIT([] { gAdmissionControlMaxConcurrentOpsPerClass.store(0); });
+
+    auto opCtx = makeOperationContext();
+    auto ticket = admissionControl().admit(opCtx.get(), "app");
+    ASSERT_THROWS_CODE(admissionControl().admit(opCtx.get(), "app"),
+                       AssertionException,
+                       ErrorCodes::TooManyConcurrentOperations);
+
+    // Releasing the ticket frees the slot for the next operation in the class.
+    ticket.reset();
+    auto nextTicket = admissionControl().admit(opCtx.get(), "app");
+}
+
+TEST_F(AdmissionControlTest, ClassesAreIsolatedFromEachOther) {
+    gAdmissionControlMaxConcurrentOpsPerClass.store(1);
+    ON_BLOCK_EXIT([] { gAdmissionControlMaxConcurrentOpsPerClass.store(0); });
+
+    auto opCtx = makeOperationContext();
+    auto appTicket = admissionControl().admit(opCtx.get(), "app");
+    auto otherTicket = admissionControl().admit(opCtx.get(), "other");
+    ASSERT_THROWS_CODE(admissionControl().admit(opCtx.get(), "app"),
+                       AssertionException,
+                       ErrorCodes::TooManyConcurrentOperations);
+}
+
+TEST_F(AdmissionControlTest, OperationsWithoutClassBypassAdmission) {
+    gAdmissionControlMaxConcurrentOpsPerClass.store(1);
+    ON_BLOCK_EXIT([] { gAdmissionControlMaxConcurrentOpsPerClass.store(0); });
+
+    auto opCtx = makeOperationContext();
+    std::vector<AdmissionControl::Ticket> tickets;
+    for (int i = 0; i < 3; i++) {
+        tickets.push_back(admissionControl().admit(opCtx.get(), ""));
+    }
+}
+
+TEST_F(AdmissionControlTest, MovedFromTicketReleasesNothing) {
+    gAdmissionControlMaxConcurrentOpsPerClass.store(1);
+    ON_BLOCK_EXIT([] { gAdmissionControlMaxConcurrentOpsPerClass.store(0); });
+
+    auto opCtx = makeOperationContext();
+    auto ticket = admissionControl().admit(opCtx.get(), "app");
+    auto movedTicket = std::move(ticket);
+    ticket.reset();  // NOLINT(bugprone-use-after-move)
+    ASSERT_THROWS_CODE(admissionControl().admit(opCtx.get(), "app"),
+                       AssertionException,
+                       ErrorCodes::TooManyConcurrentOperations);
+}
+
+}  // namespace
+}  // namespace mongo
@@ -35,6 +35,7 @@ Copyright (C) 2018-present Percona and/or its affiliates. All rights reserved.
 #ifdef PERCONA_AUDIT_ENABLED
 
 #include <cstdio>
+#include <deque>
 #include <iostream>
 #include <string>
 
@@ -67,7 +68,10 @@ Copyright (C) 2018-present Percona and/or its affiliates. All rights reserved.
 #include "mongo/logger/logger.h"
 #include "mongo/logv2/log.h"
 #include "mongo/platform/mutex.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/concurrency/mutex.h"
+#include "mongo/util/concurrency/thread_name.h"
 #include "mongo/util/exit_code.h"
 #include "mongo/util/net/sock.h"
 #include "mongo/util/string_map.h"
@@ -139,8 +143,24 @@ namespace audit {
         FileAuditLog(const std::string &file, const BSONObj &filter)
             : WritableAuditLog(filter),
               _file(new AuditFile),
-              _fileName(file) {
+              _fileName(file),
+              _asyncQueueSize(auditOptions.asyncQueueSize),
+              _dropOnOverflow(auditOptions.asyncOverflowPolicy == "drop") {
             _file->open(file.c_str(), false, false);
+            if (auditOptions.async) {
+                _writerThread = stdx::thread([this] { writerThreadRun(); });
+            }
+        }
+
+        virtual ~FileAuditLog() {
+            if (_writerThread.joinable()) {
+                {
+                    stdx::lock_guard<Latch> lk(_queueMutex);
+                    _shutdown = true;
+                }
+                _queueNotEmpty.notify_one();
+                _writerThread.join();
+            }
         }
 
     protected:
@@ -149,6 +169,62 @@ namespace audit {
         virtual AuditLogFormatAdapter *createAdapter(const BSONObj &obj) const = 0;
 
         virtual void appendMatched(const BSONObj &obj) {
+            if (!_writerThread.joinable()) {
+                // Synchronous mode: write and fsync the event on the operation thread
+                // before it makes progress.
+                stdx::lock_guard<SimpleMutex> lck(_mutex);
+                writeUnlocked(obj);
+                fsyncUnlocked(obj);
+                return;
+            }
+
+            // Asynchronous mode: publish the encoded event into the bounded queue; the
+            // writer thread batches, formats and flushes with a group fsync.
+            stdx::unique_lock<Latch> lk(_queueMutex);
+            while (_queue.size() >= _asyncQueueSize) {
+                if (_dropOnOverflow) {
+                    // Bounded-loss policy: discard the event but account for it so the
+                    // writer records the size of the gap in the log.
+                    ++_droppedEvents;
+                    return;
+                }
+                // Back-pressure policy: block the operation until the writer drains the
+                // queue so no event is ever lost.
+                _queueNotFull.wait(lk);
+            }
+            _queue.push_back(obj.getOwned());
+            lk.unlock();
+            _queueNotEmpty.notify_one();
+        }
+
+        virtual void rotate() {
+            stdx::lock_guard<SimpleMutex> lck(_mutex);
+
+            // Close the current file.
+            _file.reset();
+
+            // Rename the current file
+            // Note: we append a timestamp to the file name.
+            std::stringstream ss;
+            ss << _fileName << "." << terseCurrentTime(false);
+            std::string s = ss.str();
+            int r = std::rename(_fileName.c_str(), s.c_str());
+            if (r != 0) {
+                LOGV2_ERROR(29016,
+                            "Could not rotate audit log, but continuing normally "
+                            "(error desc: {err_desc})",
+                            "err_desc"_attr = errnoWithDescription());
+            }
+
+            // Open a new file, with the same name as the original.
+            _file.reset(new AuditFile);
+            _file->open(_fileName.c_str(), false, false);
+        }
+
+    private:
+        // Writes a single event at the end of the file without fsyncing it.
+        // The caller must hold _mutex.
+        void writeUnlocked(const BSONObj &obj) {
             boost::scoped_ptr<AuditLogFormatAdapter> adapter(createAdapter(obj));
 
             // mongo::File does not have an "atomic append" operation.
@@ -163,10 +239,6 @@ namespace audit {
             // the kernel, the synchronization is still there).  This
             // is a good enough place as any.
             //
-            // We don't need the mutex around fsync, except to protect against concurrent
-            // logRotate destroying our pointer.  Welp.
-            stdx::lock_guard<SimpleMutex> lck(_mutex);
-
             // If pwrite performs a partial write, we don't want to
             // muck about figuring out how much it did write (hard to
             // get out of the File abstraction) and then carefully
@@ -213,7 +285,11 @@ namespace audit {
                     "err_desc"_attr = errnoWithDescription(writeRet));
                 realexit(EXIT_AUDIT_ERROR);
             }
+        }
 
+        // Makes previously written events durable. The caller must hold _mutex. 'obj' is the
+        // most recent event covered by this fsync and is only used for error reporting.
+        void fsyncUnlocked(const BSONObj &obj) {
             int fsyncRet;
             for (int retries = 10; retries > 0; --retries) {
                 fsyncRet = _file->fsyncReturningError();
@@ -254,35 +330,71 @@ namespace audit {
             }
         }
 
-        virtual void rotate() {
-            stdx::lock_guard<SimpleMutex> lck(_mutex);
+        // Synthesizes an event recording how many events were discarded by the 'drop'
+        // overflow policy, so the log itself shows where the gap is.
+        BSONObj makeDroppedEventsNote(uint64_t dropped) const {
+            return BSON("atype" << "auditLogDroppedEvents"
+                        << "ts" << jsTime()
+                        << "param" << BSON("count" << static_cast<long long>(dropped))
+                        << "result" << 0);
+        }
 
-            // Close the current file.
-            _file.reset();
+        void writerThreadRun() {
+            setThreadName("auditWriter");
 
-            // Rename the current file
-            // Note: we append a timestamp to the file name.
-            std::stringstream ss;
-            ss << _fileName << "." << terseCurrentTime(false);
-            std::string s = ss.str();
-            int r = std::rename(_fileName.c_str(), s.c_str());
-            if (r != 0) {
-                LOGV2_ERROR(29016,
-                            "Could not rotate audit log, but continuing normally "
-                            "(error desc: {err_desc})",
-                            "err_desc"_attr = errnoWithDescription());
+            std::deque<BSONObj> batch;
+            for (;;) {
+                uint64_t dropped;
+                {
+                    stdx::unique_lock<Latch> lk(_queueMutex);
+                    _queueNotEmpty.wait(lk, [this] { return !_queue.empty() || _shutdown; });
+                    batch.swap(_queue);
+                    dropped = _droppedEvents;
+                    _droppedEvents = 0;
+                }
+                if (batch.empty() && dropped == 0) {
+                    // Only possible at shutdown: the wait predicate guarantees there was
+                    // work to do otherwise.
+                    return;
+                }
+                _queueNotFull.notify_all();
+
+                // A single fsync covers the whole batch, so the cost of making events
+                // durable is amortized across everything queued while the previous flush
+                // was in progress.
+                stdx::lock_guard<SimpleMutex> lck(_mutex);
+                if (dropped > 0) {
+                    LOGV2_WARNING(29054,
+                        "Audit system dropped {count} event(s) because the asynchronous "
+                        "audit queue was full",
+                        "count"_attr = dropped);
+                    batch.push_back(makeDroppedEventsNote(dropped));
+                }
+                for (const auto& obj : batch) {
+                    writeUnlocked(obj);
+                }
+                fsyncUnlocked(batch.back());
+                batch.clear();
             }
-
-            // Open a new file, with the same name as the original.
-            _file.reset(new AuditFile);
-            _file->open(_fileName.c_str(), false, false);
         }
 
-    private:
         boost::scoped_ptr<AuditFile> _file;
         const std::string _fileName;
         SimpleMutex _mutex;
-    };    
+
+        // Asynchronous writer state. Operation threads publish encoded events into the
+        // bounded queue; the writer thread drains it in batches. Only used when
+        // auditLog.async is set.
+        Mutex _queueMutex = MONGO_MAKE_LATCH("FileAuditLog::_queueMutex");
+        stdx::condition_variable _queueNotEmpty;
+        stdx::condition_variable _queueNotFull;
+        std::deque<BSONObj> _queue;
+        uint64_t _droppedEvents = 0;
+        bool _shutdown = false;
+        const size_t _asyncQueueSize;
+        const bool _dropOnOverflow;
+        stdx::thread _writerThread;
+    };
 
     // Writes audit events to a json file
     class JSONAuditLog: public FileAuditLog {
@@ -50,7 +50,10 @@ namespace mongo {
 
     AuditOptions::AuditOptions():
         format("JSON"),
-        filter("{}")
+        filter("{}"),
+        async(false),
+        asyncQueueSize(4096),
+        asyncOverflowPolicy("block")
     {
     }
 
@@ -58,7 +61,10 @@ namespace mongo {
         return BSON("format" << format <<
                     "path" << path <<
                     "destination" << destination <<
-                    "filter" << filter);
+                    "filter" << filter <<
+                    "async" << async <<
+                    "asyncQueueSize" << asyncQueueSize <<
+                    "asyncOverflowPolicy" << asyncOverflowPolicy);
     }
 
     Status storeAuditOptions(const optionenvironment::Environment& params) {
@@ -106,6 +112,34 @@ namespace mongo {
                 params["auditLog.path"].as<std::string>();
         }
 
+        if (params.count("auditLog.async")) {
+            auditOptions.async =
+                params["auditLog.async"].as<bool>();
+        }
+        if (auditOptions.async && auditOptions.destination != "file") {
+            return Status(ErrorCodes::BadValue,
+                          "Asynchronous audit log writes are only allowed when audit log destination is a 'file'");
+        }
+
+        if (params.count("auditLog.asyncQueueSize")) {
+            auditOptions.asyncQueueSize =
+                params["auditLog.asyncQueueSize"].as<int>();
+        }
+        if (auditOptions.asyncQueueSize < 1) {
+            return Status(ErrorCodes::BadValue,
+                          "auditLog.asyncQueueSize must be at least 1");
+        }
+
+        if (params.count("auditLog.asyncOverflowPolicy")) {
+            auditOptions.asyncOverflowPolicy =
+                params["auditLog.asyncOverflowPolicy"].as<std::string>();
+        }
+        if (auditOptions.asyncOverflowPolicy != "block" &&
+            auditOptions.asyncOverflowPolicy != "drop") {
+            return Status(ErrorCodes::BadValue,
+                          "Supported audit log overflow policies are 'block' and 'drop'");
+        }
+
         return Status::OK();
     }
 
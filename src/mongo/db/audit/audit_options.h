@@ -61,6 +61,15 @@ namespace optionenvironment {
         // Event destination file path and name, eg '/data/db/audit.json'
         std::string path;
 
+        // Write events asynchronously on a background thread with group fsync
+        bool async;
+
+        // Maximum number of events buffered for the asynchronous writer
+        int asyncQueueSize;
+
+        // Behavior when the asynchronous queue is full: 'block' or 'drop'
+        std::string asyncOverflowPolicy;
+
         AuditOptions();
         BSONObj toBSON();
     };
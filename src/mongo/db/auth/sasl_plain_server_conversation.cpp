@@ -33,18 +33,80 @@
 
 #include "mongo/db/auth/sasl_plain_server_conversation.h"
 
+#include <boost/optional.hpp>
+
+#include "mongo/base/data_range.h"
 #include "mongo/base/init.h"
 #include "mongo/base/status.h"
 #include "mongo/base/string_data.h"
 #include "mongo/crypto/mechanism_scram.h"
+#include "mongo/crypto/sha256_block.h"
 #include "mongo/db/auth/sasl_mechanism_registry.h"
 #include "mongo/db/auth/user.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/unordered_map.h"
 #include "mongo/util/base64.h"
 #include "mongo/util/password_digest.h"
 #include "mongo/util/text.h"
+#include "mongo/util/time_support.h"
 
 namespace mongo {
 namespace {
+
+/**
+ * Memoizes the outcome of PBKDF2-derived credential verification. Key
+ * derivation with scramIterationCount rounds dominates the cost of PLAIN
+ * authentication and is identical across reconnects of the same user, so a
+ * reconnect storm would otherwise peg the CPU re-deriving the same salted
+ * password thousands of times. Entries are keyed by a one-way digest of the
+ * stored credentials and the presented password: a cached verdict is reused
+ * with a single hash, and a password change alters the stored key and thus
+ * misses the cache immediately. Entries additionally expire after a strict
+ * TTL and the cache is bounded in size.
+ */
+class ScramVerificationCache {
+public:
+    boost::optional<bool> lookup(const SHA256Block& key) {
+        const Date_t now = Date_t::now();
+        stdx::lock_guard<Latch> lk(_mutex);
+        auto it = _entries.find(key);
+        if (it == _entries.end())
+            return boost::none;
+        if (now >= it->second.expires) {
+            _entries.erase(it);
+            return boost::none;
+        }
+        return it->second.matched;
+    }
+
+    void store(const SHA256Block& key, bool matched) {
+        const Date_t now = Date_t::now();
+        stdx::lock_guard<Latch> lk(_mutex);
+        if (_entries.size() >= kMaxEntries) {
+            for (auto it = _entries.begin(); it != _entries.end();) {
+                it = now >= it->second.expires ? _entries.erase(it) : std::next(it);
+            }
+            if (_entries.size() >= kMaxEntries)
+                _entries.clear();
+        }
+        _entries[key] = {matched, now + kTTL};
+    }
+
+private:
+    struct Entry {
+        bool matched;
+        Date_t expires;
+    };
+
+    static constexpr Seconds kTTL{60};
+    static constexpr size_t kMaxEntries = 10000;
+
+    Mutex _mutex = MONGO_MAKE_LATCH("ScramVerificationCache::_mutex");
+    stdx::unordered_map<SHA256Block, Entry, SHA256Block::Hash> _entries;
+};
+
+ScramVerificationCache verificationCache;
+
 template <typename HashBlock>
 StatusWith<bool> trySCRAM(const User::CredentialData& credentials, StringData pwd) {
     const auto scram = credentials.scram<HashBlock>();
@@ -53,6 +115,20 @@ StatusWith<bool> trySCRAM(const User::CredentialData& credentials, StringData pw
         return false;
     }
 
+    const std::int32_t iterationCount = scram.iterationCount;
+    const auto cacheKey = SHA256Block::computeHash(
+        {ConstDataRange(scram.storedKey.c_str(), scram.storedKey.size()),
+         ConstDataRange(scram.salt.c_str(), scram.salt.size()),
+         ConstDataRange(reinterpret_cast<const char*>(&iterationCount), sizeof(iterationCount)),
+         ConstDataRange(pwd.rawData(), pwd.size())});
+    if (auto matched = verificationCache.lookup(cacheKey)) {
+        if (*matched) {
+            return true;
+        }
+        return Status(ErrorCodes::AuthenticationFailed,
+                      str::stream() << "Incorrect user name or password");
+    }
+
     const auto decodedSalt = base64::decode(scram.salt);
     scram::Secrets<HashBlock, scram::UnlockedSecretsPolicy> secrets(scram::Presecrets<HashBlock>(
         pwd.toString(),
@@ -60,9 +136,11 @@ StatusWith<bool> trySCRAM(const User::CredentialData& credentials, StringData pw
                                   reinterpret_cast<const std::uint8_t*>(decodedSalt.c_str()) +
                                       decodedSalt.size()),
         scram.iterationCount));
-    if (scram.storedKey !=
+    const bool matched = scram.storedKey ==
         base64::encode(StringData(reinterpret_cast<const char*>(secrets.storedKey().data()),
-                                  secrets.storedKey().size()))) {
+                                  secrets.storedKey().size()));
+    verificationCache.store(cacheKey, matched);
+    if (!matched) {
         return Status(ErrorCodes::AuthenticationFailed,
                       str::stream() << "Incorrect user name or password");
     }
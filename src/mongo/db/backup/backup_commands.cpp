@@ -55,7 +55,10 @@ public:
     virtual std::string help() const override {
         return "Creates a hot backup, into the given directory, of the files currently in the "
                "storage engine's data directory.\n"
-               "{ createBackup: 1, backupDir: <destination directory> }";
+               "{ createBackup: 1, backupDir: <destination directory> }\n"
+               "Directory backups also accept 'incrementalBackup', 'thisBackupName', "
+               "'srcBackupName' and 'rateLimitMBps' fields to copy only blocks changed "
+               "since a previous named backup and to throttle backup reads.";
     }
     Status checkAuthForCommand(Client* client,
                                const std::string& dbname,
@@ -96,6 +99,17 @@ bool CreateBackupCommand::errmsgRun(mongo::OperationContext* opCtx,
         return false;
     }
 
+    // Incremental and throttle related fields are only supported for 'backupDir' destination
+    if (!destPathElem) {
+        for (auto&& fieldName : {"incrementalBackup", "thisBackupName", "srcBackupName", "rateLimitMBps"}) {
+            if (cmdObj[fieldName]) {
+                errmsg = str::stream()
+                    << "'" << fieldName << "' field can only be used with 'backupDir' destination";
+                return false;
+            }
+        }
+    }
+
     Status status{Status::OK()};
 
     if (destPathElem) {
@@ -116,12 +130,55 @@ bool CreateBackupCommand::errmsgRun(mongo::OperationContext* opCtx,
             return false;
         }
 
+        percona::DirectoryBackupParameters params;
+        params.path = dest;
+        if (BSONElement elem = cmdObj["incrementalBackup"]) {
+            if (!elem.isBoolean()) {
+                errmsg = "'incrementalBackup' field must be a boolean";
+                return false;
+            }
+            params.incremental = elem.Bool();
+        }
+        if (BSONElement elem = cmdObj["thisBackupName"]) {
+            if (elem.type() != BSONType::String) {
+                errmsg = "'thisBackupName' field must be a string";
+                return false;
+            }
+            params.thisBackupName = elem.String();
+        }
+        if (BSONElement elem = cmdObj["srcBackupName"]) {
+            if (elem.type() != BSONType::String) {
+                errmsg = "'srcBackupName' field must be a string";
+                return false;
+            }
+            params.srcBackupName = elem.String();
+        }
+        if (BSONElement elem = cmdObj["rateLimitMBps"]) {
+            if (!elem.isNumber()) {
+                errmsg = "'rateLimitMBps' field must be a number";
+                return false;
+            }
+            params.rateLimitMBps = elem.numberInt();
+            if (params.rateLimitMBps < 0) {
+                errmsg = "'rateLimitMBps' field must be non-negative";
+                return false;
+            }
+        }
+        if (params.incremental && params.thisBackupName.empty()) {
+            errmsg = "incremental backup requires non-empty 'thisBackupName' field";
+            return false;
+        }
+        if (!params.incremental && (!params.thisBackupName.empty() || !params.srcBackupName.empty())) {
+            errmsg = "'thisBackupName' and 'srcBackupName' fields require 'incrementalBackup: true'";
+            return false;
+        }
+
         // Flush all files first.
         auto se = getGlobalServiceContext()->getStorageEngine();
         se->flushAllFiles(opCtx, true);
 
         // Do the backup itself.
-        status = se->hotBackup(opCtx, dest);
+        status = se->hotBackup(opCtx, params);
 
     } else if (archiveElem) {
         if (archiveElem.type() != BSONType::String) {
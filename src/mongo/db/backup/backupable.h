@@ -41,6 +41,14 @@ namespace mongo {
 
 namespace percona {
 
+struct DirectoryBackupParameters {
+    std::string path;  // destination directory (must be absolute)
+    bool incremental{false};  // copy only blocks changed since 'srcBackupName'
+    std::string thisBackupName;  // identifier the engine stores to serve future incrementals
+    std::string srcBackupName;  // previous backup identifier; empty means take a full copy
+    int rateLimitMBps{0};  // limit on backup read bandwidth, 0 means unlimited
+};
+
 struct S3BackupParameters {
     std::string profile;  // empty value means default profile
     std::string region;  // empty value means default region (US_EAST_1)
@@ -70,6 +78,18 @@ struct Backupable {
                              "This engine doesn't support hot backup.");
     }
 
+    /**
+     * Perform hot backup into a directory with optional incremental block
+     * copy and read throttling.
+     * @param params destination path and incremental/throttle settings.
+     * @return Status code of the operation.
+     */
+    virtual mongo::Status hotBackup(mongo::OperationContext* opCtx,
+                                    const DirectoryBackupParameters& params) {
+        return mongo::Status(mongo::ErrorCodes::IllegalOperation,
+                             "This engine doesn't support incremental hot backup.");
+    }
+
     /**
      * Perform hot backup into the file/stream in the tar archive format.
      * @param path destination path to perform backup into.
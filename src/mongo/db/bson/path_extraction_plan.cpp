@@ -0,0 +1,102 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/bson/path_extraction_plan.h"
+
+#include "mongo/bson/bsonobjiterator.h"
+#include "mongo/util/assert_util.h"
+
+namespace mongo {
+
+PathExtractionPlan::PathExtractionPlan(StringData path) {
+    size_t start = 0;
+    while (true) {
+        const size_t dot = path.find('.', start);
+        if (dot == std::string::npos) {
+            _parts.push_back(path.substr(start).toString());
+            break;
+        }
+        _parts.push_back(path.substr(start, dot - start).toString());
+        start = dot + 1;
+    }
+    _positionHints.resize(_parts.size(), 0);
+}
+
+BSONElement PathExtractionPlan::_findField(const BSONObj& obj, size_t level) {
+    const StringData name = _parts[level];
+    size_t& hint = _positionHints[level];
+
+    // Fast path: skip straight to the memoized position and confirm the field name there.
+    BSONObjIterator it(obj);
+    for (size_t skipped = 0; skipped < hint && it.more(); ++skipped) {
+        it.next();
+    }
+    if (it.more()) {
+        BSONElement candidate = it.next();
+        if (name == candidate.fieldNameStringData()) {
+            return candidate;
+        }
+    }
+
+    // The document's shape differs from the previous one; scan by name and re-learn the position.
+    size_t position = 0;
+    for (BSONObjIterator scan(obj); scan.more(); ++position) {
+        BSONElement elem = scan.next();
+        if (name == elem.fieldNameStringData()) {
+            hint = position;
+            return elem;
+        }
+    }
+    return BSONElement();
+}
+
+BSONElement PathExtractionPlan::extract(const BSONObj& obj, bool* stoppedAtArray) {
+    *stoppedAtArray = false;
+
+    BSONObj current = obj;
+    for (size_t level = 0; level < _parts.size(); ++level) {
+        BSONElement elem = _findField(current, level);
+        if (level + 1 == _parts.size()) {
+            return elem;
+        }
+        if (elem.type() == Object) {
+            current = elem.embeddedObject();
+        } else if (elem.type() == Array) {
+            *stoppedAtArray = true;
+            return elem;
+        } else {
+            return BSONElement();
+        }
+    }
+    MONGO_UNREACHABLE;
+}
+
+}  // namespace mongo
@@ -0,0 +1,75 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "mongo/bson/bsonobj.h"
+
+namespace mongo {
+
+/**
+ * A pre-resolved extraction plan for one dotted path, for callers that extract the same path from
+ * many documents in sequence, as a scan does. The plan memoizes, per path component, the element
+ * position at which the field was found in the previous document. Collections are typically
+ * shape-homogeneous, so the next document usually holds the field at the same position and the
+ * lookup skips straight to it and confirms the field name, instead of comparing the name against
+ * every preceding field. When the memoized position does not pan out, the lookup falls back to a
+ * full scan of the object and re-learns the position, so results never depend on the memoized
+ * state.
+ *
+ * Byte offsets of elements are deliberately not memoized: documents with variable-length values
+ * shift offsets even when their shapes match, and bytes at a stale offset cannot be validated as
+ * an element boundary without re-walking the object.
+ *
+ * A plan is not thread-safe; it belongs to a single execution context, like the stage that owns
+ * it.
+ */
+class PathExtractionPlan {
+public:
+    explicit PathExtractionPlan(StringData path);
+
+    /**
+     * Returns the element 'obj' holds at the plan's path, descending only through objects, or EOO
+     * when the path is missing. If an array is encountered before the final path component, stops
+     * and returns the array element itself with '*stoppedAtArray' set to true; callers that need
+     * implicit array traversal must handle that case themselves.
+     */
+    BSONElement extract(const BSONObj& obj, bool* stoppedAtArray);
+
+private:
+    BSONElement _findField(const BSONObj& obj, size_t level);
+
+    std::vector<std::string> _parts;
+    std::vector<size_t> _positionHints;
+};
+
+}  // namespace mongo
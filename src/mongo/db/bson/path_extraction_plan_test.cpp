@@ -0,0 +1,103 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/bson/path_extraction_plan.h"
+
+#include "mongo/db/jsobj.h"
+#include "mongo/db/json.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+TEST(PathExtractionPlanTest, ExtractsTopLevelFieldAcrossShapes) {
+    PathExtractionPlan plan("b");
+    bool stoppedAtArray = false;
+
+    // Same shape twice: the second lookup takes the memoized position.
+    ASSERT_EQ(plan.extract(fromjson("{a: 1, b: 2, c: 3}"), &stoppedAtArray).numberInt(), 2);
+    ASSERT_EQ(plan.extract(fromjson("{a: 9, b: 8, c: 7}"), &stoppedAtArray).numberInt(), 8);
+
+    // A different shape must re-learn the position and still find the field.
+    ASSERT_EQ(plan.extract(fromjson("{b: 5}"), &stoppedAtArray).numberInt(), 5);
+    ASSERT_EQ(plan.extract(fromjson("{x: 1, y: 2, z: 3, b: 4}"), &stoppedAtArray).numberInt(), 4);
+    ASSERT_FALSE(stoppedAtArray);
+}
+
+TEST(PathExtractionPlanTest, ExtractsDottedPath) {
+    PathExtractionPlan plan("a.b.c");
+    bool stoppedAtArray = false;
+
+    ASSERT_EQ(plan.extract(fromjson("{a: {b: {c: 42}}}"), &stoppedAtArray).numberInt(), 42);
+    ASSERT_EQ(plan.extract(fromjson("{x: 0, a: {y: 0, b: {c: 43}}}"), &stoppedAtArray).numberInt(),
+              43);
+    ASSERT_FALSE(stoppedAtArray);
+}
+
+TEST(PathExtractionPlanTest, MissingPathYieldsEOO) {
+    PathExtractionPlan plan("a.b");
+    bool stoppedAtArray = false;
+
+    ASSERT_TRUE(plan.extract(fromjson("{}"), &stoppedAtArray).eoo());
+    ASSERT_TRUE(plan.extract(fromjson("{a: {}}"), &stoppedAtArray).eoo());
+    // A scalar in the middle of the path terminates the walk.
+    ASSERT_TRUE(plan.extract(fromjson("{a: 3}"), &stoppedAtArray).eoo());
+    ASSERT_FALSE(stoppedAtArray);
+}
+
+TEST(PathExtractionPlanTest, StopsAtInteriorArray) {
+    PathExtractionPlan plan("a.b");
+    bool stoppedAtArray = false;
+
+    BSONObj obj = fromjson("{a: [{b: 1}, {b: 2}]}");
+    BSONElement elem = plan.extract(obj, &stoppedAtArray);
+    ASSERT_TRUE(stoppedAtArray);
+    ASSERT_EQ(elem.type(), Array);
+
+    // A leaf array is returned as the element itself, not reported as a stop.
+    PathExtractionPlan leafPlan("a");
+    elem = leafPlan.extract(fromjson("{a: [1, 2]}"), &stoppedAtArray);
+    ASSERT_FALSE(stoppedAtArray);
+    ASSERT_EQ(elem.type(), Array);
+}
+
+TEST(PathExtractionPlanTest, StalePositionHintIsIgnored) {
+    PathExtractionPlan plan("b");
+    bool stoppedAtArray = false;
+
+    // Learn a position beyond the next document's field count.
+    ASSERT_EQ(plan.extract(fromjson("{a: 1, x: 1, y: 1, b: 2}"), &stoppedAtArray).numberInt(), 2);
+    ASSERT_EQ(plan.extract(fromjson("{b: 3}"), &stoppedAtArray).numberInt(), 3);
+    ASSERT_TRUE(plan.extract(fromjson("{a: 1}"), &stoppedAtArray).eoo());
+}
+
+}  // namespace
+}  // namespace mongo
@@ -68,6 +68,7 @@ class OperationContext;
 class RecordCursor;
 class UpdateDriver;
 class UpdateRequest;
+class ValidatorShapeCache;
 
 /**
  * Holds information update an update operation.
@@ -229,6 +230,13 @@ public:
          * pointers into _validatorDoc.
          */
         StatusWithMatchExpression filter = {nullptr};
+
+        /**
+         * Memoized verdicts keyed by document shape. Only non-null when 'filter' depends solely
+         * on document shape, which makes per-shape memoization sound. Replaced along with the
+         * rest of the validator whenever it changes.
+         */
+        std::shared_ptr<ValidatorShapeCache> shapeCache;
     };
 
     /**
@@ -207,6 +207,7 @@ void CollectionCatalog::setCollectionNamespace(OperationContext* opCtx,
 
     _collections[toCollection] = _collections[fromCollection];
     _collections.erase(fromCollection);
+    _invalidateLookupSnapshot(lock);
 
     ResourceId oldRid = ResourceId(RESOURCE_COLLECTION, fromCollection.ns());
     ResourceId newRid = ResourceId(RESOURCE_COLLECTION, toCollection.ns());
@@ -220,6 +221,7 @@ void CollectionCatalog::setCollectionNamespace(OperationContext* opCtx,
 
         _collections[fromCollection] = _collections[toCollection];
         _collections.erase(toCollection);
+        _invalidateLookupSnapshot(lock);
 
         ResourceId oldRid = ResourceId(RESOURCE_COLLECTION, fromCollection.ns());
         ResourceId newRid = ResourceId(RESOURCE_COLLECTION, toCollection.ns());
@@ -251,13 +253,56 @@ void CollectionCatalog::onOpenCatalog(OperationContext* opCtx) {
     _shadowCatalog.reset();
 }
 
+std::shared_ptr<const CollectionCatalog::LookupSnapshot> CollectionCatalog::_loadLookupSnapshot()
+    const {
+    return std::atomic_load_explicit(&_lookupSnapshot, std::memory_order_acquire);
+}
+
+std::shared_ptr<const CollectionCatalog::LookupSnapshot> CollectionCatalog::_rebuildLookupSnapshot(
+    WithLock) const {
+    auto snapshot = std::make_shared<LookupSnapshot>();
+    snapshot->byUUID.reserve(_catalog.size());
+    snapshot->byNamespace.reserve(_catalog.size());
+    snapshot->uuidToNss.reserve(_catalog.size());
+    for (auto& entry : _catalog) {
+        Collection* coll = entry.second.get();
+        if (!coll->isCommitted())
+            continue;
+        auto nss = coll->ns();
+        snapshot->byUUID[entry.first] = coll;
+        snapshot->byNamespace[nss] = coll;
+        snapshot->uuidToNss[entry.first] = std::move(nss);
+    }
+    std::atomic_store_explicit(&_lookupSnapshot,
+                               std::shared_ptr<const LookupSnapshot>(snapshot),
+                               std::memory_order_release);
+    return snapshot;
+}
+
+void CollectionCatalog::_invalidateLookupSnapshot(WithLock) const {
+    std::atomic_store_explicit(&_lookupSnapshot,
+                               std::shared_ptr<const LookupSnapshot>(),
+                               std::memory_order_release);
+}
+
 Collection* CollectionCatalog::lookupCollectionByUUID(OperationContext* opCtx,
                                                       CollectionUUID uuid) const {
     if (auto coll = UncommittedCollections::getForTxn(opCtx, uuid)) {
         return coll;
     }
 
+    if (auto snapshot = _loadLookupSnapshot()) {
+        auto it = snapshot->byUUID.find(uuid);
+        if (it != snapshot->byUUID.end()) {
+            return it->second;
+        }
+        // A miss isn't authoritative; fall through to the locked path below.
+    }
+
     stdx::lock_guard<Latch> lock(_catalogLock);
+    if (!_loadLookupSnapshot()) {
+        _rebuildLookupSnapshot(lock);
+    }
     auto coll = _lookupCollectionByUUID(lock, uuid);
     return (coll && coll->isCommitted()) ? coll : nullptr;
 }
@@ -266,6 +311,7 @@ void CollectionCatalog::makeCollectionVisible(CollectionUUID uuid) {
     stdx::lock_guard<Latch> lock(_catalogLock);
     auto coll = _lookupCollectionByUUID(lock, uuid);
     coll->setCommitted(true);
+    _invalidateLookupSnapshot(lock);
 }
 
 bool CollectionCatalog::isCollectionAwaitingVisibility(CollectionUUID uuid) const {
@@ -285,7 +331,18 @@ Collection* CollectionCatalog::lookupCollectionByNamespace(OperationContext* opC
         return coll;
     }
 
+    if (auto snapshot = _loadLookupSnapshot()) {
+        auto it = snapshot->byNamespace.find(nss);
+        if (it != snapshot->byNamespace.end()) {
+            return it->second;
+        }
+        // A miss isn't authoritative; fall through to the locked path below.
+    }
+
     stdx::lock_guard<Latch> lock(_catalogLock);
+    if (!_loadLookupSnapshot()) {
+        _rebuildLookupSnapshot(lock);
+    }
     auto it = _collections.find(nss);
     auto coll = (it == _collections.end() ? nullptr : it->second);
     return (coll && coll->isCommitted()) ? coll : nullptr;
@@ -297,6 +354,14 @@ boost::optional<NamespaceString> CollectionCatalog::lookupNSSByUUID(OperationCon
         return coll->ns();
     }
 
+    if (auto snapshot = _loadLookupSnapshot()) {
+        auto it = snapshot->uuidToNss.find(uuid);
+        if (it != snapshot->uuidToNss.end()) {
+            return it->second;
+        }
+        // A miss isn't authoritative; fall through to the locked path below.
+    }
+
     stdx::lock_guard<Latch> lock(_catalogLock);
     auto foundIt = _catalog.find(uuid);
     if (foundIt != _catalog.end()) {
@@ -452,6 +517,7 @@ void CollectionCatalog::registerCollection(CollectionUUID uuid, std::unique_ptr<
     _catalog[uuid] = std::move(*coll);
     _collections[ns] = _catalog[uuid].get();
     _orderedCollections[dbIdPair] = _catalog[uuid].get();
+    _invalidateLookupSnapshot(lock);
 
     auto dbRid = ResourceId(RESOURCE_DATABASE, dbName);
     addResource(dbRid, dbName);
@@ -479,6 +545,7 @@ std::unique_ptr<Collection> CollectionCatalog::deregisterCollection(CollectionUU
     _orderedCollections.erase(dbIdPair);
     _collections.erase(ns);
     _catalog.erase(uuid);
+    _invalidateLookupSnapshot(lock);
 
     auto collRid = ResourceId(RESOURCE_COLLECTION, ns.ns());
     removeResource(collRid, ns.ns());
@@ -514,6 +581,7 @@ void CollectionCatalog::deregisterAllCollections() {
     _collections.clear();
     _orderedCollections.clear();
     _catalog.clear();
+    _invalidateLookupSnapshot(lock);
 
     stdx::lock_guard<Latch> resourceLock(_resourceLock);
     _resourceInformation.clear();
@@ -31,6 +31,7 @@
 
 #include <functional>
 #include <map>
+#include <memory>
 #include <set>
 
 #include "mongo/db/catalog/collection.h"
@@ -258,6 +259,24 @@ public:
 private:
     friend class CollectionCatalog::iterator;
 
+    /**
+     * Immutable copy of the hot lookup maps, containing only committed collections. Readers load
+     * it with an atomic shared_ptr operation and probe it without taking '_catalogLock'; any
+     * mutation of the catalog throws the snapshot away, and the next locked lookup rebuilds it.
+     * This keeps the per-CRUD-op lookups wait-free while only DDL pays for copies. A snapshot
+     * miss is never authoritative -- readers fall back to the locked path, which also consults
+     * uncommitted collections and the shadow catalog.
+     */
+    struct LookupSnapshot {
+        stdx::unordered_map<CollectionUUID, Collection*, CollectionUUID::Hash> byUUID;
+        stdx::unordered_map<NamespaceString, Collection*> byNamespace;
+        stdx::unordered_map<CollectionUUID, NamespaceString, CollectionUUID::Hash> uuidToNss;
+    };
+
+    std::shared_ptr<const LookupSnapshot> _loadLookupSnapshot() const;
+    std::shared_ptr<const LookupSnapshot> _rebuildLookupSnapshot(WithLock) const;
+    void _invalidateLookupSnapshot(WithLock) const;
+
     Collection* _lookupCollectionByUUID(WithLock, CollectionUUID uuid) const;
 
     const std::vector<CollectionUUID>& _getOrdering_inlock(const StringData& db,
@@ -280,6 +299,9 @@ private:
     OrderedCollectionMap _orderedCollections;  // Ordered by <dbName, collUUID> pair
     NamespaceCollectionMap _collections;
 
+    // Accessed only via std::atomic_load/std::atomic_store; see LookupSnapshot.
+    mutable std::shared_ptr<const LookupSnapshot> _lookupSnapshot;
+
     /**
      * Generation number to track changes to the catalog that could invalidate iterators.
      */
@@ -46,6 +46,7 @@
 #include "mongo/db/catalog/index_catalog_impl.h"
 #include "mongo/db/catalog/index_consistency.h"
 #include "mongo/db/catalog/index_key_validate.h"
+#include "mongo/db/catalog/validator_shape_cache.h"
 #include "mongo/db/clientcursor.h"
 #include "mongo/db/commands/server_status_metric.h"
 #include "mongo/db/concurrency/d_concurrency.h"
@@ -54,6 +55,7 @@
 #include "mongo/db/index/index_access_method.h"
 #include "mongo/db/index/index_descriptor.h"
 #include "mongo/db/keypattern.h"
+#include "mongo/db/matcher/expression_algo.h"
 #include "mongo/db/matcher/expression_parser.h"
 #include "mongo/db/op_observer.h"
 #include "mongo/db/operation_context.h"
@@ -373,7 +375,23 @@ Status CollectionImpl::checkValidation(OperationContext* opCtx, const BSONObj& d
     if (documentValidationDisabled(opCtx))
         return Status::OK();
 
-    if (validatorMatchExpr->matchesBSON(document))
+    // When the validator depends only on document shape, its verdict is memoized per shape:
+    // repeated writes of identically-shaped documents skip the match expression entirely.
+    boost::optional<std::string> shapeKey;
+    boost::optional<bool> matched;
+    if (_validator.shapeCache) {
+        shapeKey = ValidatorShapeCache::computeShapeKey(document);
+        matched = _validator.shapeCache->lookup(*shapeKey);
+    }
+
+    if (!matched) {
+        matched = validatorMatchExpr->matchesBSON(document);
+        if (shapeKey) {
+            _validator.shapeCache->insert(std::move(*shapeKey), *matched);
+        }
+    }
+
+    if (*matched)
         return Status::OK();
 
     if (_validationAction == ValidationAction::WARN) {
@@ -430,8 +448,17 @@ Collection::Validator CollectionImpl::parseValidator(
             statusWithMatcher.getStatus().withContext("Parsing of collection validator failed")};
     }
 
+    auto filter = std::move(statusWithMatcher.getValue());
+
+    // Shape-only validators (e.g. a $jsonSchema of type and required constraints) qualify for
+    // per-shape verdict memoization; see ValidatorShapeCache.
+    std::shared_ptr<ValidatorShapeCache> shapeCache;
+    if (filter && expression::dependsOnlyOnDocumentShape(*filter)) {
+        shapeCache = std::make_shared<ValidatorShapeCache>();
+    }
+
     return Collection::Validator{
-        validator, std::move(expCtx), std::move(statusWithMatcher.getValue())};
+        validator, std::move(expCtx), std::move(filter), std::move(shapeCache)};
 }
 
 Status CollectionImpl::insertDocumentsForOplog(OperationContext* opCtx,
@@ -55,6 +55,7 @@
 #include "mongo/db/storage/write_unit_of_work.h"
 #include "mongo/logv2/log.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/progress_meter.h"
 #include "mongo/util/quick_exit.h"
@@ -390,39 +391,49 @@ Status MultiIndexBlock::insertAllDocumentsInCollection(OperationContext* opCtx,
     bool readOnce = useReadOnceCursorsForIndexBuilds.load();
     opCtx->recoveryUnit()->setReadOnce(readOnce);
 
-    BSONObj objToIndex;
-    RecordId loc;
-    PlanExecutor::ExecState state;
-    while (PlanExecutor::ADVANCED == (state = exec->getNext(&objToIndex, &loc)) ||
-           MONGO_unlikely(hangAfterStartingIndexBuild.shouldFail())) {
-        auto interruptStatus = opCtx->checkForInterruptNoAssert();
-        if (!interruptStatus.isOK())
-            return opCtx->checkForInterruptNoAssert();
-
-        if (PlanExecutor::ADVANCED != state) {
-            continue;
+    const size_t numKeyGenerators = std::min(
+        static_cast<size_t>(indexBuildKeyGenerationConcurrency.load()), _indexes.size());
+    if (numKeyGenerators > 1) {
+        Status scanStatus =
+            _insertAllDocumentsParallel(opCtx, collection, exec.get(), progress, numKeyGenerators, &n);
+        if (!scanStatus.isOK()) {
+            return scanStatus;
         }
+    } else {
+        BSONObj objToIndex;
+        RecordId loc;
+        PlanExecutor::ExecState state;
+        while (PlanExecutor::ADVANCED == (state = exec->getNext(&objToIndex, &loc)) ||
+               MONGO_unlikely(hangAfterStartingIndexBuild.shouldFail())) {
+            auto interruptStatus = opCtx->checkForInterruptNoAssert();
+            if (!interruptStatus.isOK())
+                return opCtx->checkForInterruptNoAssert();
+
+            if (PlanExecutor::ADVANCED != state) {
+                continue;
+            }
 
-        progress->setTotalWhileRunning(collection->numRecords(opCtx));
+            progress->setTotalWhileRunning(collection->numRecords(opCtx));
 
-        failPointHangDuringBuild(&hangBeforeIndexBuildOf, "before", objToIndex);
+            failPointHangDuringBuild(&hangBeforeIndexBuildOf, "before", objToIndex);
 
-        // The external sorter is not part of the storage engine and therefore does not need a
-        // WriteUnitOfWork to write keys.
-        Status ret = insert(opCtx, objToIndex, loc);
-        if (!ret.isOK()) {
-            return ret;
-        }
+            // The external sorter is not part of the storage engine and therefore does not need a
+            // WriteUnitOfWork to write keys.
+            Status ret = insert(opCtx, objToIndex, loc);
+            if (!ret.isOK()) {
+                return ret;
+            }
 
-        failPointHangDuringBuild(&hangAfterIndexBuildOf, "after", objToIndex);
+            failPointHangDuringBuild(&hangAfterIndexBuildOf, "after", objToIndex);
 
-        // Go to the next document.
-        progress->hit();
-        n++;
-    }
+            // Go to the next document.
+            progress->hit();
+            n++;
+        }
 
-    if (state != PlanExecutor::IS_EOF) {
-        return exec->getMemberObjectStatus(objToIndex);
+        if (state != PlanExecutor::IS_EOF) {
+            return exec->getMemberObjectStatus(objToIndex);
+        }
     }
 
     if (MONGO_unlikely(leaveIndexBuildUnfinishedForShutdown.shouldFail())) {
@@ -467,6 +478,156 @@ Status MultiIndexBlock::insertAllDocumentsInCollection(OperationContext* opCtx,
     return Status::OK();
 }
 
+Status MultiIndexBlock::_insertAllDocumentsParallel(OperationContext* opCtx,
+                                                    Collection* collection,
+                                                    PlanExecutor* exec,
+                                                    ProgressMeterHolder& progress,
+                                                    size_t numKeyGenerators,
+                                                    unsigned long long* numScanned) {
+    invariant(numKeyGenerators > 1);
+
+    // Buffered documents are handed off to the key generators in batches of roughly this size so
+    // the handoff cost is amortized and the scan can read ahead while keys are being generated.
+    constexpr size_t kBatchBytes = 8 * 1024 * 1024;
+
+    // Round-robin the indexes across the key generators. Each index is owned by exactly one
+    // worker for the duration of the scan so its bulk builder and sorter are only ever fed from
+    // a single thread.
+    std::vector<std::vector<size_t>> indexGroups(numKeyGenerators);
+    for (size_t i = 0; i < _indexes.size(); i++) {
+        indexGroups[i % numKeyGenerators].push_back(i);
+    }
+
+    std::vector<Status> workerResults(numKeyGenerators, Status::OK());
+
+    ThreadPool::Options options;
+    options.poolName = "IndexBuildKeyGenerator";
+    options.minThreads = 0;
+    options.maxThreads = numKeyGenerators;
+    options.onCreateThread = [](const std::string& threadName) {
+        Client::initThread(threadName.c_str());
+    };
+    ThreadPool pool(options);
+    pool.startup();
+    auto poolGuard = makeGuard([&pool] {
+        pool.shutdown();
+        pool.join();
+    });
+
+    using Batch = std::vector<std::pair<BSONObj, RecordId>>;
+    auto batch = std::make_shared<Batch>();
+    size_t batchBytes = 0;
+    bool batchOutstanding = false;
+
+    // At most one batch is in flight at a time: the scan dispatches a batch and keeps reading
+    // while the workers process it. Workers report failures through 'workerResults', which is
+    // only examined once the pool is idle.
+    auto waitForOutstandingBatch = [&]() -> Status {
+        if (!batchOutstanding)
+            return Status::OK();
+        pool.waitForIdle();
+        batchOutstanding = false;
+        for (const auto& result : workerResults) {
+            if (!result.isOK())
+                return result;
+        }
+        return Status::OK();
+    };
+    auto dispatchBatch = [&](std::shared_ptr<Batch> docs) {
+        for (size_t workerId = 0; workerId < numKeyGenerators; workerId++) {
+            pool.schedule(
+                [this, docs, workerId, &indexGroups, &workerResults](Status scheduleStatus) {
+                    invariant(scheduleStatus);
+                    workerResults[workerId] =
+                        _insertBatchForIndexGroup(*docs, indexGroups[workerId]);
+                });
+        }
+        batchOutstanding = true;
+    };
+
+    BSONObj objToIndex;
+    RecordId loc;
+    PlanExecutor::ExecState state;
+    while (PlanExecutor::ADVANCED == (state = exec->getNext(&objToIndex, &loc)) ||
+           MONGO_unlikely(hangAfterStartingIndexBuild.shouldFail())) {
+        auto interruptStatus = opCtx->checkForInterruptNoAssert();
+        if (!interruptStatus.isOK())
+            return interruptStatus;
+
+        if (PlanExecutor::ADVANCED != state) {
+            continue;
+        }
+
+        progress->setTotalWhileRunning(collection->numRecords(opCtx));
+
+        failPointHangDuringBuild(&hangBeforeIndexBuildOf, "before", objToIndex);
+
+        // The executor may invalidate 'objToIndex' on the next getNext() call, so the batch keeps
+        // an owned copy.
+        batchBytes += objToIndex.objsize();
+        batch->emplace_back(objToIndex.getOwned(), loc);
+
+        failPointHangDuringBuild(&hangAfterIndexBuildOf, "after", objToIndex);
+
+        progress->hit();
+        (*numScanned)++;
+
+        if (batchBytes >= kBatchBytes) {
+            auto batchStatus = waitForOutstandingBatch();
+            if (!batchStatus.isOK()) {
+                return batchStatus;
+            }
+            dispatchBatch(std::move(batch));
+            batch = std::make_shared<Batch>();
+            batchBytes = 0;
+        }
+    }
+
+    if (state != PlanExecutor::IS_EOF) {
+        return exec->getMemberObjectStatus(objToIndex);
+    }
+
+    auto batchStatus = waitForOutstandingBatch();
+    if (!batchStatus.isOK()) {
+        return batchStatus;
+    }
+    if (!batch->empty()) {
+        dispatchBatch(std::move(batch));
+        batchStatus = waitForOutstandingBatch();
+    }
+    return batchStatus;
+}
+
+Status MultiIndexBlock::_insertBatchForIndexGroup(
+    const std::vector<std::pair<BSONObj, RecordId>>& docs, const std::vector<size_t>& indexGroup) {
+    // Key generation needs an OperationContext for its pooled key buffers and for recording
+    // skipped records; the worker uses its own so the scan's is never shared across threads.
+    auto opCtx = cc().makeOperationContext();
+    for (const auto& doc : docs) {
+        for (auto i : indexGroup) {
+            if (_indexes[i].filterExpression &&
+                !_indexes[i].filterExpression->matchesBSON(doc.first)) {
+                continue;
+            }
+
+            Status idxStatus = Status::OK();
+
+            // When calling insert, BulkBuilderImpl's Sorter performs file I/O that may result in
+            // an exception.
+            try {
+                idxStatus =
+                    _indexes[i].bulk->insert(opCtx.get(), doc.first, doc.second, _indexes[i].options);
+            } catch (...) {
+                return exceptionToStatus();
+            }
+
+            if (!idxStatus.isOK())
+                return idxStatus;
+        }
+    }
+    return Status::OK();
+}
+
 Status MultiIndexBlock::insert(OperationContext* opCtx, const BSONObj& doc, const RecordId& loc) {
     invariant(!_buildIsCleanedUp);
     for (size_t i = 0; i < _indexes.size(); i++) {
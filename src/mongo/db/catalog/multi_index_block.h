@@ -34,6 +34,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "mongo/base/status.h"
@@ -58,6 +59,8 @@ class Collection;
 class MatchExpression;
 class NamespaceString;
 class OperationContext;
+class PlanExecutor;
+class ProgressMeterHolder;
 
 /**
  * Builds one or more indexes.
@@ -275,6 +278,28 @@ public:
     void setIndexBuildMethod(IndexBuildMethod indexBuildMethod);
 
 private:
+    /**
+     * Scans 'collection' with 'exec' and spreads key generation for the indexes being built
+     * across 'numKeyGenerators' worker threads. The scan itself stays on the calling thread so
+     * it runs under a single storage snapshot; each worker owns a disjoint subset of the indexes
+     * and feeds their bulk builders from batches of documents buffered by the scan. Used by
+     * insertAllDocumentsInCollection() when indexBuildKeyGenerationConcurrency allows it.
+     */
+    Status _insertAllDocumentsParallel(OperationContext* opCtx,
+                                       Collection* collection,
+                                       PlanExecutor* exec,
+                                       ProgressMeterHolder& progress,
+                                       size_t numKeyGenerators,
+                                       unsigned long long* numScanned);
+
+    /**
+     * Worker-side half of _insertAllDocumentsParallel(): inserts every document in 'docs' into
+     * the bulk builders of the indexes in 'indexGroup'. Runs on a key generator thread with its
+     * own OperationContext.
+     */
+    Status _insertBatchForIndexGroup(const std::vector<std::pair<BSONObj, RecordId>>& docs,
+                                     const std::vector<size_t>& indexGroup);
+
     struct IndexToBuild {
         std::unique_ptr<IndexBuildBlock> block;
 
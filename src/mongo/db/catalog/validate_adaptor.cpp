@@ -61,6 +61,11 @@ MONGO_FAIL_POINT_DEFINE(crashOnMultikeyValidateFailure);
 const long long kInterruptIntervalNumRecords = 4096;
 const long long kInterruptIntervalNumBytes = 50 * 1024 * 1024;  // 50MB.
 
+// When the data throttle set by 'maxValidateMBperSec' is engaged, the count-based yield intervals
+// above can stretch over many seconds, so yields are additionally driven by time to avoid
+// starving operations waiting on the locks held between yields.
+const Milliseconds kInterruptIntervalTime{500};
+
 }  // namespace
 
 Status ValidateAdaptor::validateRecord(OperationContext* opCtx,
@@ -251,6 +256,9 @@ void ValidateAdaptor::traverseIndex(OperationContext* opCtx,
     const auto indexCursorIt = _validateState->getIndexCursors().find(indexName);
     invariant(indexCursorIt != _validateState->getIndexCursors().end());
 
+    Date_t nextYieldTime =
+        opCtx->getServiceContext()->getFastClockSource()->now() + kInterruptIntervalTime;
+
     const std::unique_ptr<SortedDataInterfaceThrottleCursor>& indexCursor = indexCursorIt->second;
     for (auto indexEntry = indexCursor->seekForKeyString(opCtx, firstKeyString.release());
          indexEntry;
@@ -277,10 +285,13 @@ void ValidateAdaptor::traverseIndex(OperationContext* opCtx,
         isFirstEntry = false;
         prevIndexKeyStringValue = indexEntry->keyString;
 
-        if (numKeys % kInterruptIntervalNumRecords == 0) {
+        if (numKeys % kInterruptIntervalNumRecords == 0 ||
+            opCtx->getServiceContext()->getFastClockSource()->now() >= nextYieldTime) {
             // Periodically checks for interrupts and yields.
             opCtx->checkForInterrupt();
             _validateState->yield(opCtx);
+            nextYieldTime =
+                opCtx->getServiceContext()->getFastClockSource()->now() + kInterruptIntervalTime;
         }
     }
 
@@ -321,6 +332,9 @@ void ValidateAdaptor::traverseRecordStore(OperationContext* opCtx,
         _progress.set(CurOp::get(opCtx)->setProgress_inlock(curopMessage, totalRecords));
     }
 
+    Date_t nextYieldTime =
+        opCtx->getServiceContext()->getFastClockSource()->now() + kInterruptIntervalTime;
+
     const std::unique_ptr<SeekableRecordThrottleCursor>& traverseRecordStoreCursor =
         _validateState->getTraverseRecordStoreCursor();
     for (auto record =
@@ -369,10 +383,13 @@ void ValidateAdaptor::traverseRecordStore(OperationContext* opCtx,
         prevRecordId = record->id;
 
         if (_numRecords % kInterruptIntervalNumRecords == 0 ||
-            interruptIntervalNumBytes >= kInterruptIntervalNumBytes) {
+            interruptIntervalNumBytes >= kInterruptIntervalNumBytes ||
+            opCtx->getServiceContext()->getFastClockSource()->now() >= nextYieldTime) {
             // Periodically checks for interrupts and yields.
             opCtx->checkForInterrupt();
             _validateState->yield(opCtx);
+            nextYieldTime =
+                opCtx->getServiceContext()->getFastClockSource()->now() + kInterruptIntervalTime;
 
             if (interruptIntervalNumBytes >= kInterruptIntervalNumBytes) {
                 interruptIntervalNumBytes = 0;
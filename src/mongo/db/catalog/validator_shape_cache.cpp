@@ -0,0 +1,85 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/catalog/validator_shape_cache.h"
+
+#include "mongo/bson/bsonelement.h"
+#include "mongo/util/str.h"
+
+namespace mongo {
+
+namespace {
+
+void appendShape(const BSONObj& obj, bool isArray, StringBuilder* sb) {
+    for (auto&& elem : obj) {
+        // Array indices are implied by position, so their field names carry no information.
+        if (!isArray) {
+            // Field names cannot contain NUL, making it an unambiguous terminator.
+            *sb << elem.fieldNameStringData() << '\0';
+        }
+        // The raw type byte, not the canonical type: the validator may distinguish int from
+        // long from double.
+        *sb << static_cast<char>(elem.type());
+        if (elem.type() == BSONType::Object) {
+            *sb << '{';
+            appendShape(elem.embeddedObject(), false, sb);
+            *sb << '}';
+        } else if (elem.type() == BSONType::Array) {
+            *sb << '[';
+            appendShape(elem.embeddedObject(), true, sb);
+            *sb << ']';
+        }
+    }
+}
+
+}  // namespace
+
+std::string ValidatorShapeCache::computeShapeKey(const BSONObj& doc) {
+    StringBuilder sb;
+    appendShape(doc, false, &sb);
+    return sb.str();
+}
+
+boost::optional<bool> ValidatorShapeCache::lookup(const std::string& shapeKey) {
+    stdx::lock_guard<Latch> lock(_mutex);
+    auto it = _cache.find(shapeKey);
+    if (it == _cache.end()) {
+        return boost::none;
+    }
+    return it->second;
+}
+
+void ValidatorShapeCache::insert(std::string shapeKey, bool verdict) {
+    stdx::lock_guard<Latch> lock(_mutex);
+    _cache.add(std::move(shapeKey), verdict);
+}
+
+}  // namespace mongo
@@ -0,0 +1,82 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <string>
+
+#include <boost/optional.hpp>
+
+#include "mongo/bson/bsonobj.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/util/lru_cache.h"
+
+namespace mongo {
+
+/**
+ * Memoizes collection validator verdicts by document shape. Only usable for validators whose
+ * match expression depends solely on document shape (see
+ * expression::dependsOnlyOnDocumentShape): two documents with identical shape keys get the same
+ * verdict from such a validator, so repeated inserts of identically-shaped documents — the common
+ * case under a large type-and-required $jsonSchema — skip the match entirely.
+ *
+ * Thread-safe. One instance is shared by all writers through the owning Collection::Validator
+ * and is discarded with it whenever the validator changes.
+ */
+class ValidatorShapeCache {
+    ValidatorShapeCache(const ValidatorShapeCache&) = delete;
+    ValidatorShapeCache& operator=(const ValidatorShapeCache&) = delete;
+
+public:
+    ValidatorShapeCache() = default;
+
+    /**
+     * Builds the shape key for 'doc': its field names, value types, and nested object and array
+     * structure, with all values elided. A single walk of the document.
+     */
+    static std::string computeShapeKey(const BSONObj& doc);
+
+    /**
+     * Returns the memoized verdict for 'shapeKey', or boost::none if this shape has not been
+     * validated before.
+     */
+    boost::optional<bool> lookup(const std::string& shapeKey);
+
+    void insert(std::string shapeKey, bool verdict);
+
+private:
+    // Shapes seen per validator are expected to number in the tens; the bound only guards
+    // against workloads with unbounded shape variety (e.g. user-generated field names).
+    static constexpr size_t kMaxEntries = 256;
+
+    Mutex _mutex = MONGO_MAKE_LATCH("ValidatorShapeCache::_mutex");
+    LRUCache<std::string, bool> _cache{kMaxEntries};
+};
+
+}  // namespace mongo
@@ -48,6 +48,7 @@
 #include "mongo/db/commands/server_status_metric.h"
 #include "mongo/db/cursor_manager.h"
 #include "mongo/db/cursor_server_params.h"
+#include "mongo/db/exec/working_set.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/query/explain.h"
 #include "mongo/db/repl/repl_client_info.h"
@@ -65,6 +66,8 @@ static Counter64 cursorStatsOpen;           // gauge
 static Counter64 cursorStatsOpenPinned;     // gauge
 static Counter64 cursorStatsOpenNoTimeout;  // gauge
 static Counter64 cursorStatsTimedOut;
+static Counter64 cursorStatsMemoryBytes;  // gauge
+static Counter64 cursorStatsEvictedDueToMemoryPressure;
 
 static ServerStatusMetricField<Counter64> dCursorStatsOpen("cursor.open.total", &cursorStatsOpen);
 static ServerStatusMetricField<Counter64> dCursorStatsOpenPinned("cursor.open.pinned",
@@ -73,6 +76,10 @@ static ServerStatusMetricField<Counter64> dCursorStatsOpenNoTimeout("cursor.open
                                                                     &cursorStatsOpenNoTimeout);
 static ServerStatusMetricField<Counter64> dCursorStatusTimedout("cursor.timedOut",
                                                                 &cursorStatsTimedOut);
+static ServerStatusMetricField<Counter64> dCursorStatsMemoryBytes("cursor.memoryBytes",
+                                                                  &cursorStatsMemoryBytes);
+static ServerStatusMetricField<Counter64> dCursorStatsEvicted(
+    "cursor.evictedDueToMemoryPressure", &cursorStatsEvictedDueToMemoryPressure);
 
 ClientCursor::ClientCursor(ClientCursorParams params,
                            CursorId cursorId,
@@ -100,6 +107,7 @@ ClientCursor::ClientCursor(ClientCursorParams params,
     invariant(_operationUsingCursor);
 
     cursorStatsOpen.increment();
+    recalculateMemoryUsageBytes();
 
     if (isNoTimeout()) {
         // cursors normally timeout after an inactivity period to prevent excess memory use
@@ -114,11 +122,27 @@ ClientCursor::~ClientCursor() {
     invariant(_disposed);
 
     cursorStatsOpen.decrement();
+    cursorStatsMemoryBytes.decrement(_memoryUsageBytes);
     if (isNoTimeout()) {
         cursorStatsOpenNoTimeout.decrement();
     }
 }
 
+void ClientCursor::recalculateMemoryUsageBytes() {
+    long long bytes = static_cast<long long>(sizeof(ClientCursor)) + _originatingCommand.objsize() +
+        static_cast<long long>(_planSummary.size());
+    if (auto* ws = _exec->getWorkingSet()) {
+        bytes += static_cast<long long>(ws->getMemUsage());
+    }
+
+    if (bytes >= _memoryUsageBytes) {
+        cursorStatsMemoryBytes.increment(bytes - _memoryUsageBytes);
+    } else {
+        cursorStatsMemoryBytes.decrement(_memoryUsageBytes - bytes);
+    }
+    _memoryUsageBytes = bytes;
+}
+
 void ClientCursor::markAsKilled(Status killStatus) {
     _exec->markAsKilled(killStatus);
 }
@@ -280,6 +304,8 @@ public:
                 auto now = opCtx->getServiceContext()->getPreciseClockSource()->now();
                 cursorStatsTimedOut.increment(
                     CursorManager::get(opCtx.get())->timeoutCursors(opCtx.get(), now));
+                cursorStatsEvictedDueToMemoryPressure.increment(
+                    CursorManager::get(opCtx.get())->evictCursorsOverMemoryLimit(opCtx.get()));
             }
             MONGO_IDLE_THREAD_BLOCK;
             sleepsecs(getClientCursorMonitorFrequencySecs());
@@ -220,6 +220,25 @@ public:
     }
     void getOriginatingPrivileges() && = delete;
 
+    /**
+     * Returns true if a previous getMore on this cursor has already verified the originating
+     * privileges for 'users' under authorization-data generation 'generation'. A generation
+     * change means user or role definitions may have changed, so the cached verdict no longer
+     * applies and the privileges must be re-evaluated.
+     */
+    bool isAuthVerified(const std::vector<UserName>& users, const OID& generation) const {
+        return _authVerifiedGeneration == generation && _authVerifiedUsers == users;
+    }
+
+    /**
+     * Records that the originating privileges have been verified for 'users' under
+     * authorization-data generation 'generation'. Only called while the cursor is pinned.
+     */
+    void setAuthVerified(std::vector<UserName> users, const OID& generation) {
+        _authVerifiedUsers = std::move(users);
+        _authVerifiedGeneration = generation;
+    }
+
     /**
      * Returns the total number of query results returned by the cursor so far.
      */
@@ -276,6 +295,23 @@ public:
         return _lockPolicy;
     }
 
+    /**
+     * Returns an estimate of the memory held by this cursor while idle: the cursor object itself,
+     * the owned copy of the originating command, and the executor's working set. The estimate is
+     * computed at registration and refreshed at the end of each batch; callers must either have
+     * the cursor pinned or hold the cursor's partition lock in the CursorManager.
+     */
+    long long memoryUsageBytes() const {
+        return _memoryUsageBytes;
+    }
+
+    /**
+     * Recomputes the memory usage estimate returned by memoryUsageBytes() and folds the change
+     * into the server-wide cursor memory gauge. Called by the CursorManager at registration and
+     * when the cursor is returned to it at the end of a batch.
+     */
+    void recalculateMemoryUsageBytes();
+
     /**
      * Returns a generic cursor containing diagnostics about this cursor.
      * The caller must either have this cursor pinned or hold a mutex from the cursor manager.
@@ -316,6 +352,28 @@ public:
         _lastKnownCommittedOpTime = std::move(lastCommittedOpTime);
     }
 
+    /**
+     * Records an error encountered by a background cursor read-ahead task while running this
+     * cursor's executor. The executor must not be run again; the error is surfaced to the client
+     * by the next getMore on this cursor. May only be called while the caller has the cursor
+     * pinned.
+     */
+    void setReadAheadError(Status error) {
+        invariant(!error.isOK());
+        _readAheadError = std::move(error);
+    }
+
+    /**
+     * Returns the error recorded by a background read-ahead task and resets the slot, or
+     * Status::OK() if no such error occurred. May only be called while the caller has the cursor
+     * pinned.
+     */
+    Status takeReadAheadError() {
+        auto error = std::move(_readAheadError);
+        _readAheadError = Status::OK();
+        return error;
+    }
+
     friend std::size_t partitionOf(const ClientCursor* cursor) {
         return cursor->cursorid();
     }
@@ -405,12 +463,22 @@ private:
     // Tracks the number of batches returned by this cursor so far.
     std::uint64_t _nBatchesReturned = 0;
 
+    // Set to a non-OK status when a background read-ahead task fails while running this cursor's
+    // executor, so the error can be reported by the next getMore. Only accessed while the cursor
+    // is pinned.
+    Status _readAheadError = Status::OK();
+
     // Holds an owned copy of the command specification received from the client.
     const BSONObj _originatingCommand;
 
     // The privileges required for the _originatingCommand.
     const PrivilegeVector _originatingPrivileges;
 
+    // The authenticated users and authorization-data generation for which _originatingPrivileges
+    // were last verified by a getMore. Only accessed while the cursor is pinned.
+    std::vector<UserName> _authVerifiedUsers;
+    OID _authVerifiedGeneration;
+
     // See the QueryOptions enum in dbclientinterface.h.
     const int _queryOptions = 0;
 
@@ -449,6 +517,11 @@ private:
     Date_t _lastUseDate;
     Date_t _createdDate;
 
+    // An estimate of the memory held by this cursor, maintained by recalculateMemoryUsageBytes().
+    // Written while the cursor is pinned or while holding the cursor's partition lock in the
+    // CursorManager; read under the same conditions.
+    long long _memoryUsageBytes = 0;
+
     // A string with the plan summary of the cursor's query.
     std::string _planSummary;
 
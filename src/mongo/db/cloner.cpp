@@ -46,11 +46,13 @@
 #include "mongo/db/catalog/database.h"
 #include "mongo/db/catalog/database_holder.h"
 #include "mongo/db/catalog/index_catalog.h"
+#include "mongo/db/client.h"
 #include "mongo/db/commands.h"
 #include "mongo/db/commands/list_collections_filter.h"
 #include "mongo/db/commands/rename_collection.h"
 #include "mongo/db/concurrency/write_conflict_exception.h"
 #include "mongo/db/curop.h"
+#include "mongo/db/db_raii.h"
 #include "mongo/db/dbdirectclient.h"
 #include "mongo/db/index/index_descriptor.h"
 #include "mongo/db/index_builds_coordinator.h"
@@ -63,7 +65,10 @@
 #include "mongo/db/service_context.h"
 #include "mongo/db/storage/durable_catalog.h"
 #include "mongo/logv2/log.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/condition_variable.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/str.h"
 
@@ -75,6 +80,169 @@ MONGO_FAIL_POINT_DEFINE(movePrimaryFailPoint);
 
 BSONElement getErrField(const BSONObj& o);
 
+namespace {
+
+// Limits on how many documents and how many bytes a single writer batch may hold. Batches are
+// flushed to a writer thread when either limit is reached, so one oversized document still forms a
+// valid single-document batch.
+constexpr size_t kClonerWriterBatchDocs = 500;
+constexpr size_t kClonerWriterBatchBytes = 4 * 1024 * 1024;
+
+/**
+ * A pool of writer threads that insert batches of cloned documents. The cursor thread hands owned
+ * batches to dispatch(), which blocks once two batches per writer are outstanding so that cloning
+ * never buffers an unbounded amount of data. Each batch is inserted under its own Client and
+ * OperationContext with collection-level intent locks, so writers proceed in parallel with each
+ * other and with the cursor.
+ *
+ * The first writer error is surfaced on the cursor thread by the next dispatch() or by
+ * awaitAllInserted(). The destructor drains any in-flight batches; callers must not be holding
+ * locks that would block the writers when it runs.
+ */
+class ClonerWriterPool {
+    ClonerWriterPool(const ClonerWriterPool&) = delete;
+    ClonerWriterPool& operator=(const ClonerWriterPool&) = delete;
+
+public:
+    ClonerWriterPool(const NamespaceString& nss, int numThreads) : _nss(nss) {
+        ThreadPool::Options options;
+        options.threadNamePrefix = "ClonerWriter-";
+        options.poolName = "ClonerWriterThreadPool";
+        options.minThreads = 0;
+        options.maxThreads = static_cast<size_t>(numThreads);
+        options.onCreateThread = [](const std::string& threadName) {
+            Client::initThread(threadName);
+        };
+        _maxOutstandingBatches = static_cast<size_t>(numThreads) * 2;
+        _pool = std::make_unique<ThreadPool>(std::move(options));
+        _pool->startup();
+    }
+
+    ~ClonerWriterPool() {
+        {
+            stdx::unique_lock<Latch> lk(_mutex);
+            _cv.wait(lk, [&] { return _outstandingBatches == 0; });
+        }
+        _pool->shutdown();
+        _pool->join();
+    }
+
+    void dispatch(std::vector<BSONObj> batch) {
+        {
+            stdx::unique_lock<Latch> lk(_mutex);
+            _cv.wait(lk, [&] {
+                return _outstandingBatches < _maxOutstandingBatches || !_firstError.isOK();
+            });
+            uassertStatusOK(_firstError);
+            ++_outstandingBatches;
+        }
+        _pool->schedule([this, batch = std::move(batch)](Status status) mutable {
+            if (status.isOK()) {
+                try {
+                    _insertBatch(std::move(batch));
+                } catch (const DBException& ex) {
+                    status = ex.toStatus();
+                }
+            }
+            stdx::lock_guard<Latch> lk(_mutex);
+            if (!status.isOK() && _firstError.isOK()) {
+                _firstError = std::move(status);
+            }
+            --_outstandingBatches;
+            _cv.notify_all();
+        });
+    }
+
+    /**
+     * Blocks until every dispatched batch has been inserted and rethrows the first writer error,
+     * if any.
+     */
+    void awaitAllInserted() {
+        stdx::unique_lock<Latch> lk(_mutex);
+        _cv.wait(lk, [&] { return _outstandingBatches == 0; });
+        uassertStatusOK(_firstError);
+    }
+
+private:
+    void _insertBatch(std::vector<BSONObj> batch) {
+        auto opCtx = cc().makeOperationContext();
+
+        std::vector<InsertStatement> stmts;
+        stmts.reserve(batch.size());
+        for (auto&& doc : batch) {
+            stmts.emplace_back(doc);
+        }
+
+        // First try the whole batch in one WriteUnitOfWork. A duplicate key aborts the batch, in
+        // which case the documents are retried individually below so the rest of the batch still
+        // lands, mirroring the duplicate-key tolerance of the single-threaded path.
+        try {
+            writeConflictRetry(opCtx.get(), "cloner parallel insert", _nss.ns(), [&] {
+                opCtx->checkForInterrupt();
+
+                AutoGetCollection autoColl(opCtx.get(), _nss, MODE_IX);
+                auto collection = _checkWritable(opCtx.get(), autoColl);
+
+                WriteUnitOfWork wunit(opCtx.get());
+                OpDebug* const nullOpDebug = nullptr;
+                uassertStatusOK(collection->insertDocuments(
+                    opCtx.get(), stmts.cbegin(), stmts.cend(), nullOpDebug, true));
+                wunit.commit();
+            });
+            return;
+        } catch (const ExceptionFor<ErrorCodes::DuplicateKey>&) {
+        }
+
+        for (auto&& stmt : stmts) {
+            writeConflictRetry(opCtx.get(), "cloner parallel insert", _nss.ns(), [&] {
+                opCtx->checkForInterrupt();
+
+                AutoGetCollection autoColl(opCtx.get(), _nss, MODE_IX);
+                auto collection = _checkWritable(opCtx.get(), autoColl);
+
+                WriteUnitOfWork wunit(opCtx.get());
+                OpDebug* const nullOpDebug = nullptr;
+                Status status = collection->insertDocument(opCtx.get(), stmt, nullOpDebug, true);
+                if (!status.isOK() && status.code() != ErrorCodes::DuplicateKey) {
+                    LOGV2_ERROR(4957900,
+                                "error: exception cloning object",
+                                "ns"_attr = _nss,
+                                "status"_attr = redact(status),
+                                "doc"_attr = redact(stmt.doc));
+                    uassertStatusOK(status);
+                }
+                if (status.isOK()) {
+                    wunit.commit();
+                }
+            });
+        }
+    }
+
+    Collection* _checkWritable(OperationContext* opCtx, AutoGetCollection& autoColl) {
+        uassert(ErrorCodes::PrimarySteppedDown,
+                str::stream() << "Not primary while cloning collection " << _nss,
+                !opCtx->writesAreReplicated() ||
+                    repl::ReplicationCoordinator::get(opCtx)->canAcceptWritesFor(opCtx, _nss));
+        auto collection = autoColl.getCollection();
+        uassert(4957901,
+                str::stream() << "Collection " << _nss << " dropped while cloning",
+                collection);
+        return collection;
+    }
+
+    const NamespaceString _nss;
+
+    std::unique_ptr<ThreadPool> _pool;
+    size_t _maxOutstandingBatches;
+
+    Mutex _mutex = MONGO_MAKE_LATCH("ClonerWriterPool::_mutex");
+    stdx::condition_variable _cv;
+    size_t _outstandingBatches = 0;
+    Status _firstError = Status::OK();
+};
+
+}  // namespace
+
 BSONObj Cloner::_getIdIndexSpec(const std::list<BSONObj>& indexSpecs) {
     for (auto&& indexSpec : indexSpecs) {
         BSONElement indexName;
@@ -239,6 +407,12 @@ void Cloner::_copy(OperationContext* opCtx,
                 "conn_getServerAddress"_attr = conn->getServerAddress(),
                 "query"_attr = redact(query.toString()));
 
+    const int writerThreads = gClonerWriterThreads.load();
+    if (writerThreads > 1) {
+        _copyParallel(opCtx, toDBName, nss, from_opts, from_id_index, query, conn, writerThreads);
+        return;
+    }
+
     Fun f(opCtx, toDBName);
     f.numSeen = 0;
     f.nss = nss;
@@ -265,6 +439,130 @@ void Cloner::_copy(OperationContext* opCtx,
                 repl::ReplicationCoordinator::get(opCtx)->canAcceptWritesFor(opCtx, nss));
 }
 
+void Cloner::_copyParallel(OperationContext* opCtx,
+                           const std::string& toDBName,
+                           const NamespaceString& nss,
+                           const BSONObj& from_opts,
+                           const BSONObj& from_id_index,
+                           Query query,
+                           DBClientBase* conn,
+                           int writerThreads) {
+    LOGV2_DEBUG(4957902,
+                2,
+                "\t\tcloning collection with parallel writers",
+                "ns"_attr = nss,
+                "conn_getServerAddress"_attr = conn->getServerAddress(),
+                "query"_attr = redact(query.toString()),
+                "writerThreads"_attr = writerThreads);
+
+    // Make sure the collection exists before the writers race to insert into it. copyDb creates
+    // every collection up front, but the single-threaded path also tolerates creating it lazily,
+    // so the same guard is kept here.
+    {
+        uassert(ErrorCodes::NotMaster,
+                str::stream() << "Not primary while cloning collection " << nss,
+                !opCtx->writesAreReplicated() ||
+                    repl::ReplicationCoordinator::get(opCtx)->canAcceptWritesFor(opCtx, nss));
+
+        auto databaseHolder = DatabaseHolder::get(opCtx);
+        auto db = databaseHolder->openDb(opCtx, toDBName);
+        auto collection = CollectionCatalog::get(opCtx).lookupCollectionByNamespace(opCtx, nss);
+        if (!collection) {
+            writeConflictRetry(opCtx, "createCollection", nss.ns(), [&] {
+                opCtx->checkForInterrupt();
+
+                WriteUnitOfWork wunit(opCtx);
+                const bool createDefaultIndexes = true;
+                CollectionOptions collectionOptions = uassertStatusOK(CollectionOptions::parse(
+                    from_opts, CollectionOptions::ParseKind::parseForCommand));
+                invariant(db->userCreateNS(
+                              opCtx, nss, collectionOptions, createDefaultIndexes, from_id_index),
+                          str::stream()
+                              << "collection creation failed during clone [" << nss << "]");
+                wunit.commit();
+            });
+        }
+    }
+
+    int64_t numSeen = 0;
+    time_t saveLast = time(nullptr);
+    std::vector<BSONObj> batch;
+    size_t batchBytes = 0;
+
+    int options = QueryOption_NoCursorTimeout | QueryOption_Exhaust;
+    {
+        // The cursor thread holds no locks while streaming; the writers take their own
+        // collection-level intent locks. The pool is destroyed (draining any in-flight batches)
+        // before TempRelease reacquires this operation's locks, since reacquiring an exclusive
+        // database lock would block the writers.
+        Lock::TempRelease tempRelease(opCtx->lockState());
+        ClonerWriterPool pool(nss, writerThreads);
+
+        auto batchHandler = [&](DBClientCursorBatchIterator& i) {
+            while (i.moreInCurrentBatch()) {
+                if (numSeen % 128 == 127) {
+                    opCtx->checkForInterrupt();
+                }
+
+                BSONObj tmp = i.nextSafe();
+
+                /* assure object is valid.  note this will slow us down a little. */
+                // Use the latest BSON validation version. We allow cloning of collections
+                // containing decimal data even if decimal is disabled.
+                const Status status =
+                    validateBSON(tmp.objdata(), tmp.objsize(), BSONVersion::kLatest);
+                if (!status.isOK()) {
+                    str::stream ss;
+                    ss << "Cloner: found corrupt document in " << nss << ": " << redact(status);
+                    if (gSkipCorruptDocumentsWhenCloning.load()) {
+                        LOGV2_WARNING(
+                            4957903, "{ss_ss_str}; skipping", "ss_ss_str"_attr = ss.ss.str());
+                        continue;
+                    }
+                    msgasserted(4957904, ss);
+                }
+
+                ++numSeen;
+                batchBytes += tmp.objsize();
+                batch.push_back(tmp.getOwned());
+                if (batch.size() >= kClonerWriterBatchDocs || batchBytes >= kClonerWriterBatchBytes) {
+                    pool.dispatch(std::move(batch));
+                    batch = std::vector<BSONObj>();
+                    batchBytes = 0;
+                }
+
+                static Rarely sampler;
+                if (sampler.tick() && (time(nullptr) - saveLast > 60)) {
+                    LOGV2(4957905,
+                          "objects cloned so far from collection",
+                          "numSeen"_attr = numSeen,
+                          "ns"_attr = nss);
+                    saveLast = time(nullptr);
+                }
+            }
+        };
+
+        conn->query(std::function<void(DBClientCursorBatchIterator&)>(batchHandler),
+                    nss,
+                    query,
+                    nullptr,
+                    options,
+                    0 /* batchSize */,
+                    repl::ReadConcernArgs::kImplicitDefault);
+
+        if (!batch.empty()) {
+            pool.dispatch(std::move(batch));
+        }
+        pool.awaitAllInserted();
+    }
+
+    uassert(ErrorCodes::PrimarySteppedDown,
+            str::stream() << "Not primary while cloning collection " << nss.ns() << " with filter "
+                          << query.toString(),
+            !opCtx->writesAreReplicated() ||
+                repl::ReplicationCoordinator::get(opCtx)->canAcceptWritesFor(opCtx, nss));
+}
+
 void Cloner::_copyIndexes(OperationContext* opCtx,
                           const std::string& toDBName,
                           const NamespaceString& nss,
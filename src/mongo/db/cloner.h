@@ -98,6 +98,20 @@ private:
                Query q,
                DBClientBase* conn);
 
+    /**
+     * Like _copy(), but streams batches of documents from the source cursor to a pool of
+     * 'writerThreads' writer threads instead of inserting them one at a time from the cursor
+     * thread. Used when the 'clonerWriterThreads' server parameter is greater than 1.
+     */
+    void _copyParallel(OperationContext* opCtx,
+                       const std::string& toDBName,
+                       const NamespaceString& nss,
+                       const BSONObj& from_opts,
+                       const BSONObj& from_id_index,
+                       Query q,
+                       DBClientBase* conn,
+                       int writerThreads);
+
     void _copyIndexes(OperationContext* opCtx,
                       const std::string& toDBName,
                       const NamespaceString& nss,
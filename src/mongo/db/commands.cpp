@@ -33,6 +33,7 @@
 
 #include "mongo/db/commands.h"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -852,6 +853,23 @@ bool Command::hasAlias(const StringData& alias) const {
     return globalCommandRegistry()->findCommand(alias) == this;
 }
 
+void Command::recordReplySize(std::size_t bytes) const {
+    // Cap the learned hint so one jumbo reply doesn't make every subsequent invocation of this
+    // command pre-allocate a huge buffer.
+    constexpr long long kReplySizeHintCap = 256 * 1024;
+    const auto size = std::min(static_cast<long long>(bytes), kReplySizeHintCap);
+
+    auto hwm = _replySizeHighWaterMark.loadRelaxed();
+    while (true) {
+        // Jump straight up to larger replies, but decay towards smaller ones gradually so the
+        // mark tracks the recent high end of the reply size distribution.
+        const auto updated = size >= hwm ? size : hwm - (hwm - size) / 16;
+        if (updated == hwm || _replySizeHighWaterMark.compareAndSwap(&hwm, updated)) {
+            return;
+        }
+    }
+}
+
 Status BasicCommandWithReplyBuilderInterface::explain(OperationContext* opCtx,
                                                       const OpMsgRequest& request,
                                                       ExplainOptions::Verbosity verbosity,
@@ -899,6 +917,31 @@ bool ErrmsgCommandDeprecated::run(OperationContext* opCtx,
 //////////////////////////////////////////////////////////////
 // CommandRegistry
 
+namespace {
+
+/**
+ * Salted FNV-1a over a command name. The salt lets the registry search for hash functions until
+ * it finds one that maps a set of names onto distinct slots.
+ */
+uint64_t hashCommandName(StringData name, uint64_t seed) {
+    uint64_t hash = 14695981039346656037ULL ^ seed;
+    for (char c : name) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+size_t nextPowerOfTwo(size_t n) {
+    size_t result = 1;
+    while (result < n) {
+        result *= 2;
+    }
+    return result;
+}
+
+}  // namespace
+
 void CommandRegistry::registerCommand(Command* command,
                                       StringData name,
                                       std::vector<StringData> aliases) {
@@ -912,13 +955,72 @@ void CommandRegistry::registerCommand(Command* command,
         auto result = _commands.try_emplace(key, command);
         invariant(result.second, str::stream() << "command name collision: " << key);
     }
+
+    _rebuildDispatchTable();
+}
+
+void CommandRegistry::_rebuildDispatchTable() {
+    // Classic two-level (FKS) perfect hashing: a fixed first-level hash distributes names over
+    // buckets, then each bucket gets its own salt, searched for until the bucket's names land on
+    // distinct slots of a table quadratic in the bucket's size. Total space stays linear in the
+    // number of commands and every lookup is two hashes and one string compare.
+    const size_t numBuckets = nextPowerOfTwo(std::max<size_t>(_commands.size(), 1));
+
+    std::vector<std::vector<const CommandMap::value_type*>> buckets(numBuckets);
+    for (const auto& entry : _commands) {
+        buckets[hashCommandName(entry.first, 0) & (numBuckets - 1)].push_back(&entry);
+    }
+
+    std::vector<DispatchBucket> dispatchBuckets(numBuckets);
+    std::vector<DispatchSlot> dispatchSlots;
+    for (size_t i = 0; i < numBuckets; ++i) {
+        const auto& names = buckets[i];
+        if (names.empty()) {
+            continue;
+        }
+
+        const size_t bucketSlots = nextPowerOfTwo(names.size() * names.size());
+        auto& bucket = dispatchBuckets[i];
+        bucket.offset = static_cast<uint32_t>(dispatchSlots.size());
+        bucket.mask = static_cast<uint32_t>(bucketSlots - 1);
+        dispatchSlots.resize(dispatchSlots.size() + bucketSlots);
+
+        for (uint64_t seed = 1;; ++seed) {
+            bool collided = false;
+            for (const auto* entry : names) {
+                auto& slot = dispatchSlots[bucket.offset +
+                                           (hashCommandName(entry->first, seed) & bucket.mask)];
+                if (slot.command) {
+                    collided = true;
+                    break;
+                }
+                slot.name = entry->first;
+                slot.command = entry->second;
+            }
+            if (!collided) {
+                bucket.seed = seed;
+                break;
+            }
+            for (size_t s = 0; s <= bucket.mask; ++s) {
+                dispatchSlots[bucket.offset + s] = DispatchSlot();
+            }
+        }
+    }
+
+    _dispatchBuckets = std::move(dispatchBuckets);
+    _dispatchSlots = std::move(dispatchSlots);
 }
 
 Command* CommandRegistry::findCommand(StringData name) const {
-    auto it = _commands.find(name);
-    if (it == _commands.end())
+    if (_dispatchSlots.empty())
         return nullptr;
-    return it->second;
+    const auto& bucket =
+        _dispatchBuckets[hashCommandName(name, 0) & (_dispatchBuckets.size() - 1)];
+    const auto& slot =
+        _dispatchSlots[bucket.offset + (hashCommandName(name, bucket.seed) & bucket.mask)];
+    if (slot.command && name == slot.name)
+        return slot.command;
+    return nullptr;
 }
 
 CommandRegistry* globalCommandRegistry() {
@@ -30,6 +30,7 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <cstdint>
 #include <functional>
 #include <string>
 #include <vector>
@@ -48,6 +49,7 @@
 #include "mongo/db/read_concern_support_result.h"
 #include "mongo/db/repl/read_concern_args.h"
 #include "mongo/db/write_concern.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/rpc/op_msg.h"
 #include "mongo/rpc/reply_builder_interface.h"
 #include "mongo/util/fail_point.h"
@@ -464,6 +466,23 @@ public:
         _commandsFailed.increment();
     }
 
+    /**
+     * Returns a pre-size hint, in bytes, for the buffer into which this command's reply will be
+     * built, or 0 if no replies have been recorded yet. The hint is a rolling high-water mark of
+     * recent reply sizes, so typical replies fit in the initial allocation without paying a
+     * realloc-and-copy cascade as the buffer doubles up from its default size.
+     */
+    std::size_t replySizeHint() const {
+        return static_cast<std::size_t>(_replySizeHighWaterMark.loadRelaxed());
+    }
+
+    /**
+     * Records the size of a completed reply to this command, updating the rolling high-water mark
+     * returned by replySizeHint(). The mark decays towards smaller observed replies so that a
+     * single outlier does not pin oversized allocations indefinitely.
+     */
+    void recordReplySize(std::size_t bytes) const;
+
     /**
      * Generates a reply from the 'help' information associated with a command. The state of
      * the passed ReplyBuilder will be in kOutputDocs after calling this method.
@@ -497,6 +516,8 @@ private:
     // Counters for how many times this command has been executed and failed
     mutable Counter64 _commandsExecuted;
     mutable Counter64 _commandsFailed;
+    // Rolling high-water mark of this command's reply sizes, in bytes. See replySizeHint().
+    mutable AtomicWord<long long> _replySizeHighWaterMark{0};
     // Pointers to hold the metrics tree references
     ServerStatusMetricField<Counter64> _commandsExecutedMetric;
     ServerStatusMetricField<Counter64> _commandsFailedMetric;
@@ -980,10 +1001,40 @@ public:
     }
 
 private:
+    /**
+     * One slot of the two-level perfect-hash dispatch table. Lookups compare the queried name
+     * against 'name', so a probe that lands in the wrong slot simply misses.
+     */
+    struct DispatchSlot {
+        std::string name;
+        Command* command = nullptr;
+    };
+
+    /**
+     * First-level bucket of the dispatch table. Names hashing to this bucket are spread over the
+     * 'mask' + 1 slots starting at 'offset' by a second hash salted with 'seed'; the seed is
+     * chosen at build time so that the bucket's names occupy distinct slots.
+     */
+    struct DispatchBucket {
+        std::uint64_t seed = 0;
+        std::uint32_t offset = 0;
+        std::uint32_t mask = 0;
+    };
+
+    /**
+     * Rebuilds the perfect-hash dispatch table over all registered commands. Commands only
+     * register during startup (and in unit tests), so rebuilding per registration keeps
+     * findCommand() read-only and collision-free at runtime.
+     */
+    void _rebuildDispatchTable();
+
     Counter64 _unknowns;
     ServerStatusMetricField<Counter64> _unknownsMetricField;
 
     CommandMap _commands;
+
+    std::vector<DispatchBucket> _dispatchBuckets;
+    std::vector<DispatchSlot> _dispatchSlots;
 };
 
 /**
@@ -74,6 +74,7 @@
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/op_observer.h"
 #include "mongo/db/ops/insert.h"
+#include "mongo/db/profile_memory_sink.h"
 #include "mongo/db/query/collation/collator_factory_interface.h"
 #include "mongo/db/query/get_executor.h"
 #include "mongo/db/query/internal_plans.h"
@@ -148,6 +149,68 @@ protected:
 
 } cmdProfile;
 
+/**
+ * Returns profile entries buffered by the in-memory profile sink (see the
+ * 'profilingMemorySinkSize' server parameter) for the current database.
+ */
+class CmdGetProfilingMemorySink : public BasicCommand {
+public:
+    CmdGetProfilingMemorySink() : BasicCommand("getProfilingMemorySink") {}
+
+    AllowedOnSecondary secondaryAllowed(ServiceContext*) const override {
+        return AllowedOnSecondary::kAlways;
+    }
+
+    bool supportsWriteConcern(const BSONObj& cmd) const override {
+        return false;
+    }
+
+    std::string help() const override {
+        return "read entries buffered by the in-memory profile sink for this database\n"
+               "options:\n"
+               "  sinceId: <n>  only return entries with 'sinkId' greater than n\n"
+               "  limit: <n>    maximum number of entries to return (default 100)\n"
+               "  clear: true   discard all buffered entries (for every database) after reading";
+    }
+
+    Status checkAuthForCommand(Client* client,
+                               const std::string& dbname,
+                               const BSONObj& cmdObj) const override {
+        // Reading the sink is equivalent to reading system.profile.
+        AuthorizationSession* authzSession = AuthorizationSession::get(client);
+        return authzSession->isAuthorizedForActionsOnResource(
+                   ResourcePattern::forExactNamespace({dbname, "system.profile"}),
+                   ActionType::find)
+            ? Status::OK()
+            : Status(ErrorCodes::Unauthorized, "unauthorized");
+    }
+
+    bool run(OperationContext* opCtx,
+             const std::string& dbname,
+             const BSONObj& cmdObj,
+             BSONObjBuilder& result) override {
+        long long sinceId = 0;
+        if (auto elem = cmdObj["sinceId"]) {
+            uassert(ErrorCodes::BadValue, "'sinceId' field must be a number", elem.isNumber());
+            sinceId = elem.numberLong();
+            uassert(ErrorCodes::BadValue, "'sinceId' field must be non-negative", sinceId >= 0);
+        }
+        long long limit = 100;
+        if (auto elem = cmdObj["limit"]) {
+            uassert(ErrorCodes::BadValue, "'limit' field must be a number", elem.isNumber());
+            limit = elem.numberLong();
+            uassert(ErrorCodes::BadValue, "'limit' field must be positive", limit > 0);
+        }
+
+        auto& sink = ProfileMemorySink::get();
+        sink.read(dbname, sinceId, limit, &result);
+        if (cmdObj["clear"].trueValue()) {
+            sink.clear();
+        }
+        return true;
+    }
+} cmdGetProfilingMemorySink;
+
 class CmdFileMD5 : public BasicCommand {
 public:
     CmdFileMD5() : BasicCommand("filemd5") {}
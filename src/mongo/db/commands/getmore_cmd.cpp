@@ -34,6 +34,7 @@
 #include <memory>
 #include <string>
 
+#include "mongo/db/auth/authorization_manager.h"
 #include "mongo/db/auth/authorization_session.h"
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/client.h"
@@ -42,6 +43,7 @@
 #include "mongo/db/curop.h"
 #include "mongo/db/curop_failpoint_helpers.h"
 #include "mongo/db/cursor_manager.h"
+#include "mongo/db/cursor_server_params_gen.h"
 #include "mongo/db/db_raii.h"
 #include "mongo/db/exec/working_set_common.h"
 #include "mongo/db/query/cursor_response.h"
@@ -58,7 +60,10 @@
 #include "mongo/db/stats/counters.h"
 #include "mongo/db/stats/top.h"
 #include "mongo/logv2/log.h"
+#include "mongo/platform/mutex.h"
 #include "mongo/s/chunk_version.h"
+#include "mongo/stdx/unordered_set.h"
+#include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/scopeguard.h"
 #include "mongo/util/time_support.h"
@@ -218,6 +223,198 @@ void setUpOperationContextStateForGetMore(OperationContext* opCtx,
     }
 }
 
+/**
+ * Runs cursors' executors in the background after a getMore has returned its batch, materializing
+ * the next batch into the executor's enqueue buffer so the client's next getMore can be answered
+ * without waiting on query execution. Enabled by the 'cursorReadAheadEnabled' server parameter.
+ */
+class CursorReadAhead {
+public:
+    /**
+     * Returns true if a background task is currently materializing a batch for the given cursor.
+     */
+    bool isReadingAhead(CursorId cursorId) {
+        stdx::lock_guard<Latch> lk(_mutex);
+        return _inProgress.count(cursorId);
+    }
+
+    /**
+     * Schedules a background task to materialize the next batch for the given cursor, which the
+     * caller must have just returned to the cursor manager. 'batchSize' carries the batch size of
+     * the getMore that scheduled the read-ahead, with 0 meaning no limit.
+     */
+    void schedule(CursorId cursorId, long long batchSize) {
+        {
+            stdx::lock_guard<Latch> lk(_mutex);
+            if (!_inProgress.insert(cursorId).second) {
+                return;
+            }
+            if (!_poolStarted) {
+                _pool.startup();
+                _poolStarted = true;
+            }
+        }
+
+        _pool.schedule([this, cursorId, batchSize](Status status) {
+            auto inProgressGuard = makeGuard([&] {
+                stdx::lock_guard<Latch> lk(_mutex);
+                _inProgress.erase(cursorId);
+            });
+            if (status.isOK()) {
+                _materializeNextBatch(cursorId, batchSize);
+            }
+        });
+    }
+
+private:
+    static ThreadPool::Options _makePoolOptions() {
+        ThreadPool::Options options;
+        options.poolName = "CursorReadAhead";
+        options.threadNamePrefix = "CursorReadAhead-";
+        options.minThreads = 0;
+        options.maxThreads = 4;
+        options.onCreateThread = [](const std::string& threadName) {
+            Client::initThread(threadName);
+        };
+        return options;
+    }
+
+    void _materializeNextBatch(CursorId cursorId, long long batchSize) noexcept;
+
+    Mutex _mutex = MONGO_MAKE_LATCH("CursorReadAhead::_mutex");
+    bool _poolStarted = false;
+    stdx::unordered_set<CursorId> _inProgress;
+    ThreadPool _pool{_makePoolOptions()};
+};
+
+const auto getCursorReadAhead = ServiceContext::declareDecoration<CursorReadAhead>();
+
+void CursorReadAhead::_materializeNextBatch(CursorId cursorId, long long batchSize) noexcept try {
+    auto opCtx = cc().makeOperationContext();
+    auto cursorManager = CursorManager::get(opCtx.get());
+
+    // The getMore that scheduled us may not have finished returning the cursor yet; retry the pin
+    // briefly to cover that window. If the cursor is gone, or a client operation got to it first,
+    // there is nothing useful left to do.
+    boost::optional<ClientCursorPin> pin;
+    for (int attempt = 0; !pin && attempt < 10; ++attempt) {
+        try {
+            auto swPin =
+                cursorManager->pinCursor(opCtx.get(), cursorId, CursorManager::kNoCheckSession);
+            if (!swPin.isOK()) {
+                return;
+            }
+            pin.emplace(std::move(swPin.getValue()));
+        } catch (const ExceptionFor<ErrorCodes::CursorInUse>&) {
+            sleepmillis(1);
+        }
+    }
+    if (!pin) {
+        return;
+    }
+
+    ClientCursor* cursor = pin->getCursor();
+    PlanExecutor* exec = cursor->getExecutor();
+
+    // Set up read concern, locks and storage options the way the next getMore would. A failure
+    // here leaves the cursor untouched, so just give up and let the client's next getMore proceed
+    // normally.
+    boost::optional<AutoGetCollectionForRead> readLock;
+    try {
+        applyCursorReadConcern(opCtx.get(), cursor->getReadConcernArgs());
+        if (cursor->lockPolicy() == ClientCursorParams::LockPolicy::kLockExternally) {
+            readLock.emplace(opCtx.get(), exec->nss());
+            uassertStatusOK(repl::ReplicationCoordinator::get(opCtx.get())
+                                ->checkCanServeReadsFor(opCtx.get(), cursor->nss(), true));
+        }
+        const auto* cq = exec->getCanonicalQuery();
+        if (cq && cq->getQueryRequest().isReadOnce()) {
+            opCtx->recoveryUnit()->setReadOnce(true);
+        }
+    } catch (const DBException&) {
+        return;
+    }
+
+    exec->reattachToOperationContext(opCtx.get());
+
+    // Run the executor the way generateBatch() would, but buffer the results locally: they cannot
+    // go into the executor's enqueue buffer while it is still being iterated, since getNext()
+    // drains that buffer first.
+    std::vector<BSONObj> batch;
+    boost::optional<BSONObj> overflow;
+    long long numResults = 0;
+    int bytesBuffered = 0;
+    PlanExecutor::ExecState state = PlanExecutor::ADVANCED;
+    Status error = Status::OK();
+    Document doc;
+    try {
+        exec->restoreState();
+        while (!FindCommon::enoughForGetMore(batchSize, numResults) &&
+               PlanExecutor::ADVANCED == (state = exec->getNext(&doc, nullptr))) {
+            BSONObj obj = doc.toBson();
+            if (!FindCommon::haveSpaceForNext(obj, numResults, bytesBuffered)) {
+                overflow = obj.getOwned();
+                break;
+            }
+            bytesBuffered += obj.objsize();
+            batch.push_back(obj.getOwned());
+            numResults++;
+        }
+        if (state == PlanExecutor::FAILURE) {
+            error = WorkingSetCommon::getMemberObjectStatus(doc);
+            invariant(!error.isOK());
+        }
+    } catch (const DBException& ex) {
+        error = ex.toStatus();
+    }
+
+    if (!error.isOK()) {
+        // Park the error on the cursor so the client's next getMore reports it, the same way the
+        // getMore that hit it directly would have. The executor must not be run again; if it
+        // cannot even be saved and detached, destroy the cursor outright.
+        try {
+            cursor->setReadAheadError(error);
+            exec->saveState();
+            exec->detachFromOperationContext();
+        } catch (const DBException&) {
+            pin->deleteUnderlying();
+        }
+        return;
+    }
+
+    try {
+        for (auto&& obj : batch) {
+            exec->enqueue(obj);
+        }
+        if (overflow) {
+            exec->enqueue(*overflow);
+        }
+        exec->saveState();
+        exec->detachFromOperationContext();
+    } catch (const DBException&) {
+        pin->deleteUnderlying();
+    }
+} catch (...) {
+    // A read-ahead failure must never take down the server; at worst the client's next getMore
+    // runs the executor itself, exactly as it would have without read-ahead.
+}
+
+/**
+ * Pins the cursor, first waiting out any background read-ahead task that currently has it pinned
+ * rather than failing with CursorInUse; the task is doing exactly the work this getMore would
+ * otherwise have to do itself.
+ */
+ClientCursorPin pinCursorAwaitingReadAhead(OperationContext* opCtx,
+                                           CursorManager* cursorManager,
+                                           CursorId cursorId) {
+    auto& readAhead = getCursorReadAhead(opCtx->getServiceContext());
+    while (readAhead.isReadingAhead(cursorId)) {
+        opCtx->checkForInterrupt();
+        sleepmillis(1);
+    }
+    return uassertStatusOK(cursorManager->pinCursor(opCtx, cursorId));
+}
+
 /**
  * A command for running getMore() against an existing cursor registered with a CursorManager.
  * Used to generate the next batch of results for a ClientCursor.
@@ -457,10 +654,25 @@ public:
             }
 
             // Ensure that the client still has the privileges to run the originating command.
-            if (!authzSession->isAuthorizedForPrivileges(cursorPin->getOriginatingPrivileges())) {
-                uasserted(ErrorCodes::Unauthorized,
-                          str::stream()
-                              << "not authorized for getMore with cursor id " << _request.cursorid);
+            // Re-evaluating the full privilege set on every batch is wasteful for cursor-heavy
+            // workloads, so the verdict is cached on the cursor and reused while the session's
+            // authenticated users and the authorization-data generation — which changes whenever
+            // user or role definitions do — stay the same.
+            const auto authCacheGeneration =
+                AuthorizationManager::get(opCtx->getServiceContext())->getCacheGeneration();
+            std::vector<UserName> authenticatedUsers;
+            for (auto nameIter = authzSession->getAuthenticatedUserNames(); nameIter.more();
+                 nameIter.next()) {
+                authenticatedUsers.push_back(*nameIter);
+            }
+            if (!cursorPin->isAuthVerified(authenticatedUsers, authCacheGeneration)) {
+                if (!authzSession->isAuthorizedForPrivileges(
+                        cursorPin->getOriginatingPrivileges())) {
+                    uasserted(ErrorCodes::Unauthorized,
+                              str::stream() << "not authorized for getMore with cursor id "
+                                            << _request.cursorid);
+                }
+                cursorPin->setAuthVerified(std::move(authenticatedUsers), authCacheGeneration);
             }
 
             if (_request.nss != cursorPin->nss()) {
@@ -493,6 +705,11 @@ public:
             // On early return, get rid of the cursor.
             auto cursorFreer = makeGuard([&] { cursorPin.deleteUnderlying(); });
 
+            // If a background read-ahead task failed while running this cursor's executor, report
+            // its error now rather than touching the executor again; 'cursorFreer' disposes of the
+            // cursor, just as if this getMore had hit the error itself.
+            uassertStatusOK(cursorPin->takeReadAheadError());
+
             // If the 'waitAfterPinningCursorBeforeGetMoreBatch' fail point is enabled, set the
             // 'msg' field of this operation's CurOp to signal that we've hit this point and then
             // repeatedly release and re-acquire the collection readLock at regular intervals until
@@ -666,6 +883,17 @@ public:
             if (respondWithId) {
                 cursorFreer.dismiss();
 
+                // Decide whether to materialize the next batch in the background once the cursor
+                // has been returned to the manager. Tailable cursors may block waiting for
+                // inserts, merging cursors attach shard metadata during batch generation,
+                // transaction cursors must run inside their transaction, exhaust streams have no
+                // idle gap to hide work in, and direct clients may hold locks the background task
+                // would deadlock against.
+                _scheduleReadAhead = gCursorReadAheadEnabled.load() && !opCtx->isExhaust() &&
+                    !opCtx->getClient()->isInDirectClient() && !cursorPin->isTailable() &&
+                    !cursorPin->needsMerge() && !cursorPin->getTxnNumber() &&
+                    !(cq && cq->getQueryRequest().getReadAtClusterTime());
+
                 if (opCtx->isExhaust()) {
                     // Indicate that an exhaust message should be generated and the previous BSONObj
                     // command parameters should be reused as the next BSONObj command parameters.
@@ -692,7 +920,7 @@ public:
             }
 
             auto cursorManager = CursorManager::get(opCtx);
-            auto cursorPin = uassertStatusOK(cursorManager->pinCursor(opCtx, _request.cursorid));
+            auto cursorPin = pinCursorAwaitingReadAhead(opCtx, cursorManager, _request.cursorid);
 
             // Get the read concern level here in case the cursor is exhausted while iterating.
             const auto isLinearizableReadConcern = cursorPin->getReadConcernArgs().getLevel() ==
@@ -720,9 +948,20 @@ public:
                     opCtx,
                     "waitBeforeUnpinningOrDeletingCursorAfterGetMoreBatch");
             }
+
+            if (_scheduleReadAhead) {
+                // Return the cursor to the manager now so the read-ahead task can pin it.
+                cursorPin.release();
+                getCursorReadAhead(opCtx->getServiceContext())
+                    .schedule(_request.cursorid, _request.batchSize.value_or(0));
+            }
         }
 
         const GetMoreRequest _request;
+
+        // Set while generating the batch if the cursor is eligible for background read-ahead of
+        // its next batch.
+        bool _scheduleReadAhead = false;
     };
 
     bool maintenanceOk() const override {
@@ -31,15 +31,20 @@
 
 #include "mongo/platform/basic.h"
 
+#include <functional>
+
 #include "mongo/db/auth/authorization_session.h"
 #include "mongo/db/commands.h"
 #include "mongo/db/commands/server_status.h"
+#include "mongo/db/commands/server_status_gen.h"
 #include "mongo/db/commands/server_status_internal.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/stats/counters.h"
 #include "mongo/logv2/log.h"
+#include "mongo/platform/mutex.h"
 #include "mongo/util/net/http_client.h"
 #include "mongo/util/net/socket_utils.h"
+#include "mongo/util/timer.h"
 #include "mongo/util/version.h"
 
 namespace mongo {
@@ -124,7 +129,36 @@ public:
                 continue;
             }
 
-            section->appendSection(opCtx, elem, &result);
+            // A section requested without any configuration can be served from a recent cached
+            // result. Sections mentioned in the command object are always regenerated, since a
+            // configElement (e.g. tcmalloc's verbosity) may parameterize the output.
+            const auto cacheTtl = Milliseconds(gServerStatusSectionCacheTtlMillis.load());
+            const bool cacheable = cacheTtl > Milliseconds(0) && elem.eoo();
+
+            if (cacheable) {
+                stdx::lock_guard<Latch> lk(_sectionCacheMutex);
+                auto it = _sectionCache.find(section->getSectionName());
+                if (it != _sectionCache.end() && clock->now() - it->second.generatedAt < cacheTtl) {
+                    result.appendElements(it->second.fields);
+                    continue;
+                }
+            }
+
+            Timer sectionTimer;
+            if (cacheable) {
+                BSONObjBuilder sectionBuilder;
+                section->appendSection(opCtx, elem, &sectionBuilder);
+                section->recordGenerateLatency(Microseconds(sectionTimer.micros()));
+                const auto sectionObj = sectionBuilder.obj();
+                result.appendElements(sectionObj);
+
+                stdx::lock_guard<Latch> lk(_sectionCacheMutex);
+                _sectionCache[section->getSectionName()] = {clock->now(), sectionObj};
+            } else {
+                section->appendSection(opCtx, elem, &result);
+                section->recordGenerateLatency(Microseconds(sectionTimer.micros()));
+            }
+
             timeBuilder.appendNumber(
                 static_cast<string>(str::stream() << "after " << section->getSectionName()),
                 durationCount<Milliseconds>(clock->now() - runStart));
@@ -168,12 +202,29 @@ public:
         _sections[section->getSectionName()] = section;
     }
 
+    void forEachSection(const std::function<void(const ServerStatusSection&)>& fn) const {
+        for (SectionMap::const_iterator i = _sections.begin(); i != _sections.end(); ++i) {
+            fn(*i->second);
+        }
+    }
+
 private:
     const Date_t _started;
     bool _runCalled;
 
     typedef map<string, ServerStatusSection*> SectionMap;
     SectionMap _sections;
+
+    // Most recently generated result of each section, so that frequent unconfigured serverStatus
+    // calls (e.g. one monitoring agent per second) don't regenerate expensive sections within
+    // 'serverStatusSectionCacheTtlMillis'. 'fields' holds the full set of top-level fields the
+    // section appended, since a section may append more than one.
+    struct CachedSectionResult {
+        Date_t generatedAt;
+        BSONObj fields;
+    };
+    Mutex _sectionCacheMutex = MONGO_MAKE_LATCH("CmdServerStatus::_sectionCacheMutex");
+    map<string, CachedSectionResult> _sectionCache;
 };
 
 namespace {
@@ -276,6 +327,32 @@ public:
     }
 } memBase;
 
+class SectionTimings : public ServerStatusSection {
+public:
+    SectionTimings() : ServerStatusSection("sectionTimings") {}
+
+    bool includeByDefault() const override {
+        return false;
+    }
+
+    BSONObj generateSection(OperationContext* opCtx,
+                            const BSONElement& configElement) const override {
+        BSONObjBuilder bb;
+        CmdServerStatusInstantiator::getInstance().forEachSection(
+            [&bb](const ServerStatusSection& section) {
+                const auto count = section.getGenerateCount();
+                if (!count) {
+                    return;
+                }
+                BSONObjBuilder sub(bb.subobjStart(section.getSectionName()));
+                sub.appendNumber("generations", count);
+                sub.appendNumber("totalMicros", section.getTotalGenerateLatencyMicros());
+            });
+        return bb.obj();
+    }
+
+} sectionTimings;
+
 class HttpClientServerStatus : public ServerStatusSection {
 public:
     HttpClientServerStatus() : ServerStatusSection("http_client") {}
@@ -33,6 +33,7 @@
 #include "mongo/db/jsobj.h"
 #include "mongo/db/stats/counters.h"
 #include "mongo/platform/atomic_word.h"
+#include "mongo/util/duration.h"
 #include <string>
 
 namespace mongo {
@@ -103,8 +104,31 @@ public:
         result->append(getSectionName(), ret);
     }
 
+    /**
+     * Records that one generation of this section took 'micros'. Called by the serverStatus
+     * command around appendSection(); the totals are reported by its 'sectionTimings' section so
+     * expensive sections can be identified.
+     */
+    void recordGenerateLatency(Microseconds micros) {
+        _generateCount.fetchAndAddRelaxed(1);
+        _totalGenerateLatencyMicros.fetchAndAddRelaxed(durationCount<Microseconds>(micros));
+    }
+
+    long long getGenerateCount() const {
+        return _generateCount.loadRelaxed();
+    }
+
+    long long getTotalGenerateLatencyMicros() const {
+        return _totalGenerateLatencyMicros.loadRelaxed();
+    }
+
 private:
     const std::string _sectionName;
+
+    // How many times this section has been generated and how long those generations took in
+    // aggregate, across all serverStatus invocations.
+    AtomicWord<long long> _generateCount{0};
+    AtomicWord<long long> _totalGenerateLatencyMicros{0};
 };
 
 class OpCounterServerStatusSection : public ServerStatusSection {
@@ -29,18 +29,80 @@
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kTest
 
 #include "mongo/platform/basic.h"
+
+#include <algorithm>
+#include <vector>
+
 #include <benchmark/benchmark.h>
 
+#ifdef __linux__
+#include <sched.h>
+#endif
+
 #include "mongo/db/concurrency/d_concurrency.h"
 #include "mongo/db/concurrency/lock_manager_test_help.h"
 #include "mongo/db/storage/recovery_unit_noop.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/unittest/unittest.h"
+#include "mongo/util/concurrency/ticketholder.h"
+#include "mongo/util/processinfo.h"
+#include "mongo/util/timer.h"
 
 namespace mongo {
 namespace {
 
-const int kMaxPerfThreads = 16;  // max number of threads to use for lock perf
+const int kMaxPerfThreads = 16;        // max number of threads to use for lock perf
+const int kMaxContentionThreads = 64;  // max number of threads for the contention scenarios
+
+#ifdef __linux__
+/**
+ * Pins the calling benchmark thread to a core, round-robin over all cores available to the
+ * process. On multi-socket machines that enumerate cores round-robin across NUMA nodes this
+ * spreads the lock traffic over both sockets, so the contention scenarios exercise cross-socket
+ * cache line migration instead of staying NUMA-local by scheduler accident.
+ */
+void pinThreadToCore(int threadIndex) {
+    const auto numCores = ProcessInfo::getNumAvailableCores();
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(threadIndex % numCores, &cpus);
+    sched_setaffinity(0, sizeof(cpus), &cpus);
+}
+#else
+void pinThreadToCore(int) {}
+#endif
+
+/**
+ * Returns whether this benchmark thread should acquire locks in a writer mode. The benchmark's
+ * first argument is the percentage of threads that write; rounds up so any nonzero mix has at
+ * least one writer.
+ */
+bool isWriterThread(const benchmark::State& state) {
+    return state.thread_index < (state.threads * state.range(0) + 99) / 100;
+}
+
+/**
+ * Publishes a latency distribution summary for this thread's acquisition samples. Throughput
+ * alone hides the convoys that form behind exclusive lock holders, so the contention scenarios
+ * report percentiles as well. Counters are averaged across threads by the benchmark framework.
+ */
+void appendLatencyCounters(benchmark::State& state, std::vector<long long>& latenciesMicros) {
+    if (latenciesMicros.empty())
+        return;
+
+    std::sort(latenciesMicros.begin(), latenciesMicros.end());
+    const auto percentile = [&](double p) {
+        return static_cast<double>(
+            latenciesMicros[static_cast<size_t>(p * (latenciesMicros.size() - 1))]);
+    };
+
+    using benchmark::Counter;
+    state.counters["latencyP50Micros"] = Counter(percentile(0.50), Counter::kAvgThreads);
+    state.counters["latencyP95Micros"] = Counter(percentile(0.95), Counter::kAvgThreads);
+    state.counters["latencyP99Micros"] = Counter(percentile(0.99), Counter::kAvgThreads);
+    state.counters["latencyMaxMicros"] =
+        Counter(static_cast<double>(latenciesMicros.back()), Counter::kAvgThreads);
+}
 
 
 class DConcurrencyTest : public benchmark::Fixture {
@@ -166,6 +228,117 @@ BENCHMARK_DEFINE_F(DConcurrencyTest, BM_MMAPv1CollectionExclusiveLock)(benchmark
     }
 }
 
+BENCHMARK_DEFINE_F(DConcurrencyTest, BM_GlobalLockContendedMix)(benchmark::State& state) {
+    std::unique_ptr<ForceSupportsDocLocking> supportDocLocking;
+
+    if (state.thread_index == 0) {
+        makeKClientsWithLockers(state.threads);
+        supportDocLocking = std::make_unique<ForceSupportsDocLocking>(true);
+    }
+    pinThreadToCore(state.thread_index);
+
+    const bool isWriter = isWriterThread(state);
+    auto opCtx = clients[state.thread_index].second.get();
+    std::vector<long long> latenciesMicros;
+
+    for (auto keepRunning : state) {
+        Timer timer;
+        Lock::GlobalLock lk(opCtx, isWriter ? MODE_X : MODE_IS);
+        latenciesMicros.push_back(timer.micros());
+    }
+
+    appendLatencyCounters(state, latenciesMicros);
+    if (state.thread_index == 0) {
+        clients.clear();
+    }
+}
+
+BENCHMARK_DEFINE_F(DConcurrencyTest, BM_DBLockContendedMix)(benchmark::State& state) {
+    std::unique_ptr<ForceSupportsDocLocking> supportDocLocking;
+
+    if (state.thread_index == 0) {
+        makeKClientsWithLockers(state.threads);
+        supportDocLocking = std::make_unique<ForceSupportsDocLocking>(true);
+    }
+    pinThreadToCore(state.thread_index);
+
+    const bool isWriter = isWriterThread(state);
+    auto opCtx = clients[state.thread_index].second.get();
+    std::vector<long long> latenciesMicros;
+
+    for (auto keepRunning : state) {
+        Timer timer;
+        Lock::DBLock dlk(opCtx, "test", isWriter ? MODE_X : MODE_IS);
+        latenciesMicros.push_back(timer.micros());
+    }
+
+    appendLatencyCounters(state, latenciesMicros);
+    if (state.thread_index == 0) {
+        clients.clear();
+    }
+}
+
+BENCHMARK_DEFINE_F(DConcurrencyTest, BM_CollectionLockContendedMix)(benchmark::State& state) {
+    std::unique_ptr<ForceSupportsDocLocking> supportDocLocking;
+
+    if (state.thread_index == 0) {
+        makeKClientsWithLockers(state.threads);
+        supportDocLocking = std::make_unique<ForceSupportsDocLocking>(true);
+    }
+    pinThreadToCore(state.thread_index);
+
+    const bool isWriter = isWriterThread(state);
+    auto opCtx = clients[state.thread_index].second.get();
+    std::vector<long long> latenciesMicros;
+
+    for (auto keepRunning : state) {
+        Timer timer;
+        Lock::DBLock dlk(opCtx, "test", isWriter ? MODE_IX : MODE_IS);
+        Lock::CollectionLock clk(
+            opCtx, NamespaceString("test.coll"), isWriter ? MODE_X : MODE_IS);
+        latenciesMicros.push_back(timer.micros());
+    }
+
+    appendLatencyCounters(state, latenciesMicros);
+    if (state.thread_index == 0) {
+        clients.clear();
+    }
+}
+
+BENCHMARK_DEFINE_F(DConcurrencyTest, BM_TicketHolderSaturation)(benchmark::State& state) {
+    std::unique_ptr<ForceSupportsDocLocking> supportDocLocking;
+    std::unique_ptr<TicketHolder> tickets;
+
+    // The benchmark's argument is the number of global lock tickets. Running with more threads
+    // than tickets queues acquisitions in the ticket holder the same way a node saturating its
+    // configured storage engine concurrency does.
+    if (state.thread_index == 0) {
+        makeKClientsWithLockers(state.threads);
+        supportDocLocking = std::make_unique<ForceSupportsDocLocking>(true);
+        tickets = std::make_unique<TicketHolder>(state.range(0));
+        Locker::setGlobalThrottling(tickets.get(), tickets.get());
+    }
+    pinThreadToCore(state.thread_index);
+
+    // Odd threads draw writer tickets, even threads reader tickets, so both ticket pools see
+    // traffic the way a mixed workload would.
+    const bool isWriter = state.thread_index % 2;
+    auto opCtx = clients[state.thread_index].second.get();
+    std::vector<long long> latenciesMicros;
+
+    for (auto keepRunning : state) {
+        Timer timer;
+        Lock::GlobalLock lk(opCtx, isWriter ? MODE_IX : MODE_IS);
+        latenciesMicros.push_back(timer.micros());
+    }
+
+    appendLatencyCounters(state, latenciesMicros);
+    if (state.thread_index == 0) {
+        Locker::setGlobalThrottling(nullptr, nullptr);
+        clients.clear();
+    }
+}
+
 BENCHMARK_REGISTER_F(DConcurrencyTest, BM_StdMutex)->ThreadRange(1, kMaxPerfThreads);
 
 BENCHMARK_REGISTER_F(DConcurrencyTest, BM_ResourceMutexShared)->ThreadRange(1, kMaxPerfThreads);
@@ -181,5 +354,37 @@ BENCHMARK_REGISTER_F(DConcurrencyTest, BM_MMAPv1CollectionSharedLock)
 BENCHMARK_REGISTER_F(DConcurrencyTest, BM_MMAPv1CollectionExclusiveLock)
     ->ThreadRange(1, kMaxPerfThreads);
 
+// Contention scenarios: the argument is the percentage of writer threads in the mix. Real time
+// is reported because convoys behind exclusive holders show up in wall clock, not CPU time.
+BENCHMARK_REGISTER_F(DConcurrencyTest, BM_GlobalLockContendedMix)
+    ->Arg(0)
+    ->Arg(10)
+    ->Arg(50)
+    ->Arg(100)
+    ->ThreadRange(1, kMaxContentionThreads)
+    ->UseRealTime();
+BENCHMARK_REGISTER_F(DConcurrencyTest, BM_DBLockContendedMix)
+    ->Arg(0)
+    ->Arg(10)
+    ->Arg(50)
+    ->Arg(100)
+    ->ThreadRange(1, kMaxContentionThreads)
+    ->UseRealTime();
+BENCHMARK_REGISTER_F(DConcurrencyTest, BM_CollectionLockContendedMix)
+    ->Arg(0)
+    ->Arg(10)
+    ->Arg(50)
+    ->Arg(100)
+    ->ThreadRange(1, kMaxContentionThreads)
+    ->UseRealTime();
+
+// Ticket holder saturation: the argument is the number of global lock tickets available.
+BENCHMARK_REGISTER_F(DConcurrencyTest, BM_TicketHolderSaturation)
+    ->Arg(4)
+    ->Arg(16)
+    ->Arg(128)
+    ->ThreadRange(1, kMaxContentionThreads)
+    ->UseRealTime();
+
 }  // namespace
 }  // namespace mongo
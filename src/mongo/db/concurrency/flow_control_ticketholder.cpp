@@ -78,8 +78,9 @@ void FlowControlTicketholder::set(ServiceContext* service,
     globalFlow = std::move(flowControl);
 }
 
-void FlowControlTicketholder::refreshTo(int numTickets) {
+void FlowControlTicketholder::refreshTo(int numTickets, int lowPriorityReserve) {
     invariant(numTickets >= 0);
+    invariant(lowPriorityReserve >= 0);
     stdx::lock_guard<Latch> lk(_mutex);
     LOGV2_DEBUG(20518,
                 4,
@@ -87,6 +88,7 @@ void FlowControlTicketholder::refreshTo(int numTickets) {
                 "tickets"_attr = _tickets,
                 "numTickets"_attr = numTickets);
     _tickets = numTickets;
+    _lowPriorityReserve = lowPriorityReserve;
     _cv.notify_all();
 }
 
@@ -97,8 +99,13 @@ void FlowControlTicketholder::getTicket(OperationContext* opCtx,
         return;
     }
 
+    // Low-priority operations leave the last `_lowPriorityReserve` tickets of each refresh period
+    // for normal-priority operations, so backpressure squeezes background and bulk traffic first.
+    const bool lowPriority = opCtx->getAdmissionPriority() == AdmissionPriority::kLow;
+    auto ticketAvailable = [&] { return _tickets > (lowPriority ? _lowPriorityReserve : 0); };
+
     LOGV2_DEBUG(20519, 4, "Taking ticket.", "Available"_attr = _tickets);
-    if (_tickets == 0) {
+    if (!ticketAvailable()) {
         ++stats->acquireWaitCount;
     }
 
@@ -120,7 +127,7 @@ void FlowControlTicketholder::getTicket(OperationContext* opCtx,
 
     // getTicket() should block until there are tickets or the Ticketholder is in shutdown
     while (!opCtx->waitForConditionOrInterruptFor(
-        _cv, lk, Milliseconds(500), [&] { return _tickets > 0 || _inShutdown; })) {
+        _cv, lk, Milliseconds(500), [&] { return ticketAvailable() || _inShutdown; })) {
         updateTotalTime();
     }
 
@@ -79,7 +79,12 @@ public:
 
     static void set(ServiceContext* service, std::unique_ptr<FlowControlTicketholder> flowControl);
 
-    void refreshTo(int numTickets);
+    /**
+     * Resets the number of available tickets for the next time period. The last
+     * 'lowPriorityReserve' tickets of the period may only be taken by normal-priority operations;
+     * once the pool drains to the reserve, low-priority operations wait for the next refresh.
+     */
+    void refreshTo(int numTickets, int lowPriorityReserve = 0);
 
     void getTicket(OperationContext* opCtx, FlowControlTicketholder::CurOp* stats);
 
@@ -96,6 +101,7 @@ private:
     Mutex _mutex = MONGO_MAKE_LATCH("FlowControlTicketHolder::_mutex");
     stdx::condition_variable _cv;
     int _tickets;
+    int _lowPriorityReserve = 0;
 
     bool _inShutdown;  // used to synchronize shutdown of the ticket refresher job
 };
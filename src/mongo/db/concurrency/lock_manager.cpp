@@ -33,6 +33,8 @@
 
 #include "mongo/db/concurrency/lock_manager.h"
 
+#include <algorithm>
+
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
@@ -46,6 +48,7 @@
 #include "mongo/db/concurrency/locker.h"
 #include "mongo/logv2/log.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/processinfo.h"
 #include "mongo/util/str.h"
 #include "mongo/util/timer.h"
 
@@ -410,12 +413,33 @@ void LockHead::migratePartitionedLockHeads() {
 // LockManager
 //
 
+namespace {
+
 // Have more buckets than CPUs to reduce contention on lock and caches
-const unsigned LockManager::_numLockBuckets(128);
+const unsigned kMinLockBuckets = 128;
 
 // Balance scalability of intent locks against potential added cost of conflicting locks.
 // The exact value doesn't appear very important, but should be power of two
-const unsigned LockManager::_numPartitions = 32;
+const unsigned kMinPartitions = 32;
+
+/**
+ * Scales a minimum table size to the machine: at least 'minimum', at least 'coresMultiplier'
+ * times the number of available cores, rounded up to a power of two so the modulo in the hash
+ * stays a mask. On many-core boxes this gives every core its own intent-lock partition, so
+ * uncontended MODE_IS/MODE_IX acquisitions on the Global and Database resources do not share
+ * partition mutexes.
+ */
+unsigned scaleToCores(unsigned minimum, unsigned coresMultiplier) {
+    unsigned target = std::max(
+        minimum, coresMultiplier * static_cast<unsigned>(ProcessInfo::getNumAvailableCores()));
+    unsigned size = 1;
+    while (size < target) {
+        size <<= 1;
+    }
+    return size;
+}
+
+}  // namespace
 
 // static
 std::map<LockerId, BSONObj> LockManager::getLockToClientMap(ServiceContext* serviceContext) {
@@ -443,7 +467,9 @@ std::map<LockerId, BSONObj> LockManager::getLockToClientMap(ServiceContext* serv
     return lockToClientMap;
 }
 
-LockManager::LockManager() {
+LockManager::LockManager()
+    : _numLockBuckets(scaleToCores(kMinLockBuckets, 2)),
+      _numPartitions(scaleToCores(kMinPartitions, 1)) {
     _lockBuckets = new LockBucket[_numLockBuckets];
     _partitions = new Partition[_numPartitions];
 }
@@ -687,6 +713,22 @@ void LockManager::downgrade(LockRequest* request, LockMode newMode) {
     _onLockModeChanged(lock, true);
 }
 
+bool LockManager::hasConflictingRequests(ResourceId resId) const {
+    LockBucket* bucket = _getBucket(resId);
+    stdx::lock_guard<SimpleMutex> scopedLock(bucket->mutex);
+
+    // Requests on a resource acquired only in intent (self-compatible) modes live on
+    // PartitionedLockHeads, which by construction never have conflicts. A conflicting request
+    // migrates all partitioned requests to the bucket's LockHead, so it is sufficient to look
+    // there.
+    LockBucket::Map::const_iterator it = bucket->data.find(resId);
+    if (it == bucket->data.end()) {
+        return false;
+    }
+
+    return !it->second->conflictList.empty();
+}
+
 void LockManager::cleanupUnusedLocks() {
     for (unsigned i = 0; i < _numLockBuckets; i++) {
         LockBucket* bucket = &_lockBuckets[i];
@@ -40,6 +40,7 @@
 #include "mongo/db/concurrency/flow_control_ticketholder.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/service_context.h"
+#include "mongo/db/stats/operation_latency_phases.h"
 #include "mongo/db/storage/flow_control.h"
 #include "mongo/logv2/log.h"
 #include "mongo/platform/compiler.h"
@@ -688,6 +689,30 @@ ResourceId LockerImpl::getWaitingResource() const {
     return ResourceId();
 }
 
+bool LockerImpl::hasConflictingWaiters() const {
+    // Snapshot the held resources under the spinlock, then consult the lock manager without it;
+    // the lock manager's bucket mutexes must not be acquired while the spinlock is held.
+    std::vector<ResourceId> heldResources;
+    {
+        scoped_spinlock scopedLock(_lock);
+        LockRequestsMap::ConstIterator it = _requests.begin();
+        while (!it.finished()) {
+            if (it->status == LockRequest::STATUS_GRANTED) {
+                heldResources.push_back(it.key());
+            }
+            it.next();
+        }
+    }
+
+    for (ResourceId resId : heldResources) {
+        if (globalLockManager.hasConflictingRequests(resId)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 void LockerImpl::getLockerInfo(LockerInfo* lockerInfo,
                                const boost::optional<SingleThreadedLockStats> lockStatsBase) const {
     invariant(lockerInfo);
@@ -850,6 +875,28 @@ LockResult LockerImpl::_lockBegin(OperationContext* opCtx, ResourceId resId, Loc
         return LOCK_OK;
     }
 
+    // Fast path for re-acquiring a lock in a mode already covered by the granted mode (e.g. the
+    // second MODE_IX on the same collection within one operation). LockManager::convert() takes
+    // the same shortcut, but reaching it still pays for the global-resource flag handling and the
+    // call into the lock manager. Bumping the count here is safe without synchronization because
+    // all calls for the same LockRequest are made by this locker's thread, and skipping the
+    // enqueue flag updates is safe because a covered re-request never introduces a stronger mode.
+    if (!isNew && request->status == LockRequest::STATUS_GRANTED &&
+        isModeCovered(mode, request->mode)) {
+        globalStats.recordAcquisition(_id, resId, mode);
+        _stats.recordAcquisition(resId, mode);
+        request->recursiveCount++;
+        if (opCtx && _uninterruptibleLocksRequested == 0) {
+            auto interruptStatus = opCtx->checkForInterruptNoAssert();
+            if (!interruptStatus.isOK()) {
+                // Undo the increment; the lock stays held at its previous recursion depth.
+                request->recursiveCount--;
+                uassertStatusOK(interruptStatus);
+            }
+        }
+        return LOCK_OK;
+    }
+
     // Making this call here will record lock re-acquisitions and conversions as well.
     globalStats.recordAcquisition(_id, resId, mode);
     _stats.recordAcquisition(resId, mode);
@@ -990,6 +1037,14 @@ void LockerImpl::_lockComplete(OperationContext* opCtx,
 
     invariant(result == LOCK_OK);
     unlockOnErrorGuard.dismiss();
+
+    // _lockComplete() is only entered when the lock was not granted immediately, so the whole
+    // time since 'startOfTotalWaitTime' was spent blocked.
+    if (opCtx) {
+        OperationLatencyPhases::get(opCtx).add(
+            OperationLatencyPhases::kLockWait,
+            Microseconds(int64_t(curTimeMicros64() - startOfTotalWaitTime)));
+    }
 }
 
 void LockerImpl::getFlowControlTicket(OperationContext* opCtx, LockMode lockMode) {
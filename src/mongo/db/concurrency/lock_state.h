@@ -396,6 +396,8 @@ public:
     virtual bool hasLockPending() const {
         return getWaitingResource().isValid();
     }
+
+    virtual bool hasConflictingWaiters() const;
 };
 
 /**
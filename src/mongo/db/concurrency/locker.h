@@ -465,6 +465,13 @@ public:
      */
     virtual bool hasLockPending() const = 0;
 
+    /**
+     * Returns whether another operation is queued behind any lock this locker currently holds.
+     * Yielding plans use this to determine whether giving up their locks would actually allow
+     * anyone else to make progress.
+     */
+    virtual bool hasConflictingWaiters() const = 0;
+
     /**
      * If set to false, this opts out of conflicting with replication's use of the
      * ParallelBatchWriterMode lock. Code that opts-out must be ok with seeing an inconsistent view
@@ -244,6 +244,11 @@ public:
         MONGO_UNREACHABLE;
     }
 
+    virtual bool hasConflictingWaiters() const {
+        // A noop locker holds no lock manager locks, so nothing can be queued behind it.
+        return false;
+    }
+
     bool isGlobalLockedRecursively() override {
         return false;
     }
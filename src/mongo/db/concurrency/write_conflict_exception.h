@@ -32,6 +32,7 @@
 #include <exception>
 
 #include "mongo/base/string_data.h"
+#include "mongo/db/concurrency/write_conflict_hotspots.h"
 #include "mongo/db/curop.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/fail_point.h"
@@ -91,10 +92,14 @@ auto writeConflictRetry(OperationContext* opCtx, StringData opStr, StringData ns
     int attempts = 0;
     while (true) {
         try {
+            // When this namespace is conflicting heavily, retries take its retry ticket and run
+            // one at a time instead of optimistically racing each other.
+            auto ticket = attempts == 0 ? WriteConflictHotspots::RetryTicket()
+                                        : globalWriteConflictHotspots.waitForRetry(opCtx, ns);
             return f();
         } catch (WriteConflictException const&) {
             CurOp::get(opCtx)->debug().additiveMetrics.incrementWriteConflicts(1);
-            WriteConflictException::logAndBackoff(attempts, opStr, ns);
+            globalWriteConflictHotspots.recordConflictAndBackoff(opCtx, attempts, opStr, ns);
             ++attempts;
             opCtx->recoveryUnit()->abandonSnapshot();
         }
@@ -0,0 +1,278 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kWrite
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/concurrency/write_conflict_hotspots.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "mongo/db/commands/server_status.h"
+#include "mongo/db/concurrency/write_conflict_exception_gen.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/logv2/log.h"
+
+namespace mongo {
+
+namespace {
+
+// Matches the cap of the fixed backoff schedule this registry replaces.
+constexpr long long kMaxBackoffMillis = 100;
+
+// The first few retries usually succeed by simply rereading the document, so they pay no delay
+// unless the namespace is already conflicting heavily.
+constexpr int kFreeAttempts = 4;
+
+// Evict a tracked namespace only once it has been quiet this long.
+constexpr Seconds kSlotIdleTime{60};
+
+}  // namespace
+
+WriteConflictHotspots::RetryTicket::RetryTicket(RetryTicket&& other) noexcept
+    : _hotspots(std::exchange(other._hotspots, nullptr)),
+      _slot(std::exchange(other._slot, nullptr)) {}
+
+WriteConflictHotspots::RetryTicket& WriteConflictHotspots::RetryTicket::operator=(
+    RetryTicket&& other) noexcept {
+    if (this != &other) {
+        if (_hotspots) {
+            _hotspots->_releaseTicket(_slot);
+        }
+        _hotspots = std::exchange(other._hotspots, nullptr);
+        _slot = std::exchange(other._slot, nullptr);
+    }
+    return *this;
+}
+
+WriteConflictHotspots::RetryTicket::~RetryTicket() {
+    if (_hotspots) {
+        _hotspots->_releaseTicket(_slot);
+    }
+}
+
+void WriteConflictHotspots::recordConflictAndBackoff(OperationContext* opCtx,
+                                                     int attempt,
+                                                     StringData operation,
+                                                     StringData ns) {
+    long long conflictsPerSec = 0;
+    Milliseconds backoff{0};
+    {
+        stdx::lock_guard<Latch> lk(_mutex);
+        ++_totalConflicts;
+        const auto now = Date_t::now();
+        if (auto* slot = _findOrCreateSlot(lk, ns, now)) {
+            ++slot->totalConflicts;
+            conflictsPerSec = _conflictsPerSecond(lk, slot, now);
+            ++slot->windowConflicts;
+        } else {
+            ++_untrackedConflicts;
+        }
+        backoff = _computeBackoff(lk, attempt, conflictsPerSec);
+    }
+
+    LOGV2_DEBUG(4957916,
+                1,
+                "Caught WriteConflictException",
+                "operation"_attr = operation,
+                "ns"_attr = ns,
+                "attempt"_attr = attempt + 1,
+                "nsConflictsPerSec"_attr = conflictsPerSec,
+                "backoffMillis"_attr = durationCount<Milliseconds>(backoff));
+
+    if (backoff > Milliseconds(0)) {
+        opCtx->sleepFor(backoff);
+    }
+}
+
+WriteConflictHotspots::RetryTicket WriteConflictHotspots::waitForRetry(OperationContext* opCtx,
+                                                                       StringData ns) {
+    const auto threshold = gWriteConflictRetrySerializationThreshold.load();
+    if (threshold <= 0) {
+        return {};
+    }
+
+    stdx::unique_lock<Latch> lk(_mutex);
+    auto it = _slots.find(ns);
+    if (it == _slots.end()) {
+        return {};
+    }
+    auto& slot = it->second;
+    if (_conflictsPerSecond(lk, &slot, Date_t::now()) < threshold) {
+        return {};
+    }
+
+    opCtx->waitForConditionOrInterruptUntil(
+        _retryDone, lk, Date_t::now() + kMaxQueueWait, [&] { return !slot.retryInProgress; });
+    if (slot.retryInProgress) {
+        // Timed out waiting for a turn; retry optimistically rather than stalling further.
+        return {};
+    }
+    slot.retryInProgress = true;
+    return RetryTicket(this, &slot);
+}
+
+void WriteConflictHotspots::report(BSONObjBuilder* bob, bool includeHotspots) const {
+    stdx::lock_guard<Latch> lk(_mutex);
+    bob->append("totalConflicts", _totalConflicts);
+    bob->append("trackedNamespaces", static_cast<long long>(_slots.size()));
+    bob->append("untrackedConflicts", _untrackedConflicts);
+
+    if (!includeHotspots) {
+        return;
+    }
+
+    std::vector<std::pair<StringData, const Slot*>> byConflicts;
+    byConflicts.reserve(_slots.size());
+    for (auto&& entry : _slots) {
+        byConflicts.emplace_back(entry.first, &entry.second);
+    }
+    std::sort(byConflicts.begin(), byConflicts.end(), [](auto&& lhs, auto&& rhs) {
+        return lhs.second->totalConflicts > rhs.second->totalConflicts;
+    });
+
+    constexpr size_t kTopHotspots = 10;
+    BSONArrayBuilder hotspots(bob->subarrayStart("hotspots"));
+    for (size_t i = 0; i < byConflicts.size() && i < kTopHotspots; ++i) {
+        BSONObjBuilder hotspot(hotspots.subobjStart());
+        hotspot.append("ns", byConflicts[i].first);
+        hotspot.append("conflicts", byConflicts[i].second->totalConflicts);
+        hotspot.append("conflictsPerSec",
+                       std::max(byConflicts[i].second->windowConflicts,
+                                byConflicts[i].second->lastWindowConflicts));
+    }
+}
+
+WriteConflictHotspots::Slot* WriteConflictHotspots::_findOrCreateSlot(WithLock lk,
+                                                                      StringData ns,
+                                                                      Date_t now) {
+    auto it = _slots.find(ns);
+    if (it != _slots.end()) {
+        return &it->second;
+    }
+    if (_slots.size() >= kMaxTrackedNamespaces && !_evictIdleSlot(lk, now)) {
+        return nullptr;
+    }
+    Slot slot;
+    slot.windowStart = now;
+    return &_slots.emplace(std::string(ns), slot).first->second;
+}
+
+bool WriteConflictHotspots::_evictIdleSlot(WithLock, Date_t now) {
+    auto victim = _slots.end();
+    for (auto it = _slots.begin(); it != _slots.end(); ++it) {
+        // Slots with a retry in progress are pinned by an outstanding RetryTicket.
+        if (it->second.retryInProgress || now - it->second.windowStart < kSlotIdleTime) {
+            continue;
+        }
+        if (victim == _slots.end() || it->second.windowStart < victim->second.windowStart) {
+            victim = it;
+        }
+    }
+    if (victim == _slots.end()) {
+        return false;
+    }
+    _untrackedConflicts += victim->second.totalConflicts;
+    _slots.erase(victim);
+    return true;
+}
+
+long long WriteConflictHotspots::_conflictsPerSecond(WithLock, Slot* slot, Date_t now) {
+    if (now - slot->windowStart >= Seconds(1)) {
+        // The previous window only feeds the estimate when it is actually adjacent; after a
+        // longer quiet period the rate starts over from zero.
+        slot->lastWindowConflicts =
+            now - slot->windowStart < Seconds(2) ? slot->windowConflicts : 0;
+        slot->windowStart = now;
+        slot->windowConflicts = 0;
+    }
+    return std::max(slot->windowConflicts, slot->lastWindowConflicts);
+}
+
+Milliseconds WriteConflictHotspots::_computeBackoff(WithLock,
+                                                    int attempt,
+                                                    long long conflictsPerSec) {
+    long long millis = 0;
+    if (attempt >= kFreeAttempts) {
+        millis = std::min(1LL << std::min(attempt - kFreeAttempts, 6), kMaxBackoffMillis);
+    }
+    // Hotter namespaces back off harder, so retriers of a hot document spread out instead of
+    // burning CPU re-running the conflicting portion of the operation.
+    if (conflictsPerSec > 0) {
+        millis = std::min(millis * (1 + conflictsPerSec / 100), kMaxBackoffMillis);
+    }
+    if (millis == 0 && conflictsPerSec >= 100) {
+        millis = 1;
+    }
+    if (millis == 0) {
+        return Milliseconds(0);
+    }
+    // Jitter over [millis / 2, millis] breaks up retriers that conflicted at the same moment.
+    return Milliseconds(millis / 2 + _random.nextInt64(millis - millis / 2 + 1));
+}
+
+void WriteConflictHotspots::_releaseTicket(void* slot) {
+    {
+        stdx::lock_guard<Latch> lk(_mutex);
+        static_cast<Slot*>(slot)->retryInProgress = false;
+    }
+    _retryDone.notify_all();
+}
+
+WriteConflictHotspots globalWriteConflictHotspots;
+
+namespace {
+
+class WriteConflictsSSS : public ServerStatusSection {
+public:
+    WriteConflictsSSS() : ServerStatusSection("writeConflicts") {}
+
+    bool includeByDefault() const override {
+        return true;
+    }
+
+    BSONObj generateSection(OperationContext* opCtx,
+                            const BSONElement& configElement) const override {
+        // The summary counters are cheap enough for FTDC's periodic serverStatus sample; the
+        // per-namespace table is only emitted when asked for explicitly, e.g.
+        // db.serverStatus({writeConflicts: {hotspots: true}}).
+        const bool includeHotspots =
+            configElement.isABSONObj() && configElement.Obj()["hotspots"].trueValue();
+        BSONObjBuilder bob;
+        globalWriteConflictHotspots.report(&bob, includeHotspots);
+        return bob.obj();
+    }
+} writeConflictsSSS;
+
+}  // namespace
+
+}  // namespace mongo
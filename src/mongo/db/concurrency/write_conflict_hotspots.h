@@ -0,0 +1,147 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <map>
+#include <string>
+
+#include "mongo/base/string_data.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/platform/random.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/util/concurrency/with_lock.h"
+#include "mongo/util/duration.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+
+class OperationContext;
+
+/**
+ * Tracks which namespaces are currently suffering write conflicts so that retries can back off
+ * adaptively and, above a configurable conflict rate, queue behind each other instead of
+ * optimistically racing, and so that the hottest namespaces are visible through serverStatus.
+ *
+ * Conflicts are keyed by namespace rather than by RecordId: by the time a WriteConflictException
+ * reaches the retry loop the identity of the conflicting document is no longer known, and
+ * threading it out of every storage engine call site is not worth the cost. A hot document makes
+ * its namespace hot, which is enough to pick the right backoff and to tell an operator where to
+ * look.
+ */
+class WriteConflictHotspots {
+public:
+    // Bounds memory use; namespaces beyond this fold into an untracked aggregate until an idle
+    // slot can be evicted.
+    static constexpr size_t kMaxTrackedNamespaces = 128;
+
+    // How long a queued retry will wait for its turn before falling back to an optimistic retry,
+    // so serialization can never stall an operation indefinitely.
+    static constexpr Milliseconds kMaxQueueWait{100};
+
+    /**
+     * Held while a serialized retry attempt for a hot namespace is in progress; releasing it lets
+     * the next queued retry run.
+     */
+    class RetryTicket {
+    public:
+        RetryTicket() = default;
+        RetryTicket(RetryTicket&& other) noexcept;
+        RetryTicket& operator=(RetryTicket&& other) noexcept;
+        RetryTicket(const RetryTicket&) = delete;
+        RetryTicket& operator=(const RetryTicket&) = delete;
+        ~RetryTicket();
+
+    private:
+        friend class WriteConflictHotspots;
+        RetryTicket(WriteConflictHotspots* hotspots, void* slot)
+            : _hotspots(hotspots), _slot(slot) {}
+
+        WriteConflictHotspots* _hotspots = nullptr;
+        void* _slot = nullptr;
+    };
+
+    /**
+     * Folds one write conflict into the namespace's slot, logs it, and sleeps for an adaptively
+     * chosen, jittered interval. The delay grows with both the attempt number and the namespace's
+     * observed conflict rate, so concurrent retriers of a hot document spread out instead of
+     * thundering back at it in lockstep. The sleep is interruptible through 'opCtx'.
+     *
+     * 'attempt' is zero-based, as counted by writeConflictRetry.
+     */
+    void recordConflictAndBackoff(OperationContext* opCtx,
+                                  int attempt,
+                                  StringData operation,
+                                  StringData ns);
+
+    /**
+     * Returns a ticket serializing this retry attempt against other retries of the same
+     * namespace, or an empty ticket when the namespace's conflict rate is below
+     * 'writeConflictRetrySerializationThreshold' (or the threshold is zero). Waits at most
+     * kMaxQueueWait for the ticket; on timeout the retry proceeds optimistically.
+     */
+    RetryTicket waitForRetry(OperationContext* opCtx, StringData ns);
+
+    /**
+     * Appends summary counters to 'bob'. When 'includeHotspots' is set, also appends a
+     * 'hotspots' array with the most conflicting namespaces.
+     */
+    void report(BSONObjBuilder* bob, bool includeHotspots) const;
+
+private:
+    struct Slot {
+        long long totalConflicts = 0;
+        // Conflict counts over one-second windows; the rate estimate is the larger of the
+        // current and previous window so it does not collapse to zero at a window boundary.
+        Date_t windowStart;
+        long long windowConflicts = 0;
+        long long lastWindowConflicts = 0;
+        // Set while a serialized retry attempt holds this slot's ticket. Slots with a retry in
+        // progress are never evicted, so outstanding tickets stay valid.
+        bool retryInProgress = false;
+    };
+
+    Slot* _findOrCreateSlot(WithLock, StringData ns, Date_t now);
+    bool _evictIdleSlot(WithLock, Date_t now);
+    long long _conflictsPerSecond(WithLock, Slot* slot, Date_t now);
+    Milliseconds _computeBackoff(WithLock, int attempt, long long conflictsPerSec);
+    void _releaseTicket(void* slot);
+
+    mutable Mutex _mutex = MONGO_MAKE_LATCH("WriteConflictHotspots::_mutex");
+    stdx::condition_variable _retryDone;
+    std::map<std::string, Slot, std::less<>> _slots;
+    long long _totalConflicts = 0;
+    long long _untrackedConflicts = 0;
+    PseudoRandom _random{SecureRandom().nextInt64()};
+};
+
+extern WriteConflictHotspots globalWriteConflictHotspots;
+
+}  // namespace mongo
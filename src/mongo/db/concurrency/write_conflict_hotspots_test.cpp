@@ -0,0 +1,124 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/concurrency/write_conflict_hotspots.h"
+
+#include <boost/optional.hpp>
+
+#include "mongo/db/concurrency/write_conflict_exception_gen.h"
+#include "mongo/db/service_context_test_fixture.h"
+#include "mongo/unittest/unittest.h"
+#include "mongo/util/scopeguard.h"
+#include "mongo/util/timer.h"
+
+namespace mongo {
+namespace {
+
+class WriteConflictHotspotsTest : public ServiceContextTest {};
+
+TEST_F(WriteConflictHotspotsTest, RecordsConflictsPerNamespace) {
+    auto opCtx = makeOperationContext();
+    WriteConflictHotspots hotspots;
+    hotspots.recordConflictAndBackoff(opCtx.get(), 0, "update", "test.a");
+    hotspots.recordConflictAndBackoff(opCtx.get(), 1, "update", "test.a");
+    hotspots.recordConflictAndBackoff(opCtx.get(), 0, "remove", "test.b");
+
+    BSONObjBuilder bob;
+    hotspots.report(&bob, true /* includeHotspots */);
+    auto section = bob.obj();
+
+    ASSERT_EQ(section["totalConflicts"].numberLong(), 3);
+    ASSERT_EQ(section["trackedNamespaces"].numberLong(), 2);
+    ASSERT_EQ(section["untrackedConflicts"].numberLong(), 0);
+
+    auto hotspotArray = section["hotspots"].Obj();
+    // The hottest namespace is listed first.
+    ASSERT_EQ(hotspotArray.firstElement().Obj()["ns"].valueStringData(), "test.a");
+    ASSERT_EQ(hotspotArray.firstElement().Obj()["conflicts"].numberLong(), 2);
+}
+
+TEST_F(WriteConflictHotspotsTest, SummaryOmitsHotspotArrayUnlessRequested) {
+    auto opCtx = makeOperationContext();
+    WriteConflictHotspots hotspots;
+    hotspots.recordConflictAndBackoff(opCtx.get(), 0, "update", "test.a");
+
+    BSONObjBuilder bob;
+    hotspots.report(&bob, false /* includeHotspots */);
+    auto section = bob.obj();
+    ASSERT_FALSE(section.hasField("hotspots"));
+    ASSERT_EQ(section["totalConflicts"].numberLong(), 1);
+}
+
+TEST_F(WriteConflictHotspotsTest, RetriesSerializeOnHotNamespaces) {
+    auto opCtx = makeOperationContext();
+    WriteConflictHotspots hotspots;
+
+    gWriteConflictRetrySerializationThreshold.store(1);
+    ON_BLOCK_EXIT([] { gWriteConflictRetrySerializationThreshold.store(0); });
+
+    // Make the namespace hot: several conflicts in the same one-second window.
+    hotspots.recordConflictAndBackoff(opCtx.get(), 0, "update", "test.hot");
+    hotspots.recordConflictAndBackoff(opCtx.get(), 1, "update", "test.hot");
+
+    boost::optional<WriteConflictHotspots::RetryTicket> ticket(
+        hotspots.waitForRetry(opCtx.get(), "test.hot"));
+
+    // While the ticket is held, a second retrier waits out the bounded queue time and then falls
+    // back to an optimistic retry rather than stalling.
+    Timer timer;
+    { auto fallback = hotspots.waitForRetry(opCtx.get(), "test.hot"); }
+    ASSERT_GTE(Milliseconds(timer.millis()), WriteConflictHotspots::kMaxQueueWait);
+
+    // Once the ticket is released, the next retrier gets its turn without waiting long.
+    ticket = boost::none;
+    timer.reset();
+    { auto next = hotspots.waitForRetry(opCtx.get(), "test.hot"); }
+    ASSERT_LT(Milliseconds(timer.millis()), WriteConflictHotspots::kMaxQueueWait);
+}
+
+TEST_F(WriteConflictHotspotsTest, ColdNamespacesDoNotSerialize) {
+    auto opCtx = makeOperationContext();
+    WriteConflictHotspots hotspots;
+
+    gWriteConflictRetrySerializationThreshold.store(1000);
+    ON_BLOCK_EXIT([] { gWriteConflictRetrySerializationThreshold.store(0); });
+
+    hotspots.recordConflictAndBackoff(opCtx.get(), 0, "update", "test.cold");
+
+    // Below the threshold both retriers proceed immediately; neither waits for the other.
+    auto first = hotspots.waitForRetry(opCtx.get(), "test.cold");
+    Timer timer;
+    { auto second = hotspots.waitForRetry(opCtx.get(), "test.cold"); }
+    ASSERT_LT(Milliseconds(timer.millis()), WriteConflictHotspots::kMaxQueueWait);
+}
+
+}  // namespace
+}  // namespace mongo
@@ -45,15 +45,20 @@
 #include "mongo/db/commands/server_status_metric.h"
 #include "mongo/db/concurrency/d_concurrency.h"
 #include "mongo/db/concurrency/locker.h"
+#include "mongo/db/curop_gen.h"
 #include "mongo/db/json.h"
 #include "mongo/db/prepare_conflict_tracker.h"
 #include "mongo/db/query/getmore_request.h"
+#include "mongo/db/stats/operation_latency_phases.h"
+#include "mongo/db/stats/query_shape_stats.h"
+#include "mongo/platform/mutex.h"
 #include "mongo/platform/random.h"
 #include "mongo/db/query/plan_summary_stats.h"
 #include "mongo/logv2/log.h"
 #include "mongo/rpc/metadata/client_metadata.h"
 #include "mongo/rpc/metadata/client_metadata_ismaster.h"
 #include "mongo/rpc/metadata/impersonated_user_metadata.h"
+#include "mongo/stdx/unordered_map.h"
 #include "mongo/util/hex.h"
 #include "mongo/util/log_with_sampling.h"
 #include "mongo/util/net/socket_utils.h"
@@ -505,6 +510,24 @@ bool CurOp::completeAndLogOperation(OperationContext* opCtx,
         LOGV2_OPTIONS(51803, {component}, "Slow query", attr);
     }
 
+    // Fold this operation into the per-query-shape statistics registry. Only operations that went
+    // through query planning carry a query hash. Storage metrics are only available for slow or
+    // profiled operations, which gathered them above; the registry counts those separately.
+    if (_debug.queryHash) {
+        QueryShapeStats::StorageMetrics storageMetrics;
+        if (_debug.storageStats) {
+            storageMetrics.bytesRead = _debug.storageStats->bytesRead();
+            storageMetrics.readTimeMicros = _debug.storageStats->readTimeMicros();
+            storageMetrics.cacheWaitMicros = _debug.storageStats->cacheWaitMicros();
+        }
+        globalQueryShapeStats.record(*_debug.queryHash,
+                                     _debug.executionTimeMicros,
+                                     _debug.additiveMetrics.keysExamined.value_or(0),
+                                     _debug.additiveMetrics.docsExamined.value_or(0),
+                                     _debug.nreturned > 0 ? _debug.nreturned : 0,
+                                     storageMetrics);
+    }
+
     // Return 'true' if this operation should also be added to the profiler.
     return shouldDBProfile(shouldSample);
 }
@@ -533,6 +556,46 @@ BSONObj appendCommentField(OperationContext* opCtx, const BSONObj& cmdObj) {
                                                      : cmdObj;
 }
 
+/**
+ * Tracks when each query shape was last logged with its full command object so that, with
+ * 'slowOpDigestLogging' enabled, subsequent slow-op log lines for the same shape can carry only
+ * the queryHash digest and the dynamic execution values.
+ */
+class SlowOpShapeLogRegistry {
+public:
+    /**
+     * Returns true if the full command object for 'queryHash' should be included in the slow-op
+     * log line, and records the shape as logged. Returns false if the shape was already logged in
+     * full within the last 'slowOpDigestFullShapeIntervalSecs' seconds.
+     */
+    bool shouldLogFullShape(uint32_t queryHash) {
+        const Seconds interval{gSlowOpDigestFullShapeIntervalSecs.load()};
+        if (interval == Seconds::zero()) {
+            return true;
+        }
+        const auto now = Date_t::now();
+        stdx::lock_guard<Latch> lk(_mutex);
+        // Keep the registry bounded; shapes simply get relogged in full after a reset.
+        if (_lastFullLog.size() >= kMaxTrackedShapes) {
+            _lastFullLog.clear();
+        }
+        auto& lastFullLog = _lastFullLog[queryHash];
+        if (lastFullLog != Date_t() && now - lastFullLog < interval) {
+            return false;
+        }
+        lastFullLog = now;
+        return true;
+    }
+
+private:
+    static constexpr size_t kMaxTrackedShapes = 10000;
+
+    Mutex _mutex = MONGO_MAKE_LATCH("SlowOpShapeLogRegistry::_mutex");
+    stdx::unordered_map<uint32_t, Date_t> _lastFullLog;
+};
+
+SlowOpShapeLogRegistry slowOpShapeLogRegistry;
+
 /**
  * Appends {<name>: obj} to the provided builder.  If obj is greater than maxSize, appends a string
  * summary of obj as { <name>: { $truncated: "obj" } }. If a comment parameter is present, add it to
@@ -852,6 +915,13 @@ string OpDebug::report(OperationContext* opCtx, const SingleThreadedLockStats* l
         s << " storage:" << storageStats->toBSON().toString();
     }
 
+    {
+        BSONObj latencyPhases = OperationLatencyPhases::get(opCtx).toBSON();
+        if (!latencyPhases.isEmpty()) {
+            s << " latencyPhases:" << latencyPhases.toString();
+        }
+    }
+
     if (iscommand) {
         s << " protocol:" << getProtoString(networkOp);
     }
@@ -901,8 +971,13 @@ void OpDebug::report(OperationContext* opCtx,
         }
     }
 
+    // With digest logging enabled, ops whose query shape was recently logged in full skip the
+    // command serialization entirely; the "queryHash" attribute added below identifies the shape.
+    const bool digestOnly = gSlowOpDigestLogging.load() && queryHash &&
+        !slowOpShapeLogRegistry.shouldLogFullShape(*queryHash);
+
     auto query = appendCommentField(opCtx, curop.opDescription());
-    if (!query.isEmpty()) {
+    if (!query.isEmpty() && !digestOnly) {
         if (iscommand) {
             const Command* curCommand = curop.getCommand();
             if (curCommand) {
@@ -922,7 +997,7 @@ void OpDebug::report(OperationContext* opCtx,
     }
 
     auto originatingCommand = curop.originatingCommand();
-    if (!originatingCommand.isEmpty()) {
+    if (!originatingCommand.isEmpty() && !digestOnly) {
         pAttrs->add("originatingCommand", redact(originatingCommand));
     }
 
@@ -1021,6 +1096,13 @@ void OpDebug::report(OperationContext* opCtx,
         pAttrs->add("storage", storageStats->toBSON());
     }
 
+    {
+        BSONObj latencyPhases = OperationLatencyPhases::get(opCtx).toBSON();
+        if (!latencyPhases.isEmpty()) {
+            pAttrs->add("latencyPhases", latencyPhases);
+        }
+    }
+
     if (iscommand) {
         pAttrs->add("protocol", getProtoString(networkOp));
     }
@@ -1133,6 +1215,13 @@ void OpDebug::append(OperationContext* opCtx,
         b.append("storage", storageStats->toBSON());
     }
 
+    {
+        BSONObj latencyPhases = OperationLatencyPhases::get(opCtx).toBSON();
+        if (!latencyPhases.isEmpty()) {
+            b.append("latencyPhases", latencyPhases);
+        }
+    }
+
     if (!errInfo.isOK()) {
         b.appendNumber("ok", 0.0);
         if (!errInfo.reason().empty()) {
@@ -33,6 +33,7 @@
 
 #include "mongo/db/cursor_manager.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "mongo/base/data_cursor.h"
@@ -153,6 +154,79 @@ std::size_t CursorManager::timeoutCursors(OperationContext* opCtx, Date_t now) {
     return toDisposeWithoutMutex.size();
 }
 
+std::size_t CursorManager::evictCursorsOverMemoryLimit(OperationContext* opCtx) {
+    const long long limitBytes = getCursorMemoryLimitBytes();
+    if (limitBytes <= 0) {
+        return 0;
+    }
+
+    // Snapshot the memory held by all open cursors and the idle eviction candidates. The
+    // snapshot is taken under the partition locks, but eviction below re-checks each candidate
+    // under its partition lock since cursors may be pinned or killed in between.
+    struct Candidate {
+        CursorId id;
+        long long memoryUsageBytes;
+        Date_t lastUseDate;
+    };
+    long long totalBytes = 0;
+    std::vector<Candidate> candidates;
+    {
+        auto allPartitions = _cursorMap->lockAllPartitions();
+        for (auto&& partition : allPartitions) {
+            for (auto&& entry : partition) {
+                auto* cursor = entry.second;
+                totalBytes += cursor->memoryUsageBytes();
+                if (!cursor->_operationUsingCursor) {
+                    candidates.push_back(
+                        {cursor->cursorid(), cursor->memoryUsageBytes(), cursor->_lastUseDate});
+                }
+            }
+        }
+    }
+
+    if (totalBytes <= limitBytes) {
+        return 0;
+    }
+
+    // Evict the heaviest cursors first, breaking ties in favor of the least recently used.
+    std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+        if (a.memoryUsageBytes != b.memoryUsageBytes) {
+            return a.memoryUsageBytes > b.memoryUsageBytes;
+        }
+        return a.lastUseDate < b.lastUseDate;
+    });
+
+    std::size_t numEvicted = 0;
+    for (auto&& candidate : candidates) {
+        if (totalBytes <= limitBytes) {
+            break;
+        }
+
+        auto lockedPartition = _cursorMap->lockOnePartition(candidate.id);
+        auto it = lockedPartition->find(candidate.id);
+        if (it == lockedPartition->end() || it->second->_operationUsingCursor) {
+            // The cursor was killed or pinned after the snapshot was taken.
+            continue;
+        }
+        auto* cursor = it->second;
+
+        LOGV2_WARNING(4957906,
+                      "Evicting idle cursor {cursor_cursorid} holding {memoryUsageBytes} bytes "
+                      "because open cursors exceed cursorMemoryLimitMB, idle since "
+                      "{cursor_getLastUseDate}",
+                      "cursor_cursorid"_attr = cursor->cursorid(),
+                      "memoryUsageBytes"_attr = cursor->memoryUsageBytes(),
+                      "cursor_getLastUseDate"_attr = cursor->getLastUseDate());
+
+        totalBytes -= cursor->memoryUsageBytes();
+        deregisterAndDestroyCursor(std::move(lockedPartition),
+                                   opCtx,
+                                   std::unique_ptr<ClientCursor, ClientCursor::Deleter>(cursor));
+        numEvicted++;
+    }
+    return numEvicted;
+}
+
 StatusWith<ClientCursorPin> CursorManager::pinCursor(OperationContext* opCtx,
                                                      CursorId id,
                                                      AuthCheck checkSessionAuth) {
@@ -212,6 +286,10 @@ void CursorManager::unpin(OperationContext* opCtx,
     cursor->_operationUsingCursor = nullptr;
     cursor->_lastUseDate = now;
 
+    // Refresh the cursor's memory accounting now that the batch is complete, while we still hold
+    // the partition lock.
+    cursor->recalculateMemoryUsageBytes();
+
     // If someone was trying to kill this cursor with a killOp or a killCursors, they are likely
     // interesting in proactively cleaning up that cursor's resources. In these cases, we
     // proactively delete the cursor. In other cases we preserve the error code so that the client
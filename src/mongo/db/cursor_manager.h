@@ -99,6 +99,16 @@ public:
      */
     std::size_t timeoutCursors(OperationContext* opCtx, Date_t now);
 
+    /**
+     * Destroys idle (non-pinned) cursors, heaviest first, until the total memory held by open
+     * cursors falls below the limit set by the "cursorMemoryLimitMB" server parameter. Unlike
+     * timeoutCursors(), this also considers cursors opened with "noCursorTimeout", since those
+     * are the ones most often abandoned. Does nothing when the limit is zero (the default).
+     *
+     * Returns the number of cursors that were evicted.
+     */
+    std::size_t evictCursorsOverMemoryLimit(OperationContext* opCtx);
+
     /**
      * Constructs a new ClientCursor according to the given 'cursorParams'. The cursor is atomically
      * registered with the manager and returned in pinned state.
@@ -43,6 +43,10 @@ long long getCursorTimeoutMillis() {
     return gCursorTimeoutMillis.load();
 }
 
+long long getCursorMemoryLimitBytes() {
+    return gCursorMemoryLimitMB.load() * 1024 * 1024;
+}
+
 Milliseconds getDefaultCursorTimeoutMillis() {
     return Milliseconds(kCursorTimeoutMillisDefault);
 }
@@ -39,6 +39,11 @@ int getClientCursorMonitorFrequencySecs();
 // parameter "cursorTimeoutMillis".
 long long getCursorTimeoutMillis();
 
+// Total memory, in bytes, that open cursors may hold before the cursor monitor starts evicting
+// the heaviest idle cursors. Zero means eviction is disabled. Configurable with server parameter
+// "cursorMemoryLimitMB".
+long long getCursorMemoryLimitBytes();
+
 Milliseconds getDefaultCursorTimeoutMillis();
 
 }  // namespace mongo
@@ -299,7 +299,9 @@ ExitCode _initAndListen(ServiceContext* serviceContext, int listenPort) {
 
     initWireSpec();
 
-    serviceContext->setFastClockSource(FastClockSourceFactory::create(Milliseconds(10)));
+    // 1ms granularity: operation deadline checks and other coarse-clock consumers read this on
+    // hot paths, and the background tick thread idles whenever nothing is reading the clock.
+    serviceContext->setFastClockSource(FastClockSourceFactory::create(Milliseconds(1)));
 
     DBDirectClientFactory::get(serviceContext).registerImplementation([](OperationContext* opCtx) {
         return std::unique_ptr<DBClientBase>(new DBDirectClient(opCtx));
@@ -433,7 +435,9 @@ ExitCode _initAndListen(ServiceContext* serviceContext, int listenPort) {
     }
 
     if (mongodGlobalParams.scriptingEnabled) {
-        ScriptEngine::setup();
+        // Defer interpreter construction until the first operation that actually runs JavaScript,
+        // so deployments that never use it do not pay its startup time or memory.
+        ScriptEngine::setupDeferred();
     }
 
     auto startupOpCtx = serviceContext->makeOperationContext(&cc());
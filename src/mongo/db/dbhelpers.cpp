@@ -123,6 +123,41 @@ RecordId Helpers::findOne(OperationContext* opCtx,
     return RecordId();
 }
 
+void Helpers::findAll(OperationContext* opCtx,
+                      std::unique_ptr<QueryRequest> qr,
+                      std::vector<BSONObj>* results) {
+    const NamespaceString nss = qr->nss();
+
+    AutoGetCollectionForReadCommand autoColl(opCtx, nss);
+    Collection* collection = autoColl.getCollection();
+    if (!collection) {
+        return;
+    }
+
+    const ExtensionsCallbackReal extensionsCallback(opCtx, &nss);
+    const boost::intrusive_ptr<ExpressionContext> expCtx;
+    auto statusWithCQ =
+        CanonicalQuery::canonicalize(opCtx,
+                                     std::move(qr),
+                                     expCtx,
+                                     extensionsCallback,
+                                     MatchExpressionParser::kAllowAllSpecialFeatures);
+    uassertStatusOK(statusWithCQ.getStatus());
+
+    auto exec = uassertStatusOK(getExecutorFind(
+        opCtx, collection, std::move(statusWithCQ.getValue()), true /* permitYield */));
+
+    BSONObj obj;
+    PlanExecutor::ExecState state;
+    while (PlanExecutor::ADVANCED == (state = exec->getNext(&obj, nullptr))) {
+        results->push_back(obj.getOwned());
+    }
+    uassert(ErrorCodes::OperationFailed,
+            str::stream() << "PlanExecutor error while reading " << nss.ns() << ": "
+                          << WorkingSetCommon::toStatusString(obj),
+            PlanExecutor::IS_EOF == state);
+}
+
 bool Helpers::findById(OperationContext* opCtx,
                        Database* database,
                        StringData ns,
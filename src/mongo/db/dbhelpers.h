@@ -29,6 +29,9 @@
 
 #pragma once
 
+#include <memory>
+#include <vector>
+
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/record_id.h"
 
@@ -74,6 +77,20 @@ struct Helpers {
                             std::unique_ptr<QueryRequest> qr,
                             bool requireIndex);
 
+    /**
+     * Runs the given query request against its namespace and appends an owned copy of every
+     * matching document to 'results'. The query is canonicalized and executed through a
+     * PlanExecutor built directly on the collection, bypassing command dispatch and reply
+     * serialization entirely, so this is the preferred way for internal consumers to read their
+     * own local collections. Performs no auth checks. A missing collection yields no results.
+     *
+     * Acquires the collection lock itself; callers must not already hold it. Throws on
+     * canonicalization or execution errors.
+     */
+    static void findAll(OperationContext* opCtx,
+                        std::unique_ptr<QueryRequest> qr,
+                        std::vector<BSONObj>* results);
+
     /**
      * @param foundIndex if passed in will be set to 1 if ns and index found
      * @return true if object found
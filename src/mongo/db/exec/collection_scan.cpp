@@ -39,6 +39,7 @@
 #include "mongo/db/exec/collection_scan_common.h"
 #include "mongo/db/exec/filter.h"
 #include "mongo/db/exec/scoped_timer.h"
+#include "mongo/db/exec/shared_scan_tracker.h"
 #include "mongo/db/exec/working_set.h"
 #include "mongo/db/exec/working_set_common.h"
 #include "mongo/db/repl/optime.h"
@@ -85,6 +86,16 @@ CollectionScan::CollectionScan(ExpressionContext* expCtx,
         invariant(params.direction == CollectionScanParams::FORWARD);
     }
 
+    if (params.allowSharedScan) {
+        // Shared scans reorder the records they return, so they are only legal for unordered,
+        // forward scans that start at the beginning of a normal collection.
+        invariant(params.direction == CollectionScanParams::FORWARD);
+        invariant(!params.tailable);
+        invariant(!params.resumeAfterRecordId);
+        invariant(!params.minTs && !params.maxTs);
+        invariant(!collection->ns().isOplog());
+    }
+
     // Set early stop condition.
     if (params.maxTs) {
         _endConditionBSON = BSON("$gte"_sd << *(params.maxTs));
@@ -123,8 +134,12 @@ PlanStage::StageState CollectionScan::doWork(WorkingSetID* out) {
 
             _cursor = collection()->getCursor(opCtx(), forward);
 
-            if (!_lastSeenId.isNull()) {
-                invariant(_params.tailable);
+            if (!_lastSeenId.isNull() && !_params.tailable) {
+                // The only other reason to create a cursor after already returning results is the
+                // wrap-around of a shared scan, which restarts from the beginning of the
+                // collection and so has nothing to seek to.
+                invariant(_sharedScanWrapped);
+            } else if (!_lastSeenId.isNull()) {
                 // Seek to where we were last time. If it no longer exists, mark us as dead since we
                 // want to signal an error rather than silently dropping data from the stream.
                 //
@@ -163,6 +178,10 @@ PlanStage::StageState CollectionScan::doWork(WorkingSetID* out) {
                 }
             }
 
+            if (_params.allowSharedScan && _lastSeenId.isNull() && !_sharedScanWrapped) {
+                tryJoinSharedScan();
+            }
+
             return PlanStage::NEED_TIME;
         }
 
@@ -191,6 +210,15 @@ PlanStage::StageState CollectionScan::doWork(WorkingSetID* out) {
     }
 
     if (!record) {
+        if (_sharedScanStopId && !_sharedScanWrapped) {
+            // The first pass of a shared scan has reached the end of the collection. Wrap around
+            // to cover the records that precede the position at which we joined. The cursor is
+            // recreated from the beginning of the collection on the next call to work().
+            _sharedScanWrapped = true;
+            _cursor.reset();
+            return PlanStage::NEED_TIME;
+        }
+
         // We just hit EOF. If we are tailable and have already returned data, leave us in a
         // state to pick up where we left off on the next call to work(). Otherwise EOF is
         // permanent.
@@ -203,7 +231,17 @@ PlanStage::StageState CollectionScan::doWork(WorkingSetID* out) {
         return PlanStage::IS_EOF;
     }
 
+    if (_sharedScanWrapped && record->id > *_sharedScanStopId) {
+        // The wrapped-around pass has caught back up to the position at which this scan joined,
+        // so every record in the collection has now been visited exactly once.
+        _commonStats.isEOF = true;
+        return PlanStage::IS_EOF;
+    }
+
     _lastSeenId = record->id;
+    if (_params.allowSharedScan) {
+        SharedScanTracker::get(collection()).reportPosition(record->id);
+    }
     if (_params.shouldTrackLatestOplogTimestamp) {
         auto status = setLatestOplogEntryTimestamp(*record);
         if (!status.isOK()) {
@@ -221,6 +259,34 @@ PlanStage::StageState CollectionScan::doWork(WorkingSetID* out) {
     return returnIfMatches(member, id, out);
 }
 
+PlanStage::StageState CollectionScan::doWorkBatch(size_t maxUnits,
+                                                  std::vector<WorkingSetID>* out,
+                                                  WorkingSetID* terminalId) {
+    // The qualified call lets the tight loop avoid per-document virtual dispatch.
+    return workBatchLoop(maxUnits, out, terminalId, [this](WorkingSetID* id) {
+        return CollectionScan::doWork(id);
+    });
+}
+
+void CollectionScan::tryJoinSharedScan() {
+    auto joinPosition = SharedScanTracker::get(collection()).positionForNewScanner();
+    if (!joinPosition) {
+        return;
+    }
+
+    if (_cursor->seekExact(*joinPosition)) {
+        // The records after this position are the ones the concurrent scan(s) are about to read,
+        // so they will be read while still warm in the storage engine cache. The record at the
+        // join position itself is skipped by the first pass and returned by the wrapped-around
+        // pass instead.
+        _sharedScanStopId = joinPosition;
+    } else {
+        // The record another scan most recently reported has since been deleted. Recreate the
+        // cursor so the scan proceeds from the beginning of the collection as usual.
+        _cursor = collection()->getCursor(opCtx(), true);
+    }
+}
+
 Status CollectionScan::setLatestOplogEntryTimestamp(const Record& record) {
     auto tsElem = record.data.toBson()[repl::OpTime::kTimestampFieldName];
     if (tsElem.type() != BSONType::bsonTimestamp) {
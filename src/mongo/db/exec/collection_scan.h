@@ -60,6 +60,9 @@ public:
                    const MatchExpression* filter);
 
     StageState doWork(WorkingSetID* out) final;
+    StageState doWorkBatch(size_t maxUnits,
+                           std::vector<WorkingSetID>* out,
+                           WorkingSetID* terminalId) final;
     bool isEOF() final;
 
     void doDetachFromOperationContext() final;
@@ -100,6 +103,14 @@ private:
      */
     Status setLatestOplogEntryTimestamp(const Record& record);
 
+    /**
+     * Tries to position '_cursor' at the point another concurrent scan of this collection has
+     * recently read up to, so that this scan rides along with it and reuses the pages it brings
+     * into cache. On success sets '_sharedScanStopId' so the scan knows to wrap around at EOF; if
+     * no concurrent scan position is available the scan proceeds from the beginning as usual.
+     */
+    void tryJoinSharedScan();
+
     // WorkingSet is not owned by us.
     WorkingSet* _workingSet;
 
@@ -117,6 +128,15 @@ private:
 
     RecordId _lastSeenId;  // Null if nothing has been returned from _cursor yet.
 
+    // Set if this scan joined a concurrent scan of the same collection mid-collection. Holds the
+    // RecordId at which we joined; the first pass covers the records after it, and the
+    // wrapped-around pass covers the records up to and including it.
+    boost::optional<RecordId> _sharedScanStopId;
+
+    // True once a shared scan has reached the end of the collection and restarted from the
+    // beginning to cover the records that precede '_sharedScanStopId'.
+    bool _sharedScanWrapped = false;
+
     // If _params.shouldTrackLatestOplogTimestamp is set and the collection is the oplog, the latest
     // timestamp seen in the collection.  Otherwise, this is a null timestamp.
     Timestamp _latestOplogEntryTimestamp;
@@ -77,6 +77,14 @@ struct CollectionScanParams {
 
     // Whether or not to wait for oplog visibility on oplog collection scans.
     bool shouldWaitForOplogVisibility = false;
+
+    // If true, this scan may share its read position with other concurrent scans of the same
+    // collection: it starts at the position most recently reported by another scan, wraps around
+    // at the end of the collection, and reports its own position as it goes. This changes the
+    // order in which records are returned, so it must only be set when the caller does not depend
+    // on scan order. Must only be set on forward, non-tailable scans of non-oplog collections,
+    // and cannot be used in conjunction with 'resumeAfterRecordId', 'minTs' or 'maxTs'.
+    bool allowSharedScan = false;
 };
 
 }  // namespace mongo
@@ -31,14 +31,23 @@
 
 #include "mongo/db/exec/count.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "mongo/db/catalog/collection.h"
+#include "mongo/db/exec/count_scan.h"
 #include "mongo/db/exec/scoped_timer.h"
 #include "mongo/db/exec/working_set_common.h"
 
 namespace mongo {
 
+namespace {
+// The number of index keys a batch-counting CountScan child consumes per work cycle. Large
+// enough to amortize per-key stage overhead, small enough to keep the yielding between work
+// cycles responsive.
+const long long kMaxKeysCountedPerWorkCycle = 1000;
+}  // namespace
+
 using std::unique_ptr;
 using std::vector;
 
@@ -51,7 +60,13 @@ CountStage::CountStage(ExpressionContext* expCtx,
                        long long skip,
                        WorkingSet* ws,
                        PlanStage* child)
-    : PlanStage(kStageType, expCtx), _limit(limit), _skip(skip), _leftToSkip(_skip), _ws(ws) {
+    : PlanStage(kStageType, expCtx),
+      _limit(limit),
+      _skip(skip),
+      _leftToSkip(_skip),
+      _ws(ws),
+      _batchedCountScan(child->stageType() == STAGE_COUNT_SCAN &&
+                        static_cast<CountScan*>(child)->supportsBatchCounting()) {
     invariant(_skip >= 0);
     invariant(_limit >= 0);
     invariant(child);
@@ -78,6 +93,32 @@ PlanStage::StageState CountStage::doWork(WorkingSetID* out) {
     // For cases where we can't ask the record store directly, we should always have a child stage
     // from which we can retrieve results.
     invariant(child());
+
+    if (_batchedCountScan) {
+        // Every key the child scans counts exactly once, so we can consume them in batches and
+        // apply the skip and limit arithmetically instead of surfacing one key per work cycle.
+        long long maxKeysToCount = kMaxKeysCountedPerWorkCycle;
+        if (_limit > 0) {
+            maxKeysToCount =
+                std::min(maxKeysToCount, _leftToSkip + _limit - _specificStats.nCounted);
+        }
+
+        auto batch = static_cast<CountScan*>(child())->countBatch(maxKeysToCount);
+        long long counted = batch.counted;
+        if (_leftToSkip > 0) {
+            const long long skipped = std::min(counted, _leftToSkip);
+            _leftToSkip -= skipped;
+            _specificStats.nSkipped += skipped;
+            counted -= skipped;
+        }
+        _specificStats.nCounted += counted;
+
+        if (batch.needYield) {
+            return PlanStage::NEED_YIELD;
+        }
+        return PlanStage::NEED_TIME;
+    }
+
     WorkingSetID id = WorkingSet::INVALID_ID;
     PlanStage::StageState state = child()->work(&id);
 
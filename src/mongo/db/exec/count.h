@@ -80,6 +80,10 @@ private:
     // by us.
     WorkingSet* _ws;
 
+    // Whether the child is a CountScan that can count entries in batches, letting us avoid
+    // surfacing every index key through work().
+    const bool _batchedCountScan;
+
     CountStats _specificStats;
 };
 
@@ -153,6 +153,63 @@ PlanStage::StageState CountScan::doWork(WorkingSetID* out) {
     return PlanStage::ADVANCED;
 }
 
+CountScan::BatchCount CountScan::countBatch(long long maxKeysToCount) {
+    invariant(!_shouldDedup);
+    invariant(maxKeysToCount > 0);
+
+    BatchCount batch;
+    if (_commonStats.isEOF)
+        return batch;
+
+    const bool needInit = !_cursor;
+    bool exhausted = false;
+    try {
+        // Only the existence of the entries matters, not their contents.
+        const auto kJustExistance = SortedDataInterface::Cursor::kJustExistance;
+
+        boost::optional<IndexKeyEntry> entry;
+        if (needInit) {
+            _cursor = indexAccessMethod()->newCursor(opCtx());
+            _cursor->setEndPosition(_endKey, _endKeyInclusive);
+
+            auto keyStringForSeek = IndexEntryComparison::makeKeyStringFromBSONKeyForSeek(
+                _startKey,
+                indexAccessMethod()->getSortedDataInterface()->getKeyStringVersion(),
+                indexAccessMethod()->getSortedDataInterface()->getOrdering(),
+                true, /* forward */
+                _startKeyInclusive);
+            entry = _cursor->seek(keyStringForSeek, kJustExistance);
+        } else {
+            entry = _cursor->next(kJustExistance);
+        }
+
+        while (entry) {
+            ++batch.counted;
+            if (batch.counted == maxKeysToCount)
+                break;
+            entry = _cursor->next(kJustExistance);
+        }
+        exhausted = !entry;
+    } catch (const WriteConflictException&) {
+        if (needInit) {
+            // Release our cursor and try again next time.
+            _cursor.reset();
+        }
+        batch.needYield = true;
+        return batch;
+    }
+
+    // Mirror doWork(), which examines one key per call including the one that hits EOF.
+    _specificStats.keysExamined += batch.counted + (exhausted ? 1 : 0);
+    _commonStats.advanced += batch.counted;
+
+    if (exhausted) {
+        _commonStats.isEOF = true;
+        _cursor.reset();
+    }
+    return batch;
+}
+
 bool CountScan::isEOF() {
     return _commonStats.isEOF;
 }
@@ -91,6 +91,32 @@ public:
 
     StageState doWork(WorkingSetID* out) final;
     bool isEOF() final;
+
+    /**
+     * The result of a countBatch() call: how many index entries were counted, and whether the
+     * batch was cut short by a WriteConflictException, in which case the caller should yield
+     * before counting further.
+     */
+    struct BatchCount {
+        long long counted = 0;
+        bool needYield = false;
+    };
+
+    /**
+     * Returns true if this scan can count entries in batches via countBatch(). Scans over
+     * multikey indexes must dedup record ids and so must surface each entry through work().
+     */
+    bool supportsBatchCounting() const {
+        return !_shouldDedup;
+    }
+
+    /**
+     * Counts up to 'maxKeysToCount' further entries in the scanned range without surfacing each
+     * one through work(), advancing this stage to EOF if the range is exhausted first. Used by
+     * CountStage to amortize per-key stage overhead when every key in the range counts exactly
+     * once. Callers must check supportsBatchCounting() first.
+     */
+    BatchCount countBatch(long long maxKeysToCount);
     void doDetachFromOperationContext() final;
     void doReattachToOperationContext() final;
 
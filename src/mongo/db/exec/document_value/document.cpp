@@ -127,10 +127,17 @@ bool DocumentStorageIterator::shouldSkipDeleted() {
 }
 
 Position DocumentStorage::findFieldInCache(StringData requested) const {
+    // Only pay for the hash when we are actually going to do a hash lookup.
+    if (_numFields >= HASH_TAB_MIN) {
+        return findFieldInCache(requested, hashKey(requested));
+    }
+    return findFieldInCache(requested, 0);
+}
+
+Position DocumentStorage::findFieldInCache(StringData requested, unsigned hash) const {
     int reqSize = requested.size();  // get size calculation out of the way if needed
 
     if (_numFields >= HASH_TAB_MIN) {  // hash lookup
-        const unsigned hash = hashKey(requested);
         const unsigned bucket = hash & _hashTabMask;
 
         Position pos = _hashTab[bucket];
@@ -160,6 +167,21 @@ Position DocumentStorage::findField(StringData requested, LookupPolicy policy) c
         return pos;
     }
 
+    return findFieldInBson(requested);
+}
+
+Position DocumentStorage::findField(StringData requested,
+                                    unsigned hash,
+                                    LookupPolicy policy) const {
+    if (auto pos = findFieldInCache(requested, hash);
+        pos.found() || policy == LookupPolicy::kCacheOnly) {
+        return pos;
+    }
+
+    return findFieldInBson(requested);
+}
+
+Position DocumentStorage::findFieldInBson(StringData requested) const {
     for (auto&& bsonElement : _bson) {
         if (requested == bsonElement.fieldNameStringData()) {
             return const_cast<DocumentStorage*>(this)->constructInCache(bsonElement);
@@ -515,6 +537,21 @@ Document Document::getOwned() const {
     }
 }
 
+Document Document::getOwned() && {
+    if (isOwned()) {
+        return std::move(*this);
+    } else if (!_storage->isShared()) {
+        // Nobody else can observe this storage, so it can take ownership of its backing BSON in
+        // place instead of being cloned first.
+        const_cast<DocumentStorage&>(*_storage).makeOwned();
+        return std::move(*this);
+    } else {
+        MutableDocument md(*this);
+        md.makeOwned();
+        return md.freeze();
+    }
+}
+
 MutableDocument::MutableDocument(size_t expectedFields)
     : _storageHolder(nullptr), _storage(_storageHolder) {
     if (expectedFields) {
@@ -618,7 +655,7 @@ static Value getNestedFieldHelper(const Document& doc,
                                   vector<Position>* positions,
                                   size_t level) {
     const auto fieldName = fieldNames.getFieldName(level);
-    const Position pos = doc.positionOf(fieldName);
+    const Position pos = doc.positionOf(fieldName, fieldNames.getFieldNameHash(level));
 
     if (!pos.found())
         return Value();
@@ -136,6 +136,15 @@ public:
         return storage().getField(key);
     }
 
+    /**
+     * Look up a field by key name with 'hash' equal to FieldPath::hashName(key) precomputed by
+     * the caller. Avoids re-hashing the field name when the same path is looked up across many
+     * documents.
+     */
+    const Value getField(StringData key, unsigned hash) const {
+        return storage().getField(key, hash);
+    }
+
     /// Look up a field by Position. See positionOf and getNestedField.
     const Value operator[](Position pos) const {
         return getField(pos);
@@ -278,6 +287,11 @@ public:
         return storage().findField(fieldName, DocumentStorage::LookupPolicy::kCacheAndBSON);
     }
 
+    /// Same, but with 'hash' equal to FieldPath::hashName(fieldName) precomputed by the caller.
+    Position positionOf(StringData fieldName, unsigned hash) const {
+        return storage().findField(fieldName, hash, DocumentStorage::LookupPolicy::kCacheAndBSON);
+    }
+
     /** Clone a document.
      *
      *  This should only be called by MutableDocument and tests
@@ -311,6 +325,13 @@ public:
      */
     Document getOwned() const;
 
+    /**
+     * Moving overload of getOwned(). When this document holds the only reference to its storage,
+     * ownership of the backing BSONObj is taken in place rather than cloning the storage, which
+     * avoids a per-document allocation on hot batching paths.
+     */
+    Document getOwned() &&;
+
     /**
      * Returns true if the underlying BSONObj is owned.
      */
@@ -29,14 +29,13 @@
 
 #pragma once
 
-#include <third_party/murmurhash3/MurmurHash3.h>
-
 #include <bitset>
 #include <boost/intrusive_ptr.hpp>
 
 #include "mongo/base/static_assert.h"
 #include "mongo/db/exec/document_value/document_metadata_fields.h"
 #include "mongo/db/exec/document_value/value.h"
+#include "mongo/db/pipeline/field_path.h"
 #include "mongo/stdx/variant.h"
 #include "mongo/util/intrusive_counter.h"
 
@@ -327,6 +326,9 @@ public:
     /// Returns the position of the named field or Position()
     Position findField(StringData name, LookupPolicy policy) const;
 
+    /// Same, but with 'hash' equal to hashKey(name) precomputed by the caller (e.g. a FieldPath).
+    Position findField(StringData name, unsigned hash, LookupPolicy policy) const;
+
     // Document uses these
     const ValueElement& getField(Position pos) const {
         verify(pos.found());
@@ -338,6 +340,12 @@ public:
             return Value();
         return getField(pos).val;
     }
+    Value getField(StringData name, unsigned hash) const {
+        Position pos = findField(name, hash, LookupPolicy::kCacheAndBSON);
+        if (!pos.found())
+            return Value();
+        return getField(pos).val;
+    }
 
     // MutableDocument uses these
     ValueElement& getField(Position pos) {
@@ -464,9 +472,7 @@ public:
 
     static unsigned hashKey(StringData name) {
         // TODO consider FNV-1a once we have a better benchmark corpus
-        unsigned out;
-        MurmurHash3_x86_32(name.rawData(), name.size(), 0, &out);
-        return out;
+        return FieldPath::hashName(name);
     }
 
     const ValueElement* begin() const {
@@ -495,6 +501,10 @@ public:
 private:
     /// Returns the position of the named field in the cache or Position()
     Position findFieldInCache(StringData name) const;
+    Position findFieldInCache(StringData name, unsigned hash) const;
+
+    /// Searches the underlying BSON for the named field and caches it when found
+    Position findFieldInBson(StringData name) const;
 
     /// Allocates space in _cache. Copies existing data if there is any.
     void alloc(unsigned newSize);
@@ -136,6 +136,30 @@ TEST(DocumentConstruction, FromBsonReset) {
     ASSERT_BSONOBJ_EQ(bson, toBson(newDocument));
 }
 
+TEST(DocumentGetOwned, MovingGetOwnedTakesOwnershipInPlace) {
+    BSONObj bson = BSON("a" << 1 << "b"
+                            << "q");
+    Document document = fromBson(BSONObj(bson.objdata()));  // unowned view of 'bson'.
+    ASSERT_FALSE(document.isOwned());
+
+    Document owned = std::move(document).getOwned();
+    ASSERT_TRUE(owned.isOwned());
+    ASSERT_BSONOBJ_EQ(bson, toBson(owned));
+}
+
+TEST(DocumentGetOwned, MovingGetOwnedFallsBackToCloneWhenStorageIsShared) {
+    BSONObj bson = BSON("a" << 1);
+    Document document = fromBson(BSONObj(bson.objdata()));
+    Document alias = document;
+
+    Document owned = std::move(document).getOwned();
+    ASSERT_TRUE(owned.isOwned());
+    // The aliasing document must still observe the original, unowned storage.
+    ASSERT_FALSE(alias.isOwned());
+    ASSERT_BSONOBJ_EQ(bson, toBson(owned));
+    ASSERT_BSONOBJ_EQ(bson, toBson(alias));
+}
+
 /**
  * Appends to 'builder' an object nested 'depth' levels deep.
  */
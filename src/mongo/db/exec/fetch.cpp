@@ -69,6 +69,11 @@ bool FetchStage::isEOF() {
         return false;
     }
 
+    if (_batchedChildPos < _batchedChildResults.size()) {
+        // We have child results obtained ahead by doWorkBatch() that have not been returned yet.
+        return false;
+    }
+
     return child()->isEOF();
 }
 
@@ -131,6 +136,97 @@ PlanStage::StageState FetchStage::doWork(WorkingSetID* out) {
     return status;
 }
 
+PlanStage::StageState FetchStage::doWorkBatch(size_t maxUnits,
+                                              std::vector<WorkingSetID>* out,
+                                              WorkingSetID* terminalId) {
+    auto optTimer(getOptTimer());
+
+    // Refill from the child in bulk once the results obtained ahead by the previous call have all
+    // been drained. A pending retry or leftover results mean the previous call was interrupted by
+    // a WriteConflictException; resume draining before asking the child for more.
+    if (WorkingSet::INVALID_ID == _idRetrying && _batchedChildPos >= _batchedChildResults.size()) {
+        if (isEOF()) {
+            return PlanStage::IS_EOF;
+        }
+
+        _batchedChildResults.clear();
+        _batchedChildPos = 0;
+        _batchedChildTerminalId = WorkingSet::INVALID_ID;
+        _batchedChildStatus =
+            child()->workBatch(maxUnits, &_batchedChildResults, &_batchedChildTerminalId);
+        if (PlanStage::FAILURE == _batchedChildStatus) {
+            // The stage which produces a failure is responsible for allocating a working set
+            // member with error details.
+            invariant(WorkingSet::INVALID_ID != _batchedChildTerminalId);
+        }
+    }
+
+    while (WorkingSet::INVALID_ID != _idRetrying ||
+           _batchedChildPos < _batchedChildResults.size()) {
+        WorkingSetID id;
+        if (WorkingSet::INVALID_ID != _idRetrying) {
+            id = _idRetrying;
+            _idRetrying = WorkingSet::INVALID_ID;
+        } else {
+            id = _batchedChildResults[_batchedChildPos++];
+        }
+
+        ++_commonStats.works;
+        WorkingSetMember* member = _ws->get(id);
+
+        // If there's an obj there, there is no fetching to perform.
+        if (member->hasObj()) {
+            ++_specificStats.alreadyHasObj;
+        } else {
+            // We need a valid RecordId to fetch from and this is the only state that has one.
+            verify(WorkingSetMember::RID_AND_IDX == member->getState());
+            verify(member->hasRecordId());
+
+            try {
+                if (!_cursor)
+                    _cursor = collection()->getCursor(opCtx());
+
+                if (!WorkingSetCommon::fetch(opCtx(), _ws, id, _cursor, collection()->ns())) {
+                    _ws->free(id);
+                    ++_commonStats.needTime;
+                    continue;
+                }
+            } catch (const WriteConflictException&) {
+                // Ensure that the BSONObj underlying the WorkingSetMember is owned because it may
+                // be freed when we yield.
+                member->makeObjOwnedIfNeeded();
+                _idRetrying = id;
+                ++_commonStats.needYield;
+                *terminalId = WorkingSet::INVALID_ID;
+                return PlanStage::NEED_YIELD;
+            }
+        }
+
+        WorkingSetID outId = WorkingSet::INVALID_ID;
+        if (PlanStage::ADVANCED == returnIfMatches(member, id, &outId)) {
+            ++_commonStats.advanced;
+            out->push_back(outId);
+        } else {
+            ++_commonStats.needTime;
+        }
+    }
+
+    // The results obtained ahead have all been drained; surface the child's terminal state for
+    // the batch. Results already appended to 'out' are consumed by the caller first.
+    if (PlanStage::NEED_YIELD == _batchedChildStatus ||
+        PlanStage::FAILURE == _batchedChildStatus || PlanStage::IS_EOF == _batchedChildStatus) {
+        if (PlanStage::FAILURE == _batchedChildStatus) {
+            _commonStats.failed = true;
+        } else if (PlanStage::NEED_YIELD == _batchedChildStatus) {
+            ++_commonStats.needYield;
+        }
+        *terminalId = _batchedChildTerminalId;
+        return _batchedChildStatus;
+    }
+
+    return out->empty() ? PlanStage::NEED_TIME : PlanStage::ADVANCED;
+}
+
 void FetchStage::doSaveStateRequiresCollection() {
     if (_cursor) {
         _cursor->saveUnpositioned();
@@ -60,6 +60,9 @@ public:
 
     bool isEOF() final;
     StageState doWork(WorkingSetID* out) final;
+    StageState doWorkBatch(size_t maxUnits,
+                           std::vector<WorkingSetID>* out,
+                           WorkingSetID* terminalId) final;
 
     void doDetachFromOperationContext() final;
     void doReattachToOperationContext() final;
@@ -98,6 +101,15 @@ private:
     // If not Null, we use this rather than asking our child what to do next.
     WorkingSetID _idRetrying;
 
+    // Child results obtained ahead by doWorkBatch() and not yet fetched, consumed in order from
+    // '_batchedChildPos' before the child is asked for more. The child's terminal state for the
+    // batch is held in '_batchedChildStatus' / '_batchedChildTerminalId' and surfaced once the
+    // results ahead of it have been drained.
+    std::vector<WorkingSetID> _batchedChildResults;
+    size_t _batchedChildPos = 0;
+    StageState _batchedChildStatus = NEED_TIME;
+    WorkingSetID _batchedChildTerminalId = WorkingSet::INVALID_ID;
+
     // Stats
     FetchStats _specificStats;
 };
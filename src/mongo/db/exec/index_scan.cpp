@@ -91,6 +91,12 @@ boost::optional<IndexKeyEntry> IndexScan::initIndexScan() {
     // Perform the possibly heavy-duty initialization of the underlying index cursor.
     _indexCursor = indexAccessMethod()->newCursor(opCtx(), _forward);
 
+    // Cache the parameters needed to build KeyString seek targets; they never change for the
+    // lifetime of the scan and the NEED_SEEK state may rebuild targets thousands of times.
+    const auto sortedDataInterface = indexAccessMethod()->getSortedDataInterface();
+    _keyStringVersion = sortedDataInterface->getKeyStringVersion();
+    _ordering = sortedDataInterface->getOrdering();
+
     // We always seek once to establish the cursor position.
     ++_specificStats.seeks;
 
@@ -101,11 +107,7 @@ boost::optional<IndexKeyEntry> IndexScan::initIndexScan() {
         _indexCursor->setEndPosition(_endKey, _endKeyInclusive);
 
         KeyString::Value keyStringForSeek = IndexEntryComparison::makeKeyStringFromBSONKeyForSeek(
-            _startKey,
-            indexAccessMethod()->getSortedDataInterface()->getKeyStringVersion(),
-            indexAccessMethod()->getSortedDataInterface()->getOrdering(),
-            _forward,
-            _startKeyInclusive);
+            _startKey, *_keyStringVersion, *_ordering, _forward, _startKeyInclusive);
         return _indexCursor->seek(keyStringForSeek);
     } else {
         // For single intervals, we can use an optimized scan which checks against the position
@@ -116,11 +118,7 @@ boost::optional<IndexKeyEntry> IndexScan::initIndexScan() {
             _indexCursor->setEndPosition(_endKey, _endKeyInclusive);
 
             auto keyStringForSeek = IndexEntryComparison::makeKeyStringFromBSONKeyForSeek(
-                _startKey,
-                indexAccessMethod()->getSortedDataInterface()->getKeyStringVersion(),
-                indexAccessMethod()->getSortedDataInterface()->getOrdering(),
-                _forward,
-                _startKeyInclusive);
+                _startKey, *_keyStringVersion, *_ordering, _forward, _startKeyInclusive);
             return _indexCursor->seek(keyStringForSeek);
         } else {
             _checker.reset(new IndexBoundsChecker(&_bounds, _keyPattern, _direction));
@@ -128,10 +126,7 @@ boost::optional<IndexKeyEntry> IndexScan::initIndexScan() {
             if (!_checker->getStartSeekPoint(&_seekPoint))
                 return boost::none;
             return _indexCursor->seek(IndexEntryComparison::makeKeyStringFromSeekPointForSeek(
-                _seekPoint,
-                indexAccessMethod()->getSortedDataInterface()->getKeyStringVersion(),
-                indexAccessMethod()->getSortedDataInterface()->getOrdering(),
-                _forward));
+                _seekPoint, *_keyStringVersion, *_ordering, _forward));
         }
     }
 }
@@ -150,10 +145,7 @@ PlanStage::StageState IndexScan::doWork(WorkingSetID* out) {
             case NEED_SEEK:
                 ++_specificStats.seeks;
                 kv = _indexCursor->seek(IndexEntryComparison::makeKeyStringFromSeekPointForSeek(
-                    _seekPoint,
-                    indexAccessMethod()->getSortedDataInterface()->getKeyStringVersion(),
-                    indexAccessMethod()->getSortedDataInterface()->getOrdering(),
-                    _forward));
+                    _seekPoint, *_keyStringVersion, *_ordering, _forward));
                 break;
             case HIT_END:
                 return PlanStage::IS_EOF;
@@ -242,6 +234,14 @@ PlanStage::StageState IndexScan::doWork(WorkingSetID* out) {
     return PlanStage::ADVANCED;
 }
 
+PlanStage::StageState IndexScan::doWorkBatch(size_t maxUnits,
+                                             std::vector<WorkingSetID>* out,
+                                             WorkingSetID* terminalId) {
+    // The qualified call lets the tight loop avoid per-key virtual dispatch.
+    return workBatchLoop(
+        maxUnits, out, terminalId, [this](WorkingSetID* id) { return IndexScan::doWork(id); });
+}
+
 bool IndexScan::isEOF() {
     return _commonStats.isEOF;
 }
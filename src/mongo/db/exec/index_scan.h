@@ -114,6 +114,9 @@ public:
               const MatchExpression* filter);
 
     StageState doWork(WorkingSetID* out) final;
+    StageState doWorkBatch(size_t maxUnits,
+                           std::vector<WorkingSetID>* out,
+                           WorkingSetID* terminalId) final;
     bool isEOF() final;
     void doDetachFromOperationContext() final;
     void doReattachToOperationContext() final;
@@ -183,6 +186,12 @@ private:
     std::unique_ptr<IndexBoundsChecker> _checker;
     IndexSeekPoint _seekPoint;
 
+    // Memoized parameters for building the KeyString seek target from _seekPoint. These are
+    // immutable properties of the index, cached when the cursor is initialized so that repeated
+    // seeks do not have to chase through the access method to rediscover them.
+    boost::optional<KeyString::Version> _keyStringVersion;
+    boost::optional<Ordering> _ordering;
+
     //
     // 2) If the index scan is a single contiguous interval, then the scan can execute faster by
     //    letting the index cursor tell us when it hits the end, rather than repeatedly doing
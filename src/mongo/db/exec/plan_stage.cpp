@@ -37,6 +37,27 @@
 #include "mongo/db/service_context.h"
 
 namespace mongo {
+PlanStage::StageState PlanStage::doWorkBatch(size_t maxUnits,
+                                            std::vector<WorkingSetID>* out,
+                                            WorkingSetID* terminalId) {
+    // Loop the single-result protocol. work() already maintains the common stats and the
+    // execution timer, so this default must not touch either.
+    StageState state = NEED_TIME;
+    for (size_t unit = 0; unit < maxUnits; ++unit) {
+        WorkingSetID id = WorkingSet::INVALID_ID;
+        state = work(&id);
+
+        if (StageState::ADVANCED == state) {
+            out->push_back(id);
+        } else if (StageState::NEED_TIME != state) {
+            *terminalId = id;
+            break;
+        }
+    }
+
+    return state;
+}
+
 void PlanStage::saveState() {
     ++_commonStats.yields;
     for (auto&& child : _children) {
@@ -220,6 +220,24 @@ public:
         return workResult;
     }
 
+    /**
+     * Performs up to 'maxUnits' units of work, appending the WorkingSetID of each produced result
+     * to 'out'. Returns the StageState of the last unit of work performed.
+     *
+     * This is the batched counterpart of work(). Callers must consume all appended results before
+     * acting on the returned state: a terminal state (NEED_YIELD, FAILURE or IS_EOF) may follow
+     * results produced earlier in the same call. On NEED_YIELD or FAILURE the out parameter of
+     * work() is conveyed through '*terminalId', with the same semantics as for work().
+     *
+     * The default implementation loops work() and preserves its semantics and stats exactly.
+     * Stages that can produce results in a tight loop override doWorkBatch() to amortize
+     * per-result virtual dispatch and stats bookkeeping.
+     */
+    StageState workBatch(size_t maxUnits, std::vector<WorkingSetID>* out, WorkingSetID* terminalId) {
+        dassert(maxUnits > 0);
+        return doWorkBatch(maxUnits, out, terminalId);
+    }
+
     /**
      * Returns true if no more work can be done on the query / out of results.
      */
@@ -377,6 +395,55 @@ protected:
      */
     virtual StageState doWork(WorkingSetID* out) = 0;
 
+    /**
+     * Performs up to 'maxUnits' units of work.  See comment at workBatch() above.
+     *
+     * The default implementation loops work(), so overriding is never required for correctness.
+     * Overrides typically call workBatchLoop() with the stage's own doWork(), qualified to avoid
+     * virtual dispatch.
+     */
+    virtual StageState doWorkBatch(size_t maxUnits,
+                                   std::vector<WorkingSetID>* out,
+                                   WorkingSetID* terminalId);
+
+    /**
+     * Helper for doWorkBatch() overrides. Runs up to 'maxUnits' calls to 'workFn' (typically the
+     * stage's own doWork(), called without virtual dispatch) under a single timer scope,
+     * maintaining the same common stats that work() would.
+     */
+    template <typename WorkFn>
+    StageState workBatchLoop(size_t maxUnits,
+                             std::vector<WorkingSetID>* out,
+                             WorkingSetID* terminalId,
+                             WorkFn workFn) {
+        auto optTimer(getOptTimer());
+
+        StageState state = NEED_TIME;
+        for (size_t unit = 0; unit < maxUnits; ++unit) {
+            WorkingSetID id = WorkingSet::INVALID_ID;
+
+            ++_commonStats.works;
+            state = workFn(&id);
+
+            if (StageState::ADVANCED == state) {
+                ++_commonStats.advanced;
+                out->push_back(id);
+            } else if (StageState::NEED_TIME == state) {
+                ++_commonStats.needTime;
+            } else {
+                if (StageState::NEED_YIELD == state) {
+                    ++_commonStats.needYield;
+                } else if (StageState::FAILURE == state) {
+                    _commonStats.failed = true;
+                }
+                *terminalId = id;
+                break;
+            }
+        }
+
+        return state;
+    }
+
     /**
      * Saves any stage-specific state required to resume where it was if the underlying data
      * changes.
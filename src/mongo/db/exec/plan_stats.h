@@ -633,6 +633,11 @@ struct SortStats : public SpecificStats {
     // disk use is allowed.
     uint64_t totalDataSizeBytes = 0u;
 
+    // The peak amount of data buffered in memory by the underlying sorter, in bytes. For a sort
+    // with a limit this stays bounded by the retained top-k results even when 'totalDataSizeBytes'
+    // is much larger.
+    uint64_t maxUsedMemoryBytes = 0u;
+
     // Whether we spilled data to disk during the execution of this query.
     bool wasDiskUsed = false;
 };
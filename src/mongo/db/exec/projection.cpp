@@ -161,6 +161,52 @@ PlanStage::StageState ProjectionStage::doWork(WorkingSetID* out) {
     return status;
 }
 
+PlanStage::StageState ProjectionStage::doWorkBatch(size_t maxUnits,
+                                                  std::vector<WorkingSetID>* out,
+                                                  WorkingSetID* terminalId) {
+    auto optTimer(getOptTimer());
+
+    std::vector<WorkingSetID> childResults;
+    WorkingSetID childTerminalId = WorkingSet::INVALID_ID;
+    StageState status = child()->workBatch(maxUnits, &childResults, &childTerminalId);
+
+    for (WorkingSetID id : childResults) {
+        ++_commonStats.works;
+
+        // Punt to our specific projection impl.
+        Status projStatus = transform(_ws.get(id));
+        if (!projStatus.isOK()) {
+            LOGV2_WARNING(31614,
+                          "Couldn't execute projection, status = {projStatus}",
+                          "projStatus"_attr = redact(projStatus));
+            _commonStats.failed = true;
+            *terminalId = WorkingSetCommon::allocateStatusMember(&_ws, projStatus);
+            return PlanStage::FAILURE;
+        }
+
+        ++_commonStats.advanced;
+        out->push_back(id);
+    }
+
+    // Surface the child's terminal state for the batch. Results already appended to 'out' are
+    // consumed by the caller first.
+    if (PlanStage::NEED_YIELD == status || PlanStage::FAILURE == status ||
+        PlanStage::IS_EOF == status) {
+        if (PlanStage::FAILURE == status) {
+            // The stage which produces a failure is responsible for allocating a working set
+            // member with error details.
+            invariant(WorkingSet::INVALID_ID != childTerminalId);
+            _commonStats.failed = true;
+        } else if (PlanStage::NEED_YIELD == status) {
+            ++_commonStats.needYield;
+        }
+        *terminalId = childTerminalId;
+        return status;
+    }
+
+    return out->empty() ? PlanStage::NEED_TIME : PlanStage::ADVANCED;
+}
+
 std::unique_ptr<PlanStageStats> ProjectionStage::getStats() {
     _commonStats.isEOF = isEOF();
     auto ret = std::make_unique<PlanStageStats>(_commonStats, stageType());
@@ -0,0 +1,73 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/exec/shared_scan_tracker.h"
+
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+namespace {
+
+// A reported position is only useful to a new scanner while the scan that reported it is still
+// actively reading. Positions older than this are ignored; a stale join would be harmless (the
+// joiner still visits every record exactly once) but would split a solo scan into two passes for
+// no benefit.
+constexpr auto kPositionMaxAge = Seconds(5);
+
+// How many calls to reportPosition() between refreshes of the report timestamp. The freshness
+// check only needs coarse granularity, and this keeps the clock read off the per-record path.
+constexpr long long kReportsPerTimestampRefresh = 256;
+
+}  // namespace
+
+void SharedScanTracker::reportPosition(const RecordId& id) const {
+    _lastPosition.store(id.repr());
+
+    if (_numReports.fetchAndAdd(1) % kReportsPerTimestampRefresh == 0) {
+        _lastReportMillis.store(Date_t::now().toMillisSinceEpoch());
+    }
+}
+
+boost::optional<RecordId> SharedScanTracker::positionForNewScanner() const {
+    const auto lastReportMillis = _lastReportMillis.load();
+    if (lastReportMillis == 0 ||
+        Date_t::now() - Date_t::fromMillisSinceEpoch(lastReportMillis) > kPositionMaxAge) {
+        return boost::none;
+    }
+
+    RecordId position(_lastPosition.load());
+    if (position.isNull()) {
+        return boost::none;
+    }
+    return position;
+}
+
+}  // namespace mongo
@@ -0,0 +1,85 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <boost/optional.hpp>
+
+#include "mongo/db/catalog/collection.h"
+#include "mongo/db/record_id.h"
+#include "mongo/platform/atomic_word.h"
+
+namespace mongo {
+
+/**
+ * Tracks the read position of shared-scan-eligible collection scans so that a scan starting while
+ * another scan of the same collection is in progress can attach to that scan's position rather
+ * than reading the collection from the beginning. Scans travelling together reuse the pages the
+ * leading scan just brought into the storage engine cache instead of each faulting in its own
+ * copy; a scan that joined mid-collection wraps around at EOF to cover the records it skipped.
+ *
+ * The tracker is purely advisory. Participating scans report the RecordId of each record they
+ * visit, and a new scan consults the most recently reported position, using it only if it is
+ * fresh enough to indicate an actively running scan. All state is lock-free, and no registration
+ * or deregistration is required, so a scan that is killed or abandoned needs no cleanup here.
+ */
+class SharedScanTracker {
+public:
+    inline static const auto get = Collection::declareDecoration<SharedScanTracker>();
+
+    /**
+     * Records that a participating scan has just visited the record with the given id. Called for
+     * every record a participating scan reads, so it must stay cheap.
+     *
+     * This method is const, and the state below mutable, because scans only hold const access to
+     * the Collection they are reading and this advisory state is not part of the collection's
+     * logical state.
+     */
+    void reportPosition(const RecordId& id) const;
+
+    /**
+     * Returns the position at which a newly starting scan should join the scans already in
+     * progress, or boost::none if no scan has reported a position recently enough for it to be
+     * worth joining.
+     */
+    boost::optional<RecordId> positionForNewScanner() const;
+
+private:
+    // RecordId::repr() of the most recently reported position, or 0 if none.
+    mutable AtomicWord<long long> _lastPosition{0};
+
+    // When '_lastPosition' was last refreshed, in milliseconds since epoch, or 0 if never.
+    // Updated only periodically to keep the clock read off the per-record path.
+    mutable AtomicWord<long long> _lastReportMillis{0};
+
+    // Number of calls to reportPosition(), used to throttle updates of '_lastReportMillis'.
+    mutable AtomicWord<long long> _numReports{0};
+};
+
+}  // namespace mongo
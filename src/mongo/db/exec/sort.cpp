@@ -113,7 +113,11 @@ SortStageDefault::SortStageDefault(boost::intrusive_ptr<ExpressionContext> expCt
                     limit,
                     maxMemoryUsageBytes,
                     expCtx->tempDir,
-                    expCtx->allowDiskUse) {}
+                    expCtx->allowDiskUse) {
+    if (expCtx->opCtx) {
+        _sortExecutor.attachMemoryBroker(expCtx->opCtx->getServiceContext());
+    }
+}
 
 void SortStageDefault::spool(WorkingSetID wsid) {
     SortableWorkingSetMember extractedMember{_ws->extract(wsid)};
@@ -149,7 +153,11 @@ SortStageSimple::SortStageSimple(boost::intrusive_ptr<ExpressionContext> expCtx,
                     limit,
                     maxMemoryUsageBytes,
                     expCtx->tempDir,
-                    expCtx->allowDiskUse) {}
+                    expCtx->allowDiskUse) {
+    if (expCtx->opCtx) {
+        _sortExecutor.attachMemoryBroker(expCtx->opCtx->getServiceContext());
+    }
+}
 
 void SortStageSimple::spool(WorkingSetID wsid) {
     auto member = _ws->get(wsid);
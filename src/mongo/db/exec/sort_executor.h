@@ -29,11 +29,14 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "mongo/db/exec/document_value/document.h"
 #include "mongo/db/exec/plan_stats.h"
 #include "mongo/db/exec/sort_key_comparator.h"
 #include "mongo/db/exec/working_set.h"
 #include "mongo/db/pipeline/expression.h"
+#include "mongo/db/query/aggregation_memory_broker.h"
 #include "mongo/db/query/sort_pattern.h"
 #include "mongo/db/sorter/sorter.h"
 
@@ -85,6 +88,17 @@ public:
         return _sortPattern;
     }
 
+    /**
+     * Registers this sort with the server-wide aggregation memory pool, making the memory limit
+     * dynamic: the sorter may exceed the static limit while the pool has spare capacity, and
+     * spills earlier when many stages compete for the pool. Must be called before the first call
+     * to add(), and only once this executor has reached its final address, since the sorter holds
+     * a callback into it. Without this call the static limit applies unchanged.
+     */
+    void attachMemoryBroker(ServiceContext* svcCtx) {
+        _memoryLease = AggregationMemoryBroker::get(svcCtx).makeLease();
+    }
+
     /**
      * Absorbs 'limit', enabling a top-k sort. It is safe to call this multiple times, it will keep
      * the smallest limit.
@@ -129,6 +143,8 @@ public:
         _sorter->add(sortKey, data);
 
         _stats.totalDataSizeBytes += data.memUsageForSorter();
+        _stats.maxUsedMemoryBytes =
+            std::max(_stats.maxUsedMemoryBytes, static_cast<uint64_t>(_sorter->memUsed()));
     }
 
     /**
@@ -172,16 +188,21 @@ public:
     }
 
 private:
-    SortOptions makeSortOptions() const {
+    SortOptions makeSortOptions() {
         SortOptions opts;
         if (_stats.limit) {
             opts.limit = _stats.limit;
         }
 
         opts.maxMemoryUsageBytes = _stats.maxMemoryUsageBytes;
+        opts.dynamicMemoryLimit = [this](size_t memUsed) {
+            _memoryLease.reportUsage(memUsed);
+            return _memoryLease.effectiveLimit(_stats.maxMemoryUsageBytes);
+        };
         if (_diskUseAllowed) {
             opts.extSortAllowed = true;
             opts.tempDir = _tempDir;
+            opts.backgroundSpill = true;
         }
 
         return opts;
@@ -191,6 +212,9 @@ private:
     const std::string _tempDir;
     const bool _diskUseAllowed;
 
+    // Unregistered (and therefore a no-op) unless attachMemoryBroker() is called.
+    AggregationMemoryBroker::Lease _memoryLease;
+
     std::unique_ptr<DocumentSorter> _sorter;
     std::unique_ptr<typename DocumentSorter::Iterator> _output;
 
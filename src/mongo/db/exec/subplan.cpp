@@ -189,7 +189,7 @@ namespace {
  * plan for 'orChild') to 'compositeCacheData'.
  */
 Status tagOrChildAccordingToCache(PlanCacheIndexTree* compositeCacheData,
-                                  SolutionCacheData* branchCacheData,
+                                  const SolutionCacheData* branchCacheData,
                                   MatchExpression* orChild,
                                   const std::map<IndexEntry::Identifier, size_t>& indexMap) {
     invariant(compositeCacheData);
@@ -237,7 +237,10 @@ Status SubplanStage::choosePlanForSubqueries(PlanYieldPolicy* yieldPolicy) {
         if (branchResult->cachedSolution.get()) {
             // We can get the index tags we need out of the cache.
             Status tagStatus = tagOrChildAccordingToCache(
-                cacheData.get(), branchResult->cachedSolution->plannerData[0], orChild, _indexMap);
+                cacheData.get(),
+                branchResult->cachedSolution->plannerData[0].get(),
+                orChild,
+                _indexMap);
             if (!tagStatus.isOK()) {
                 return tagStatus;
             }
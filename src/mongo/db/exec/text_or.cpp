@@ -61,8 +61,7 @@ TextOrStage::TextOrStage(ExpressionContext* expCtx,
       _ftsSpec(ftsSpec),
       _ws(ws),
       _scoreIterator(_scores.end()),
-      _filter(filter),
-      _idRetrying(WorkingSet::INVALID_ID) {}
+      _filter(filter) {}
 
 void TextOrStage::addChild(unique_ptr<PlanStage> child) {
     _children.push_back(std::move(child));
@@ -170,16 +169,9 @@ PlanStage::StageState TextOrStage::readFromChildren(WorkingSetID* out) {
     }
     invariant(_currentChild < _children.size());
 
-    // Either retry the last WSM we worked on or get a new one from our current child.
+    // Get a new WSM from our current child.
     WorkingSetID id;
-    StageState childState;
-    if (_idRetrying == WorkingSet::INVALID_ID) {
-        childState = _children[_currentChild]->work(&id);
-    } else {
-        childState = ADVANCED;
-        id = _idRetrying;
-        _idRetrying = WorkingSet::INVALID_ID;
-    }
+    StageState childState = _children[_currentChild]->work(&id);
 
     if (PlanStage::ADVANCED == childState) {
         return addTerm(id, out);
@@ -223,18 +215,42 @@ PlanStage::StageState TextOrStage::returnResults(WorkingSetID* out) {
         return PlanStage::IS_EOF;
     }
 
-    // Retrieve the record that contains the text score.
-    TextRecordData textRecordData = _scoreIterator->second;
-    ++_scoreIterator;
+    // Retrieve the record that contains the text score. The iterator is advanced only once the
+    // result has been handled, so that a fetch interrupted by a write conflict is retried.
+    const TextRecordData& textRecordData = _scoreIterator->second;
 
     // Ignore non-matched documents.
     if (textRecordData.score < 0) {
         invariant(textRecordData.wsid == WorkingSet::INVALID_ID);
+        ++_scoreIterator;
         return PlanStage::NEED_TIME;
     }
 
     WorkingSetMember* wsm = _ws->get(textRecordData.wsid);
 
+    // Fetch the document now that this result is actually being returned. Scoring runs entirely
+    // off the index keys, so documents a parent stage never asks for are never fetched.
+    if (!wsm->hasObj()) {
+        try {
+            if (!WorkingSetCommon::fetch(
+                    opCtx(), _ws, textRecordData.wsid, _recordCursor, collection()->ns())) {
+                // The document was deleted out from under us after its keys were read.
+                _ws->free(textRecordData.wsid);
+                ++_scoreIterator;
+                return PlanStage::NEED_TIME;
+            }
+            ++_specificStats.fetches;
+        } catch (const WriteConflictException&) {
+            *out = WorkingSet::INVALID_ID;
+            return PlanStage::NEED_YIELD;
+        }
+
+        // Ensure that the BSONObj underlying the WorkingSetMember is owned in case we yield.
+        wsm->makeObjOwnedIfNeeded();
+    }
+
+    ++_scoreIterator;
+
     // Populate the working set member with the text score metadata and return it.
     wsm->metadata().setTextScore(textRecordData.score);
     *out = textRecordData.wsid;
@@ -265,34 +281,18 @@ PlanStage::StageState TextOrStage::addTerm(WorkingSetID wsid, WorkingSetID* out)
             return NEED_TIME;
         }
 
-        // Our parent expects RID_AND_OBJ members, so we fetch the document here if we haven't
-        // already.
-        try {
-            if (!WorkingSetCommon::fetch(opCtx(), _ws, wsid, _recordCursor, collection()->ns())) {
-                _ws->free(wsid);
-                textRecordData->score = -1;
-                return NEED_TIME;
-            }
-            ++_specificStats.fetches;
-        } catch (const WriteConflictException&) {
-            wsm->makeObjOwnedIfNeeded();
-            _idRetrying = wsid;
-            *out = WorkingSet::INVALID_ID;
-            return NEED_YIELD;
-        }
-
+        // Hold on to the member in its RID_AND_IDX state; the index keys are owned, so it is
+        // safe to keep across yields. The document itself is fetched lazily in returnResults(),
+        // so documents discarded before being returned never pay for a fetch. The score weight
+        // is stored in the index entry, so scoring needs no fetch either.
         textRecordData->wsid = wsid;
-
-        // Ensure that the BSONObj underlying the WorkingSetMember is owned in case we yield.
-        wsm->makeObjOwnedIfNeeded();
     } else {
-        // We already have a working set member for this RecordId. Free the new WSM and retrieve the
+        // We already have a working set member for this RecordId. Free the new WSM and keep the
         // old one. Note that since we don't keep all index keys, we could get a score that doesn't
         // match the document, but this has always been a problem.
         // TODO something to improve the situation.
         invariant(wsid != textRecordData->wsid);
         _ws->free(wsid);
-        wsm = _ws->get(textRecordData->wsid);
     }
 
     // Locate score within possibly compound key: {prefix,term,score,suffix}.
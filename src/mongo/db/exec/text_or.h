@@ -119,7 +119,9 @@ private:
     StageState addTerm(WorkingSetID wsid, WorkingSetID* out);
 
     /**
-     * Worker for kReturningResults. Returns a wsm with RecordID and Score.
+     * Worker for kReturningResults. Fetches the document for the next buffered result and
+     * returns a wsm with RecordID and Score. Fetching is deferred to here so that results a
+     * parent stage never consumes (e.g. past its limit) never touch the record store.
      */
     StageState returnResults(WorkingSetID* out);
 
@@ -154,7 +156,6 @@ private:
 
     // Members needed only for using the TextMatchableDocument.
     const MatchExpression* _filter;
-    WorkingSetID _idRetrying;
     std::unique_ptr<SeekableRecordCursor> _recordCursor;
 };
 }  // namespace mongo
@@ -46,11 +46,13 @@
 #include "mongo/db/op_observer.h"
 #include "mongo/db/query/collection_query_info.h"
 #include "mongo/db/query/explain.h"
+#include "mongo/db/repl/repl_server_parameters_gen.h"
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/s/operation_sharding_state.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/storage/duplicate_key_error_info.h"
 #include "mongo/db/update/path_support.h"
+#include "mongo/db/update/replacement_update_diff.h"
 #include "mongo/db/update/storage_validation.h"
 #include "mongo/logv2/log.h"
 #include "mongo/s/shard_key_pattern.h"
@@ -171,6 +173,10 @@ BSONObj UpdateStage::transformAndUpdate(const Snapshotted<BSONObj>& oldObj, Reco
                     ? mutablebson::Document::kInPlaceEnabled
                     : mutablebson::Document::kInPlaceDisabled));
 
+    // The record stores reached from here understand damage events that grow the record,
+    // so mods that append new fields to the document root can also be applied in place.
+    _doc.enableInPlaceAppends();
+
     BSONObj logObj;
 
     bool docWasModified = false;
@@ -252,6 +258,18 @@ BSONObj UpdateStage::transformAndUpdate(const Snapshotted<BSONObj>& oldObj, Reco
         if (!request->isExplain()) {
             args.stmtId = request->getStmtId();
             args.update = logObj;
+            if (driver->type() == UpdateDriver::UpdateType::kReplacement &&
+                repl::logReplacementUpdatesAsDeltas.load() && opCtx()->writesAreReplicated() &&
+                !request->isFromMigration()) {
+                // For a replacement update 'logObj' is the entire post-image. When only a few
+                // fields changed, an equivalent $set/$unset entry is usually far smaller and
+                // secondaries apply it through the existing modifier-update path. The diff is
+                // only substituted when replaying it reproduces the post-image byte for byte.
+                if (auto diff =
+                        update::makeReplacementOplogDiff(oldObj.value(), _doc.getObject())) {
+                    args.update = *diff;
+                }
+            }
             args.criteria = collDesc.extractDocumentKey(newObj);
             uassert(16980,
                     "Multi-update operations require all documents to have an '_id' field",
@@ -268,6 +286,18 @@ BSONObj UpdateStage::transformAndUpdate(const Snapshotted<BSONObj>& oldObj, Reco
                 newObj = oldObj.value();
                 const RecordData oldRec(oldObj.value().objdata(), oldObj.value().objsize());
 
+                // Damage events that grow the document can push it past the BSON size limit,
+                // so size the post-image from the damage deltas before writing anything.
+                int64_t newObjSize = oldObj.value().objsize();
+                for (const auto& event : _damages) {
+                    newObjSize +=
+                        static_cast<int64_t>(event.size) - static_cast<int64_t>(event.targetSize);
+                }
+                uassert(5274700,
+                        str::stream() << "Resulting document after update is larger than "
+                                      << BSONObjMaxUserSize,
+                        newObjSize <= BSONObjMaxUserSize);
+
                 Snapshotted<RecordData> snap(oldObj.snapshotId(), oldRec);
 
                 if (collDesc.isSharded() && _shouldCheckForShardKeyUpdate) {
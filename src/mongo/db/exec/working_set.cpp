@@ -70,6 +70,16 @@ void WorkingSet::free(WorkingSetID i) {
     _freeList = i;
 }
 
+size_t WorkingSet::getMemUsage() const {
+    size_t memUsage = _data.capacity() * sizeof(MemberHolder);
+    for (WorkingSetID i = 0; i < _data.size(); i++) {
+        if (_data[i].nextFreeOrSelf == i) {
+            memUsage += _data[i].member.getMemUsage();
+        }
+    }
+    return memUsage;
+}
+
 void WorkingSet::clear() {
     _data.clear();
 
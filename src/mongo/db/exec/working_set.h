@@ -29,9 +29,11 @@
 
 #pragma once
 
-#include "boost/optional.hpp"
+#include <boost/container/small_vector.hpp>
 #include <vector>
 
+#include "boost/optional.hpp"
+
 #include "mongo/db/exec/document_value/document.h"
 #include "mongo/db/exec/document_value/document_metadata_fields.h"
 #include "mongo/db/jsobj.h"
@@ -57,6 +59,14 @@ using WorkingSetRegisteredIndexId = unsigned int;
  * the index that provided the key.  The index key pattern is required to correctly interpret
  * the key.
  */
+struct IndexKeyDatum;
+
+/**
+ * Nearly every document produced by an index scan carries exactly one index key, so the key data
+ * is stored inline to avoid a heap allocation per WorkingSetMember in the common case.
+ */
+using IndexKeyDatumVector = boost::container::small_vector<IndexKeyDatum, 1>;
+
 struct IndexKeyDatum {
     IndexKeyDatum(const BSONObj& keyPattern,
                   const BSONObj& key,
@@ -69,7 +79,7 @@ struct IndexKeyDatum {
      * object is populated if the element is in a provided index key.  Returns none otherwise.
      * Returning none indicates a query planning error.
      */
-    static boost::optional<BSONElement> getFieldDotted(const std::vector<IndexKeyDatum>& keyData,
+    static boost::optional<BSONElement> getFieldDotted(const IndexKeyDatumVector& keyData,
                                                        const std::string& field) {
         for (size_t i = 0; i < keyData.size(); ++i) {
             BSONObjIterator keyPatternIt(keyData[i].indexKeyPattern);
@@ -152,7 +162,7 @@ public:
 
     RecordId recordId;
     Snapshotted<Document> doc;
-    std::vector<IndexKeyDatum> keyData;
+    IndexKeyDatumVector keyData;
 
     bool hasRecordId() const;
     bool hasObj() const;
@@ -349,6 +359,13 @@ public:
      */
     void clear();
 
+    /**
+     * Returns the expected memory usage of this working set: the member slots themselves plus
+     * the data held by the members currently in use. Freed slots remain in '_data' but have had
+     * their resources released, so they contribute only their fixed slot size.
+     */
+    size_t getMemUsage() const;
+
     //
     // WorkingSetMember state transitions
     //
@@ -47,7 +47,7 @@
 namespace mongo {
 
 namespace {
-std::string indexKeyVectorDebugString(const std::vector<IndexKeyDatum>& keyData) {
+std::string indexKeyVectorDebugString(const IndexKeyDatumVector& keyData) {
     StringBuilder sb;
     sb << "[";
     if (keyData.size() > 0) {
@@ -82,7 +82,7 @@ bool WorkingSetCommon::fetch(OperationContext* opCtx,
         // we first examined the index entry, then it's likely that the record was deleted while we
         // were yielding. However, if the snapshot id hasn't changed since the index lookup, then
         // there could not have been a yield, and the only explanation is corruption.
-        std::vector<IndexKeyDatum>::iterator keyDataIt;
+        IndexKeyDatumVector::iterator keyDataIt;
         if (member->getState() == WorkingSetMember::RID_AND_IDX &&
             (keyDataIt = std::find_if(member->keyData.begin(),
                                       member->keyData.end(),
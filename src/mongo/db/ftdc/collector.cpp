@@ -31,6 +31,8 @@
 
 #include "mongo/db/ftdc/collector.h"
 
+#include <algorithm>
+
 #include "mongo/base/string_data.h"
 #include "mongo/bson/bsonmisc.h"
 #include "mongo/bson/bsonobjbuilder.h"
@@ -43,9 +45,35 @@
 
 namespace mongo {
 
+namespace {
+
+// Upper bound on worker threads used to run collectors concurrently.
+constexpr size_t kMaxCollectorThreads = 4;
+
+// How long an individual collector may run before its operation context is interrupted. This
+// stops a wedged collector, such as storage engine statistics under cache pressure, from pinning
+// a worker thread indefinitely.
+const Seconds kCollectorDeadline{60};
+
+// How long a sampling pass waits for its collectors before emitting the previous samples for the
+// stragglers. Generous relative to the default one second collection period; it exists so that a
+// single stuck section cannot stall diagnostic collection entirely.
+const Seconds kMaxSampleWait{10};
+
+}  // namespace
+
+FTDCCollectorCollection::~FTDCCollectorCollection() {
+    if (_pool) {
+        _pool->shutdown();
+        _pool->join();
+    }
+}
+
 void FTDCCollectorCollection::add(std::unique_ptr<FTDCCollectorInterface> collector) {
     // TODO: ensure the collectors all have unique names.
-    _collectors.emplace_back(std::move(collector));
+    invariant(!_pool);
+    _collectors.emplace_back();
+    _collectors.back().collector = std::move(collector);
 }
 
 std::tuple<BSONObj, Date_t> FTDCCollectorCollection::collect(Client* client) {
@@ -55,14 +83,99 @@ std::tuple<BSONObj, Date_t> FTDCCollectorCollection::collect(Client* client) {
         return std::tuple<BSONObj, Date_t>(BSONObj(), Date_t());
     }
 
-    BSONObjBuilder builder;
+    auto clock = client->getServiceContext()->getPreciseClockSource();
+    Date_t start = clock->now();
+
+    if (!_pool) {
+        ThreadPool::Options options;
+        options.poolName = "FTDCCollector";
+        options.minThreads = 0;
+        options.maxThreads = std::min(_collectors.size(), kMaxCollectorThreads);
+        options.onCreateThread = [](const std::string& threadName) {
+            Client::initThread(threadName.c_str());
+        };
+        _pool = std::make_unique<ThreadPool>(options);
+        _pool->startup();
+    }
+
+    // Decide which collectors actually run this pass. A collector that is still running from an
+    // earlier pass, or whose sampling interval has not elapsed, re-emits its previous section
+    // unchanged so the sample schema stays stable for the metric compressor.
+    std::vector<CollectorState*> scheduled;
+    {
+        stdx::lock_guard<Latch> lk(_mutex);
+        for (auto& state : _collectors) {
+            if (state.inFlight) {
+                continue;
+            }
+
+            auto interval = state.collector->sampleInterval();
+            if (interval > Milliseconds{0} && !state.lastSample.isEmpty() &&
+                start - state.lastSampleTime < interval) {
+                continue;
+            }
+
+            state.inFlight = true;
+            state.lastSampleTime = start;
+            scheduled.push_back(&state);
+        }
+    }
 
-    Date_t start = client->getServiceContext()->getPreciseClockSource()->now();
-    Date_t end;
-    bool firstLoop = true;
+    for (auto* state : scheduled) {
+        _pool->schedule([this, state](Status status) {
+            BSONObj section;
+            if (status.isOK()) {
+                section = _collectOne(state->collector.get());
+            }
+
+            stdx::lock_guard<Latch> lk(_mutex);
+            if (!section.isEmpty()) {
+                state->lastSample = std::move(section);
+            }
+            state->inFlight = false;
+            _condvar.notify_all();
+        });
+    }
 
+    stdx::unique_lock<Latch> lk(_mutex);
+
+    // Wait for this pass's collectors with a deadline; any collector that has not finished by
+    // then contributes its previous sample this pass and publishes its result for the next one.
+    Date_t waitDeadline = start + kMaxSampleWait;
+    auto allDone = [&] {
+        return std::none_of(scheduled.begin(), scheduled.end(), [](CollectorState* state) {
+            return state->inFlight;
+        });
+    };
+    while (!allDone()) {
+        if (_condvar.wait_until(lk, waitDeadline.toSystemTimePoint()) ==
+            stdx::cv_status::timeout) {
+            break;
+        }
+    }
+
+    // Assemble the sample in registration order so the field order is deterministic.
+    BSONObjBuilder builder;
     builder.appendDate(kFTDCCollectStartField, start);
 
+    for (auto& state : _collectors) {
+        // A collector that has never completed, because its very first run is still in flight,
+        // has nothing to contribute yet.
+        if (state.lastSample.isEmpty()) {
+            continue;
+        }
+        builder.append(state.collector->name(), state.lastSample);
+    }
+
+    builder.appendDate(kFTDCCollectEndField, clock->now());
+
+    return std::tuple<BSONObj, Date_t>(builder.obj(), start);
+}
+
+BSONObj FTDCCollectorCollection::_collectOne(FTDCCollectorInterface* collector) {
+    auto client = &cc();
+    auto clock = client->getServiceContext()->getPreciseClockSource();
+
     // All collectors should be ok seeing the inconsistent states in the middle of replication
     // batches. This is desirable because we want to be able to collect data in the middle of
     // batches that are taking a long time.
@@ -73,30 +186,30 @@ std::tuple<BSONObj, Date_t> FTDCCollectorCollection::collect(Client* client) {
     // Explicitly start future read transactions without a timestamp.
     opCtx->recoveryUnit()->setTimestampReadSource(RecoveryUnit::ReadSource::kNoTimestamp);
 
-    for (auto& collector : _collectors) {
-        BSONObjBuilder subObjBuilder(builder.subobjStart(collector->name()));
-
-        // Add a Date_t before and after each BSON is collected so that we can track timing of the
-        // collector.
-        Date_t now = start;
-
-        if (!firstLoop) {
-            now = client->getServiceContext()->getPreciseClockSource()->now();
-        }
+    // Add a Date_t before and after the BSON is collected so that we can track timing of the
+    // collector.
+    Date_t sectionStart = clock->now();
 
-        firstLoop = false;
+    // Interrupt collectors that run unreasonably long so they cannot pin a worker thread.
+    opCtx->setDeadlineByDate(sectionStart + kCollectorDeadline, ErrorCodes::ExceededTimeLimit);
 
-        subObjBuilder.appendDate(kFTDCCollectStartField, now);
+    try {
+        BSONObjBuilder subObjBuilder;
+        subObjBuilder.appendDate(kFTDCCollectStartField, sectionStart);
 
         collector->collect(opCtx.get(), subObjBuilder);
 
-        end = client->getServiceContext()->getPreciseClockSource()->now();
-        subObjBuilder.appendDate(kFTDCCollectEndField, end);
+        subObjBuilder.appendDate(kFTDCCollectEndField, clock->now());
+        return subObjBuilder.obj();
+    } catch (const DBException& e) {
+        // An interrupted collector may have left a partially built section behind; emit the
+        // failure instead so the sample still records which section was slow.
+        BSONObjBuilder failedBuilder;
+        failedBuilder.appendDate(kFTDCCollectStartField, sectionStart);
+        failedBuilder.append("error", e.toString());
+        failedBuilder.appendDate(kFTDCCollectEndField, clock->now());
+        return failedBuilder.obj();
     }
-
-    builder.appendDate(kFTDCCollectEndField, end);
-
-    return std::tuple<BSONObj, Date_t>(builder.obj(), start);
 }
 
 }  // namespace mongo
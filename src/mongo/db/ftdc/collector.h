@@ -34,12 +34,16 @@
 #include <tuple>
 #include <vector>
 
+#include "mongo/bson/bsonobj.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/util/concurrency/thread_pool.h"
+#include "mongo/util/duration.h"
+#include "mongo/util/time_support.h"
 
 namespace mongo {
 
-class BSONObj;
 class BSONObjBuilder;
-class Date_t;
 class Client;
 class OperationContext;
 
@@ -62,6 +66,17 @@ public:
      */
     virtual std::string name() const = 0;
 
+    /**
+     * Interval at which this collector's data should be refreshed.
+     *
+     * Zero, the default, means the collector runs on every sample. Expensive collectors may
+     * return a longer interval; between refreshes the previous sample is re-emitted unchanged so
+     * that the sample schema stays stable for the metric compressor.
+     */
+    virtual Milliseconds sampleInterval() const {
+        return Milliseconds{0};
+    }
+
     /**
      * Collect a sample.
      *
@@ -77,7 +92,8 @@ protected:
 /**
  * Manages the set of BSON collectors
  *
- * Not Thread-Safe. Locking is owner's responsibility.
+ * Runs collectors concurrently on an internal worker pool so one slow collector does not delay
+ * the rest of the sample. Callers must still externally serialize calls to add() and collect().
  */
 class FTDCCollectorCollection {
     FTDCCollectorCollection(const FTDCCollectorCollection&) = delete;
@@ -85,6 +101,7 @@ class FTDCCollectorCollection {
 
 public:
     FTDCCollectorCollection() = default;
+    ~FTDCCollectorCollection();
 
     /**
      * Add a metric collector to the collection.
@@ -111,8 +128,42 @@ public:
     std::tuple<BSONObj, Date_t> collect(Client* client);
 
 private:
+    /**
+     * Per-collector bookkeeping shared between the sampling thread and the pool workers.
+     */
+    struct CollectorState {
+        std::unique_ptr<FTDCCollectorInterface> collector;
+
+        // Most recent completed section for this collector, including its start/end timing
+        // fields. Re-emitted when the collector is skipped this pass, either because its
+        // sampling interval has not elapsed or because it is still running from an earlier pass.
+        BSONObj lastSample;
+
+        // Time at which the last collection for this collector was started.
+        Date_t lastSampleTime;
+
+        // True while a collection task for this collector is outstanding on the worker pool.
+        bool inFlight = false;
+    };
+
+    /**
+     * Runs a single collector on the current (worker) thread and returns its section, stamping
+     * start/end times around the collected data so per-section collection cost is visible in the
+     * sample.
+     */
+    BSONObj _collectOne(FTDCCollectorInterface* collector);
+
+    // Guards the per-collector state above; pool workers publish their results under this mutex.
+    Mutex _mutex = MONGO_MAKE_LATCH("FTDCCollectorCollection::_mutex");
+
+    // Signaled each time a pool worker finishes a collection task.
+    stdx::condition_variable _condvar;
+
     // collection of collectors
-    std::vector<std::unique_ptr<FTDCCollectorInterface>> _collectors;
+    std::vector<CollectorState> _collectors;
+
+    // Worker pool that runs collectors concurrently; created on the first call to collect().
+    std::unique_ptr<ThreadPool> _pool;
 };
 
 }  // namespace mongo
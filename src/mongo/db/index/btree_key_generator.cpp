@@ -107,6 +107,9 @@ BtreeKeyGenerator::BtreeKeyGenerator(std::vector<const char*> fieldNames,
         size_t pathLength = FieldRef{fieldName}.numParts();
         invariant(pathLength > 0);
         _pathLengths.push_back(pathLength);
+        if (pathLength > 1) {
+            _patternHasOnlyTopLevelFields = false;
+        }
     }
 }
 
@@ -243,7 +246,11 @@ void BtreeKeyGenerator::getKeys(SharedBufferFragmentBuilder& pooledBufferBuilder
             invariant(multikeyPaths->empty());
             multikeyPaths->resize(_fieldNames.size());
         }
-        _getKeysWithoutArray(pooledBufferBuilder, obj, id, keys);
+        if (_patternHasOnlyTopLevelFields) {
+            _getKeysWithoutArrayTopLevel(pooledBufferBuilder, obj, id, keys);
+        } else {
+            _getKeysWithoutArray(pooledBufferBuilder, obj, id, keys);
+        }
     } else {
         if (multikeyPaths) {
             invariant(multikeyPaths->empty());
@@ -307,6 +314,54 @@ void BtreeKeyGenerator::_getKeysWithoutArray(SharedBufferFragmentBuilder& pooled
     keys->insert(keyString.release());
 }
 
+void BtreeKeyGenerator::_getKeysWithoutArrayTopLevel(
+    SharedBufferFragmentBuilder& pooledBufferBuilder,
+    const BSONObj& obj,
+    boost::optional<RecordId> id,
+    KeyStringSet* keys) const {
+    const size_t numFields = _fieldNames.size();
+    invariant(numFields <= Ordering::kMaxCompoundIndexKeys);
+
+    // Collect the element for each key pattern component in a single scan of the document, rather
+    // than restarting a linear field lookup from the beginning of 'obj' per component. A slot left
+    // EOO below corresponds to a missing field and keys identically to _getKeysWithoutArray().
+    BSONElement elems[Ordering::kMaxCompoundIndexKeys];
+    size_t numFound = 0;
+    for (auto&& elem : obj) {
+        const auto fieldName = elem.fieldNameStringData();
+        for (size_t i = 0; i < numFields; i++) {
+            if (elems[i].eoo() && fieldName == _fieldNames[i]) {
+                invariant(elem.type() != BSONType::Array);
+                elems[i] = elem;
+                ++numFound;
+            }
+        }
+        if (numFound == numFields) {
+            break;
+        }
+    }
+
+    if (_isSparse && numFound == 0) {
+        return;
+    }
+
+    KeyString::PooledBuilder keyString{pooledBufferBuilder, _keyStringVersion, _ordering};
+    for (size_t i = 0; i < numFields; i++) {
+        if (_collator) {
+            keyString.appendBSONElement(elems[i], [&](StringData stringData) {
+                return _collator->getComparisonString(stringData);
+            });
+        } else {
+            keyString.appendBSONElement(elems[i]);
+        }
+    }
+
+    if (id) {
+        keyString.appendRecordId(*id);
+    }
+    keys->insert(keyString.release());
+}
+
 void BtreeKeyGenerator::_getKeysWithArray(std::vector<const char*>* fieldNames,
                                           std::vector<BSONElement>* fixed,
                                           SharedBufferFragmentBuilder& pooledBufferBuilder,
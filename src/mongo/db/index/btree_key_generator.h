@@ -168,6 +168,17 @@ private:
                               boost::optional<RecordId> id,
                               KeyStringSet* keys) const;
 
+    /**
+     * A further specialization of _getKeysWithoutArray() for key patterns whose components are all
+     * top-level fields, which covers the overwhelmingly common single-field and compound indexes
+     * without dotted paths. Extracts every component in a single scan of 'obj' rather than
+     * restarting a field lookup from the beginning of the document for each component.
+     */
+    void _getKeysWithoutArrayTopLevel(SharedBufferFragmentBuilder& pooledBufferBuilder,
+                                      const BSONObj& obj,
+                                      boost::optional<RecordId> id,
+                                      KeyStringSet* keys) const;
+
     /**
      * A call to _getKeysWithArray() begins by calling this for each field in the key pattern. It
      * traverses the path '*field' in 'obj' until either reaching the end of the path or an array
@@ -236,6 +247,10 @@ private:
     // the vector is the number of path components in the indexed field.
     std::vector<size_t> _pathLengths;
 
+    // True if every component of the key pattern is a single top-level field, in which case the
+    // non-array key generation path can extract all components in one scan of the document.
+    bool _patternHasOnlyTopLevelFields = true;
+
     // Null if this key generator orders strings according to the simple binary compare. If
     // non-null, represents the collator used to generate index keys for indexed strings.
     const CollatorInterface* _collator;
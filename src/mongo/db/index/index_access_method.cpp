@@ -153,6 +153,29 @@ Status AbstractIndexAccessMethod::insertKeys(OperationContext* opCtx,
                                              const RecordId& loc,
                                              const InsertDeleteOptions& options,
                                              InsertResult* result) {
+    auto status = _insertKeys(opCtx, keys, multikeyMetadataKeys, options, result);
+    if (!status.isOK()) {
+        return status;
+    }
+
+    if (shouldMarkIndexAsMultikey(keys.size(), multikeyMetadataKeys, multikeyPaths)) {
+        _indexCatalogEntry->setMultikey(opCtx, multikeyPaths);
+    }
+    return Status::OK();
+}
+
+Status AbstractIndexAccessMethod::insertKeysNoMultikey(OperationContext* opCtx,
+                                                       const KeyStringSet& keys,
+                                                       const InsertDeleteOptions& options,
+                                                       InsertResult* result) {
+    return _insertKeys(opCtx, keys, KeyStringSet{}, options, result);
+}
+
+Status AbstractIndexAccessMethod::_insertKeys(OperationContext* opCtx,
+                                              const KeyStringSet& keys,
+                                              const KeyStringSet& multikeyMetadataKeys,
+                                              const InsertDeleteOptions& options,
+                                              InsertResult* result) {
     // Add all new data keys, and all new multikey metadata keys, into the index. When iterating
     // over the data keys, each of them should point to the doc's RecordId. When iterating over
     // the multikey metadata keys, they should point to the reserved 'kMultikeyMetadataKeyId'.
@@ -182,10 +205,6 @@ Status AbstractIndexAccessMethod::insertKeys(OperationContext* opCtx,
     if (result) {
         result->numInserted += keys.size() + multikeyMetadataKeys.size();
     }
-
-    if (shouldMarkIndexAsMultikey(keys.size(), multikeyMetadataKeys, multikeyPaths)) {
-        _indexCatalogEntry->setMultikey(opCtx, multikeyPaths);
-    }
     return Status::OK();
 }
 
@@ -262,7 +281,8 @@ RecordId AbstractIndexAccessMethod::findSingle(OperationContext* opCtx,
             invariant(keys->size() == 1);
             return *keys->begin();
         } else {
-            KeyString::HeapBuilder requestedKeyString(
+            KeyString::PooledBuilder requestedKeyString(
+                StorageExecutionContext::get(opCtx).pooledBufferBuilder(),
                 getSortedDataInterface()->getKeyStringVersion(),
                 BSONObj::stripFieldNames(requestedKey),
                 getSortedDataInterface()->getOrdering());
@@ -497,7 +517,11 @@ AbstractIndexAccessMethod::BulkBuilderImpl::BulkBuilderImpl(IndexCatalogEntry* i
           SortOptions()
               .TempDir(storageGlobalParams.dbpath + "/_tmp")
               .ExtSortAllowed()
-              .MaxMemoryUsageBytes(maxMemoryUsageBytes),
+              .MaxMemoryUsageBytes(maxMemoryUsageBytes)
+              .BackgroundSpill()
+              // Index builds produce the largest spill files and the background spill thread hides
+              // the extra compression CPU, so trade it for the smaller on-disk runs zstd gives.
+              .SpillCompressionCodec(SorterCompressionCodec::kZstd),
           BtreeExternalSortComparison(),
           std::pair<KeyString::Value::SorterDeserializeSettings,
                     mongo::NullValue::SorterDeserializeSettings>(
@@ -614,11 +638,18 @@ Status AbstractIndexAccessMethod::commitBulk(OperationContext* opCtx,
 
     KeyString::Value previousKey;
 
+    // Bulk builder inserts go through a bulk cursor that bypasses the transactional machinery, so
+    // the write unit of work only exists to satisfy the storage engine's write contract.
+    // Committing it at intervals rather than per key keeps recovery unit overhead out of the
+    // cursor-call path while draining the sorter.
+    constexpr int64_t kInsertsPerWriteUnitOfWork = 64;
+    int64_t insertsSinceCommit = 0;
+    boost::optional<WriteUnitOfWork> wunit;
+    wunit.emplace(opCtx);
+
     while (it->more()) {
         opCtx->checkForInterrupt();
 
-        WriteUnitOfWork wunit(opCtx);
-
         // Get the next datum and add it to the builder.
         BulkBuilder::Sorter::Data data = it->next();
 
@@ -675,8 +706,13 @@ Status AbstractIndexAccessMethod::commitBulk(OperationContext* opCtx,
 
         // If we're here either it's a dup and we're cool with it or the addKey went just fine.
         pm.hit();
-        wunit.commit();
+        if (++insertsSinceCommit >= kInsertsPerWriteUnitOfWork) {
+            wunit->commit();
+            wunit.emplace(opCtx);
+            insertsSinceCommit = 0;
+        }
     }
+    wunit->commit();
 
     pm.finished();
 
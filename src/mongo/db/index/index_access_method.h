@@ -98,6 +98,17 @@ public:
                               const InsertDeleteOptions& options,
                               InsertResult* result) = 0;
 
+    /**
+     * Inserts the specified keys into the index without any multikey bookkeeping. Intended for
+     * callers that batch up keys generated by many different documents, such as the hybrid index
+     * build drain, where the size of 'keys' implies nothing about any single document's key
+     * count. Duplicate handling matches insertKeys().
+     */
+    virtual Status insertKeysNoMultikey(OperationContext* opCtx,
+                                        const KeyStringSet& keys,
+                                        const InsertDeleteOptions& options,
+                                        InsertResult* result) = 0;
+
     /**
      * Analogous to insertKeys above, but remove the keys instead of inserting them.
      * 'numDeleted' will be set to the number of keys removed from the index for the provided keys.
@@ -463,6 +474,11 @@ public:
                       const InsertDeleteOptions& options,
                       InsertResult* result) final;
 
+    Status insertKeysNoMultikey(OperationContext* opCtx,
+                                const KeyStringSet& keys,
+                                const InsertDeleteOptions& options,
+                                InsertResult* result) final;
+
     Status removeKeys(OperationContext* opCtx,
                       const KeyStringSet& keys,
                       const RecordId& loc,
@@ -565,6 +581,16 @@ private:
      */
     bool isFatalError(OperationContext* opCtx, Status status, KeyString::Value key);
 
+    /**
+     * Shared key-insertion loop for insertKeys() and insertKeysNoMultikey(); performs no
+     * multikey bookkeeping.
+     */
+    Status _insertKeys(OperationContext* opCtx,
+                       const KeyStringSet& keys,
+                       const KeyStringSet& multikeyMetadataKeys,
+                       const InsertDeleteOptions& options,
+                       InsertResult* result);
+
     /**
      * Removes a single key from the index.
      *
@@ -170,6 +170,26 @@ Status IndexBuildInterceptor::drainWritesIntoIndex(OperationContext* opCtx,
         // table matters.
         std::vector<RecordId> recordsAddedToIndex;
 
+        // Writes are applied to the index in runs: consecutive records with the same operation
+        // type are gathered up and inserted (or removed) through a single sorted batch. Ordering
+        // only matters across operation-type boundaries, e.g. an insert and a later delete of the
+        // same key, so a run can be applied set-wise without changing the outcome.
+        std::vector<KeyString::Value> runKeys;
+        Op runOp = Op::kInsert;
+
+        auto applyRun = [&]() -> Status {
+            if (runKeys.empty()) {
+                return Status::OK();
+            }
+            auto status = _applyWrites(
+                opCtx, runOp, runKeys, options, trackDuplicates, &totalInserted, &totalDeleted);
+            runKeys.clear();
+            return status;
+        };
+
+        const auto keyStringVersion =
+            _indexCatalogEntry->accessMethod()->getSortedDataInterface()->getKeyStringVersion();
+
         while (!atEof) {
             opCtx->checkForInterrupt();
 
@@ -191,11 +211,22 @@ Status IndexBuildInterceptor::drainWritesIntoIndex(OperationContext* opCtx,
             batchSize += 1;
             batchSizeBytes += objSize;
 
-            if (auto status = _applyWrite(
-                    opCtx, unownedDoc, options, trackDuplicates, &totalInserted, &totalDeleted);
-                !status.isOK()) {
-                return status;
+            // Deserialize the encoded KeyString::Value.
+            int keyLen;
+            const char* binKey = unownedDoc["key"].binData(keyLen);
+            BufReader reader(binKey, keyLen);
+            auto keyString = KeyString::Value::deserialize(reader, keyStringVersion);
+
+            const Op opType =
+                (strcmp(unownedDoc.getStringField("op"), "i") == 0) ? Op::kInsert : Op::kDelete;
+
+            if (opType != runOp) {
+                if (auto status = applyRun(); !status.isOK()) {
+                    return status;
+                }
+                runOp = opType;
             }
+            runKeys.push_back(std::move(keyString));
 
             // Save the record ids of the documents inserted into the index for deletion later.
             // We can't delete records while holding a positioned cursor.
@@ -207,6 +238,10 @@ Status IndexBuildInterceptor::drainWritesIntoIndex(OperationContext* opCtx,
             }
         }
 
+        if (auto status = applyRun(); !status.isOK()) {
+            return status;
+        }
+
         // Delete documents from the side table as soon as they have been inserted into the index.
         // This ensures that no key is ever inserted twice and no keys are skipped.
         for (const auto& recordId : recordsAddedToIndex) {
@@ -258,37 +293,25 @@ Status IndexBuildInterceptor::drainWritesIntoIndex(OperationContext* opCtx,
     return Status::OK();
 }
 
-Status IndexBuildInterceptor::_applyWrite(OperationContext* opCtx,
-                                          const BSONObj& operation,
-                                          const InsertDeleteOptions& options,
-                                          TrackDuplicates trackDups,
-                                          int64_t* const keysInserted,
-                                          int64_t* const keysDeleted) {
-    // Deserialize the encoded KeyString::Value.
-    int keyLen;
-    const char* binKey = operation["key"].binData(keyLen);
-    BufReader reader(binKey, keyLen);
-    const KeyString::Value keyString = KeyString::Value::deserialize(
-        reader,
-        _indexCatalogEntry->accessMethod()->getSortedDataInterface()->getKeyStringVersion());
-
-    const Op opType =
-        (strcmp(operation.getStringField("op"), "i") == 0) ? Op::kInsert : Op::kDelete;
-
-    const KeyStringSet keySet{keyString};
-    const RecordId opRecordId =
-        KeyString::decodeRecordIdAtEnd(keyString.getBuffer(), keyString.getSize());
+Status IndexBuildInterceptor::_applyWrites(OperationContext* opCtx,
+                                           Op op,
+                                           const std::vector<KeyString::Value>& keys,
+                                           const InsertDeleteOptions& options,
+                                           TrackDuplicates trackDups,
+                                           int64_t* const keysInserted,
+                                           int64_t* const keysDeleted) {
+    invariant(!keys.empty());
+
+    // The keys end in their RecordIds, so keys from different documents never collide and the
+    // whole run can be applied as one sorted set.
+    const KeyStringSet keySet(keys.begin(), keys.end());
 
     auto accessMethod = _indexCatalogEntry->accessMethod();
-    if (opType == Op::kInsert) {
+    if (op == Op::kInsert) {
+        // Multikey state is tracked through sideWrite() at write time, so applying many
+        // documents' keys at once must not feed the key count into multikey bookkeeping.
         InsertResult result;
-        auto status = accessMethod->insertKeys(opCtx,
-                                               {keySet.begin(), keySet.end()},
-                                               {},
-                                               MultikeyPaths{},
-                                               opRecordId,
-                                               options,
-                                               &result);
+        auto status = accessMethod->insertKeysNoMultikey(opCtx, keySet, options, &result);
         if (!status.isOK()) {
             return status;
         }
@@ -305,13 +328,14 @@ Status IndexBuildInterceptor::_applyWrite(OperationContext* opCtx,
         opCtx->recoveryUnit()->onRollback(
             [keysInserted, numInserted] { *keysInserted -= numInserted; });
     } else {
-        invariant(opType == Op::kDelete);
-        if (kDebugBuild)
-            invariant(strcmp(operation.getStringField("op"), "d") == 0);
+        invariant(op == Op::kDelete);
+
+        // The RecordId is only used for diagnostics on unindex failures.
+        const RecordId opRecordId =
+            KeyString::decodeRecordIdAtEnd(keys.front().getBuffer(), keys.front().getSize());
 
         int64_t numDeleted;
-        Status s = accessMethod->removeKeys(
-            opCtx, {keySet.begin(), keySet.end()}, opRecordId, options, &numDeleted);
+        Status s = accessMethod->removeKeys(opCtx, keySet, opRecordId, options, &numDeleted);
         if (!s.isOK()) {
             return s;
         }
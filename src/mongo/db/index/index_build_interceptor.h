@@ -159,12 +159,17 @@ public:
 private:
     using SideWriteRecord = std::pair<RecordId, BSONObj>;
 
-    Status _applyWrite(OperationContext* opCtx,
-                       const BSONObj& doc,
-                       const InsertDeleteOptions& options,
-                       TrackDuplicates trackDups,
-                       int64_t* const keysInserted,
-                       int64_t* const keysDeleted);
+    /**
+     * Applies a run of side-written keys that all share the same operation type to the index in a
+     * single access method call. The keys may come from many different documents.
+     */
+    Status _applyWrites(OperationContext* opCtx,
+                        Op op,
+                        const std::vector<KeyString::Value>& keys,
+                        const InsertDeleteOptions& options,
+                        TrackDuplicates trackDups,
+                        int64_t* const keysInserted,
+                        int64_t* const keysDeleted);
 
     /**
      * Yield lock manager locks and abandon the current storage engine snapshot.
@@ -46,8 +46,10 @@
 #include <unistd.h>
 #endif
 
+#include "mongo/base/counter.h"
 #include "mongo/base/init.h"
 #include "mongo/config.h"
+#include "mongo/db/commands/server_status_metric.h"
 #include "mongo/db/server_options.h"
 #include "mongo/logger/console_appender.h"
 #include "mongo/logger/logger.h"
@@ -295,6 +297,11 @@ void forkServerOrDie() {
         quickExit(EXIT_FAILURE);
 }
 
+namespace {
+ServerStatusMetricField<Counter64> displayAsyncLogQueueDropped(
+    "logging.asyncQueueDroppedRecords", &logv2::LogDomainGlobal::asyncQueueDroppedRecords());
+}  // namespace
+
 MONGO_INITIALIZER_GENERAL(ServerLogRedirection,
                           ("GlobalLogManager", "EndStartupOptionHandling", "ForkServer"),
                           ("default"))
@@ -376,6 +383,8 @@ MONGO_INITIALIZER_GENERAL(ServerLogRedirection,
         lv2Config.fileOpenMode = serverGlobalParams.logAppend
             ? logv2::LogDomainGlobal::ConfigurationOptions::OpenMode::kAppend
             : logv2::LogDomainGlobal::ConfigurationOptions::OpenMode::kTruncate;
+        lv2Config.fileAsync = gAsyncLogFile;
+        lv2Config.fileAsyncBlockOnFull = gAsyncLogFileBlockOnFull;
 
         if (serverGlobalParams.logAppend && exists) {
             writeServerRestartedAfterLogConfig = true;
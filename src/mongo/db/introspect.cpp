@@ -33,6 +33,8 @@
 
 #include "mongo/db/introspect.h"
 
+#include <algorithm>
+
 #include "mongo/bson/util/builder.h"
 #include "mongo/db/auth/authorization_manager.h"
 #include "mongo/db/auth/authorization_session.h"
@@ -41,11 +43,14 @@
 #include "mongo/db/client.h"
 #include "mongo/db/curop.h"
 #include "mongo/db/db_raii.h"
+#include "mongo/db/introspect_gen.h"
 #include "mongo/db/jsobj.h"
+#include "mongo/db/profile_memory_sink.h"
 #include "mongo/logv2/log.h"
 #include "mongo/rpc/metadata/client_metadata.h"
 #include "mongo/rpc/metadata/client_metadata_ismaster.h"
 #include "mongo/util/scopeguard.h"
+#include "mongo/util/string_map.h"
 
 namespace mongo {
 
@@ -80,6 +85,51 @@ void _appendUserInfo(const CurOp& c, BSONObjBuilder& builder, AuthorizationSessi
     builder.append("user", bestUser.getUser().empty() ? "" : bestUser.getFullName());
 }
 
+/**
+ * Per-namespace token buckets limiting how many operations faster than
+ * 'slowms' are profiled per second for each namespace, so a hot collection
+ * cannot crowd out profile entries from the rest of the workload. Slow
+ * operations bypass the budget entirely.
+ */
+class ProfileSampleBudget {
+public:
+    bool tryAcquire(const std::string& ns, int budget) {
+        const Date_t now = jsTime();
+        stdx::lock_guard<Latch> lk(_mutex);
+        // The map only grows while namespaces are being profiled; reset it if
+        // an unusual workload (e.g. many short-lived collections) lets it get
+        // large.
+        if (_buckets.size() > kMaxBuckets)
+            _buckets.clear();
+        auto& bucket = _buckets[ns];
+        if (bucket.lastRefill == Date_t()) {
+            bucket.tokens = budget;
+        } else {
+            const auto elapsed = durationCount<Milliseconds>(now - bucket.lastRefill);
+            bucket.tokens = std::min(static_cast<double>(budget),
+                                     bucket.tokens + budget * elapsed / 1000.0);
+        }
+        bucket.lastRefill = now;
+        if (bucket.tokens < 1.0)
+            return false;
+        bucket.tokens -= 1.0;
+        return true;
+    }
+
+private:
+    struct Bucket {
+        double tokens = 0.0;
+        Date_t lastRefill;
+    };
+
+    static constexpr size_t kMaxBuckets = 10000;
+
+    Mutex _mutex = MONGO_MAKE_LATCH("ProfileSampleBudget::_mutex");
+    StringMap<Bucket> _buckets;
+};
+
+ProfileSampleBudget profileSampleBudget;
+
 }  // namespace
 
 
@@ -115,6 +165,26 @@ void profile(OperationContext* opCtx, NetworkOp op) {
 
     const string dbName(nsToDatabase(CurOp::get(opCtx)->getNS()));
 
+    // Per-namespace adaptive sampling: when a budget is configured, operations
+    // faster than 'slowms' are admitted at most 'profilingAdaptiveSampleBudget'
+    // times per second for each namespace. Slow operations always pass.
+    const int sampleBudget = gProfilingAdaptiveSampleBudget.load();
+    if (sampleBudget > 0 &&
+        CurOp::get(opCtx)->elapsedTimeExcludingPauses() <
+            Milliseconds{serverGlobalParams.slowMS} &&
+        !profileSampleBudget.tryAcquire(CurOp::get(opCtx)->getNS(), sampleBudget)) {
+        return;
+    }
+
+    // With the in-memory sink enabled the entry is buffered in memory instead
+    // of being written to system.profile, so profiling takes no collection
+    // locks and does no storage writes.
+    auto& memorySink = ProfileMemorySink::get();
+    if (memorySink.enabled()) {
+        memorySink.append(dbName, p);
+        return;
+    }
+
     auto origFlowControl = opCtx->shouldParticipateInFlowControl();
 
     // The system.profile collection is non-replicated, so writes to it do not cause
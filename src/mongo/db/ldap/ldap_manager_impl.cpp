@@ -47,42 +47,107 @@ namespace mongo {
 
 using namespace fmt::literals;
 
-LDAPManagerImpl::LDAPManagerImpl() = default;
+namespace {
 
-LDAPManagerImpl::~LDAPManagerImpl() {
-    if (_ldap) {
-        ldap_unbind_ext(_ldap, nullptr, nullptr);
-        _ldap = nullptr;
+timeval ldapTimeout() {
+    const Milliseconds timeout{ldapGlobalParams.ldapTimeoutMS.load()};
+    timeval tv;
+    tv.tv_sec = durationCount<Seconds>(timeout);
+    tv.tv_usec = durationCount<Microseconds>(timeout) % 1000000;
+    return tv;
+}
+
+// Errors indicating the connection itself is unusable (as opposed to the
+// query failing); such connections must not go back into the pool.
+bool connectionBroken(int res) {
+    return res == LDAP_SERVER_DOWN || res == LDAP_CONNECT_ERROR || res == LDAP_UNAVAILABLE ||
+        res == LDAP_TIMEOUT;
+}
+
+}  // namespace
+
+LDAPConnectionPool::~LDAPConnectionPool() {
+    for (auto ld : _idle) {
+        ldap_unbind_ext(ld, nullptr, nullptr);
     }
 }
 
-Status LDAPManagerImpl::initialize() {
-    int res = LDAP_OTHER;
+StatusWith<LDAP*> LDAPConnectionPool::_connect() {
+    LDAP* ld = nullptr;
     const char* ldapprot = "ldaps";
     if (ldapGlobalParams.ldapTransportSecurity == "none")
         ldapprot = "ldap";
     auto uri = "{}://{}/"_format(ldapprot, ldapGlobalParams.ldapServers.get());
-    res = ldap_initialize(&_ldap, uri.c_str());
+    int res = ldap_initialize(&ld, uri.c_str());
     if (res != LDAP_SUCCESS) {
         return Status(ErrorCodes::LDAPLibraryError,
                       "Cannot initialize LDAP structure for {}; LDAP error: {}"_format(
                           uri, ldap_err2string(res)));
     }
+    auto unbindGuard = makeGuard([&] { ldap_unbind_ext(ld, nullptr, nullptr); });
     const int ldap_version = LDAP_VERSION3;
-    res = ldap_set_option(_ldap, LDAP_OPT_PROTOCOL_VERSION, &ldap_version);
+    res = ldap_set_option(ld, LDAP_OPT_PROTOCOL_VERSION, &ldap_version);
     if (res != LDAP_OPT_SUCCESS) {
         return Status(ErrorCodes::LDAPLibraryError,
                       "Cannot set LDAP version option; LDAP error: {}"_format(
                           ldap_err2string(res)));
     }
+    // Bound waits on connect and on each operation; without these an
+    // unresponsive LDAP server blocks authorization threads indefinitely.
+    timeval tv = ldapTimeout();
+    ldap_set_option(ld, LDAP_OPT_NETWORK_TIMEOUT, &tv);
+    ldap_set_option(ld, LDAP_OPT_TIMEOUT, &tv);
+
+    auto status = LDAPbind(ld,
+                           ldapGlobalParams.ldapQueryUser.get(),
+                           ldapGlobalParams.ldapQueryPassword.get());
+    if (!status.isOK())
+        return status;
+    unbindGuard.dismiss();
+    return ld;
+}
 
-    return LDAPbind(_ldap,
-                    ldapGlobalParams.ldapQueryUser.get(),
-                    ldapGlobalParams.ldapQueryPassword.get());
+StatusWith<LDAP*> LDAPConnectionPool::acquire() {
+    {
+        stdx::lock_guard<Latch> lk(_mutex);
+        if (!_idle.empty()) {
+            LDAP* ld = _idle.back();
+            _idle.pop_back();
+            return ld;
+        }
+    }
+    return _connect();
+}
+
+void LDAPConnectionPool::release(LDAP* ld, bool broken) {
+    if (!ld)
+        return;
+    if (!broken && ldapGlobalParams.ldapUseConnectionPool) {
+        stdx::lock_guard<Latch> lk(_mutex);
+        if (_idle.size() < kMaxIdleConnections) {
+            _idle.push_back(ld);
+            return;
+        }
+    }
+    ldap_unbind_ext(ld, nullptr, nullptr);
+}
+
+LDAPManagerImpl::LDAPManagerImpl() = default;
+
+LDAPManagerImpl::~LDAPManagerImpl() = default;
+
+Status LDAPManagerImpl::initialize() {
+    // Establish and bind the first connection to validate the configuration;
+    // it stays in the pool for subsequent queries.
+    auto swConn = _pool.acquire();
+    if (!swConn.isOK())
+        return swConn.getStatus();
+    _pool.release(swConn.getValue());
+    return Status::OK();
 }
 
 Status LDAPManagerImpl::execQuery(std::string& ldapurl, std::vector<std::string>& results) {
-    timeval tv;
+    timeval tv = ldapTimeout();
     LDAPMessage*answer = nullptr;
     LDAPURLDesc *ludp{nullptr};
     int res = ldap_url_parse(ldapurl.c_str(), &ludp);
@@ -101,13 +166,38 @@ Status LDAPManagerImpl::execQuery(std::string& ldapurl, std::vector<std::string>
             "scope"_attr = ludp->lud_scope,
             "dn"_attr = ludp->lud_dn ? ludp->lud_dn : "nullptr",
             "filter"_attr = ludp->lud_filter ? ludp->lud_filter : "nullptr");
-    res = ldap_search_ext_s(_ldap,
+    auto swConn = _pool.acquire();
+    if (!swConn.isOK())
+        return swConn.getStatus();
+    LDAP* ld = swConn.getValue();
+    ON_BLOCK_EXIT([&] { _pool.release(ld, connectionBroken(res)); });
+
+    res = ldap_search_ext_s(ld,
             ludp->lud_dn,
             ludp->lud_scope,
             ludp->lud_filter,
             ludp->lud_attrs,
             0, // attrsonly (0 => attrs and values)
             nullptr, nullptr, &tv, 0, &answer);
+    if (connectionBroken(res)) {
+        // A pooled connection may have been closed by the server while it
+        // was idle; retry once on a fresh connection.
+        _pool.release(ld, true);
+        ld = nullptr;
+        ldap_msgfree(answer);
+        answer = nullptr;
+        swConn = _pool.acquire();
+        if (!swConn.isOK())
+            return swConn.getStatus();
+        ld = swConn.getValue();
+        res = ldap_search_ext_s(ld,
+                ludp->lud_dn,
+                ludp->lud_scope,
+                ludp->lud_filter,
+                ludp->lud_attrs,
+                0, // attrsonly (0 => attrs and values)
+                nullptr, nullptr, &tv, 0, &answer);
+    }
     ON_BLOCK_EXIT([&] { ldap_msgfree(answer); });
     if (res != LDAP_SUCCESS) {
         return Status(ErrorCodes::LDAPLibraryError,
@@ -115,14 +205,14 @@ Status LDAPManagerImpl::execQuery(std::string& ldapurl, std::vector<std::string>
                           ldap_err2string(res)));
     }
 
-    auto entry = ldap_first_entry(_ldap, answer);
+    auto entry = ldap_first_entry(ld, answer);
     while (entry) {
         if (entitiesonly) {
-            auto dn = ldap_get_dn(_ldap, entry);
+            auto dn = ldap_get_dn(ld, entry);
             ON_BLOCK_EXIT([&] { ldap_memfree(dn); });
             if (!dn) {
                 int ld_errno = 0;
-                ldap_get_option(_ldap, LDAP_OPT_RESULT_CODE, &ld_errno);
+                ldap_get_option(ld, LDAP_OPT_RESULT_CODE, &ld_errno);
                 return Status(ErrorCodes::LDAPLibraryError,
                               "Failed to get DN from LDAP query result: {}"_format(
                                   ldap_err2string(ld_errno)));
@@ -130,12 +220,12 @@ Status LDAPManagerImpl::execQuery(std::string& ldapurl, std::vector<std::string>
             results.emplace_back(dn);
         } else {
             BerElement *ber = nullptr;
-            auto attribute = ldap_first_attribute(_ldap, entry, &ber);
+            auto attribute = ldap_first_attribute(ld, entry, &ber);
             ON_BLOCK_EXIT([&] { ber_free(ber, 0); });
             while (attribute) {
                 ON_BLOCK_EXIT([&] { ldap_memfree(attribute); });
 
-                auto const values = ldap_get_values_len(_ldap, entry, attribute);
+                auto const values = ldap_get_values_len(ld, entry, attribute);
                 ON_BLOCK_EXIT([&] { ldap_value_free_len(values); });
                 if (values) {
                     auto curval = values;
@@ -144,10 +234,10 @@ Status LDAPManagerImpl::execQuery(std::string& ldapurl, std::vector<std::string>
                         ++curval;
                     }
                 }
-                attribute = ldap_next_attribute(_ldap, entry, ber);
+                attribute = ldap_next_attribute(ld, entry, ber);
             }
         }
-        entry = ldap_next_entry(_ldap, entry);
+        entry = ldap_next_entry(ld, entry);
     }
     return Status::OK();
 }
@@ -224,6 +314,20 @@ Status LDAPManagerImpl::queryUserRoles(const UserName& userName, stdx::unordered
             return mapRes;
     }
 
+    const Seconds ttl{ldapGlobalParams.ldapUserCacheInvalidationInterval.load()};
+    const Date_t now = Date_t::now();
+    if (ttl > Seconds(0)) {
+        stdx::lock_guard<Latch> lk(_rolesCacheMutex);
+        auto it = _rolesCache.find(mappedUser);
+        if (it != _rolesCache.end()) {
+            if (now < it->second.expires) {
+                roles = it->second.roles;
+                return Status::OK();
+            }
+            _rolesCache.erase(it);
+        }
+    }
+
     auto ldapurl = fmt::format("ldap://{Servers}/{Query}",
             fmt::arg("Servers", ldapGlobalParams.ldapServers.get()),
             fmt::arg("Query", ldapGlobalParams.ldapQueryTemplate.get()));
@@ -237,6 +341,14 @@ Status LDAPManagerImpl::queryUserRoles(const UserName& userName, stdx::unordered
         for (auto& dn: qresult) {
             roles.insert(RoleName{dn, kAdmin});
         }
+        if (ttl > Seconds(0)) {
+            stdx::lock_guard<Latch> lk(_rolesCacheMutex);
+            // Drop expired entries so the cache cannot grow without bound.
+            for (auto it = _rolesCache.begin(); it != _rolesCache.end();) {
+                it = now >= it->second.expires ? _rolesCache.erase(it) : std::next(it);
+            }
+            _rolesCache[mappedUser] = {roles, now + ttl};
+        }
     }
     return status;
 }
@@ -35,8 +35,49 @@ Copyright (C) 2019-present Percona and/or its affiliates. All rights reserved.
 
 #include <ldap.h>
 
+#include <vector>
+
+#include "mongo/base/status_with.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/unordered_map.h"
+#include "mongo/util/time_support.h"
+
 namespace mongo {
 
+/**
+ * Pool of LDAP connections bound with the query user credentials. Reusing
+ * bound connections keeps connect and bind latency off the authorization
+ * path. Connections are created on demand with network and operation
+ * timeouts taken from ldapTimeoutMS, so an unresponsive LDAP server cannot
+ * stall callers indefinitely. When ldapUseConnectionPool is false every
+ * released connection is closed instead of being kept for reuse.
+ */
+class LDAPConnectionPool {
+public:
+    ~LDAPConnectionPool();
+
+    /**
+     * Returns a bound connection, reusing an idle one when possible.
+     */
+    StatusWith<LDAP*> acquire();
+
+    /**
+     * Returns a connection to the pool. Broken connections are closed and
+     * dropped instead of being reused.
+     */
+    void release(LDAP* ld, bool broken = false);
+
+private:
+    static StatusWith<LDAP*> _connect();
+
+    // Idle connections kept for reuse; connections released above this
+    // limit are closed.
+    static constexpr size_t kMaxIdleConnections = 4;
+
+    Mutex _mutex = MONGO_MAKE_LATCH("LDAPConnectionPool::_mutex");
+    std::vector<LDAP*> _idle;
+};
+
 class LDAPManagerImpl : public LDAPManager {
 public:
     LDAPManagerImpl();
@@ -49,7 +90,18 @@ public:
     virtual Status mapUserToDN(const std::string& user, std::string& out) override;
 
 private:
-    LDAP* _ldap{nullptr};
+    struct CachedRoles {
+        stdx::unordered_set<RoleName> roles;
+        Date_t expires;
+    };
+
+    LDAPConnectionPool _pool;
+
+    // Group membership query results keyed by the mapped user DN, valid for
+    // ldapUserCacheInvalidationInterval seconds. While an entry is fresh,
+    // re-authorization of the same user costs no LDAP round trips.
+    Mutex _rolesCacheMutex = MONGO_MAKE_LATCH("LDAPManagerImpl::_rolesCacheMutex");
+    stdx::unordered_map<std::string, CachedRoles> _rolesCache;
 
     Status execQuery(std::string& ldapurl, std::vector<std::string>& results);
 };
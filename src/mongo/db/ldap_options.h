@@ -57,7 +57,7 @@ struct LDAPGlobalParams {
     synchronized_value<std::string> ldapQueryUser;
     synchronized_value<std::string> ldapQueryPassword;
     synchronized_value<std::string> ldapUserToDNMapping;
-    bool ldapUseConnectionPool;
+    bool ldapUseConnectionPool = true;
     AtomicWord<int> ldapUserCacheInvalidationInterval;
     synchronized_value<std::string> ldapQueryTemplate;
 
@@ -309,12 +309,46 @@ void LogicalSessionCacheImpl::_refresh(Client* client) {
         activeSessionRecords.insert(it.second);
     }
 
+    // In incremental mode, skip records which were already written during the current wall-clock
+    // bucket; their lastUse in the sessions collection is recent enough that rewriting it would
+    // only bump the TTL by a fraction of a bucket.
+    const long long writeBucketMillis = logicalSessionWriteBucketMillis;
+    const long long currentBucket =
+        writeBucketMillis > 0 ? _service->now().toMillisSinceEpoch() / writeBucketMillis : 0;
+    if (writeBucketMillis > 0) {
+        stdx::lock_guard<Latch> lk(_mutex);
+        for (auto it = activeSessionRecords.begin(); it != activeSessionRecords.end();) {
+            auto bucketIt = _lastWrittenBuckets.find(it->getId());
+            if (bucketIt != _lastWrittenBuckets.end() && bucketIt->second == currentBucket) {
+                it = activeSessionRecords.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
     // Refresh the active sessions in the sessions collection.
     _sessionsColl->refreshSessions(opCtx, activeSessionRecords);
     activeSessionsBackSwapper.dismiss();
     {
         stdx::lock_guard<Latch> lk(_mutex);
         _stats.setLastSessionsCollectionJobEntriesRefreshed(activeSessionRecords.size());
+
+        if (writeBucketMillis > 0) {
+            for (const auto& record : activeSessionRecords) {
+                _lastWrittenBuckets[record.getId()] = currentBucket;
+            }
+
+            // Sessions which were not written during the current bucket have not been active
+            // since the previous one, so their entries are no longer needed.
+            for (auto it = _lastWrittenBuckets.begin(); it != _lastWrittenBuckets.end();) {
+                if (it->second != currentBucket) {
+                    it = _lastWrittenBuckets.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
     }
 
     // Remove the ending sessions from the sessions collection.
@@ -323,6 +357,12 @@ void LogicalSessionCacheImpl::_refresh(Client* client) {
     {
         stdx::lock_guard<Latch> lk(_mutex);
         _stats.setLastSessionsCollectionJobEntriesEnded(explicitlyEndingSessions.size());
+
+        // An ended session must be written out again if it is recreated, even within the same
+        // bucket its record was last written in.
+        for (const auto& lsid : explicitlyEndingSessions) {
+            _lastWrittenBuckets.erase(lsid);
+        }
     }
 
     // Find which running, but not recently active sessions, are expired, and add them
@@ -114,6 +114,12 @@ private:
 
     LogicalSessionIdSet _endingSessions;
 
+    // When incremental refresh is enabled (logicalSessionWriteBucketMillis > 0), tracks the
+    // wall-clock bucket in which each session record was last successfully written to the
+    // sessions collection, so refreshes can skip records whose bucket has not changed. Entries
+    // from earlier buckets are pruned during each refresh.
+    LogicalSessionIdMap<long long> _lastWrittenBuckets;
+
     Date_t _lastRefreshTime;
 
     LogicalSessionCacheStats _stats;
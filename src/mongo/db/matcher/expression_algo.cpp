@@ -370,6 +370,49 @@ bool hasExistencePredicateOnPath(const MatchExpression& expr, StringData path) {
     return false;
 }
 
+bool dependsOnlyOnDocumentShape(const MatchExpression& expr) {
+    switch (expr.matchType()) {
+        // Connectives and expressions which apply their children to parts of the document: shape
+        // dependent iff every child is.
+        case MatchExpression::AND:
+        case MatchExpression::OR:
+        case MatchExpression::NOR:
+        case MatchExpression::NOT:
+        case MatchExpression::ELEM_MATCH_OBJECT:
+        case MatchExpression::ELEM_MATCH_VALUE:
+        case MatchExpression::INTERNAL_SCHEMA_ALLOWED_PROPERTIES:
+        case MatchExpression::INTERNAL_SCHEMA_ALL_ELEM_MATCH_FROM_INDEX:
+        case MatchExpression::INTERNAL_SCHEMA_COND:
+        case MatchExpression::INTERNAL_SCHEMA_MATCH_ARRAY_INDEX:
+        case MatchExpression::INTERNAL_SCHEMA_OBJECT_MATCH:
+        case MatchExpression::INTERNAL_SCHEMA_XOR:
+            for (size_t i = 0; i < expr.numChildren(); i++) {
+                if (!dependsOnlyOnDocumentShape(*expr.getChild(i))) {
+                    return false;
+                }
+            }
+            return true;
+
+        // Predicates on existence, type, array length, and property count. These observe only the
+        // structure of the document, never the values within it.
+        case MatchExpression::ALWAYS_FALSE:
+        case MatchExpression::ALWAYS_TRUE:
+        case MatchExpression::EXISTS:
+        case MatchExpression::SIZE:
+        case MatchExpression::TYPE_OPERATOR:
+        case MatchExpression::INTERNAL_SCHEMA_MAX_ITEMS:
+        case MatchExpression::INTERNAL_SCHEMA_MAX_PROPERTIES:
+        case MatchExpression::INTERNAL_SCHEMA_MIN_ITEMS:
+        case MatchExpression::INTERNAL_SCHEMA_MIN_PROPERTIES:
+        case MatchExpression::INTERNAL_SCHEMA_TYPE:
+            return true;
+
+        // Everything else compares against values.
+        default:
+            return false;
+    }
+}
+
 bool isSubsetOf(const MatchExpression* lhs, const MatchExpression* rhs) {
     invariant(lhs);
     invariant(rhs);
@@ -52,6 +52,16 @@ using NodeTraversalFunc = std::function<void(MatchExpression*, std::string)>;
  */
 bool hasExistencePredicateOnPath(const MatchExpression& expr, StringData path);
 
+/**
+ * Returns true if the outcome of 'expr' is fully determined by the shape of the input document —
+ * its field names, the BSON types of their values, and the structure of nested objects and arrays
+ * — and never by the values themselves. Two documents with identical shape are indistinguishable
+ * to such an expression, so its verdict can be cached per shape. Type, existence, and
+ * property/item-count predicates qualify; anything comparing values (equality, ranges, regexes,
+ * string lengths, $expr, ...) does not.
+ */
+bool dependsOnlyOnDocumentShape(const MatchExpression& expr);
+
 /**
  * Returns true if the documents matched by 'lhs' are a subset of the documents matched by
  * 'rhs', i.e. a document matched by 'lhs' must also be matched by 'rhs', and false otherwise.
@@ -1344,4 +1344,60 @@ TEST(HasExistencePredicateOnPath, ReturnsFalseWhenExistsOnSubpath) {
         expression::hasExistencePredicateOnPath(*swMatchExpression.getValue().get(), "a"_sd));
 }
 
+TEST(DependsOnlyOnDocumentShape, TypeExistenceAndSizePredicatesDependOnlyOnShape) {
+    ParsedMatchExpression exists("{a: {$exists: true}}");
+    ASSERT_TRUE(expression::dependsOnlyOnDocumentShape(*exists.get()));
+
+    ParsedMatchExpression type("{a: {$type: 'long'}}");
+    ASSERT_TRUE(expression::dependsOnlyOnDocumentShape(*type.get()));
+
+    ParsedMatchExpression size("{a: {$size: 2}}");
+    ASSERT_TRUE(expression::dependsOnlyOnDocumentShape(*size.get()));
+
+    ParsedMatchExpression combined(
+        "{$and: [{a: {$exists: true}}, {$or: [{b: {$type: 'string'}}, {c: {$size: 0}}]}]}");
+    ASSERT_TRUE(expression::dependsOnlyOnDocumentShape(*combined.get()));
+}
+
+TEST(DependsOnlyOnDocumentShape, ValueComparisonsDependOnMoreThanShape) {
+    ParsedMatchExpression eq("{a: 5}");
+    ASSERT_FALSE(expression::dependsOnlyOnDocumentShape(*eq.get()));
+
+    ParsedMatchExpression gt("{a: {$gt: 5}}");
+    ASSERT_FALSE(expression::dependsOnlyOnDocumentShape(*gt.get()));
+
+    ParsedMatchExpression regex("{a: {$regex: 'x'}}");
+    ASSERT_FALSE(expression::dependsOnlyOnDocumentShape(*regex.get()));
+
+    ParsedMatchExpression buriedUnderConnectives(
+        "{$and: [{a: {$exists: true}}, {$or: [{b: {$type: 16}}, {c: 3}]}]}");
+    ASSERT_FALSE(expression::dependsOnlyOnDocumentShape(*buriedUnderConnectives.get()));
+}
+
+TEST(DependsOnlyOnDocumentShape, ElemMatchDependsOnItsSubExpression) {
+    ParsedMatchExpression shapeOnly("{a: {$elemMatch: {b: {$type: 'string'}}}}");
+    ASSERT_TRUE(expression::dependsOnlyOnDocumentShape(*shapeOnly.get()));
+
+    ParsedMatchExpression valueDependent("{a: {$elemMatch: {b: {$gt: 3}}}}");
+    ASSERT_FALSE(expression::dependsOnlyOnDocumentShape(*valueDependent.get()));
+}
+
+TEST(DependsOnlyOnDocumentShape, TypeAndRequiredJSONSchemaDependsOnlyOnShape) {
+    ParsedMatchExpression schema(
+        "{$jsonSchema: {required: ['a', 'b'], properties: {a: {type: 'string'}, b: {type: "
+        "'object', required: ['c']}}}}");
+    ASSERT_TRUE(expression::dependsOnlyOnDocumentShape(*schema.get()));
+}
+
+TEST(DependsOnlyOnDocumentShape, JSONSchemaWithValueConstraintsDependsOnMoreThanShape) {
+    ParsedMatchExpression minimum("{$jsonSchema: {properties: {a: {minimum: 5}}}}");
+    ASSERT_FALSE(expression::dependsOnlyOnDocumentShape(*minimum.get()));
+
+    ParsedMatchExpression maxLength("{$jsonSchema: {properties: {a: {maxLength: 5}}}}");
+    ASSERT_FALSE(expression::dependsOnlyOnDocumentShape(*maxLength.get()));
+
+    ParsedMatchExpression enumSchema("{$jsonSchema: {properties: {a: {enum: [1, 2]}}}}");
+    ASSERT_FALSE(expression::dependsOnlyOnDocumentShape(*enumSchema.get()));
+}
+
 }  // namespace mongo
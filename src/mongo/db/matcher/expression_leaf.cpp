@@ -31,6 +31,7 @@
 
 #include "mongo/db/matcher/expression_leaf.h"
 
+#include <algorithm>
 #include <cmath>
 #include <memory>
 #include <pcrecpp.h>
@@ -197,6 +198,110 @@ constexpr StringData LTEMatchExpression::kName;
 constexpr StringData GTMatchExpression::kName;
 constexpr StringData GTEMatchExpression::kName;
 
+namespace {
+/**
+ * Extracts the longest substring that must appear, contiguously, in any string matching 'regex'.
+ * Returns an empty string when no such substring can be proven. The result is used as a cheap
+ * prefilter: candidate strings that do not contain it can be rejected without invoking pcre.
+ *
+ * The extraction is deliberately conservative. It only needs to be sound (never claim a substring
+ * is required when it is not), so any construct whose effect on the match is unclear simply ends
+ * the current literal run or abandons extraction altogether.
+ */
+std::string extractRequiredSubstring(const std::string& regex, const std::string& flags) {
+    // Case-insensitive matching would require a case-folded scan, and free-spacing mode changes
+    // which characters are literal. Neither is worth handling here.
+    if (flags.find('i') != std::string::npos || flags.find('x') != std::string::npos) {
+        return "";
+    }
+
+    std::string best;
+    std::string run;
+    auto endRun = [&] {
+        if (run.size() > best.size()) {
+            best = run;
+        }
+        run.clear();
+    };
+
+    const char* p = regex.c_str();
+    while (*p) {
+        char c = *(p++);
+        switch (c) {
+            case '|':
+            case '(':
+            case ')':
+            case '[':
+            case ']':
+                // Alternation and groups can make any part of the pattern optional in ways that
+                // are hard to reason about locally; give up entirely.
+                return "";
+            case '*':
+            case '?':
+                // The preceding character may match zero times, so it is not required.
+                if (!run.empty()) {
+                    run.pop_back();
+                }
+                endRun();
+                break;
+            case '+':
+                // The preceding character is required, but its repetitions break contiguity with
+                // whatever follows.
+                endRun();
+                break;
+            case '{':
+                // A counted repetition may have a zero lower bound; conservatively treat the
+                // preceding character as optional and skip the quantifier body.
+                if (!run.empty()) {
+                    run.pop_back();
+                }
+                endRun();
+                while (*p && *p != '}') {
+                    ++p;
+                }
+                if (*p) {
+                    ++p;
+                }
+                break;
+            case '^':
+            case '$':
+            case '.':
+                endRun();
+                break;
+            case '\\':
+                c = *(p++);
+                if (c == 'Q') {
+                    // \Q...\E quotes everything inside.
+                    while (*p) {
+                        c = *(p++);
+                        if (c == '\\' && *p == 'E') {
+                            ++p;
+                            break;
+                        }
+                        run += c;
+                    }
+                } else if ((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') ||
+                           (c >= '0' && c <= '9') || c == '\0') {
+                    // Character class shortcut, anchor, backreference, or a trailing backslash;
+                    // none of these match a single known character.
+                    endRun();
+                    if (c == '\0') {
+                        --p;
+                    }
+                } else {
+                    // A backslash followed by a non-alphanumeric matches that character itself.
+                    run += c;
+                }
+                break;
+            default:
+                run += c;
+        }
+    }
+    endRun();
+    return best;
+}
+}  // namespace
+
 const std::set<char> RegexMatchExpression::kValidRegexFlags = {'i', 'm', 's', 'x'};
 
 RegexMatchExpression::RegexMatchExpression(StringData path, const BSONElement& e)
@@ -228,6 +333,8 @@ void RegexMatchExpression::_init() {
     uassert(51091,
             str::stream() << "Regular expression is invalid: " << _re->error(),
             _re->error().empty());
+
+    _prefilterLiteral = extractRequiredSubstring(_regex, _flags);
 }
 
 RegexMatchExpression::~RegexMatchExpression() {}
@@ -249,6 +356,19 @@ bool RegexMatchExpression::matchesSingleElement(const BSONElement& e, MatchDetai
             // pcrecpp::StringPiece instance using the full length of the string to avoid truncating
             // 'data' early.
             pcrecpp::StringPiece data(e.valuestr(), e.valuestrsize() - 1);
+
+            // Any match must contain '_prefilterLiteral', so a plain substring scan can reject
+            // most non-matching candidates far more cheaply than a pcre execution.
+            if (!_prefilterLiteral.empty()) {
+                const char* begin = data.data();
+                const char* end = begin + data.size();
+                if (std::search(begin,
+                                end,
+                                _prefilterLiteral.begin(),
+                                _prefilterLiteral.end()) == end) {
+                    return false;
+                }
+            }
             return _re->PartialMatch(data);
         }
         case RegEx:
@@ -376,6 +496,9 @@ std::unique_ptr<MatchExpression> InMatchExpression::shallowClone() const {
     next->_hasEmptyArray = _hasEmptyArray;
     next->_equalitySet = _equalitySet;
     next->_originalEqualityVector = _originalEqualityVector;
+    // The hash set's functors are bound to this instance's comparator, so the clone must build its
+    // own against its own '_eltCmp'.
+    next->buildHashedEqualitySet();
     for (auto&& regex : _regexes) {
         std::unique_ptr<RegexMatchExpression> clonedRegex(
             static_cast<RegexMatchExpression*>(regex->shallowClone().release()));
@@ -384,10 +507,32 @@ std::unique_ptr<MatchExpression> InMatchExpression::shallowClone() const {
     return std::move(next);
 }
 
+namespace {
+// Only build a hashed equality set for $in lists at least this large. For smaller lists binary
+// search is as fast as a hash probe, and skipping the table avoids paying its construction cost
+// when the expression is only used for things like index bounds building.
+constexpr size_t kMinEqualitiesForHashedLookup = 16;
+}  // namespace
+
 bool InMatchExpression::contains(const BSONElement& e) const {
+    if (_equalityHashSet) {
+        return _equalityHashSet->find(e) != _equalityHashSet->end();
+    }
     return std::binary_search(_equalitySet.begin(), _equalitySet.end(), e, _eltCmp.makeLessThan());
 }
 
+void InMatchExpression::buildHashedEqualitySet() {
+    _equalityHashSet = boost::none;
+    if (_equalitySet.size() < kMinEqualitiesForHashedLookup) {
+        return;
+    }
+
+    auto hashSet = _eltCmp.makeBSONEltUnorderedSet();
+    hashSet.reserve(_equalitySet.size());
+    hashSet.insert(_equalitySet.begin(), _equalitySet.end());
+    _equalityHashSet = std::move(hashSet);
+}
+
 bool InMatchExpression::matchesSingleElement(const BSONElement& e, MatchDetails* details) const {
     if (_hasNull && e.eoo()) {
         return true;
@@ -496,6 +641,8 @@ void InMatchExpression::_doSetCollator(const CollatorInterface* collator) {
                      _originalEqualityVector.end(),
                      std::back_inserter(_equalitySet),
                      _eltCmp.makeEqualTo());
+
+    buildHashedEqualitySet();
 }
 
 Status InMatchExpression::setEqualities(std::vector<BSONElement> equalities) {
@@ -530,6 +677,8 @@ Status InMatchExpression::setEqualities(std::vector<BSONElement> equalities) {
                      std::back_inserter(_equalitySet),
                      _eltCmp.makeEqualTo());
 
+    buildHashedEqualitySet();
+
     return Status::OK();
 }
 
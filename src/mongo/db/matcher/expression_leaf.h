@@ -337,6 +337,10 @@ private:
     std::string _regex;
     std::string _flags;
     std::unique_ptr<pcrecpp::RE> _re;
+
+    // A substring that every matching string must contain, or empty if none could be derived
+    // from the pattern. Used to cheaply reject candidates before running pcre.
+    std::string _prefilterLiteral;
 };
 
 class ModMatchExpression : public LeafMatchExpression {
@@ -453,6 +457,13 @@ public:
 private:
     ExpressionOptimizerFunc getOptimizer() const final;
 
+    /**
+     * Rebuilds '_equalityHashSet' from '_equalitySet'. Only large equality lists get a hash set;
+     * see the comment on '_equalityHashSet'. Must be called whenever '_equalitySet' or '_eltCmp'
+     * changes.
+     */
+    void buildHashedEqualitySet();
+
     // Whether or not '_equalities' has a jstNULL element in it.
     bool _hasNull = false;
 
@@ -473,13 +484,17 @@ private:
     std::vector<BSONElement> _originalEqualityVector;
 
     // Deduped set of equality elements associated with this expression. Kept in sorted order to
-    // support std::binary_search. Because we need to sort the elements anyway for things like index
-    // bounds building, using binary search avoids the overhead of inserting into a hash table which
-    // doesn't pay for itself in the common case where lookups are done a few times if ever.
-    // TODO It may be worth dynamically creating a hashset after matchesSingleElement() has been
-    // called "many" times.
+    // support std::binary_search and because index bounds building needs the elements sorted
+    // anyway. Large lists additionally get a hashed copy in '_equalityHashSet' below.
     std::vector<BSONElement> _equalitySet;
 
+    // Hashed copy of '_equalitySet', used by contains() instead of binary search when the list of
+    // equalities is large enough that probing it dominates the cost of matching. Lookups in large
+    // $in lists are then a single hash probe instead of O(log n) full element comparisons. Not
+    // populated for small lists, where binary search is as fast as a hash probe and building the
+    // table would not pay for itself if the expression is only used to generate index bounds.
+    boost::optional<BSONEltUnorderedSet> _equalityHashSet;
+
     // Container of regex elements this object owns.
     std::vector<std::unique_ptr<RegexMatchExpression>> _regexes;
 };
@@ -1014,6 +1014,41 @@ TEST(RegexMatchExpression, RegexAcceptsLFOption) {
                                      << "a\rb")));
 }
 
+TEST(RegexMatchExpression, MatchesWithRequiredLiteralPrefilter) {
+    // Patterns with an embedded literal take a substring-prescan fast path; matching semantics
+    // must be unchanged.
+    RegexMatchExpression regex("a", "error: .*timeout", "");
+    ASSERT(regex.matchesBSON(BSON("a" << "error: connection timeout")));
+    ASSERT(!regex.matchesBSON(BSON("a" << "warning: connection timeout")));
+    ASSERT(!regex.matchesBSON(BSON("a" << "error: connection reset")));
+}
+
+TEST(RegexMatchExpression, PrefilterHonorsOptionalQuantifiers) {
+    // 'b' may match zero times, so only "a" and "c" are required.
+    RegexMatchExpression regex("a", "ab?cd", "");
+    ASSERT(regex.matchesBSON(BSON("a" << "xacdx")));
+    ASSERT(regex.matchesBSON(BSON("a" << "xabcdx")));
+    ASSERT(!regex.matchesBSON(BSON("a" << "xabdx")));
+
+    RegexMatchExpression starRegex("a", "ab*cd", "");
+    ASSERT(starRegex.matchesBSON(BSON("a" << "acd")));
+    ASSERT(starRegex.matchesBSON(BSON("a" << "abbbcd")));
+
+    RegexMatchExpression countedRegex("a", "ab{0,2}cd", "");
+    ASSERT(countedRegex.matchesBSON(BSON("a" << "acd")));
+    ASSERT(countedRegex.matchesBSON(BSON("a" << "abbcd")));
+}
+
+TEST(RegexMatchExpression, PrefilterHonorsEscapesAndQuoting) {
+    RegexMatchExpression escapedRegex("a", "foo\\.bar", "");
+    ASSERT(escapedRegex.matchesBSON(BSON("a" << "xfoo.barx")));
+    ASSERT(!escapedRegex.matchesBSON(BSON("a" << "fooxbar")));
+
+    RegexMatchExpression quotedRegex("a", "\\Qa+b\\E\\d", "");
+    ASSERT(quotedRegex.matchesBSON(BSON("a" << "a+b1")));
+    ASSERT(!quotedRegex.matchesBSON(BSON("a" << "ab1")));
+}
+
 TEST(ModMatchExpression, MatchesElement) {
     BSONObj match = BSON("a" << 1);
     BSONObj largerMatch = BSON("a" << 4.0);
@@ -1370,6 +1405,52 @@ TEST(InMatchExpression, ChangingCollationAfterAddingEqualitiesPreservesEqualitie
     ASSERT(in.contains(obj2.firstElement()));
 }
 
+TEST(InMatchExpression, LargeEqualityListUsesHashedLookup) {
+    // Large lists take the hashed lookup path in contains(); make sure it agrees with binary
+    // search semantics, including type-insensitive numeric equality.
+    BSONArrayBuilder bab;
+    for (int i = 0; i < 100; i++) {
+        bab.append(i * 2);
+    }
+    BSONArray operand = bab.arr();
+
+    InMatchExpression in("");
+    std::vector<BSONElement> equalities;
+    for (const auto& elt : operand) {
+        equalities.push_back(elt);
+    }
+    ASSERT_OK(in.setEqualities(std::move(equalities)));
+
+    ASSERT(in.matchesSingleElement(BSON("a" << 42)["a"]));
+    ASSERT(in.matchesSingleElement(BSON("a" << 42.0)["a"]));
+    ASSERT(in.matchesSingleElement(BSON("a" << 42LL)["a"]));
+    ASSERT(!in.matchesSingleElement(BSON("a" << 43)["a"]));
+    ASSERT(!in.matchesSingleElement(BSON("a"
+                                         << "42")["a"]));
+}
+
+TEST(InMatchExpression, LargeEqualityListRespectsCollationChange) {
+    BSONArrayBuilder bab;
+    for (int i = 0; i < 100; i++) {
+        bab.append("string" + std::to_string(i));
+    }
+    BSONArray operand = bab.arr();
+
+    CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kAlwaysEqual);
+    InMatchExpression in("");
+    std::vector<BSONElement> equalities;
+    for (const auto& elt : operand) {
+        equalities.push_back(elt);
+    }
+    ASSERT_OK(in.setEqualities(std::move(equalities)));
+
+    ASSERT(!in.matchesSingleElement(BSON("a"
+                                         << "missing")["a"]));
+    in.setCollator(&collator);
+    ASSERT(in.matchesSingleElement(BSON("a"
+                                        << "anything at all")["a"]));
+}
+
 std::vector<uint32_t> bsonArrayToBitPositions(const BSONArray& ba) {
     std::vector<uint32_t> bitPositions;
 
@@ -0,0 +1,176 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/matcher/match_program.h"
+
+#include "mongo/util/assert_util.h"
+
+namespace mongo {
+
+namespace {
+
+/**
+ * Returns whether 'node' is a leaf whose matches() implementation is "evaluate
+ * matchesSingleElement() on each element the leaf's path names". Such leaves can be compiled to
+ * a direct path walk; all array traversal behaviors only diverge when an array is encountered,
+ * which the compiled instruction handles by falling back to the interpreted leaf.
+ */
+bool isSimplePathLeaf(const MatchExpression* node) {
+    switch (node->matchType()) {
+        case MatchExpression::EQ:
+        case MatchExpression::LT:
+        case MatchExpression::LTE:
+        case MatchExpression::GT:
+        case MatchExpression::GTE:
+        case MatchExpression::REGEX:
+        case MatchExpression::MOD:
+        case MatchExpression::EXISTS:
+        case MatchExpression::MATCH_IN:
+            return true;
+        default:
+            return false;
+    }
+}
+
+}  // namespace
+
+MatchProgram MatchProgram::compile(const MatchExpression* root) {
+    invariant(root);
+    MatchProgram program;
+    program._compileNode(root);
+    return program;
+}
+
+void MatchProgram::_compileNode(const MatchExpression* node) {
+    switch (node->matchType()) {
+        case MatchExpression::AND:
+        case MatchExpression::OR:
+        case MatchExpression::NOR: {
+            // An empty conjunction is vacuously true, an empty disjunction vacuously false.
+            if (node->numChildren() == 0) {
+                const bool constant = node->matchType() == MatchExpression::AND;
+                _instructions.push_back({OpCode::kLoadConstant, 0, constant, nullptr, boost::none});
+                return;
+            }
+
+            // Compile children in sequence with a short-circuit jump between them, then patch the
+            // jumps to the end of the node. For NOR the jumps land on the trailing negation so it
+            // applies on every path.
+            const auto shortCircuitOp =
+                node->matchType() == MatchExpression::AND ? OpCode::kJumpIfFalse : OpCode::kJumpIfTrue;
+            std::vector<size_t> jumps;
+            for (size_t i = 0; i < node->numChildren(); ++i) {
+                _compileNode(node->getChild(i));
+                if (i + 1 < node->numChildren()) {
+                    jumps.push_back(_instructions.size());
+                    _instructions.push_back({shortCircuitOp, 0, false, nullptr, boost::none});
+                }
+            }
+            for (size_t jump : jumps) {
+                _instructions[jump].target = _instructions.size();
+            }
+            if (node->matchType() == MatchExpression::NOR) {
+                _instructions.push_back({OpCode::kNegate, 0, false, nullptr, boost::none});
+            }
+            return;
+        }
+        case MatchExpression::NOT: {
+            _compileNode(node->getChild(0));
+            _instructions.push_back({OpCode::kNegate, 0, false, nullptr, boost::none});
+            return;
+        }
+        case MatchExpression::ALWAYS_TRUE:
+        case MatchExpression::ALWAYS_FALSE: {
+            const bool constant = node->matchType() == MatchExpression::ALWAYS_TRUE;
+            _instructions.push_back({OpCode::kLoadConstant, 0, constant, nullptr, boost::none});
+            return;
+        }
+        default: {
+            if (isSimplePathLeaf(node)) {
+                _instructions.push_back(
+                    {OpCode::kMatchPathLeaf, 0, false, node, PathExtractionPlan(node->path())});
+            } else {
+                // Anything else (array operators, $where, $expr, schema operators, ...) is
+                // evaluated through the interpreted subtree.
+                _instructions.push_back({OpCode::kMatchSubtree, 0, false, node, boost::none});
+            }
+            return;
+        }
+    }
+}
+
+bool MatchProgram::_matchPathLeaf(Instruction& insn, const BSONObj& doc) {
+    // Resolve the leaf's path through its extraction plan. Absent arrays, the interpreted leaf
+    // would evaluate matchesSingleElement() on exactly the element the plan finds (EOO when the
+    // path is missing). Any array requires implicit traversal semantics, so delegate the whole
+    // document back to the leaf.
+    bool stoppedAtArray = false;
+    BSONElement elem = insn.path->extract(doc, &stoppedAtArray);
+    if (stoppedAtArray || elem.type() == Array) {
+        return insn.expr->matchesBSON(doc, nullptr);
+    }
+
+    return insn.expr->matchesSingleElement(elem, nullptr);
+}
+
+bool MatchProgram::matches(const BSONObj& doc) {
+    bool acc = true;
+    for (size_t pc = 0; pc < _instructions.size(); ++pc) {
+        Instruction& insn = _instructions[pc];
+        switch (insn.op) {
+            case OpCode::kMatchSubtree:
+                acc = insn.expr->matchesBSON(doc, nullptr);
+                break;
+            case OpCode::kMatchPathLeaf:
+                acc = _matchPathLeaf(insn, doc);
+                break;
+            case OpCode::kJumpIfFalse:
+                if (!acc) {
+                    pc = insn.target - 1;
+                }
+                break;
+            case OpCode::kJumpIfTrue:
+                if (acc) {
+                    pc = insn.target - 1;
+                }
+                break;
+            case OpCode::kNegate:
+                acc = !acc;
+                break;
+            case OpCode::kLoadConstant:
+                acc = insn.constant;
+                break;
+        }
+    }
+    return acc;
+}
+
+}  // namespace mongo
@@ -0,0 +1,112 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <boost/optional.hpp>
+#include <vector>
+
+#include "mongo/db/bson/path_extraction_plan.h"
+#include "mongo/db/matcher/expression.h"
+
+namespace mongo {
+
+/**
+ * A MatchProgram is a MatchExpression tree flattened into a linear sequence of instructions with
+ * short-circuit jumps. Executing the program avoids the recursive descent through virtual tree
+ * nodes that MatchExpression::matchesBSON() performs per document, which dominates the cost of
+ * evaluating wide $and/$or trees of cheap comparisons.
+ *
+ * Logical nodes (AND, OR, NOR, NOT) are compiled structurally into jumps. Path-naming leaves with
+ * simple comparison semantics are compiled into an instruction that locates the element at the
+ * leaf's path through a PathExtractionPlan and evaluates matchesSingleElement() on it; if an
+ * array is encountered anywhere along the path, the instruction falls back to the leaf's own
+ * matchesBSON() so implicit array traversal semantics are preserved exactly. Every other node is
+ * compiled into an instruction that evaluates the whole subtree through matchesBSON(), so
+ * compilation always succeeds and a program is always equivalent to the tree it came from.
+ *
+ * A program holds pointers into the MatchExpression tree it was compiled from, which must outlive
+ * the program and must not be mutated while the program is in use. A program is not thread-safe:
+ * compiled path leaves memoize the element position of the previous lookup (see
+ * PathExtractionPlan), so a program belongs to a single execution context, like the stage that
+ * owns it.
+ */
+class MatchProgram {
+public:
+    /**
+     * Compiles 'root' into a program. 'root' must not be null.
+     */
+    static MatchProgram compile(const MatchExpression* root);
+
+    /**
+     * Returns whether 'doc' satisfies the predicate this program was compiled from. Equivalent to
+     * calling matchesBSON(doc) on the root of that tree. MatchDetails are not supported; callers
+     * that need them must use the interpreted tree.
+     */
+    bool matches(const BSONObj& doc);
+
+private:
+    enum class OpCode {
+        // acc = expr->matchesBSON(doc).
+        kMatchSubtree,
+        // acc = expr->matchesSingleElement() on the element found at 'path', falling back to
+        // expr->matchesBSON(doc) if an array is encountered along the path.
+        kMatchPathLeaf,
+        // pc = target if !acc.
+        kJumpIfFalse,
+        // pc = target if acc.
+        kJumpIfTrue,
+        // acc = !acc.
+        kNegate,
+        // acc = constant.
+        kLoadConstant,
+    };
+
+    struct Instruction {
+        OpCode op;
+        // Jump target for kJumpIfFalse / kJumpIfTrue.
+        size_t target = 0;
+        // Value for kLoadConstant.
+        bool constant = false;
+        // The tree node for kMatchSubtree / kMatchPathLeaf. Not owned.
+        const MatchExpression* expr = nullptr;
+        // The pre-resolved extraction plan for the leaf's path for kMatchPathLeaf.
+        boost::optional<PathExtractionPlan> path;
+    };
+
+    MatchProgram() = default;
+
+    void _compileNode(const MatchExpression* node);
+
+    static bool _matchPathLeaf(Instruction& insn, const BSONObj& doc);
+
+    std::vector<Instruction> _instructions;
+};
+
+}  // namespace mongo
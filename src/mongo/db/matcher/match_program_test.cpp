@@ -0,0 +1,129 @@
+/**
+ *    Copyright (C) 2018-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/unittest/unittest.h"
+
+#include <memory>
+#include <vector>
+
+#include "mongo/db/jsobj.h"
+#include "mongo/db/json.h"
+#include "mongo/db/matcher/expression_parser.h"
+#include "mongo/db/matcher/match_program.h"
+#include "mongo/db/pipeline/expression_context_for_test.h"
+#include "mongo/db/query/collation/collator_interface_mock.h"
+
+namespace mongo {
+namespace {
+
+/**
+ * Parses 'filter', compiles it, and asserts that the program agrees with the interpreted tree on
+ * every document in 'docs'. The BSONObj backing the parsed expression is kept alive for the
+ * duration of the check.
+ */
+void assertProgramAgreesWithTree(const std::string& filter,
+                                 const std::vector<std::string>& docs,
+                                 const CollatorInterface* collator = nullptr) {
+    const BSONObj filterObj = fromjson(filter);
+    auto expCtx = make_intrusive<ExpressionContextForTest>();
+    expCtx->setCollator(CollatorInterface::cloneCollator(collator));
+    StatusWithMatchExpression parsed = MatchExpressionParser::parse(filterObj, expCtx);
+    ASSERT_OK(parsed.getStatus());
+    auto expr = std::move(parsed.getValue());
+
+    const MatchProgram program = MatchProgram::compile(expr.get());
+    for (const auto& doc : docs) {
+        const BSONObj obj = fromjson(doc);
+        ASSERT_EQ(program.matches(obj), expr->matchesBSON(obj))
+            << "filter: " << filter << " document: " << doc;
+    }
+}
+
+TEST(MatchProgram, SimpleComparisons) {
+    assertProgramAgreesWithTree("{a: 1}",
+                                {"{a: 1}", "{a: 2}", "{a: '1'}", "{}", "{a: null}", "{b: 1}"});
+    assertProgramAgreesWithTree("{a: {$gt: 5}}", {"{a: 4}", "{a: 5}", "{a: 6}", "{a: 'x'}", "{}"});
+    assertProgramAgreesWithTree("{a: {$lte: 'abc'}}", {"{a: 'abb'}", "{a: 'abd'}", "{a: 3}"});
+}
+
+TEST(MatchProgram, WideAndShortCircuits) {
+    assertProgramAgreesWithTree(
+        "{$and: [{a: {$gte: 0}}, {a: {$lt: 10}}, {b: 'x'}, {c: {$ne: 3}}, {d: {$exists: true}}]}",
+        {"{a: 5, b: 'x', c: 2, d: 1}",
+         "{a: 5, b: 'x', c: 3, d: 1}",
+         "{a: -1, b: 'x', c: 2, d: 1}",
+         "{a: 5, b: 'y', c: 2, d: 1}",
+         "{a: 5, b: 'x', c: 2}",
+         "{}"});
+}
+
+TEST(MatchProgram, NestedLogicalOperators) {
+    assertProgramAgreesWithTree(
+        "{$or: [{a: 1}, {$and: [{b: {$gt: 2}}, {$nor: [{c: 0}, {c: 1}]}]}]}",
+        {"{a: 1}", "{b: 3, c: 2}", "{b: 3, c: 0}", "{b: 2, c: 2}", "{a: 2, b: 3, c: 5}", "{}"});
+    assertProgramAgreesWithTree("{a: {$not: {$gt: 4}}}", {"{a: 3}", "{a: 5}", "{}", "{a: null}"});
+}
+
+TEST(MatchProgram, DottedPathsAndMissingFields) {
+    assertProgramAgreesWithTree(
+        "{'a.b.c': 7}",
+        {"{a: {b: {c: 7}}}", "{a: {b: {c: 8}}}", "{a: {b: 3}}", "{a: 3}", "{}", "{a: {b: {}}}"});
+    assertProgramAgreesWithTree("{'a.b': null}",
+                                {"{a: {b: null}}", "{a: {}}", "{a: 1}", "{}", "{a: {b: 1}}"});
+}
+
+TEST(MatchProgram, ArraysFallBackToImplicitTraversalSemantics) {
+    assertProgramAgreesWithTree("{a: 2}",
+                                {"{a: [1, 2, 3]}", "{a: [4, 5]}", "{a: [[2]]}", "{a: []}"});
+    assertProgramAgreesWithTree(
+        "{'a.b': {$gte: 10}}",
+        {"{a: [{b: 5}, {b: 12}]}", "{a: [{b: 5}]}", "{a: {b: [3, 11]}}", "{a: [1, 2]}"});
+    assertProgramAgreesWithTree("{'a.0': 'x'}", {"{a: ['x', 'y']}", "{a: ['y']}", "{a: {'0': 'x'}}"});
+}
+
+TEST(MatchProgram, NonCompilableLeavesUseInterpretedSubtree) {
+    assertProgramAgreesWithTree("{a: {$elemMatch: {b: 1, c: 2}}}",
+                                {"{a: [{b: 1, c: 2}]}", "{a: [{b: 1}, {c: 2}]}", "{a: 1}", "{}"});
+    assertProgramAgreesWithTree("{a: {$size: 2}}", {"{a: [1, 2]}", "{a: [1]}", "{a: 2}", "{}"});
+    assertProgramAgreesWithTree("{$alwaysTrue: 1}", {"{}", "{a: 1}"});
+}
+
+TEST(MatchProgram, InAndRegexLeaves) {
+    assertProgramAgreesWithTree("{a: {$in: [1, 'x', null]}}",
+                                {"{a: 1}", "{a: 'x'}", "{a: 2}", "{}", "{a: null}", "{a: [3, 'x']}"});
+    assertProgramAgreesWithTree("{a: /^ab/}", {"{a: 'abc'}", "{a: 'xabc'}", "{a: 5}", "{}"});
+}
+
+TEST(MatchProgram, RespectsCollation) {
+    CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kAlwaysEqual);
+    assertProgramAgreesWithTree("{a: 'foo'}", {"{a: 'bar'}", "{a: 'foo'}", "{a: 1}"}, &collator);
+}
+
+}  // namespace
+}  // namespace mongo
@@ -71,6 +71,8 @@ constexpr auto kMirroredReadsParamName = "mirrorReads"_sd;
 constexpr auto kMirroredReadsName = "mirroredReads"_sd;
 constexpr auto kMirroredReadsSeenKey = "seen"_sd;
 constexpr auto kMirroredReadsSentKey = "sent"_sd;
+constexpr auto kMirroredReadsRateLimitedKey = "rateLimited"_sd;
+constexpr auto kMirroredReadsOverloadSkippedKey = "overloadSkipped"_sd;
 constexpr auto kMirroredReadsResolvedKey = "resolved"_sd;
 constexpr auto kMirroredReadsResolvedBreakdownKey = "resolvedBreakdown"_sd;
 
@@ -152,6 +154,36 @@ private:
     };
     InitializationGuard _initGuard;
 
+    /**
+     * Tracks the mirroring load towards a single secondary. The outstanding count grows while the
+     * host's send queue backs up, which is the feedback signal used to scale its mirror rate down.
+     */
+    struct HostState {
+        AtomicWord<long long> outstanding{0};
+    };
+
+    /**
+     * A per-second token budget shared by all mirrored reads. Slight overshoot under concurrency
+     * is acceptable; this is a cost cap, not a scheduler.
+     */
+    class MirroringBudget {
+    public:
+        bool tryAcquire(int maxPerSecond) {
+            const auto nowSec = Date_t::now().toMillisSinceEpoch() / 1000;
+            auto windowStart = _windowStart.load();
+            if (windowStart != nowSec && _windowStart.compareAndSwap(&windowStart, nowSec)) {
+                _used.store(0);
+            }
+            return _used.fetchAndAdd(1) < maxPerSecond;
+        }
+
+    private:
+        AtomicWord<long long> _windowStart{0};
+        AtomicWord<long long> _used{0};
+    };
+
+    std::shared_ptr<HostState> _getHostState(const HostAndPort& host);
+
     // _isInitialized guards the use of heap allocated members like _executor
     // Even if _isInitialized is true, any member function of the variables below must still be
     // inately thread safe. If _isInitialized is false, there may not even be correct pointers to
@@ -161,6 +193,12 @@ private:
     MirroringSampler _sampler;
     std::shared_ptr<executor::TaskExecutor> _executor;
     repl::TopologyVersionObserver _topologyVersionObserver;
+
+    MirroringBudget _budget;
+
+    // Guards insertion into _hostStates; the states themselves are thread safe.
+    Mutex _hostStatesMutex = MONGO_MAKE_LATCH("MirrorMaestroImpl::_hostStatesMutex");
+    stdx::unordered_map<std::string, std::shared_ptr<HostState>> _hostStates;
 };
 
 const auto getMirrorMaestroImpl = ServiceContext::declareDecoration<MirrorMaestroImpl>();
@@ -180,6 +218,8 @@ public:
         BSONObjBuilder section;
         section.append(kMirroredReadsSeenKey, seen.loadRelaxed());
         section.append(kMirroredReadsSentKey, sent.loadRelaxed());
+        section.append(kMirroredReadsRateLimitedKey, rateLimited.loadRelaxed());
+        section.append(kMirroredReadsOverloadSkippedKey, overloadSkipped.loadRelaxed());
 
         if (MONGO_unlikely(mirrorMaestroExpectsResponse.shouldFail())) {
             // We only can see if the command resolved if we got a response
@@ -226,6 +266,8 @@ public:
 
     AtomicWord<CounterT> seen;
     AtomicWord<CounterT> sent;
+    AtomicWord<CounterT> rateLimited;
+    AtomicWord<CounterT> overloadSkipped;
     AtomicWord<CounterT> resolved;
 } gMirroredReadsSection;
 
@@ -315,6 +357,14 @@ void MirrorMaestroImpl::tryMirror(std::shared_ptr<CommandInvocation> invocation)
         return;
     }
 
+    if (auto maxPerSec = params.getMaxRequestsPerSecond();
+        maxPerSec > 0 && !_budget.tryAcquire(maxPerSec)) {
+        // The global mirroring budget for this second is spent; give up before doing any of the
+        // expensive work so high sampling rates stay safe.
+        gMirroredReadsSection.rateLimited.fetchAndAdd(1);
+        return;
+    }
+
     auto hosts = _sampler.getRawMirroringTargets(imr);
     invariant(!hosts.empty());
 
@@ -373,7 +423,18 @@ void MirrorMaestroImpl::_mirror(const std::vector<HostAndPort>& hosts,
 
     for (auto i = 0; i < mirroringFactor; i++) {
         auto& host = hosts[(startIndex + i) % hosts.size()];
-        auto mirrorResponseCallback = [host](auto& args) {
+
+        auto hostState = _getHostState(host);
+        if (hostState->outstanding.load() >= params.getMaxOutstandingPerHost()) {
+            // This secondary has not kept up with the mirrored reads already sent to it. Skipping
+            // it scales the mirror rate to what the host can absorb instead of piling on.
+            gMirroredReadsSection.overloadSkipped.fetchAndAdd(1);
+            continue;
+        }
+
+        auto mirrorResponseCallback = [host, hostState](auto& args) {
+            hostState->outstanding.subtractAndFetch(1);
+
             if (MONGO_likely(!mirrorMaestroExpectsResponse.shouldFail())) {
                 // If we don't expect responses, then there is nothing to do here
                 return;
@@ -400,9 +461,13 @@ void MirrorMaestroImpl::_mirror(const std::vector<HostAndPort>& hosts,
 
         LOGV2_DEBUG(31455, 4, "About to mirror", "host"_attr = host, "request"_attr = newRequest);
 
+        hostState->outstanding.fetchAndAdd(1);
         auto status =
             _executor->scheduleRemoteCommand(newRequest, std::move(mirrorResponseCallback))
                 .getStatus();
+        if (!status.isOK()) {
+            hostState->outstanding.subtractAndFetch(1);
+        }
         uassertStatusOK(status);
 
         gMirroredReadsSection.sent.fetchAndAdd(1);
@@ -412,6 +477,16 @@ void MirrorMaestroImpl::_mirror(const std::vector<HostAndPort>& hosts,
     LOGV2_DEBUG(31456, 2, "Mirroring failed", "reason"_attr = e);
 }
 
+std::shared_ptr<MirrorMaestroImpl::HostState> MirrorMaestroImpl::_getHostState(
+    const HostAndPort& host) {
+    stdx::lock_guard<Latch> lk(_hostStatesMutex);
+    auto& state = _hostStates[host.toString()];
+    if (!state) {
+        state = std::make_shared<HostState>();
+    }
+    return state;
+}
+
 void MirrorMaestroImpl::init(ServiceContext* serviceContext) noexcept {
     LOGV2_DEBUG(31452, 2, "Initializing MirrorMaestro");
 
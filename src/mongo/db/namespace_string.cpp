@@ -84,6 +84,8 @@ const NamespaceString NamespaceString::kRangeDeletionNamespace(NamespaceString::
                                                                "rangeDeletions");
 const NamespaceString NamespaceString::kConfigSettingsNamespace(NamespaceString::kConfigDb,
                                                                 "settings");
+const NamespaceString NamespaceString::kConfigImagesNamespace(NamespaceString::kConfigDb,
+                                                              "image_collection");
 
 bool NamespaceString::isListCollectionsCursorNS() const {
     return coll() == listCollectionsCursorCol;
@@ -160,7 +162,7 @@ NamespaceString NamespaceString::makeDropPendingNamespace(const repl::OpTime& op
 StatusWith<repl::OpTime> NamespaceString::getDropPendingNamespaceOpTime() const {
     if (!isDropPendingNamespace()) {
         return Status(ErrorCodes::BadValue,
-                      str::stream() << "Not a drop-pending namespace: " << _ns);
+                      str::stream() << "Not a drop-pending namespace: " << ns());
     }
 
     auto collectionName = coll();
@@ -173,20 +175,20 @@ StatusWith<repl::OpTime> NamespaceString::getDropPendingNamespaceOpTime() const
     auto incrementSeparatorIndex = opTimeStr.find('i');
     if (std::string::npos == incrementSeparatorIndex) {
         return Status(ErrorCodes::FailedToParse,
-                      str::stream() << "Missing 'i' separator in drop-pending namespace: " << _ns);
+                      str::stream() << "Missing 'i' separator in drop-pending namespace: " << ns());
     }
 
     auto termSeparatorIndex = opTimeStr.find('t', incrementSeparatorIndex);
     if (std::string::npos == termSeparatorIndex) {
         return Status(ErrorCodes::FailedToParse,
-                      str::stream() << "Missing 't' separator in drop-pending namespace: " << _ns);
+                      str::stream() << "Missing 't' separator in drop-pending namespace: " << ns());
     }
 
     long long seconds;
     auto status = NumberParser{}(opTimeStr.substr(0, incrementSeparatorIndex), &seconds);
     if (!status.isOK()) {
         return status.withContext(
-            str::stream() << "Invalid timestamp seconds in drop-pending namespace: " << _ns);
+            str::stream() << "Invalid timestamp seconds in drop-pending namespace: " << ns());
     }
 
     unsigned int increment;
@@ -195,14 +197,14 @@ StatusWith<repl::OpTime> NamespaceString::getDropPendingNamespaceOpTime() const
                             &increment);
     if (!status.isOK()) {
         return status.withContext(
-            str::stream() << "Invalid timestamp increment in drop-pending namespace: " << _ns);
+            str::stream() << "Invalid timestamp increment in drop-pending namespace: " << ns());
     }
 
     long long term;
     status = mongo::NumberParser{}(opTimeStr.substr(termSeparatorIndex + 1), &term);
     if (!status.isOK()) {
         return status.withContext(str::stream()
-                                  << "Invalid term in drop-pending namespace: " << _ns);
+                                  << "Invalid term in drop-pending namespace: " << ns());
     }
 
     return repl::OpTime(Timestamp(Seconds(seconds), increment), term);
@@ -216,7 +218,7 @@ bool NamespaceString::isNamespaceAlwaysUnsharded() const {
     // Certain config collections can never be sharded
     if (ns() == kSessionTransactionsTableNamespace.ns() || ns() == kRangeDeletionNamespace.ns() ||
         ns() == kTransactionCoordinatorsNamespace.ns() ||
-        ns() == kMigrationCoordinatorsNamespace.ns())
+        ns() == kMigrationCoordinatorsNamespace.ns() || ns() == kConfigImagesNamespace.ns())
         return true;
 
     if (isSystemDotProfile())
@@ -32,6 +32,7 @@
 #include <algorithm>
 #include <boost/optional.hpp>
 #include <iosfwd>
+#include <memory>
 #include <string>
 
 #include "mongo/base/status_with.h"
@@ -113,28 +114,31 @@ public:
     // Namespace for balancer settings and default read and write concerns.
     static const NamespaceString kConfigSettingsNamespace;
 
+    // Namespace for pre/post images of retryable findAndModify operations, keyed by session id.
+    static const NamespaceString kConfigImagesNamespace;
+
     /**
      * Constructs an empty NamespaceString.
      */
-    NamespaceString() : _ns(), _dotIndex(std::string::npos) {}
+    NamespaceString() : _ns(_emptyNs()), _dotIndex(std::string::npos) {}
 
     /**
      * Constructs a NamespaceString from the fully qualified namespace named in "ns".
      */
     explicit NamespaceString(StringData ns) {
-        _ns = ns.toString();  // copy to our buffer
-        _dotIndex = _ns.find('.');
+        std::string str = ns.toString();  // copy to our buffer
+        _dotIndex = str.find('.');
         uassert(ErrorCodes::InvalidNamespace,
                 "namespaces cannot have embedded null characters",
-                _ns.find('\0') == std::string::npos);
+                str.find('\0') == std::string::npos);
+        _ns = std::make_shared<const std::string>(std::move(str));
     }
 
     /**
      * Constructs a NamespaceString for the given database and collection names.
      * "dbName" must not contain a ".", and "collectionName" must not start with one.
      */
-    NamespaceString(StringData dbName, StringData collectionName)
-        : _ns(dbName.size() + collectionName.size() + 1, '\0') {
+    NamespaceString(StringData dbName, StringData collectionName) {
         uassert(ErrorCodes::InvalidNamespace,
                 "'.' is an invalid character in a database name",
                 dbName.find('.') == std::string::npos);
@@ -142,18 +146,21 @@ public:
                 "Collection names cannot start with '.'",
                 collectionName.empty() || collectionName[0] != '.');
 
-        std::string::iterator it = std::copy(dbName.begin(), dbName.end(), _ns.begin());
+        std::string str(dbName.size() + collectionName.size() + 1, '\0');
+        std::string::iterator it = std::copy(dbName.begin(), dbName.end(), str.begin());
         *it = '.';
         ++it;
         it = std::copy(collectionName.begin(), collectionName.end(), it);
         _dotIndex = dbName.size();
 
-        dassert(it == _ns.end());
-        dassert(_ns[_dotIndex] == '.');
+        dassert(it == str.end());
+        dassert(str[_dotIndex] == '.');
 
         uassert(ErrorCodes::InvalidNamespace,
                 "namespaces cannot have embedded null characters",
-                _ns.find('\0') == std::string::npos);
+                str.find('\0') == std::string::npos);
+
+        _ns = std::make_shared<const std::string>(std::move(str));
     }
 
     /**
@@ -180,17 +187,18 @@ public:
     };
 
     StringData db() const {
-        return _dotIndex == std::string::npos ? _ns : StringData(_ns.data(), _dotIndex);
+        return _dotIndex == std::string::npos ? StringData(*_ns)
+                                              : StringData(_ns->data(), _dotIndex);
     }
 
     StringData coll() const {
         return _dotIndex == std::string::npos
             ? StringData()
-            : StringData(_ns.c_str() + _dotIndex + 1, _ns.size() - 1 - _dotIndex);
+            : StringData(_ns->c_str() + _dotIndex + 1, _ns->size() - 1 - _dotIndex);
     }
 
     const std::string& ns() const {
-        return _ns;
+        return *_ns;
     }
 
     const std::string& toString() const {
@@ -198,11 +206,11 @@ public:
     }
 
     size_t size() const {
-        return _ns.size();
+        return _ns->size();
     }
 
     bool isEmpty() const {
-        return _ns.empty();
+        return _ns->empty();
     }
 
     //
@@ -240,7 +248,7 @@ public:
         return coll() == "$cmd";
     }
     bool isOplog() const {
-        return oplog(_ns);
+        return oplog(*_ns);
     }
     bool isOnInternalDb() const {
         if (db() == kAdminDb)
@@ -382,12 +390,13 @@ public:
      */
     static bool validCollectionName(StringData coll);
 
-    // Relops among `NamespaceString`.
+    // Relops among `NamespaceString`. Copies share their buffer, so equality between a
+    // NamespaceString and its copies is a pointer comparison.
     friend bool operator==(const NamespaceString& a, const NamespaceString& b) {
-        return a.ns() == b.ns();
+        return a._ns == b._ns || a.ns() == b.ns();
     }
     friend bool operator!=(const NamespaceString& a, const NamespaceString& b) {
-        return a.ns() != b.ns();
+        return !(a == b);
     }
     friend bool operator<(const NamespaceString& a, const NamespaceString& b) {
         return a.ns() < b.ns();
@@ -404,11 +413,18 @@ public:
 
     template <typename H>
     friend H AbslHashValue(H h, const NamespaceString& nss) {
-        return H::combine(std::move(h), nss._ns);
+        return H::combine(std::move(h), *nss._ns);
     }
 
 private:
-    std::string _ns;
+    static const std::shared_ptr<const std::string>& _emptyNs() {
+        static const auto empty = std::make_shared<const std::string>();
+        return empty;
+    }
+
+    // The namespace is immutable once constructed and shared between copies, so copying a
+    // NamespaceString never allocates.
+    std::shared_ptr<const std::string> _ns;
     size_t _dotIndex;
 };
 
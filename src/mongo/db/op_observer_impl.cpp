@@ -33,9 +33,11 @@
 
 #include "mongo/db/op_observer_impl.h"
 
+#include <iterator>
 #include <limits>
 
 #include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/catalog/collection_catalog.h"
 #include "mongo/db/catalog/collection_options.h"
 #include "mongo/db/catalog/database.h"
 #include "mongo/db/catalog/database_holder.h"
@@ -49,9 +51,11 @@
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/op_observer_util.h"
 #include "mongo/db/operation_context.h"
+#include "mongo/db/query_result_cache.h"
 #include "mongo/db/read_write_concern_defaults.h"
 #include "mongo/db/repl/oplog.h"
 #include "mongo/db/repl/oplog_entry_gen.h"
+#include "mongo/db/repl/repl_server_parameters_gen.h"
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/s/collection_sharding_state.h"
 #include "mongo/db/server_options.h"
@@ -118,6 +122,68 @@ void onWriteOpCompleted(OperationContext* opCtx,
     txnParticipant.onWriteOpCompletedOnPrimary(opCtx, std::move(stmtIdsWritten), sessionTxnRecord);
 }
 
+/**
+ * Writes a batch of inserts to the oplog as grouped 'applyOps' command entries instead of one
+ * entry per document. Consecutive inserts are packed into one 'applyOps' array until either
+ * 'maxNumberOfGroupedInsertsInSingleOplogEntry' operations are reached or the next operation
+ * would put the array over the maximum BSON user size; packing then continues in a new entry.
+ * Secondaries unpack these entries via ApplyOps::extractOperations() and apply the individual
+ * inserts in parallel.
+ *
+ * Returns one optime per insert statement, where each document maps to the optime of the
+ * grouped entry that contains it. Must not be used for writes in sessions, which require
+ * per-statement oplog entries to remain retryable.
+ */
+std::vector<repl::OpTime> logGroupedInsertOps(OperationContext* opCtx,
+                                              MutableOplogEntry* oplogEntryTemplate,
+                                              std::vector<InsertStatement>::const_iterator first,
+                                              std::vector<InsertStatement>::const_iterator last) {
+    invariant(!opCtx->getTxnNumber());
+
+    const auto nss = oplogEntryTemplate->getNss();
+    const auto uuid = *oplogEntryTemplate->getUuid();
+
+    std::vector<repl::OpTime> opTimes;
+    opTimes.reserve(std::distance(first, last));
+
+    auto docIter = first;
+    while (docIter != last) {
+        BSONObjBuilder applyOpsBuilder;
+        size_t docsInEntry = 0;
+        {
+            BSONArrayBuilder opsArray(applyOpsBuilder.subarrayStart("applyOps"_sd));
+            for (; docIter != last; docIter++) {
+                auto operation = MutableOplogEntry::makeInsertOperation(nss, uuid, docIter->doc);
+                // Stop packing when either the maximum number of grouped operations is reached,
+                // or when the next one would put the array over the maximum BSON user size. We
+                // rely on the head room between BSONObjMaxUserSize and BSONObjMaxInternalSize to
+                // cover the BSON overhead and the other oplog entry fields. A single max-length
+                // document is still logged on its own.
+                if (opsArray.arrSize() ==
+                        repl::gMaxNumberOfGroupedInsertsInSingleOplogEntry.load() ||
+                    (opsArray.arrSize() > 0 &&
+                     opsArray.len() + OplogEntry::getDurableReplOperationSize(operation) >
+                         BSONObjMaxUserSize))
+                    break;
+                opsArray.append(operation.toBSON());
+                docsInEntry++;
+            }
+            opsArray.done();
+        }
+
+        MutableOplogEntry oplogEntry;
+        oplogEntry.setOpType(repl::OpTypeEnum::kCommand);
+        oplogEntry.setNss(nss.getCommandNS());
+        oplogEntry.setUuid(uuid);
+        oplogEntry.setFromMigrateIfTrue(oplogEntryTemplate->getFromMigrate().value_or(false));
+        oplogEntry.setObject(applyOpsBuilder.done());
+
+        auto opTime = logOperation(opCtx, &oplogEntry);
+        opTimes.insert(opTimes.end(), docsInEntry, opTime);
+    }
+    return opTimes;
+}
+
 /**
  * Given the collection count from Collection::numRecords(), create and return the object for the
  * 'o2' field of a drop or rename oplog entry. If the collection count exceeds the upper limit of a
@@ -159,38 +225,71 @@ OpTimeBundle replLogUpdate(OperationContext* opCtx, const OplogUpdateEntryArgs&
     repl::appendOplogEntryChainInfo(opCtx, &oplogEntry, &oplogLink, args.updateArgs.stmtId);
 
     OpTimeBundle opTimes;
+    // When images are stored in config.image_collection instead of as no-op oplog entries, the
+    // retried findAndModify reconstructs its response with a single point read on the side
+    // collection rather than random reads of the oplog. Collections with pre-image recording
+    // enabled still require the no-op entry.
+    const bool storeImagesInSideCollection =
+        repl::gStoreFindAndModifyImagesInSideCollection.load() &&
+        !args.updateArgs.preImageRecordingEnabledForCollection;
+    boost::optional<repl::RetryImageEnum> imageToWrite;
     const auto storePreImageForRetryableWrite =
         (args.updateArgs.storeDocOption == CollectionUpdateArgs::StoreDocOption::PreImage &&
          opCtx->getTxnNumber());
     if (storePreImageForRetryableWrite || args.updateArgs.preImageRecordingEnabledForCollection) {
-        MutableOplogEntry noopEntry = oplogEntry;
         invariant(args.updateArgs.preImageDoc);
-        noopEntry.setOpType(repl::OpTypeEnum::kNoop);
-        noopEntry.setObject(*args.updateArgs.preImageDoc);
-        oplogLink.preImageOpTime = logOperation(opCtx, &noopEntry);
-        if (storePreImageForRetryableWrite) {
-            opTimes.prePostImageOpTime = oplogLink.preImageOpTime;
+        if (storeImagesInSideCollection) {
+            imageToWrite = repl::RetryImageEnum::kPreImage;
+        } else {
+            MutableOplogEntry noopEntry = oplogEntry;
+            noopEntry.setOpType(repl::OpTypeEnum::kNoop);
+            noopEntry.setObject(*args.updateArgs.preImageDoc);
+            oplogLink.preImageOpTime = logOperation(opCtx, &noopEntry);
+            if (storePreImageForRetryableWrite) {
+                opTimes.prePostImageOpTime = oplogLink.preImageOpTime;
+            }
         }
     }
 
     // This case handles storing the post image for retryable findAndModify's.
     if (args.updateArgs.storeDocOption == CollectionUpdateArgs::StoreDocOption::PostImage &&
         opCtx->getTxnNumber()) {
-        MutableOplogEntry noopEntry = oplogEntry;
-        noopEntry.setOpType(repl::OpTypeEnum::kNoop);
-        noopEntry.setObject(args.updateArgs.updatedDoc);
-        oplogLink.postImageOpTime = logOperation(opCtx, &noopEntry);
-        invariant(opTimes.prePostImageOpTime.isNull());
-        opTimes.prePostImageOpTime = oplogLink.postImageOpTime;
+        if (storeImagesInSideCollection) {
+            invariant(!imageToWrite);
+            imageToWrite = repl::RetryImageEnum::kPostImage;
+        } else {
+            MutableOplogEntry noopEntry = oplogEntry;
+            noopEntry.setOpType(repl::OpTypeEnum::kNoop);
+            noopEntry.setObject(args.updateArgs.updatedDoc);
+            oplogLink.postImageOpTime = logOperation(opCtx, &noopEntry);
+            invariant(opTimes.prePostImageOpTime.isNull());
+            opTimes.prePostImageOpTime = oplogLink.postImageOpTime;
+        }
     }
 
     oplogEntry.setOpType(repl::OpTypeEnum::kUpdate);
     oplogEntry.setObject(args.updateArgs.update);
     oplogEntry.setObject2(args.updateArgs.criteria);
     oplogEntry.setFromMigrateIfTrue(args.updateArgs.fromMigrate);
+    if (imageToWrite) {
+        oplogEntry.setNeedsRetryImage(imageToWrite);
+    }
     // oplogLink could have been changed to include pre/postImageOpTime by the previous no-op write.
     repl::appendOplogEntryChainInfo(opCtx, &oplogEntry, &oplogLink, args.updateArgs.stmtId);
     opTimes.writeOpTime = logOperation(opCtx, &oplogEntry);
+    if (imageToWrite) {
+        // Written in the same unit of work as the update itself, so the image commits and is
+        // timestamped atomically with the oplog entry that references it.
+        const BSONObj& image = *imageToWrite == repl::RetryImageEnum::kPreImage
+            ? *args.updateArgs.preImageDoc
+            : args.updateArgs.updatedDoc;
+        repl::writeToImageCollection(opCtx,
+                                     *opCtx->getLogicalSessionId(),
+                                     *opCtx->getTxnNumber(),
+                                     opTimes.writeOpTime.getTimestamp(),
+                                     *imageToWrite,
+                                     image);
+    }
     opTimes.wallClockTime = oplogEntry.getWallClockTime();
     return opTimes;
 }
@@ -212,7 +311,16 @@ OpTimeBundle replLogDelete(OperationContext* opCtx,
     repl::appendOplogEntryChainInfo(opCtx, &oplogEntry, &oplogLink, stmtId);
 
     OpTimeBundle opTimes;
-    if (deletedDoc) {
+    // Collections with pre-image recording enabled still require the no-op entry, as with
+    // updates.
+    auto* const collection =
+        CollectionCatalog::get(opCtx).lookupCollectionByNamespace(opCtx, nss);
+    const bool preImageRecordingEnabledForCollection =
+        collection && collection->getRecordPreImages();
+    const bool storeImageInSideCollection = deletedDoc && opCtx->getTxnNumber() &&
+        repl::gStoreFindAndModifyImagesInSideCollection.load() &&
+        !preImageRecordingEnabledForCollection;
+    if (deletedDoc && !storeImageInSideCollection) {
         MutableOplogEntry noopEntry = oplogEntry;
         noopEntry.setOpType(repl::OpTypeEnum::kNoop);
         noopEntry.setObject(*deletedDoc);
@@ -224,9 +332,22 @@ OpTimeBundle replLogDelete(OperationContext* opCtx,
     oplogEntry.setOpType(repl::OpTypeEnum::kDelete);
     oplogEntry.setObject(documentKeyDecoration(opCtx));
     oplogEntry.setFromMigrateIfTrue(fromMigrate);
+    if (storeImageInSideCollection) {
+        oplogEntry.setNeedsRetryImage(repl::RetryImageEnum::kPreImage);
+    }
     // oplogLink could have been changed to include preImageOpTime by the previous no-op write.
     repl::appendOplogEntryChainInfo(opCtx, &oplogEntry, &oplogLink, stmtId);
     opTimes.writeOpTime = logOperation(opCtx, &oplogEntry);
+    if (storeImageInSideCollection) {
+        // Written in the same unit of work as the delete itself, so the image commits and is
+        // timestamped atomically with the oplog entry that references it.
+        repl::writeToImageCollection(opCtx,
+                                     *opCtx->getLogicalSessionId(),
+                                     *opCtx->getTxnNumber(),
+                                     opTimes.writeOpTime.getTimestamp(),
+                                     repl::RetryImageEnum::kPreImage,
+                                     *deletedDoc);
+    }
     opTimes.wallClockTime = oplogEntry.getWallClockTime();
     return opTimes;
 }
@@ -390,6 +511,8 @@ void OpObserverImpl::onInserts(OperationContext* opCtx,
                                std::vector<InsertStatement>::const_iterator first,
                                std::vector<InsertStatement>::const_iterator last,
                                bool fromMigrate) {
+    QueryResultCache::get().invalidate(nss.ns());
+
     auto txnParticipant = TransactionParticipant::get(opCtx);
     const bool inMultiDocumentTransaction =
         txnParticipant && opCtx->writesAreReplicated() && txnParticipant.transactionIsOpen();
@@ -420,15 +543,27 @@ void OpObserverImpl::onInserts(OperationContext* opCtx,
         lastWriteDate = getWallClockTimeForOpLog(opCtx);
         oplogEntryTemplate.setWallClockTime(lastWriteDate);
 
-        opTimeList = repl::logInsertOps(opCtx, &oplogEntryTemplate, first, last);
+        // Batches of multiple inserts outside of a session may be logged as grouped 'applyOps'
+        // entries instead of one entry per document. Writes in sessions always log per-statement
+        // entries, which retryability depends on. logGroupedInsertOps() records the optime of
+        // each grouped entry it writes in the reserved times, so only the per-document path
+        // appends to them here.
+        const bool groupInserts = repl::gGroupInsertOplogEntries.load() &&
+            std::distance(first, last) > 1 && uuid && !opCtx->getTxnNumber() &&
+            opCtx->writesAreReplicated();
+        if (groupInserts) {
+            opTimeList = logGroupedInsertOps(opCtx, &oplogEntryTemplate, first, last);
+        } else {
+            opTimeList = repl::logInsertOps(opCtx, &oplogEntryTemplate, first, last);
+
+            auto& times = OpObserver::Times::get(opCtx).reservedOpTimes;
+            using std::begin;
+            using std::end;
+            times.insert(end(times), begin(opTimeList), end(opTimeList));
+        }
         if (!opTimeList.empty())
             lastOpTime = opTimeList.back();
 
-        auto& times = OpObserver::Times::get(opCtx).reservedOpTimes;
-        using std::begin;
-        using std::end;
-        times.insert(end(times), begin(opTimeList), end(opTimeList));
-
         std::vector<StmtId> stmtIdsWritten;
         std::transform(first,
                        last,
@@ -470,6 +605,8 @@ void OpObserverImpl::onInserts(OperationContext* opCtx,
 }
 
 void OpObserverImpl::onUpdate(OperationContext* opCtx, const OplogUpdateEntryArgs& args) {
+    QueryResultCache::get().invalidate(args.nss.ns());
+
     failCollectionUpdates.executeIf(
         [&](const BSONObj&) {
             uasserted(40654,
@@ -555,6 +692,8 @@ void OpObserverImpl::onDelete(OperationContext* opCtx,
                               StmtId stmtId,
                               bool fromMigrate,
                               const boost::optional<BSONObj>& deletedDoc) {
+    QueryResultCache::get().invalidate(nss.ns());
+
     auto& documentKey = documentKeyDecoration(opCtx);
     invariant(!documentKey.isEmpty());
 
@@ -701,6 +840,8 @@ void OpObserverImpl::onCollMod(OperationContext* opCtx,
 }
 
 void OpObserverImpl::onDropDatabase(OperationContext* opCtx, const std::string& dbName) {
+    QueryResultCache::get().clear();
+
     MutableOplogEntry oplogEntry;
     oplogEntry.setOpType(repl::OpTypeEnum::kCommand);
     oplogEntry.setNss({dbName, "$cmd"});
@@ -720,6 +861,8 @@ repl::OpTime OpObserverImpl::onDropCollection(OperationContext* opCtx,
                                               OptionalCollectionUUID uuid,
                                               std::uint64_t numRecords,
                                               const CollectionDropType dropType) {
+    QueryResultCache::get().invalidate(collectionName.ns());
+
     if (!collectionName.isSystemDotProfile()) {
         // Do not replicate system.profile modifications.
         MutableOplogEntry oplogEntry;
@@ -807,6 +950,9 @@ void OpObserverImpl::onRenameCollection(OperationContext* const opCtx,
                                         OptionalCollectionUUID dropTargetUUID,
                                         std::uint64_t numRecords,
                                         bool stayTemp) {
+    QueryResultCache::get().invalidate(fromCollection.ns());
+    QueryResultCache::get().invalidate(toCollection.ns());
+
     preRenameCollection(
         opCtx, fromCollection, toCollection, uuid, dropTargetUUID, numRecords, stayTemp);
     postRenameCollection(opCtx, fromCollection, toCollection, uuid, dropTargetUUID, stayTemp);
@@ -825,6 +971,8 @@ void OpObserverImpl::onApplyOps(OperationContext* opCtx,
 void OpObserverImpl::onEmptyCapped(OperationContext* opCtx,
                                    const NamespaceString& collectionName,
                                    OptionalCollectionUUID uuid) {
+    QueryResultCache::get().invalidate(collectionName.ns());
+
     if (!collectionName.isSystemDotProfile()) {
         // Do not replicate system.profile modifications
         MutableOplogEntry oplogEntry;
@@ -43,6 +43,7 @@
 #include "mongo/db/repl/oplog.h"
 #include "mongo/db/repl/oplog_interface_local.h"
 #include "mongo/db/repl/repl_client_info.h"
+#include "mongo/db/repl/repl_server_parameters_gen.h"
 #include "mongo/db/repl/replication_coordinator_mock.h"
 #include "mongo/db/repl/storage_interface_impl.h"
 #include "mongo/db/service_context_d_test_fixture.h"
@@ -53,6 +54,7 @@
 #include "mongo/rpc/get_status_from_command_result.h"
 #include "mongo/unittest/death_test.h"
 #include "mongo/util/clock_source_mock.h"
+#include "mongo/util/scopeguard.h"
 
 namespace mongo {
 namespace {
@@ -445,6 +447,93 @@ TEST_F(OpObserverTest, OnRenameCollectionOmitsDropTargetFieldIfDropTargetUuidIsN
     ASSERT_BSONOBJ_EQ(oExpected, o);
 }
 
+TEST_F(OpObserverTest, GroupedInsertsLogSingleApplyOpsEntry) {
+    repl::gGroupInsertOplogEntries.store(true);
+    ON_BLOCK_EXIT([] { repl::gGroupInsertOplogEntries.store(false); });
+
+    OpObserverImpl opObserver;
+    auto opCtx = cc().makeOperationContext();
+    auto uuid = CollectionUUID::gen();
+    NamespaceString nss("test.coll");
+
+    std::vector<InsertStatement> inserts;
+    inserts.emplace_back(BSON("_id" << 0));
+    inserts.emplace_back(BSON("_id" << 1));
+    inserts.emplace_back(BSON("_id" << 2));
+
+    // Write to the oplog.
+    {
+        AutoGetDb autoDb(opCtx.get(), nss.db(), MODE_X);
+        WriteUnitOfWork wunit(opCtx.get());
+        opObserver.onInserts(
+            opCtx.get(), nss, uuid, inserts.begin(), inserts.end(), false /*fromMigrate*/);
+        wunit.commit();
+    }
+
+    // The whole batch is logged as one 'applyOps' entry.
+    auto oplogEntry = getSingleOplogEntry(opCtx.get());
+    auto o = oplogEntry.getObjectField("o");
+    auto oExpected = BSON("applyOps" << BSON_ARRAY(BSON("op"
+                                                        << "i"
+                                                        << "ns" << nss.toString() << "ui" << uuid
+                                                        << "o" << BSON("_id" << 0))
+                                                   << BSON("op"
+                                                           << "i"
+                                                           << "ns" << nss.toString() << "ui" << uuid
+                                                           << "o" << BSON("_id" << 1))
+                                                   << BSON("op"
+                                                           << "i"
+                                                           << "ns" << nss.toString() << "ui" << uuid
+                                                           << "o" << BSON("_id" << 2))));
+    ASSERT_BSONOBJ_EQ(oExpected, o);
+}
+
+TEST_F(OpObserverTest, GroupedInsertsSplitAtMaxNumberOfOperations) {
+    repl::gGroupInsertOplogEntries.store(true);
+    const auto prevPackingLimit = repl::gMaxNumberOfGroupedInsertsInSingleOplogEntry.load();
+    repl::gMaxNumberOfGroupedInsertsInSingleOplogEntry.store(2);
+    ON_BLOCK_EXIT([prevPackingLimit] {
+        repl::gGroupInsertOplogEntries.store(false);
+        repl::gMaxNumberOfGroupedInsertsInSingleOplogEntry.store(prevPackingLimit);
+    });
+
+    OpObserverImpl opObserver;
+    auto opCtx = cc().makeOperationContext();
+    auto uuid = CollectionUUID::gen();
+    NamespaceString nss("test.coll");
+
+    std::vector<InsertStatement> inserts;
+    inserts.emplace_back(BSON("_id" << 0));
+    inserts.emplace_back(BSON("_id" << 1));
+    inserts.emplace_back(BSON("_id" << 2));
+
+    // Write to the oplog.
+    {
+        AutoGetDb autoDb(opCtx.get(), nss.db(), MODE_X);
+        WriteUnitOfWork wunit(opCtx.get());
+        opObserver.onInserts(
+            opCtx.get(), nss, uuid, inserts.begin(), inserts.end(), false /*fromMigrate*/);
+        wunit.commit();
+    }
+
+    // The batch is split into two 'applyOps' entries of at most two operations each.
+    auto oplogEntries = getNOplogEntries(opCtx.get(), 2);
+    auto firstExpected = BSON("applyOps" << BSON_ARRAY(BSON("op"
+                                                            << "i"
+                                                            << "ns" << nss.toString() << "ui"
+                                                            << uuid << "o" << BSON("_id" << 0))
+                                                       << BSON("op"
+                                                               << "i"
+                                                               << "ns" << nss.toString() << "ui"
+                                                               << uuid << "o" << BSON("_id" << 1))));
+    auto secondExpected = BSON("applyOps" << BSON_ARRAY(BSON("op"
+                                                             << "i"
+                                                             << "ns" << nss.toString() << "ui"
+                                                             << uuid << "o" << BSON("_id" << 2))));
+    ASSERT_BSONOBJ_EQ(firstExpected, oplogEntries[0].getObjectField("o"));
+    ASSERT_BSONOBJ_EQ(secondExpected, oplogEntries[1].getObjectField("o"));
+}
+
 /**
  * Test fixture for testing OpObserver behavior specific to the SessionCatalog.
  */
@@ -63,6 +63,17 @@ namespace repl {
 class UnreplicatedWritesBlock;
 }  // namespace repl
 
+/**
+ * The admission priority of an operation. Tickets handed out under backpressure (flow control,
+ * storage engine concurrency tickets) are granted to normal-priority operations first; low-priority
+ * operations are only admitted with whatever capacity is left over. Background and bulk work should
+ * run at low priority so that throttling squeezes it before interactive traffic.
+ */
+enum class AdmissionPriority {
+    kNormal,
+    kLow,
+};
+
 /**
  * This class encompasses the state required by an operation and lives from the time a network
  * operation is dispatched until its execution is finished. Note that each "getmore" on a cursor
@@ -90,6 +101,18 @@ public:
         _shouldParticipateInFlowControl = target;
     }
 
+    AdmissionPriority getAdmissionPriority() const {
+        return _admissionPriority;
+    }
+
+    /**
+     * Prefer ScopedAdmissionPriority over calling this directly, so the priority is restored when
+     * the marked section of the operation completes.
+     */
+    void setAdmissionPriority(AdmissionPriority priority) {
+        _admissionPriority = priority;
+    }
+
     /**
      * Interface for durability.  Caller DOES NOT own pointer.
      */
@@ -563,6 +586,7 @@ private:
 
     bool _writesAreReplicated = true;
     bool _shouldParticipateInFlowControl = true;
+    AdmissionPriority _admissionPriority = AdmissionPriority::kNormal;
     bool _inMultiDocumentTransaction = false;
     bool _isStartingMultiDocumentTransaction = false;
 
@@ -574,6 +598,29 @@ private:
     bool _exhaust = false;
 };
 
+/**
+ * RAII-style class to set the admission priority of an operation. The priority is restored when
+ * the object goes out of scope.
+ */
+class ScopedAdmissionPriority {
+    ScopedAdmissionPriority(const ScopedAdmissionPriority&) = delete;
+    ScopedAdmissionPriority& operator=(const ScopedAdmissionPriority&) = delete;
+
+public:
+    ScopedAdmissionPriority(OperationContext* opCtx, AdmissionPriority priority)
+        : _opCtx(opCtx), _originalPriority(opCtx->getAdmissionPriority()) {
+        _opCtx->setAdmissionPriority(priority);
+    }
+
+    ~ScopedAdmissionPriority() {
+        _opCtx->setAdmissionPriority(_originalPriority);
+    }
+
+private:
+    OperationContext* _opCtx;
+    const AdmissionPriority _originalPriority;
+};
+
 namespace repl {
 /**
  * RAII-style class to turn off replicated writes. Writes do not create oplog entries while the
@@ -143,6 +143,18 @@ StatusWith<BSONObj> fixDocumentForInsert(ServiceContext* service, const BSONObj&
     if (firstElementIsId && !hasTimestampToFix)
         return StatusWith<BSONObj>(BSONObj());
 
+    if (!hadId && !hasTimestampToFix) {
+        // Common bulk-load case: the server generates the _id and the rest of the document is
+        // unchanged. Prepend the new _id and splice the original element bytes in with a single
+        // buffer copy instead of re-appending element by element. The loop above has already
+        // validated the field names.
+        BSONObjBuilder b(doc.objsize() + 16);
+        b.appendOID("_id", nullptr, true);
+        // Skip the 4-byte length prefix and trailing EOO; the builder writes its own.
+        b.bb().appendBuf(doc.objdata() + 4, doc.objsize() - 5);
+        return StatusWith<BSONObj>(b.obj());
+    }
+
     BSONObjIterator i(doc);
 
     BSONObjBuilder b(doc.objsize() + 16);
@@ -35,6 +35,7 @@
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/ops/find_and_modify_result.h"
 #include "mongo/db/query/find_and_modify_request.h"
+#include "mongo/db/repl/image_collection_entry_gen.h"
 #include "mongo/logv2/redaction.h"
 
 namespace mongo {
@@ -62,7 +63,9 @@ void validateFindAndModifyRetryability(const FindAndModifyRequest& request,
         uassert(40607,
                 str::stream() << "No pre-image available for findAndModify retry request:"
                               << redact(request.toBSON({})),
-                oplogWithCorrectLinks.getPreImageOpTime());
+                oplogWithCorrectLinks.getPreImageOpTime() ||
+                    oplogWithCorrectLinks.getNeedsRetryImage() ==
+                        repl::RetryImageEnum::kPreImage);
     } else if (opType == repl::OpTypeEnum::kInsert) {
         uassert(
             40608,
@@ -86,14 +89,18 @@ void validateFindAndModifyRetryability(const FindAndModifyRequest& request,
                                   << " wants the document after update returned, but only before "
                                      "update document is stored, oplogTs: "
                                   << ts.toString() << ", oplog: " << redact(oplogEntry.toBSON()),
-                    oplogWithCorrectLinks.getPostImageOpTime());
+                    oplogWithCorrectLinks.getPostImageOpTime() ||
+                        oplogWithCorrectLinks.getNeedsRetryImage() ==
+                            repl::RetryImageEnum::kPostImage);
         } else {
             uassert(40612,
                     str::stream() << "findAndModify retry request: " << redact(request.toBSON({}))
                                   << " wants the document before update returned, but only after "
                                      "update document is stored, oplogTs: "
                                   << ts.toString() << ", oplog: " << redact(oplogEntry.toBSON()),
-                    oplogWithCorrectLinks.getPreImageOpTime());
+                    oplogWithCorrectLinks.getPreImageOpTime() ||
+                        oplogWithCorrectLinks.getNeedsRetryImage() ==
+                            repl::RetryImageEnum::kPreImage);
         }
     }
 }
@@ -103,11 +110,39 @@ void validateFindAndModifyRetryability(const FindAndModifyRequest& request,
  * oplog.
  */
 BSONObj extractPreOrPostImage(OperationContext* opCtx, const repl::OplogEntry& oplog) {
-    invariant(oplog.getPreImageOpTime() || oplog.getPostImageOpTime());
-    auto opTime = oplog.getPreImageOpTime() ? oplog.getPreImageOpTime().value()
-                                            : oplog.getPostImageOpTime().value();
+    invariant(oplog.getPreImageOpTime() || oplog.getPostImageOpTime() ||
+              oplog.getNeedsRetryImage());
 
     DBDirectClient client(opCtx);
+
+    if (oplog.getNeedsRetryImage()) {
+        // The image is stored in config.image_collection keyed by session id: a single point read
+        // instead of a random read of the oplog.
+        const auto sessionId = *oplog.getSessionId();
+        auto imageDoc = client.findOne(NamespaceString::kConfigImagesNamespace.ns(),
+                                       BSON("_id" << sessionId.toBSON()),
+                                       nullptr);
+        uassert(ErrorCodes::IncompleteTransactionHistory,
+                str::stream() << "image collection no longer contains the image for session "
+                              << sessionId.getId() << ", cannot retry the findAndModify",
+                !imageDoc.isEmpty());
+
+        auto entry =
+            repl::ImageEntry::parse(IDLParserErrorContext("write_ops_retryability"), imageDoc);
+        // A later retryable write on the session overwrites the image, and oplog application
+        // outside of steady state replication invalidates it.
+        uassert(ErrorCodes::IncompleteTransactionHistory,
+                str::stream() << "image for session " << sessionId.getId()
+                              << " no longer matches the findAndModify with oplogTs "
+                              << oplog.getTimestamp().toString()
+                              << ", cannot retry the findAndModify",
+                !entry.getInvalidated() && entry.getTs() == oplog.getTimestamp() &&
+                    entry.getTxnNum() == *oplog.getTxnNumber());
+        return entry.getImage().getOwned();
+    }
+
+    auto opTime = oplog.getPreImageOpTime() ? oplog.getPreImageOpTime().value()
+                                            : oplog.getPostImageOpTime().value();
     auto oplogDoc =
         client.findOne(NamespaceString::kRsOplogNamespace.ns(), opTime.asQuery(), nullptr);
 
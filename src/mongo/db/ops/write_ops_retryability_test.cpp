@@ -30,10 +30,13 @@
 #include "mongo/platform/basic.h"
 
 #include "mongo/bson/bsonmisc.h"
+#include "mongo/db/dbdirectclient.h"
+#include "mongo/db/logical_session_id.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/ops/write_ops.h"
 #include "mongo/db/ops/write_ops_retryability.h"
 #include "mongo/db/query/find_and_modify_request.h"
+#include "mongo/db/repl/image_collection_entry_gen.h"
 #include "mongo/db/repl/mock_repl_coord_server_fixture.h"
 #include "mongo/db/repl/oplog_entry.h"
 #include "mongo/db/service_context.h"
@@ -77,6 +80,35 @@ repl::OplogEntry makeOplogEntry(repl::OpTime opTime,
                             postImageOpTime);  // post-image optime
 }
 
+/**
+ * Creates an OplogEntry that stores its pre/post image in config.image_collection rather than in a
+ * no-op oplog entry.
+ */
+repl::OplogEntry makeOplogEntryNeedingRetryImage(repl::OpTime opTime,
+                                                 repl::OpTypeEnum opType,
+                                                 NamespaceString nss,
+                                                 BSONObj oField,
+                                                 boost::optional<BSONObj> o2Field,
+                                                 const LogicalSessionId& sessionId,
+                                                 TxnNumber txnNum,
+                                                 repl::RetryImageEnum imageKind) {
+    BSONObjBuilder builder;
+    builder.append("ts", opTime.getTimestamp());
+    builder.append("t", opTime.getTerm());
+    builder.append("op", OpType_serializer(opType));
+    builder.append("ns", nss.ns());
+    builder.append("wall", Date_t());
+    builder.append("o", oField);
+    if (o2Field) {
+        builder.append("o2", *o2Field);
+    }
+    builder.append("lsid", sessionId.toBSON());
+    builder.append("txnNumber", txnNum);
+    builder.append("stmtId", 0);
+    builder.append("needsRetryImage", RetryImage_serializer(imageKind));
+    return assertGet(repl::OplogEntry::parse(builder.obj()));
+}
+
 TEST_F(WriteOpsRetryability, ParseOplogEntryForUpdate) {
     const auto entry = assertGet(repl::OplogEntry::parse(
         BSON("ts" << Timestamp(50, 10) << "t" << 1LL << "op"
@@ -170,6 +202,28 @@ protected:
         parseOplogEntryForFindAndModify(opCtx, request, oplogEntry, &builder);
         return builder.obj();
     }
+
+    /**
+     * Stores an image in config.image_collection the way the op observer would have during the
+     * original execution of the findAndModify.
+     */
+    void insertImageEntry(const LogicalSessionId& sessionId,
+                          TxnNumber txnNum,
+                          Timestamp ts,
+                          repl::RetryImageEnum imageKind,
+                          const BSONObj& image,
+                          bool invalidated = false) {
+        repl::ImageEntry imageEntry;
+        imageEntry.set_id(sessionId);
+        imageEntry.setTxnNum(txnNum);
+        imageEntry.setTs(ts);
+        imageEntry.setImageKind(imageKind);
+        imageEntry.setImage(image);
+        imageEntry.setInvalidated(invalidated);
+
+        DBDirectClient client(opCtx());
+        client.insert(NamespaceString::kConfigImagesNamespace.ns(), imageEntry.toBSON());
+    }
 };
 
 const NamespaceString kNs("test.user");
@@ -456,6 +510,84 @@ TEST_F(FindAndModifyRetryability, UpdateWithPostImageButOplogDoesNotExistShouldE
                   AssertionException);
 }
 
+TEST_F(FindAndModifyRetryability, UpdateWithPreImageFromSideCollection) {
+    auto request = FindAndModifyRequest::makeUpdate(kNs, BSONObj(), BSONObj());
+    request.setShouldReturnNew(false);
+
+    auto sessionId = makeLogicalSessionIdForTest();
+    insertImageEntry(sessionId,
+                     1,
+                     Timestamp(60, 10),
+                     repl::RetryImageEnum::kPreImage,
+                     BSON("_id" << 1 << "z" << 1));
+
+    auto updateOplog = makeOplogEntryNeedingRetryImage(repl::OpTime(Timestamp(60, 10), 1),
+                                                       repl::OpTypeEnum::kUpdate,
+                                                       kNs,
+                                                       BSON("_id" << 1 << "y" << 1),
+                                                       BSON("_id" << 1),
+                                                       sessionId,
+                                                       1,
+                                                       repl::RetryImageEnum::kPreImage);
+
+    auto result = constructFindAndModifyRetryResult(opCtx(), request, updateOplog);
+    ASSERT_BSONOBJ_EQ(BSON("lastErrorObject" << BSON("n" << 1 << "updatedExisting" << true)
+                                             << "value" << BSON("_id" << 1 << "z" << 1)),
+                      result);
+}
+
+TEST_F(FindAndModifyRetryability, UpdateWithPostImageFromSideCollection) {
+    auto request = FindAndModifyRequest::makeUpdate(kNs, BSONObj(), BSONObj());
+    request.setShouldReturnNew(true);
+
+    auto sessionId = makeLogicalSessionIdForTest();
+    insertImageEntry(sessionId,
+                     1,
+                     Timestamp(60, 10),
+                     repl::RetryImageEnum::kPostImage,
+                     BSON("a" << 1 << "b" << 1));
+
+    auto updateOplog = makeOplogEntryNeedingRetryImage(repl::OpTime(Timestamp(60, 10), 1),
+                                                       repl::OpTypeEnum::kUpdate,
+                                                       kNs,
+                                                       BSON("_id" << 1 << "y" << 1),
+                                                       BSON("_id" << 1),
+                                                       sessionId,
+                                                       1,
+                                                       repl::RetryImageEnum::kPostImage);
+
+    auto result = constructFindAndModifyRetryResult(opCtx(), request, updateOplog);
+    ASSERT_BSONOBJ_EQ(BSON("lastErrorObject" << BSON("n" << 1 << "updatedExisting" << true)
+                                             << "value" << BSON("a" << 1 << "b" << 1)),
+                      result);
+}
+
+TEST_F(FindAndModifyRetryability, UpdateWithImageFromSideCollectionOverwrittenShouldError) {
+    auto request = FindAndModifyRequest::makeUpdate(kNs, BSONObj(), BSONObj());
+    request.setShouldReturnNew(false);
+
+    // A later retryable write on the same session has overwritten the image.
+    auto sessionId = makeLogicalSessionIdForTest();
+    insertImageEntry(sessionId,
+                     2,
+                     Timestamp(90, 4),
+                     repl::RetryImageEnum::kPreImage,
+                     BSON("_id" << 1 << "q" << 1));
+
+    auto updateOplog = makeOplogEntryNeedingRetryImage(repl::OpTime(Timestamp(60, 10), 1),
+                                                       repl::OpTypeEnum::kUpdate,
+                                                       kNs,
+                                                       BSON("_id" << 1 << "y" << 1),
+                                                       BSON("_id" << 1),
+                                                       sessionId,
+                                                       1,
+                                                       repl::RetryImageEnum::kPreImage);
+
+    ASSERT_THROWS_CODE(constructFindAndModifyRetryResult(opCtx(), request, updateOplog),
+                       AssertionException,
+                       ErrorCodes::IncompleteTransactionHistory);
+}
+
 TEST_F(FindAndModifyRetryability, BasicRemove) {
     auto request = FindAndModifyRequest::makeRemove(kNs, BSONObj());
 
@@ -511,6 +643,31 @@ TEST_F(FindAndModifyRetryability, NestedRemove) {
         result);
 }
 
+TEST_F(FindAndModifyRetryability, RemoveWithPreImageFromSideCollection) {
+    auto request = FindAndModifyRequest::makeRemove(kNs, BSONObj());
+
+    auto sessionId = makeLogicalSessionIdForTest();
+    insertImageEntry(sessionId,
+                     1,
+                     Timestamp(60, 10),
+                     repl::RetryImageEnum::kPreImage,
+                     BSON("_id" << 20 << "a" << 1));
+
+    auto removeOplog = makeOplogEntryNeedingRetryImage(repl::OpTime(Timestamp(60, 10), 1),
+                                                       repl::OpTypeEnum::kDelete,
+                                                       kNs,
+                                                       BSON("_id" << 20),
+                                                       boost::none,
+                                                       sessionId,
+                                                       1,
+                                                       repl::RetryImageEnum::kPreImage);
+
+    auto result = constructFindAndModifyRetryResult(opCtx(), request, removeOplog);
+    ASSERT_BSONOBJ_EQ(
+        BSON("lastErrorObject" << BSON("n" << 1) << "value" << BSON("_id" << 20 << "a" << 1)),
+        result);
+}
+
 TEST_F(FindAndModifyRetryability, AttemptingToRetryUpsertWithRemoveErrors) {
     auto request = FindAndModifyRequest::makeRemove(kNs, BSONObj());
 
@@ -79,6 +79,7 @@ void PeriodicThreadToDecreaseSnapshotHistoryCachePressure::_init(ServiceContext*
                 // (The PeriodicRunnerASIO's Client must be reset before returning.)
                 auto opCtx = client->makeOperationContext();
 
+                SnapshotWindowUtil::recordCommitPointAdvancement(opCtx.get());
                 SnapshotWindowUtil::decreaseTargetSnapshotWindowSize(opCtx.get());
             } catch (const ExceptionForCat<ErrorCategory::CancelationError>& ex) {
                 LOGV2_DEBUG(4684102, 4, "Periodic task cancelled", "reason"_attr = ex.toStatus());
@@ -42,6 +42,7 @@
 #include "mongo/db/exec/document_value/value_comparator.h"
 #include "mongo/db/pipeline/expression.h"
 #include "mongo/db/pipeline/expression_context.h"
+#include "mongo/db/sorter/sorter.h"
 #include "mongo/stdx/unordered_set.h"
 #include "mongo/util/summation.h"
 
@@ -81,6 +82,14 @@ public:
         processInternal(input, merging);
     }
 
+    /** Process a batch of inputs in one call. Equivalent to calling process() on each element of
+     *  'inputs' in order, but lets accumulators whose work is dominated by per-value type dispatch
+     *  amortize that dispatch over runs of same-typed values.
+     */
+    void processBatch(const std::vector<Value>& inputs, bool merging) {
+        processBatchInternal(inputs, merging);
+    }
+
     /** Marks the end of the evaluate() phase and return accumulated result.
      *  toBeMerged should be true when the outputs will be merged by process().
      */
@@ -137,6 +146,14 @@ protected:
     /// Update subclass's internal state based on input
     virtual void processInternal(const Value& input, bool merging) = 0;
 
+    /// Update subclass's internal state based on a batch of inputs. The default implementation
+    /// processes the values one at a time; accumulators with a cheaper bulk path override it.
+    virtual void processBatchInternal(const std::vector<Value>& inputs, bool merging) {
+        for (auto&& input : inputs) {
+            processInternal(input, merging);
+        }
+    }
+
     const boost::intrusive_ptr<ExpressionContext>& getExpressionContext() const {
         return _expCtx;
     }
@@ -156,6 +173,7 @@ public:
      */
     AccumulatorAddToSet(const boost::intrusive_ptr<ExpressionContext>& expCtx,
                         boost::optional<int> maxMemoryUsageBytes = boost::none);
+    ~AccumulatorAddToSet();
 
     void processInternal(const Value& input, bool merging) final;
     Value getValue(bool toBeMerged) final;
@@ -174,8 +192,23 @@ public:
     }
 
 private:
+    /**
+     * Writes the current contents of '_set' to this accumulator's spill file, records an iterator
+     * that can replay them, and resets the in-memory set.
+     */
+    void spill();
+
     ValueUnorderedSet _set;
     int _maxMemUsageBytes;
+
+    // Spill state, used only when the query allows disk use. A value can appear in more than one
+    // spilled chunk if it is added again after the chunk containing it was written, so getValue()
+    // re-deduplicates while streaming the chunks back.
+    bool _diskUseAllowed;
+    std::string _fileName;
+    std::streampos _nextSortedFileWriterOffset = 0;
+    bool _usedDisk = false;
+    std::vector<std::shared_ptr<Sorter<Value, Value>::Iterator>> _spilledChunks;
 };
 
 class AccumulatorFirst final : public AccumulatorState {
@@ -224,6 +257,7 @@ public:
     explicit AccumulatorSum(const boost::intrusive_ptr<ExpressionContext>& expCtx);
 
     void processInternal(const Value& input, bool merging) final;
+    void processBatchInternal(const std::vector<Value>& inputs, bool merging) final;
     Value getValue(bool toBeMerged) final;
     const char* getOpName() const final;
     void reset() final;
@@ -255,6 +289,7 @@ public:
     AccumulatorMinMax(const boost::intrusive_ptr<ExpressionContext>& expCtx, Sense sense);
 
     void processInternal(const Value& input, bool merging) final;
+    void processBatchInternal(const std::vector<Value>& inputs, bool merging) final;
     Value getValue(bool toBeMerged) final;
     const char* getOpName() const final;
     void reset() final;
@@ -296,6 +331,7 @@ public:
      */
     AccumulatorPush(const boost::intrusive_ptr<ExpressionContext>& expCtx,
                     boost::optional<int> maxMemoryUsageBytes = boost::none);
+    ~AccumulatorPush();
 
     void processInternal(const Value& input, bool merging) final;
     Value getValue(bool toBeMerged) final;
@@ -306,8 +342,22 @@ public:
         const boost::intrusive_ptr<ExpressionContext>& expCtx);
 
 private:
+    /**
+     * Writes the current contents of '_array' to this accumulator's spill file, records an
+     * iterator that can replay them in insertion order, and resets the in-memory array.
+     */
+    void spill();
+
     std::vector<Value> _array;
     int _maxMemUsageBytes;
+
+    // Spill state, used only when the query allows disk use. The chunks replay in the order they
+    // were written, followed by whatever remains in '_array', preserving insertion order.
+    bool _diskUseAllowed;
+    std::string _fileName;
+    std::streampos _nextSortedFileWriterOffset = 0;
+    bool _usedDisk = false;
+    std::vector<std::shared_ptr<Sorter<Value, Value>::Iterator>> _spilledChunks;
 };
 
 class AccumulatorAvg final : public AccumulatorState {
@@ -315,6 +365,7 @@ public:
     explicit AccumulatorAvg(const boost::intrusive_ptr<ExpressionContext>& expCtx);
 
     void processInternal(const Value& input, bool merging) final;
+    void processBatchInternal(const std::vector<Value>& inputs, bool merging) final;
     Value getValue(bool toBeMerged) final;
     const char* getOpName() const final;
     void reset() final;
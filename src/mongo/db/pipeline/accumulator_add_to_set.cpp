@@ -31,16 +31,37 @@
 
 #include "mongo/db/pipeline/accumulator.h"
 
+#include <boost/filesystem/operations.hpp>
+
 #include "mongo/db/exec/document_value/value.h"
 #include "mongo/db/pipeline/accumulation_statement.h"
 #include "mongo/db/pipeline/expression_context.h"
 #include "mongo/db/query/query_knobs_gen.h"
+#include "mongo/util/destructor_guard.h"
 
 namespace mongo {
 
 using boost::intrusive_ptr;
 using std::vector;
 
+namespace {
+
+/**
+ * Generates a new file name on each call using a static, atomic and monotonically increasing
+ * number.
+ *
+ * Each user of the Sorter must implement this function to ensure that all temporary files that the
+ * Sorter instances produce are uniquely identified using a unique file name extension with separate
+ * atomic variable. This is necessary because the sorter.cpp code is separately included in multiple
+ * places, rather than compiled in one place and linked, and so cannot provide a globally unique ID.
+ */
+std::string nextFileName() {
+    static AtomicWord<unsigned> accumulatorAddToSetFileCounter;
+    return "extsort-add-to-set." + std::to_string(accumulatorAddToSetFileCounter.fetchAndAdd(1));
+}
+
+}  // namespace
+
 REGISTER_ACCUMULATOR(addToSet, genericParseSingleExpressionAccumulator<AccumulatorAddToSet>);
 
 const char* AccumulatorAddToSet::getOpName() const {
@@ -52,11 +73,16 @@ void AccumulatorAddToSet::processInternal(const Value& input, bool merging) {
         bool inserted = _set.insert(val).second;
         if (inserted) {
             _memUsageBytes += val.getApproximateSize();
-            uassert(ErrorCodes::ExceededMemoryLimit,
-                    str::stream()
-                        << "$addToSet used too much memory and cannot spill to disk. Memory limit: "
-                        << _maxMemUsageBytes << " bytes",
-                    _memUsageBytes < _maxMemUsageBytes);
+            if (_memUsageBytes >= _maxMemUsageBytes) {
+                if (_diskUseAllowed) {
+                    spill();
+                } else {
+                    uasserted(ErrorCodes::ExceededMemoryLimit,
+                              str::stream() << "$addToSet used too much memory and cannot spill to "
+                                               "disk. Memory limit: "
+                                            << _maxMemUsageBytes << " bytes");
+                }
+            }
         }
     };
     if (!merging) {
@@ -75,7 +101,42 @@ void AccumulatorAddToSet::processInternal(const Value& input, bool merging) {
     }
 }
 
+void AccumulatorAddToSet::spill() {
+    invariant(_diskUseAllowed);
+    _usedDisk = true;
+    SortedFileWriter<Value, Value> writer(SortOptions().TempDir(getExpressionContext()->tempDir),
+                                          _fileName,
+                                          _nextSortedFileWriterOffset);
+    for (auto&& val : _set) {
+        writer.addAlreadySorted(Value(), val);
+    }
+    _spilledChunks.emplace_back(writer.done());
+    _nextSortedFileWriterOffset = writer.getFileEndOffset();
+
+    _set = getExpressionContext()->getValueComparator().makeUnorderedValueSet();
+    _memUsageBytes = sizeof(*this);
+}
+
 Value AccumulatorAddToSet::getValue(bool toBeMerged) {
+    if (_spilledChunks.empty()) {
+        return Value(vector<Value>(_set.begin(), _set.end()));
+    }
+
+    // A value can appear in more than one spilled chunk if it was added again after the chunk
+    // containing it was written, so stream everything back through a fresh set to re-deduplicate.
+    // The merged set replaces the spill state since the chunk iterators are single-pass; a
+    // subsequent call takes the in-memory path above.
+    auto merged = getExpressionContext()->getValueComparator().makeUnorderedValueSet();
+    for (auto&& chunk : _spilledChunks) {
+        chunk->openSource();
+        while (chunk->more()) {
+            merged.insert(chunk->next().second);
+        }
+        chunk->closeSource();
+    }
+    merged.insert(_set.begin(), _set.end());
+    _set = std::move(merged);
+    _spilledChunks.clear();
     return Value(vector<Value>(_set.begin(), _set.end()));
 }
 
@@ -83,12 +144,25 @@ AccumulatorAddToSet::AccumulatorAddToSet(const boost::intrusive_ptr<ExpressionCo
                                          boost::optional<int> maxMemoryUsageBytes)
     : AccumulatorState(expCtx),
       _set(expCtx->getValueComparator().makeUnorderedValueSet()),
-      _maxMemUsageBytes(maxMemoryUsageBytes.value_or(internalQueryMaxAddToSetBytes.load())) {
+      _maxMemUsageBytes(maxMemoryUsageBytes.value_or(internalQueryMaxAddToSetBytes.load())),
+      _diskUseAllowed(expCtx->allowDiskUse && !expCtx->inMongos) {
+    if (_diskUseAllowed) {
+        _fileName = expCtx->tempDir + "/" + nextFileName();
+    }
     _memUsageBytes = sizeof(*this);
 }
 
+AccumulatorAddToSet::~AccumulatorAddToSet() {
+    // Close any open file handles before deleting the spill file.
+    _spilledChunks.clear();
+    if (_usedDisk) {
+        DESTRUCTOR_GUARD(boost::filesystem::remove(_fileName));
+    }
+}
+
 void AccumulatorAddToSet::reset() {
     _set = getExpressionContext()->getValueComparator().makeUnorderedValueSet();
+    _spilledChunks.clear();
     _memUsageBytes = sizeof(*this);
 }
 
@@ -98,3 +172,6 @@ intrusive_ptr<AccumulatorState> AccumulatorAddToSet::create(
 }
 
 }  // namespace mongo
+
+#include "mongo/db/sorter/sorter.cpp"
+// Explicit instantiation unneeded since we aren't exposing Sorter outside of this file.
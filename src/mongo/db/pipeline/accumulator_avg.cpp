@@ -93,6 +93,58 @@ void AccumulatorAvg::processInternal(const Value& input, bool merging) {
     _count++;
 }
 
+void AccumulatorAvg::processBatchInternal(const std::vector<Value>& inputs, bool merging) {
+    if (merging) {
+        // Merge documents carry a count alongside the subtotal, so they are unpacked one at a
+        // time.
+        for (auto&& input : inputs) {
+            processInternal(input, merging);
+        }
+        return;
+    }
+
+    const size_t n = inputs.size();
+    size_t i = 0;
+    while (i < n) {
+        // Hoist the type dispatch out of the per-value loop by processing runs of same-typed
+        // values together.
+        const BSONType runType = inputs[i].getType();
+        size_t runEnd = i + 1;
+        while (runEnd < n && inputs[runEnd].getType() == runType) {
+            runEnd++;
+        }
+
+        switch (runType) {
+            case NumberDecimal:
+                for (size_t j = i; j < runEnd; j++) {
+                    _decimalTotal = _decimalTotal.add(inputs[j].getDecimal());
+                }
+                _isDecimal = true;
+                _count += runEnd - i;
+                break;
+            case NumberLong:
+                // Avoid summation using double as that loses precision.
+                for (size_t j = i; j < runEnd; j++) {
+                    _nonDecimalTotal.addLong(inputs[j].getLong());
+                }
+                _count += runEnd - i;
+                break;
+            case NumberInt:
+            case NumberDouble:
+                for (size_t j = i; j < runEnd; j++) {
+                    _nonDecimalTotal.addDouble(inputs[j].getDouble());
+                }
+                _count += runEnd - i;
+                break;
+            default:
+                // Non-numeric values do not contribute to the average.
+                dassert(!inputs[i].numeric());
+                break;
+        }
+        i = runEnd;
+    }
+}
+
 intrusive_ptr<AccumulatorState> AccumulatorAvg::create(
     const boost::intrusive_ptr<ExpressionContext>& expCtx) {
     return new AccumulatorAvg(expCtx);
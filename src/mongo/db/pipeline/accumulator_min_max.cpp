@@ -29,6 +29,8 @@
 
 #include "mongo/platform/basic.h"
 
+#include <cmath>
+
 #include "mongo/db/pipeline/accumulator.h"
 
 #include "mongo/db/exec/document_value/value.h"
@@ -62,6 +64,66 @@ void AccumulatorMinMax::processInternal(const Value& input, bool merging) {
     }
 }
 
+void AccumulatorMinMax::processBatchInternal(const std::vector<Value>& inputs, bool merging) {
+    const size_t n = inputs.size();
+    size_t i = 0;
+    while (i < n) {
+        // Find the run of values sharing the current value's type. For runs of basic numerics the
+        // best candidate is selected with primitive comparisons, so the full Value comparator only
+        // runs once per run instead of once per value. Numeric comparisons are unaffected by the
+        // collation, so this is safe under any collator.
+        const BSONType runType = inputs[i].getType();
+        size_t runEnd = i + 1;
+        while (runEnd < n && inputs[runEnd].getType() == runType) {
+            runEnd++;
+        }
+
+        // Selects the run's best element according to '_sense' and processes only that element.
+        // Ties keep the earliest element, like repeated processInternal() calls would.
+        auto pickBest = [&](auto getter) {
+            size_t best = i;
+            for (size_t j = i + 1; j < runEnd; j++) {
+                if (_sense == MIN ? getter(inputs[j]) < getter(inputs[best])
+                                  : getter(inputs[j]) > getter(inputs[best])) {
+                    best = j;
+                }
+            }
+            processInternal(inputs[best], merging);
+        };
+
+        switch (runType) {
+            case NumberInt:
+                pickBest([](const Value& val) { return val.getInt(); });
+                break;
+            case NumberLong:
+                pickBest([](const Value& val) { return val.getLong(); });
+                break;
+            case NumberDouble: {
+                // NaN sorts below all other doubles, which primitive comparisons do not reflect,
+                // so runs containing NaN fall through to the one-at-a-time path.
+                bool runHasNaN = false;
+                for (size_t j = i; j < runEnd && !runHasNaN; j++) {
+                    runHasNaN = std::isnan(inputs[j].getDouble());
+                }
+                if (runHasNaN) {
+                    for (size_t j = i; j < runEnd; j++) {
+                        processInternal(inputs[j], merging);
+                    }
+                } else {
+                    pickBest([](const Value& val) { return val.getDouble(); });
+                }
+                break;
+            }
+            default:
+                for (size_t j = i; j < runEnd; j++) {
+                    processInternal(inputs[j], merging);
+                }
+                break;
+        }
+        i = runEnd;
+    }
+}
+
 Value AccumulatorMinMax::getValue(bool toBeMerged) {
     if (_val.missing()) {
         return Value(BSONNULL);
@@ -31,16 +31,37 @@
 
 #include "mongo/db/pipeline/accumulator.h"
 
+#include <boost/filesystem/operations.hpp>
+
 #include "mongo/db/exec/document_value/value.h"
 #include "mongo/db/pipeline/accumulation_statement.h"
 #include "mongo/db/pipeline/expression_context.h"
 #include "mongo/db/query/query_knobs_gen.h"
+#include "mongo/util/destructor_guard.h"
 
 namespace mongo {
 
 using boost::intrusive_ptr;
 using std::vector;
 
+namespace {
+
+/**
+ * Generates a new file name on each call using a static, atomic and monotonically increasing
+ * number.
+ *
+ * Each user of the Sorter must implement this function to ensure that all temporary files that the
+ * Sorter instances produce are uniquely identified using a unique file name extension with separate
+ * atomic variable. This is necessary because the sorter.cpp code is separately included in multiple
+ * places, rather than compiled in one place and linked, and so cannot provide a globally unique ID.
+ */
+std::string nextFileName() {
+    static AtomicWord<unsigned> accumulatorPushFileCounter;
+    return "extsort-push." + std::to_string(accumulatorPushFileCounter.fetchAndAdd(1));
+}
+
+}  // namespace
+
 REGISTER_ACCUMULATOR(push, genericParseSingleExpressionAccumulator<AccumulatorPush>);
 
 const char* AccumulatorPush::getOpName() const {
@@ -48,15 +69,25 @@ const char* AccumulatorPush::getOpName() const {
 }
 
 void AccumulatorPush::processInternal(const Value& input, bool merging) {
+    auto checkMemUsage = [this] {
+        if (_memUsageBytes < _maxMemUsageBytes) {
+            return;
+        }
+        if (_diskUseAllowed) {
+            spill();
+            return;
+        }
+        uasserted(ErrorCodes::ExceededMemoryLimit,
+                  str::stream()
+                      << "$push used too much memory and cannot spill to disk. Memory limit: "
+                      << _maxMemUsageBytes << " bytes");
+    };
+
     if (!merging) {
         if (!input.missing()) {
             _array.push_back(input);
             _memUsageBytes += input.getApproximateSize();
-            uassert(ErrorCodes::ExceededMemoryLimit,
-                    str::stream()
-                        << "$push used too much memory and cannot spill to disk. Memory limit: "
-                        << _maxMemUsageBytes << " bytes",
-                    _memUsageBytes < _maxMemUsageBytes);
+            checkMemUsage();
         }
     } else {
         // If we're merging, we need to take apart the arrays we receive and put their elements into
@@ -64,32 +95,74 @@ void AccumulatorPush::processInternal(const Value& input, bool merging) {
         // array from each merge source.
         invariant(input.getType() == Array);
 
-        const vector<Value>& vec = input.getArray();
-        for (auto&& val : vec) {
+        for (auto&& val : input.getArray()) {
+            _array.push_back(val);
             _memUsageBytes += val.getApproximateSize();
-            uassert(ErrorCodes::ExceededMemoryLimit,
-                    str::stream()
-                        << "$push used too much memory and cannot spill to disk. Memory limit: "
-                        << _maxMemUsageBytes << " bytes",
-                    _memUsageBytes < _maxMemUsageBytes);
+            checkMemUsage();
         }
-        _array.insert(_array.end(), vec.begin(), vec.end());
     }
 }
 
+void AccumulatorPush::spill() {
+    invariant(_diskUseAllowed);
+    _usedDisk = true;
+    SortedFileWriter<Value, Value> writer(SortOptions().TempDir(getExpressionContext()->tempDir),
+                                          _fileName,
+                                          _nextSortedFileWriterOffset);
+    for (auto&& val : _array) {
+        writer.addAlreadySorted(Value(), val);
+    }
+    _spilledChunks.emplace_back(writer.done());
+    _nextSortedFileWriterOffset = writer.getFileEndOffset();
+
+    vector<Value>().swap(_array);
+    _memUsageBytes = sizeof(*this);
+}
+
 Value AccumulatorPush::getValue(bool toBeMerged) {
+    if (_spilledChunks.empty()) {
+        return Value(_array);
+    }
+
+    // Stream the spilled chunks back in the order they were written, followed by the in-memory
+    // tail, so insertion order is preserved. The merged array replaces the spill state since the
+    // chunk iterators are single-pass; a subsequent call takes the in-memory path above.
+    vector<Value> merged;
+    for (auto&& chunk : _spilledChunks) {
+        chunk->openSource();
+        while (chunk->more()) {
+            merged.push_back(chunk->next().second);
+        }
+        chunk->closeSource();
+    }
+    merged.insert(merged.end(), _array.begin(), _array.end());
+    _array = std::move(merged);
+    _spilledChunks.clear();
     return Value(_array);
 }
 
 AccumulatorPush::AccumulatorPush(const boost::intrusive_ptr<ExpressionContext>& expCtx,
                                  boost::optional<int> maxMemoryUsageBytes)
     : AccumulatorState(expCtx),
-      _maxMemUsageBytes(maxMemoryUsageBytes.value_or(internalQueryMaxPushBytes.load())) {
+      _maxMemUsageBytes(maxMemoryUsageBytes.value_or(internalQueryMaxPushBytes.load())),
+      _diskUseAllowed(expCtx->allowDiskUse && !expCtx->inMongos) {
+    if (_diskUseAllowed) {
+        _fileName = expCtx->tempDir + "/" + nextFileName();
+    }
     _memUsageBytes = sizeof(*this);
 }
 
+AccumulatorPush::~AccumulatorPush() {
+    // Close any open file handles before deleting the spill file.
+    _spilledChunks.clear();
+    if (_usedDisk) {
+        DESTRUCTOR_GUARD(boost::filesystem::remove(_fileName));
+    }
+}
+
 void AccumulatorPush::reset() {
     vector<Value>().swap(_array);
+    _spilledChunks.clear();
     _memUsageBytes = sizeof(*this);
 }
 
@@ -98,3 +171,6 @@ intrusive_ptr<AccumulatorState> AccumulatorPush::create(
     return new AccumulatorPush(expCtx, boost::none);
 }
 }  // namespace mongo
+
+#include "mongo/db/sorter/sorter.cpp"
+// Explicit instantiation unneeded since we aren't exposing Sorter outside of this file.
@@ -29,6 +29,7 @@
 
 #include "mongo/platform/basic.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
@@ -85,6 +86,69 @@ void AccumulatorSum::processInternal(const Value& input, bool merging) {
     }
 }
 
+void AccumulatorSum::processBatchInternal(const std::vector<Value>& inputs, bool merging) {
+    const size_t n = inputs.size();
+    size_t i = 0;
+    while (i < n) {
+        // Find the run of values sharing the current value's type, so that the type dispatch below
+        // is performed once per run rather than once per value.
+        const BSONType runType = inputs[i].getType();
+        size_t runEnd = i + 1;
+        while (runEnd < n && inputs[runEnd].getType() == runType) {
+            runEnd++;
+        }
+
+        switch (runType) {
+            case NumberInt: {
+                totalType = Value::getWidestNumeric(totalType, runType);
+                // A run of ints is pre-summed into a 64-bit total with a simple loop the compiler
+                // can vectorize. The partial total is flushed periodically so it cannot overflow:
+                // each partial is bounded by 2^20 values of magnitude below 2^31.
+                constexpr size_t kIntsPerPartial = 1 << 20;
+                while (i < runEnd) {
+                    const size_t partialEnd = std::min(runEnd, i + kIntsPerPartial);
+                    long long partial = 0;
+                    for (size_t j = i; j < partialEnd; j++) {
+                        partial += inputs[j].getInt();
+                    }
+                    nonDecimalTotal.addLong(partial);
+                    i = partialEnd;
+                }
+                break;
+            }
+            case NumberLong:
+                totalType = Value::getWidestNumeric(totalType, runType);
+                // Longs are added one at a time, since overflow of the exact long total must be
+                // detected per addition.
+                for (; i < runEnd; i++) {
+                    nonDecimalTotal.addLong(inputs[i].getLong());
+                }
+                break;
+            case NumberDouble:
+                totalType = Value::getWidestNumeric(totalType, runType);
+                // The compensated summation is order-dependent, so doubles are added in input
+                // order; hoisting the dispatch still avoids a switch per value.
+                for (; i < runEnd; i++) {
+                    nonDecimalTotal.addDouble(inputs[i].getDouble());
+                }
+                break;
+            case NumberDecimal:
+                totalType = Value::getWidestNumeric(totalType, runType);
+                for (; i < runEnd; i++) {
+                    decimalTotal = decimalTotal.add(inputs[i].getDecimal());
+                }
+                break;
+            default:
+                // Non-numeric values are ignored, except for the merge documents produced by
+                // getValue(true), which processInternal() knows how to unpack.
+                for (; i < runEnd; i++) {
+                    processInternal(inputs[i], merging);
+                }
+                break;
+        }
+    }
+}
+
 intrusive_ptr<AccumulatorState> AccumulatorSum::create(
     const boost::intrusive_ptr<ExpressionContext>& expCtx) {
     return new AccumulatorSum(expCtx);
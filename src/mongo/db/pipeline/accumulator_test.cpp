@@ -41,6 +41,7 @@
 #include "mongo/db/query/collation/collator_interface_mock.h"
 #include "mongo/dbtests/dbtests.h"
 #include "mongo/logv2/log.h"
+#include "mongo/unittest/temp_dir.h"
 
 namespace AccumulatorTests {
 
@@ -70,6 +71,16 @@ static void assertExpectedResults(
                 ASSERT_EQUALS(op.second.getType(), result.getType());
             }
 
+            // Asserts that the batch entry point gives the same result as processing the values
+            // one at a time.
+            {
+                auto accum = AccName::create(expCtx);
+                accum->processBatch(op.first, false);
+                Value result = accum->getValue(false);
+                ASSERT_VALUE_EQ(op.second, result);
+                ASSERT_EQUALS(op.second.getType(), result.getType());
+            }
+
             // Asserts that result equals expected result when all input is on one shard.
             {
                 auto accum = AccName::create(expCtx);
@@ -368,6 +379,53 @@ TEST(Accumulators, PushRespectsMaxMemoryConstraint) {
         ErrorCodes::ExceededMemoryLimit);
 }
 
+TEST(Accumulators, PushSpillsToDiskAndPreservesOrderWhenDiskUseAllowed) {
+    intrusive_ptr<ExpressionContextForTest> expCtx(new ExpressionContextForTest());
+    unittest::TempDir tempDir("AccumulatorPushTest");
+    expCtx->tempDir = tempDir.path();
+    expCtx->allowDiskUse = true;
+
+    // A limit small enough that every few values trigger a spill.
+    const int maxMemoryBytes = 256;
+    auto push = AccumulatorPush(expCtx, maxMemoryBytes);
+    std::vector<Value> expected;
+    for (int i = 0; i < 100; ++i) {
+        auto val = Value("a string long enough to contribute to the memory total"_sd);
+        push.process(val, false);
+        expected.push_back(val);
+        push.process(Value(i), false);
+        expected.push_back(Value(i));
+    }
+
+    ASSERT_VALUE_EQ(Value(expected), push.getValue(false));
+    // The accumulator remains usable after finalization has merged the spilled chunks.
+    ASSERT_VALUE_EQ(Value(expected), push.getValue(false));
+}
+
+TEST(Accumulators, AddToSetSpillsToDiskAndDeduplicatesWhenDiskUseAllowed) {
+    intrusive_ptr<ExpressionContextForTest> expCtx(new ExpressionContextForTest());
+    unittest::TempDir tempDir("AccumulatorAddToSetTest");
+    expCtx->tempDir = tempDir.path();
+    expCtx->allowDiskUse = true;
+
+    // A limit small enough that every few values trigger a spill.
+    const int maxMemoryBytes = 256;
+    auto addToSet = AccumulatorAddToSet(expCtx, maxMemoryBytes);
+    for (int pass = 0; pass < 2; ++pass) {
+        // The second pass re-adds values whose first occurrences have been spilled, which must not
+        // produce duplicates in the final set.
+        for (int i = 0; i < 100; ++i) {
+            addToSet.process(Value("a string long enough to contribute to the memory total #" +
+                                   std::to_string(i)),
+                             false);
+        }
+    }
+
+    auto result = addToSet.getValue(false);
+    ASSERT_EQUALS(result.getType(), Array);
+    ASSERT_EQUALS(result.getArrayLength(), 100u);
+}
+
 /* ------------------------- AccumulatorMergeObjects -------------------------- */
 
 TEST(AccumulatorMergeObjects, MergingZeroObjectsShouldReturnEmptyDocument) {
@@ -51,11 +51,13 @@
 #include "mongo/db/pipeline/document_source_mock.h"
 #include "mongo/db/pipeline/document_source_sort.h"
 #include "mongo/db/pipeline/process_interface/stub_mongo_process_interface.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/repl/oplog_entry.h"
 #include "mongo/db/repl/replication_coordinator_mock.h"
 #include "mongo/db/transaction_history_iterator.h"
 #include "mongo/unittest/death_test.h"
 #include "mongo/unittest/unittest.h"
+#include "mongo/util/scopeguard.h"
 #include "mongo/util/uuid.h"
 
 namespace mongo {
@@ -571,6 +573,33 @@ TEST_F(ChangeStreamStageTest, TransformInsertDocKeyXAndId) {
     checkTransformation(insert2, expectedInsert, {{"x"}, {"_id"}});
 }
 
+TEST_F(ChangeStreamStageTest, TransformInsertWithSharedEventCacheEnabled) {
+    internalDocumentSourceChangeStreamEventCacheSize.store(100);
+    ON_BLOCK_EXIT([] { internalDocumentSourceChangeStreamEventCacheSize.store(0); });
+
+    auto insert = makeOplogEntry(OpTypeEnum::kInsert,           // op type
+                                 nss,                           // namespace
+                                 BSON("_id" << 1 << "x" << 2),  // o
+                                 testUuid(),                    // uuid
+                                 boost::none,                   // fromMigrate
+                                 boost::none);                  // o2
+
+    Document expectedInsert{
+        {DSChangeStream::kIdField,
+         makeResumeToken(kDefaultTs, testUuid(), BSON("x" << 2 << "_id" << 1))},
+        {DSChangeStream::kOperationTypeField, DSChangeStream::kInsertOpType},
+        {DSChangeStream::kClusterTimeField, kDefaultTs},
+        {DSChangeStream::kFullDocumentField, D{{"_id", 1}, {"x", 2}}},
+        {DSChangeStream::kNamespaceField, D{{"db", nss.db()}, {"coll", nss.coll()}}},
+        {DSChangeStream::kDocumentKeyField, D{{"x", 2}, {"_id", 1}}},
+    };
+
+    // The first transformation populates the shared cache; the second, through a separate stage
+    // as a concurrent stream would use, is served from it. Both must produce the same event.
+    checkTransformation(insert, expectedInsert, {{"x"}, {"_id"}});
+    checkTransformation(insert, expectedInsert, {{"x"}, {"_id"}});
+}
+
 TEST_F(ChangeStreamStageTest, TransformInsertDocKeyIdAndX) {
     auto insert = makeOplogEntry(OpTypeEnum::kInsert,           // op type
                                  nss,                           // namespace
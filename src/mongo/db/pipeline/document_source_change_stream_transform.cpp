@@ -49,13 +49,16 @@
 #include "mongo/db/pipeline/expression.h"
 #include "mongo/db/pipeline/lite_parsed_document_source.h"
 #include "mongo/db/pipeline/resume_token.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/repl/bson_extract_optime.h"
 #include "mongo/db/repl/oplog_entry.h"
 #include "mongo/db/repl/oplog_entry_gen.h"
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/transaction_history_iterator.h"
+#include "mongo/platform/mutex.h"
 #include "mongo/s/catalog_cache.h"
 #include "mongo/s/grid.h"
+#include "mongo/util/lru_cache.h"
 
 namespace mongo {
 
@@ -67,6 +70,82 @@ using std::vector;
 
 namespace {
 constexpr auto checkValueType = &DocumentSourceChangeStream::checkValueType;
+
+/**
+ * A process-wide cache of transformed change events, shared by all change streams on this node.
+ * When many streams tail the same region of the oplog, only the first stream to reach an entry
+ * pays for decoding it into a change event; the others are served the finished Document, which is
+ * immutable and cheap to share. The capacity tracks the server parameter on every access, so the
+ * cache can be enabled, resized or disabled at runtime.
+ */
+class ChangeStreamEventCache {
+public:
+    boost::optional<Document> lookup(const std::string& key) {
+        const auto capacity = _loadCapacity();
+        stdx::lock_guard<Latch> lk(_mutex);
+        if (!_refresh(capacity)) {
+            return boost::none;
+        }
+        auto it = _cache->find(key);
+        if (it == _cache->end()) {
+            return boost::none;
+        }
+        return it->second;
+    }
+
+    void insert(const std::string& key, const Document& event) {
+        const auto capacity = _loadCapacity();
+        stdx::lock_guard<Latch> lk(_mutex);
+        if (_refresh(capacity)) {
+            _cache->add(key, event);
+        }
+    }
+
+private:
+    static size_t _loadCapacity() {
+        return static_cast<size_t>(internalDocumentSourceChangeStreamEventCacheSize.load());
+    }
+
+    // Discards the cache when the parameter is 0 and rebuilds it when the capacity has changed.
+    // Returns true if the cache is enabled.
+    bool _refresh(size_t capacity) {
+        if (capacity == 0) {
+            _cache.reset();
+            return false;
+        }
+        if (!_cache || _capacity != capacity) {
+            _cache = std::make_unique<LRUCache<std::string, Document>>(capacity);
+            _capacity = capacity;
+        }
+        return true;
+    }
+
+    Mutex _mutex = MONGO_MAKE_LATCH("ChangeStreamEventCache::_mutex");
+    size_t _capacity = 0;
+    std::unique_ptr<LRUCache<std::string, Document>> _cache;
+};
+
+ChangeStreamEventCache changeStreamEventCache;
+
+/**
+ * Builds the cache key for one oplog entry. The timestamp identifies the entry; the remaining
+ * components capture everything stream-specific that can influence the transformed event, so
+ * that streams configured differently never share an entry.
+ */
+std::string makeEventCacheKey(Timestamp ts,
+                              const Value& uuid,
+                              ServerGlobalParams::FeatureCompatibility::Version fcv,
+                              bool includePreImageOptime,
+                              const std::vector<FieldPath>& documentKeyFields) {
+    StringBuilder sb;
+    sb << ts.asULL() << ':' << uuid.toString() << ':' << static_cast<int>(fcv) << ':'
+       << includePreImageOptime;
+    for (auto&& field : documentKeyFields) {
+        sb << ':' << field.fullPath();
+    }
+    return sb.str();
+}
+
 }  // namespace
 
 boost::intrusive_ptr<DocumentSourceChangeStreamTransform>
@@ -217,6 +296,26 @@ Document DocumentSourceChangeStreamTransform::applyTransformation(const Document
 
         documentKeyFields = _documentKeyCache.find(uuid.getUuid())->second.documentKeyFields;
     }
+
+    // If the shared event cache is enabled, another change stream may already have transformed
+    // this oplog entry; the timestamp uniquely identifies it on this node. Entries from within a
+    // transaction are never cached, since their events depend on this stream's position in the
+    // 'applyOps' unwind.
+    std::string eventCacheKey;
+    if (!_txnIterator && internalDocumentSourceChangeStreamEventCacheSize.load() > 0) {
+        eventCacheKey = makeEventCacheKey(
+            ts.getTimestamp(), uuid, _fcv, _includePreImageOptime, documentKeyFields);
+        if (auto cached = changeStreamEventCache.lookup(eventCacheKey)) {
+            return *cached;
+        }
+    }
+    auto finishEvent = [&](Document event) {
+        if (!eventCacheKey.empty()) {
+            changeStreamEventCache.insert(eventCacheKey, event);
+        }
+        return event;
+    };
+
     Value id = input.getNestedField("o._id");
     // Non-replace updates have the _id in field "o2".
     StringData operationType;
@@ -339,7 +438,7 @@ Document DocumentSourceChangeStreamTransform::applyTransformation(const Document
     // "invalidate" and "newShardDetected" entries have fewer fields.
     if (operationType == DocumentSourceChangeStream::kInvalidateOpType ||
         operationType == DocumentSourceChangeStream::kNewShardDetectedOpType) {
-        return doc.freeze();
+        return finishEvent(doc.freeze());
     }
 
     // Add the post-image, pre-image, namespace, documentKey and other fields as appropriate.
@@ -358,7 +457,7 @@ Document DocumentSourceChangeStreamTransform::applyTransformation(const Document
     // Note that 'updateDescription' might be the 'missing' value, in which case it will not be
     // serialized.
     doc.addField("updateDescription", updateDescription);
-    return doc.freeze();
+    return finishEvent(doc.freeze());
 }
 
 Value DocumentSourceChangeStreamTransform::serialize(
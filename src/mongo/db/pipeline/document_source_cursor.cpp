@@ -69,7 +69,7 @@ bool DocumentSourceCursor::Batch::isEmpty() const {
 void DocumentSourceCursor::Batch::enqueue(Document&& doc) {
     switch (_type) {
         case CursorType::kRegular: {
-            _batchOfDocs.push_back(doc.getOwned());
+            _batchOfDocs.push_back(std::move(doc).getOwned());
             _memUsageBytes += _batchOfDocs.back().getApproximateSize();
             break;
         }
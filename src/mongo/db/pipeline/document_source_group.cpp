@@ -35,13 +35,21 @@
 #include "mongo/db/exec/document_value/document.h"
 #include "mongo/db/exec/document_value/value.h"
 #include "mongo/db/exec/document_value/value_comparator.h"
+#include "mongo/db/operation_context.h"
 #include "mongo/db/pipeline/accumulation_statement.h"
 #include "mongo/db/pipeline/accumulator.h"
+#include "mongo/db/pipeline/accumulator_js_reduce.h"
 #include "mongo/db/pipeline/document_source_group.h"
 #include "mongo/db/pipeline/expression.h"
 #include "mongo/db/pipeline/expression_context.h"
+#include "mongo/db/pipeline/expression_function.h"
+#include "mongo/db/pipeline/expression_js_emit.h"
 #include "mongo/db/pipeline/lite_parsed_document_source.h"
+#include "mongo/db/query/query_knobs_gen.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/util/concurrency/thread_name.h"
 #include "mongo/util/destructor_guard.h"
+#include "mongo/util/producer_consumer_queue.h"
 
 namespace mongo {
 
@@ -61,6 +69,40 @@ std::string nextFileName() {
     return "extsort-doc-group." + std::to_string(documentSourceGroupFileCounter.fetchAndAdd(1));
 }
 
+/**
+ * Number of partitions the spilled groups are hashed into. Each partition is re-aggregated in
+ * memory once the input is exhausted, so this should be large enough that a single partition of
+ * a spilling aggregation is likely to fit within the memory limit.
+ */
+constexpr size_t kSpillPartitions = 32;
+
+/**
+ * Maximum number of documents buffered in each parallel $group worker's input queue.
+ */
+constexpr size_t kParallelGroupWorkerQueueDepth = 128;
+
+/**
+ * Returns true if any field name in 'spec', recursively, names a JavaScript expression or
+ * accumulator. JavaScript execution is bound to the operation context of the thread running the
+ * pipeline, so a $group whose spec uses JavaScript must stay single threaded.
+ */
+bool specUsesJavaScript(const BSONObj& spec) {
+    for (auto&& elem : spec) {
+        auto fieldName = elem.fieldNameStringData();
+        if (fieldName == ExpressionFunction::kExpressionName ||
+            fieldName == ExpressionInternalJsEmit::kExpressionName ||
+            fieldName == AccumulatorJs::kAccumulatorName ||
+            fieldName == AccumulatorInternalJsReduce::kAccumulatorName) {
+            return true;
+        }
+        if ((elem.type() == BSONType::Object || elem.type() == BSONType::Array) &&
+            specUsesJavaScript(elem.Obj())) {
+            return true;
+        }
+    }
+    return false;
+}
+
 }  // namespace
 
 using boost::intrusive_ptr;
@@ -152,10 +194,31 @@ DocumentSource::GetNextResult DocumentSourceGroup::doGetNext() {
 }
 
 DocumentSource::GetNextResult DocumentSourceGroup::getNextSpilled() {
-    // We aren't streaming, and we have spilled to disk.
-    if (!_sorterIterator)
-        return GetNextResult::makeEOF();
+    // We aren't streaming, and we have spilled to disk. Partitions are re-aggregated lazily, one
+    // at a time, and the groups of the current partition are emitted from the in-memory map
+    // unless the partition was too large to fit, in which case its sorted chunks are merged.
+    while (true) {
+        if (_sorterIterator) {
+            return getNextFromSortedPartition();
+        }
+
+        if (groupsIterator != _groups->end()) {
+            Document out =
+                makeDocument(groupsIterator->first, groupsIterator->second, pExpCtx->needsMerge);
+            ++groupsIterator;
+            return std::move(out);
+        }
+
+        if (_currentPartition >= _partitionChunks.size()) {
+            dispose();
+            return GetNextResult::makeEOF();
+        }
+
+        loadPartition(_currentPartition++);
+    }
+}
 
+DocumentSource::GetNextResult DocumentSourceGroup::getNextFromSortedPartition() {
     _currentId = _firstPartOfNextGroup.first;
     const size_t numAccumulators = _accumulatedFields.size();
 
@@ -169,12 +232,17 @@ DocumentSource::GetNextResult DocumentSourceGroup::getNextSpilled() {
         _currentAccumulators[i]->startNewGroup(initializerValue);
     }
 
+    // With a single accumulator, the group's partials are buffered and merged as one batch, which
+    // lets the accumulator amortize its per-value type dispatch. The buffer stays small: a group
+    // appears at most once per sorted chunk of the partition.
+    std::vector<Value> singleAccumulatorStates;
+
     while (pExpCtx->getValueComparator().evaluate(_currentId == _firstPartOfNextGroup.first)) {
         // Inside of this loop, _firstPartOfNextGroup is the current data being processed.
         // At loop exit, it is the first value to be processed in the next group.
         switch (numAccumulators) {  // mirrors switch in spill()
             case 1:                 // Single accumulators serialize as a single Value.
-                _currentAccumulators[0]->process(_firstPartOfNextGroup.second, true);
+                singleAccumulatorStates.push_back(_firstPartOfNextGroup.second);
             case 0:  // No accumulators so no Values.
                 break;
             default: {  // Multiple accumulators serialize as an array of Values.
@@ -186,13 +254,19 @@ DocumentSource::GetNextResult DocumentSourceGroup::getNextSpilled() {
         }
 
         if (!_sorterIterator->more()) {
-            dispose();
+            // This partition is exhausted; the next getNextSpilled() call moves on to the next
+            // partition (or EOF).
+            _sorterIterator.reset();
             break;
         }
 
         _firstPartOfNextGroup = _sorterIterator->next();
     }
 
+    if (numAccumulators == 1) {
+        _currentAccumulators[0]->processBatch(singleAccumulatorStates, true);
+    }
+
     return makeDocument(_currentId, _currentAccumulators, pExpCtx->needsMerge);
 }
 
@@ -210,9 +284,12 @@ DocumentSource::GetNextResult DocumentSourceGroup::getNextStandard() {
 }
 
 void DocumentSourceGroup::doDispose() {
+    shutdownParallelWorkers();
+
     // Free our resources.
     _groups = pExpCtx->getValueComparator().makeUnorderedValueMap<Accumulators>();
     _sorterIterator.reset();
+    _partitionChunks.clear();
 
     // Make us look done.
     groupsIterator = _groups->end();
@@ -348,6 +425,10 @@ DocumentSourceGroup::DocumentSourceGroup(const intrusive_ptr<ExpressionContext>&
       _groups(pExpCtx->getValueComparator().makeUnorderedValueMap<Accumulators>()),
       _spilled(false),
       _allowDiskUse(pExpCtx->allowDiskUse && !pExpCtx->inMongos) {
+    if (pExpCtx->opCtx) {
+        _memoryLease =
+            AggregationMemoryBroker::get(pExpCtx->opCtx->getServiceContext()).makeLease();
+    }
     if (!pExpCtx->inMongos && (pExpCtx->allowDiskUse || kDebugBuild)) {
         // We spill to disk in debug mode, regardless of allowDiskUse, to stress the system.
         _fileName = pExpCtx->tempDir + "/" + nextFileName();
@@ -355,7 +436,12 @@ DocumentSourceGroup::DocumentSourceGroup(const intrusive_ptr<ExpressionContext>&
 }
 
 DocumentSourceGroup::~DocumentSourceGroup() {
-    if (_ownsFileDeletion) {
+    shutdownParallelWorkers();
+
+    // Close any open file handles before deleting the spill file.
+    _sorterIterator.reset();
+    _partitionChunks.clear();
+    if (_usedDisk) {
         DESTRUCTOR_GUARD(boost::filesystem::remove(_fileName));
     }
 }
@@ -477,75 +563,27 @@ private:
 }  // namespace
 
 DocumentSource::GetNextResult DocumentSourceGroup::initialize() {
+    if (!_parallelDecided) {
+        // Decide exactly once, on the first document request, whether to aggregate on worker
+        // threads.
+        _parallelDecided = true;
+        const int concurrency = internalQueryParallelGroupConcurrency.load();
+        if (concurrency > 1 && canGroupInParallel()) {
+            startParallelWorkers(concurrency);
+        }
+    }
+    if (_parallelState) {
+        return initializeParallel();
+    }
+
     const size_t numAccumulators = _accumulatedFields.size();
 
     // Barring any pausing, this loop exhausts 'pSource' and populates '_groups'.
     GetNextResult input = pSource->getNext();
     for (; input.isAdvanced(); input = pSource->getNext()) {
-        if (_memoryUsageBytes > _maxMemoryUsageBytes) {
-            uassert(ErrorCodes::QueryExceededMemoryLimitNoDiskUseAllowed,
-                    "Exceeded memory limit for $group, but didn't allow external sort."
-                    " Pass allowDiskUse:true to opt in.",
-                    _allowDiskUse);
-            _sortedFiles.push_back(spill());
-            _memoryUsageBytes = 0;
-        }
-
         // We release the result document here so that it does not outlive the end of this loop
         // iteration. Not releasing could lead to an array copy when this group follows an unwind.
-        auto rootDocument = input.releaseDocument();
-        Value id = computeId(rootDocument);
-
-        // Look for the _id value in the map. If it's not there, add a new entry with a blank
-        // accumulator. This is done in a somewhat odd way in order to avoid hashing 'id' and
-        // looking it up in '_groups' multiple times.
-        const size_t oldSize = _groups->size();
-        vector<intrusive_ptr<AccumulatorState>>& group = (*_groups)[id];
-        const bool inserted = _groups->size() != oldSize;
-
-        if (inserted) {
-            _memoryUsageBytes += id.getApproximateSize();
-
-            // Initialize and add the accumulators
-            Value expandedId = expandId(id);
-            Document idDoc =
-                expandedId.getType() == BSONType::Object ? expandedId.getDocument() : Document();
-            group.reserve(numAccumulators);
-            for (auto&& accumulatedField : _accumulatedFields) {
-                auto accum = accumulatedField.makeAccumulator();
-                Value initializerValue =
-                    accumulatedField.expr.initializer->evaluate(idDoc, &pExpCtx->variables);
-                accum->startNewGroup(initializerValue);
-                group.push_back(accum);
-            }
-        } else {
-            for (auto&& groupObj : group) {
-                // subtract old mem usage. New usage added back after processing.
-                _memoryUsageBytes -= groupObj->memUsageForSorter();
-            }
-        }
-
-        /* tickle all the accumulators for the group we found */
-        dassert(numAccumulators == group.size());
-
-        for (size_t i = 0; i < numAccumulators; i++) {
-            group[i]->process(
-                _accumulatedFields[i].expr.argument->evaluate(rootDocument, &pExpCtx->variables),
-                _doingMerge);
-
-            _memoryUsageBytes += group[i]->memUsageForSorter();
-        }
-
-        if (kDebugBuild && !storageGlobalParams.readOnly) {
-            // In debug mode, spill every time we have a duplicate id to stress merge logic.
-            if (!inserted &&                 // is a dup
-                !pExpCtx->inMongos &&        // can't spill to disk in mongos
-                !_allowDiskUse &&            // don't change behavior when testing external sort
-                _sortedFiles.size() < 20) {  // don't open too many FDs
-
-                _sortedFiles.push_back(spill());
-            }
-        }
+        processDocument(input.releaseDocument());
     }
 
     switch (input.getStatus()) {
@@ -557,30 +595,24 @@ DocumentSource::GetNextResult DocumentSourceGroup::initialize() {
         }
         case DocumentSource::GetNextResult::ReturnStatus::kEOF: {
             // Do any final steps necessary to prepare to output results.
-            if (!_sortedFiles.empty()) {
+            if (!_partitionChunks.empty()) {
                 _spilled = true;
                 if (!_groups->empty()) {
-                    _sortedFiles.push_back(spill());
+                    spill();
                 }
 
-                // We won't be using groups again so free its memory.
+                // Free the groups map; partitions will be re-aggregated into a fresh map one at
+                // a time by loadPartition().
                 _groups = pExpCtx->getValueComparator().makeUnorderedValueMap<Accumulators>();
+                groupsIterator = _groups->end();
+                _currentPartition = 0;
 
-                _sorterIterator.reset(Sorter<Value, Value>::Iterator::merge(
-                    _sortedFiles,
-                    _fileName,
-                    SortOptions(),
-                    SorterComparator(pExpCtx->getValueComparator())));
-                _ownsFileDeletion = false;
-
-                // prepare current to accumulate data
+                // Prepare to accumulate data for partitions that exceed the memory limit and
+                // fall back to a sorted merge of their chunks.
                 _currentAccumulators.reserve(numAccumulators);
                 for (auto&& accumulatedField : _accumulatedFields) {
                     _currentAccumulators.push_back(accumulatedField.makeAccumulator());
                 }
-
-                verify(_sorterIterator->more());  // we put data in, we should get something out.
-                _firstPartOfNextGroup = _sorterIterator->next();
             } else {
                 // start the group iterator
                 groupsIterator = _groups->begin();
@@ -595,12 +627,253 @@ DocumentSource::GetNextResult DocumentSourceGroup::initialize() {
     MONGO_UNREACHABLE;
 }
 
+void DocumentSourceGroup::processDocument(const Document& rootDocument) {
+    const size_t numAccumulators = _accumulatedFields.size();
+
+    _memoryLease.reportUsage(_memoryUsageBytes);
+    if (_memoryUsageBytes > _memoryLease.effectiveLimit(_maxMemoryUsageBytes)) {
+        uassert(ErrorCodes::QueryExceededMemoryLimitNoDiskUseAllowed,
+                "Exceeded memory limit for $group, but didn't allow external sort."
+                " Pass allowDiskUse:true to opt in.",
+                _allowDiskUse);
+        spill();
+        _memoryUsageBytes = 0;
+    }
+
+    Value id = computeId(rootDocument);
+
+    // Look for the _id value in the map. If it's not there, add a new entry with a blank
+    // accumulator. This is done in a somewhat odd way in order to avoid hashing 'id' and
+    // looking it up in '_groups' multiple times.
+    const size_t oldSize = _groups->size();
+    vector<intrusive_ptr<AccumulatorState>>& group = (*_groups)[id];
+    const bool inserted = _groups->size() != oldSize;
+
+    if (inserted) {
+        _memoryUsageBytes += id.getApproximateSize();
+
+        // Initialize and add the accumulators
+        Value expandedId = expandId(id);
+        Document idDoc =
+            expandedId.getType() == BSONType::Object ? expandedId.getDocument() : Document();
+        group.reserve(numAccumulators);
+        for (auto&& accumulatedField : _accumulatedFields) {
+            auto accum = accumulatedField.makeAccumulator();
+            Value initializerValue =
+                accumulatedField.expr.initializer->evaluate(idDoc, &pExpCtx->variables);
+            accum->startNewGroup(initializerValue);
+            group.push_back(accum);
+        }
+    } else {
+        for (auto&& groupObj : group) {
+            // subtract old mem usage. New usage added back after processing.
+            _memoryUsageBytes -= groupObj->memUsageForSorter();
+        }
+    }
+
+    /* tickle all the accumulators for the group we found */
+    dassert(numAccumulators == group.size());
+
+    for (size_t i = 0; i < numAccumulators; i++) {
+        group[i]->process(
+            _accumulatedFields[i].expr.argument->evaluate(rootDocument, &pExpCtx->variables),
+            _doingMerge);
+
+        _memoryUsageBytes += group[i]->memUsageForSorter();
+    }
+
+    if (kDebugBuild && !storageGlobalParams.readOnly) {
+        // In debug mode, spill every time we have a duplicate id to stress merge logic.
+        if (!inserted &&           // is a dup
+            !_isParallelWorker &&  // workers are merged from their in-memory maps; never spill
+            !pExpCtx->inMongos &&  // can't spill to disk in mongos
+            !_allowDiskUse &&      // don't change behavior when testing external sort
+            _numSpills < 20) {     // don't open too many FDs
+
+            spill();
+        }
+    }
+}
+
+struct DocumentSourceGroup::ParallelState {
+    struct Worker {
+        boost::intrusive_ptr<DocumentSourceGroup> group;
+        std::unique_ptr<SingleProducerSingleConsumerQueue<Document>> queue;
+        stdx::thread thread;
+
+        // Set by the worker thread on failure, before it closes the consumer end of its queue
+        // to unblock the feeding thread. Examined after all workers have been joined.
+        Status status = Status::OK();
+    };
+
+    std::vector<Worker> workers;
+
+    // Index of the worker that receives the next input document.
+    size_t nextWorker = 0;
+};
+
+bool DocumentSourceGroup::canGroupInParallel() const {
+    // A merging $group must fold every partial result into a single map, and a spilling $group
+    // writes per-instance files; neither composes with private worker instances. mongos never
+    // aggregates enough data locally to be worth worker threads.
+    if (_doingMerge || pExpCtx->allowDiskUse || pExpCtx->inMongos) {
+        return false;
+    }
+
+    // Folding worker partials reuses the spill serialization round trip, which is only correct
+    // for accumulators whose result does not depend on the order of their inputs. The order in
+    // which a worker sees its share of the input is not the pipeline order.
+    for (auto&& accumulatedField : _accumulatedFields) {
+        StringData opName(accumulatedField.makeAccumulator()->getOpName());
+        if (opName == "$first"_sd || opName == "$last"_sd || opName == "$push"_sd ||
+            opName == "$mergeObjects"_sd) {
+            return false;
+        }
+    }
+
+    return !specUsesJavaScript(serialize().getDocument().toBson());
+}
+
+void DocumentSourceGroup::startParallelWorkers(int numWorkers) {
+    auto spec = serialize().getDocument().toBson();
+
+    _parallelState = std::make_unique<ParallelState>();
+    _parallelState->workers.resize(numWorkers);
+    for (auto&& worker : _parallelState->workers) {
+        // Each worker re-parses the group spec against a copy of the ExpressionContext, so that
+        // expression evaluation state (in particular Variables) is private to its thread.
+        auto workerExpCtx = pExpCtx->copyWith(pExpCtx->ns);
+        worker.group = boost::intrusive_ptr<DocumentSourceGroup>(static_cast<DocumentSourceGroup*>(
+            createFromBson(spec.firstElement(), workerExpCtx).get()));
+        worker.group->_isParallelWorker = true;
+        worker.group->_maxMemoryUsageBytes =
+            std::max<size_t>(_maxMemoryUsageBytes / numWorkers, 1);
+        // Workers enforce a fixed, even split of this stage's budget; only the parent stage
+        // participates in pool rebalancing.
+        worker.group->_memoryLease.release();
+
+        SingleProducerSingleConsumerQueue<Document>::Options options;
+        options.maxQueueDepth = kParallelGroupWorkerQueueDepth;
+        worker.queue = std::make_unique<SingleProducerSingleConsumerQueue<Document>>(options);
+    }
+
+    // Start the threads only once the workers vector is fully built, since each thread holds a
+    // reference into it.
+    for (auto&& worker : _parallelState->workers) {
+        worker.thread = stdx::thread([&worker] {
+            setThreadName("ParallelGroupWorker");
+
+            try {
+                while (true) {
+                    worker.group->processDocument(worker.queue->pop());
+                }
+            } catch (const ExceptionFor<ErrorCodes::ProducerConsumerQueueConsumed>&) {
+                // The feeding thread closed the producer end: this worker's share of the input
+                // is exhausted.
+            } catch (...) {
+                worker.status = exceptionToStatus();
+                worker.queue->closeConsumerEnd();
+            }
+        });
+    }
+}
+
+DocumentSource::GetNextResult DocumentSourceGroup::initializeParallel() {
+    auto& workers = _parallelState->workers;
+
+    // Barring any pausing, this loop exhausts 'pSource', distributing its documents round-robin
+    // over the worker queues.
+    GetNextResult input = pSource->getNext();
+    for (; input.isAdvanced(); input = pSource->getNext()) {
+        auto& worker = workers[_parallelState->nextWorker];
+        _parallelState->nextWorker = (_parallelState->nextWorker + 1) % workers.size();
+        try {
+            worker.queue->push(input.releaseDocument());
+        } catch (const ExceptionFor<ErrorCodes::ProducerConsumerQueueEndClosed>&) {
+            // The worker failed and closed its queue to unblock this thread. Stop feeding; the
+            // worker's original error is rethrown below once every worker has been joined.
+            break;
+        }
+    }
+
+    if (input.getStatus() == GetNextResult::ReturnStatus::kPauseExecution) {
+        // Propagate pause. The queues stay open and this method is re-entered, so the workers
+        // keep draining what has been fed so far.
+        return input;
+    }
+
+    for (auto&& worker : workers) {
+        worker.queue->closeProducerEnd();
+    }
+    for (auto&& worker : workers) {
+        worker.thread.join();
+    }
+    for (auto&& worker : workers) {
+        uassertStatusOK(worker.status);
+    }
+
+    // Fold each worker's partial groups into this stage's map. The partials make the same
+    // serialization round trip as spilled groups.
+    const size_t numAccumulators = _accumulatedFields.size();
+    for (auto&& worker : workers) {
+        for (auto&& group : *worker.group->_groups) {
+            Value accumStates;
+            switch (numAccumulators) {  // mirrors switch in spill()
+                case 0:
+                    break;
+                case 1:
+                    accumStates = group.second[0]->getValue(/*toBeMerged=*/true);
+                    break;
+                default: {
+                    vector<Value> states;
+                    states.reserve(numAccumulators);
+                    for (auto&& accum : group.second) {
+                        states.push_back(accum->getValue(/*toBeMerged=*/true));
+                    }
+                    accumStates = Value(std::move(states));
+                }
+            }
+            mergeSpilledGroup(group.first, accumStates);
+        }
+    }
+    _parallelState.reset();
+
+    // Each worker had an equal share of the memory budget, so the merged map should respect the
+    // overall limit unless the partial maps overlapped badly.
+    uassert(ErrorCodes::QueryExceededMemoryLimitNoDiskUseAllowed,
+            "Exceeded memory limit for $group, but didn't allow external sort."
+            " Pass allowDiskUse:true to opt in.",
+            _memoryUsageBytes <= _maxMemoryUsageBytes);
+
+    // start the group iterator
+    groupsIterator = _groups->begin();
+    _initialized = true;
+    return input;
+}
+
+void DocumentSourceGroup::shutdownParallelWorkers() {
+    if (!_parallelState) {
+        return;
+    }
+
+    for (auto&& worker : _parallelState->workers) {
+        worker.queue->closeProducerEnd();
+    }
+    for (auto&& worker : _parallelState->workers) {
+        if (worker.thread.joinable()) {
+            worker.thread.join();
+        }
+    }
+    _parallelState.reset();
+}
+
 bool DocumentSourceGroup::usedDisk() {
     return _usedDisk;
 }
 
-shared_ptr<Sorter<Value, Value>::Iterator> DocumentSourceGroup::spill() {
+void DocumentSourceGroup::spill() {
     _usedDisk = true;
+    _numSpills++;
     vector<const GroupsMap::value_type*> ptrs;  // using pointers to speed sorting
     ptrs.reserve(_groups->size());
     for (GroupsMap::const_iterator it = _groups->begin(), end = _groups->end(); it != end; ++it) {
@@ -609,38 +882,150 @@ shared_ptr<Sorter<Value, Value>::Iterator> DocumentSourceGroup::spill() {
 
     stable_sort(ptrs.begin(), ptrs.end(), SpillSTLComparator(pExpCtx->getValueComparator()));
 
-    SortedFileWriter<Value, Value> writer(
-        SortOptions().TempDir(pExpCtx->tempDir), _fileName, _nextSortedFileWriterOffset);
-    switch (_accumulatedFields.size()) {  // same as ptrs[i]->second.size() for all i.
-        case 0:                           // no values, essentially a distinct
-            for (size_t i = 0; i < ptrs.size(); i++) {
-                writer.addAlreadySorted(ptrs[i]->first, Value());
-            }
-            break;
+    if (_partitionChunks.empty()) {
+        _partitionChunks.resize(kSpillPartitions);
+    }
 
-        case 1:  // just one value, use optimized serialization as single Value
-            for (size_t i = 0; i < ptrs.size(); i++) {
-                writer.addAlreadySorted(ptrs[i]->first,
-                                        ptrs[i]->second[0]->getValue(/*toBeMerged=*/true));
-            }
-            break;
+    // Bucket the groups by group key hash. Since the buckets are filled in globally sorted order,
+    // each partition's chunk is itself sorted by group key, which the oversized-partition
+    // fallback in loadPartition() relies on.
+    const auto& valueComparator = pExpCtx->getValueComparator();
+    vector<vector<const GroupsMap::value_type*>> buckets(kSpillPartitions);
+    for (auto&& ptr : ptrs) {
+        buckets[valueComparator.hash(ptr->first) % kSpillPartitions].push_back(ptr);
+    }
 
-        default:  // multiple values, serialize as array-typed Value
-            for (size_t i = 0; i < ptrs.size(); i++) {
-                vector<Value> accums;
-                for (size_t j = 0; j < ptrs[i]->second.size(); j++) {
-                    accums.push_back(ptrs[i]->second[j]->getValue(/*toBeMerged=*/true));
+    for (size_t partition = 0; partition < kSpillPartitions; partition++) {
+        const auto& bucket = buckets[partition];
+        if (bucket.empty()) {
+            continue;
+        }
+
+        SortedFileWriter<Value, Value> writer(
+            SortOptions().TempDir(pExpCtx->tempDir), _fileName, _nextSortedFileWriterOffset);
+        switch (_accumulatedFields.size()) {  // same as bucket[i]->second.size() for all i.
+            case 0:                           // no values, essentially a distinct
+                for (size_t i = 0; i < bucket.size(); i++) {
+                    writer.addAlreadySorted(bucket[i]->first, Value());
                 }
-                writer.addAlreadySorted(ptrs[i]->first, Value(std::move(accums)));
-            }
-            break;
+                break;
+
+            case 1:  // just one value, use optimized serialization as single Value
+                for (size_t i = 0; i < bucket.size(); i++) {
+                    writer.addAlreadySorted(bucket[i]->first,
+                                            bucket[i]->second[0]->getValue(/*toBeMerged=*/true));
+                }
+                break;
+
+            default:  // multiple values, serialize as array-typed Value
+                for (size_t i = 0; i < bucket.size(); i++) {
+                    vector<Value> accums;
+                    for (size_t j = 0; j < bucket[i]->second.size(); j++) {
+                        accums.push_back(bucket[i]->second[j]->getValue(/*toBeMerged=*/true));
+                    }
+                    writer.addAlreadySorted(bucket[i]->first, Value(std::move(accums)));
+                }
+                break;
+        }
+
+        Sorter<Value, Value>::Iterator* iteratorPtr = writer.done();
+        _nextSortedFileWriterOffset = writer.getFileEndOffset();
+        _partitionChunks[partition].emplace_back(iteratorPtr);
     }
 
     _groups->clear();
+}
 
-    Sorter<Value, Value>::Iterator* iteratorPtr = writer.done();
-    _nextSortedFileWriterOffset = writer.getFileEndOffset();
-    return shared_ptr<Sorter<Value, Value>::Iterator>(iteratorPtr);
+void DocumentSourceGroup::loadPartition(size_t partition) {
+    invariant(!_sorterIterator);
+    _groups = pExpCtx->getValueComparator().makeUnorderedValueMap<Accumulators>();
+    _memoryUsageBytes = 0;
+
+    auto& chunks = _partitionChunks[partition];
+    for (size_t chunkIdx = 0; chunkIdx < chunks.size(); ++chunkIdx) {
+        auto& chunk = chunks[chunkIdx];
+        chunk->openSource();
+        while (chunk->more()) {
+            auto data = chunk->next();
+            mergeSpilledGroup(data.first, data.second);
+
+            _memoryLease.reportUsage(_memoryUsageBytes);
+            if (_memoryUsageBytes > _memoryLease.effectiveLimit(_maxMemoryUsageBytes)) {
+                // This partition does not fit in memory. Discard the partial aggregation and
+                // fall back to merging the partition's sorted chunks group by group, which needs
+                // only constant memory. The chunks are re-read from their starting offsets, so
+                // nothing folded into the map so far is lost or double counted.
+                chunk->closeSource();
+                _groups = pExpCtx->getValueComparator().makeUnorderedValueMap<Accumulators>();
+                groupsIterator = _groups->end();
+
+                // Pass an empty file name so the merge iterator does not delete the spill file,
+                // which later partitions still read. The stage deletes it on destruction.
+                _sorterIterator.reset(
+                    Sorter<Value, Value>::Iterator::merge(chunks,
+                                                          std::string(),
+                                                          SortOptions(),
+                                                          SorterComparator(
+                                                              pExpCtx->getValueComparator())));
+                chunks.clear();
+
+                verify(_sorterIterator->more());  // we put data in, we should get something out.
+                _firstPartOfNextGroup = _sorterIterator->next();
+                return;
+            }
+        }
+        chunk->closeSource();
+    }
+    chunks.clear();
+
+    groupsIterator = _groups->begin();
+}
+
+void DocumentSourceGroup::mergeSpilledGroup(const Value& id, const Value& accumStates) {
+    const size_t numAccumulators = _accumulatedFields.size();
+
+    const size_t oldSize = _groups->size();
+    Accumulators& group = (*_groups)[id];
+    const bool inserted = _groups->size() != oldSize;
+
+    if (inserted) {
+        _memoryUsageBytes += id.getApproximateSize();
+
+        // Initialize and add the accumulators
+        Value expandedId = expandId(id);
+        Document idDoc =
+            expandedId.getType() == BSONType::Object ? expandedId.getDocument() : Document();
+        group.reserve(numAccumulators);
+        for (auto&& accumulatedField : _accumulatedFields) {
+            auto accum = accumulatedField.makeAccumulator();
+            Value initializerValue =
+                accumulatedField.expr.initializer->evaluate(idDoc, &pExpCtx->variables);
+            accum->startNewGroup(initializerValue);
+            group.push_back(accum);
+        }
+    } else {
+        for (auto&& groupObj : group) {
+            // subtract old mem usage. New usage added back after processing.
+            _memoryUsageBytes -= groupObj->memUsageForSorter();
+        }
+    }
+
+    switch (numAccumulators) {  // mirrors switch in spill()
+        case 1:                 // Single accumulators serialize as a single Value.
+            group[0]->process(accumStates, true);
+        case 0:  // No accumulators so no Values.
+            break;
+        default: {  // Multiple accumulators serialize as an array of Values.
+            const vector<Value>& accumulatorStates = accumStates.getArray();
+            for (size_t i = 0; i < numAccumulators; i++) {
+                group[i]->process(accumulatorStates[i], true);
+            }
+        }
+    }
+
+    for (auto&& groupObj : group) {
+        _memoryUsageBytes += groupObj->memUsageForSorter();
+    }
 }
 
 Value DocumentSourceGroup::computeId(const Document& root) {
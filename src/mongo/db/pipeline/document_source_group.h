@@ -36,6 +36,7 @@
 #include "mongo/db/pipeline/accumulator.h"
 #include "mongo/db/pipeline/document_source.h"
 #include "mongo/db/pipeline/transformer_interface.h"
+#include "mongo/db/query/aggregation_memory_broker.h"
 #include "mongo/db/sorter/sorter.h"
 
 namespace mongo {
@@ -195,6 +196,13 @@ private:
     GetNextResult getNextSpilled();
     GetNextResult getNextStandard();
 
+    /**
+     * Emits the next group of a spilled partition that was too large to re-aggregate in memory.
+     * The partition's chunks are each sorted by group key, so a k-way merge visits all of a
+     * group's partial states consecutively and they are folded together in constant memory.
+     */
+    GetNextResult getNextFromSortedPartition();
+
     /**
      * Before returning anything, this source must prepare itself. In a streaming $group,
      * initialize() requests the first document from the previous source, and uses it to prepare the
@@ -208,11 +216,65 @@ private:
     GetNextResult initialize();
 
     /**
-     * Spill groups map to disk and returns an iterator to the file. Note: Since a sorted $group
-     * does not exhaust the previous stage before returning, and thus does not maintain as large a
-     * store of documents at any one time, only an unsorted group can spill to disk.
+     * Processes one input document: finds (or creates) its group in '_groups' and feeds the
+     * document to the group's accumulators. Called by initialize() on the main thread, and by
+     * every worker thread of a parallel $group on that worker's private instance.
+     */
+    void processDocument(const Document& rootDocument);
+
+    /**
+     * Returns true if this $group may aggregate on multiple threads. Parallelism changes the
+     * order in which documents reach the accumulators and folds the workers' partial states
+     * together at the end, so it is restricted to groups whose result is insensitive to both:
+     * no $first/$last/$push/$mergeObjects, no merging of shard results, no disk use (spill files
+     * are per-instance) and no JavaScript (JS execution is bound to the owning operation
+     * context).
+     */
+    bool canGroupInParallel() const;
+
+    /**
+     * Creates 'numWorkers' worker instances of this $group, each with a private groups map and
+     * an equal share of the memory budget, and starts a thread per worker consuming documents
+     * from a bounded queue.
+     */
+    void startParallelWorkers(int numWorkers);
+
+    /**
+     * The parallel analogue of the initialize() input loop: distributes input documents
+     * round-robin to the worker queues, and on EOF joins the workers and folds their partial
+     * groups into '_groups'. Like initialize(), may return kPauseExecution and be re-entered.
+     */
+    GetNextResult initializeParallel();
+
+    /**
+     * Closes the worker queues and joins the worker threads, if any. Called on the normal EOF
+     * path, on dispose and on destruction.
      */
-    std::shared_ptr<Sorter<Value, Value>::Iterator> spill();
+    void shutdownParallelWorkers();
+
+    /**
+     * Spill groups map to disk, hash-partitioned by group key. Each partition receives one chunk
+     * per spill, and because the groups are written in globally sorted order every chunk is
+     * itself sorted by group key. Partitions are re-aggregated one at a time by loadPartition()
+     * once the input is exhausted, so a spilling $group remains a hash aggregation rather than
+     * degrading into a full external sort. Note: Since a sorted $group does not exhaust the
+     * previous stage before returning, and thus does not maintain as large a store of documents
+     * at any one time, only an unsorted group can spill to disk.
+     */
+    void spill();
+
+    /**
+     * Re-aggregates one spilled partition into '_groups'. If a single partition exceeds the
+     * memory limit, the partial aggregation is discarded and the partition's sorted chunks are
+     * instead merged group by group via getNextFromSortedPartition(), which needs only constant
+     * memory.
+     */
+    void loadPartition(size_t partition);
+
+    /**
+     * Folds one spilled pair of (group key, serialized accumulator states) into '_groups'.
+     */
+    void mergeSpilledGroup(const Value& id, const Value& accumStates);
 
     Document makeDocument(const Value& id, const Accumulators& accums, bool mergeableOutput);
 
@@ -238,15 +300,33 @@ private:
     bool _doingMerge;
     size_t _memoryUsageBytes = 0;
     size_t _maxMemoryUsageBytes;
+
+    // Registration with the server-wide aggregation memory pool. When the pool is enabled, the
+    // lease's effective limit replaces '_maxMemoryUsageBytes' at each spill check; otherwise the
+    // lease passes the static limit through unchanged.
+    AggregationMemoryBroker::Lease _memoryLease;
     std::string _fileName;
     std::streampos _nextSortedFileWriterOffset = 0;
-    bool _ownsFileDeletion = true;  // unless a MergeIterator is made that takes over.
+    size_t _numSpills = 0;
 
     std::vector<std::string> _idFieldNames;  // used when id is a document
     std::vector<boost::intrusive_ptr<Expression>> _idExpressions;
 
     bool _initialized;
 
+    // True once initialize() has checked the parallelism knob and eligibility. The decision is
+    // made exactly once, on the first call.
+    bool _parallelDecided = false;
+
+    // True on the private worker instances of a parallel $group. Workers are merged from their
+    // in-memory groups maps, so they must never spill.
+    bool _isParallelWorker = false;
+
+    // Non-null while a parallel $group is consuming its input. Owns the worker instances, their
+    // input queues and their threads.
+    struct ParallelState;
+    std::unique_ptr<ParallelState> _parallelState;
+
     Value _currentId;
     Accumulators _currentAccumulators;
 
@@ -255,13 +335,19 @@ private:
     // definition of equality.
     boost::optional<GroupsMap> _groups;
 
-    std::vector<std::shared_ptr<Sorter<Value, Value>::Iterator>> _sortedFiles;
+    // Chunks of spilled groups for each partition. Every chunk is sorted by group key.
+    std::vector<std::vector<std::shared_ptr<Sorter<Value, Value>::Iterator>>> _partitionChunks;
     bool _spilled;
 
-    // Only used when '_spilled' is false.
+    // Used to iterate the in-memory groups map, both when the stage never spilled and when
+    // emitting a re-aggregated spill partition.
     GroupsMap::iterator groupsIterator;
 
-    // Only used when '_spilled' is true.
+    // Only used when '_spilled' is true. Index of the next partition to re-aggregate.
+    size_t _currentPartition = 0;
+
+    // Only used when '_spilled' is true and the current partition was too large to re-aggregate
+    // in memory.
     std::unique_ptr<Sorter<Value, Value>::Iterator> _sorterIterator;
     const bool _allowDiskUse;
 
@@ -49,11 +49,13 @@
 #include "mongo/db/pipeline/document_source_mock.h"
 #include "mongo/db/pipeline/expression.h"
 #include "mongo/db/pipeline/expression_context_for_test.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/query/query_test_service_context.h"
 #include "mongo/dbtests/dbtests.h"
 #include "mongo/stdx/unordered_set.h"
 #include "mongo/unittest/temp_dir.h"
 #include "mongo/unittest/unittest.h"
+#include "mongo/util/scopeguard.h"
 
 namespace mongo {
 
@@ -147,6 +149,71 @@ TEST_F(DocumentSourceGroupTest, ShouldBeAbleToPauseLoadingWhileSpilled) {
     ASSERT_EQ(idSet.count(2), 1UL);
 }
 
+TEST_F(DocumentSourceGroupTest, ShouldComputeSameResultsWhenGroupingInParallel) {
+    internalQueryParallelGroupConcurrency.store(4);
+    ON_BLOCK_EXIT([] { internalQueryParallelGroupConcurrency.store(1); });
+
+    auto expCtx = getExpCtx();
+    auto&& parser = AccumulationStatement::getParser("$sum", boost::none);
+    auto accumulatorArg = BSON(""
+                               << "$b");
+    auto accExpr = parser(expCtx, accumulatorArg.firstElement(), expCtx->variablesParseState);
+    AccumulationStatement totalStatement{"total", accExpr};
+    auto groupByExpression = ExpressionFieldPath::parse(expCtx, "$a", expCtx->variablesParseState);
+    auto group = DocumentSourceGroup::create(expCtx, groupByExpression, {totalStatement});
+
+    // Spread 100 documents over 5 groups so that every worker thread sees members of every group.
+    deque<DocumentSource::GetNextResult> inputs;
+    vector<int> expectedTotals(5, 0);
+    for (int i = 0; i < 100; i++) {
+        inputs.emplace_back(Document{{"a", i % 5}, {"b", i}});
+        expectedTotals[i % 5] += i;
+    }
+    auto mock = DocumentSourceMock::createForTest(std::move(inputs), expCtx);
+    group->setSource(mock.get());
+
+    map<int, int> totals;
+    for (auto result = group->getNext(); result.isAdvanced(); result = group->getNext()) {
+        auto doc = result.releaseDocument();
+        totals[doc["_id"].coerceToInt()] = doc["total"].coerceToInt();
+    }
+
+    ASSERT_EQ(totals.size(), 5UL);
+    for (int id = 0; id < 5; id++) {
+        ASSERT_EQ(totals[id], expectedTotals[id]);
+    }
+}
+
+TEST_F(DocumentSourceGroupTest, ShouldBeAbleToPauseLoadingWhileGroupingInParallel) {
+    internalQueryParallelGroupConcurrency.store(2);
+    ON_BLOCK_EXIT([] { internalQueryParallelGroupConcurrency.store(1); });
+
+    auto expCtx = getExpCtx();
+    auto&& parser = AccumulationStatement::getParser("$sum", boost::none);
+    auto accumulatorArg = BSON("" << 1);
+    auto accExpr = parser(expCtx, accumulatorArg.firstElement(), expCtx->variablesParseState);
+    AccumulationStatement countStatement{"count", accExpr};
+    auto group = DocumentSourceGroup::create(
+        expCtx, ExpressionConstant::create(expCtx, Value(BSONNULL)), {countStatement});
+    auto mock =
+        DocumentSourceMock::createForTest({Document(),
+                                           DocumentSource::GetNextResult::makePauseExecution(),
+                                           Document(),
+                                           DocumentSource::GetNextResult::makePauseExecution(),
+                                           Document()},
+                                          expCtx);
+    group->setSource(mock.get());
+
+    // There were 2 pauses, so we should expect 2 paused results before any results can be returned.
+    ASSERT_TRUE(group->getNext().isPaused());
+    ASSERT_TRUE(group->getNext().isPaused());
+
+    // There were 3 documents, so we expect a count of 3.
+    auto result = group->getNext();
+    ASSERT_TRUE(result.isAdvanced());
+    ASSERT_DOCUMENT_EQ(result.releaseDocument(), (Document{{"_id", BSONNULL}, {"count", 3}}));
+}
+
 TEST_F(DocumentSourceGroupTest, ShouldErrorIfNotAllowedToSpillToDiskAndResultSetIsTooLarge) {
     auto expCtx = getExpCtx();
     const size_t maxMemoryUsageBytes = 1000;
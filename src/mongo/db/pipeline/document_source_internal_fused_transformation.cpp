@@ -0,0 +1,265 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/pipeline/document_source_internal_fused_transformation.h"
+
+#include <algorithm>
+#include <typeinfo>
+
+#include "mongo/db/exec/document_value/document.h"
+
+namespace mongo {
+
+namespace {
+
+/**
+ * Returns the constituent stage as its DocumentSource base.
+ */
+DocumentSource* asSource(
+    const DocumentSourceInternalFusedTransformation::FusedStage& stage) {
+    if (stage.match) {
+        return stage.match.get();
+    }
+    return stage.transform.get();
+}
+
+/**
+ * Returns whether 'stage' may become part of a fused run. Only plain $match stages are fused;
+ * subclasses such as the change stream oplog match carry additional semantics. A $match at the
+ * very front of the pipeline is left alone so that it remains eligible for pushdown into the
+ * query layer.
+ */
+bool isFusibleStage(const boost::intrusive_ptr<DocumentSource>& stage, bool isFirstStage) {
+    if (dynamic_cast<DocumentSourceSingleDocumentTransformation*>(stage.get())) {
+        return true;
+    }
+
+    auto match = dynamic_cast<DocumentSourceMatch*>(stage.get());
+    return match && typeid(*stage) == typeid(DocumentSourceMatch) && !match->isTextQuery() &&
+        !isFirstStage;
+}
+
+}  // namespace
+
+DocumentSourceInternalFusedTransformation::DocumentSourceInternalFusedTransformation(
+    const boost::intrusive_ptr<ExpressionContext>& expCtx, std::vector<FusedStage> stages)
+    : DocumentSource(kStageName, expCtx), _stages(std::move(stages)) {}
+
+void DocumentSourceInternalFusedTransformation::fuseAdjacentStages(
+    const boost::intrusive_ptr<ExpressionContext>& expCtx, Pipeline::SourceContainer* container) {
+    auto itr = container->begin();
+    while (itr != container->end()) {
+        if (!isFusibleStage(*itr, itr == container->begin())) {
+            ++itr;
+            continue;
+        }
+
+        auto runStart = itr;
+        while (itr != container->end() && isFusibleStage(*itr, itr == container->begin())) {
+            ++itr;
+        }
+
+        // Fusing a single stage would only add indirection.
+        if (std::distance(runStart, itr) < 2) {
+            continue;
+        }
+
+        std::vector<FusedStage> stages;
+        for (auto stageItr = runStart; stageItr != itr; ++stageItr) {
+            FusedStage stage;
+            if (auto transform =
+                    dynamic_cast<DocumentSourceSingleDocumentTransformation*>(stageItr->get())) {
+                stage.transform = transform;
+            } else {
+                stage.match = dynamic_cast<DocumentSourceMatch*>(stageItr->get());
+                invariant(stage.match);
+            }
+            stages.push_back(std::move(stage));
+        }
+
+        itr = container->erase(runStart, itr);
+        itr = container->insert(
+            itr, new DocumentSourceInternalFusedTransformation(expCtx, std::move(stages)));
+        ++itr;
+    }
+}
+
+DocumentSource::GetNextResult DocumentSourceInternalFusedTransformation::doGetNext() {
+    auto nextInput = pSource->getNext();
+    for (; nextInput.isAdvanced(); nextInput = pSource->getNext()) {
+        Document current = nextInput.releaseDocument();
+
+        bool filteredOut = false;
+        for (auto&& stage : _stages) {
+            if (stage.match) {
+                if (!stage.match->matchesDocument(current)) {
+                    filteredOut = true;
+                    break;
+                }
+            } else {
+                current = stage.transform->applyTransformation(current);
+            }
+        }
+
+        if (!filteredOut) {
+            return std::move(current);
+        }
+    }
+
+    return nextInput;
+}
+
+Value DocumentSourceInternalFusedTransformation::serialize(
+    boost::optional<ExplainOptions::Verbosity> explain) const {
+    std::vector<Value> stages;
+    for (auto&& stage : _stages) {
+        asSource(stage)->serializeToArray(stages, explain);
+    }
+    return Value(Document{{kStageName, Document{{"stages"_sd, Value(std::move(stages))}}}});
+}
+
+void DocumentSourceInternalFusedTransformation::serializeToArray(
+    std::vector<Value>& array, boost::optional<ExplainOptions::Verbosity> explain) const {
+    if (explain) {
+        // Explain attaches execution stats to exactly one serialized value per stage, so for
+        // explain the fused stage serializes as a single value exposing its constituents.
+        array.push_back(serialize(explain));
+        return;
+    }
+
+    // Decompose back into the constituent stages, so any node receiving the serialized pipeline
+    // can parse it; the receiving node re-fuses when it optimizes the pipeline.
+    for (auto&& stage : _stages) {
+        asSource(stage)->serializeToArray(array, explain);
+    }
+}
+
+DepsTracker::State DocumentSourceInternalFusedTransformation::getDependencies(
+    DepsTracker* deps) const {
+    // Mirrors the per-stage walk in Pipeline::getDependencies(), collapsing the constituent
+    // stages' dependencies into the state of a single stage.
+    const bool scopeHasVariables = pExpCtx->variablesParseState.hasDefinedVariables();
+    bool skipFieldsAndMetadataDeps = false;
+    bool knowAllFields = false;
+    bool knowAllMeta = false;
+    for (auto&& stage : _stages) {
+        DepsTracker localDeps(deps->getUnavailableMetadata());
+        DepsTracker::State status = asSource(stage)->getDependencies(&localDeps);
+
+        deps->vars.insert(localDeps.vars.begin(), localDeps.vars.end());
+
+        if ((skipFieldsAndMetadataDeps |= (status == DepsTracker::State::NOT_SUPPORTED))) {
+            // Assume the stage needs everything. Keep enumerating the remaining stages if this
+            // scope has variables, but only to collect their variable dependencies.
+            if (scopeHasVariables) {
+                continue;
+            } else {
+                break;
+            }
+        }
+
+        if (!knowAllFields) {
+            deps->fields.insert(localDeps.fields.begin(), localDeps.fields.end());
+            if (localDeps.needWholeDocument) {
+                deps->needWholeDocument = true;
+            }
+            knowAllFields = status & DepsTracker::State::EXHAUSTIVE_FIELDS;
+        }
+
+        if (!knowAllMeta) {
+            deps->requestMetadata(localDeps.metadataDeps());
+            knowAllMeta = status & DepsTracker::State::EXHAUSTIVE_META;
+        }
+
+        if (knowAllFields && knowAllMeta && !scopeHasVariables) {
+            break;
+        }
+    }
+
+    if (skipFieldsAndMetadataDeps) {
+        return DepsTracker::State::NOT_SUPPORTED;
+    }
+    if (knowAllFields && knowAllMeta) {
+        return DepsTracker::State::EXHAUSTIVE_ALL;
+    }
+    if (knowAllFields) {
+        return DepsTracker::State::EXHAUSTIVE_FIELDS;
+    }
+    if (knowAllMeta) {
+        return DepsTracker::State::EXHAUSTIVE_META;
+    }
+    return DepsTracker::State::SEE_NEXT;
+}
+
+StageConstraints DocumentSourceInternalFusedTransformation::constraints(
+    Pipeline::SplitState pipeState) const {
+    // Both fusible stage types are streaming, position-free, host-agnostic stages allowed in
+    // every pipeline context, so the fused stage can carry the same constraints. Collection
+    // independence holds only if every constituent is independent.
+    StageConstraints constraints(StreamType::kStreaming,
+                                 PositionRequirement::kNone,
+                                 HostTypeRequirement::kNone,
+                                 DiskUseRequirement::kNoDiskUse,
+                                 FacetRequirement::kAllowed,
+                                 TransactionRequirement::kAllowed,
+                                 LookupRequirement::kAllowed,
+                                 UnionRequirement::kAllowed,
+                                 ChangeStreamRequirement::kWhitelist);
+    constraints.isAllowedWithinUpdatePipeline = true;
+    constraints.isIndependentOfAnyCollection =
+        std::all_of(_stages.begin(), _stages.end(), [&](const FusedStage& stage) {
+            return asSource(stage)->constraints(pipeState).isIndependentOfAnyCollection;
+        });
+    return constraints;
+}
+
+void DocumentSourceInternalFusedTransformation::detachFromOperationContext() {
+    for (auto&& stage : _stages) {
+        asSource(stage)->detachFromOperationContext();
+    }
+}
+
+void DocumentSourceInternalFusedTransformation::reattachToOperationContext(
+    OperationContext* opCtx) {
+    for (auto&& stage : _stages) {
+        asSource(stage)->reattachToOperationContext(opCtx);
+    }
+}
+
+void DocumentSourceInternalFusedTransformation::doDispose() {
+    // The constituents are not stitched to one another, so each stage's dispose() stops with that
+    // stage.
+    for (auto&& stage : _stages) {
+        asSource(stage)->dispose();
+    }
+}
+
+}  // namespace mongo
@@ -0,0 +1,113 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "mongo/db/pipeline/document_source.h"
+#include "mongo/db/pipeline/document_source_match.h"
+#include "mongo/db/pipeline/document_source_single_document_transformation.h"
+
+namespace mongo {
+
+/**
+ * Evaluates a run of adjacent stateless stages ($match and single document transformations such as
+ * $project and $addFields) in a single pass over each input document, so that a run of fused
+ * stages pays one getNext() stage boundary per document instead of one per stage. Created by the
+ * fusion pass in Pipeline::optimizePipeline(); it is not a registered DocumentSource and cannot be
+ * created from BSON. When serialized for dispatch to another node it decomposes back into its
+ * constituent stages, which re-fuse when the receiving node optimizes the pipeline.
+ */
+class DocumentSourceInternalFusedTransformation final : public DocumentSource {
+public:
+    static constexpr StringData kStageName = "$_internalFusedTransformation"_sd;
+
+    /**
+     * One fused step. Exactly one of 'match' and 'transform' is non-null.
+     */
+    struct FusedStage {
+        boost::intrusive_ptr<DocumentSourceMatch> match;
+        boost::intrusive_ptr<DocumentSourceSingleDocumentTransformation> transform;
+    };
+
+    /**
+     * Replaces each run of two or more adjacent fusible stages in 'container' with a single
+     * DocumentSourceInternalFusedTransformation which evaluates them in one pass per document.
+     * Must run after all other optimizations have settled, since the fused stage does not
+     * participate in stage reordering. A $match at the very front of the pipeline is never fused,
+     * so that it remains visible for pushdown into the query layer.
+     */
+    static void fuseAdjacentStages(const boost::intrusive_ptr<ExpressionContext>& expCtx,
+                                   Pipeline::SourceContainer* container);
+
+    DocumentSourceInternalFusedTransformation(
+        const boost::intrusive_ptr<ExpressionContext>& expCtx, std::vector<FusedStage> stages);
+
+    const char* getSourceName() const final {
+        return kStageName.rawData();
+    }
+
+    boost::intrusive_ptr<DocumentSource> optimize() final {
+        return this;
+    }
+
+    Value serialize(boost::optional<ExplainOptions::Verbosity> explain = boost::none) const final;
+
+    void serializeToArray(
+        std::vector<Value>& array,
+        boost::optional<ExplainOptions::Verbosity> explain = boost::none) const final;
+
+    DepsTracker::State getDependencies(DepsTracker* deps) const final;
+
+    StageConstraints constraints(Pipeline::SplitState pipeState) const final;
+
+    boost::optional<DistributedPlanLogic> distributedPlanLogic() final {
+        return boost::none;
+    }
+
+    void detachFromOperationContext() final;
+
+    void reattachToOperationContext(OperationContext* opCtx) final;
+
+    const std::vector<FusedStage>& getFusedStages() const {
+        return _stages;
+    }
+
+protected:
+    GetNextResult doGetNext() final;
+    void doDispose() final;
+
+private:
+    // The constituent stages, in pipeline order. They are not stitched to one another; this stage
+    // drives their per-document logic directly.
+    std::vector<FusedStage> _stages;
+};
+
+}  // namespace mongo
@@ -0,0 +1,220 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/pipeline/document_source_internal_unpack_bucket.h"
+
+#include "mongo/db/exec/document_value/document.h"
+
+namespace mongo {
+
+REGISTER_DOCUMENT_SOURCE(_internalUnpackBucket,
+                         LiteParsedDocumentSourceDefault::parse,
+                         DocumentSourceInternalUnpackBucket::createFromBson);
+
+constexpr StringData BucketUnpacker::kBucketMetaFieldName;
+constexpr StringData BucketUnpacker::kBucketDataFieldName;
+constexpr StringData DocumentSourceInternalUnpackBucket::kStageName;
+constexpr StringData DocumentSourceInternalUnpackBucket::kInclude;
+constexpr StringData DocumentSourceInternalUnpackBucket::kExclude;
+constexpr StringData DocumentSourceInternalUnpackBucket::kTimeFieldName;
+constexpr StringData DocumentSourceInternalUnpackBucket::kMetaFieldName;
+
+namespace {
+/**
+ * Returns whether 'field' should be materialized into the measurement given the unpacker's
+ * behavior and field set.
+ */
+bool determineIncludeField(StringData field,
+                           BucketUnpacker::Behavior behavior,
+                           const std::set<std::string>& fieldSet) {
+    return (behavior == BucketUnpacker::Behavior::kInclude) ==
+        (fieldSet.find(field.toString()) != fieldSet.end());
+}
+}  // namespace
+
+void BucketUnpacker::reset(Document&& bucket) {
+    _bucket = std::move(bucket);
+    _timeFieldIter = boost::none;
+    if (_bucket.empty()) {
+        return;
+    }
+
+    auto dataRegion = _bucket[kBucketDataFieldName];
+    uassert(31630,
+            "The $_internalUnpackBucket stage requires 'data' to be present in the bucket",
+            dataRegion.getType() == BSONType::Object);
+
+    auto timeColumn = dataRegion.getDocument()[_timeField];
+    uassert(31631,
+            str::stream() << "The $_internalUnpackBucket stage requires the bucket to have a time "
+                             "column named '"
+                          << _timeField << "'",
+            timeColumn.getType() == BSONType::Object);
+
+    _metaValue = _bucket[kBucketMetaFieldName];
+    _timeFieldIter.emplace(timeColumn.getDocument());
+}
+
+Document BucketUnpacker::getNext() {
+    invariant(hasNext());
+    auto rowKey = _timeFieldIter->next().first;
+
+    MutableDocument measurement;
+    if (_metaField && !_metaValue.missing() &&
+        determineIncludeField(*_metaField, _behavior, _fieldSet)) {
+        measurement.addField(*_metaField, _metaValue);
+    }
+
+    auto dataRegion = _bucket[kBucketDataFieldName].getDocument();
+    for (auto columnIter = dataRegion.fieldIterator(); columnIter.more();) {
+        auto column = columnIter.next();
+        if (!determineIncludeField(column.first, _behavior, _fieldSet)) {
+            continue;
+        }
+        uassert(31632,
+                str::stream() << "The $_internalUnpackBucket stage requires each column in 'data' "
+                                 "to be an object, but found column '"
+                              << column.first << "' of type " << typeName(column.second.getType()),
+                column.second.getType() == BSONType::Object);
+
+        auto value = column.second.getDocument()[rowKey];
+        if (!value.missing()) {
+            measurement.addField(column.first, value);
+        }
+    }
+
+    return measurement.freeze();
+}
+
+boost::intrusive_ptr<DocumentSource> DocumentSourceInternalUnpackBucket::createFromBson(
+    BSONElement specElem, const boost::intrusive_ptr<ExpressionContext>& expCtx) {
+    uassert(31633,
+            str::stream() << "$_internalUnpackBucket specification must be an object, got: "
+                          << typeName(specElem.type()),
+            specElem.type() == BSONType::Object);
+
+    boost::optional<BucketUnpacker::Behavior> behavior;
+    std::set<std::string> fieldSet;
+    boost::optional<std::string> timeField;
+    boost::optional<std::string> metaField;
+    for (auto&& elem : specElem.embeddedObject()) {
+        auto fieldName = elem.fieldNameStringData();
+        if (fieldName == kInclude || fieldName == kExclude) {
+            uassert(31634,
+                    "The $_internalUnpackBucket stage expects at most one of include/exclude "
+                    "parameters to be specified",
+                    !behavior);
+            uassert(31635,
+                    str::stream() << "The '" << fieldName << "' parameter of the "
+                                  << "$_internalUnpackBucket stage must be an array, got: "
+                                  << typeName(elem.type()),
+                    elem.type() == BSONType::Array);
+
+            behavior = fieldName == kInclude ? BucketUnpacker::Behavior::kInclude
+                                             : BucketUnpacker::Behavior::kExclude;
+            for (auto&& field : elem.Array()) {
+                uassert(31636,
+                        str::stream() << "The '" << fieldName << "' parameter of the "
+                                      << "$_internalUnpackBucket stage must contain only strings",
+                        field.type() == BSONType::String);
+                fieldSet.insert(field.str());
+            }
+        } else if (fieldName == kTimeFieldName) {
+            uassert(31637,
+                    str::stream() << "The 'timeField' parameter of the $_internalUnpackBucket "
+                                  << "stage must be a string, got: " << typeName(elem.type()),
+                    elem.type() == BSONType::String);
+            timeField = elem.str();
+        } else if (fieldName == kMetaFieldName) {
+            uassert(31638,
+                    str::stream() << "The 'metaField' parameter of the $_internalUnpackBucket "
+                                  << "stage must be a string, got: " << typeName(elem.type()),
+                    elem.type() == BSONType::String);
+            metaField = elem.str();
+        } else {
+            uasserted(31639,
+                      str::stream()
+                          << "Unrecognized parameter to $_internalUnpackBucket: " << fieldName);
+        }
+    }
+
+    uassert(31640,
+            "The $_internalUnpackBucket stage expects one of include/exclude parameters to be "
+            "specified",
+            behavior);
+    uassert(31641,
+            "The $_internalUnpackBucket stage requires a timeField parameter",
+            timeField);
+
+    return new DocumentSourceInternalUnpackBucket(
+        expCtx,
+        BucketUnpacker{
+            std::move(fieldSet), *behavior, std::move(*timeField), std::move(metaField)});
+}
+
+DocumentSource::GetNextResult DocumentSourceInternalUnpackBucket::doGetNext() {
+    if (_bucketUnpacker.hasNext()) {
+        return _bucketUnpacker.getNext();
+    }
+
+    auto nextResult = pSource->getNext();
+    if (nextResult.isAdvanced()) {
+        auto bucket = nextResult.getDocument();
+        _bucketUnpacker.reset(Document{bucket});
+        uassert(31642,
+                str::stream() << "The $_internalUnpackBucket stage requires the bucket's time "
+                                 "column to be nonempty, but found: "
+                              << bucket.toString(),
+                _bucketUnpacker.hasNext());
+        return _bucketUnpacker.getNext();
+    }
+
+    return nextResult;
+}
+
+Value DocumentSourceInternalUnpackBucket::serialize(
+    boost::optional<ExplainOptions::Verbosity> explain) const {
+    MutableDocument spec;
+    std::vector<Value> fields;
+    for (auto&& field : _bucketUnpacker.fieldSet()) {
+        fields.emplace_back(field);
+    }
+    spec.addField(_bucketUnpacker.behavior() == BucketUnpacker::Behavior::kInclude ? kInclude
+                                                                                   : kExclude,
+                  Value{std::move(fields)});
+    spec.addField(kTimeFieldName, Value{_bucketUnpacker.timeField()});
+    if (_bucketUnpacker.metaField()) {
+        spec.addField(kMetaFieldName, Value{*_bucketUnpacker.metaField()});
+    }
+    return Value(Document{{getSourceName(), spec.freeze()}});
+}
+
+}  // namespace mongo
@@ -0,0 +1,162 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <set>
+#include <string>
+
+#include "mongo/db/exec/document_value/document.h"
+#include "mongo/db/pipeline/document_source.h"
+
+namespace mongo {
+
+/**
+ * Carries the bucket unpacking parameters and state for iterating over the measurements stored in
+ * a single bucket document. A bucket document groups many measurements into one document using a
+ * column-per-field layout:
+ *
+ *     {_id: ...,
+ *      meta: <metadata common to all measurements in the bucket>,
+ *      data: {<time field>: {'0': <time 0>, '1': <time 1>, ...},
+ *             <field>: {'0': <value 0>, ...},
+ *             ...}}
+ *
+ * The row keys of the time column define the measurements in the bucket; a column without a value
+ * at a given row key simply contributes no field to that measurement.
+ */
+class BucketUnpacker {
+public:
+    // The bucket-level fields that the unpacker understands.
+    static constexpr StringData kBucketMetaFieldName = "meta"_sd;
+    static constexpr StringData kBucketDataFieldName = "data"_sd;
+
+    // Describes whether '_fieldSet' names the fields to include in or exclude from the
+    // materialized measurements.
+    enum class Behavior { kInclude, kExclude };
+
+    BucketUnpacker(std::set<std::string> fieldSet,
+                   Behavior behavior,
+                   std::string timeField,
+                   boost::optional<std::string> metaField)
+        : _fieldSet(std::move(fieldSet)),
+          _behavior(behavior),
+          _timeField(std::move(timeField)),
+          _metaField(std::move(metaField)) {}
+
+    /**
+     * Begins unpacking a new bucket document, discarding any state from the previous one.
+     */
+    void reset(Document&& bucket);
+
+    bool hasNext() const {
+        return _timeFieldIter && _timeFieldIter->more();
+    }
+
+    /**
+     * Materializes the next measurement in the current bucket. Illegal to call unless hasNext()
+     * returns true.
+     */
+    Document getNext();
+
+    Behavior behavior() const {
+        return _behavior;
+    }
+
+    const std::set<std::string>& fieldSet() const {
+        return _fieldSet;
+    }
+
+    const std::string& timeField() const {
+        return _timeField;
+    }
+
+    const boost::optional<std::string>& metaField() const {
+        return _metaField;
+    }
+
+private:
+    std::set<std::string> _fieldSet;
+    Behavior _behavior;
+    std::string _timeField;
+    boost::optional<std::string> _metaField;
+
+    // The bucket currently being unpacked and the iterator over the row keys of its time column.
+    Document _bucket;
+    Value _metaValue;
+    boost::optional<FieldIterator> _timeFieldIter;
+};
+
+/**
+ * An internal stage which stands between a scan over a bucketed metrics collection and the rest of
+ * the pipeline, materializing one document per measurement stored in each bucket.
+ */
+class DocumentSourceInternalUnpackBucket final : public DocumentSource {
+public:
+    static constexpr StringData kStageName = "$_internalUnpackBucket"_sd;
+    static constexpr StringData kInclude = "include"_sd;
+    static constexpr StringData kExclude = "exclude"_sd;
+    static constexpr StringData kTimeFieldName = "timeField"_sd;
+    static constexpr StringData kMetaFieldName = "metaField"_sd;
+
+    static boost::intrusive_ptr<DocumentSource> createFromBson(
+        BSONElement specElem, const boost::intrusive_ptr<ExpressionContext>& expCtx);
+
+    DocumentSourceInternalUnpackBucket(const boost::intrusive_ptr<ExpressionContext>& expCtx,
+                                       BucketUnpacker bucketUnpacker)
+        : DocumentSource(kStageName, expCtx), _bucketUnpacker(std::move(bucketUnpacker)) {}
+
+    const char* getSourceName() const final {
+        return kStageName.rawData();
+    }
+
+    StageConstraints constraints(Pipeline::SplitState pipeState) const final {
+        return {StreamType::kStreaming,
+                PositionRequirement::kFirst,
+                HostTypeRequirement::kNone,
+                DiskUseRequirement::kNoDiskUse,
+                FacetRequirement::kNotAllowed,
+                TransactionRequirement::kAllowed,
+                LookupRequirement::kAllowed,
+                UnionRequirement::kAllowed};
+    }
+
+    boost::optional<DistributedPlanLogic> distributedPlanLogic() final {
+        return boost::none;
+    }
+
+    Value serialize(boost::optional<ExplainOptions::Verbosity> explain = boost::none) const final;
+
+private:
+    GetNextResult doGetNext() final;
+
+    BucketUnpacker _bucketUnpacker;
+};
+
+}  // namespace mongo
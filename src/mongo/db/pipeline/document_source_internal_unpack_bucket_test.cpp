@@ -0,0 +1,172 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/bson/json.h"
+#include "mongo/db/exec/document_value/document_value_test_util.h"
+#include "mongo/db/pipeline/aggregation_context_fixture.h"
+#include "mongo/db/pipeline/document_source_internal_unpack_bucket.h"
+#include "mongo/db/pipeline/document_source_mock.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+using InternalUnpackBucketStageTest = AggregationContextFixture;
+
+TEST_F(InternalUnpackBucketStageTest, UnpacksBasicExcludeBucket) {
+    auto spec = fromjson(
+        "{$_internalUnpackBucket: {exclude: [], timeField: 'time', metaField: 'myMeta'}}");
+    auto unpack =
+        DocumentSourceInternalUnpackBucket::createFromBson(spec.firstElement(), getExpCtx());
+    auto source = DocumentSourceMock::createForTest(
+        Document{fromjson("{meta: {sensor: 1}, data: {time: {'0': 1, '1': 2}, "
+                          "a: {'0': 10, '1': 20}, b: {'1': 30}}}")},
+        getExpCtx());
+    unpack->setSource(source.get());
+
+    auto next = unpack->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next.getDocument(),
+                       Document{fromjson("{myMeta: {sensor: 1}, time: 1, a: 10}")});
+
+    next = unpack->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next.getDocument(),
+                       Document{fromjson("{myMeta: {sensor: 1}, time: 2, a: 20, b: 30}")});
+
+    next = unpack->getNext();
+    ASSERT_TRUE(next.isEOF());
+}
+
+TEST_F(InternalUnpackBucketStageTest, UnpacksOnlyIncludedFields) {
+    auto spec = fromjson(
+        "{$_internalUnpackBucket: {include: ['time', 'b'], timeField: 'time', "
+        "metaField: 'myMeta'}}");
+    auto unpack =
+        DocumentSourceInternalUnpackBucket::createFromBson(spec.firstElement(), getExpCtx());
+    auto source = DocumentSourceMock::createForTest(
+        Document{fromjson("{meta: {sensor: 1}, data: {time: {'0': 1, '1': 2}, "
+                          "a: {'0': 10, '1': 20}, b: {'1': 30}}}")},
+        getExpCtx());
+    unpack->setSource(source.get());
+
+    auto next = unpack->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next.getDocument(), Document{fromjson("{time: 1}")});
+
+    next = unpack->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next.getDocument(), Document{fromjson("{time: 2, b: 30}")});
+
+    next = unpack->getNext();
+    ASSERT_TRUE(next.isEOF());
+}
+
+TEST_F(InternalUnpackBucketStageTest, UnpacksMultipleBuckets) {
+    auto spec =
+        fromjson("{$_internalUnpackBucket: {exclude: [], timeField: 'time', metaField: 'tag'}}");
+    auto unpack =
+        DocumentSourceInternalUnpackBucket::createFromBson(spec.firstElement(), getExpCtx());
+    auto source = DocumentSourceMock::createForTest(
+        {Document{fromjson("{meta: 1, data: {time: {'0': 1}, a: {'0': 10}}}")},
+         Document{fromjson("{meta: 2, data: {time: {'0': 2}, a: {'0': 20}}}")}},
+        getExpCtx());
+    unpack->setSource(source.get());
+
+    auto next = unpack->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next.getDocument(), Document{fromjson("{tag: 1, time: 1, a: 10}")});
+
+    next = unpack->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next.getDocument(), Document{fromjson("{tag: 2, time: 2, a: 20}")});
+
+    next = unpack->getNext();
+    ASSERT_TRUE(next.isEOF());
+}
+
+TEST_F(InternalUnpackBucketStageTest, SerializeRoundtrips) {
+    auto spec = fromjson(
+        "{$_internalUnpackBucket: {include: ['a', 'time'], timeField: 'time', "
+        "metaField: 'myMeta'}}");
+    auto unpack =
+        DocumentSourceInternalUnpackBucket::createFromBson(spec.firstElement(), getExpCtx());
+
+    std::vector<Value> serialization;
+    unpack->serializeToArray(serialization);
+    ASSERT_EQ(serialization.size(), 1UL);
+
+    auto roundtripped = DocumentSourceInternalUnpackBucket::createFromBson(
+        serialization[0].getDocument().toBson().firstElement(), getExpCtx());
+    std::vector<Value> newSerialization;
+    roundtripped->serializeToArray(newSerialization);
+    ASSERT_EQ(newSerialization.size(), 1UL);
+    ASSERT_VALUE_EQ(newSerialization[0], serialization[0]);
+}
+
+TEST_F(InternalUnpackBucketStageTest, RejectsBothIncludeAndExclude) {
+    auto spec = fromjson(
+        "{$_internalUnpackBucket: {include: ['a'], exclude: ['b'], timeField: 'time'}}");
+    ASSERT_THROWS_CODE(
+        DocumentSourceInternalUnpackBucket::createFromBson(spec.firstElement(), getExpCtx()),
+        AssertionException,
+        31634);
+}
+
+TEST_F(InternalUnpackBucketStageTest, RejectsMissingIncludeAndExclude) {
+    auto spec = fromjson("{$_internalUnpackBucket: {timeField: 'time'}}");
+    ASSERT_THROWS_CODE(
+        DocumentSourceInternalUnpackBucket::createFromBson(spec.firstElement(), getExpCtx()),
+        AssertionException,
+        31640);
+}
+
+TEST_F(InternalUnpackBucketStageTest, RejectsMissingTimeField) {
+    auto spec = fromjson("{$_internalUnpackBucket: {exclude: []}}");
+    ASSERT_THROWS_CODE(
+        DocumentSourceInternalUnpackBucket::createFromBson(spec.firstElement(), getExpCtx()),
+        AssertionException,
+        31641);
+}
+
+TEST_F(InternalUnpackBucketStageTest, RejectsBucketWithoutTimeColumn) {
+    auto spec = fromjson("{$_internalUnpackBucket: {exclude: [], timeField: 'time'}}");
+    auto unpack =
+        DocumentSourceInternalUnpackBucket::createFromBson(spec.firstElement(), getExpCtx());
+    auto source = DocumentSourceMock::createForTest(
+        Document{fromjson("{meta: 1, data: {a: {'0': 10}}}")}, getExpCtx());
+    unpack->setSource(source.get());
+
+    ASSERT_THROWS_CODE(unpack->getNext(), AssertionException, 31631);
+}
+
+}  // namespace
+}  // namespace mongo
@@ -38,6 +38,7 @@
 #include "mongo/db/exec/document_value/value.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/matcher/expression_algo.h"
+#include "mongo/db/matcher/expression_parser.h"
 #include "mongo/db/pipeline/document_path_support.h"
 #include "mongo/db/pipeline/expression.h"
 #include "mongo/db/pipeline/expression_context.h"
@@ -253,6 +254,74 @@ void lookupPipeValidator(const Pipeline& pipeline) {
                 src->constraints().isAllowedInLookupPipeline());
     });
 }
+
+/**
+ * Collects the values under which a foreign document must be registered in the hash join table
+ * for a probe with any local join value that matches it to find it. The set is deliberately
+ * over-inclusive: every candidate the table returns is re-checked against the real join
+ * predicate, so an extra key can never produce a wrong result, while a missing one would. In
+ * particular, a document is registered under null whenever the path terminates early or yields
+ * a nullish value, mirroring the query system's treatment of missing fields in an equality to
+ * null, and leaf arrays are registered both element-wise and as whole values, since an equality
+ * can match either the array itself or any one of its elements.
+ */
+void collectHashJoinKeysAtPath(const Value& value,
+                               const FieldPath& path,
+                               size_t fieldPathIndex,
+                               std::vector<Value>* keys) {
+    if (fieldPathIndex == path.getPathLength()) {
+        if (value.isArray()) {
+            keys->push_back(value);
+            for (auto&& element : value.getArray()) {
+                keys->push_back(element.nullish() ? Value(BSONNULL) : element);
+            }
+        } else {
+            keys->push_back(value.nullish() ? Value(BSONNULL) : value);
+        }
+        return;
+    }
+
+    const auto& fieldName = path.getFieldName(fieldPathIndex);
+    if (value.getType() == BSONType::Object) {
+        collectHashJoinKeysAtPath(
+            value.getDocument().getField(fieldName), path, fieldPathIndex + 1, keys);
+        return;
+    }
+
+    if (value.isArray()) {
+        // A numeric path component can also address an array position.
+        if (auto index = str::parseUnsignedBase10Integer(fieldName)) {
+            collectHashJoinKeysAtPath(value[*index], path, fieldPathIndex + 1, keys);
+        }
+        // Independently of any positional interpretation, the query system traverses the array
+        // and looks for the rest of the path in each object element. Elements that cannot
+        // continue the path are only reachable by an equality to null.
+        for (auto&& element : value.getArray()) {
+            if (element.getType() == BSONType::Object) {
+                collectHashJoinKeysAtPath(
+                    element.getDocument().getField(fieldName), path, fieldPathIndex + 1, keys);
+            } else {
+                keys->push_back(Value(BSONNULL));
+            }
+        }
+        if (value.getArrayLength() == 0) {
+            keys->push_back(Value(BSONNULL));
+        }
+        return;
+    }
+
+    // A scalar or missing value in the middle of the path; the rest of the path is missing,
+    // which an equality to null can still match.
+    keys->push_back(Value(BSONNULL));
+}
+
+/**
+ * Collects the hash join table keys for the foreign document 'doc' with join field 'path'.
+ */
+void collectHashJoinKeys(const Document& doc, const FieldPath& path, std::vector<Value>* keys) {
+    // The first component of the path is always a field name, even if numeric.
+    collectHashJoinKeysAtPath(doc.getField(path.getFieldName(0)), path, 1, keys);
+}
 }  // namespace
 
 DocumentSource::GetNextResult DocumentSourceLookUp::doGetNext() {
@@ -271,6 +340,21 @@ DocumentSource::GetNextResult DocumentSourceLookUp::doGetNext() {
     // '_unwindSrc' would be non-null, and we would not have made it here.
     invariant(!_matchSrc);
 
+    // When eligible, answer the join by probing a hash table built once over the foreign
+    // collection rather than issuing a sub-pipeline per input document.
+    if (hashJoinEligible()) {
+        if (_hashJoinState == HashJoinState::kNotBuilt) {
+            buildHashJoinTable();
+        }
+        if (_hashJoinState == HashJoinState::kServing) {
+            auto results = probeHashJoinTable(inputDoc);
+            MutableDocument output(std::move(inputDoc));
+            output.setNestedField(_as, Value(std::move(results)));
+            return output.freeze();
+        }
+        // The table was abandoned as over budget; fall back to per-document execution.
+    }
+
     if (!wasConstructedWithPipelineSyntax()) {
         auto matchStage =
             makeMatchStageFromInput(inputDoc, *_localField, _foreignField->fullPath(), BSONObj());
@@ -362,6 +446,113 @@ std::unique_ptr<Pipeline, PipelineDeleter> DocumentSourceLookUp::buildPipeline(
     return pipeline;
 }
 
+bool DocumentSourceLookUp::hashJoinEligible() const {
+    // Hash join execution requires the join predicate to be the pure equality implied by the
+    // localField/foreignField syntax. An absorbed $match would add a correlated filter via
+    // '_additionalFilter', which the probe does not evaluate.
+    return internalQueryEnableLookupHashJoin.load() && !wasConstructedWithPipelineSyntax() &&
+        !_additionalFilter;
+}
+
+void DocumentSourceLookUp::buildHashJoinTable() {
+    invariant(_hashJoinState == HashJoinState::kNotBuilt);
+    invariant(!wasConstructedWithPipelineSyntax());
+
+    // Scan the entire foreign collection, with the trailing join $match left empty. Any stages
+    // introduced by view resolution still apply.
+    _resolvedPipeline.back() = BSON("$match" << BSONObj());
+    auto pipeline = buildPipeline(Document());
+
+    const auto maxBytes = internalLookupStageHashJoinMaxMemoryBytes.load();
+    long long bytes = 0;
+
+    _hashJoinTable.emplace(
+        _fromExpCtx->getValueComparator().makeUnorderedValueMap<std::vector<size_t>>());
+
+    std::vector<Value> keys;
+    while (auto result = pipeline->getNext()) {
+        bytes += result->getApproximateSize();
+        if (bytes > maxBytes) {
+            // The foreign collection does not fit within the memory budget; fall back to
+            // issuing a sub-pipeline per input document.
+            _hashJoinTable = boost::none;
+            _hashJoinDocs.clear();
+            _hashJoinDocs.shrink_to_fit();
+            _hashJoinState = HashJoinState::kAbandoned;
+            _usedDisk = _usedDisk || pipeline->usedDisk();
+            return;
+        }
+
+        const size_t index = _hashJoinDocs.size();
+        keys.clear();
+        collectHashJoinKeys(*result, *_foreignField, &keys);
+        _hashJoinDocs.push_back(std::move(*result));
+        for (auto&& key : keys) {
+            (*_hashJoinTable)[key].push_back(index);
+        }
+    }
+    _usedDisk = _usedDisk || pipeline->usedDisk();
+    _hashJoinState = HashJoinState::kServing;
+}
+
+std::vector<Value> DocumentSourceLookUp::probeHashJoinTable(const Document& inputDoc) {
+    invariant(_hashJoinState == HashJoinState::kServing);
+
+    // Build the same $match that per-document execution would issue against the foreign
+    // collection and use it to re-check candidates, so that probing the hash table can never
+    // change this stage's semantics. The parsed expression references 'matchStage', which must
+    // stay alive until matching is done.
+    auto matchStage =
+        makeMatchStageFromInput(inputDoc, *_localField, _foreignField->fullPath(), BSONObj());
+    auto matchExpr =
+        uassertStatusOK(MatchExpressionParser::parse(matchStage.firstElement().Obj(), _fromExpCtx));
+
+    // Gather the candidates registered under any of the local join values. These are the same
+    // values makeMatchStageFromInput() built the query from.
+    std::vector<size_t> candidates;
+    auto addCandidatesForValue = [&](const Value& value) {
+        auto it = _hashJoinTable->find(value);
+        if (it != _hashJoinTable->end()) {
+            candidates.insert(candidates.end(), it->second.begin(), it->second.end());
+        }
+    };
+    bool joinValuesFound = false;
+    document_path_support::visitAllValuesAtPath(inputDoc, *_localField, [&](const Value& value) {
+        joinValuesFound = true;
+        addCandidatesForValue(value);
+    });
+    if (!joinValuesFound) {
+        // Missing values are treated as null.
+        addCandidatesForValue(Value(BSONNULL));
+    }
+
+    // Restore foreign collection scan order and drop candidates reachable through more than one
+    // join value.
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+    std::vector<Value> results;
+    long long objsize = 0;
+    const auto maxBytes = internalLookupStageIntermediateDocumentMaxSizeBytes.load();
+    for (auto index : candidates) {
+        const auto& candidate = _hashJoinDocs[index];
+        if (!matchExpr->matchesBSON(candidate.toBson())) {
+            continue;
+        }
+
+        long long safeSum = 0;
+        bool hasOverflowed = overflow::add(objsize, candidate.getApproximateSize(), &safeSum);
+        uassert(31613,
+                str::stream() << "Total size of documents in " << _fromNs.coll()
+                              << " matching pipeline's $lookup stage exceeds " << maxBytes
+                              << " bytes",
+                !hasOverflowed && safeSum <= maxBytes);
+        objsize = safeSum;
+        results.emplace_back(Document(candidate));
+    }
+    return results;
+}
+
 DocumentSource::GetModPathsReturn DocumentSourceLookUp::getModifiedPaths() const {
     std::set<std::string> modifiedPaths{_as.fullPath()};
     if (_unwindSrc) {
@@ -498,6 +689,10 @@ bool DocumentSourceLookUp::usedDisk() {
 }
 
 void DocumentSourceLookUp::doDispose() {
+    _hashJoinTable = boost::none;
+    _hashJoinDocs.clear();
+    _hashJoinDocs.shrink_to_fit();
+
     if (_pipeline) {
         _usedDisk = _usedDisk || _pipeline->usedDisk();
         _pipeline->dispose(pExpCtx->opCtx);
@@ -247,6 +247,31 @@ private:
      */
     void resolveLetVariables(const Document& localDoc, Variables* variables);
 
+    /**
+     * Returns true if this $lookup may execute as a hash join: the join predicate must be the
+     * pure equality implied by the localField/foreignField syntax, without a correlated filter
+     * from an absorbed $match, and the mode must be enabled via
+     * internalQueryEnableLookupHashJoin.
+     */
+    bool hashJoinEligible() const;
+
+    /**
+     * Scans the entire foreign collection once and builds a hash table from each value of the
+     * foreign join field to the documents containing it. Sets '_hashJoinState' to kServing on
+     * success, or to kAbandoned if the foreign documents would exceed
+     * internalLookupStageHashJoinMaxMemoryBytes, in which case execution falls back to issuing
+     * a sub-pipeline per input document.
+     */
+    void buildHashJoinTable();
+
+    /**
+     * Returns the foreign documents matching 'inputDoc', in foreign collection scan order, by
+     * probing the hash table with each value of the local join field. Candidates found in the
+     * table are re-checked against the same $match predicate that per-document execution would
+     * have issued, so the results are identical to that mode's.
+     */
+    std::vector<Value> probeHashJoinTable(const Document& inputDoc);
+
     /**
      * Builds a parsed pipeline for introspection (e.g. constraints, dependencies). Any sub-$lookup
      * pipelines will be built recursively.
@@ -292,6 +317,18 @@ private:
     // from a cursor source.
     boost::optional<SequentialDocumentCache> _cache;
 
+    // State of the hash join execution mode. The table is built lazily on the first input
+    // document and abandoned if the foreign collection exceeds the memory budget.
+    enum class HashJoinState { kNotBuilt, kServing, kAbandoned };
+    HashJoinState _hashJoinState = HashJoinState::kNotBuilt;
+
+    // Foreign collection documents in scan order, referenced by position from '_hashJoinTable'.
+    std::vector<Document> _hashJoinDocs;
+
+    // Maps each value of the foreign join field to the positions in '_hashJoinDocs' of the
+    // documents containing it. Engaged only while '_hashJoinState' is kServing.
+    boost::optional<ValueUnorderedMap<std::vector<size_t>>> _hashJoinTable;
+
     // The ExpressionContext used when performing aggregation pipelines against the '_resolvedNs'
     // namespace.
     boost::intrusive_ptr<ExpressionContext> _fromExpCtx;
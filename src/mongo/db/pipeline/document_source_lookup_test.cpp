@@ -48,6 +48,7 @@
 #include "mongo/db/repl/replication_coordinator_mock.h"
 #include "mongo/db/repl/storage_interface_mock.h"
 #include "mongo/db/server_options.h"
+#include "mongo/util/scopeguard.h"
 
 namespace mongo {
 namespace {
@@ -569,6 +570,70 @@ TEST_F(DocumentSourceLookUpTest, ShouldPropagatePauses) {
     lookup->dispose();
 }
 
+TEST_F(DocumentSourceLookUpTest, HashJoinMatchesLikePerDocumentExecution) {
+    auto expCtx = getExpCtx();
+    NamespaceString fromNs("test", "foreign");
+    expCtx->setResolvedNamespaces(StringMap<ExpressionContext::ResolvedNamespace>{
+        {fromNs.coll().toString(), {fromNs, std::vector<BSONObj>()}}});
+
+    internalQueryEnableLookupHashJoin.store(true);
+    ON_BLOCK_EXIT([] { internalQueryEnableLookupHashJoin.store(false); });
+
+    auto mockLocalSource =
+        DocumentSourceMock::createForTest({Document(fromjson("{_id: 0, joinKey: 0}")),
+                                           Document(fromjson("{_id: 1, joinKey: [1, 2]}")),
+                                           Document(fromjson("{_id: 2}")),
+                                           Document(fromjson("{_id: 3, joinKey: 5}"))},
+                                          expCtx);
+
+    // Mock out the foreign collection.
+    deque<DocumentSource::GetNextResult> mockForeignContents{
+        Document(fromjson("{_id: 0, key: 0}")),
+        Document(fromjson("{_id: 1, key: [2, 3]}")),
+        Document(fromjson("{_id: 2, key: null}")),
+        Document(fromjson("{_id: 3}"))};
+    expCtx->mongoProcessInterface =
+        std::make_shared<MockMongoInterface>(std::move(mockForeignContents));
+
+    auto lookupSpec = Document{{"$lookup",
+                                Document{{"from", fromNs.coll()},
+                                         {"localField", "joinKey"_sd},
+                                         {"foreignField", "key"_sd},
+                                         {"as", "matches"_sd}}}}
+                          .toBson();
+    auto parsed = DocumentSourceLookUp::createFromBson(lookupSpec.firstElement(), expCtx);
+    auto lookup = static_cast<DocumentSourceLookUp*>(parsed.get());
+    lookup->setSource(mockLocalSource.get());
+
+    auto next = lookup->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next.releaseDocument(),
+                       Document(fromjson("{_id: 0, joinKey: 0, matches: [{_id: 0, key: 0}]}")));
+
+    // An array-valued local field joins on each of its elements, and matches an array-valued
+    // foreign field containing any of them.
+    next = lookup->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(
+        next.releaseDocument(),
+        Document(fromjson("{_id: 1, joinKey: [1, 2], matches: [{_id: 1, key: [2, 3]}]}")));
+
+    // A missing local field is treated as null, which matches both null and missing foreign
+    // join fields.
+    next = lookup->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next.releaseDocument(),
+                       Document(fromjson("{_id: 2, matches: [{_id: 2, key: null}, {_id: 3}]}")));
+
+    next = lookup->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next.releaseDocument(),
+                       Document(fromjson("{_id: 3, joinKey: 5, matches: []}")));
+
+    ASSERT_TRUE(lookup->getNext().isEOF());
+    lookup->dispose();
+}
+
 TEST_F(DocumentSourceLookUpTest, ShouldPropagatePausesWhileUnwinding) {
     auto expCtx = getExpCtx();
     NamespaceString fromNs("test", "foreign");
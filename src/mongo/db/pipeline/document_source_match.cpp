@@ -43,6 +43,7 @@
 #include "mongo/db/pipeline/document_path_support.h"
 #include "mongo/db/pipeline/expression.h"
 #include "mongo/db/pipeline/lite_parsed_document_source.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/util/str.h"
 
 namespace mongo {
@@ -80,20 +81,35 @@ intrusive_ptr<DocumentSource> DocumentSourceMatch::optimize() {
     return this;
 }
 
+bool DocumentSourceMatch::matchesDocument(const Document& input) {
+    // '_expression' cannot change once execution has begun, so it is now safe to compile it.
+    if (!_matchProgram && internalQueryEnableMatchCompilation.load()) {
+        _matchProgram.emplace(MatchProgram::compile(_expression.get()));
+    }
+
+    // If the Document is still an unmodified view of its backing BSON, as documents fed straight
+    // from DocumentSourceCursor are, match directly against that BSON. Documents are materialized
+    // lazily, so non-matching records are discarded without ever deserializing a field.
+    if (auto bson = input.toBsonIfTriviallyConvertible()) {
+        return _matchProgram ? _matchProgram->matches(*bson) : _expression->matchesBSON(*bson);
+    }
+
+    // MatchExpression only takes BSON documents, so we have to make one. As an optimization,
+    // only serialize the fields we need to do the match.
+    BSONObj toMatch = _dependencies.needWholeDocument
+        ? input.toBson()
+        : document_path_support::documentToBsonWithPaths(input, _dependencies.fields);
+
+    return _matchProgram ? _matchProgram->matches(toMatch) : _expression->matchesBSON(toMatch);
+}
+
 DocumentSource::GetNextResult DocumentSourceMatch::doGetNext() {
     // The user facing error should have been generated earlier.
     massert(17309, "Should never call getNext on a $match stage with $text clause", !_isTextQuery);
 
     auto nextInput = pSource->getNext();
     for (; nextInput.isAdvanced(); nextInput = pSource->getNext()) {
-        // MatchExpression only takes BSON documents, so we have to make one. As an optimization,
-        // only serialize the fields we need to do the match.
-        BSONObj toMatch = _dependencies.needWholeDocument
-            ? nextInput.getDocument().toBson()
-            : document_path_support::documentToBsonWithPaths(nextInput.getDocument(),
-                                                             _dependencies.fields);
-
-        if (_expression->matchesBSON(toMatch)) {
+        if (matchesDocument(nextInput.getDocument())) {
             return nextInput;
         }
 
@@ -500,6 +516,7 @@ DocumentSourceMatch::DocumentSourceMatch(const BSONObj& query,
 }
 
 void DocumentSourceMatch::rebuild(BSONObj filter) {
+    _matchProgram = boost::none;
     _predicate = filter.getOwned();
     _expression = uassertStatusOK(MatchExpressionParser::parse(
         _predicate, pExpCtx, ExtensionsCallbackNoop(), Pipeline::kAllowedMatcherFeatures));
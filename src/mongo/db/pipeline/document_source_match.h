@@ -34,6 +34,7 @@
 #include <utility>
 
 #include "mongo/client/connpool.h"
+#include "mongo/db/matcher/match_program.h"
 #include "mongo/db/matcher/matcher.h"
 #include "mongo/db/pipeline/document_source.h"
 #include "mongo/util/intrusive_counter.h"
@@ -119,6 +120,12 @@ public:
         return {GetModPathsReturn::Type::kFiniteSet, std::set<std::string>{}, {}};
     }
 
+    /**
+     * Returns whether 'input' satisfies this stage's filter. Exposed so that a fused stage can
+     * evaluate the filter without paying a getNext() stage boundary per document.
+     */
+    bool matchesDocument(const Document& input);
+
     /**
      * Access the MatchExpression stored inside the DocumentSourceMatch. Does not release ownership.
      */
@@ -192,6 +199,11 @@ protected:
 private:
     std::unique_ptr<MatchExpression> _expression;
 
+    // The flattened form of '_expression', compiled lazily on first execution when match
+    // compilation is enabled. Compilation is deferred until then because '_expression' may still
+    // be optimized, split or rebuilt while the pipeline is being assembled.
+    boost::optional<MatchProgram> _matchProgram;
+
     bool _isTextQuery;
 
     // Cache the dependencies so that we know what fields we need to serialize to BSON for matching.
@@ -632,6 +632,25 @@ TEST_F(DocumentSourceMatchTest, ShouldCorrectlyEvaluateJSONSchemaPredicate) {
     ASSERT_TRUE(match->getNext().isEOF());
 }
 
+TEST_F(DocumentSourceMatchTest, ShouldMatchBsonBackedDocumentsWithoutMaterializing) {
+    const auto match = DocumentSourceMatch::create(fromjson("{a: 1}"), getExpCtx());
+
+    // Documents backed by unmodified BSON take the raw-BSON matching fast path; the result must
+    // agree with matching a materialized Document.
+    const BSONObj matching = fromjson("{_id: 0, a: 1, b: 'big payload'}");
+    const BSONObj nonMatching = fromjson("{_id: 1, a: 2, b: 'big payload'}");
+    const auto mock = DocumentSourceMock::createForTest(
+        {Document(matching), Document(nonMatching)}, getExpCtx());
+
+    match->setSource(mock.get());
+
+    auto next = match->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(next.releaseDocument(), Document(matching));
+
+    ASSERT_TRUE(match->getNext().isEOF());
+}
+
 TEST_F(DocumentSourceMatchTest, ShouldShowOptimizationsInExplainOutputWhenOptimized) {
     const auto match = DocumentSourceMatch::create(fromjson("{$and: [{a: 1}]}"), getExpCtx());
 
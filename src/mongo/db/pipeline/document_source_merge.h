@@ -182,7 +182,10 @@ private:
         return bob.obj();
     }
 
-    void spill(BatchedObjects&& batch) override;
+    void spill(const boost::intrusive_ptr<ExpressionContext>& expCtx,
+               BatchedObjects&& batch) override;
+
+    bool canSpillInParallel() const override;
 
     void waitWhileFailPointEnabled() override;
 
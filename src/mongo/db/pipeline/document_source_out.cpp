@@ -55,6 +55,9 @@ REGISTER_DOCUMENT_SOURCE(out,
                          DocumentSourceOut::createFromBson);
 
 DocumentSourceOut::~DocumentSourceOut() {
+    // Wait out any in-flight writer tasks before touching the temp collection below; the base
+    // class destructor, which normally tears down the writer pool, only runs afterwards.
+    shutdownWriterPool();
     DESTRUCTOR_GUARD(
         // Make sure we drop the temp collection if anything goes wrong. Errors are ignored
         // here because nothing can be done about them. Additionally, if this fails and the
@@ -119,12 +119,19 @@ private:
 
     void finalize() override;
 
-    void spill(BatchedObjects&& batch) override {
-        DocumentSourceWriteBlock writeBlock(pExpCtx->opCtx);
+    void spill(const boost::intrusive_ptr<ExpressionContext>& expCtx,
+               BatchedObjects&& batch) override {
+        DocumentSourceWriteBlock writeBlock(expCtx->opCtx);
 
         auto targetEpoch = boost::none;
-        uassertStatusOK(pExpCtx->mongoProcessInterface->insert(
-            pExpCtx, _tempNs, std::move(batch), _writeConcern, targetEpoch));
+        uassertStatusOK(expCtx->mongoProcessInterface->insert(
+            expCtx, _tempNs, std::move(batch), _writeConcern, targetEpoch));
+    }
+
+    bool canSpillInParallel() const override {
+        // Every batch is a plain insert into the stage's private temp collection, so batches may
+        // be written in any order.
+        return true;
     }
 
     std::pair<BSONObj, int> makeBatchObject(Document&& doc) const override {
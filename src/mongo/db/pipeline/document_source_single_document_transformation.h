@@ -94,6 +94,14 @@ public:
         return *_parsedTransform;
     }
 
+    /**
+     * Applies this stage's transformation to 'input'. Exposed so that a fused stage can evaluate
+     * the transformation without paying a getNext() stage boundary per document.
+     */
+    Document applyTransformation(const Document& input) {
+        return _parsedTransform->applyTransformation(input);
+    }
+
 protected:
     GetNextResult doGetNext() final;
     void doDispose() final;
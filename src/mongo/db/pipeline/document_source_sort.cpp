@@ -71,6 +71,9 @@ DocumentSourceSort::DocumentSourceSort(const boost::intrusive_ptr<ExpressionCont
     uassert(15976,
             "$sort stage must have at least one sort key",
             !_sortExecutor->sortPattern().empty());
+    if (pExpCtx->opCtx) {
+        _sortExecutor->attachMemoryBroker(pExpCtx->opCtx->getServiceContext());
+    }
 }
 
 REGISTER_DOCUMENT_SOURCE(sort,
@@ -78,7 +78,18 @@ private:
 
     Value _inputArray;
 
-    MutableDocument _output;
+    // The document being unwound, used to lazily initialize the second output buffer.
+    Document _document;
+
+    // Two output buffers used in alternation for consecutive array elements. Emitting from
+    // alternating buffers lets MutableDocument's copy-on-write machinery avoid cloning the sibling
+    // fields for every element: by the time a buffer is mutated again, a streaming downstream
+    // stage has usually released the document emitted from it two elements earlier, so the
+    // buffer's storage is no longer shared and the unwound field is simply overwritten in place.
+    // If downstream retains the emitted documents (e.g. a blocking $sort), mutating a still-shared
+    // buffer falls back to the usual copy-on-write clone and remains correct.
+    MutableDocument _outputs[2];
+    bool _outputInitialized[2] = {false, false};
 
     // Document indexes of the field path components.
     vector<Position> _unwindPathFieldIndexes;
@@ -96,7 +107,10 @@ DocumentSourceUnwind::Unwinder::Unwinder(const FieldPath& unwindPath,
 
 void DocumentSourceUnwind::Unwinder::resetDocument(const Document& document) {
     // Reset document specific attributes.
-    _output.reset(document);
+    _document = document;
+    _outputs[0].reset(document);
+    _outputInitialized[0] = true;
+    _outputInitialized[1] = false;
     _unwindPathFieldIndexes.clear();
     _index = 0;
     _inputArray = document.getNestedField(_unwindPath, &_unwindPathFieldIndexes);
@@ -114,6 +128,15 @@ DocumentSource::GetNextResult DocumentSourceUnwind::Unwinder::getNext() {
     // this index in the output document, or null if the value didn't come from an array.
     boost::optional<long long> indexForOutput;
 
+    // Elements alternate between the two output buffers; the non-array cases below only ever run
+    // with '_index' still at zero and so use the buffer primed by resetDocument().
+    const size_t whichOutput = _index % 2;
+    MutableDocument& output = _outputs[whichOutput];
+    if (!_outputInitialized[whichOutput]) {
+        output.reset(_document);
+        _outputInitialized[whichOutput] = true;
+    }
+
     if (_inputArray.getType() == Array) {
         const size_t length = _inputArray.getArrayLength();
         invariant(_index == 0 || _index < length);
@@ -124,7 +147,7 @@ DocumentSource::GetNextResult DocumentSourceUnwind::Unwinder::getNext() {
             if (!_preserveNullAndEmptyArrays) {
                 return GetNextResult::makeEOF();
             }
-            _output.removeNestedField(_unwindPathFieldIndexes);
+            output.removeNestedField(_unwindPathFieldIndexes);
         } else {
             // Set field to be the next element in the array. If needed, this will automatically
             // clone all the documents along the field path so that the end values are not shared
@@ -132,7 +155,7 @@ DocumentSource::GetNextResult DocumentSourceUnwind::Unwinder::getNext() {
             // clone. Because the value at the end will be replaced, everything along the path
             // leading to that will be replaced in order not to share that change with any other
             // clones (or the original).
-            _output.setNestedField(_unwindPathFieldIndexes, _inputArray[_index]);
+            output.setNestedField(_unwindPathFieldIndexes, _inputArray[_index]);
             indexForOutput = _index;
             _index++;
             _haveNext = _index < length;
@@ -149,11 +172,15 @@ DocumentSource::GetNextResult DocumentSourceUnwind::Unwinder::getNext() {
     }
 
     if (_indexPath) {
-        _output.getNestedField(*_indexPath) =
+        output.getNestedField(*_indexPath) =
             indexForOutput ? Value(*indexForOutput) : Value(BSONNULL);
     }
 
-    return _haveNext ? _output.peek() : _output.freeze();
+    if (_haveNext) {
+        return output.peek();
+    }
+    _outputInitialized[whichOutput] = false;
+    return output.freeze();
 }
 
 DocumentSourceUnwind::DocumentSourceUnwind(const intrusive_ptr<ExpressionContext>& pExpCtx,
@@ -708,6 +708,32 @@ TEST_F(UnwindStageTest, ShouldPropagatePauses) {
     ASSERT_TRUE(unwind->getNext().isEOF());
 }
 
+TEST_F(UnwindStageTest, RetainedOutputDocumentsAreNotModifiedByLaterElements) {
+    // The unwinder reuses output buffers between elements; a caller that holds on to earlier
+    // results (e.g. a blocking stage) must still observe the values it was originally handed.
+    const bool includeNullIfEmptyOrMissing = false;
+    const boost::optional<std::string> includeArrayIndex = boost::none;
+    auto unwind = DocumentSourceUnwind::create(
+        getExpCtx(), "array", includeNullIfEmptyOrMissing, includeArrayIndex);
+    auto source = DocumentSourceMock::createForTest(
+        {Document{{"_id", 0},
+                  {"array", vector<Value>{Value(1), Value(2), Value(3), Value(4), Value(5)}}}},
+        getExpCtx());
+
+    unwind->setSource(source.get());
+
+    vector<Document> results;
+    for (auto next = unwind->getNext(); next.isAdvanced(); next = unwind->getNext()) {
+        results.push_back(next.releaseDocument());
+    }
+
+    ASSERT_EQUALS(5U, results.size());
+    for (size_t i = 0; i < results.size(); ++i) {
+        ASSERT_DOCUMENT_EQ(results[i],
+                           (Document{{"_id", 0}, {"array", static_cast<int>(i) + 1}}));
+    }
+}
+
 TEST_F(UnwindStageTest, UnwindOnlyModifiesUnwoundPathWhenNotIncludingIndex) {
     const bool includeNullIfEmptyOrMissing = false;
     const boost::optional<std::string> includeArrayIndex = boost::none;
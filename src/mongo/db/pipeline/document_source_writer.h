@@ -33,11 +33,16 @@
 
 #include <fmt/format.h>
 
+#include "mongo/db/client.h"
 #include "mongo/db/db_raii.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/pipeline/document_source.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/read_concern.h"
 #include "mongo/db/storage/recovery_unit.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/util/concurrency/thread_pool.h"
 
 namespace mongo {
 using namespace fmt::literals;
@@ -82,6 +87,14 @@ public:
  * Two other virtual methods exist which a subclass may override: 'initialize()' and 'finalize()',
  * which are called before the first element is read from the input source, and after the last one
  * has been read, respectively.
+ *
+ * If the 'internalDocumentSourceWriterParallelism' knob is greater than 1 and the subclass reports
+ * via 'canSpillInParallel()' that its batches may be written in any order, batches are handed off
+ * to a pool of writer threads instead of being spilled from the pipeline thread. Each writer task
+ * runs under its own Client and OperationContext, so 'spill()' must only touch state that is
+ * read-only once 'initialize()' has returned, and must perform the write through the
+ * ExpressionContext it is given rather than 'pExpCtx'. All outstanding batches are written (and
+ * any writer error rethrown) before 'finalize()' is called.
  */
 template <typename B>
 class DocumentSourceWriter : public DocumentSource {
@@ -96,6 +109,10 @@ public:
           _outputNs(std::move(outputNs)),
           _writeConcern(expCtx->opCtx->getWriteConcern()) {}
 
+    ~DocumentSourceWriter() override {
+        shutdownWriterPool();
+    }
+
     DepsTracker::State getDependencies(DepsTracker* deps) const override {
         deps->needWholeDocument = true;
         return DepsTracker::State::EXHAUSTIVE_ALL;
@@ -133,9 +150,21 @@ protected:
     virtual void finalize() {}
 
     /**
-     * Writes the documents in 'batch' to the output namespace.
+     * Writes the documents in 'batch' to the output namespace. When parallel spilling is in use
+     * this is invoked on a writer thread, so the write must go through the given 'expCtx' (whose
+     * opCtx belongs to the writer task) rather than 'pExpCtx'.
+     */
+    virtual void spill(const boost::intrusive_ptr<ExpressionContext>& expCtx,
+                       BatchedObjects&& batch) = 0;
+
+    /**
+     * Returns whether the batches produced by this stage may be written in any order relative to
+     * each other. Only such stages are eligible for parallel spilling; the rest always spill
+     * serially from the pipeline thread.
      */
-    virtual void spill(BatchedObjects&& batch) = 0;
+    virtual bool canSpillInParallel() const {
+        return false;
+    }
 
     /**
      * Creates a batch object from the given document and returns it to the caller along with the
@@ -149,6 +178,25 @@ protected:
      */
     virtual void waitWhileFailPointEnabled() {}
 
+    /**
+     * Blocks until all dispatched batches have been written and tears down the writer pool. Safe
+     * to call when no pool was ever started. A subclass whose destructor touches the output
+     * collection (e.g. to drop a temporary namespace) must call this first, as the base class
+     * destructor only runs afterwards.
+     */
+    void shutdownWriterPool() {
+        if (!_writerPool) {
+            return;
+        }
+        {
+            stdx::unique_lock<Latch> lk(_writerMutex);
+            _writerCv.wait(lk, [&] { return _outstandingBatches == 0; });
+        }
+        _writerPool->shutdown();
+        _writerPool->join();
+        _writerPool.reset();
+    }
+
     // The namespace where the output will be written to.
     const NamespaceString _outputNs;
 
@@ -160,8 +208,101 @@ protected:
     WriteConcernOptions _writeConcern;
 
 private:
+    /**
+     * Starts the writer pool if this stage and the current operation are eligible for parallel
+     * spilling. Called once, right after 'initialize()'.
+     */
+    void startWriterPoolIfEligible() {
+        const auto parallelism = internalDocumentSourceWriterParallelism.load();
+        if (parallelism <= 1 || !canSpillInParallel()) {
+            return;
+        }
+        // Writer tasks run under their own operation contexts, so writes issued from them would
+        // neither belong to the stage's transaction nor be tracked as retryable statements.
+        if (pExpCtx->inMultiDocumentTransaction || pExpCtx->opCtx->getTxnNumber()) {
+            return;
+        }
+        ThreadPool::Options options;
+        options.threadNamePrefix = "AggWriter-";
+        options.poolName = "DocumentSourceWriterThreadPool";
+        options.minThreads = 0;
+        options.maxThreads = static_cast<size_t>(parallelism);
+        options.onCreateThread = [](const std::string& threadName) {
+            Client::initThread(threadName);
+        };
+        // Allow one queued batch per writer so the pipeline thread can build the next batch while
+        // all writers are busy, without buffering an unbounded amount of output.
+        _maxOutstandingBatches = static_cast<size_t>(parallelism) * 2;
+        _writerPool = std::make_unique<ThreadPool>(std::move(options));
+        _writerPool->startup();
+    }
+
+    /**
+     * Hands 'batch' to the writer pool, or writes it inline when parallel spilling is not in use.
+     * Blocks while the maximum number of batches is outstanding, and rethrows the first error
+     * reported by a writer task.
+     */
+    void dispatchSpill(BatchedObjects&& batch) {
+        if (!_writerPool) {
+            spill(pExpCtx, std::move(batch));
+            return;
+        }
+        {
+            stdx::unique_lock<Latch> lk(_writerMutex);
+            _writerCv.wait(lk, [&] {
+                return _outstandingBatches < _maxOutstandingBatches || !_firstWriterError.isOK();
+            });
+            uassertStatusOK(_firstWriterError);
+            ++_outstandingBatches;
+        }
+        // The copied ExpressionContext is used only by this task; its opCtx is repointed at the
+        // task's own operation context before the write.
+        auto expCtx = pExpCtx->copyWith(pExpCtx->ns);
+        _writerPool->schedule(
+            [this, expCtx = std::move(expCtx), batch = std::move(batch)](Status status) mutable {
+                if (status.isOK()) {
+                    try {
+                        auto opCtx = cc().makeOperationContext();
+                        expCtx->opCtx = opCtx.get();
+                        spill(expCtx, std::move(batch));
+                    } catch (const DBException& ex) {
+                        status = ex.toStatus();
+                    }
+                }
+                stdx::lock_guard<Latch> lk(_writerMutex);
+                if (!status.isOK() && _firstWriterError.isOK()) {
+                    _firstWriterError = std::move(status);
+                }
+                --_outstandingBatches;
+                _writerCv.notify_all();
+            });
+    }
+
+    /**
+     * Blocks until all dispatched batches have been written and rethrows the first writer error,
+     * if any. Called before 'finalize()' so that the output collection is complete by the time it
+     * is finalized.
+     */
+    void awaitAllWritesSpilled() {
+        if (!_writerPool) {
+            return;
+        }
+        stdx::unique_lock<Latch> lk(_writerMutex);
+        _writerCv.wait(lk, [&] { return _outstandingBatches == 0; });
+        uassertStatusOK(_firstWriterError);
+    }
+
     bool _initialized{false};
     bool _done{false};
+
+    // Set only when this stage spills in parallel; null otherwise. The mutex guards the counter
+    // and the error status below, and the condition variable is signalled whenever either changes.
+    std::unique_ptr<ThreadPool> _writerPool;
+    Mutex _writerMutex = MONGO_MAKE_LATCH("DocumentSourceWriter::_writerMutex");
+    stdx::condition_variable _writerCv;
+    size_t _outstandingBatches{0};
+    size_t _maxOutstandingBatches{0};
+    Status _firstWriterError = Status::OK();
 };
 
 template <typename B>
@@ -185,6 +326,7 @@ DocumentSource::GetNextResult DocumentSourceWriter<B>::doGetNext() {
 
         if (!_initialized) {
             initialize();
+            startWriterPoolIfEligible();
             _initialized = true;
         }
 
@@ -202,14 +344,14 @@ DocumentSource::GetNextResult DocumentSourceWriter<B>::doGetNext() {
             if (!batch.empty() &&
                 (bufferedBytes > BSONObjMaxUserSize ||
                  batch.size() >= write_ops::kMaxWriteBatchSize)) {
-                spill(std::move(batch));
+                dispatchSpill(std::move(batch));
                 batch.clear();
                 bufferedBytes = objSize;
             }
             batch.push_back(obj);
         }
         if (!batch.empty()) {
-            spill(std::move(batch));
+            dispatchSpill(std::move(batch));
             batch.clear();
         }
 
@@ -221,6 +363,7 @@ DocumentSource::GetNextResult DocumentSourceWriter<B>::doGetNext() {
                 return nextInput;  // Propagate the pause.
             }
             case GetNextResult::ReturnStatus::kEOF: {
+                awaitAllWritesSpilled();
                 _done = true;
                 finalize();
                 return nextInput;
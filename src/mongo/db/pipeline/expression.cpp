@@ -42,9 +42,13 @@
 #include "mongo/db/commands/feature_compatibility_version_documentation.h"
 #include "mongo/db/exec/document_value/document.h"
 #include "mongo/db/exec/document_value/value.h"
+#include "mongo/db/exec/document_value/value_comparator.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/pipeline/expression_context.h"
+#include "mongo/db/pipeline/expression_function.h"
+#include "mongo/db/pipeline/expression_js_emit.h"
 #include "mongo/db/query/datetime/date_time_support.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/platform/bits.h"
 #include "mongo/platform/decimal128.h"
 #include "mongo/util/regex_util.h"
@@ -276,10 +280,7 @@ Value ExpressionAdd::evaluate(const Document& root, Variables* variables) const
     BSONType totalType = NumberInt;
     bool haveDate = false;
 
-    const size_t n = _children.size();
-    for (size_t i = 0; i < n; ++i) {
-        Value val = _children[i]->evaluate(root, variables);
-
+    const auto accumulate = [&](const Value& val) {
         switch (val.getType()) {
             case NumberDecimal:
                 decimalTotal = decimalTotal.add(val.getDecimal());
@@ -308,9 +309,47 @@ Value ExpressionAdd::evaluate(const Document& root, Variables* variables) const
                         str::stream() << "$add only supports numeric or date types, not "
                                       << typeName(val.getType()),
                         val.nullish());
+                return false;
+        }
+        return true;
+    };
+
+    const size_t n = _children.size();
+    size_t i = 0;
+
+    // Sums over NumberInt/NumberLong operands only -- the common shape of arithmetic-bound
+    // pipelines -- run in a plain 64-bit accumulator, skipping the compensated summation and
+    // decimal bookkeeping above. The first non-integer operand (or an overflowing addition)
+    // seeds the general path with the exact partial sum and continues from that operand.
+    bool integersOnly = true;
+    long long longTotal = 0;
+    for (; i < n; ++i) {
+        Value val = _children[i]->evaluate(root, variables);
+        const BSONType type = val.getType();
+        long long sum;
+        if (type == NumberInt && !overflow::add(longTotal, val.getInt(), &sum)) {
+            longTotal = sum;
+        } else if (type == NumberLong && !overflow::add(longTotal, val.getLong(), &sum)) {
+            longTotal = sum;
+            totalType = NumberLong;
+        } else {
+            integersOnly = false;
+            nonDecimalTotal.addLong(longTotal);
+            if (!accumulate(val))
                 return Value(BSONNULL);
+            ++i;
+            break;
         }
     }
+    if (integersOnly) {
+        return totalType == NumberLong ? Value(longTotal) : Value::createIntOrLong(longTotal);
+    }
+
+    for (; i < n; ++i) {
+        Value val = _children[i]->evaluate(root, variables);
+        if (!accumulate(val))
+            return Value(BSONNULL);
+    }
 
     if (haveDate) {
         int64_t longTotal;
@@ -1234,6 +1273,15 @@ intrusive_ptr<Expression> ExpressionDateFromParts::optimize() {
         return ExpressionConstant::create(
             getExpressionContext(), evaluate(Document{}, &(getExpressionContext()->variables)));
     }
+    if (_timeZone && dynamic_cast<ExpressionConstant*>(_timeZone.get())) {
+        // The timezone is constant but the other arguments are not: look the timezone up here,
+        // once, rather than once per document. A constant nullish timezone is left for
+        // evaluate(), which returns null for it.
+        _parsedTimeZone = makeTimeZone(getExpressionContext()->timeZoneDatabase,
+                                       Document{},
+                                       _timeZone.get(),
+                                       &(getExpressionContext()->variables));
+    }
 
     return this;
 }
@@ -1314,8 +1362,9 @@ Value ExpressionDateFromParts::evaluate(const Document& root, Variables* variabl
         return Value(BSONNULL);
     }
 
-    auto timeZone =
-        makeTimeZone(getExpressionContext()->timeZoneDatabase, root, _timeZone.get(), variables);
+    auto timeZone = _parsedTimeZone
+        ? _parsedTimeZone
+        : makeTimeZone(getExpressionContext()->timeZoneDatabase, root, _timeZone.get(), variables);
 
     if (!timeZone) {
         return Value(BSONNULL);
@@ -1492,6 +1541,15 @@ intrusive_ptr<Expression> ExpressionDateFromString::optimize() {
         return ExpressionConstant::create(
             getExpressionContext(), evaluate(Document{}, &(getExpressionContext()->variables)));
     }
+    if (_timeZone && dynamic_cast<ExpressionConstant*>(_timeZone.get())) {
+        // The timezone is constant but the other arguments are not: look the timezone up here,
+        // once, rather than once per document. A constant nullish timezone is left for
+        // evaluate(), which returns null for it.
+        _parsedTimeZone = makeTimeZone(getExpressionContext()->timeZoneDatabase,
+                                       Document{},
+                                       _timeZone.get(),
+                                       &(getExpressionContext()->variables));
+    }
     return this;
 }
 
@@ -1526,8 +1584,9 @@ Value ExpressionDateFromString::evaluate(const Document& root, Variables* variab
 
     // Evaluate the timezone parameter before checking for nullish input, as this will throw an
     // exception for an invalid timezone string.
-    auto timeZone =
-        makeTimeZone(getExpressionContext()->timeZoneDatabase, root, _timeZone.get(), variables);
+    auto timeZone = _parsedTimeZone
+        ? _parsedTimeZone
+        : makeTimeZone(getExpressionContext()->timeZoneDatabase, root, _timeZone.get(), variables);
 
     // Behavior for nullish input takes precedence over other nullish elements.
     if (dateString.nullish()) {
@@ -1650,6 +1709,15 @@ intrusive_ptr<Expression> ExpressionDateToParts::optimize() {
         return ExpressionConstant::create(
             getExpressionContext(), evaluate(Document{}, &(getExpressionContext()->variables)));
     }
+    if (_timeZone && dynamic_cast<ExpressionConstant*>(_timeZone.get())) {
+        // The timezone is constant but the other arguments are not: look the timezone up here,
+        // once, rather than once per document. A constant nullish timezone is left for
+        // evaluate(), which returns null for it.
+        _parsedTimeZone = makeTimeZone(getExpressionContext()->timeZoneDatabase,
+                                       Document{},
+                                       _timeZone.get(),
+                                       &(getExpressionContext()->variables));
+    }
 
     return this;
 }
@@ -1685,8 +1753,9 @@ boost::optional<int> ExpressionDateToParts::evaluateIso8601Flag(const Document&
 Value ExpressionDateToParts::evaluate(const Document& root, Variables* variables) const {
     const Value date = _date->evaluate(root, variables);
 
-    auto timeZone =
-        makeTimeZone(getExpressionContext()->timeZoneDatabase, root, _timeZone.get(), variables);
+    auto timeZone = _parsedTimeZone
+        ? _parsedTimeZone
+        : makeTimeZone(getExpressionContext()->timeZoneDatabase, root, _timeZone.get(), variables);
     if (!timeZone) {
         return Value(BSONNULL);
     }
@@ -1808,6 +1877,15 @@ intrusive_ptr<Expression> ExpressionDateToString::optimize() {
         return ExpressionConstant::create(
             getExpressionContext(), evaluate(Document{}, &(getExpressionContext()->variables)));
     }
+    if (_timeZone && dynamic_cast<ExpressionConstant*>(_timeZone.get())) {
+        // The timezone is constant but the other arguments are not: look the timezone up here,
+        // once, rather than once per document. A constant nullish timezone is left for
+        // evaluate(), which returns null for it.
+        _parsedTimeZone = makeTimeZone(getExpressionContext()->timeZoneDatabase,
+                                       Document{},
+                                       _timeZone.get(),
+                                       &(getExpressionContext()->variables));
+    }
 
     return this;
 }
@@ -1842,8 +1920,9 @@ Value ExpressionDateToString::evaluate(const Document& root, Variables* variable
 
     // Evaluate the timezone parameter before checking for nullish input, as this will throw an
     // exception for an invalid timezone string.
-    auto timeZone =
-        makeTimeZone(getExpressionContext()->timeZoneDatabase, root, _timeZone.get(), variables);
+    auto timeZone = _parsedTimeZone
+        ? _parsedTimeZone
+        : makeTimeZone(getExpressionContext()->timeZoneDatabase, root, _timeZone.get(), variables);
 
     if (date.nullish()) {
         return _onNull ? _onNull->evaluate(root, variables) : Value(BSONNULL);
@@ -1988,6 +2067,169 @@ intrusive_ptr<ExpressionObject> ExpressionObject::parse(
     return new ExpressionObject{expCtx, std::move(children), std::move(expressions)};
 }
 
+namespace {
+
+/**
+ * Returns true if any string in 'val', recursively, is a field path rooted at a non-builtin
+ * variable. Such an expression cannot be re-parsed against the ExpressionContext's top-level
+ * VariablesParseState (the variable is defined by an enclosing $let, $map or similar), so the
+ * common-subexpression rewrite below leaves it alone.
+ */
+bool referencesNonBuiltinVariable(const Value& val) {
+    switch (val.getType()) {
+        case BSONType::String: {
+            StringData raw = val.getStringData();
+            if (!raw.startsWith("$$")) {
+                return false;
+            }
+            auto path = raw.substr(2);
+            auto varName = path.substr(0, path.find('.'));
+            return Variables::kBuiltinVarNameToId.find(varName) ==
+                Variables::kBuiltinVarNameToId.end();
+        }
+        case BSONType::Object: {
+            auto it = val.getDocument().fieldIterator();
+            while (it.more()) {
+                if (referencesNonBuiltinVariable(it.next().second)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+        case BSONType::Array: {
+            for (auto&& elem : val.getArray()) {
+                if (referencesNonBuiltinVariable(elem)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+        default:
+            return false;
+    }
+}
+
+/**
+ * Returns true if 'val' is the serialized form of an operator expression worth deduplicating:
+ * an object whose first field is an operator name. Constants are excluded (sharing them saves
+ * nothing) and so is JavaScript, which may be impure.
+ */
+bool isCandidateSubexpression(const Value& val) {
+    if (val.getType() != BSONType::Object || val.getDocument().empty()) {
+        return false;
+    }
+    auto firstField = val.getDocument().fieldIterator().next().first;
+    return firstField.startsWith("$") && firstField != "$const"_sd && firstField != "$literal"_sd &&
+        firstField != ExpressionFunction::kExpressionName &&
+        firstField != ExpressionInternalJsEmit::kExpressionName;
+}
+
+void countCandidateSubexpressions(const Value& val, ValueUnorderedMap<int>* counts) {
+    if (val.getType() == BSONType::Object) {
+        if (isCandidateSubexpression(val)) {
+            ++(*counts)[val];
+        }
+        auto it = val.getDocument().fieldIterator();
+        while (it.more()) {
+            countCandidateSubexpressions(it.next().second, counts);
+        }
+    } else if (val.getType() == BSONType::Array) {
+        for (auto&& elem : val.getArray()) {
+            countCandidateSubexpressions(elem, counts);
+        }
+    }
+}
+
+/**
+ * Rewrites 'val' top-down, replacing every subexpression that occurs more than once with a
+ * reference to a shared variable. The first time a duplicate is seen its definition is recorded
+ * in 'definitions'; replacement does not descend into recorded definitions, so duplicates nested
+ * inside a larger duplicate stay inline and are evaluated once with it.
+ */
+Value replaceDuplicateSubexpressions(const Value& val,
+                                     const ValueUnorderedMap<int>& counts,
+                                     ValueUnorderedMap<std::string>* assignedNames,
+                                     std::vector<std::pair<std::string, Value>>* definitions) {
+    if (val.getType() == BSONType::Array) {
+        vector<Value> elems;
+        elems.reserve(val.getArrayLength());
+        for (auto&& elem : val.getArray()) {
+            elems.push_back(
+                replaceDuplicateSubexpressions(elem, counts, assignedNames, definitions));
+        }
+        return Value(std::move(elems));
+    }
+    if (val.getType() != BSONType::Object) {
+        return val;
+    }
+
+    if (isCandidateSubexpression(val)) {
+        auto countsIt = counts.find(val);
+        if (countsIt != counts.end() && countsIt->second > 1) {
+            auto nameIt = assignedNames->find(val);
+            if (nameIt == assignedNames->end()) {
+                std::string name = str::stream() << "cse" << definitions->size();
+                nameIt = assignedNames->emplace(val, name).first;
+                definitions->emplace_back(std::move(name), val);
+            }
+            return Value("$$" + nameIt->second);
+        }
+    }
+
+    MutableDocument md;
+    auto it = val.getDocument().fieldIterator();
+    while (it.more()) {
+        auto field = it.next();
+        md[field.first] =
+            replaceDuplicateSubexpressions(field.second, counts, assignedNames, definitions);
+    }
+    return md.freezeToValue();
+}
+
+/**
+ * If the serialized object expression 'serializedObject' evaluates any subexpression more than
+ * once per document, returns an equivalent $let which binds each duplicate to a variable
+ * evaluated once and references the variable at every occurrence. Returns nullptr when there is
+ * nothing to share, or when the expression references an enclosing scope's variables and cannot
+ * be re-parsed here.
+ */
+intrusive_ptr<Expression> rewriteWithCommonSubexpressions(
+    const intrusive_ptr<ExpressionContext>& expCtx, const Value& serializedObject) {
+    if (referencesNonBuiltinVariable(serializedObject)) {
+        return nullptr;
+    }
+
+    auto counts = expCtx->getValueComparator().makeUnorderedValueMap<int>();
+    countCandidateSubexpressions(serializedObject, &counts);
+
+    bool hasDuplicates = false;
+    for (auto&& entry : counts) {
+        if (entry.second > 1) {
+            hasDuplicates = true;
+            break;
+        }
+    }
+    if (!hasDuplicates) {
+        return nullptr;
+    }
+
+    auto assignedNames = expCtx->getValueComparator().makeUnorderedValueMap<std::string>();
+    std::vector<std::pair<std::string, Value>> definitions;
+    Value rewritten =
+        replaceDuplicateSubexpressions(serializedObject, counts, &assignedNames, &definitions);
+    invariant(!definitions.empty());
+
+    MutableDocument vars;
+    for (auto&& definition : definitions) {
+        vars[definition.first] = definition.second;
+    }
+    BSONObj letSpec =
+        Document{{"$let", Document{{"vars", vars.freezeToValue()}, {"in", rewritten}}}}.toBson();
+    return Expression::parseExpression(expCtx, letSpec, expCtx->variablesParseState);
+}
+
+}  // namespace
+
 intrusive_ptr<Expression> ExpressionObject::optimize() {
     bool allValuesConstant = true;
     for (auto&& pair : _expressions) {
@@ -2001,6 +2243,15 @@ intrusive_ptr<Expression> ExpressionObject::optimize() {
         return ExpressionConstant::create(
             getExpressionContext(), evaluate(Document(), &(getExpressionContext()->variables)));
     }
+    if (internalQueryEnableCommonSubexpressionElimination.load()) {
+        if (auto rewritten =
+                rewriteWithCommonSubexpressions(getExpressionContext(), serialize(false))) {
+            // Optimize the $let so that its bound subexpressions and body are themselves
+            // optimized. The rewritten body references the bound variables, so the rewrite does
+            // not fire on it a second time.
+            return rewritten->optimize();
+        }
+    }
     return this;
 }
 
@@ -2142,10 +2393,11 @@ Value ExpressionFieldPath::evaluatePath(size_t index, const Document& input) con
 
     /* if we've hit the end of the path, stop */
     if (index == _fieldPath.getPathLength() - 1)
-        return input[_fieldPath.getFieldName(index)];
+        return input.getField(_fieldPath.getFieldName(index), _fieldPath.getFieldNameHash(index));
 
     // Try to dive deeper
-    const Value val = input[_fieldPath.getFieldName(index)];
+    const Value val =
+        input.getField(_fieldPath.getFieldName(index), _fieldPath.getFieldNameHash(index));
     switch (val.getType()) {
         case Object:
             return evaluatePath(index + 1, val.getDocument());
@@ -2770,10 +3022,7 @@ Value ExpressionMultiply::evaluate(const Document& root, Variables* variables) c
 
     BSONType productType = NumberInt;
 
-    const size_t n = _children.size();
-    for (size_t i = 0; i < n; ++i) {
-        Value val = _children[i]->evaluate(root, variables);
-
+    const auto accumulate = [&](const Value& val) {
         if (val.numeric()) {
             BSONType oldProductType = productType;
             productType = Value::getWidestNumeric(productType, val.getType());
@@ -2796,12 +3045,44 @@ Value ExpressionMultiply::evaluate(const Document& root, Variables* variables) c
                 }
             }
         } else if (val.nullish()) {
-            return Value(BSONNULL);
+            return false;
         } else {
             uasserted(16555,
                       str::stream() << "$multiply only supports numeric types, not "
                                     << typeName(val.getType()));
         }
+        return true;
+    };
+
+    const size_t n = _children.size();
+    size_t i = 0;
+
+    // Products over NumberInt/NumberLong operands only skip the numeric widening and decimal
+    // promotion checks of the general path above. The running double product is kept up to date
+    // so the general path can take over mid-expression at the first non-integer operand (or an
+    // overflowing multiplication) with no change in the result.
+    for (; i < n; ++i) {
+        Value val = _children[i]->evaluate(root, variables);
+        const BSONType type = val.getType();
+        long long product;
+        if ((type == NumberInt || type == NumberLong) &&
+            !overflow::mul(longProduct, val.coerceToLong(), &product)) {
+            longProduct = product;
+            doubleProduct *= val.coerceToDouble();
+            if (type == NumberLong)
+                productType = NumberLong;
+        } else {
+            if (!accumulate(val))
+                return Value(BSONNULL);
+            ++i;
+            break;
+        }
+    }
+
+    for (; i < n; ++i) {
+        Value val = _children[i]->evaluate(root, variables);
+        if (!accumulate(val))
+            return Value(BSONNULL);
     }
 
     if (productType == NumberDouble)
@@ -409,14 +409,12 @@ public:
     Value evaluate(const Document& root, Variables* variables) const final {
         AccumulatorState accum(this->getExpressionContext());
         const auto n = this->_children.size();
-        // If a single array arg is given, loop through it passing each member to the accumulator.
+        // If a single array arg is given, pass the whole array to the accumulator as one batch.
         // If a single, non-array arg is given, pass it directly to the accumulator.
         if (n == 1) {
             Value singleVal = this->_children[0]->evaluate(root, variables);
             if (singleVal.getType() == Array) {
-                for (const Value& val : singleVal.getArray()) {
-                    accum.process(val, false);
-                }
+                accum.processBatch(singleVal.getArray(), false);
             } else {
                 accum.process(singleVal, false);
             }
@@ -605,6 +603,10 @@ public:
         if (!_timeZone) {
             return evaluateDate(date, TimeZoneDatabase::utcZone());
         }
+        if (_parsedTimeZone) {
+            // The timezone argument is constant and was looked up once by optimize().
+            return evaluateDate(date, *_parsedTimeZone);
+        }
         auto timeZoneId = _timeZone->evaluate(root, variables);
         if (timeZoneId.nullish()) {
             return Value(BSONNULL);
@@ -644,6 +646,25 @@ public:
             return ExpressionConstant::create(
                 getExpressionContext(), evaluate(Document{}, &(getExpressionContext()->variables)));
         }
+        if (_timeZone && dynamic_cast<ExpressionConstant*>(_timeZone.get())) {
+            // The timezone is constant but the date is not: look the timezone up here, once,
+            // rather than once per document. A constant nullish timezone is left to evaluate(),
+            // which returns null for it.
+            auto timeZoneId =
+                _timeZone->evaluate(Document{}, &(getExpressionContext()->variables));
+            if (!timeZoneId.nullish()) {
+                uassert(40533,
+                        str::stream()
+                            << _opName
+                            << " requires a string for the timezone argument, but was given a "
+                            << typeName(timeZoneId.getType()) << " (" << timeZoneId.toString()
+                            << ")",
+                        timeZoneId.getType() == BSONType::String);
+                invariant(getExpressionContext()->timeZoneDatabase);
+                _parsedTimeZone = getExpressionContext()->timeZoneDatabase->getTimeZone(
+                    timeZoneId.getString());
+            }
+        }
         return this;
     }
 
@@ -734,6 +755,10 @@ private:
     boost::intrusive_ptr<Expression>& _date;
     // The expression representing the timezone argument.
     boost::intrusive_ptr<Expression>& _timeZone;
+
+    // Populated by optimize() when the timezone argument is a non-null constant, so that the
+    // lookup in the timezone database happens once rather than once per document.
+    boost::optional<TimeZone> _parsedTimeZone;
 };
 
 class ExpressionAbs final : public ExpressionSingleNumericArg<ExpressionAbs> {
@@ -1104,6 +1129,10 @@ private:
     boost::intrusive_ptr<Expression>& _format;
     boost::intrusive_ptr<Expression>& _onNull;
     boost::intrusive_ptr<Expression>& _onError;
+
+    // Populated by optimize() when the timezone argument is a non-null constant, so that the
+    // lookup in the timezone database happens once rather than once per document.
+    boost::optional<TimeZone> _parsedTimeZone;
 };
 
 class ExpressionDateFromParts final : public Expression {
@@ -1181,6 +1210,10 @@ private:
     boost::intrusive_ptr<Expression>& _isoDayOfWeek;
     boost::intrusive_ptr<Expression>& _timeZone;
 
+    // Populated by optimize() when the timezone argument is a non-null constant, so that the
+    // lookup in the timezone database happens once rather than once per document.
+    boost::optional<TimeZone> _parsedTimeZone;
+
     // Some date conversions spend a long time iterating through date tables when dealing with large
     // input numbers, so we place a reasonable limit on the magnitude of any argument to
     // $dateFromParts: inputs that fit within a 16-bit int are permitted.
@@ -1220,6 +1253,10 @@ private:
     boost::intrusive_ptr<Expression>& _date;
     boost::intrusive_ptr<Expression>& _timeZone;
     boost::intrusive_ptr<Expression>& _iso8601;
+
+    // Populated by optimize() when the timezone argument is a non-null constant, so that the
+    // lookup in the timezone database happens once rather than once per document.
+    boost::optional<TimeZone> _parsedTimeZone;
 };
 
 class ExpressionDateToString final : public Expression {
@@ -1251,6 +1288,10 @@ private:
     boost::intrusive_ptr<Expression>& _date;
     boost::intrusive_ptr<Expression>& _timeZone;
     boost::intrusive_ptr<Expression>& _onNull;
+
+    // Populated by optimize() when the timezone argument is a non-null constant, so that the
+    // lookup in the timezone database happens once rather than once per document.
+    boost::optional<TimeZone> _parsedTimeZone;
 };
 
 class ExpressionDayOfMonth final : public DateExpressionAcceptingTimeZone<ExpressionDayOfMonth> {
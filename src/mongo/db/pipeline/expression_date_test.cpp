@@ -512,6 +512,22 @@ TEST_F(DateExpressionTest, DoesRespectTimeZone) {
     ASSERT_VALUE_EQ(hourWithTimezone, Value(15));
 }
 
+TEST_F(DateExpressionTest, DoesRespectTimeZoneAfterOptimizationWithNonConstantDate) {
+    // With a constant timezone but a non-constant date, optimize() caches the parsed TimeZone
+    // rather than folding to a constant. Make sure evaluation still honors the timezone.
+    auto expCtx = getExpCtx();
+    auto date = Date_t::fromMillisSinceEpoch(1496777923000LL);  // 2017-06-06T19:38:43:234Z.
+    auto spec = BSON("$hour" << BSON("date"
+                                     << "$date"
+                                     << "timezone"
+                                     << "America/New_York"));
+    auto dateExp = Expression::parseExpression(expCtx, spec, expCtx->variablesParseState);
+    auto optimized = dateExp->optimize();
+    ASSERT_FALSE(dynamic_cast<ExpressionConstant*>(optimized.get()));
+    auto contextDoc = Document{{"date", date}};
+    ASSERT_VALUE_EQ(optimized->evaluate(contextDoc, &expCtx->variables), Value(15));
+}
+
 TEST_F(DateExpressionTest, DoesResultInNullIfGivenNullishInput) {
     // Make sure they each successfully evaluate with a different TimeZone.
     auto expCtx = getExpCtx();
@@ -39,8 +39,10 @@
 #include "mongo/db/pipeline/expression.h"
 #include "mongo/db/pipeline/expression_context_for_test.h"
 #include "mongo/db/query/collation/collator_interface_mock.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/dbtests/dbtests.h"
 #include "mongo/unittest/unittest.h"
+#include "mongo/util/scopeguard.h"
 
 namespace mongo {
 namespace ExpressionTests {
@@ -397,6 +399,43 @@ TEST(ExpressionObjectOptimizations,
                                                 << "string")));
 };
 
+TEST(ExpressionObjectOptimizations,
+     OptimizingAnObjectWithDuplicateSubexpressionsShouldEvaluateThemOnce) {
+    const auto savedKnobValue = internalQueryEnableCommonSubexpressionElimination.load();
+    internalQueryEnableCommonSubexpressionElimination.store(true);
+    ON_BLOCK_EXIT([&] { internalQueryEnableCommonSubexpressionElimination.store(savedKnobValue); });
+
+    intrusive_ptr<ExpressionContextForTest> expCtx(new ExpressionContextForTest());
+    VariablesParseState vps = expCtx->variablesParseState;
+    auto object = ExpressionObject::parse(
+        expCtx, fromjson("{a: {$add: ['$x', 1]}, b: {$add: ['$x', 1]}, c: '$x'}"), vps);
+    auto optimized = object->optimize();
+
+    // The duplicated {$add: ['$x', 1]} should have been hoisted into a $let-bound variable that
+    // both fields reference.
+    auto letExpression = dynamic_cast<ExpressionLet*>(optimized.get());
+    ASSERT_TRUE(letExpression);
+
+    ASSERT_VALUE_EQ(optimized->evaluate(Document{{"x", 5}}, &(expCtx->variables)),
+                    Value(Document{{"a", 6}, {"b", 6}, {"c", 5}}));
+};
+
+TEST(ExpressionObjectOptimizations,
+     OptimizingAnObjectWithNoDuplicateSubexpressionsShouldLeaveItUnchanged) {
+    const auto savedKnobValue = internalQueryEnableCommonSubexpressionElimination.load();
+    internalQueryEnableCommonSubexpressionElimination.store(true);
+    ON_BLOCK_EXIT([&] { internalQueryEnableCommonSubexpressionElimination.store(savedKnobValue); });
+
+    intrusive_ptr<ExpressionContextForTest> expCtx(new ExpressionContextForTest());
+    VariablesParseState vps = expCtx->variablesParseState;
+    auto object = ExpressionObject::parse(
+        expCtx, fromjson("{a: {$add: ['$x', 1]}, b: {$multiply: ['$x', 2]}}"), vps);
+    auto optimized = object->optimize();
+    ASSERT_TRUE(dynamic_cast<ExpressionObject*>(optimized.get()));
+    ASSERT_VALUE_EQ(optimized->evaluate(Document{{"x", 5}}, &(expCtx->variables)),
+                    Value(Document{{"a", 6}, {"b", 10}}));
+};
+
 }  // namespace Object
 
 }  // namespace
@@ -29,6 +29,8 @@
 
 #pragma once
 
+#include <third_party/murmurhash3/MurmurHash3.h>
+
 #include <string>
 #include <vector>
 
@@ -60,6 +62,17 @@ public:
         return path.substr(0, path.find('.'));
     }
 
+    /**
+     * Hash of a single field name. This is the same hash function the DocumentStorage field cache
+     * uses so that lookups by FieldPath can reuse the hashes precomputed at parse time instead of
+     * re-hashing the path components for every document.
+     */
+    static unsigned hashName(StringData name) {
+        unsigned out;
+        MurmurHash3_x86_32(name.rawData(), name.size(), 0, &out);
+        return out;
+    }
+
     /**
      * Throws a AssertionException if the string is empty or if any of the field names fail
      * validation.
@@ -109,6 +122,14 @@ public:
         return StringData(&_fieldPath[begin], end - begin);
     }
 
+    /**
+     * Return hashName(getFieldName(i)), precomputed when the path was parsed.
+     */
+    unsigned getFieldNameHash(size_t i) const {
+        dassert(i < getPathLength());
+        return _fieldHash[i];
+    }
+
     /**
      * Returns the full path, not including the prefix 'FieldPath::prefix'.
      */
@@ -141,8 +162,10 @@ public:
     FieldPath concat(const FieldPath& tail) const;
 
 private:
-    FieldPath(std::string string, std::vector<size_t> dots)
-        : _fieldPath(std::move(string)), _fieldPathDotPosition(std::move(dots)) {}
+    FieldPath(std::string string, std::vector<size_t> dots, std::vector<unsigned> hashes)
+        : _fieldPath(std::move(string)),
+          _fieldPathDotPosition(std::move(dots)),
+          _fieldHash(std::move(hashes)) {}
 
     static const char prefix = '$';
 
@@ -153,6 +176,9 @@ private:
     // string::npos (which evaluates to -1) and the last contains _fieldPath.size() to facilitate
     // lookup.
     std::vector<size_t> _fieldPathDotPosition;
+
+    // Contains hashName() of each path component, precomputed to speed up field lookups.
+    std::vector<unsigned> _fieldHash;
 };
 
 inline bool operator<(const FieldPath& lhs, const FieldPath& rhs) {
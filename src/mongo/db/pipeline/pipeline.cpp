@@ -42,6 +42,7 @@
 #include "mongo/db/pipeline/accumulator.h"
 #include "mongo/db/pipeline/document_source.h"
 #include "mongo/db/pipeline/document_source_geo_near.h"
+#include "mongo/db/pipeline/document_source_internal_fused_transformation.h"
 #include "mongo/db/pipeline/document_source_match.h"
 #include "mongo/db/pipeline/document_source_merge.h"
 #include "mongo/db/pipeline/document_source_out.h"
@@ -50,6 +51,7 @@
 #include "mongo/db/pipeline/document_source_unwind.h"
 #include "mongo/db/pipeline/expression.h"
 #include "mongo/db/pipeline/expression_context.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/storage/storage_options.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/str.h"
@@ -262,6 +264,13 @@ void Pipeline::optimizePipeline() {
             }
         }
         _sources.swap(optimizedSources);
+
+        // Once the stage order has settled, fuse runs of adjacent stateless stages so that each
+        // run is evaluated in a single pass per document instead of paying a stage boundary per
+        // stage.
+        if (internalQueryEnableStageFusion.load()) {
+            DocumentSourceInternalFusedTransformation::fuseAdjacentStages(pCtx, &_sources);
+        }
     } catch (DBException& ex) {
         ex.addContext("Failed to optimize pipeline");
         throw;
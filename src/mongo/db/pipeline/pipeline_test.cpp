@@ -42,6 +42,7 @@
 #include "mongo/db/pipeline/document_source_change_stream.h"
 #include "mongo/db/pipeline/document_source_facet.h"
 #include "mongo/db/pipeline/document_source_graph_lookup.h"
+#include "mongo/db/pipeline/document_source_internal_fused_transformation.h"
 #include "mongo/db/pipeline/document_source_internal_split_pipeline.h"
 #include "mongo/db/pipeline/document_source_lookup.h"
 #include "mongo/db/pipeline/document_source_lookup_change_post_image.h"
@@ -59,11 +60,13 @@
 #include "mongo/db/pipeline/semantic_analysis.h"
 #include "mongo/db/pipeline/sharded_agg_helpers.h"
 #include "mongo/db/query/collation/collator_interface_mock.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/query/query_test_service_context.h"
 #include "mongo/db/repl/replication_coordinator_mock.h"
 #include "mongo/dbtests/dbtests.h"
 #include "mongo/unittest/death_test.h"
 #include "mongo/unittest/temp_dir.h"
+#include "mongo/util/scopeguard.h"
 
 namespace mongo {
 namespace {
@@ -2840,6 +2843,78 @@ TEST_F(PipelineMustRunOnMongoSTest, SplittablePipelineRunsUnsplitOnMongoSIfSplit
 
 }  // namespace mustRunOnMongoS
 }  // namespace Sharded
+
+namespace StageFusion {
+
+using PipelineStageFusionTest = AggregationContextFixture;
+
+TEST_F(PipelineStageFusionTest, FusesRunsOfAdjacentStatelessStages) {
+    internalQueryEnableStageFusion.store(true);
+    ON_BLOCK_EXIT([] { internalQueryEnableStageFusion.store(false); });
+
+    const std::vector<BSONObj> rawPipeline = {fromjson("{$addFields: {b: {$add: ['$a', 1]}}}"),
+                                              fromjson("{$match: {b: {$gt: 1}}}"),
+                                              fromjson("{$project: {_id: false, b: true}}")};
+    auto pipeline = Pipeline::parse(rawPipeline, getExpCtx());
+    pipeline->optimizePipeline();
+
+    ASSERT_EQ(pipeline->getSources().size(), 1UL);
+    auto fused = dynamic_cast<DocumentSourceInternalFusedTransformation*>(
+        pipeline->getSources().front().get());
+    ASSERT(fused);
+    ASSERT_EQ(fused->getFusedStages().size(), 3UL);
+
+    // Serializing for dispatch decomposes the fused stage back into its constituents, so any
+    // node receiving the pipeline can parse it.
+    ASSERT_EQ(pipeline->serialize().size(), 3UL);
+}
+
+TEST_F(PipelineStageFusionTest, DoesNotFuseLeadingMatch) {
+    internalQueryEnableStageFusion.store(true);
+    ON_BLOCK_EXIT([] { internalQueryEnableStageFusion.store(false); });
+
+    // The leading $match must stay a separate stage so that it remains eligible for pushdown into
+    // the query layer.
+    const std::vector<BSONObj> rawPipeline = {fromjson("{$match: {a: 1}}"),
+                                              fromjson("{$addFields: {b: 1}}"),
+                                              fromjson("{$project: {_id: false, b: true}}")};
+    auto pipeline = Pipeline::parse(rawPipeline, getExpCtx());
+    pipeline->optimizePipeline();
+
+    ASSERT_EQ(pipeline->getSources().size(), 2UL);
+    ASSERT(dynamic_cast<DocumentSourceMatch*>(pipeline->getSources().front().get()));
+    auto fused = dynamic_cast<DocumentSourceInternalFusedTransformation*>(
+        pipeline->getSources().back().get());
+    ASSERT(fused);
+    ASSERT_EQ(fused->getFusedStages().size(), 2UL);
+}
+
+TEST_F(PipelineStageFusionTest, FusedStagesProduceSameResults) {
+    internalQueryEnableStageFusion.store(true);
+    ON_BLOCK_EXIT([] { internalQueryEnableStageFusion.store(false); });
+
+    auto expCtx = getExpCtx();
+    const std::vector<BSONObj> rawPipeline = {fromjson("{$addFields: {b: {$add: ['$a', 1]}}}"),
+                                              fromjson("{$match: {b: {$gt: 2}}}")};
+    auto pipeline = Pipeline::parse(rawPipeline, expCtx);
+    auto mock = DocumentSourceMock::createForTest({"{a: 1}", "{a: 2}", "{a: 3}"}, expCtx);
+    pipeline->addInitialSource(mock);
+    pipeline->optimizePipeline();
+
+    ASSERT_EQ(pipeline->getSources().size(), 2UL);
+    ASSERT(dynamic_cast<DocumentSourceInternalFusedTransformation*>(
+        pipeline->getSources().back().get()));
+
+    auto doc = pipeline->getNext();
+    ASSERT(doc);
+    ASSERT_EQ((*doc)["b"].getInt(), 3);
+    doc = pipeline->getNext();
+    ASSERT(doc);
+    ASSERT_EQ((*doc)["b"].getInt(), 4);
+    ASSERT_FALSE(pipeline->getNext());
+}
+
+}  // namespace StageFusion
 }  // namespace Optimizations
 
 TEST(PipelineInitialSource, GeoNearInitialQuery) {
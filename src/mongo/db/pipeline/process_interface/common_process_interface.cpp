@@ -74,8 +74,7 @@ std::vector<BSONObj> CommonProcessInterface::getCurrentOps(
     auto blockedOpGuard = DiagnosticInfo::maybeMakeBlockedOpForTest(opCtx->getClient());
 #endif
 
-    for (ServiceContext::LockedClientsCursor cursor(opCtx->getClient()->getServiceContext());
-         Client* client = cursor.next();) {
+    auto reportClient = [&](Client* client) {
         invariant(client);
 
         stdx::lock_guard<Client> lk(*client);
@@ -84,17 +83,33 @@ std::vector<BSONObj> CommonProcessInterface::getCurrentOps(
         if (ctxAuth->getAuthorizationManager().isAuthEnabled() &&
             userMode == CurrentOpUserMode::kExcludeOthers &&
             !ctxAuth->isCoauthorizedWithClient(client, lk)) {
-            continue;
+            return;
         }
 
         // Ignore inactive connections unless 'idleConnections' is true.
         if (connMode == CurrentOpConnectionsMode::kExcludeIdle &&
             !client->hasAnyActiveCurrentOp()) {
-            continue;
+            return;
         }
 
         // Delegate to the mongoD- or mongoS-specific implementation of _reportCurrentOpForClient.
         ops.emplace_back(_reportCurrentOpForClient(opCtx, client, truncateMode, backtraceMode));
+    };
+
+    if (connMode == CurrentOpConnectionsMode::kExcludeIdle) {
+        // When idle connections are excluded, enumerate the operation registry rather than the
+        // full client list so the scan cost is proportional to the number of in-flight operations
+        // instead of the number of connections.
+        for (ServiceContext::LockedActiveClientsCursor cursor(
+                 opCtx->getClient()->getServiceContext());
+             Client* client = cursor.next();) {
+            reportClient(client);
+        }
+    } else {
+        for (ServiceContext::LockedClientsCursor cursor(opCtx->getClient()->getServiceContext());
+             Client* client = cursor.next();) {
+            reportClient(client);
+        }
     }
 
     // If 'cursorMode' is set to include idle cursors, retrieve them and add them to ops.
@@ -0,0 +1,104 @@
+// profile_memory_sink.cpp
+
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2018-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/profile_memory_sink.h"
+
+#include "mongo/db/introspect_gen.h"
+
+namespace mongo {
+
+ProfileMemorySink& ProfileMemorySink::get() {
+    static ProfileMemorySink sink;
+    return sink;
+}
+
+bool ProfileMemorySink::enabled() const {
+    return gProfilingMemorySinkSize.load() > 0;
+}
+
+void ProfileMemorySink::append(const std::string& dbName, const BSONObj& entry) {
+    const long long capacity = gProfilingMemorySinkSize.load();
+    if (capacity <= 0)
+        return;
+
+    stdx::lock_guard<Latch> lk(_mutex);
+    BSONObjBuilder b;
+    b.append("sinkId", _nextId);
+    b.appendElements(entry);
+    _entries.push_back({_nextId, dbName, b.obj()});
+    ++_nextId;
+    // The capacity parameter may have been lowered at runtime; trim until the
+    // buffer fits.
+    while (static_cast<long long>(_entries.size()) > capacity) {
+        _entries.pop_front();
+        ++_dropped;
+    }
+}
+
+void ProfileMemorySink::read(const std::string& dbName,
+                             long long sinceId,
+                             long long limit,
+                             BSONObjBuilder* result) const {
+    stdx::lock_guard<Latch> lk(_mutex);
+    long long lastId = sinceId;
+    long long returned = 0;
+    // Leave room in the reply for the entries themselves plus command overhead.
+    const int maxBytes = BSONObjMaxUserSize - 1024 * 1024;
+    int bytes = 0;
+    {
+        BSONArrayBuilder entries(result->subarrayStart("entries"));
+        for (auto&& entry : _entries) {
+            if (entry.id <= sinceId || entry.db != dbName)
+                continue;
+            if (returned >= limit || bytes + entry.doc.objsize() > maxBytes)
+                break;
+            entries.append(entry.doc);
+            bytes += entry.doc.objsize();
+            lastId = entry.id;
+            ++returned;
+        }
+        entries.doneFast();
+    }
+    result->append("lastId", lastId);
+    result->append("dropped", _dropped);
+}
+
+void ProfileMemorySink::clear() {
+    stdx::lock_guard<Latch> lk(_mutex);
+    _entries.clear();
+    _dropped = 0;
+}
+
+}  // namespace mongo
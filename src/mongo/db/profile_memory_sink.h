@@ -0,0 +1,101 @@
+// profile_memory_sink.h
+
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2018-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+#pragma once
+
+#include <deque>
+#include <string>
+
+#include "mongo/bson/bsonobj.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/platform/mutex.h"
+
+namespace mongo {
+
+/**
+ * Bounded in-memory buffer of profile entries, shared by all databases.
+ *
+ * When the 'profilingMemorySinkSize' server parameter is non-zero, profile()
+ * appends entries here instead of writing them to system.profile, so profiling
+ * takes no collection locks and does no storage writes. The oldest entries are
+ * evicted once the configured capacity is reached. Entries are read back with
+ * the getProfilingMemorySink command.
+ */
+class ProfileMemorySink {
+public:
+    static ProfileMemorySink& get();
+
+    /**
+     * Returns true if the sink is configured to retain entries
+     * ('profilingMemorySinkSize' > 0).
+     */
+    bool enabled() const;
+
+    /**
+     * Buffers a copy of 'entry' for database 'dbName', tagging it with a
+     * monotonically increasing 'sinkId' field. Evicts the oldest entries if
+     * the buffer is over capacity. No-op when the sink is disabled.
+     */
+    void append(const std::string& dbName, const BSONObj& entry);
+
+    /**
+     * Appends to 'result' an 'entries' array with up to 'limit' buffered
+     * entries for 'dbName' whose sinkId is greater than 'sinceId' (oldest
+     * first), along with 'lastId' (the sinkId of the last returned entry) and
+     * 'dropped' (the number of entries evicted before they were read).
+     */
+    void read(const std::string& dbName,
+              long long sinceId,
+              long long limit,
+              BSONObjBuilder* result) const;
+
+    /**
+     * Discards all buffered entries (for every database). sinkId numbering
+     * continues from where it left off.
+     */
+    void clear();
+
+private:
+    struct Entry {
+        long long id;
+        std::string db;
+        BSONObj doc;
+    };
+
+    mutable Mutex _mutex = MONGO_MAKE_LATCH("ProfileMemorySink::_mutex");
+    std::deque<Entry> _entries;
+    long long _nextId = 1;
+    long long _dropped = 0;
+};
+
+}  // namespace mongo
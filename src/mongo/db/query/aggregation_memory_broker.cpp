@@ -0,0 +1,110 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/query/aggregation_memory_broker.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "mongo/db/query/query_knobs_gen.h"
+#include "mongo/db/service_context.h"
+
+namespace mongo {
+
+namespace {
+
+const auto getAggregationMemoryBroker =
+    ServiceContext::declareDecoration<AggregationMemoryBroker>();
+
+// A stage is always allowed at least a megabyte before spilling, however contended the pool.
+constexpr size_t kMinimumGrantBytes = 1024 * 1024;
+
+size_t poolSizeBytes() {
+    return static_cast<size_t>(internalQueryAggregationMemoryPoolMB.load()) * 1024 * 1024;
+}
+
+}  // namespace
+
+AggregationMemoryBroker& AggregationMemoryBroker::get(ServiceContext* svcCtx) {
+    return getAggregationMemoryBroker(svcCtx);
+}
+
+AggregationMemoryBroker::Lease AggregationMemoryBroker::makeLease() {
+    _numLeases.fetchAndAdd(1);
+    return Lease(this);
+}
+
+void AggregationMemoryBroker::Lease::reportUsage(size_t currentBytes) {
+    if (!_broker) {
+        return;
+    }
+    const auto delta = static_cast<long long>(currentBytes) - static_cast<long long>(_reportedBytes);
+    if (static_cast<size_t>(std::abs(delta)) < kReportGranularityBytes) {
+        return;
+    }
+    _broker->_totalReportedBytes.fetchAndAdd(delta);
+    _reportedBytes = currentBytes;
+}
+
+size_t AggregationMemoryBroker::Lease::effectiveLimit(size_t staticLimitBytes) const {
+    const auto pool = poolSizeBytes();
+    if (!_broker || pool == 0) {
+        return staticLimitBytes;
+    }
+
+    // Memory reported by every lease other than this one. The subtraction saturates at zero since
+    // the atomic total can momentarily lag behind this lease's own reported figure.
+    const auto total = std::max<long long>(_broker->_totalReportedBytes.load(), 0);
+    const auto others =
+        static_cast<size_t>(std::max<long long>(total - static_cast<long long>(_reportedBytes), 0));
+
+    // Whatever the pool has left after everyone else's usage, but never less than an even split —
+    // an idle node lets one stage grow into the whole pool, while under contention established
+    // stages cannot starve newcomers below their fair share.
+    const auto numLeases = std::max(_broker->_numLeases.load(), 1);
+    const auto fairShare = pool / static_cast<size_t>(numLeases);
+    const auto remaining = pool > others ? pool - others : 0;
+    return std::max({fairShare, remaining, kMinimumGrantBytes});
+}
+
+void AggregationMemoryBroker::Lease::release() {
+    if (!_broker) {
+        return;
+    }
+    if (_reportedBytes > 0) {
+        _broker->_totalReportedBytes.fetchAndSubtract(static_cast<long long>(_reportedBytes));
+        _reportedBytes = 0;
+    }
+    _broker->_numLeases.fetchAndSubtract(1);
+    _broker = nullptr;
+}
+
+}  // namespace mongo
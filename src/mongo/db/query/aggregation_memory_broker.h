@@ -0,0 +1,124 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+#include "mongo/platform/atomic_word.h"
+
+namespace mongo {
+
+class ServiceContext;
+
+/**
+ * Tracks the memory held by blocking aggregation stages ($group hash tables, blocking sorts)
+ * across all operations on the node so that per-stage memory limits can adapt to the node-wide
+ * load. Each participating stage holds a Lease, periodically reports its usage, and asks for its
+ * effective limit in place of its static per-stage limit: when the node is otherwise idle a single
+ * stage may grow into the whole pool before spilling, and when many stages compete the grant
+ * converges to an even split of the pool, spilling earlier than the static limit would.
+ *
+ * The pool size is set by the internalQueryAggregationMemoryPoolMB knob; zero (the default)
+ * disables the broker, in which case effective limits equal the static per-stage limits.
+ */
+class AggregationMemoryBroker {
+    AggregationMemoryBroker(const AggregationMemoryBroker&) = delete;
+    AggregationMemoryBroker& operator=(const AggregationMemoryBroker&) = delete;
+
+public:
+    AggregationMemoryBroker() = default;
+
+    static AggregationMemoryBroker& get(ServiceContext* svcCtx);
+
+    /**
+     * A stage's registration with the broker. A default-constructed Lease is unregistered and
+     * passes static limits through unchanged, so stages built without an operation context (e.g.
+     * in unit tests) behave exactly as before.
+     */
+    class Lease {
+    public:
+        Lease() = default;
+        Lease(Lease&& other) noexcept
+            : _broker(std::exchange(other._broker, nullptr)),
+              _reportedBytes(std::exchange(other._reportedBytes, 0)) {}
+        Lease& operator=(Lease&& other) noexcept {
+            if (this != &other) {
+                release();
+                _broker = std::exchange(other._broker, nullptr);
+                _reportedBytes = std::exchange(other._reportedBytes, 0);
+            }
+            return *this;
+        }
+        ~Lease() {
+            release();
+        }
+
+        /**
+         * Reports the stage's current memory footprint to the broker. Cheap to call per document;
+         * the shared counter is only touched when usage has moved by at least a megabyte since
+         * the last report.
+         */
+        void reportUsage(size_t currentBytes);
+
+        /**
+         * Returns the number of bytes the stage may hold before spilling (or failing, when disk
+         * use is not allowed). Returns 'staticLimitBytes' unchanged when the broker is disabled
+         * or the lease is unregistered.
+         */
+        size_t effectiveLimit(size_t staticLimitBytes) const;
+
+        void release();
+
+    private:
+        friend class AggregationMemoryBroker;
+        explicit Lease(AggregationMemoryBroker* broker) : _broker(broker) {}
+
+        AggregationMemoryBroker* _broker = nullptr;
+        size_t _reportedBytes = 0;
+    };
+
+    /**
+     * Registers a new stage with the broker. The returned Lease must not outlive the
+     * ServiceContext the broker decorates.
+     */
+    Lease makeLease();
+
+private:
+    static constexpr size_t kReportGranularityBytes = 1024 * 1024;
+
+    // Sum of the usage last reported by each live lease.
+    AtomicWord<long long> _totalReportedBytes{0};
+
+    // Number of live leases, i.e. blocking stages currently executing on the node.
+    AtomicWord<int> _numLeases{0};
+};
+
+}  // namespace mongo
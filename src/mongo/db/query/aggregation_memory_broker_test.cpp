@@ -0,0 +1,129 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/query/aggregation_memory_broker.h"
+
+#include "mongo/db/query/query_knobs_gen.h"
+#include "mongo/db/service_context_test_fixture.h"
+#include "mongo/unittest/unittest.h"
+#include "mongo/util/scopeguard.h"
+
+namespace mongo {
+namespace {
+
+constexpr size_t kMB = 1024 * 1024;
+
+class AggregationMemoryBrokerTest : public ServiceContextTest {
+protected:
+    AggregationMemoryBroker& broker() {
+        return AggregationMemoryBroker::get(getServiceContext());
+    }
+};
+
+TEST_F(AggregationMemoryBrokerTest, StaticLimitAppliesWhenPoolDisabled) {
+    auto lease = broker().makeLease();
+    ASSERT_EQ(lease.effectiveLimit(100 * kMB), 100 * kMB);
+}
+
+TEST_F(AggregationMemoryBrokerTest, UnregisteredLeasePassesStaticLimitThrough) {
+    internalQueryAggregationMemoryPoolMB.store(1024);
+    ON_BLOCK_EXIT([] { internalQueryAggregationMemoryPoolMB.store(0); });
+
+    AggregationMemoryBroker::Lease lease;
+    ASSERT_EQ(lease.effectiveLimit(100 * kMB), 100 * kMB);
+}
+
+TEST_F(AggregationMemoryBrokerTest, SoleLeaseMayGrowIntoTheWholePool) {
+    internalQueryAggregationMemoryPoolMB.store(1024);
+    ON_BLOCK_EXIT([] { internalQueryAggregationMemoryPoolMB.store(0); });
+
+    auto lease = broker().makeLease();
+    ASSERT_EQ(lease.effectiveLimit(100 * kMB), 1024 * kMB);
+
+    // The lease's own usage does not shrink its grant.
+    lease.reportUsage(500 * kMB);
+    ASSERT_EQ(lease.effectiveLimit(100 * kMB), 1024 * kMB);
+}
+
+TEST_F(AggregationMemoryBrokerTest, ContendedLeasesConvergeToFairShare) {
+    internalQueryAggregationMemoryPoolMB.store(1024);
+    ON_BLOCK_EXIT([] { internalQueryAggregationMemoryPoolMB.store(0); });
+
+    auto first = broker().makeLease();
+    auto second = broker().makeLease();
+
+    // Nothing reported yet: each lease may still claim the whole pool.
+    ASSERT_EQ(first.effectiveLimit(100 * kMB), 1024 * kMB);
+
+    // Once the first lease holds most of the pool, the second is limited to the remainder or its
+    // even split, whichever is larger.
+    first.reportUsage(1000 * kMB);
+    ASSERT_EQ(second.effectiveLimit(100 * kMB), 512 * kMB);
+
+    // When the first lease releases, its usage returns to the pool.
+    first.release();
+    ASSERT_EQ(second.effectiveLimit(100 * kMB), 1024 * kMB);
+}
+
+TEST_F(AggregationMemoryBrokerTest, SmallUsageChangesAreNotPublished) {
+    internalQueryAggregationMemoryPoolMB.store(1024);
+    ON_BLOCK_EXIT([] { internalQueryAggregationMemoryPoolMB.store(0); });
+
+    auto first = broker().makeLease();
+    auto second = broker().makeLease();
+
+    // Sub-megabyte usage stays below the reporting granularity, so the second lease still sees an
+    // untouched pool.
+    first.reportUsage(kMB - 1);
+    ASSERT_EQ(second.effectiveLimit(100 * kMB), 1024 * kMB);
+
+    first.reportUsage(700 * kMB);
+    ASSERT_EQ(second.effectiveLimit(100 * kMB), 512 * kMB);
+}
+
+TEST_F(AggregationMemoryBrokerTest, MovedFromLeaseReleasesNothing) {
+    internalQueryAggregationMemoryPoolMB.store(1024);
+    ON_BLOCK_EXIT([] { internalQueryAggregationMemoryPoolMB.store(0); });
+
+    auto observer = broker().makeLease();
+    auto lease = broker().makeLease();
+    lease.reportUsage(800 * kMB);
+
+    auto movedLease = std::move(lease);
+    lease.release();  // NOLINT(bugprone-use-after-move)
+    ASSERT_EQ(observer.effectiveLimit(100 * kMB), 512 * kMB);
+
+    movedLease.release();
+    ASSERT_EQ(observer.effectiveLimit(100 * kMB), 1024 * kMB);
+}
+
+}  // namespace
+}  // namespace mongo
@@ -31,7 +31,9 @@
 
 #include "mongo/db/query/collation/collator_interface_icu.h"
 
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 #include <unicode/coll.h>
 #include <unicode/sortkey.h>
@@ -39,10 +41,102 @@
 #include "mongo/util/assert_util.h"
 
 namespace mongo {
+namespace {
+
+// Byte range handled by the ASCII comparison fast path. Characters below the space character are
+// ignorable control characters (as is 0x7f, DEL), so strings containing them always take the ICU
+// path.
+constexpr char kFirstPrintableAscii = 0x20;
+constexpr char kLastPrintableAscii = 0x7e;
+
+}  // namespace
 
 CollatorInterfaceICU::CollatorInterfaceICU(CollationSpec spec,
                                            std::unique_ptr<icu::Collator> collator)
-    : CollatorInterface(std::move(spec)), _collator(std::move(collator)) {}
+    : CollatorInterface(std::move(spec)), _collator(std::move(collator)) {
+    _initAsciiComparisonFastPath();
+}
+
+void CollatorInterfaceICU::_initAsciiComparisonFastPath() {
+    const auto& spec = getSpec();
+
+    // The fast path models the collation as one weight per character, which is only valid when
+    // case (tertiary) differences are ignored and every printable ASCII character contributes
+    // exactly one collation element: no case level, no numeric reordering of digit runs, no
+    // shifted spaces or punctuation, and a locale that neither contracts nor reorders ASCII
+    // sequences. 'en' at strength 1 or 2 satisfies all of these.
+    if (spec.localeID != "en" || spec.caseLevel ||
+        static_cast<int>(spec.strength) >
+            static_cast<int>(CollationSpec::StrengthType::kSecondary) ||
+        spec.numericOrdering || spec.alternate != CollationSpec::AlternateType::kNonIgnorable ||
+        spec.backwards) {
+        return;
+    }
+
+    // Derive the relative order of the printable ASCII characters from the configured ICU
+    // collator itself, so the weight table agrees with the ICU comparison by construction
+    // (including which characters tie, e.g. case pairs at these strengths).
+    struct CharAndKey {
+        char c;
+        std::string key;
+    };
+    std::vector<CharAndKey> keys;
+    for (char c = kFirstPrintableAscii; c <= kLastPrintableAscii; ++c) {
+        UErrorCode status = U_ZERO_ERROR;
+        icu::CollationKey icuKey;
+        _collator->getCollationKey(icu::UnicodeString(static_cast<UChar>(c)), icuKey, status);
+        if (!U_SUCCESS(status)) {
+            return;  // Leave the fast path disabled.
+        }
+        int32_t keyLength;
+        const uint8_t* keyBuffer = icuKey.getByteArray(keyLength);
+        keys.push_back({c, std::string(reinterpret_cast<const char*>(keyBuffer), keyLength)});
+    }
+
+    std::sort(keys.begin(), keys.end(), [](const CharAndKey& a, const CharAndKey& b) {
+        return a.key < b.key;
+    });
+
+    uint8_t weight = 1;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        if (i > 0 && keys[i].key != keys[i - 1].key) {
+            ++weight;
+        }
+        _asciiWeights[static_cast<uint8_t>(keys[i].c)] = weight;
+    }
+    _asciiFastPathEnabled = true;
+}
+
+boost::optional<int> CollatorInterfaceICU::_compareAscii(StringData left, StringData right) const {
+    const size_t commonLen = std::min(left.size(), right.size());
+    for (size_t i = 0; i < commonLen; ++i) {
+        const uint8_t leftWeight = _asciiWeights[static_cast<uint8_t>(left[i])];
+        const uint8_t rightWeight = _asciiWeights[static_cast<uint8_t>(right[i])];
+        if (!leftWeight || !rightWeight) {
+            return boost::none;
+        }
+        if (leftWeight != rightWeight) {
+            // The first primary-level difference decides the comparison regardless of what
+            // follows, even if the tails contain characters the fast path cannot weigh.
+            return leftWeight < rightWeight ? -1 : 1;
+        }
+    }
+
+    // One string is a prefix of the other (or they are equal). The longer string compares
+    // greater, but only if its tail consists entirely of weighable characters; an ignorable
+    // control character or a non-ASCII sequence in the tail needs the ICU comparison.
+    const StringData longer = left.size() >= right.size() ? left : right;
+    for (size_t i = commonLen; i < longer.size(); ++i) {
+        if (!_asciiWeights[static_cast<uint8_t>(longer[i])]) {
+            return boost::none;
+        }
+    }
+
+    if (left.size() == right.size()) {
+        return 0;
+    }
+    return left.size() < right.size() ? -1 : 1;
+}
 
 std::unique_ptr<CollatorInterface> CollatorInterfaceICU::clone() const {
     auto clone = std::make_unique<CollatorInterfaceICU>(
@@ -51,6 +145,12 @@ std::unique_ptr<CollatorInterface> CollatorInterfaceICU::clone() const {
 }
 
 int CollatorInterfaceICU::compare(StringData left, StringData right) const {
+    if (_asciiFastPathEnabled) {
+        if (auto result = _compareAscii(left, right)) {
+            return *result;
+        }
+    }
+
     UErrorCode status = U_ZERO_ERROR;
     auto compareResult = _collator->compareUTF8(icu::StringPiece(left.rawData(), left.size()),
                                                 icu::StringPiece(right.rawData(), right.size()),
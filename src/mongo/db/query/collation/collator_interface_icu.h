@@ -31,8 +31,11 @@
 
 #include "mongo/db/query/collation/collator_interface.h"
 
+#include <array>
 #include <memory>
 
+#include <boost/optional.hpp>
+
 namespace icu {
 class Collator;
 }  // namespace icu
@@ -54,9 +57,30 @@ public:
     ComparisonKey getComparisonKey(StringData stringData) const final;
 
 private:
+    /**
+     * Enables the printable-ASCII comparison fast path if the collation is one it can model
+     * exactly, deriving the per-character weight table from '_collator'. Called once at
+     * construction.
+     */
+    void _initAsciiComparisonFastPath();
+
+    /**
+     * Compares two strings using the per-character weight table. Returns boost::none if either
+     * string contains a byte the fast path cannot weigh, in which case the caller must fall back
+     * to the ICU comparison.
+     */
+    boost::optional<int> _compareAscii(StringData left, StringData right) const;
+
     // The ICU implementation of the collator to which we delegate interesting work. Const methods
     // on the ICU collator are expected to be thread-safe.
     const std::unique_ptr<icu::Collator> _collator;
+
+    // Comparison weight for each byte value, where higher-weighted bytes sort after lower ones and
+    // equal weights compare equal (e.g. a case pair under a case-insensitive strength). A weight of
+    // zero marks bytes the fast path cannot handle: non-ASCII lead bytes and ignorable control
+    // characters. Only populated when '_asciiFastPathEnabled' is true.
+    std::array<uint8_t, 256> _asciiWeights{};
+    bool _asciiFastPathEnabled = false;
 };
 
 }  // namespace mongo
@@ -594,4 +594,73 @@ TEST(CollatorInterfaceICUTest, ComparisonKeysForFrCaCollatorCorrect) {
               "\x2D\x45\x4F\x31\x01\x88\x44\x8E\x06\x01\x0A");
 }
 
+std::unique_ptr<CollatorInterfaceICU> makeEnglishStrengthTwoCollator() {
+    CollationSpec collationSpec;
+    collationSpec.localeID = "en";
+    collationSpec.strength = CollationSpec::StrengthType::kSecondary;
+    UErrorCode status = U_ZERO_ERROR;
+    std::unique_ptr<icu::Collator> coll(icu::Collator::createInstance(icu::Locale("en"), status));
+    ASSERT(U_SUCCESS(status));
+    coll->setStrength(icu::Collator::SECONDARY);
+    return std::make_unique<CollatorInterfaceICU>(collationSpec, std::move(coll));
+}
+
+TEST(CollatorInterfaceICUTest, EnglishStrengthTwoComparesCaseInsensitively) {
+    auto icuCollator = makeEnglishStrengthTwoCollator();
+    ASSERT_EQ(icuCollator->compare("Simple", "simple"), 0);
+    ASSERT_EQ(icuCollator->compare("SIMPLE", "simple"), 0);
+    ASSERT_LT(icuCollator->compare("simple", "simplex"), 0);
+    ASSERT_GT(icuCollator->compare("Simplex", "simple"), 0);
+}
+
+TEST(CollatorInterfaceICUTest, EnglishStrengthTwoCompareAgreesWithComparisonKeys) {
+    // Cross-checks compare(), which takes the ASCII fast path when it can, against comparison
+    // keys, which always come from ICU. The inputs cover pure ASCII (letters, digits, spaces and
+    // punctuation, including '~' which sorts before letters despite its high byte value), strings
+    // where one is a prefix of the other, ignorable control characters, and non-ASCII sequences
+    // that force the fallback.
+    auto icuCollator = makeEnglishStrengthTwoCollator();
+
+    const StringData strings[] = {"",
+                                  " ",
+                                  "!",
+                                  "~ab",
+                                  "ABC",
+                                  "abc",
+                                  "abcd",
+                                  "abd",
+                                  "a b",
+                                  "a-b",
+                                  "ab1",
+                                  "AB2",
+                                  "zebra",
+                                  "Zebra!",
+                                  "cafe",
+                                  "caf\xC3\xA9",
+                                  "abc\x01",
+                                  "abc\x7F"};
+
+    for (auto&& left : strings) {
+        for (auto&& right : strings) {
+            const int cmp = icuCollator->compare(left, right);
+            const auto leftKey = icuCollator->getComparisonKey(left);
+            const auto rightKey = icuCollator->getComparisonKey(right);
+            const int keyCmp = leftKey.getKeyData().compare(rightKey.getKeyData());
+            ASSERT_EQ(cmp < 0, keyCmp < 0);
+            ASSERT_EQ(cmp == 0, keyCmp == 0);
+        }
+    }
+}
+
+TEST(CollatorInterfaceICUTest, EnglishDefaultStrengthStillComparesCase) {
+    CollationSpec collationSpec;
+    collationSpec.localeID = "en";
+    UErrorCode status = U_ZERO_ERROR;
+    std::unique_ptr<icu::Collator> coll(icu::Collator::createInstance(icu::Locale("en"), status));
+    ASSERT(U_SUCCESS(status));
+    CollatorInterfaceICU icuCollator(collationSpec, std::move(coll));
+
+    ASSERT_NE(icuCollator.compare("abc", "ABC"), 0);
+}
+
 }  // namespace
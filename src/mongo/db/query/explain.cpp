@@ -554,6 +554,7 @@ void Explain::statsToBSON(const PlanStageStats& stats,
 
         if (verbosity >= ExplainOptions::Verbosity::kExecStats) {
             bob->appendIntOrLL("totalDataSizeSorted", spec->totalDataSizeBytes);
+            bob->appendIntOrLL("maxUsedMemBytes", spec->maxUsedMemoryBytes);
             bob->appendBool("usedDisk", spec->wasDiskUsed);
         }
     } else if (STAGE_SORT_MERGE == stats.stageType) {
@@ -1035,14 +1036,20 @@ void Explain::getSummaryStats(const PlanExecutor& exec, PlanSummaryStats* statsO
 }
 
 void Explain::planCacheEntryToBSON(const PlanCacheEntry& entry, BSONObjBuilder* out) {
-    BSONObjBuilder shapeBuilder(out->subobjStart("createdFromQuery"));
-    shapeBuilder.append("query", entry.query);
-    shapeBuilder.append("sort", entry.sort);
-    shapeBuilder.append("projection", entry.projection);
-    if (!entry.collation.isEmpty()) {
-        shapeBuilder.append("collation", entry.collation);
+    if (entry.encodedQueryShape.empty()) {
+        BSONObjBuilder shapeBuilder(out->subobjStart("createdFromQuery"));
+        shapeBuilder.append("query", entry.query);
+        shapeBuilder.append("sort", entry.sort);
+        shapeBuilder.append("projection", entry.projection);
+        if (!entry.collation.isEmpty()) {
+            shapeBuilder.append("collation", entry.collation);
+        }
+        shapeBuilder.doneFast();
+    } else {
+        // Compact entries do not retain the example query which created them; the encoded shape
+        // key is the only representation of the query available.
+        out->append("queryShapeKey", entry.encodedQueryShape);
     }
-    shapeBuilder.doneFast();
     out->append("queryHash", unsignedIntToFixedLengthHex(entry.queryHash));
     out->append("planCacheKey", unsignedIntToFixedLengthHex(entry.planCacheKey));
 
@@ -1051,31 +1058,39 @@ void Explain::planCacheEntryToBSON(const PlanCacheEntry& entry, BSONObjBuilder*
     out->append("works", static_cast<long long>(entry.works));
 
     BSONObjBuilder cachedPlanBob(out->subobjStart("cachedPlan"));
-    Explain::statsToBSON(
-        *entry.decision->stats[0], &cachedPlanBob, ExplainOptions::Verbosity::kQueryPlanner);
+    if (entry.decision) {
+        Explain::statsToBSON(
+            *entry.decision->stats[0], &cachedPlanBob, ExplainOptions::Verbosity::kQueryPlanner);
+    } else {
+        // Compact entries do not retain the plan ranking stats trees, so reconstruct a summary of
+        // the winning plan from the cached solution data instead.
+        cachedPlanBob.append("solution", entry.plannerData[0]->toString());
+    }
     cachedPlanBob.doneFast();
 
     out->append("timeOfCreation", entry.timeOfCreation);
 
-    BSONArrayBuilder creationBuilder(out->subarrayStart("creationExecStats"));
-    for (auto&& stat : entry.decision->stats) {
-        BSONObjBuilder planBob(creationBuilder.subobjStart());
-        Explain::generateSinglePlanExecutionInfo(
-            stat.get(), ExplainOptions::Verbosity::kExecAllPlans, boost::none, &planBob);
-        planBob.doneFast();
-    }
-    creationBuilder.doneFast();
+    if (entry.decision) {
+        BSONArrayBuilder creationBuilder(out->subarrayStart("creationExecStats"));
+        for (auto&& stat : entry.decision->stats) {
+            BSONObjBuilder planBob(creationBuilder.subobjStart());
+            Explain::generateSinglePlanExecutionInfo(
+                stat.get(), ExplainOptions::Verbosity::kExecAllPlans, boost::none, &planBob);
+            planBob.doneFast();
+        }
+        creationBuilder.doneFast();
 
-    BSONArrayBuilder scoresBuilder(out->subarrayStart("candidatePlanScores"));
-    for (double score : entry.decision->scores) {
-        scoresBuilder.append(score);
-    }
+        BSONArrayBuilder scoresBuilder(out->subarrayStart("candidatePlanScores"));
+        for (double score : entry.decision->scores) {
+            scoresBuilder.append(score);
+        }
 
-    std::for_each(entry.decision->failedCandidates.begin(),
-                  entry.decision->failedCandidates.end(),
-                  [&scoresBuilder](const auto&) { scoresBuilder.append(0.0); });
+        std::for_each(entry.decision->failedCandidates.begin(),
+                      entry.decision->failedCandidates.end(),
+                      [&scoresBuilder](const auto&) { scoresBuilder.append(0.0); });
 
-    scoresBuilder.doneFast();
+        scoresBuilder.doneFast();
+    }
 
     out->append("indexFilterSet", entry.plannerData[0]->indexFilterApplied);
 }
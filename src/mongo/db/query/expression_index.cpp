@@ -37,6 +37,8 @@
 #include "mongo/db/hasher.h"
 #include "mongo/db/index/expression_params.h"
 #include "mongo/db/query/expression_index_knobs_gen.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/util/lru_cache.h"
 #include "third_party/s2/s2cellid.h"
 #include "third_party/s2/s2region.h"
 #include "third_party/s2/s2regioncoverer.h"
@@ -108,24 +110,91 @@ void ExpressionMapping::cover2d(const R2Region& region,
     GeoHashsToIntervalsWithParents(unorderedCovering, oilOut);
 }
 
-std::vector<S2CellId> ExpressionMapping::get2dsphereCovering(const S2Region& region) {
-    auto minLevel = gInternalQueryS2GeoCoarsestLevel.load();
-    auto maxLevel = gInternalQueryS2GeoFinestLevel.load();
+namespace {
+
+struct S2CoveringParameters {
+    int minLevel;
+    int maxLevel;
+    int maxCells;
+};
+
+S2CoveringParameters load2dsphereCoveringParameters() {
+    S2CoveringParameters params;
+    params.minLevel = gInternalQueryS2GeoCoarsestLevel.load();
+    params.maxLevel = gInternalQueryS2GeoFinestLevel.load();
+    params.maxCells = gInternalQueryS2GeoMaxCells.load();
 
-    uassert(28739, "Geo coarsest level must be in range [0,30]", 0 <= minLevel && minLevel <= 30);
-    uassert(28740, "Geo finest level must be in range [0,30]", 0 <= maxLevel && maxLevel <= 30);
-    uassert(28741, "Geo coarsest level must be less than or equal to finest", minLevel <= maxLevel);
+    uassert(28739,
+            "Geo coarsest level must be in range [0,30]",
+            0 <= params.minLevel && params.minLevel <= 30);
+    uassert(28740,
+            "Geo finest level must be in range [0,30]",
+            0 <= params.maxLevel && params.maxLevel <= 30);
+    uassert(28741,
+            "Geo coarsest level must be less than or equal to finest",
+            params.minLevel <= params.maxLevel);
+    return params;
+}
 
+std::vector<S2CellId> compute2dsphereCovering(const S2Region& region,
+                                              const S2CoveringParameters& params) {
     S2RegionCoverer coverer;
-    coverer.set_min_level(minLevel);
-    coverer.set_max_level(maxLevel);
-    coverer.set_max_cells(gInternalQueryS2GeoMaxCells.load());
+    coverer.set_min_level(params.minLevel);
+    coverer.set_max_level(params.maxLevel);
+    coverer.set_max_cells(params.maxCells);
 
     std::vector<S2CellId> cover;
     coverer.GetCovering(region, &cover);
     return cover;
 }
 
+// Process-global cache of 2dsphere coverings, keyed by the region fingerprint plus the covering
+// parameters in effect when the covering was computed (the parameters are runtime-settable).
+Mutex s2CoveringCacheMutex = MONGO_MAKE_LATCH("ExpressionMapping::s2CoveringCacheMutex");
+LRUCache<std::string, std::vector<S2CellId>>& s2CoveringCache() {
+    static LRUCache<std::string, std::vector<S2CellId>> cache(
+        static_cast<std::size_t>(gInternalQueryS2CoveringCacheSize));
+    return cache;
+}
+
+std::string makeS2CoveringCacheKey(const BSONObj& regionFingerprint,
+                                   const S2CoveringParameters& params) {
+    std::string key(regionFingerprint.objdata(), regionFingerprint.objsize());
+    key.append(reinterpret_cast<const char*>(&params.minLevel), sizeof(params.minLevel));
+    key.append(reinterpret_cast<const char*>(&params.maxLevel), sizeof(params.maxLevel));
+    key.append(reinterpret_cast<const char*>(&params.maxCells), sizeof(params.maxCells));
+    return key;
+}
+
+}  // namespace
+
+std::vector<S2CellId> ExpressionMapping::get2dsphereCovering(const S2Region& region) {
+    return compute2dsphereCovering(region, load2dsphereCoveringParameters());
+}
+
+std::vector<S2CellId> ExpressionMapping::get2dsphereCovering(const S2Region& region,
+                                                             const BSONObj& regionFingerprint) {
+    const auto params = load2dsphereCoveringParameters();
+    if (gInternalQueryS2CoveringCacheSize == 0) {
+        return compute2dsphereCovering(region, params);
+    }
+
+    const auto key = makeS2CoveringCacheKey(regionFingerprint, params);
+    {
+        stdx::lock_guard<Latch> lk(s2CoveringCacheMutex);
+        auto it = s2CoveringCache().find(key);
+        if (it != s2CoveringCache().end()) {
+            return it->second;
+        }
+    }
+
+    auto cover = compute2dsphereCovering(region, params);
+
+    stdx::lock_guard<Latch> lk(s2CoveringCacheMutex);
+    s2CoveringCache().add(key, cover);
+    return cover;
+}
+
 void ExpressionMapping::cover2dsphere(const S2Region& region,
                                       const S2IndexingParams& indexingParams,
                                       OrderedIntervalList* oilOut) {
@@ -133,6 +202,14 @@ void ExpressionMapping::cover2dsphere(const S2Region& region,
     S2CellIdsToIntervalsWithParents(cover, indexingParams, oilOut);
 }
 
+void ExpressionMapping::cover2dsphere(const S2Region& region,
+                                      const BSONObj& regionFingerprint,
+                                      const S2IndexingParams& indexingParams,
+                                      OrderedIntervalList* oilOut) {
+    std::vector<S2CellId> cover = get2dsphereCovering(region, regionFingerprint);
+    S2CellIdsToIntervalsWithParents(cover, indexingParams, oilOut);
+}
+
 namespace {
 bool compareIntervals(const Interval& a, const Interval& b) {
     return a.precedes(b);
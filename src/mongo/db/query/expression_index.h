@@ -65,6 +65,15 @@ public:
 
     static std::vector<S2CellId> get2dsphereCovering(const S2Region& region);
 
+    /**
+     * As above, but consults a process-global cache of coverings keyed by 'regionFingerprint',
+     * which must uniquely identify the query region (e.g. the serialized geo predicate).
+     * Computing a covering dominates the cost of building 2dsphere bounds for complex regions,
+     * and geo-heavy workloads tend to issue the same handful of shapes repeatedly.
+     */
+    static std::vector<S2CellId> get2dsphereCovering(const S2Region& region,
+                                                     const BSONObj& regionFingerprint);
+
     static void S2CellIdsToIntervals(const std::vector<S2CellId>& intervalSet,
                                      const S2IndexVersion indexVersion,
                                      OrderedIntervalList* oilOut);
@@ -78,6 +87,12 @@ public:
     static void cover2dsphere(const S2Region& region,
                               const S2IndexingParams& indexParams,
                               OrderedIntervalList* oilOut);
+
+    // As above, but uses the covering cache via the fingerprinted get2dsphereCovering() overload.
+    static void cover2dsphere(const S2Region& region,
+                              const BSONObj& regionFingerprint,
+                              const S2IndexingParams& indexParams,
+                              OrderedIntervalList* oilOut);
 };
 
 }  // namespace mongo
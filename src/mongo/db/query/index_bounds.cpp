@@ -75,6 +75,20 @@ IndexBoundsChecker::Location intervalCmp(const Interval& interval,
     return IndexBoundsChecker::WITHIN;
 }
 
+/**
+ * Like intervalCmp(), but for a point interval, which only requires comparing 'key' against the
+ * single point rather than against both interval endpoints.
+ */
+IndexBoundsChecker::Location pointIntervalCmp(const Interval& interval,
+                                              const BSONElement& key,
+                                              const int expectedDirection) {
+    int cmp = sgn(key.woCompare(interval.start, false));
+    if (0 == cmp) {
+        return IndexBoundsChecker::WITHIN;
+    }
+    return cmp == expectedDirection ? IndexBoundsChecker::AHEAD : IndexBoundsChecker::BEHIND;
+}
+
 }  // namespace
 
 // For debugging.
@@ -496,6 +510,15 @@ IndexBoundsChecker::IndexBoundsChecker(const IndexBounds* bounds,
         int indexDirection = it.next().number() >= 0 ? 1 : -1;
         _expectedDirection.push_back(indexDirection * scanDirection);
     }
+
+    _allPointIntervals.reserve(bounds->fields.size());
+    for (const OrderedIntervalList& oil : bounds->fields) {
+        _allPointIntervals.push_back(std::all_of(oil.intervals.begin(),
+                                                 oil.intervals.end(),
+                                                 [](const Interval& ival) {
+                                                     return ival.isPoint();
+                                                 }));
+    }
 }
 
 bool IndexBoundsChecker::getStartSeekPoint(IndexSeekPoint* out) {
@@ -522,7 +545,9 @@ bool IndexBoundsChecker::findLeftmostProblem(const vector<BSONElement>& keyValue
     for (size_t i = 0; i < _curInterval.size(); ++i) {
         const OrderedIntervalList& field = _bounds->fields[i];
         const Interval& currentInterval = field.intervals[_curInterval[i]];
-        Location cmp = intervalCmp(currentInterval, keyValues[i], _expectedDirection[i]);
+        Location cmp = _allPointIntervals[i]
+            ? pointIntervalCmp(currentInterval, keyValues[i], _expectedDirection[i])
+            : intervalCmp(currentInterval, keyValues[i], _expectedDirection[i]);
 
         // If it's not in the interval we think it is...
         if (0 != cmp) {
@@ -572,8 +597,7 @@ bool IndexBoundsChecker::isValidKey(const BSONObj& key) {
     while (it.more()) {
         BSONElement elt = it.next();
         size_t whichInterval;
-        Location loc = findIntervalForField(
-            elt, _bounds->fields[curOil], _expectedDirection[curOil], &whichInterval);
+        Location loc = locateIntervalForField(curOil, elt, &whichInterval);
         if (WITHIN != loc) {
             return false;
         }
@@ -646,10 +670,8 @@ IndexBoundsChecker::KeyState IndexBoundsChecker::checkKey(const BSONObj& key, In
         // Find the interval that contains our field.
         size_t newIntervalForField;
 
-        Location where = findIntervalForField(keyValues[firstNonContainedField],
-                                              _bounds->fields[firstNonContainedField],
-                                              _expectedDirection[firstNonContainedField],
-                                              &newIntervalForField);
+        Location where = locateIntervalForField(
+            firstNonContainedField, keyValues[firstNonContainedField], &newIntervalForField);
 
         if (WITHIN == where) {
             // Found a new interval for field firstNonContainedField.  Move our internal choice
@@ -722,6 +744,16 @@ bool isKeyAheadOfInterval(const Interval& interval,
     return IndexBoundsChecker::AHEAD == where;
 }
 
+/**
+ * As above, but for a point interval, comparing against the single point only.
+ */
+bool isKeyAheadOfPointInterval(const Interval& interval,
+                               const std::pair<BSONElement, int>& keyAndDirection) {
+    const BSONElement& elt = keyAndDirection.first;
+    int expectedDirection = keyAndDirection.second;
+    return sgn(elt.woCompare(interval.start, false)) == expectedDirection;
+}
+
 }  // namespace
 
 // static
@@ -758,4 +790,30 @@ IndexBoundsChecker::Location IndexBoundsChecker::findIntervalForField(
     return where;
 }
 
+IndexBoundsChecker::Location IndexBoundsChecker::locateIntervalForField(
+    size_t fieldIndex, const BSONElement& elt, size_t* newIntervalIndex) const {
+    const OrderedIntervalList& oil = _bounds->fields[fieldIndex];
+    const int expectedDirection = _expectedDirection[fieldIndex];
+
+    if (!_allPointIntervals[fieldIndex]) {
+        return findIntervalForField(elt, oil, expectedDirection, newIntervalIndex);
+    }
+
+    // Every interval for this field is a point, as is the case for $in predicates. Binary search
+    // directly over the points, comparing against each probed interval once instead of twice.
+    vector<Interval>::const_iterator i = std::lower_bound(oil.intervals.begin(),
+                                                          oil.intervals.end(),
+                                                          std::make_pair(elt, expectedDirection),
+                                                          isKeyAheadOfPointInterval);
+
+    // Key ahead of all intervals.
+    if (i == oil.intervals.end()) {
+        return AHEAD;
+    }
+
+    *newIntervalIndex = std::distance(oil.intervals.begin(), i);
+
+    return pointIntervalCmp(*i, elt, expectedDirection);
+}
+
 }  // namespace mongo
@@ -270,6 +270,15 @@ public:
                                          size_t* newIntervalIndex);
 
 private:
+    /**
+     * Per-field wrapper around findIntervalForField() that uses a cheaper comparison, against the
+     * single point rather than both interval endpoints, when every interval for the field is a
+     * point interval, as is the case for $in predicates.
+     */
+    Location locateIntervalForField(size_t fieldIndex,
+                                    const BSONElement& elt,
+                                    size_t* newIntervalIndex) const;
+
     /**
      * Find the first field in the key that isn't within the interval we think it is.  Returns
      * false if every field is in the interval we think it is.  Returns true and populates out
@@ -299,6 +308,11 @@ private:
 
     // Direction of scan * direction of indexing.
     std::vector<int> _expectedDirection;
+
+    // For each field, true if every interval in its bounds is a point interval. Point-interval
+    // runs, such as those generated by large $in predicates, can be navigated with one comparison
+    // per probed interval instead of two.
+    std::vector<bool> _allPointIntervals;
 };
 
 }  // namespace mongo
@@ -742,6 +742,41 @@ TEST(IndexBoundsCheckerTest, MoveIntervalForwardManyIntervals) {
     ASSERT_EQUALS(state, IndexBoundsChecker::VALID);
 }
 
+TEST(IndexBoundsCheckerTest, MoveForwardThroughPointIntervalRun) {
+    // All-point bounds, as a $in predicate would generate, take the point-interval fast path.
+    OrderedIntervalList fooList("foo");
+    for (int i = 0; i < 100; i += 2) {
+        fooList.intervals.push_back(Interval(BSON("" << i << "" << i), true, true));
+    }
+
+    IndexBounds bounds;
+    bounds.fields.push_back(fooList);
+    IndexBoundsChecker it(&bounds, BSON("foo" << 1), 1);
+
+    IndexSeekPoint seekPoint;
+    IndexBoundsChecker::KeyState state;
+
+    // Start at the first point.
+    state = it.checkKey(BSON("" << 0), &seekPoint);
+    ASSERT_EQUALS(state, IndexBoundsChecker::VALID);
+
+    // A key between two points must advance to the next point.
+    state = it.checkKey(BSON("" << 13), &seekPoint);
+    ASSERT_EQUALS(state, IndexBoundsChecker::MUST_ADVANCE);
+    ASSERT_EQUALS(seekPoint.prefixLen, 0);
+    ASSERT_EQUALS(seekPoint.prefixExclusive, false);
+    ASSERT_EQUALS(seekPoint.keySuffix[0]->numberInt(), 14);
+    ASSERT_EQUALS(seekPoint.suffixInclusive[0], true);
+
+    // A key on a point far ahead is valid, skipping many intervals at once.
+    state = it.checkKey(BSON("" << 90), &seekPoint);
+    ASSERT_EQUALS(state, IndexBoundsChecker::VALID);
+
+    // Past the last point, we're done.
+    state = it.checkKey(BSON("" << 99), &seekPoint);
+    ASSERT_EQUALS(state, IndexBoundsChecker::DONE);
+}
+
 TEST(IndexBoundsCheckerTest, SimpleCheckKey) {
     OrderedIntervalList fooList("foo");
     fooList.intervals.push_back(Interval(BSON("" << 7 << "" << 20), true, true));
@@ -168,27 +168,17 @@ bool PlanCache::shouldCacheQuery(const CanonicalQuery& query) {
 //
 
 CachedSolution::CachedSolution(const PlanCacheKey& key, const PlanCacheEntry& entry)
-    : plannerData(entry.plannerData.size()),
+    : plannerData(entry.plannerData),
       key(key),
       query(entry.query.getOwned()),
       sort(entry.sort.getOwned()),
       projection(entry.projection.getOwned()),
       collation(entry.collation.getOwned()),
       decisionWorks(entry.works) {
-    // CachedSolution should not having any references into
-    // cache entry. All relevant data should be cloned/copied.
-    for (size_t i = 0; i < entry.plannerData.size(); ++i) {
-        verify(entry.plannerData[i]);
-        plannerData[i] = entry.plannerData[i]->clone();
-    }
-}
-
-CachedSolution::~CachedSolution() {
-    for (std::vector<SolutionCacheData*>::const_iterator i = plannerData.begin();
-         i != plannerData.end();
-         ++i) {
-        SolutionCacheData* scd = *i;
-        delete scd;
+    // The SolutionCacheData is immutable, so it is shared by reference rather than deep-copied.
+    // The shared_ptrs keep it valid even if the cache entry goes away.
+    for (auto&& scd : plannerData) {
+        verify(scd);
     }
 }
 
@@ -212,11 +202,30 @@ std::unique_ptr<PlanCacheEntry> PlanCacheEntry::create(
     // data to cache you shouldn't be trying to construct a PlanCacheEntry.
 
     // Copy the solution's cache data into the plan cache entry.
-    std::vector<std::unique_ptr<const SolutionCacheData>> solutionCacheData(solutions.size());
+    std::vector<std::shared_ptr<const SolutionCacheData>> solutionCacheData(solutions.size());
     for (size_t i = 0; i < solutions.size(); ++i) {
         invariant(solutions[i]->cacheData.get());
         solutionCacheData[i] =
-            std::unique_ptr<const SolutionCacheData>(solutions[i]->cacheData->clone());
+            std::shared_ptr<const SolutionCacheData>(solutions[i]->cacheData->clone());
+    }
+
+    // In compact mode only the encoded query shape is retained for diagnostics; the example
+    // query BSON and the plan ranking debug info are dropped, which shrinks entries by an order
+    // of magnitude for workloads with very many distinct shapes.
+    if (internalQueryCacheCompactEntries.load()) {
+        return std::unique_ptr<PlanCacheEntry>(new PlanCacheEntry(std::move(solutionCacheData),
+                                                                  BSONObj(),
+                                                                  BSONObj(),
+                                                                  BSONObj(),
+                                                                  BSONObj(),
+                                                                  query.encodeKey(),
+                                                                  timeOfCreation,
+                                                                  queryHash,
+                                                                  planCacheKey,
+                                                                  nullptr,
+                                                                  {},
+                                                                  isActive,
+                                                                  works));
     }
 
     // Strip projections on $-prefixed fields, as these are added by internal callers of the
@@ -236,6 +245,7 @@ std::unique_ptr<PlanCacheEntry> PlanCacheEntry::create(
         qr.getSort(),
         projBuilder.obj(),
         query.getCollator() ? query.getCollator()->getSpec().toBSON() : BSONObj(),
+        std::string(),
         timeOfCreation,
         queryHash,
         planCacheKey,
@@ -245,11 +255,12 @@ std::unique_ptr<PlanCacheEntry> PlanCacheEntry::create(
         works));
 }
 
-PlanCacheEntry::PlanCacheEntry(std::vector<std::unique_ptr<const SolutionCacheData>> plannerData,
+PlanCacheEntry::PlanCacheEntry(std::vector<std::shared_ptr<const SolutionCacheData>> plannerData,
                                const BSONObj& query,
                                const BSONObj& sort,
                                const BSONObj& projection,
                                const BSONObj& collation,
+                               std::string encodedQueryShape,
                                const Date_t timeOfCreation,
                                const uint32_t queryHash,
                                const uint32_t planCacheKey,
@@ -262,6 +273,7 @@ PlanCacheEntry::PlanCacheEntry(std::vector<std::unique_ptr<const SolutionCacheDa
       sort(sort),
       projection(projection),
       collation(collation),
+      encodedQueryShape(std::move(encodedQueryShape)),
       timeOfCreation(timeOfCreation),
       queryHash(queryHash),
       planCacheKey(planCacheKey),
@@ -280,18 +292,18 @@ PlanCacheEntry::~PlanCacheEntry() {
 }
 
 std::unique_ptr<PlanCacheEntry> PlanCacheEntry::clone() const {
-    std::vector<std::unique_ptr<const SolutionCacheData>> solutionCacheData(plannerData.size());
-    for (size_t i = 0; i < plannerData.size(); ++i) {
-        invariant(plannerData[i]);
-        solutionCacheData[i] = std::unique_ptr<const SolutionCacheData>(plannerData[i]->clone());
-    }
+    // The cached plan data is immutable, so the clone can share it by reference.
+    auto solutionCacheData = plannerData;
 
-    auto decisionPtr = std::unique_ptr<PlanRankingDecision>(decision->clone());
+    // Compact entries do not retain a decision to clone.
+    auto decisionPtr =
+        std::unique_ptr<PlanRankingDecision>(decision ? decision->clone() : nullptr);
     return std::unique_ptr<PlanCacheEntry>(new PlanCacheEntry(std::move(solutionCacheData),
                                                               query,
                                                               sort,
                                                               projection,
                                                               collation,
+                                                              encodedQueryShape,
                                                               timeOfCreation,
                                                               queryHash,
                                                               planCacheKey,
@@ -313,6 +325,8 @@ uint64_t PlanCacheEntry::_estimateObjectSizeInBytes() const {
         (decision ? decision->estimateObjectSizeInBytes() : 0) +
         // Add the size of all the owned BSON objects.
         query.objsize() + sort.objsize() + projection.objsize() + collation.objsize() +
+        // Add the size of the encoded query shape (compact entries only).
+        encodedQueryShape.size() +
         // Add size of the object.
         sizeof(*this);
 }
@@ -30,6 +30,7 @@
 #pragma once
 
 #include <boost/optional/optional.hpp>
+#include <memory>
 #include <set>
 
 #include "mongo/db/exec/plan_stats.h"
@@ -276,10 +277,11 @@ private:
 
 public:
     CachedSolution(const PlanCacheKey& key, const PlanCacheEntry& entry);
-    ~CachedSolution();
 
-    // Owned here.
-    std::vector<SolutionCacheData*> plannerData;
+    // Shared (immutably) with the plan cache entry this solution was created from, so a cache hit
+    // doesn't pay for a deep copy of the index tree. The shared_ptr keeps the data alive even if
+    // the entry is evicted while this solution is in use.
+    std::vector<std::shared_ptr<const SolutionCacheData>> plannerData;
 
     // Key used to provide feedback on the entry.
     PlanCacheKey key;
@@ -335,20 +337,26 @@ public:
     // Planner data
     //
 
-    // Data provided to the planner to allow it to recreate the solutions this entry
-    // represents. Each SolutionCacheData is fully owned here, so in order to return
-    // it from the cache a deep copy is made and returned inside CachedSolution.
-    const std::vector<std::unique_ptr<const SolutionCacheData>> plannerData;
+    // Data provided to the planner to allow it to recreate the solutions this entry represents.
+    // Each SolutionCacheData is immutable and shared by reference with any CachedSolution
+    // returned from the cache, avoiding a deep copy per cache hit.
+    const std::vector<std::shared_ptr<const SolutionCacheData>> plannerData;
 
     // TODO: Do we really want to just hold a copy of the CanonicalQuery?  For now we just
     // extract the data we need.
     //
     // Used by the plan cache commands to display an example query
-    // of the appropriate shape.
+    // of the appropriate shape. Empty for entries created in compact mode
+    // (internalQueryCacheCompactEntries), which store 'encodedQueryShape' instead.
     const BSONObj query;
     const BSONObj sort;
     const BSONObj projection;
     const BSONObj collation;
+
+    // The canonical query encoder key for this entry's shape. Only populated for entries created
+    // in compact mode, where it replaces the example query BSON above in diagnostic output.
+    const std::string encodedQueryShape;
+
     const Date_t timeOfCreation;
 
     // Hash of the PlanCacheKey. Intended as an identifier for the query shape in logs and other
@@ -363,6 +371,8 @@ public:
     //
 
     // Information that went into picking the winning plan and also why the other plans lost.
+    // Null for entries created in compact mode: the decision is only consulted for diagnostic
+    // output, which then falls back to a summary reconstructed from 'plannerData'.
     const std::unique_ptr<const PlanRankingDecision> decision;
 
     // Scores from uses of this cache entry.
@@ -387,11 +397,12 @@ private:
     /**
      * All arguments constructor.
      */
-    PlanCacheEntry(std::vector<std::unique_ptr<const SolutionCacheData>> plannerData,
+    PlanCacheEntry(std::vector<std::shared_ptr<const SolutionCacheData>> plannerData,
                    const BSONObj& query,
                    const BSONObj& sort,
                    const BSONObj& projection,
                    const BSONObj& collation,
+                   std::string encodedQueryShape,
                    Date_t timeOfCreation,
                    uint32_t queryHash,
                    uint32_t planCacheKey,
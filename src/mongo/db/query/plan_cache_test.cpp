@@ -534,6 +534,36 @@ TEST(PlanCacheTest, InactiveEntriesDisabled) {
     ASSERT_EQ(planCache.get(*cq).state, PlanCache::CacheEntryState::kNotPresent);
 }
 
+TEST(PlanCacheTest, CompactEntriesDropDebugInfo) {
+    // Set the global flag for compact plan cache entries.
+    internalQueryCacheCompactEntries.store(true);
+    ON_BLOCK_EXIT([] { internalQueryCacheCompactEntries.store(false); });
+
+    PlanCache planCache;
+    unique_ptr<CanonicalQuery> cq(canonicalize("{a: 1}"));
+    auto qs = getQuerySolutionForCaching();
+    std::vector<QuerySolution*> solns = {qs.get()};
+
+    QueryTestServiceContext serviceContext;
+    ASSERT_OK(planCache.set(*cq, solns, createDecision(1U, 10), Date_t{}));
+
+    // The entry should retain only the encoded query shape: no example query BSON and no plan
+    // ranking debug info.
+    auto entry = assertGet(planCache.getEntry(*cq));
+    ASSERT_EQ(entry->encodedQueryShape, cq->encodeKey());
+    ASSERT_TRUE(entry->query.isEmpty());
+    ASSERT_TRUE(entry->sort.isEmpty());
+    ASSERT_TRUE(entry->projection.isEmpty());
+    ASSERT_FALSE(entry->decision);
+    ASSERT_EQ(entry->works, 10U);
+
+    // The entry must still be usable for retrieving the cached solution, and clone() must
+    // tolerate the missing decision.
+    auto clonedEntry = entry->clone();
+    ASSERT_EQ(clonedEntry->encodedQueryShape, entry->encodedQueryShape);
+    ASSERT_FALSE(clonedEntry->decision);
+    ASSERT_EQ(planCache.get(*cq).state, PlanCache::CacheEntryState::kPresentInactive);
+}
 
 TEST(PlanCacheTest, PlanCacheLRUPolicyRemovesInactiveEntries) {
     // Use a tiny cache size.
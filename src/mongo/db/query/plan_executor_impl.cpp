@@ -54,8 +54,11 @@
 #include "mongo/db/query/find_common.h"
 #include "mongo/db/query/mock_yield_policies.h"
 #include "mongo/db/query/plan_yield_policy.h"
+#include "mongo/db/query/query_knobs_gen.h"
+#include "mongo/db/repl/read_concern_args.h"
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/service_context.h"
+#include "mongo/db/snapshot_window_util.h"
 #include "mongo/logv2/log.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/scopeguard.h"
@@ -218,6 +221,13 @@ PlanExecutorImpl::PlanExecutorImpl(OperationContext* opCtx,
     invariant(!_expCtx || _expCtx->opCtx == _opCtx);
     invariant(!_cq || !_expCtx || _cq->getExpCtx() == _expCtx);
 
+    // Reads at readConcern level 'snapshot' tend to be long scans. Give the snapshot window a
+    // chance to grow before the read starts, rather than after it fails with SnapshotTooOld.
+    if (repl::ReadConcernArgs::get(_opCtx).getLevel() ==
+        repl::ReadConcernLevel::kSnapshotReadConcern) {
+        SnapshotWindowUtil::preWidenSnapshotWindowForSnapshotRead(_opCtx);
+    }
+
     // Both ChangeStreamProxy and CollectionScan stages can provide oplog tracking info, such as
     // post batch resume token, or latest oplog timestamp. If either of these two stages is present
     // in the execution tree, then cache it for fast retrieval of the oplog info, avoiding the need
@@ -525,6 +535,11 @@ PlanExecutor::ExecState PlanExecutorImpl::_getNextImpl(Snapshotted<Document>* ob
     // Incremented on every writeConflict, reset to 0 on any successful call to _root->work.
     size_t writeConflictsInARow = 0;
 
+    // When enabled, the root stage is driven through the batched workBatch() protocol and the
+    // produced results are buffered, one of which is returned per iteration below. Buffered
+    // results from a previous call are drained regardless of the current knob value.
+    const bool batchedExecution = internalQueryEnableBatchedExecution.load();
+
     // Capped insert data; declared outside the loop so we hold a shared pointer to the capped
     // insert notifier the entire time we are in the loop.  Holding a shared pointer to the capped
     // insert notifier is necessary for the notifierVersion to advance.
@@ -551,7 +566,45 @@ PlanExecutor::ExecState PlanExecutorImpl::_getNextImpl(Snapshotted<Document>* ob
         }
 
         WorkingSetID id = WorkingSet::INVALID_ID;
-        PlanStage::StageState code = _root->work(&id);
+        PlanStage::StageState code;
+        if (_batchedResultsPos < _batchedResults.size()) {
+            id = _batchedResults[_batchedResultsPos++];
+            code = PlanStage::ADVANCED;
+        } else if (_batchedTerminalState) {
+            // All results buffered ahead of the terminal state have been returned; act on it now.
+            code = *_batchedTerminalState;
+            id = _batchedTerminalId;
+            _batchedTerminalState = boost::none;
+            _batchedTerminalId = WorkingSet::INVALID_ID;
+        } else if (batchedExecution) {
+            _batchedResults.clear();
+            _batchedResultsPos = 0;
+            WorkingSetID terminalId = WorkingSet::INVALID_ID;
+            const auto batchSize = static_cast<size_t>(internalQueryExecutionBatchSize.load());
+            const auto batchState = _root->workBatch(batchSize, &_batchedResults, &terminalId);
+
+            // Buffered members may not be returned until after a yield, so they must own their
+            // data.
+            for (auto memberId : _batchedResults) {
+                _workingSet->get(memberId)->makeObjOwnedIfNeeded();
+            }
+
+            if (_batchedResultsPos < _batchedResults.size()) {
+                id = _batchedResults[_batchedResultsPos++];
+                code = PlanStage::ADVANCED;
+                if (batchState != PlanStage::ADVANCED && batchState != PlanStage::NEED_TIME) {
+                    // The batch ended in a terminal state. Defer it until the buffered results
+                    // ahead of it have been returned.
+                    _batchedTerminalState = batchState;
+                    _batchedTerminalId = terminalId;
+                }
+            } else {
+                code = batchState;
+                id = terminalId;
+            }
+        } else {
+            code = _root->work(&id);
+        }
 
         if (code != PlanStage::NEED_YIELD)
             writeConflictsInARow = 0;
@@ -656,7 +709,8 @@ PlanExecutor::ExecState PlanExecutorImpl::_getNextImpl(Snapshotted<Document>* ob
 
 bool PlanExecutorImpl::isEOF() {
     invariant(_currentState == kUsable);
-    return isMarkedAsKilled() || (_stash.empty() && _root->isEOF());
+    return isMarkedAsKilled() ||
+        (_stash.empty() && _batchedResultsPos >= _batchedResults.size() && _root->isEOF());
 }
 
 void PlanExecutorImpl::markAsKilled(Status killStatus) {
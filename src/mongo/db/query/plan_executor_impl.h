@@ -31,7 +31,9 @@
 
 #include <boost/optional.hpp>
 #include <queue>
+#include <vector>
 
+#include "mongo/db/exec/plan_stage.h"
 #include "mongo/db/query/plan_executor.h"
 
 namespace mongo {
@@ -189,6 +191,15 @@ private:
     // stages.
     std::queue<Document> _stash;
 
+    // Results produced by the root stage through the batched workBatch() protocol and not yet
+    // returned to the caller, consumed in order from '_batchedResultsPos'. A terminal state
+    // produced at the end of a batch is deferred in '_batchedTerminalState' until the buffered
+    // results ahead of it have been returned. Only used when batched execution is enabled.
+    std::vector<WorkingSetID> _batchedResults;
+    size_t _batchedResultsPos = 0;
+    boost::optional<PlanStage::StageState> _batchedTerminalState;
+    WorkingSetID _batchedTerminalId = WorkingSet::INVALID_ID;
+
     // The output document that is used by getNext BSON API. This allows us to avoid constantly
     // allocating and freeing DocumentStorage.
     Document _docOutput;
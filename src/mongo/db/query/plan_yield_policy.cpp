@@ -37,6 +37,7 @@
 #include "mongo/db/operation_context.h"
 #include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/service_context.h"
+#include "mongo/util/clock_source.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/scopeguard.h"
 #include "mongo/util/time_support.h"
@@ -54,6 +55,9 @@ PlanYieldPolicy::PlanYieldPolicy(PlanExecutor* exec, PlanExecutor::YieldPolicy p
       _elapsedTracker(exec->getOpCtx()->getServiceContext()->getFastClockSource(),
                       internalQueryExecYieldIterations.load(),
                       Milliseconds(internalQueryExecYieldPeriodMS.load())),
+      _fastClock(exec->getOpCtx()->getServiceContext()->getFastClockSource()),
+      _lastYieldTime(_fastClock->now()),
+      _lastSnapshotAbandoned(_lastYieldTime),
       _planYielding(exec) {}
 
 
@@ -63,6 +67,9 @@ PlanYieldPolicy::PlanYieldPolicy(PlanExecutor::YieldPolicy policy, ClockSource*
       _elapsedTracker(cs,
                       internalQueryExecYieldIterations.load(),
                       Milliseconds(internalQueryExecYieldPeriodMS.load())),
+      _fastClock(cs),
+      _lastYieldTime(_fastClock->now()),
+      _lastSnapshotAbandoned(_lastYieldTime),
       _planYielding(nullptr) {}
 
 bool PlanYieldPolicy::shouldYieldOrInterrupt() {
@@ -74,11 +81,30 @@ bool PlanYieldPolicy::shouldYieldOrInterrupt() {
     invariant(!_planYielding->getOpCtx()->lockState()->inAWriteUnitOfWork());
     if (_forceYield)
         return true;
-    return _elapsedTracker.intervalHasElapsed();
+
+    // Always yield once the time budget has elapsed, so interrupt is checked at a bounded
+    // interval no matter how expensive the individual work units are.
+    if (_fastClock->now() - _lastYieldTime >=
+        Milliseconds(internalQueryExecYieldPeriodMS.load())) {
+        return true;
+    }
+
+    // In between, periodically poll for another operation queued behind one of this plan's locks
+    // and yield early if there is one. A pure in-cache scan burns through work units far faster
+    // than the time budget and should give up its locks when somebody needs them, not on a work
+    // unit counter.
+    if (++_workUnitsSinceWaiterCheck >= internalQueryExecYieldIterations.load()) {
+        _workUnitsSinceWaiterCheck = 0;
+        return _planYielding->getOpCtx()->lockState()->hasConflictingWaiters();
+    }
+
+    return false;
 }
 
 void PlanYieldPolicy::resetTimer() {
     _elapsedTracker.resetLastTime();
+    _lastYieldTime = _fastClock->now();
+    _workUnitsSinceWaiterCheck = 0;
 }
 
 Status PlanYieldPolicy::yieldOrInterrupt(std::function<void()> whileYieldingFn) {
@@ -161,6 +187,11 @@ void PlanYieldPolicy::_yieldAllLocks(OperationContext* opCtx,
 
     Locker* locker = opCtx->lockState();
 
+    // Determine, before giving up the locks, whether any other operation is queued behind them.
+    // If so, it may acquire them during the yield and commit writes, so our storage snapshot must
+    // be abandoned below.
+    const bool hadWaiters = locker->hasConflictingWaiters();
+
     Locker::LockSnapshot snapshot;
 
     auto unlocked = locker->saveLockStateAndUnlock(&snapshot);
@@ -177,8 +208,17 @@ void PlanYieldPolicy::_yieldAllLocks(OperationContext* opCtx,
     }
 
     // Top-level locks are freed, release any potential low-level (storage engine-specific
-    // locks). If we are yielding, we are at a safe place to do so.
-    opCtx->recoveryUnit()->abandonSnapshot();
+    // locks). If we are yielding, we are at a safe place to do so. Repositioning the storage
+    // cursors once the snapshot is gone is the expensive part of a yield for in-cache scans, so
+    // keep the snapshot when nobody was waiting behind our locks, bounding its age so the storage
+    // engine does not pin history for the lifetime of a long scan.
+    const auto now = _fastClock->now();
+    if (hadWaiters ||
+        now - _lastSnapshotAbandoned >=
+            Milliseconds(internalQueryExecYieldSnapshotMaxAgeMS.load())) {
+        opCtx->recoveryUnit()->abandonSnapshot();
+        _lastSnapshotAbandoned = now;
+    }
 
     // Track the number of yields in CurOp.
     CurOp::get(opCtx)->yielded();
@@ -141,6 +141,23 @@ private:
     bool _forceYield;
     ElapsedTracker _elapsedTracker;
 
+    // Used for the time-budget yield decisions below. The fast clock source is coarse but cheap
+    // enough to consult on every work unit.
+    ClockSource* const _fastClock;
+
+    // The last time this plan yielded (or started executing). The plan yields once
+    // internalQueryExecYieldPeriodMS have elapsed since then.
+    Date_t _lastYieldTime;
+
+    // The last time the storage engine snapshot was abandoned during a yield. Yields that find no
+    // operation waiting behind this plan's locks keep the snapshot, up to
+    // internalQueryExecYieldSnapshotMaxAgeMS.
+    Date_t _lastSnapshotAbandoned;
+
+    // Work units since we last polled the lock manager for operations queued behind this plan's
+    // locks. The poll runs every internalQueryExecYieldIterations work units.
+    int32_t _workUnitsSinceWaiterCheck = 0;
+
     // The plan executor which this yield policy is responsible for yielding. Must
     // not outlive the plan executor.
     PlanExecutor* const _planYielding;
@@ -255,6 +255,16 @@ std::unique_ptr<QuerySolutionNode> QueryPlannerAccess::makeCollectionScan(
         }
     }
 
+    // An unordered scan may share its read position with other concurrent scans of the same
+    // collection so that they reuse each other's storage engine cache footprint. This reorders
+    // the returned records, so it is only legal when nothing depends on scan order: the query
+    // must not sort (a {$natural: 1} sort spec requires scan order even though the scan provides
+    // no sort to the planner), and tailable, resumable and oplog scans all depend on position.
+    csn->allowSharedScan = internalQueryEnableSharedCollectionScans.load() &&
+        csn->direction == 1 && !csn->tailable && !csn->requestResumeToken &&
+        !csn->resumeAfterRecordId && !csn->minTs && !csn->maxTs && !query.nss().isOplog() &&
+        query.getQueryRequest().getSort().isEmpty();
+
     return std::move(csn);
 }
 
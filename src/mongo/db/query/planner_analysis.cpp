@@ -39,6 +39,7 @@
 #include "mongo/db/index/expression_params.h"
 #include "mongo/db/index/s2_common.h"
 #include "mongo/db/jsobj.h"
+#include "mongo/db/matcher/expression_algo.h"
 #include "mongo/db/matcher/expression_geo.h"
 #include "mongo/db/query/query_planner.h"
 #include "mongo/db/query/query_planner_common.h"
@@ -291,11 +292,51 @@ void geoSkipValidationOn(const std::set<StringData>& twoDSphereFields,
 }
 
 /**
- * If any field is missing from the list of fields the projection wants, we are not covered.
+ * Returns true if the plan rooted at 'solnRoot' can materialize the dotted path 'field' from a key
+ * pattern component that is a proper prefix of it. An index on {a: 1} stores the entire value of
+ * 'a' in its keys, so 'a.b' can be recovered when the projection stage rehydrates the key into a
+ * document. This only holds when the data comes from a single btree index scan whose prefix
+ * component has no multikey components (individual array elements cannot be reassembled from the
+ * keys in the right order) and whose index uses the simple collation (with a non-simple collation
+ * the stored object may contain collation keys anywhere inside it).
  */
-auto providesAllFields(const vector<std::string>& fields, const QuerySolutionNode& solnRoot) {
+bool providesFieldViaKeyPatternPrefix(const std::string& field, QuerySolutionNode* solnRoot) {
+    vector<QuerySolutionNode*> leafNodes;
+    getLeafNodes(solnRoot, &leafNodes);
+    if (1 != leafNodes.size() || STAGE_IXSCAN != leafNodes[0]->getType()) {
+        return false;
+    }
+
+    const auto& index = static_cast<const IndexScanNode*>(leafNodes[0])->index;
+    if (index.type != IndexType::INDEX_BTREE || index.collator) {
+        return false;
+    }
+    if (index.multikey && index.multikeyPaths.empty()) {
+        // The index is multikey but lacks path-level multikeyness information, so we cannot prove
+        // that the prefix component is non-multikey.
+        return false;
+    }
+
+    size_t keyPatternFieldIndex = 0;
+    for (auto&& elt : index.keyPattern) {
+        if (elt.isNumber() && expression::isPathPrefixOf(elt.fieldNameStringData(), field) &&
+            (!index.multikey || index.multikeyPaths[keyPatternFieldIndex].empty())) {
+            return true;
+        }
+        ++keyPatternFieldIndex;
+    }
+    return false;
+}
+
+/**
+ * If any field is missing from the list of fields the projection wants, we are not covered. A
+ * dotted field which no node provides directly may still be extracted from the index key if a
+ * prefix of its path appears as a non-multikey key pattern component.
+ */
+auto providesAllFields(const vector<std::string>& fields, QuerySolutionNode* solnRoot) {
     for (size_t i = 0; i < fields.size(); ++i) {
-        if (!solnRoot.hasField(fields[i]))
+        if (!solnRoot->hasField(fields[i]) &&
+            !providesFieldViaKeyPatternPrefix(fields[i], solnRoot))
             return false;
     }
     return true;
@@ -353,7 +394,7 @@ std::unique_ptr<ProjectionNode> analyzeProjection(const CanonicalQuery& query,
     // we add a fetch stage if we are not covered.
     if (!solnRoot->fetched() &&
         (query.getProj()->requiresDocument() ||
-         (!providesAllFields(query.getProj()->getRequiredFields(), *solnRoot)))) {
+         (!providesAllFields(query.getProj()->getRequiredFields(), solnRoot.get())))) {
         auto fetch = std::make_unique<FetchNode>();
         fetch->children.push_back(solnRoot.release());
         solnRoot = std::move(fetch);
@@ -262,6 +262,19 @@ TEST_F(QueryPlannerTest, DottedFieldCovering) {
         "bounds: {'a.b': [[5,5,true,true]]}}}}}");
 }
 
+TEST_F(QueryPlannerTest, DottedFieldCoveringWithIndexOnPathPrefix) {
+    addIndex(BSON("a" << 1));
+    runQuerySortProj(fromjson("{a: {$gt: 1}}"), BSONObj(), fromjson("{_id: 0, 'a.b': 1}"));
+
+    ASSERT_EQUALS(getNumSolutions(), 2U);
+    assertSolutionExists(
+        "{proj: {spec: {_id: 0, 'a.b': 1}, node: "
+        "{cscan: {dir: 1, filter: {a: {$gt: 1}}}}}}");
+    assertSolutionExists(
+        "{proj: {spec: {_id: 0, 'a.b': 1}, node: {ixscan: {filter: null, pattern: {a: 1},"
+        "bounds: {a: [[1,Infinity,false,true]]}}}}}");
+}
+
 TEST_F(QueryPlannerTest, IdCovering) {
     runQuerySortProj(fromjson("{_id: {$gt: 10}}"), BSONObj(), fromjson("{_id: 1}"));
 
@@ -1180,6 +1193,18 @@ TEST_F(QueryPlannerTest,
         "{cscan: {dir: 1}}}}");
 }
 
+TEST_F(QueryPlannerTest,
+       EmptyQueryWithDottedProjectionUsesCoveredIxscanOnPathPrefixIndexIfEnabled) {
+    params.options = QueryPlannerParams::GENERATE_COVERED_IXSCANS;
+    addIndex(BSON("a" << 1));
+    runQueryAsCommand(fromjson("{find: 'testns', projection: {_id: 0, 'a.b': 1}}"));
+    assertNumSolutions(1);
+    assertSolutionExists(
+        "{proj: {spec: {_id: 0, 'a.b': 1}, node: "
+        "{ixscan: {filter: null, pattern: {a: 1},"
+        "bounds: {a: [['MinKey', 'MaxKey', true, true]]}}}}}");
+}
+
 TEST_F(QueryPlannerTest, EmptyQueryWithProjectionUsesCollscanIfIndexIsMultikey) {
     params.options = QueryPlannerParams::GENERATE_COVERED_IXSCANS;
     constexpr bool isMultikey = true;
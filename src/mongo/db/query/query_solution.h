@@ -373,6 +373,11 @@ struct CollectionScanNode : public QuerySolutionNode {
     // Whether or not to wait for oplog visibility on oplog collection scans.
     bool shouldWaitForOplogVisibility = false;
 
+    // If true, the collection scan may share its read position with other concurrent scans of the
+    // same collection, returning records in an arbitrary order. Only set for unordered, forward,
+    // non-tailable scans of non-oplog collections.
+    bool allowSharedScan = false;
+
     // Once the first matching document is found, assume that all documents after it must match.
     bool stopApplyingFilterAfterFirstMatch = false;
 };
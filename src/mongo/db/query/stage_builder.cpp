@@ -89,6 +89,7 @@ std::unique_ptr<PlanStage> buildStages(OperationContext* opCtx,
             params.requestResumeToken = csn->requestResumeToken;
             params.resumeAfterRecordId = csn->resumeAfterRecordId;
             params.stopApplyingFilterAfterFirstMatch = csn->stopApplyingFilterAfterFirstMatch;
+            params.allowSharedScan = csn->allowSharedScan;
             return std::make_unique<CollectionScan>(
                 expCtx, collection, params, ws, csn->filter.get());
         }
@@ -0,0 +1,147 @@
+/**
+ * This file is part of Percona Server for MongoDB.
+ *
+ * Copyright (C) 2018-present Percona and/or its affiliates. All rights reserved.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/query_result_cache.h"
+
+#include "mongo/db/commands/server_status_metric.h"
+#include "mongo/db/query_result_cache_gen.h"
+#include "mongo/stdx/mutex.h"
+
+namespace mongo {
+namespace {
+
+Counter64 queryResultCacheHits;
+Counter64 queryResultCacheMisses;
+ServerStatusMetricField<Counter64> displayQueryResultCacheHits("queryResultCache.hits",
+                                                               &queryResultCacheHits);
+ServerStatusMetricField<Counter64> displayQueryResultCacheMisses("queryResultCache.misses",
+                                                                 &queryResultCacheMisses);
+
+}  // namespace
+
+QueryResultCache& QueryResultCache::get() {
+    static QueryResultCache cache;
+    return cache;
+}
+
+std::string QueryResultCache::_makeKey(StringData dbName, const BSONObj& cmdKey) {
+    std::string key;
+    key.reserve(dbName.size() + 1 + cmdKey.objsize());
+    key.append(dbName.rawData(), dbName.size());
+    key.push_back('\0');
+    key.append(cmdKey.objdata(), cmdKey.objsize());
+    return key;
+}
+
+boost::optional<BSONObj> QueryResultCache::lookup(StringData dbName, const BSONObj& cmdKey) {
+    if (gQueryResultCacheTTLSeconds.load() <= 0) {
+        return boost::none;
+    }
+
+    const auto key = _makeKey(dbName, cmdKey);
+    const auto now = Date_t::now();
+
+    stdx::lock_guard<Latch> lk(_mutex);
+    auto it = _entries.find(key);
+    if (it == _entries.end()) {
+        queryResultCacheMisses.increment();
+        return boost::none;
+    }
+    const auto& entry = it->second;
+    auto genIt = _generations.find(entry.ns);
+    const uint64_t currentGen = genIt != _generations.end() ? genIt->second : 0;
+    if (entry.expires <= now || entry.generation != currentGen) {
+        _entries.erase(it);
+        _numEntries.store(static_cast<long long>(_entries.size()));
+        queryResultCacheMisses.increment();
+        return boost::none;
+    }
+    queryResultCacheHits.increment();
+    return entry.reply;
+}
+
+void QueryResultCache::store(StringData dbName,
+                             const BSONObj& cmdKey,
+                             StringData ns,
+                             const BSONObj& replyBody) {
+    const auto ttl = Seconds(gQueryResultCacheTTLSeconds.load());
+    if (ttl <= Seconds::zero() || replyBody.objsize() > kMaxCachedReplySize) {
+        return;
+    }
+
+    auto key = _makeKey(dbName, cmdKey);
+    const auto now = Date_t::now();
+
+    stdx::lock_guard<Latch> lk(_mutex);
+    if (_entries.size() >= kMaxEntries) {
+        // Cheap bound on memory: drop everything rather than maintaining an eviction order for
+        // entries that expire within seconds anyway.
+        _entries.clear();
+    }
+    auto genIt = _generations.find(ns);
+    const uint64_t currentGen = genIt != _generations.end() ? genIt->second : 0;
+    _entries[std::move(key)] = Entry{replyBody.getOwned(), ns.toString(), currentGen, now + ttl};
+    _numEntries.store(static_cast<long long>(_entries.size()));
+}
+
+void QueryResultCache::invalidate(StringData ns) {
+    // Generation numbers only need to advance relative to entries that already exist, so when
+    // nothing is cached — in particular while the cache is disabled, which is the default — the
+    // write path gets out without touching the mutex or growing _generations.
+    if (_numEntries.loadRelaxed() == 0) {
+        return;
+    }
+
+    stdx::lock_guard<Latch> lk(_mutex);
+    if (_generations.size() >= kMaxTrackedNamespaces) {
+        // Resetting the generation numbers would revalidate stale entries, so the entries go too.
+        _generations.clear();
+        _entries.clear();
+        _numEntries.store(0);
+    }
+    auto it = _generations.find(ns);
+    if (it == _generations.end()) {
+        _generations.emplace(ns.toString(), 1);
+    } else {
+        ++it->second;
+    }
+}
+
+void QueryResultCache::clear() {
+    stdx::lock_guard<Latch> lk(_mutex);
+    _entries.clear();
+    _generations.clear();
+    _numEntries.store(0);
+}
+
+}  // namespace mongo
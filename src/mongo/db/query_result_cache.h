@@ -0,0 +1,108 @@
+/**
+ * This file is part of Percona Server for MongoDB.
+ *
+ * Copyright (C) 2018-present Percona and/or its affiliates. All rights reserved.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <string>
+
+#include <boost/optional.hpp>
+
+#include "mongo/base/string_data.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/util/string_map.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+
+/**
+ * Process-wide cache of complete command reply bodies for repeated identical read commands.
+ *
+ * Entries are keyed on the database name plus the caller-filtered command object (generic
+ * arguments other than readConcern stripped) and expire after 'queryResultCacheTTLSeconds'.
+ * Writes observed through the OpObserver bump a per-namespace generation number which
+ * immediately invalidates every entry cached against that namespace; the TTL bounds staleness
+ * for writes the observer does not see, such as oplog application on secondaries.
+ *
+ * Lookups and stores are no-ops while 'queryResultCacheTTLSeconds' is zero (the default).
+ */
+class QueryResultCache {
+public:
+    static QueryResultCache& get();
+
+    /**
+     * Returns the cached reply body for the given key, or boost::none on miss, expiry, or when
+     * the source namespace has seen a write since the entry was stored.
+     */
+    boost::optional<BSONObj> lookup(StringData dbName, const BSONObj& cmdKey);
+
+    /**
+     * Caches 'replyBody' (an ok:1 command reply with a fully exhausted first batch) for the
+     * given key. 'ns' is the command's source namespace, used for invalidation.
+     */
+    void store(StringData dbName, const BSONObj& cmdKey, StringData ns, const BSONObj& replyBody);
+
+    /**
+     * Invalidates all entries cached against 'ns'. Called from the OpObserver on writes.
+     */
+    void invalidate(StringData ns);
+
+    /**
+     * Drops every cached entry. Used for operations that affect more than one namespace, such
+     * as dropDatabase.
+     */
+    void clear();
+
+private:
+    struct Entry {
+        BSONObj reply;
+        std::string ns;
+        uint64_t generation;
+        Date_t expires;
+    };
+
+    static constexpr size_t kMaxEntries = 1000;
+    static constexpr size_t kMaxTrackedNamespaces = 10000;
+    static constexpr int kMaxCachedReplySize = 4 * 1024 * 1024;
+
+    static std::string _makeKey(StringData dbName, const BSONObj& cmdKey);
+
+    Mutex _mutex = MONGO_MAKE_LATCH("QueryResultCache::_mutex");
+    StringMap<Entry> _entries;
+    StringMap<uint64_t> _generations;
+
+    // Mirrors _entries.size(); updated under _mutex, read without it so invalidate() can skip
+    // the mutex on the write path when nothing is cached.
+    AtomicWord<long long> _numEntries{0};
+};
+
+}  // namespace mongo
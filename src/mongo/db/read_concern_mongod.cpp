@@ -244,10 +244,18 @@ bool canIgnorePrepareConflicts(OperationContext* opCtx,
     auto afterClusterTime = readConcernArgs.getArgsAfterClusterTime();
     auto atClusterTime = readConcernArgs.getArgsAtClusterTime();
 
-    if (afterClusterTime || atClusterTime) {
+    if (atClusterTime) {
         return false;
     }
 
+    if (afterClusterTime) {
+        // Causal reads must normally block on prepared transactions: a distributed commit the
+        // client already saw acknowledged may still be in prepared state on this shard, and
+        // reading around it would miss that write. Workloads that tolerate this can opt in to
+        // prepare conflict free causal reads.
+        return gIgnorePrepareConflictsForCausalReads.load();
+    }
+
     return true;
 }
 
@@ -510,6 +510,15 @@ std::vector<OplogEntry> ApplyOps::extractOperations(const OplogEntry& applyOpsOp
 void ApplyOps::extractOperationsTo(const OplogEntry& applyOpsOplogEntry,
                                    const BSONObj& topLevelDoc,
                                    std::vector<OplogEntry>* operations) {
+    forEachOperation(applyOpsOplogEntry, topLevelDoc, [operations](OplogEntry&& operation) {
+        operations->emplace_back(std::move(operation));
+    });
+}
+
+// static
+void ApplyOps::forEachOperation(const OplogEntry& applyOpsOplogEntry,
+                                const BSONObj& topLevelDoc,
+                                const std::function<void(OplogEntry&&)>& visitor) {
     uassert(ErrorCodes::TypeMismatch,
             str::stream() << "ApplyOps::extractOperations(): not a command: "
                           << redact(applyOpsOplogEntry.toBSON()),
@@ -521,11 +530,24 @@ void ApplyOps::extractOperationsTo(const OplogEntry& applyOpsOplogEntry,
             OplogEntry::CommandType::kApplyOps == applyOpsOplogEntry.getCommandType());
 
     auto cmdObj = applyOpsOplogEntry.getOperationToApply();
-    auto info = ApplyOpsCommandInfo::parse(cmdObj);
-    auto operationDocs = info.getOperations();
-    bool alwaysUpsert = info.getAlwaysUpsert() && !applyOpsOplogEntry.getTxnNumber();
+    bool alwaysUpsert = false;
+    {
+        // Only the scalar options survive this scope; the parsed info's view of the operation
+        // array is dropped so the iteration below stays the sole reference to the payload.
+        auto info = ApplyOpsCommandInfo::parse(cmdObj);
+        alwaysUpsert = info.getAlwaysUpsert() && !applyOpsOplogEntry.getTxnNumber();
+    }
+
+    // Iterate the operations directly from the raw BSON of the applyOps array; each element is an
+    // unowned view into the payload, and only the extracted entry under construction is
+    // materialized.
+    for (const auto& operationElem : cmdObj.firstElement().Obj()) {
+        uassert(ErrorCodes::TypeMismatch,
+                str::stream() << "ApplyOps::extractOperations(): not an object: "
+                              << redact(operationElem),
+                operationElem.type() == BSONType::Object);
+        auto operationDoc = operationElem.Obj();
 
-    for (const auto& operationDoc : operationDocs) {
         // Make sure that the inner ops are not malformed or over-specified.
         ReplOperation::parse(IDLParserErrorContext("extractOperations"), operationDoc);
 
@@ -538,9 +560,8 @@ void ApplyOps::extractOperationsTo(const OplogEntry& applyOpsOplogEntry,
         }
 
         builder.appendElementsUnique(topLevelDoc);
-        auto operation = builder.obj();
 
-        operations->emplace_back(operation);
+        visitor(OplogEntry(builder.obj()));
     }
 }
 
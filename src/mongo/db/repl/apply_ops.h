@@ -27,6 +27,7 @@
  *    it in the license file.
  */
 
+#include <functional>
 #include <vector>
 
 #include "mongo/base/status.h"
@@ -61,6 +62,19 @@ public:
     static void extractOperationsTo(const OplogEntry& applyOpsOplogEntry,
                                     const BSONObj& topLevelDoc,
                                     std::vector<OplogEntry>* operations);
+
+    /**
+     * Streaming variant of the extraction above: decodes the operations inside the applyOps
+     * payload one at a time, iterating the raw BSON array without copying it, and passes each
+     * extracted entry to 'visitor'. Only the entry currently being visited is materialized, so
+     * callers that apply operations incrementally keep their memory use bounded by one operation
+     * instead of the whole payload. Consumers that need the full set at once (multi-pass scans,
+     * distribution across applier threads) should keep using extractOperations().
+     * Throws UserException on error.
+     */
+    static void forEachOperation(const OplogEntry& applyOpsOplogEntry,
+                                 const BSONObj& topLevelDoc,
+                                 const std::function<void(OplogEntry&&)>& visitor);
 };
 
 /**
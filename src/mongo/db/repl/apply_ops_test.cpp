@@ -453,6 +453,49 @@ TEST_F(ApplyOpsTest, ExtractOperationsReturnsOperationsWithSameOpTimeAsApplyOps)
     ASSERT(operations.cend() == it);
 }
 
+TEST_F(ApplyOpsTest, ForEachOperationVisitsOperationsInOrderWithoutMaterializingAll) {
+    NamespaceString ns1("test.a");
+    auto ui1 = UUID::gen();
+    auto op1 = BSON("op"
+                    << "i"
+                    << "ns" << ns1.ns() << "ui" << ui1 << "o" << BSON("_id" << 1));
+
+    NamespaceString ns2("test.b");
+    auto ui2 = UUID::gen();
+    auto op2 = BSON("op"
+                    << "d"
+                    << "ns" << ns2.ns() << "ui" << ui2 << "o" << BSON("_id" << 2));
+
+    auto oplogEntry =
+        makeOplogEntry(OpTypeEnum::kCommand, BSON("applyOps" << BSON_ARRAY(op1 << op2)));
+
+    std::vector<OpTypeEnum> opTypes;
+    std::vector<NamespaceString> namespaces;
+    ApplyOps::forEachOperation(
+        oplogEntry, oplogEntry.toBSON(), [&](OplogEntry&& operation) {
+            opTypes.push_back(operation.getOpType());
+            namespaces.push_back(operation.getNss());
+            // Each visited entry carries the applyOps entry's optime, like extractOperations().
+            ASSERT_EQUALS(oplogEntry.getOpTime(), operation.getOpTime());
+        });
+
+    ASSERT_EQUALS(2U, opTypes.size());
+    ASSERT(OpTypeEnum::kInsert == opTypes[0]);
+    ASSERT(OpTypeEnum::kDelete == opTypes[1]);
+    ASSERT_EQUALS(ns1, namespaces[0]);
+    ASSERT_EQUALS(ns2, namespaces[1]);
+}
+
+TEST_F(ApplyOpsTest, ForEachOperationRejectsNonObjectOperation) {
+    // Corrupt payloads surface as TypeMismatch from the streaming decoder, matching the
+    // behavior of the vector-producing extraction.
+    auto badEntry = makeOplogEntry(OpTypeEnum::kCommand, BSON("applyOps" << BSON_ARRAY(1 << 2)));
+    ASSERT_THROWS_CODE(
+        ApplyOps::forEachOperation(badEntry, badEntry.toBSON(), [](OplogEntry&&) {}),
+        DBException,
+        ErrorCodes::TypeMismatch);
+}
+
 TEST_F(ApplyOpsTest, ApplyOpsFailsToDropAdmin) {
     auto opCtx = cc().makeOperationContext();
     auto mode = OplogApplication::Mode::kApplyOpsCmd;
@@ -32,10 +32,14 @@
 #include "mongo/platform/basic.h"
 
 #include "mongo/base/string_data.h"
+#include "mongo/db/client.h"
 #include "mongo/db/commands/list_collections_filter.h"
 #include "mongo/db/repl/database_cloner.h"
 #include "mongo/db/repl/database_cloner_gen.h"
+#include "mongo/db/repl/repl_server_parameters_gen.h"
+#include "mongo/db/repl/replication_auth.h"
 #include "mongo/logv2/log.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/assert_util.h"
 
 namespace mongo {
@@ -49,7 +53,16 @@ DatabaseCloner::DatabaseCloner(const std::string& dbName,
                                ThreadPool* dbPool)
     : BaseCloner("DatabaseCloner"_sd, sharedData, source, client, storageInterface, dbPool),
       _dbName(dbName),
-      _listCollectionsStage("listCollections", this, &DatabaseCloner::listCollectionsStage) {
+      _listCollectionsStage("listCollections", this, &DatabaseCloner::listCollectionsStage),
+      _createWorkerClientFn([this] {
+          auto workerClient = std::make_unique<DBClientConnection>(true /* autoReconnect */);
+          uassertStatusOK(workerClient->connect(getSource(), StringData()));
+          uassertStatusOK(replAuthenticate(workerClient.get())
+                              .withContext(str::stream() << "Failed to authenticate to "
+                                                         << getSource()
+                                                         << " for parallel collection cloning"));
+          return workerClient;
+      }) {
     invariant(!dbName.empty());
     _stats.dbname = dbName;
 }
@@ -130,6 +143,18 @@ void DatabaseCloner::postStage() {
             _stats.collectionStats.back().ns = coll.first.ns();
         }
     }
+    auto numWorkers =
+        std::min<size_t>(initialSyncCollectionClonerConcurrency, _collections.size());
+    if (numWorkers > 1) {
+        cloneCollectionsInParallel(numWorkers);
+    } else {
+        cloneCollectionsSerially();
+    }
+    stdx::lock_guard<Latch> lk(_mutex);
+    _stats.end = getSharedData()->getClock()->now();
+}
+
+void DatabaseCloner::cloneCollectionsSerially() {
     for (const auto& coll : _collections) {
         auto& sourceNss = coll.first;
         auto& collectionOptions = coll.second;
@@ -173,8 +198,87 @@ void DatabaseCloner::postStage() {
             _stats.clonedCollections++;
         }
     }
-    stdx::lock_guard<Latch> lk(_mutex);
-    _stats.end = getSharedData()->getClock()->now();
+}
+
+void DatabaseCloner::cloneCollectionsInParallel(size_t numWorkers) {
+    struct Worker {
+        std::unique_ptr<DBClientConnection> client;
+        stdx::thread thread;
+    };
+    std::vector<Worker> workers(numWorkers);
+
+    // Connect and authenticate every worker before starting any threads, so a connection failure
+    // surfaces as a normal retryable stage error rather than a partially started clone.
+    for (auto& worker : workers) {
+        worker.client = _createWorkerClientFn();
+    }
+
+    AtomicWord<size_t> nextIndex{0};
+    for (auto& worker : workers) {
+        worker.thread = stdx::thread([this, client = worker.client.get(), &nextIndex] {
+            Client::initThread("CollectionClonerWorker");
+            runParallelClonerWorker(client, &nextIndex);
+        });
+    }
+    for (auto& worker : workers) {
+        worker.thread.join();
+    }
+}
+
+void DatabaseCloner::runParallelClonerWorker(DBClientConnection* workerClient,
+                                             AtomicWord<size_t>* nextIndex) {
+    while (!mustExit()) {
+        auto collectionIndex = nextIndex->fetchAndAdd(1);
+        if (collectionIndex >= _collections.size()) {
+            return;
+        }
+        auto& sourceNss = _collections[collectionIndex].first;
+        auto& collectionOptions = _collections[collectionIndex].second;
+        auto collectionCloner = std::make_unique<CollectionCloner>(sourceNss,
+                                                                   collectionOptions,
+                                                                   getSharedData(),
+                                                                   getSource(),
+                                                                   workerClient,
+                                                                   getStorageInterface(),
+                                                                   getDBPool());
+        {
+            stdx::lock_guard<Latch> lk(_mutex);
+            _activeCollectionCloners[collectionIndex] = collectionCloner.get();
+        }
+        auto collStatus = [&] {
+            try {
+                return collectionCloner->run();
+            } catch (const DBException& e) {
+                return e.toStatus();
+            }
+        }();
+        if (collStatus.isOK()) {
+            LOGV2_DEBUG(4915303,
+                        1,
+                        "Collection clone finished on parallel cloner worker",
+                        "namespace"_attr = sourceNss);
+        } else {
+            LOGV2_ERROR(4915304,
+                        "Collection clone failed on parallel cloner worker",
+                        "namespace"_attr = sourceNss,
+                        "error"_attr = collStatus.toString());
+            setInitialSyncFailedStatus(
+                {ErrorCodes::InitialSyncFailure,
+                 collStatus
+                     .withContext(str::stream()
+                                  << "Error cloning collection '" << sourceNss.toString() << "'")
+                     .toString()});
+        }
+        {
+            stdx::lock_guard<Latch> lk(_mutex);
+            _stats.collectionStats[collectionIndex] = collectionCloner->getStats();
+            _activeCollectionCloners.erase(collectionIndex);
+            // Other workers stop via mustExit() if the collection clone failed.
+            if (!collStatus.isOK())
+                return;
+            _stats.clonedCollections++;
+        }
+    }
 }
 
 DatabaseCloner::Stats DatabaseCloner::getStats() const {
@@ -183,6 +287,9 @@ DatabaseCloner::Stats DatabaseCloner::getStats() const {
     if (_currentCollectionCloner) {
         stats.collectionStats[_stats.clonedCollections] = _currentCollectionCloner->getStats();
     }
+    for (auto&& active : _activeCollectionCloners) {
+        stats.collectionStats[active.first] = active.second->getStats();
+    }
     return stats;
 }
 
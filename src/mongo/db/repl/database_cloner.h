@@ -29,10 +29,14 @@
 
 #pragma once
 
+#include <functional>
+#include <map>
+#include <memory>
 #include <vector>
 
 #include "mongo/db/repl/base_cloner.h"
 #include "mongo/db/repl/collection_cloner.h"
+#include "mongo/platform/atomic_word.h"
 
 namespace mongo {
 namespace repl {
@@ -67,6 +71,15 @@ public:
 
     static CollectionOptions parseCollectionOptions(const BSONObj& element);
 
+    /**
+     * Overrides how connections for parallel collection cloner workers are created. For testing.
+     * The returned clients must be ready for use (connected and authenticated).
+     */
+    void setCreateWorkerClientFn_forTest(
+        std::function<std::unique_ptr<DBClientConnection>()> createWorkerClientFn) {
+        _createWorkerClientFn = std::move(createWorkerClientFn);
+    }
+
 protected:
     ClonerStages getStages() final;
 
@@ -91,6 +104,25 @@ private:
      */
     void postStage() final;
 
+    /**
+     * Clones the collections in _collections serially on the calling thread, using the cloner's
+     * own connection to the sync source.
+     */
+    void cloneCollectionsSerially();
+
+    /**
+     * Clones the collections in _collections using 'numWorkers' worker threads, each with a
+     * dedicated connection to the sync source. Workers pull collections off a shared list until
+     * it is exhausted or a clone fails.
+     */
+    void cloneCollectionsInParallel(size_t numWorkers);
+
+    /**
+     * Worker body for parallel collection cloning. Runs CollectionCloners over 'workerClient'
+     * until there are no collections left to claim or initial sync has failed.
+     */
+    void runParallelClonerWorker(DBClientConnection* workerClient, AtomicWord<size_t>* nextIndex);
+
     std::string describeForFuzzer(BaseClonerStage* stage) const final {
         return _dbName + " db: { " + stage->getName() + ": 1 } ";
     }
@@ -108,7 +140,10 @@ private:
     ClonerStage<DatabaseCloner> _listCollectionsStage;                        // (R)
     std::vector<std::pair<NamespaceString, CollectionOptions>> _collections;  // (X)
     std::unique_ptr<CollectionCloner> _currentCollectionCloner;               // (MX)
-    Stats _stats;                                                             // (MX)
+    // Cloners currently being run by parallel worker threads, keyed by index in _collections.
+    std::map<size_t, CollectionCloner*> _activeCollectionCloners;           // (M)
+    std::function<std::unique_ptr<DBClientConnection>()> _createWorkerClientFn;  // (X)
+    Stats _stats;                                                           // (MX)
 };
 
 }  // namespace repl
@@ -32,12 +32,14 @@
 #include "mongo/db/clientcursor.h"
 #include "mongo/db/repl/cloner_test_fixture.h"
 #include "mongo/db/repl/database_cloner.h"
+#include "mongo/db/repl/repl_server_parameters_gen.h"
 #include "mongo/db/repl/storage_interface.h"
 #include "mongo/db/repl/storage_interface_mock.h"
 #include "mongo/db/service_context_test_fixture.h"
 #include "mongo/dbtests/mock/mock_dbclient_connection.h"
 #include "mongo/unittest/unittest.h"
 #include "mongo/util/clock_source_mock.h"
+#include "mongo/util/scopeguard.h"
 #include "mongo/util/concurrency/thread_pool.h"
 
 namespace mongo {
@@ -390,6 +392,61 @@ TEST_F(DatabaseClonerTest, CreateCollections) {
     ASSERT(stats.commitCalled);
 }
 
+TEST_F(DatabaseClonerTest, CreateCollectionsInParallel) {
+    const auto savedConcurrency = initialSyncCollectionClonerConcurrency;
+    initialSyncCollectionClonerConcurrency = 2;
+    ON_BLOCK_EXIT([&] { initialSyncCollectionClonerConcurrency = savedConcurrency; });
+
+    auto uuid1 = UUID::gen();
+    auto uuid2 = UUID::gen();
+    const BSONObj idIndexSpec = BSON("v" << 1 << "key" << BSON("_id" << 1) << "name"
+                                         << "_id_");
+    const std::vector<BSONObj> sourceInfos = {BSON("name"
+                                                   << "a"
+                                                   << "type"
+                                                   << "collection"
+                                                   << "options" << BSONObj() << "info"
+                                                   << BSON("readOnly" << false << "uuid" << uuid1)),
+                                              BSON(
+                                                  "name"
+                                                  << "b"
+                                                  << "type"
+                                                  << "collection"
+                                                  << "options" << BSONObj() << "info"
+                                                  << BSON("readOnly" << false << "uuid" << uuid2))};
+    _mockServer->setCommandReply("listCollections",
+                                 createListCollectionsResponse({sourceInfos[0], sourceInfos[1]}));
+    // Single (repeating) replies, so the responses are valid no matter which worker claims which
+    // collection.
+    _mockServer->setCommandReply("count", createCountResponse(0));
+    _mockServer->setCommandReply("listIndexes",
+                                 createCursorResponse(_dbName + ".a", BSON_ARRAY(idIndexSpec)));
+    auto cloner = makeDatabaseCloner();
+    cloner->setCreateWorkerClientFn_forTest([this] {
+        return std::unique_ptr<DBClientConnection>(
+            new MockDBClientConnection(_mockServer.get(), true /* autoReconnect */));
+    });
+    auto status = cloner->run();
+    ASSERT_OK(status);
+
+    ASSERT_EQUALS(2U, _collections.size());
+
+    auto collInfo = _collections[NamespaceString{_dbName, "a"}];
+    auto stats = *collInfo.stats;
+    ASSERT_EQUALS(0, stats.insertCount);
+    ASSERT(stats.commitCalled);
+
+    collInfo = _collections[NamespaceString{_dbName, "b"}];
+    stats = *collInfo.stats;
+    ASSERT_EQUALS(0, stats.insertCount);
+    ASSERT(stats.commitCalled);
+
+    auto clonerStats = cloner->getStats();
+    ASSERT_EQ(2, clonerStats.clonedCollections);
+    ASSERT_EQ(_dbName + ".a", clonerStats.collectionStats[0].ns);
+    ASSERT_EQ(_dbName + ".b", clonerStats.collectionStats[1].ns);
+}
+
 TEST_F(DatabaseClonerTest, DatabaseAndCollectionStats) {
     auto uuid1 = UUID::gen();
     auto uuid2 = UUID::gen();
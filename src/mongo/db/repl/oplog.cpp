@@ -75,6 +75,7 @@
 #include "mongo/db/repl/apply_ops.h"
 #include "mongo/db/repl/bgsync.h"
 #include "mongo/db/repl/dbcheck.h"
+#include "mongo/db/repl/image_collection_entry_gen.h"
 #include "mongo/db/repl/local_oplog_info.h"
 #include "mongo/db/repl/optime.h"
 #include "mongo/db/repl/repl_client_info.h"
@@ -480,6 +481,36 @@ void appendOplogEntryChainInfo(OperationContext* opCtx,
     }
 }
 
+void writeToImageCollection(OperationContext* opCtx,
+                            const LogicalSessionId& sessionId,
+                            TxnNumber txnNum,
+                            Timestamp ts,
+                            RetryImageEnum imageKind,
+                            const BSONObj& image,
+                            bool invalidated) {
+    ImageEntry imageEntry;
+    imageEntry.set_id(sessionId);
+    imageEntry.setTxnNum(txnNum);
+    imageEntry.setTs(ts);
+    imageEntry.setImageKind(imageKind);
+    imageEntry.setImage(image);
+    imageEntry.setInvalidated(invalidated);
+
+    // The side collection is maintained by every node individually when it observes an oplog entry
+    // with 'needsRetryImage'; this write must not generate an oplog entry of its own.
+    UnreplicatedWritesBlock unreplicatedWrites(opCtx);
+
+    AutoGetCollection autoColl(opCtx, NamespaceString::kConfigImagesNamespace, MODE_IX);
+    uassert(5274702,
+            str::stream() << "Unable to persist retryable findAndModify image because the "
+                          << NamespaceString::kConfigImagesNamespace.ns()
+                          << " collection is missing. This indicates that the collection has been "
+                             "manually deleted.",
+            autoColl.getCollection());
+
+    Helpers::upsert(opCtx, NamespaceString::kConfigImagesNamespace.ns(), imageEntry.toBSON());
+}
+
 namespace {
 long long getNewOplogSizeBytes(OperationContext* opCtx, const ReplSettings& replSettings) {
     if (replSettings.getOplogSizeBytes() != 0) {
@@ -1287,6 +1318,13 @@ Status applyOperation_inlock(OperationContext* opCtx,
                 timestamp = op.getTimestamp();
             }
 
+            // If the write that generated this entry stored its pre/post image in
+            // config.image_collection, this node must maintain the side collection itself as part
+            // of applying the entry.
+            const auto needsRetryImage = (op.getSessionId() && op.getTxnNumber())
+                ? op.getNeedsRetryImage()
+                : boost::none;
+
             const StringData ns = op.getNss().ns();
             auto status = writeConflictRetry(opCtx, "applyOps_update", ns, [&] {
                 WriteUnitOfWork wuow(opCtx);
@@ -1294,6 +1332,12 @@ Status applyOperation_inlock(OperationContext* opCtx,
                     uassertStatusOK(opCtx->recoveryUnit()->setTimestamp(timestamp));
                 }
 
+                BSONObj imageDoc;
+                if (needsRetryImage == RetryImageEnum::kPreImage) {
+                    // Point read of the document as it is before this update is applied.
+                    Helpers::findById(opCtx, db, requestNss.ns(), updateCriteria, imageDoc);
+                }
+
                 UpdateResult ur = update(opCtx, db, request);
                 if (ur.numMatched == 0 && ur.upserted.isEmpty()) {
                     if (collection && collection->isCapped() &&
@@ -1359,6 +1403,24 @@ Status applyOperation_inlock(OperationContext* opCtx,
                     invariant(!oplogApplicationEnforcesSteadyStateConstraints);
                 }
 
+                if (needsRetryImage) {
+                    if (needsRetryImage == RetryImageEnum::kPostImage) {
+                        Helpers::findById(opCtx, db, requestNss.ns(), updateCriteria, imageDoc);
+                    }
+                    // Outside of steady state replication (initial sync, recovery) the document
+                    // read here may not match what the primary saw at this timestamp, so store an
+                    // invalidated entry instead of a possibly wrong image.
+                    const bool invalidated =
+                        mode != OplogApplication::Mode::kSecondary || imageDoc.isEmpty();
+                    writeToImageCollection(opCtx,
+                                           *op.getSessionId(),
+                                           *op.getTxnNumber(),
+                                           op.getTimestamp(),
+                                           *needsRetryImage,
+                                           invalidated ? BSONObj() : imageDoc,
+                                           invalidated);
+                }
+
                 wuow.commit();
                 return Status::OK();
             });
@@ -1395,12 +1457,22 @@ Status applyOperation_inlock(OperationContext* opCtx,
                 timestamp = op.getTimestamp();
             }
 
+            // As with updates, a delete carrying 'needsRetryImage' requires this node to store the
+            // pre-image of the document in config.image_collection while applying the entry.
+            const auto needsRetryImage = (op.getSessionId() && op.getTxnNumber())
+                ? op.getNeedsRetryImage()
+                : boost::none;
+
             const StringData ns = op.getNss().ns();
             writeConflictRetry(opCtx, "applyOps_delete", ns, [&] {
                 WriteUnitOfWork wuow(opCtx);
                 if (timestamp != Timestamp::min()) {
                     uassertStatusOK(opCtx->recoveryUnit()->setTimestamp(timestamp));
                 }
+                BSONObj imageDoc;
+                if (needsRetryImage) {
+                    Helpers::findById(opCtx, db, requestNss.ns(), deleteCriteria, imageDoc);
+                }
                 auto nDeleted = deleteObjects(
                     opCtx, collection, requestNss, deleteCriteria, true /* justOne */);
                 if (nDeleted == 0 && mode == OplogApplication::Mode::kSecondary) {
@@ -1419,6 +1491,17 @@ Status applyOperation_inlock(OperationContext* opCtx,
                                           << redact(op.toBSON()),
                             !oplogApplicationEnforcesSteadyStateConstraints);
                 }
+                if (needsRetryImage) {
+                    const bool invalidated =
+                        mode != OplogApplication::Mode::kSecondary || imageDoc.isEmpty();
+                    writeToImageCollection(opCtx,
+                                           *op.getSessionId(),
+                                           *op.getTxnNumber(),
+                                           op.getTimestamp(),
+                                           RetryImageEnum::kPreImage,
+                                           invalidated ? BSONObj() : imageDoc,
+                                           invalidated);
+                }
                 wuow.commit();
             });
 
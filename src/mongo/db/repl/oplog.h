@@ -96,6 +96,21 @@ void appendOplogEntryChainInfo(OperationContext* opCtx,
                                OplogLink* oplogLink,
                                StmtId stmtId);
 
+/**
+ * Upserts the pre/post image of a retryable findAndModify into config.image_collection, keyed by
+ * session id. Must be called within the same unit of work as the write that generated the image so
+ * that the image becomes visible (and is timestamped) atomically with the corresponding oplog
+ * entry. The write is not replicated; every node maintains the side collection itself when it
+ * observes an oplog entry with the 'needsRetryImage' field.
+ */
+void writeToImageCollection(OperationContext* opCtx,
+                            const LogicalSessionId& sessionId,
+                            TxnNumber txnNum,
+                            Timestamp ts,
+                            RetryImageEnum imageKind,
+                            const BSONObj& image,
+                            bool invalidated = false);
+
 /**
  * Create a new capped collection for the oplog if it doesn't yet exist.
  * If the collection already exists (and isReplSet is false),
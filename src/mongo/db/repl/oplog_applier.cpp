@@ -38,6 +38,7 @@
 #include "mongo/db/repl/repl_server_parameters_gen.h"
 #include "mongo/logv2/log.h"
 #include "mongo/util/time_support.h"
+#include "mongo/util/timer.h"
 
 namespace mongo {
 namespace repl {
@@ -121,7 +122,12 @@ void OplogApplier::enqueue(OperationContext* opCtx,
 StatusWith<OpTime> OplogApplier::applyOplogBatch(OperationContext* opCtx,
                                                  std::vector<OplogEntry> ops) {
     _observer->onBatchBegin(ops);
+    const auto numOps = ops.size();
+    Timer applyTimer;
     auto lastApplied = _applyOplogBatch(opCtx, std::move(ops));
+    if (lastApplied.isOK()) {
+        _oplogBatcher->recordBatchApplyDuration(Microseconds(applyTimer.micros()), numOps);
+    }
     _observer->onBatchEnd(lastApplied, {});
     return lastApplied;
 }
@@ -186,9 +186,8 @@ void processCrudOp(OperationContext* opCtx,
                    OplogEntry* op,
                    uint32_t* hash,
                    StringMapHashedKey* hashedNs,
-                   CachedCollectionProperties* collPropertiesCache) {
-    const bool supportsDocLocking =
-        opCtx->getServiceContext()->getStorageEngine()->supportsDocLocking();
+                   CachedCollectionProperties* collPropertiesCache,
+                   bool supportsDocLocking) {
     auto collProperties = collPropertiesCache->getCollectionProperties(opCtx, *hashedNs);
 
     // For doc locking engines, include the _id of the document in the hash so we get
@@ -239,6 +238,10 @@ void addDerivedOps(OperationContext* opCtx,
     boost::optional<uint32_t>
         serialWriterId;  // Used to determine which writer vector to assign serial ops.
 
+    // Hoisted out of the loop: two virtual calls per op add up over thousand-op batches.
+    const bool supportsDocLocking =
+        opCtx->getServiceContext()->getStorageEngine()->supportsDocLocking();
+
     for (auto&& op : *derivedOps) {
         auto hashedNs = StringMapHasher().hashed_key(op.getNss().ns());
         uint32_t hash = static_cast<uint32_t>(hashedNs.hash());
@@ -246,7 +249,7 @@ void addDerivedOps(OperationContext* opCtx,
             serialWriterId.emplace(hash);
         }
         if (op.isCrudOpType()) {
-            processCrudOp(opCtx, &op, &hash, &hashedNs, collPropertiesCache);
+            processCrudOp(opCtx, &op, &hash, &hashedNs, collPropertiesCache, supportsDocLocking);
         }
         if (serial) {
             // Serial derived ops go to the writer vector corresponding to the first op of
@@ -390,6 +393,178 @@ void ApplyBatchFinalizerForJournal::_run() {
     }
 }
 
+/**
+ * An optional stage between the OplogBatcher and the apply loop that writes each batch to the
+ * local oplog on a dedicated thread, so that the oplog writes for batch N+1 overlap with the
+ * application of batch N while the batcher keeps fetching batch N+2 behind both. Enabled by the
+ * replOplogWritePipelineEnabled server parameter; when active, _applyOplogBatch() skips its own
+ * oplog write phase and consistency marker updates because this stage has already performed them
+ * before handing over each batch.
+ *
+ * Crash safety relies on the oplog truncate after point never being cleared while the pipeline
+ * runs. It is advanced to the last timestamp of each batch as soon as that batch's writes
+ * complete, and only then is the batch handed to the applier. Since 'appliedThrough' is only
+ * advanced after a batch is applied, the truncate point always stays at or ahead of it, so
+ * startup recovery truncates exactly the entries of a partially written batch and never any
+ * applied ones.
+ */
+class OplogWritePipeline {
+public:
+    OplogWritePipeline(OplogBatcher* oplogBatcher,
+                       StorageInterface* storageInterface,
+                       ReplicationConsistencyMarkers* consistencyMarkers,
+                       ReplicationCoordinator* replCoord)
+        : _oplogBatcher(oplogBatcher),
+          _storageInterface(storageInterface),
+          _consistencyMarkers(consistencyMarkers),
+          _replCoord(replCoord),
+          _writerThread{&OplogWritePipeline::_run, this} {}
+    ~OplogWritePipeline();
+
+    /**
+     * Returns the next batch, whose entries have already been written to the local oplog.
+     * Returns an empty batch if none becomes ready within 'maxWaitTime', mirroring
+     * OplogBatcher::getNextBatch().
+     */
+    OplogBatch getNextBatch(Seconds maxWaitTime);
+
+private:
+    void _run();
+
+    /**
+     * Writes 'ops' to the local oplog on this thread and advances the oplog truncate after point
+     * and 'minValid' past the batch once all entries are in place.
+     */
+    void _writeBatchToOplog(OperationContext* opCtx, const std::vector<OplogEntry>& ops);
+
+    OplogBatcher* const _oplogBatcher;
+    StorageInterface* const _storageInterface;
+    ReplicationConsistencyMarkers* const _consistencyMarkers;
+    ReplicationCoordinator* const _replCoord;
+
+    // Whether the initial truncate after point, which bounds recovery at the position we start
+    // writing, has been persisted. Only accessed by the writer thread.
+    bool _truncatePointInitialized = false;
+
+    // Protects _cond, _shutdownSignaled, and _readyBatch.
+    Mutex _mutex = MONGO_MAKE_LATCH("OplogWritePipeline::_mutex");
+    // Used to hand batches from the writer thread to the apply loop.
+    stdx::condition_variable _cond;
+    // Single-slot queue of written batches; bounds the pipeline to one written-but-unapplied
+    // batch so a slow applier backpressures the writer, which backpressures the fetcher.
+    boost::optional<OplogBatch> _readyBatch;
+    // Once this is set to true the _run method will terminate.
+    bool _shutdownSignaled = false;
+    // Thread that will _run(). Must be initialized last as it depends on the other variables.
+    stdx::thread _writerThread;
+};
+
+OplogWritePipeline::~OplogWritePipeline() {
+    stdx::unique_lock<Latch> lock(_mutex);
+    _shutdownSignaled = true;
+    _cond.notify_all();
+    lock.unlock();
+
+    _writerThread.join();
+}
+
+OplogBatch OplogWritePipeline::getNextBatch(Seconds maxWaitTime) {
+    stdx::unique_lock<Latch> lk(_mutex);
+    if (!_readyBatch) {
+        // We intentionally don't care about whether this returns due to signaling or timeout
+        // since we do the same thing either way: return whatever is ready, if anything.
+        (void)_cond.wait_for(lk, maxWaitTime.toSystemDuration());
+    }
+
+    if (!_readyBatch) {
+        return OplogBatch(0);
+    }
+
+    OplogBatch ops = std::move(*_readyBatch);
+    _readyBatch = boost::none;
+    _cond.notify_all();
+    return ops;
+}
+
+void OplogWritePipeline::_run() {
+    Client::initThread("ReplOplogWriter");
+
+    while (true) {
+        // Blocks up to a second. The batcher does not emit empty batches unless it is shutting
+        // down or has exhausted the buffer in draining mode, so an empty unmarked batch just
+        // means nothing arrived in time and we should poll again.
+        OplogBatch ops = _oplogBatcher->getNextBatch(Seconds(1));
+
+        if (!ops.empty()) {
+            auto opCtx = cc().makeOperationContext();
+
+            // This code path is only executed on secondaries, so it is safe to exclude any
+            // writes from Flow Control.
+            opCtx->setShouldParticipateInFlowControl(false);
+
+            _writeBatchToOplog(opCtx.get(), ops.getBatch());
+        }
+
+        const bool mustShutdown = ops.mustShutdown();
+
+        {
+            stdx::unique_lock<Latch> lk(_mutex);
+            if (ops.empty() && !mustShutdown && !ops.termWhenExhausted()) {
+                if (_shutdownSignaled) {
+                    return;
+                }
+                continue;
+            }
+
+            // Block until the previous batch has been taken.
+            _cond.wait(lk, [&] { return !_readyBatch || _shutdownSignaled; });
+            if (_shutdownSignaled) {
+                return;
+            }
+
+            _readyBatch.emplace(std::move(ops));
+            _cond.notify_all();
+        }
+
+        if (mustShutdown) {
+            return;
+        }
+    }
+}
+
+void OplogWritePipeline::_writeBatchToOplog(OperationContext* opCtx,
+                                            const std::vector<OplogEntry>& ops) {
+    UnreplicatedWritesBlock uwb(opCtx);
+    ShouldNotConflictWithSecondaryBatchApplicationBlock shouldNotConflictBlock(opCtx->lockState());
+
+    if (!_truncatePointInitialized) {
+        // Before the first batch goes in, mark the oplog as hole-free only up to our last
+        // applied position, so a crash while this batch's writes are in flight truncates the
+        // partial batch and we refetch it from the sync source. For later batches the truncate
+        // point already sits at the end of the previous written batch.
+        _consistencyMarkers->setOplogTruncateAfterPoint(
+            opCtx, _replCoord->getMyLastAppliedOpTime().getTimestamp());
+        _truncatePointInitialized = true;
+    }
+
+    std::vector<InsertStatement> docs;
+    docs.reserve(ops.size());
+    for (const auto& op : ops) {
+        // Add as unowned BSON to avoid unnecessary ref-count bumps. The batch outlives 'docs'.
+        docs.emplace_back(InsertStatement{
+            op.getRaw(), op.getOpTime().getTimestamp(), op.getOpTime().getTerm()});
+    }
+
+    fassert(31612,
+            _storageInterface->insertDocuments(opCtx, NamespaceString::kRsOplogNamespace, docs));
+
+    // The oplog is now hole-free through the end of this batch, so advance the truncate point
+    // past it before the applier can see the batch and advance 'appliedThrough'. Also advance
+    // 'minValid', which must cover the batch before the first of its ops is applied.
+    _consistencyMarkers->setOplogTruncateAfterPoint(opCtx, ops.back().getOpTime().getTimestamp());
+    _consistencyMarkers->setMinValidToAtLeast(opCtx, ops.back().getOpTime());
+}
+
 }  // namespace
 
 OplogApplierImpl::OplogApplierImpl(executor::TaskExecutor* executor,
@@ -423,6 +598,18 @@ void OplogApplierImpl::_run(OplogBuffer* oplogBuffer) {
             ? new ApplyBatchFinalizerForJournal(_replCoord)
             : new ApplyBatchFinalizer(_replCoord)};
 
+    // When enabled, interpose a stage that writes each batch to the local oplog on its own
+    // thread, so the oplog writes for one batch overlap with the application of the previous
+    // one. _applyOplogBatch() skips its own oplog writes for batches that came through the
+    // pipeline. Declared after the ON_BLOCK_EXIT above so the writer thread is joined before
+    // the batcher it consumes from is shut down.
+    std::unique_ptr<OplogWritePipeline> writePipeline;
+    if (replOplogWritePipelineEnabled && !getOptions().skipWritesToOplog) {
+        writePipeline = std::make_unique<OplogWritePipeline>(
+            _oplogBatcher.get(), _storageInterface, _consistencyMarkers, _replCoord);
+        _oplogWritesPipelined = true;
+    }
+
     while (true) {  // Exits on message from OplogBatcher.
         // Use a new operation context each iteration, as otherwise we may appear to use a single
         // collection name to refer to collections with different UUIDs.
@@ -447,7 +634,8 @@ void OplogApplierImpl::_run(OplogBuffer* oplogBuffer) {
 
         // Blocks up to a second waiting for a batch to be ready to apply. If one doesn't become
         // ready in time, we'll loop again so we can do the above checks periodically.
-        OplogBatch ops = _oplogBatcher->getNextBatch(Seconds(1));
+        OplogBatch ops = writePipeline ? writePipeline->getNextBatch(Seconds(1))
+                                       : _oplogBatcher->getNextBatch(Seconds(1));
         if (ops.empty()) {
             if (ops.mustShutdown()) {
                 // Shut down and exit oplog application loop.
@@ -634,8 +822,9 @@ StatusWith<OpTime> OplogApplierImpl::_applyOplogBatch(OperationContext* opCtx,
         // because the spawned threads refer to objects on the stack
         ON_BLOCK_EXIT([&] { _writerPool->waitForIdle(); });
 
-        // Write batch of ops into oplog.
-        if (!getOptions().skipWritesToOplog) {
+        // Write batch of ops into oplog, unless the write pipeline already did so before
+        // handing the batch to us.
+        if (!getOptions().skipWritesToOplog && !_oplogWritesPipelined) {
             _consistencyMarkers->setOplogTruncateAfterPoint(
                 opCtx, _replCoord->getMyLastAppliedOpTime().getTimestamp());
             scheduleWritesToOplog(opCtx, _storageInterface, _writerPool, ops);
@@ -666,8 +855,10 @@ StatusWith<OpTime> OplogApplierImpl::_applyOplogBatch(OperationContext* opCtx,
             pauseBatchApplicationAfterWritingOplogEntries.pauseWhileSet(opCtx);
         }
 
-        // Reset consistency markers in case the node fails while applying ops.
-        if (!getOptions().skipWritesToOplog) {
+        // Reset consistency markers in case the node fails while applying ops. When the write
+        // pipeline is active it owns both markers: 'minValid' already covers this batch, and the
+        // truncate point must stay set because the next batch's writes may be in flight.
+        if (!getOptions().skipWritesToOplog && !_oplogWritesPipelined) {
             _consistencyMarkers->setOplogTruncateAfterPoint(opCtx, Timestamp());
             _consistencyMarkers->setMinValidToAtLeast(opCtx, ops.back().getOpTime());
         }
@@ -790,6 +981,8 @@ void OplogApplierImpl::_deriveOpsAndFillWriterVectors(
 
     LogicalSessionIdMap<std::vector<OplogEntry*>> partialTxnOps;
     CachedCollectionProperties collPropertiesCache;
+    const bool supportsDocLocking =
+        opCtx->getServiceContext()->getStorageEngine()->supportsDocLocking();
     for (auto&& op : *ops) {
         // If the operation's optime is before or the same as the beginApplyingOpTime we don't want
         // to apply it, so don't include it in writerVectors.
@@ -838,7 +1031,7 @@ void OplogApplierImpl::_deriveOpsAndFillWriterVectors(
         }
 
         if (op.isCrudOpType())
-            processCrudOp(opCtx, &op, &hash, &hashedNs, &collPropertiesCache);
+            processCrudOp(opCtx, &op, &hash, &hashedNs, &collPropertiesCache, supportsDocLocking);
         // Extract applyOps operations and fill writers with extracted operations using this
         // function.
         if (op.isTerminalApplyOps()) {
@@ -119,6 +119,11 @@ private:
     // we will apply all operations that were fetched.
     OpTime _beginApplyingOpTime = OpTime();
 
+    // Set by _run() when the oplog write pipeline is active. _applyOplogBatch() then skips its
+    // own oplog writes and consistency marker updates, because the pipeline performs both before
+    // handing over each batch.
+    bool _oplogWritesPipelined = false;
+
     void fillWriterVectors(OperationContext* opCtx,
                            std::vector<OplogEntry>* ops,
                            std::vector<std::vector<const OplogEntry*>>* writerVectors,
@@ -164,6 +164,27 @@ std::size_t getOpCount(const OplogEntry& entry) {
 }
 }  // namespace
 
+void OplogBatcher::recordBatchApplyDuration(Microseconds duration, std::size_t numOps) {
+    if (numOps == 0) {
+        return;
+    }
+    auto perOpMicros = durationCount<Microseconds>(duration) / static_cast<long long>(numOps);
+    auto ema = _emaPerOpApplyMicros.load();
+    // Weight recent batches at 1/4 so one anomalous batch doesn't whipsaw the batch size.
+    _emaPerOpApplyMicros.store(ema ? (3 * ema + perOpMicros) / 4 : perOpMicros);
+}
+
+std::size_t OplogBatcher::_adjustBatchLimitForApplyCost(std::size_t opsLimit) const {
+    auto targetMillis = replBatchTargetApplyMillis.load();
+    auto perOpMicros = _emaPerOpApplyMicros.load();
+    if (targetMillis <= 0 || perOpMicros <= 0) {
+        return opsLimit;
+    }
+    auto adaptiveLimit = static_cast<std::size_t>(
+        std::max<long long>(1, targetMillis * 1000LL / perOpMicros));
+    return std::min(opsLimit, adaptiveLimit);
+}
+
 StatusWith<std::vector<OplogEntry>> OplogBatcher::getNextApplierBatch(
     OperationContext* opCtx, const BatchLimits& batchLimits) {
     if (batchLimits.ops == 0) {
@@ -277,7 +298,7 @@ void OplogBatcher::_run(StorageInterface* storageInterface) {
         batchLimits.slaveDelayLatestTimestamp = _calculateSlaveDelayLatestTimestamp();
 
         // Check the limits once per batch since users can change them at runtime.
-        batchLimits.ops = getBatchLimitOplogEntries();
+        batchLimits.ops = _adjustBatchLimitForApplyCost(getBatchLimitOplogEntries());
 
         // Use the OplogBuffer to populate a local OplogBatch. Note that the buffer may be empty.
         OplogBatch ops(batchLimits.ops);
@@ -32,6 +32,7 @@
 #include "mongo/db/repl/oplog_buffer.h"
 #include "mongo/db/repl/oplog_entry.h"
 #include "mongo/db/repl/storage_interface.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/stdx/thread.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/invariant.h"
@@ -173,7 +174,22 @@ public:
     StatusWith<std::vector<OplogEntry>> getNextApplierBatch(OperationContext* opCtx,
                                                             const BatchLimits& batchLimits);
 
+    /**
+     * Feeds back the measured wall-clock cost of applying a batch of 'numOps' operations.
+     * Maintains an exponential moving average of the per-operation apply cost, which the batcher
+     * thread uses to size subsequent batches when replBatchTargetApplyMillis is set.
+     */
+    void recordBatchApplyDuration(Microseconds duration, std::size_t numOps);
+
 private:
+    /**
+     * Returns 'opsLimit' scaled down (never up past 'opsLimit') so that the projected apply time
+     * of the next batch stays near replBatchTargetApplyMillis, based on the per-op cost recorded
+     * by recordBatchApplyDuration(). Returns 'opsLimit' unchanged when adaptive batching is
+     * disabled or no cost measurement exists yet.
+     */
+    std::size_t _adjustBatchLimitForApplyCost(std::size_t opsLimit) const;
+
     /**
      * If slaveDelay is enabled, this function calculates the most recent timestamp of any oplog
      * entries that can be be returned in a batch.
@@ -199,6 +215,10 @@ private:
     OplogBatch _ops;
 
     std::unique_ptr<stdx::thread> _thread;
+
+    // Exponential moving average of the per-operation apply cost in microseconds. Written by the
+    // applier thread via recordBatchApplyDuration() and read by the batcher thread, hence atomic.
+    AtomicWord<long long> _emaPerOpApplyMicros{0};
 };
 
 /**
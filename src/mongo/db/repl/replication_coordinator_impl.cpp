@@ -995,8 +995,9 @@ ReplicationCoordinator::Mode ReplicationCoordinatorImpl::getReplicationMode() co
 }
 
 MemberState ReplicationCoordinatorImpl::getMemberState() const {
-    stdx::lock_guard<Latch> lk(_mutex);
-    return _getMemberState_inlock();
+    // Reads the published copy of _memberState; these checks run several times per operation
+    // and must not contend on _mutex with heartbeat processing.
+    return MemberState(_cachedMemberState.load());
 }
 
 std::vector<MemberData> ReplicationCoordinatorImpl::getMemberData() const {
@@ -4041,6 +4042,7 @@ ReplicationCoordinatorImpl::_updateMemberStateFromTopologyCoordinator(WithLock l
                   "newState"_attr = newState,
                   "oldState"_attr = _memberState);
     _memberState = newState;
+    _cachedMemberState.store(newState.s);
 
     _cancelAndRescheduleElectionTimeout_inlock();
 
@@ -4449,10 +4451,41 @@ ReplicationCoordinatorImpl::_setCurrentRSConfig(WithLock lk,
 }
 
 void ReplicationCoordinatorImpl::_wakeReadyWaiters(WithLock lk, boost::optional<OpTime> opTime) {
+    // Satisfaction of an optime-based write concern is monotone in the waited-on optime: a write
+    // concern satisfied at 'opTime' is satisfied for every waiter at or below it. When many
+    // concurrent writers wait with identical write concerns (e.g. w:"majority"), evaluating member
+    // progress once per distinct write concern at the advancement optime and reusing that verdict
+    // across the eligible prefix avoids re-tallying per waiter. Distinct write concerns in a single
+    // pass are few, so a flat vector lookup suffices.
+    std::vector<std::pair<WriteConcernOptions, bool>> satisfiedAtWakeOpTime;
+    auto doneWaiting = [&](const OpTime& waiterOpTime, const WriteConcernOptions& writeConcern) {
+        if (!opTime || writeConcern.checkCondition != WriteConcernOptions::CheckCondition::OpTime) {
+            return _doneWaitingForReplication_inlock(waiterOpTime, writeConcern);
+        }
+        auto cached = std::find_if(satisfiedAtWakeOpTime.begin(),
+                                   satisfiedAtWakeOpTime.end(),
+                                   [&](const auto& entry) {
+                                       return entry.first.wMode == writeConcern.wMode &&
+                                           entry.first.wNumNodes == writeConcern.wNumNodes &&
+                                           entry.first.syncMode == writeConcern.syncMode;
+                                   });
+        if (cached == satisfiedAtWakeOpTime.end()) {
+            cached = satisfiedAtWakeOpTime.emplace(
+                satisfiedAtWakeOpTime.end(),
+                writeConcern,
+                _doneWaitingForReplication_inlock(*opTime, writeConcern));
+        }
+        if (cached->second) {
+            return true;
+        }
+        // Not satisfied at the advancement optime, but possibly satisfied at the waiter's own,
+        // earlier optime.
+        return _doneWaitingForReplication_inlock(waiterOpTime, writeConcern);
+    };
     _replicationWaiterList.setValueIf_inlock(
-        [this](const OpTime& opTime, const SharedWaiterHandle& waiter) {
+        [&](const OpTime& waiterOpTime, const SharedWaiterHandle& waiter) {
             invariant(waiter->writeConcern);
-            return _doneWaitingForReplication_inlock(opTime, waiter->writeConcern.get());
+            return doneWaiting(waiterOpTime, waiter->writeConcern.get());
         },
         opTime);
 }
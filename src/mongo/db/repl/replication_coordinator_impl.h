@@ -1519,6 +1519,12 @@ private:
     // Current ReplicaSet state.
     MemberState _memberState;  // (M)
 
+    // Lock-free copy of _memberState, published on every state transition so that hot
+    // read-side callers of getMemberState() do not contend on _mutex with heartbeat
+    // processing. May lag _memberState by the duration of a transition, which is no worse
+    // than reading under the mutex and observing the old state just before the transition.
+    AtomicWord<int> _cachedMemberState{MemberState::RS_STARTUP};  // (S)
+
     // Used to signal threads waiting for changes to _memberState.
     stdx::condition_variable _drainFinishedCond;  // (M)
 
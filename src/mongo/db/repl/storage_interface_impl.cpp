@@ -1048,6 +1048,39 @@ boost::optional<BSONObj> StorageInterfaceImpl::findOplogEntryLessThanOrEqualToTi
     invariant(oplog);
     invariant(opCtx->lockState()->isLocked());
 
+    // A record id in the oplog collection is equivalent to the document's timestamp field.
+    RecordId desiredRecordId = RecordId(timestamp.asULL());
+
+    // Try the record store's oplogStartHack first. On engines that support it (e.g. WiredTiger)
+    // this is a bounded seek in record id space that lands directly on the newest record with
+    // recordId <= desiredRecordId, instead of scanning the oplog backward from the end.
+    {
+        auto recordStore = oplog->getRecordStore();
+        boost::optional<RecordId> startLoc =
+            writeConflictRetry(opCtx, "findOplogEntryLessThanOrEqualToTimestamp", oplog->ns().ns(), [&] {
+                return recordStore->oplogStartHack(opCtx, desiredRecordId);
+            });
+        if (startLoc) {
+            if (startLoc->isNull()) {
+                // The oplog holds no entry at or before the requested timestamp.
+                return boost::none;
+            }
+            return writeConflictRetry(
+                opCtx,
+                "findOplogEntryLessThanOrEqualToTimestamp",
+                oplog->ns().ns(),
+                [&]() -> boost::optional<BSONObj> {
+                    RecordData record;
+                    if (!recordStore->findRecord(opCtx, *startLoc, &record)) {
+                        // The record was truncated away after the seek; since truncation removes
+                        // the oldest records first, no entry <= the timestamp remains.
+                        return boost::none;
+                    }
+                    return record.toBson().getOwned();
+                });
+        }
+    }
+
     // Using a YieldPolicy WRITE_CONFLICT_RETRY_ONLY that will allow query to retry on
     // WriteConflictExceptions without releasing locks that are important to callers.
     //
@@ -1063,9 +1096,6 @@ boost::optional<BSONObj> StorageInterfaceImpl::findOplogEntryLessThanOrEqualToTi
                                         PlanExecutor::WRITE_CONFLICT_RETRY_ONLY,
                                         InternalPlanner::BACKWARD);
 
-    // A record id in the oplog collection is equivalent to the document's timestamp field.
-    RecordId desiredRecordId = RecordId(timestamp.asULL());
-
     // Iterate the collection in reverse until the desiredRecordId, or one less than, is found.
     BSONObj bson;
     RecordId recordId;
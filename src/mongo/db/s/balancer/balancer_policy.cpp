@@ -247,6 +247,7 @@ ShardId BalancerPolicy::_getLeastLoadedReceiverShard(const ShardStatisticsVector
                                                      const set<ShardId>& excludedShards) {
     ShardId best;
     unsigned minChunks = numeric_limits<unsigned>::max();
+    uint64_t bestSizeMB = 0;
 
     for (const auto& stat : shardStats) {
         if (excludedShards.count(stat.shardId))
@@ -257,13 +258,17 @@ ShardId BalancerPolicy::_getLeastLoadedReceiverShard(const ShardStatisticsVector
             continue;
         }
 
+        // Chunk counts drive the balance, but equally-counted shards can hold very different
+        // amounts of data, so break ties towards the shard with the least data on it. This
+        // steers migrations to the emptiest shards first after a capacity expansion.
         unsigned myChunks = distribution.numberOfChunksInShard(stat.shardId);
-        if (myChunks >= minChunks) {
+        if (myChunks > minChunks || (myChunks == minChunks && stat.currSizeMB >= bestSizeMB)) {
             continue;
         }
 
         best = stat.shardId;
         minChunks = myChunks;
+        bestSizeMB = stat.currSizeMB;
     }
 
     return best;
@@ -275,6 +280,7 @@ ShardId BalancerPolicy::_getMostOverloadedShard(const ShardStatisticsVector& sha
                                                 const set<ShardId>& excludedShards) {
     ShardId worst;
     unsigned maxChunks = 0;
+    uint64_t worstSizeMB = 0;
 
     for (const auto& stat : shardStats) {
         if (excludedShards.count(stat.shardId))
@@ -282,11 +288,18 @@ ShardId BalancerPolicy::_getMostOverloadedShard(const ShardStatisticsVector& sha
 
         const unsigned shardChunkCount =
             distribution.numberOfChunksInShardWithTag(stat.shardId, chunkTag);
-        if (shardChunkCount <= maxChunks)
+        if (shardChunkCount == 0)
+            continue;
+
+        // Mirror the receiver-side tie-break: among equally-counted donors, drain the shard
+        // carrying the most data first.
+        if (shardChunkCount < maxChunks ||
+            (shardChunkCount == maxChunks && stat.currSizeMB <= worstSizeMB))
             continue;
 
         worst = stat.shardId;
         maxChunks = shardChunkCount;
+        worstSizeMB = stat.currSizeMB;
     }
 
     return worst;
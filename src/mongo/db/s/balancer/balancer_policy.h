@@ -212,8 +212,9 @@ public:
 
 private:
     /**
-     * Return the shard with the specified tag, which has the least number of chunks. If the tag is
-     * empty, considers all shards.
+     * Return the shard with the specified tag, which has the least number of chunks. Ties are
+     * broken towards the shard with the least data on it. If the tag is empty, considers all
+     * shards.
      */
     static ShardId _getLeastLoadedReceiverShard(const ShardStatisticsVector& shardStats,
                                                 const DistributionStatus& distribution,
@@ -221,8 +222,9 @@ private:
                                                 const std::set<ShardId>& excludedShards);
 
     /**
-     * Return the shard which has the least number of chunks with the specified tag. If the tag is
-     * empty, considers all chunks.
+     * Return the shard which has the most number of chunks with the specified tag. Ties are
+     * broken towards the shard with the most data on it. If the tag is empty, considers all
+     * chunks.
      */
     static ShardId _getMostOverloadedShard(const ShardStatisticsVector& shardStats,
                                            const DistributionStatus& distribution,
@@ -134,6 +134,27 @@ TEST(BalancerPolicy, Basic) {
     ASSERT_EQ(MigrateInfo::chunksImbalance, migrations[0].reason);
 }
 
+TEST(BalancerPolicy, SizeUsedAsTieBreakerBetweenEquallyCountedShards) {
+    // Shards 1 and 2 have the same number of chunks, but shard 2 is the most loaded by data
+    // size, and likewise shard 3 (vs shard 4) holds the least data. So the first migration
+    // should be 2 -> 3 and the second (parallel) one 1 -> 4.
+    auto cluster = generateCluster(
+        {{ShardStatistics(kShardId0, kNoMaxSize, 6, false, emptyTagSet, emptyShardVersion), 3},
+         {ShardStatistics(kShardId1, kNoMaxSize, 10, false, emptyTagSet, emptyShardVersion), 4},
+         {ShardStatistics(kShardId2, kNoMaxSize, 20, false, emptyTagSet, emptyShardVersion), 4},
+         {ShardStatistics(kShardId3, kNoMaxSize, 1, false, emptyTagSet, emptyShardVersion), 1},
+         {ShardStatistics(kShardId4, kNoMaxSize, 2, false, emptyTagSet, emptyShardVersion), 1}});
+
+    const auto migrations(
+        balanceChunks(cluster.first, DistributionStatus(kNamespace, cluster.second), false, false));
+    ASSERT_EQ(2U, migrations.size());
+    ASSERT_EQ(kShardId2, migrations[0].from);
+    ASSERT_EQ(kShardId3, migrations[0].to);
+    ASSERT_EQ(kShardId1, migrations[1].from);
+    ASSERT_EQ(kShardId4, migrations[1].to);
+    ASSERT_EQ(MigrateInfo::chunksImbalance, migrations[0].reason);
+}
+
 TEST(BalancerPolicy, SmallClusterShouldBePerfectlyBalanced) {
     auto cluster = generateCluster(
         {{ShardStatistics(kShardId0, kNoMaxSize, 1, false, emptyTagSet, emptyShardVersion), 1},
@@ -664,37 +664,47 @@ void MigrationChunkClonerSourceLegacy::_nextCloneBatchFromCloneLocs(OperationCon
                            Milliseconds(internalQueryExecYieldPeriodMS.load()));
 
     stdx::unique_lock<Latch> lk(_mutex);
-    auto iter = _cloneLocs.begin();
 
-    for (; iter != _cloneLocs.end(); ++iter) {
+    while (!_cloneLocs.empty()) {
         // We must always make progress in this method by at least one document because empty
         // return indicates there is no more initial clone data.
         if (arrBuilder->arrSize() && tracker.intervalHasElapsed()) {
             break;
         }
 
-        auto nextRecordId = *iter;
+        // Pop the next record id off the set before fetching the document, so that concurrent
+        // callers each operate on disjoint sets of documents and can fill their batches in
+        // parallel.
+        const auto nextRecordId = *_cloneLocs.begin();
+        _cloneLocs.erase(_cloneLocs.begin());
 
         lk.unlock();
 
-        Snapshotted<BSONObj> doc;
-        if (collection->findDoc(opCtx, nextRecordId, &doc)) {
-            // Use the builder size instead of accumulating the document sizes directly so
-            // that we take into consideration the overhead of BSONArray indices.
-            if (arrBuilder->arrSize() &&
-                (arrBuilder->len() + doc.value().objsize() + 1024) > BSONObjMaxUserSize) {
-
-                break;
+        try {
+            Snapshotted<BSONObj> doc;
+            if (collection->findDoc(opCtx, nextRecordId, &doc)) {
+                // Use the builder size instead of accumulating the document sizes directly so
+                // that we take into consideration the overhead of BSONArray indices.
+                if (arrBuilder->arrSize() &&
+                    (arrBuilder->len() + doc.value().objsize() + 1024) > BSONObjMaxUserSize) {
+                    // The document does not fit in the current batch, so return its record id to
+                    // the set for a subsequent batch to pick up.
+                    lk.lock();
+                    _cloneLocs.insert(nextRecordId);
+                    break;
+                }
+
+                arrBuilder->append(doc.value());
+                ShardingStatistics::get(opCtx).countDocsClonedOnDonor.addAndFetch(1);
             }
-
-            arrBuilder->append(doc.value());
-            ShardingStatistics::get(opCtx).countDocsClonedOnDonor.addAndFetch(1);
+        } catch (const DBException&) {
+            lk.lock();
+            _cloneLocs.insert(nextRecordId);
+            throw;
         }
 
         lk.lock();
     }
-
-    _cloneLocs.erase(_cloneLocs.begin(), iter);
 }
 
 uint64_t MigrationChunkClonerSourceLegacy::getCloneBatchBufferAllocationSize() {
@@ -146,8 +146,10 @@ public:
 
     /**
      * Called by the recipient shard. Populates the passed BSONArrayBuilder with a set of documents,
-     * which are part of the initial clone sequence. Assumes that there is only one active caller
-     * to this method at a time (otherwise, it can cause corruption/crash).
+     * which are part of the initial clone sequence. Safe to be called by multiple callers
+     * concurrently, in which case each caller receives a disjoint set of documents, so that the
+     * recipient can fetch and apply batches in parallel. Note that jumbo chunks cloned through an
+     * index scan do not support concurrent callers, because they share a single plan executor.
      *
      * Returns OK status on success. If there were documents returned in the result argument, this
      * method should be called more times until the result is empty. If it returns failure, it is
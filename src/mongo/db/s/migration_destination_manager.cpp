@@ -408,63 +408,116 @@ repl::OpTime MigrationDestinationManager::cloneDocumentsFromDonor(
     std::function<void(OperationContext*, BSONObj)> insertBatchFn,
     std::function<BSONObj(OperationContext*)> fetchBatchFn) {
 
-    SingleProducerSingleConsumerQueue<BSONObj>::Options options;
-    options.maxQueueDepth = 1;
+    // The number of fetcher/inserter thread pairs to run. With more than one pair, batches are
+    // fetched from the donor and applied locally in parallel.
+    const int numWorkers = chunkMigrationConcurrency.load();
 
-    SingleProducerSingleConsumerQueue<BSONObj> batches(options);
-    repl::OpTime lastOpApplied;
+    MultiProducerMultiConsumerQueue<BSONObj>::Options options;
+    options.maxQueueDepth = numWorkers;
 
-    stdx::thread inserterThread{[&] {
-        Client::initKillableThread("chunkInserter", opCtx->getServiceContext());
+    MultiProducerMultiConsumerQueue<BSONObj> batches(options);
 
-        auto inserterOpCtx = Client::getCurrent()->makeOperationContext();
-        auto consumerGuard = makeGuard([&] {
-            batches.closeConsumerEnd();
-            lastOpApplied = repl::ReplClientInfo::forClient(inserterOpCtx->getClient()).getLastOp();
-        });
+    std::vector<repl::OpTime> inserterLastOpsApplied(numWorkers);
 
-        try {
-            while (true) {
-                auto nextBatch = batches.pop(inserterOpCtx.get());
-                auto arr = nextBatch["objects"].Obj();
-                if (arr.isEmpty()) {
-                    return;
+    std::vector<stdx::thread> inserterThreads;
+    for (int i = 0; i < numWorkers; i++) {
+        inserterThreads.emplace_back([&, i] {
+            Client::initKillableThread("chunkInserter", opCtx->getServiceContext());
+
+            auto inserterOpCtx = Client::getCurrent()->makeOperationContext();
+            auto lastOpGuard = makeGuard([&] {
+                inserterLastOpsApplied[i] =
+                    repl::ReplClientInfo::forClient(inserterOpCtx->getClient()).getLastOp();
+            });
+
+            try {
+                while (true) {
+                    auto nextBatch = batches.pop(inserterOpCtx.get());
+                    insertBatchFn(inserterOpCtx.get(), nextBatch["objects"].Obj());
                 }
-                insertBatchFn(inserterOpCtx.get(), arr);
+            } catch (const ExceptionFor<ErrorCodes::ProducerConsumerQueueConsumed>&) {
+                // All batches fetched from the donor have been applied
+            } catch (const ExceptionFor<ErrorCodes::ProducerConsumerQueueEndClosed>&) {
+                // Another worker thread already failed and closed the queue
+            } catch (...) {
+                // Stop the fetchers and unblock any other workers waiting on the queue, then use
+                // killOp to propagate the failure to the migrate thread (this thread), which
+                // checks for interruption once all workers have been joined
+                batches.closeConsumerEnd();
+
+                stdx::lock_guard<Client> lk(*opCtx->getClient());
+                opCtx->getServiceContext()->killOperation(lk, opCtx, ErrorCodes::Error(51008));
+                LOGV2(21999,
+                      "Batch insertion failed: {error}",
+                      "Batch insertion failed",
+                      "error"_attr = redact(exceptionToStatus()));
             }
-        } catch (...) {
-            stdx::lock_guard<Client> lk(*opCtx->getClient());
-            opCtx->getServiceContext()->killOperation(lk, opCtx, ErrorCodes::Error(51008));
-            LOGV2(21999,
-                  "Batch insertion failed: {error}",
-                  "Batch insertion failed",
-                  "error"_attr = redact(exceptionToStatus()));
-        }
-    }};
+        });
+    }
 
+    // The fetcher threads record their failures here, so that the original error can be rethrown
+    // on the migrate thread after all workers have been joined
+    std::vector<Status> fetcherStatuses(numWorkers, Status::OK());
 
-    {
-        auto inserterThreadJoinGuard = makeGuard([&] {
-            batches.closeProducerEnd();
-            inserterThread.join();
-        });
+    std::vector<stdx::thread> fetcherThreads;
+    for (int i = 0; i < numWorkers; i++) {
+        fetcherThreads.emplace_back([&, i] {
+            Client::initKillableThread("chunkFetcher", opCtx->getServiceContext());
+
+            auto fetcherOpCtx = Client::getCurrent()->makeOperationContext();
 
-        while (true) {
-            auto res = fetchBatchFn(opCtx);
             try {
-                batches.push(res.getOwned(), opCtx);
-                auto arr = res["objects"].Obj();
-                if (arr.isEmpty()) {
-                    break;
+                while (true) {
+                    auto res = fetchBatchFn(fetcherOpCtx.get());
+                    if (res["objects"].Obj().isEmpty()) {
+                        // There is no more initial clone data. The other fetchers will each
+                        // receive an empty batch of their own and stop the same way.
+                        return;
+                    }
+                    batches.push(res.getOwned(), fetcherOpCtx.get());
                 }
             } catch (const ExceptionFor<ErrorCodes::ProducerConsumerQueueEndClosed>&) {
-                break;
+                // An inserter thread already failed and closed the queue
+            } catch (...) {
+                // Unblock any other workers waiting on the queue
+                batches.closeConsumerEnd();
+                fetcherStatuses[i] = exceptionToStatus();
+                LOGV2(31624,
+                      "Batch fetching failed: {error}",
+                      "Batch fetching failed",
+                      "error"_attr = redact(fetcherStatuses[i]));
             }
-        }
+        });
+    }
+
+    {
+        auto workerThreadJoinGuard = makeGuard([&] {
+            for (auto& fetcherThread : fetcherThreads) {
+                fetcherThread.join();
+            }
+
+            // All batches have been produced, so the inserters can drain the queue and exit
+            batches.closeProducerEnd();
+
+            for (auto& inserterThread : inserterThreads) {
+                inserterThread.join();
+            }
+        });
     }  // This scope ensures that the guard is destroyed
 
-    // This check is necessary because the consumer thread uses killOp to propagate errors to the
-    // producer thread (this thread)
+    for (const auto& fetcherStatus : fetcherStatuses) {
+        uassertStatusOK(fetcherStatus);
+    }
+
+    repl::OpTime lastOpApplied;
+    for (const auto& inserterLastOpApplied : inserterLastOpsApplied) {
+        if (lastOpApplied < inserterLastOpApplied) {
+            lastOpApplied = inserterLastOpApplied;
+        }
+    }
+
+    // This check is necessary because the worker threads use killOp to propagate errors to the
+    // migrate thread (this thread)
     opCtx->checkForInterrupt();
     return lastOpApplied;
 }
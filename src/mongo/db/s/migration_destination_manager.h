@@ -113,7 +113,9 @@ public:
                  const WriteConcernOptions& writeConcern);
 
     /**
-     * Clones documents from a donor shard.
+     * Clones documents from a donor shard. Runs 'chunkMigrationConcurrency' pairs of fetcher and
+     * inserter threads, so 'fetchBatchFn' and 'insertBatchFn' may be invoked concurrently from
+     * multiple threads. Returns the last op applied by any of the inserters.
      */
     static repl::OpTime cloneDocumentsFromDonor(
         OperationContext* opCtx,
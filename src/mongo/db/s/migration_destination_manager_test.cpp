@@ -30,8 +30,10 @@
 #include "mongo/platform/basic.h"
 
 #include "mongo/db/s/migration_destination_manager.h"
+#include "mongo/db/s/sharding_runtime_d_params_gen.h"
 #include "mongo/s/shard_server_test_fixture.h"
 #include "mongo/unittest/unittest.h"
+#include "mongo/util/scopeguard.h"
 
 namespace mongo {
 namespace {
@@ -105,6 +107,56 @@ TEST_F(MigrationDestinationManagerTest, CloneDocumentsFromDonorWorksCorrectly) {
     }
 }
 
+// Tests that all documents are cloned when batches are fetched and applied by multiple worker
+// threads.
+TEST_F(MigrationDestinationManagerTest, CloneDocumentsWithMultipleWorkerThreads) {
+    chunkMigrationConcurrency.store(3);
+    ON_BLOCK_EXIT([] { chunkMigrationConcurrency.store(1); });
+
+    const int kNumBatches = 10;
+    AtomicWord<int> fetchedBatches{0};
+
+    auto fetchBatchFn = [&](OperationContext* opCtx) {
+        const int batchNum = fetchedBatches.fetchAndAdd(1);
+
+        BSONObjBuilder fetchBatchResultBuilder;
+        if (batchNum >= kNumBatches) {
+            fetchBatchResultBuilder.append("objects", BSONObj());
+        } else {
+            BSONArrayBuilder arrayBuilder;
+            arrayBuilder.append(createDocument(batchNum));
+            fetchBatchResultBuilder.append("objects", arrayBuilder.arr());
+        }
+
+        return fetchBatchResultBuilder.obj();
+    };
+
+    auto resultDocsMutex = MONGO_MAKE_LATCH("CloneDocumentsWithMultipleWorkerThreads::mutex");
+    std::vector<BSONObj> resultDocs;
+
+    auto insertBatchFn = [&](OperationContext* opCtx, BSONObj docs) {
+        for (auto&& docToClone : docs) {
+            stdx::lock_guard<Latch> lk(resultDocsMutex);
+            resultDocs.push_back(docToClone.Obj().getOwned());
+        }
+    };
+
+    MigrationDestinationManager::cloneDocumentsFromDonor(
+        operationContext(), insertBatchFn, fetchBatchFn);
+
+    // The batches are applied in parallel, so no particular order of the documents is guaranteed
+    ASSERT_EQ(static_cast<size_t>(kNumBatches), resultDocs.size());
+
+    std::set<int> clonedValues;
+    for (const auto& doc : resultDocs) {
+        clonedValues.insert(doc["_id"].Int());
+    }
+
+    for (int i = 0; i < kNumBatches; i++) {
+        ASSERT_EQ(1U, clonedValues.count(i));
+    }
+}
+
 // Tests that an exception in the fetch logic will successfully throw an exception on the main
 // thread.
 TEST_F(MigrationDestinationManagerTest, CloneDocumentsThrowsFetchErrors) {
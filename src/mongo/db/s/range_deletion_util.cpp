@@ -284,6 +284,10 @@ void ensureRangeDeletionTaskStillExists(OperationContext* opCtx, const UUID& mig
 /**
  * Delete the range in a sequence of batches until there are no more documents to
  * delete or deletion returns an error.
+ *
+ * Each non-empty batch waits for its deletions to majority-replicate before the next batch
+ * begins, so the deletion rate is throttled by secondary replication lag: a lagging set slows
+ * the deleter down automatically, while a caught-up set pays only the no-op wait.
  */
 ExecutorFuture<void> deleteRangeInBatches(const std::shared_ptr<executor::TaskExecutor>& executor,
                                           const NamespaceString& nss,
@@ -299,18 +303,22 @@ ExecutorFuture<void> deleteRangeInBatches(const std::shared_ptr<executor::TaskEx
                        ensureRangeDeletionTaskStillExists(opCtx, *migrationId);
                    }
 
-                   AutoGetCollection autoColl(opCtx, nss, MODE_IX);
-                   auto* const collection = autoColl.getCollection();
+                   int numDeleted;
+                   {
+                       AutoGetCollection autoColl(opCtx, nss, MODE_IX);
+                       auto* const collection = autoColl.getCollection();
 
-                   // Ensure the collection exists and has not been dropped or dropped and
-                   // recreated.
-                   uassert(ErrorCodes::RangeDeletionAbandonedBecauseCollectionWithUUIDDoesNotExist,
+                       // Ensure the collection exists and has not been dropped or dropped and
+                       // recreated.
+                       uassert(
+                           ErrorCodes::RangeDeletionAbandonedBecauseCollectionWithUUIDDoesNotExist,
                            "Collection has been dropped since enqueuing this range "
                            "deletion task. No need to delete documents.",
                            !collectionUuidHasChanged(nss, collection, collectionUuid));
 
-                   auto numDeleted = uassertStatusOK(deleteNextBatch(
-                       opCtx, collection, keyPattern, range, numDocsToRemovePerBatch));
+                       numDeleted = uassertStatusOK(deleteNextBatch(
+                           opCtx, collection, keyPattern, range, numDocsToRemovePerBatch));
+                   }
 
                    LOGV2_DEBUG(23769,
                                2,
@@ -321,7 +329,21 @@ ExecutorFuture<void> deleteRangeInBatches(const std::shared_ptr<executor::TaskEx
                                "collectionUuid"_attr = collectionUuid,
                                "range"_attr = range.toString());
 
-                   return numDeleted;
+                   if (numDeleted == 0) {
+                       return ExecutorFuture<int>(executor, numDeleted);
+                   }
+
+                   // Throttle on replication lag: don't start the next batch until this one has
+                   // majority-replicated. The locks are released above, so waiting here doesn't
+                   // block foreground writes to the collection.
+                   repl::ReplClientInfo::forClient(opCtx->getClient())
+                       .setLastOpToSystemLastOpTime(opCtx);
+                   auto clientOpTime =
+                       repl::ReplClientInfo::forClient(opCtx->getClient()).getLastOp();
+                   return WaitForMajorityService::get(opCtx->getServiceContext())
+                       .waitUntilMajority(clientOpTime)
+                       .thenRunOn(executor)
+                       .then([numDeleted] { return numDeleted; });
                });
            })
         .until([](StatusWith<int> swNumDeleted) {
@@ -36,7 +36,9 @@
 #include <memory>
 
 #include "mongo/db/dbdirectclient.h"
+#include "mongo/db/dbhelpers.h"
 #include "mongo/db/ops/write_ops.h"
+#include "mongo/db/query/query_request.h"
 #include "mongo/db/write_concern_options.h"
 #include "mongo/logv2/log.h"
 #include "mongo/rpc/get_status_from_command_result.h"
@@ -138,27 +140,21 @@ StatusWith<RefreshState> getPersistedRefreshFlags(OperationContext* opCtx,
 StatusWith<ShardCollectionType> readShardCollectionsEntry(OperationContext* opCtx,
                                                           const NamespaceString& nss) {
 
-    Query fullQuery(BSON(ShardCollectionType::kNssFieldName << nss.ns()));
-
     try {
-        DBDirectClient client(opCtx);
-        std::unique_ptr<DBClientCursor> cursor =
-            client.query(NamespaceString::kShardConfigCollectionsNamespace, fullQuery, 1);
-        if (!cursor) {
-            return Status(ErrorCodes::OperationFailed,
-                          str::stream() << "Failed to establish a cursor for reading "
-                                        << NamespaceString::kShardConfigCollectionsNamespace.ns()
-                                        << " from local storage");
-        }
-
-        if (!cursor->more()) {
+        auto qr =
+            std::make_unique<QueryRequest>(NamespaceString::kShardConfigCollectionsNamespace);
+        qr->setFilter(BSON(ShardCollectionType::kNssFieldName << nss.ns()));
+        qr->setLimit(1);
+
+        std::vector<BSONObj> documents;
+        Helpers::findAll(opCtx, std::move(qr), &documents);
+        if (documents.empty()) {
             // The collection has been dropped.
             return Status(ErrorCodes::NamespaceNotFound,
                           str::stream() << "collection " << nss.ns() << " not found");
         }
 
-        BSONObj document = cursor->nextSafe();
-        return ShardCollectionType::fromBSON(document);
+        return ShardCollectionType::fromBSON(documents.front());
     } catch (const DBException& ex) {
         return ex.toStatus(str::stream() << "Failed to read the '" << nss.ns()
                                          << "' entry locally from config.collections");
@@ -166,27 +162,20 @@ StatusWith<ShardCollectionType> readShardCollectionsEntry(OperationContext* opCt
 }
 
 StatusWith<ShardDatabaseType> readShardDatabasesEntry(OperationContext* opCtx, StringData dbName) {
-    Query fullQuery(BSON(ShardDatabaseType::name() << dbName.toString()));
-
     try {
-        DBDirectClient client(opCtx);
-        std::unique_ptr<DBClientCursor> cursor =
-            client.query(NamespaceString::kShardConfigDatabasesNamespace, fullQuery, 1);
-        if (!cursor) {
-            return Status(ErrorCodes::OperationFailed,
-                          str::stream() << "Failed to establish a cursor for reading "
-                                        << NamespaceString::kShardConfigDatabasesNamespace.ns()
-                                        << " from local storage");
-        }
+        auto qr = std::make_unique<QueryRequest>(NamespaceString::kShardConfigDatabasesNamespace);
+        qr->setFilter(BSON(ShardDatabaseType::name() << dbName.toString()));
+        qr->setLimit(1);
 
-        if (!cursor->more()) {
+        std::vector<BSONObj> documents;
+        Helpers::findAll(opCtx, std::move(qr), &documents);
+        if (documents.empty()) {
             // The database has been dropped.
             return Status(ErrorCodes::NamespaceNotFound,
                           str::stream() << "database " << dbName.toString() << " not found");
         }
 
-        BSONObj document = cursor->nextSafe();
-        auto statusWithDatabaseEntry = ShardDatabaseType::fromBSON(document);
+        auto statusWithDatabaseEntry = ShardDatabaseType::fromBSON(documents.front());
         if (!statusWithDatabaseEntry.isOK()) {
             return statusWithDatabaseEntry.getStatus();
         }
@@ -292,23 +281,19 @@ StatusWith<std::vector<ChunkType>> readShardChunks(OperationContext* opCtx,
                                                    boost::optional<long long> limit,
                                                    const OID& epoch) {
     try {
-        Query fullQuery(query);
-        fullQuery.sort(sort);
-
-        DBDirectClient client(opCtx);
-
         const std::string chunkMetadataNs = ChunkType::ShardNSPrefix + nss.ns();
 
-        std::unique_ptr<DBClientCursor> cursor =
-            client.query(NamespaceString(chunkMetadataNs), fullQuery, limit.get_value_or(0));
-        uassert(ErrorCodes::OperationFailed,
-                str::stream() << "Failed to establish a cursor for reading " << chunkMetadataNs
-                              << " from local storage",
-                cursor);
+        auto qr = std::make_unique<QueryRequest>(NamespaceString(chunkMetadataNs));
+        qr->setFilter(query);
+        qr->setSort(sort);
+        qr->setLimit(limit);
+
+        std::vector<BSONObj> documents;
+        Helpers::findAll(opCtx, std::move(qr), &documents);
 
         std::vector<ChunkType> chunks;
-        while (cursor->more()) {
-            BSONObj document = cursor->nextSafe().getOwned();
+        chunks.reserve(documents.size());
+        for (const auto& document : documents) {
             auto statusWithChunk = ChunkType::fromShardBSON(document, epoch);
             if (!statusWithChunk.isOK()) {
                 return statusWithChunk.getStatus().withContext(
@@ -152,13 +152,15 @@ void ServerTransactionsMetrics::decrementCurrentPrepared() {
 void ServerTransactionsMetrics::updateLastTransaction(size_t operationCount,
                                                       size_t oplogOperationBytes,
                                                       BSONObj writeConcern) {
+    // Build the record outside the critical section so concurrently committing transactions only
+    // serialize on the pointer swap below.
+    auto lastCommitted = std::make_shared<LastCommittedTransaction>();
+    lastCommitted->setOperationCount(operationCount);
+    lastCommitted->setOplogOperationBytes(oplogOperationBytes);
+    lastCommitted->setWriteConcern(std::move(writeConcern));
+
     stdx::lock_guard<Latch> lg(_mutex);
-    if (!_lastCommittedTransaction) {
-        _lastCommittedTransaction = LastCommittedTransaction();
-    }
-    _lastCommittedTransaction->setOperationCount(operationCount);
-    _lastCommittedTransaction->setOplogOperationBytes(oplogOperationBytes);
-    _lastCommittedTransaction->setWriteConcern(std::move(writeConcern));
+    _lastCommittedTransaction = std::move(lastCommitted);
 }
 
 void ServerTransactionsMetrics::updateStats(TransactionsStats* stats) {
@@ -173,9 +175,15 @@ void ServerTransactionsMetrics::updateStats(TransactionsStats* stats) {
     stats->setTotalPreparedThenAborted(_totalPreparedThenAborted.load());
     stats->setCurrentPrepared(_currentPrepared.load());
 
-    stdx::lock_guard<Latch> lg(_mutex);
-    if (_lastCommittedTransaction) {
-        stats->setLastCommittedTransaction(*_lastCommittedTransaction);
+    std::shared_ptr<const LastCommittedTransaction> lastCommitted;
+    {
+        stdx::lock_guard<Latch> lg(_mutex);
+        lastCommitted = _lastCommittedTransaction;
+    }
+    if (lastCommitted) {
+        // Copying the record (including its write concern document) happens outside the lock so
+        // serverStatus readers do not stall committing transactions.
+        stats->setLastCommittedTransaction(*lastCommitted);
     }
 }
 
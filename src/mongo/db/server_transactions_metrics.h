@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <memory>
 #include <set>
 
 #include "mongo/bson/timestamp.h"
@@ -128,10 +129,12 @@ private:
     // The current number of transactions in the prepared state.
     AtomicWord<unsigned long long> _currentPrepared{0};
 
-    // Protects member variables below.
+    // Protects the pointer below. Every committing transaction publishes a record here, so the
+    // record itself is built and read outside the critical section and the lock is only held for
+    // the pointer swap.
     mutable Mutex _mutex = MONGO_MAKE_LATCH("ServerTransactionsMetrics::_mutex");
 
-    boost::optional<LastCommittedTransaction> _lastCommittedTransaction;
+    std::shared_ptr<const LastCommittedTransaction> _lastCommittedTransaction;
 };
 
 }  // namespace mongo
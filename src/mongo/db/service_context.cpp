@@ -327,6 +327,19 @@ Client* ServiceContext::LockedClientsCursor::next() {
     return result;
 }
 
+ServiceContext::LockedActiveClientsCursor::LockedActiveClientsCursor(ServiceContext* service)
+    : _lock(service->_mutex),
+      _curr(service->_clientByOperationId.cbegin()),
+      _end(service->_clientByOperationId.cend()) {}
+
+Client* ServiceContext::LockedActiveClientsCursor::next() {
+    if (_curr == _end)
+        return nullptr;
+    Client* result = _curr->second;
+    ++_curr;
+    return result;
+}
+
 void ServiceContext::setKillAllOperations() {
     stdx::lock_guard<Latch> clientLock(_mutex);
 
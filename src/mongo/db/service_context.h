@@ -219,6 +219,29 @@ public:
         ClientSet::const_iterator _end;
     };
 
+    /**
+     * Cursor for enumerating only the Client objects that currently have an OperationContext.
+     *
+     * Enumerates the operation registry, which holds one entry per in-flight operation, rather
+     * than the full client list. currentOp-style reporting that excludes idle connections should
+     * prefer this cursor so its cost scales with the number of running operations instead of the
+     * number of connections.
+     */
+    class LockedActiveClientsCursor {
+    public:
+        explicit LockedActiveClientsCursor(ServiceContext* service);
+
+        /**
+         * Returns the next client with an active operation, or nullptr when there are no more.
+         */
+        Client* next();
+
+    private:
+        stdx::unique_lock<Latch> _lock;
+        stdx::unordered_map<OperationId, Client*>::const_iterator _curr;
+        stdx::unordered_map<OperationId, Client*>::const_iterator _end;
+    };
+
     /**
      * Special deleter used for cleaning up ServiceContext objects.
      * See UniqueServiceContext, below.
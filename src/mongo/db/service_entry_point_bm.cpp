@@ -0,0 +1,207 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <benchmark/benchmark.h>
+
+#include "mongo/db/auth/authorization_manager_impl.h"
+#include "mongo/db/auth/authz_manager_external_state_mock.h"
+#include "mongo/db/catalog/collection_impl.h"
+#include "mongo/db/catalog/database_holder_impl.h"
+#include "mongo/db/client.h"
+#include "mongo/db/index/index_access_method_factory_impl.h"
+#include "mongo/db/index_builds_coordinator_mongod.h"
+#include "mongo/db/logical_clock.h"
+#include "mongo/db/op_observer_registry.h"
+#include "mongo/db/repl/replication_coordinator_mock.h"
+#include "mongo/db/s/collection_sharding_state_factory_shard.h"
+#include "mongo/db/service_context.h"
+#include "mongo/db/service_entry_point_mongod.h"
+#include "mongo/db/storage/control/storage_control.h"
+#include "mongo/db/storage/storage_engine_init.h"
+#include "mongo/db/storage/storage_options.h"
+#include "mongo/rpc/op_msg.h"
+#include "mongo/transport/transport_layer_mock.h"
+#include "mongo/unittest/temp_dir.h"
+#include "mongo/util/periodic_runner_factory.h"
+
+namespace mongo {
+namespace {
+
+/**
+ * Drives ServiceEntryPointMongod::handleRequest() with synthetic OP_MSG traffic over a mock
+ * transport session, against the ephemeral_for_test storage engine. This measures the full
+ * ingress path for one operation -- message parse, command lookup, auth, dispatch, execution,
+ * and reply serialization -- so fixed per-op overhead regressions show up here regardless of
+ * which layer introduces them.
+ *
+ * The setup mirrors ServiceContextMongoDTest, but is built once and leaked because the storage
+ * engine and service context are process-global and benchmark functions may run repeatedly.
+ */
+class ServiceEntryPointBenchmarkFixture {
+public:
+    ServiceEntryPointBenchmarkFixture() : _tempDir("service_entry_point_bm") {
+        storageGlobalParams.engine = "ephemeralForTest";
+        storageGlobalParams.engineSetByUser = true;
+        storageGlobalParams.dbpath = _tempDir.path();
+
+        auto serviceContext = getGlobalServiceContext();
+        serviceContext->setServiceEntryPoint(
+            std::make_unique<ServiceEntryPointMongod>(serviceContext));
+        LogicalClock::set(serviceContext, std::make_unique<LogicalClock>(serviceContext));
+        serviceContext->setPeriodicRunner(makePeriodicRunner(serviceContext));
+        serviceContext->setOpObserver(std::make_unique<OpObserverRegistry>());
+
+        initializeStorageEngine(serviceContext,
+                                StorageEngineInitFlags::kAllowNoLockFile |
+                                    StorageEngineInitFlags::kSkipMetadataFile);
+        StorageControl::startStorageControls(serviceContext);
+
+        DatabaseHolder::set(serviceContext, std::make_unique<DatabaseHolderImpl>());
+        IndexAccessMethodFactory::set(serviceContext,
+                                      std::make_unique<IndexAccessMethodFactoryImpl>());
+        Collection::Factory::set(serviceContext, std::make_unique<CollectionImpl::FactoryImpl>());
+        IndexBuildsCoordinator::set(serviceContext,
+                                    std::make_unique<IndexBuildsCoordinatorMongod>());
+        CollectionShardingStateFactory::set(
+            serviceContext, std::make_unique<CollectionShardingStateFactoryShard>(serviceContext));
+
+        auto replCoord = std::make_unique<repl::ReplicationCoordinatorMock>(serviceContext);
+        invariant(replCoord->setFollowerMode(repl::MemberState::RS_PRIMARY));
+        repl::ReplicationCoordinator::set(serviceContext, std::move(replCoord));
+
+        // Auth stays disabled: the benchmark isolates dispatch and execution cost, and per-op ACL
+        // resolution has its own coverage.
+        auto authzManager = std::make_unique<AuthorizationManagerImpl>(
+            serviceContext, std::make_unique<AuthzManagerExternalStateMock>());
+        authzManager->setAuthEnabled(false);
+        AuthorizationManager::set(serviceContext, std::move(authzManager));
+
+        _session = _transportLayer.createSession();
+        _client = serviceContext->makeClient("service_entry_point_bm", _session);
+
+        // Seed the collection the find benchmarks read from.
+        for (int i = 0; i < kSeededDocuments; ++i) {
+            runCommandChecked("test",
+                              BSON("insert" << kCollectionName << "documents"
+                                            << BSON_ARRAY(BSON("_id" << i << "payload"
+                                                                     << "abcdefghijklmnop"))));
+        }
+    }
+
+    static constexpr auto kCollectionName = "service_entry_point_bm";
+    static constexpr int kSeededDocuments = 1000;
+
+    /**
+     * Serializes 'body' as an OP_MSG against 'db' and pushes it through the service entry point,
+     * returning the reply body. A fresh OperationContext per call is part of the real per-op path.
+     */
+    BSONObj runCommand(StringData db, const BSONObj& body) {
+        auto opCtx = getGlobalServiceContext()->makeOperationContext(_client.get());
+        auto message = OpMsgRequest::fromDBAndBody(db, body).serialize();
+        auto dbResponse =
+            getGlobalServiceContext()->getServiceEntryPoint()->handleRequest(opCtx.get(), message);
+        return OpMsg::parse(dbResponse.response).body;
+    }
+
+    void runCommandChecked(StringData db, const BSONObj& body) {
+        auto reply = runCommand(db, body);
+        invariant(reply["ok"].trueValue(), reply.toString());
+    }
+
+private:
+    unittest::TempDir _tempDir;
+    transport::TransportLayerMock _transportLayer;
+    transport::SessionHandle _session;
+    ServiceContext::UniqueClient _client;
+};
+
+ServiceEntryPointBenchmarkFixture& fixture() {
+    static auto* instance = new ServiceEntryPointBenchmarkFixture();
+    return *instance;
+}
+
+void runBenchmark(benchmark::State& state, StringData db, const BSONObj& body) {
+    auto& fix = fixture();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(fix.runCommand(db, body));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_SEP_Ping(benchmark::State& state) {
+    runBenchmark(state, "admin", BSON("ping" << 1));
+}
+
+void BM_SEP_IsMaster(benchmark::State& state) {
+    runBenchmark(state, "admin", BSON("isMaster" << 1));
+}
+
+void BM_SEP_BuildInfo(benchmark::State& state) {
+    runBenchmark(state, "admin", BSON("buildinfo" << 1));
+}
+
+void BM_SEP_FindOneById(benchmark::State& state) {
+    runBenchmark(state,
+                 "test",
+                 BSON("find" << ServiceEntryPointBenchmarkFixture::kCollectionName << "filter"
+                             << BSON("_id" << 42) << "limit" << 1 << "singleBatch" << true));
+}
+
+void BM_SEP_FindEmptyBatch(benchmark::State& state) {
+    runBenchmark(state,
+                 "test",
+                 BSON("find" << ServiceEntryPointBenchmarkFixture::kCollectionName << "filter"
+                             << BSON("_id" << -1) << "limit" << 1 << "singleBatch" << true));
+}
+
+void BM_SEP_InsertOne(benchmark::State& state) {
+    auto& fix = fixture();
+    // Distinct _ids keep every iteration on the insert fast path rather than DuplicateKey.
+    long long id = 1'000'000'000LL;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            fix.runCommand("test",
+                           BSON("insert"
+                                << "service_entry_point_bm_inserts"
+                                << "documents" << BSON_ARRAY(BSON("_id" << id++)))));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_SEP_Ping);
+BENCHMARK(BM_SEP_IsMaster);
+BENCHMARK(BM_SEP_BuildInfo);
+BENCHMARK(BM_SEP_FindOneById);
+BENCHMARK(BM_SEP_FindEmptyBatch);
+BENCHMARK(BM_SEP_InsertOne);
+
+}  // namespace
+}  // namespace mongo
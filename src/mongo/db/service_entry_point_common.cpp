@@ -37,6 +37,7 @@
 #include "mongo/bson/mutable/document.h"
 #include "mongo/bson/util/bson_extract.h"
 #include "mongo/client/server_is_master_monitor.h"
+#include "mongo/db/admission_control.h"
 #include "mongo/db/audit.h"
 #include "mongo/db/auth/authorization_session.h"
 #include "mongo/db/auth/impersonation_session.h"
@@ -62,6 +63,8 @@
 #include "mongo/db/ops/write_ops.h"
 #include "mongo/db/ops/write_ops_exec.h"
 #include "mongo/db/query/find.h"
+#include "mongo/db/query_result_cache.h"
+#include "mongo/db/query_result_cache_gen.h"
 #include "mongo/db/read_concern.h"
 #include "mongo/db/read_write_concern_defaults.h"
 #include "mongo/db/repl/optime.h"
@@ -87,11 +90,13 @@
 #include "mongo/rpc/get_status_from_command_result.h"
 #include "mongo/rpc/message.h"
 #include "mongo/rpc/metadata.h"
+#include "mongo/rpc/metadata/client_metadata_ismaster.h"
 #include "mongo/rpc/metadata/logical_time_metadata.h"
 #include "mongo/rpc/metadata/oplog_query_metadata.h"
 #include "mongo/rpc/metadata/repl_set_metadata.h"
 #include "mongo/rpc/metadata/tracking_metadata.h"
 #include "mongo/rpc/op_msg.h"
+#include "mongo/rpc/op_msg_rpc_impls.h"
 #include "mongo/rpc/reply_builder_interface.h"
 #include "mongo/transport/ismaster_metrics.h"
 #include "mongo/transport/session.h"
@@ -99,6 +104,8 @@
 #include "mongo/util/fail_point.h"
 #include "mongo/util/scopeguard.h"
 
+#include <algorithm>
+
 #include <fmt/format.h>
 
 using namespace fmt::literals;
@@ -127,6 +134,23 @@ ServerStatusMetricField<Counter64> displayNotMasterUnackWrites(
 
 namespace {
 
+// Tracks the largest command reply this client has produced so the next reply's buffer can be
+// sized to fit without repeated realloc-and-copy growth. Capped so a single jumbo reply doesn't
+// pin a large allocation for the lifetime of the connection.
+constexpr std::size_t kMaxReplySizeHint = 256 * 1024;
+const auto replySizeHighWaterMark = Client::declareDecoration<std::size_t>();
+
+// A per-client OP_MSG reply builder recycled across commands so that small commands (driver
+// heartbeats in particular) don't heap-allocate a fresh builder per request. The buffer itself
+// is always released into the outgoing Message, so only the builder object is reused. The inUse
+// flag guards against nested command dispatch on the same client (e.g. via DBDirectClient),
+// which falls back to an owned builder.
+struct ReusableReplyBuilder {
+    rpc::OpMsgReplyBuilder builder;
+    bool inUse = false;
+};
+const auto reusableReplyBuilder = Client::declareDecoration<ReusableReplyBuilder>();
+
 void generateLegacyQueryErrorResponse(const AssertionException& exception,
                                       const QueryMessage& queryMessage,
                                       CurOp* curop,
@@ -683,6 +707,60 @@ void invokeWithSessionCheckedOut(OperationContext* opCtx,
     }
 }
 
+/**
+ * Builds the query result cache key for an eligible read command, or boost::none when the
+ * command or session state is not cacheable. Generic arguments other than readConcern do not
+ * affect the result and are excluded from the key.
+ */
+boost::optional<BSONObj> makeResultCacheKey(OperationContext* opCtx,
+                                            const CommandInvocation* invocation,
+                                            const OpMsgRequest& request) {
+    if (gQueryResultCacheTTLSeconds.load() <= 0) {
+        return boost::none;
+    }
+    const auto cmdName = request.getCommandName();
+    if (cmdName != "find" && cmdName != "aggregate") {
+        return boost::none;
+    }
+    if (opCtx->inMultiDocumentTransaction() || opCtx->getClient()->isInDirectClient()) {
+        return boost::none;
+    }
+    const auto& nss = invocation->ns();
+    if (!nss.isValid() || nss.isCollectionlessCursorNamespace()) {
+        return boost::none;
+    }
+
+    BSONObjBuilder bob;
+    for (auto&& elem : request.body) {
+        if (CommandHelpers::isGenericArgument(elem.fieldNameStringData()) &&
+            elem.fieldNameStringData() != repl::ReadConcernArgs::kReadConcernFieldName) {
+            continue;
+        }
+        bob.append(elem);
+    }
+    return bob.obj();
+}
+
+/**
+ * Returns true if 'body' is a successful command reply whose cursor was exhausted in the first
+ * batch, i.e. a complete result that can be replayed to an identical request. At the point this
+ * runs the reply has not been finalized yet, so a successful reply does not carry an 'ok' field
+ * ('ok' is appended by extractOrAppendOk afterwards, and likewise when a cached body is
+ * replayed); only an explicit falsy 'ok' written by the command itself indicates failure.
+ */
+bool isCacheableResultBody(const BSONObj& body) {
+    auto okField = body["ok"];
+    if (!okField.eoo() && !okField.trueValue()) {
+        return false;
+    }
+    auto cursor = body["cursor"];
+    if (cursor.type() != BSONType::Object) {
+        return false;
+    }
+    auto id = cursor.Obj()["id"];
+    return id.isNumber() && id.numberLong() == 0;
+}
+
 bool runCommandImpl(OperationContext* opCtx,
                     CommandInvocation* invocation,
                     const OpMsgRequest& request,
@@ -843,7 +921,23 @@ bool runCommandImpl(OperationContext* opCtx,
         if (shouldCheckOutSession) {
             invokeWithSessionCheckedOut(opCtx, request, invocation, sessionOptions, replyBuilder);
         } else {
-            CommandHelpers::runCommandInvocation(opCtx, request, invocation, replyBuilder);
+            auto cacheKey = makeResultCacheKey(opCtx, invocation, request);
+            boost::optional<BSONObj> cachedReply;
+            if (cacheKey) {
+                cachedReply = QueryResultCache::get().lookup(request.getDatabase(), *cacheKey);
+            }
+            if (cachedReply) {
+                replyBuilder->setCommandReply(*cachedReply);
+            } else {
+                CommandHelpers::runCommandInvocation(opCtx, request, invocation, replyBuilder);
+                if (cacheKey) {
+                    auto body = replyBuilder->getBodyBuilder().asTempObj();
+                    if (isCacheableResultBody(body)) {
+                        QueryResultCache::get().store(
+                            request.getDatabase(), *cacheKey, invocation->ns().ns(), body);
+                    }
+                }
+            }
         }
     }
 
@@ -899,6 +993,37 @@ bool runCommandImpl(OperationContext* opCtx,
     return ok;
 }
 
+/**
+ * Commands exempt from admission control: the connection-establishment commands drivers run
+ * before client metadata is in hand, and the commands operators rely on to observe and recover an
+ * overloaded node.
+ */
+bool isAdmissionExemptCommand(StringData name) {
+    static const StringMap<int> exempt = {{"isMaster", 1},
+                                          {"ismaster", 1},
+                                          {"ping", 1},
+                                          {"buildInfo", 1},
+                                          {"buildinfo", 1},
+                                          {"saslStart", 1},
+                                          {"saslContinue", 1},
+                                          {"authenticate", 1},
+                                          {"logout", 1},
+                                          {"killOp", 1},
+                                          {"currentOp", 1},
+                                          {"serverStatus", 1},
+                                          {"endSessions", 1}};
+    return exempt.count(name) > 0;
+}
+
+/**
+ * Returns the admission class for the client's operations: the application name from the driver's
+ * client metadata, or an empty string (bypassing admission) when the client supplied none.
+ */
+StringData admissionClassForClient(Client* client) {
+    const auto& clientMetadata = ClientMetadataIsMasterState::get(client).getClientMetadata();
+    return clientMetadata ? clientMetadata->getApplicationName() : StringData();
+}
+
 /**
  * Executes a command after stripping metadata, performing authorization checks,
  * handling audit impersonation, and (potentially) setting maintenance mode. This method
@@ -1015,6 +1140,16 @@ void execCommandDatabase(OperationContext* opCtx,
         ImpersonationSessionGuard guard(opCtx);
         invocation->checkAuthorization(opCtx, request);
 
+        // Admit the operation into its class's share of the node after authorization so that
+        // unauthenticated traffic cannot occupy admission slots. The ticket spans the rest of the
+        // command's execution.
+        AdmissionControl::Ticket admissionTicket;
+        if (!isInternalClient && !opCtx->getClient()->isInDirectClient() &&
+            !isAdmissionExemptCommand(command->getName())) {
+            admissionTicket = AdmissionControl::get(opCtx->getServiceContext())
+                                  .admit(opCtx, admissionClassForClient(opCtx->getClient()));
+        }
+
         const bool iAmPrimary = replCoord->canAcceptWritesForDatabase_UNSAFE(opCtx, dbname);
 
         if (!opCtx->getClient()->isInDirectClient() &&
@@ -1294,7 +1429,27 @@ void curOpCommandSetup(OperationContext* opCtx, const OpMsgRequest& request) {
 DbResponse receivedCommands(OperationContext* opCtx,
                             const Message& message,
                             const ServiceEntryPointCommon::Hooks& behaviors) {
-    auto replyBuilder = rpc::makeReplyBuilder(rpc::protocolForMessage(message));
+    const auto protocol = rpc::protocolForMessage(message);
+    const auto replySizeHint = replySizeHighWaterMark(opCtx->getClient());
+    auto& reusable = reusableReplyBuilder(opCtx->getClient());
+    std::unique_ptr<rpc::ReplyBuilderInterface> ownedReplyBuilder;
+    rpc::ReplyBuilderInterface* replyBuilder;
+    if (protocol == rpc::Protocol::kOpMsg && !reusable.inUse) {
+        reusable.inUse = true;
+        reusable.builder.reset();
+        if (replySizeHint) {
+            reusable.builder.reserveBytes(replySizeHint);
+        }
+        replyBuilder = &reusable.builder;
+    } else {
+        ownedReplyBuilder = rpc::makeReplyBuilder(protocol, replySizeHint);
+        replyBuilder = ownedReplyBuilder.get();
+    }
+    ON_BLOCK_EXIT([&] {
+        if (replyBuilder == &reusable.builder) {
+            reusable.inUse = false;
+        }
+    });
     OpMsgRequest request;
     Command* c = nullptr;
     [&] {
@@ -1322,7 +1477,7 @@ DbResponse receivedCommands(OperationContext* opCtx,
                         "error"_attr = ex.toString());
 
             generateErrorResponse(
-                opCtx, replyBuilder.get(), ex, metadataBob.obj(), extraFieldsBuilder.obj());
+                opCtx, replyBuilder, ex, metadataBob.obj(), extraFieldsBuilder.obj());
 
             return;  // From lambda. Don't try executing if parsing failed.
         }
@@ -1346,6 +1501,12 @@ DbResponse receivedCommands(OperationContext* opCtx,
                 uasserted(ErrorCodes::CommandNotFound, str::stream() << msg);
             }
 
+            // Now that the command is known, top the reply buffer up to this command's learned
+            // reply size if it exceeds what the per-client high-water mark already reserved.
+            if (const auto commandHint = c->replySizeHint(); commandHint > replySizeHint) {
+                replyBuilder->reserveBytes(commandHint - replySizeHint);
+            }
+
             LOGV2_DEBUG(21965,
                         2,
                         "Run command {db}.$cmd {commandArgs}",
@@ -1370,7 +1531,7 @@ DbResponse receivedCommands(OperationContext* opCtx,
                 }
             }
 
-            execCommandDatabase(opCtx, c, request, replyBuilder.get(), behaviors);
+            execCommandDatabase(opCtx, c, request, replyBuilder, behaviors);
         } catch (const DBException& ex) {
             BSONObjBuilder metadataBob;
             behaviors.appendReplyMetadataOnError(opCtx, &metadataBob);
@@ -1388,7 +1549,7 @@ DbResponse receivedCommands(OperationContext* opCtx,
                         "error"_attr = ex.toString());
 
             generateErrorResponse(
-                opCtx, replyBuilder.get(), ex, metadataBob.obj(), extraFieldsBuilder.obj());
+                opCtx, replyBuilder, ex, metadataBob.obj(), extraFieldsBuilder.obj());
 
             if (ErrorCodes::isA<ErrorCategory::CloseConnectionError>(ex.code())) {
                 // Rethrow the exception to the top to signal that the client connection should be
@@ -1426,6 +1587,14 @@ DbResponse receivedCommands(OperationContext* opCtx,
     dbResponse.response = replyBuilder->done();
     CurOp::get(opCtx)->debug().responseLength = dbResponse.response.header().dataLen();
 
+    auto& replyHwm = replySizeHighWaterMark(opCtx->getClient());
+    replyHwm = std::min(kMaxReplySizeHint,
+                        std::max(replyHwm, static_cast<std::size_t>(dbResponse.response.size())));
+
+    if (c) {
+        c->recordReplySize(static_cast<std::size_t>(dbResponse.response.size()));
+    }
+
     return dbResponse;
 }
 
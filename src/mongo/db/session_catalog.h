@@ -91,13 +91,12 @@ public:
     SessionToKill checkOutSessionForKill(OperationContext* opCtx, KillToken killToken);
 
     /**
-     * Iterates through the SessionCatalog under the SessionCatalog mutex and applies 'workerFn' to
-     * each Session which matches the specified 'matcher'.
+     * Iterates through the SessionCatalog under the session shard mutexes and applies 'workerFn'
+     * to each Session which matches the specified 'matcher'. Shards are visited one at a time, so
+     * the scan observes each session atomically, but not the catalog as a whole.
      *
-     * NOTE: Since this method runs with the session catalog mutex, the work done by 'workerFn' is
+     * NOTE: Since this method runs with a shard mutex held, the work done by 'workerFn' is
      * not allowed to block, perform I/O or acquire any lock manager locks.
-     * Iterates through the SessionCatalog and applies 'workerFn' to each Session. This locks the
-     * SessionCatalog.
      */
     using ScanSessionsCallbackFn = std::function<void(ObservableSession&)>;
     void scanSession(const LogicalSessionId& lsid, const ScanSessionsCallbackFn& workerFn);
@@ -105,7 +104,7 @@ public:
                       const ScanSessionsCallbackFn& workerFn);
 
     /**
-     * Shortcut to invoke 'kill' on the specified session under the SessionCatalog mutex. Throws a
+     * Shortcut to invoke 'kill' on the specified session under its shard mutex. Throws a
      * NoSuchSession exception if the session doesn't exist.
      */
     KillToken killSession(const LogicalSessionId& lsid);
@@ -129,23 +128,42 @@ private:
         // sessions entries from the map.
         int numWaitingToCheckOut{0};
 
-        // Signaled when the state becomes available. Uses the transaction table's mutex to protect
+        // Signaled when the state becomes available. Uses the owning shard's mutex to protect
         // the state transitions.
         stdx::condition_variable availableCondVar;
     };
     using SessionRuntimeInfoMap = LogicalSessionIdMap<std::unique_ptr<SessionRuntimeInfo>>;
 
+    // The session map is sharded by logical session id so checkouts of distinct sessions do not
+    // serialize on a single catalog-wide mutex. Each shard's mutex protects its portion of the
+    // map and the state transitions of the sessions it owns; shard mutexes are never held
+    // together, and catalog-wide operations visit the shards one at a time.
+    struct SessionShard {
+        mutable Mutex mutex = MONGO_MAKE_LATCH(HierarchicalAcquisitionLevel(0),
+                                               "SessionCatalog::SessionShard::mutex");
+
+        // Owns the Session objects for the sessions hashing to this shard.
+        SessionRuntimeInfoMap sessions;
+    };
+
+    static constexpr size_t kNumShards = 16;
+
     /**
      * Blocking method, which checks-out the session set on 'opCtx'.
      */
     ScopedCheckedOutSession _checkOutSession(OperationContext* opCtx);
 
     /**
-     * Creates or returns the session runtime info for 'lsid' from the '_sessions' map. The returned
-     * pointer is guaranteed to be linked on the map for as long as the mutex is held.
+     * Returns the shard which owns (or would own) the runtime state for 'lsid'.
+     */
+    SessionShard& _shardFor(const LogicalSessionId& lsid) const;
+
+    /**
+     * Creates or returns the session runtime info for 'lsid' from 'shard'. The returned pointer
+     * is guaranteed to be linked on the shard's map for as long as the shard's mutex is held.
      */
     SessionRuntimeInfo* _getOrCreateSessionRuntimeInfo(WithLock,
-                                                       OperationContext* opCtx,
+                                                       SessionShard& shard,
                                                        const LogicalSessionId& lsid);
 
     /**
@@ -153,12 +171,7 @@ private:
      */
     void _releaseSession(SessionRuntimeInfo* sri, boost::optional<KillToken> killToken);
 
-    // Protects the state below
-    mutable Mutex _mutex =
-        MONGO_MAKE_LATCH(HierarchicalAcquisitionLevel(0), "SessionCatalog::_mutex");
-
-    // Owns the Session objects for all current Sessions.
-    SessionRuntimeInfoMap _sessions;
+    mutable SessionShard _shards[kNumShards];
 };
 
 /**
@@ -242,8 +255,8 @@ using SessionToKill = SessionCatalog::SessionToKill;
 /**
  * This type represents access to a session inside of a scanSessions loop.
  * If you have one of these, you're in a scanSessions callback context, and so
- * have locked the whole catalog and, if the observed session is bound to an operation context,
- * you hold that operation context's client's mutex, as well.
+ * have locked the catalog shard owning the observed session and, if the observed session is bound
+ * to an operation context, you hold that operation context's client's mutex, as well.
  */
 class ObservableSession {
 public:
@@ -189,6 +189,21 @@ void createTransactionTable(OperationContext* opCtx) {
                       << NamespaceString::kSessionTransactionsTableNamespace.ns() << " collection");
 }
 
+void createRetryableFindAndModifyTable(OperationContext* opCtx) {
+    auto serviceCtx = opCtx->getServiceContext();
+    CollectionOptions options;
+    auto status = repl::StorageInterface::get(serviceCtx)
+                      ->createCollection(opCtx, NamespaceString::kConfigImagesNamespace, options);
+    if (status == ErrorCodes::NamespaceExists) {
+        return;
+    }
+
+    uassertStatusOKWithContext(status,
+                               str::stream()
+                                   << "Failed to create the "
+                                   << NamespaceString::kConfigImagesNamespace.ns() << " collection");
+}
+
 void abortInProgressTransactions(OperationContext* opCtx) {
     DBDirectClient client(opCtx);
     Query query(BSON(SessionTxnRecord::kStateFieldName
@@ -266,6 +281,7 @@ void MongoDSessionCatalog::onStepUp(OperationContext* opCtx) {
     abortInProgressTransactions(opCtx);
 
     createTransactionTable(opCtx);
+    createRetryableFindAndModifyTable(opCtx);
 }
 
 boost::optional<UUID> MongoDSessionCatalog::getTransactionTableUUID(OperationContext* opCtx) {
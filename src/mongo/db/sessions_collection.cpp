@@ -38,11 +38,13 @@
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/client/dbclient_base.h"
 #include "mongo/db/create_indexes_gen.h"
+#include "mongo/db/logical_session_cache_gen.h"
 #include "mongo/db/logical_session_id.h"
 #include "mongo/db/ops/write_ops.h"
 #include "mongo/db/repl/read_concern_args.h"
 #include "mongo/rpc/get_status_from_command_result.h"
 #include "mongo/s/write_ops/batched_command_response.h"
+#include "mongo/util/time_support.h"
 
 namespace mongo {
 namespace {
@@ -55,6 +57,11 @@ namespace {
 // comfortably be able to stay under, even with 10k user names.
 constexpr size_t kMaxBatchSize = 1000;
 
+// Write commands are batched by accumulated size rather than by a fixed element count, flushing
+// with enough headroom under the 16mb limit that the outer command fields always fit. The entry
+// count is still capped at the server's write batch limit.
+constexpr size_t kMaxBatchByteSize = 14 * 1024 * 1024;
+
 // Used to refresh or remove items from the session collection with write
 // concern majority
 const WriteConcernOptions kMajorityWriteConcern{WriteConcernOptions::kMajority,
@@ -132,16 +139,33 @@ void runBulkCmd(StringData label,
         batchBuilder.emplace(buf);
         initBatch(&(batchBuilder.get()));
         entries.emplace(batchBuilder->subarrayStart(label));
-
-        return &(entries.get());
     };
 
-    auto sendLocalBatch = [&](BSONArrayBuilder*) {
+    auto sendLocalBatch = [&] {
         entries->done();
         sendBatch(batchBuilder->done());
     };
 
-    runBulkGeneric(makeBatch, addLine, sendLocalBatch, items);
+    size_t i = 0;
+    makeBatch();
+
+    for (const auto& item : items) {
+        addLine(&(entries.get()), item);
+
+        // Flush when the accumulated command approaches the BSON size limit or reaches the
+        // server's write batch limit, whichever comes first.
+        if (++i >= write_ops::kMaxWriteBatchSize ||
+            static_cast<size_t>(buf.len()) >= kMaxBatchByteSize) {
+            sendLocalBatch();
+
+            i = 0;
+            makeBatch();
+        }
+    }
+
+    if (i > 0) {
+        sendLocalBatch();
+    }
 }
 
 }  // namespace
@@ -205,7 +229,20 @@ void SessionsCollection::_doRefresh(const NamespaceString& ns,
             BSON("q" << lsidQuery(record) << "u" << updateQuery(record) << "upsert" << true));
     };
 
-    runBulkCmd("updates", init, add, send, sessions);
+    // Optionally pace the refresh batches instead of issuing them back-to-back, so flushing a
+    // large active-session set does not disturb the latency of concurrent user writes.
+    bool firstBatch = true;
+    auto pacedSend = [&](BSONObj batch) {
+        if (!firstBatch) {
+            if (auto delay = logicalSessionRefreshBatchDelayMillis) {
+                sleepmillis(delay);
+            }
+        }
+        firstBatch = false;
+        send(batch);
+    };
+
+    runBulkCmd("updates", init, add, pacedSend, sessions);
 }
 
 void SessionsCollection::_doRemove(const NamespaceString& ns,
@@ -111,6 +111,17 @@ struct SnapshotWindowParams {
         observeCheckCachePressurePeriodSeconds;
 
     AtomicWord<std::int64_t> snapshotTooOldErrorCount{0};
+
+    // Number of times the target window was widened preemptively, at the start of a point-in-time
+    // read, rather than in reaction to a SnapshotTooOld error. Used for statistics purposes.
+    AtomicWord<std::int64_t> preemptiveSnapshotWindowIncreaseCount{0};
+
+    // How fast the majority commit point has recently been advancing, in timestamp-seconds per
+    // wall-clock second. Sampled by the periodic cache pressure task. A rate near 1 means the
+    // commit point tracks the wall clock, so a fixed-size window is consumed underneath a
+    // long-running snapshot read; a rate near 0 means snapshots barely age. Used to decide whether
+    // preemptively widening the window is worthwhile, and reported for statistics purposes.
+    AtomicDouble observedCommitPointAdvancementRate{0.0};
 };
 
 extern SnapshotWindowParams snapshotWindowParams;
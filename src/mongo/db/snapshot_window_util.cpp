@@ -35,6 +35,7 @@
 
 #include "mongo/db/commands/test_commands_enabled.h"
 #include "mongo/db/operation_context.h"
+#include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/snapshot_window_options.h"
 #include "mongo/db/storage/storage_engine.h"
@@ -59,6 +60,17 @@ Mutex snapshotWindowMutex;
 
 namespace {
 
+// Minimum observed commit point advancement rate, in timestamp-seconds per wall-clock second, at
+// which preWidenSnapshotWindowForSnapshotRead() will widen the window. Below this rate, snapshots
+// age so slowly that the reactive SnapshotTooOld handling suffices.
+constexpr double kMinCommitPointRateForPreemptiveIncrease = 0.5;
+
+// Tracks the last time that the snapshot window was increased so that it does not go up so fast
+// that the storage engine does not have time to improve snapshot availability. Shared between the
+// reactive and preemptive increase paths so that together they respect
+// minMillisBetweenSnapshotWindowInc.
+Date_t _snapshotWindowLastIncreasedAt{Date_t::min()};
+
 void _decreaseTargetSnapshotWindowSize(WithLock lock, OperationContext* opCtx) {
     // Tracks the last time that the snapshot window was decreased so that it does not go down so
     // fast that the system does not have time to react and reduce snapshot availability.
@@ -94,10 +106,6 @@ void increaseTargetSnapshotWindowSize(OperationContext* opCtx) {
 
     stdx::unique_lock<Latch> lock(snapshotWindowMutex);
 
-    // Tracks the last time that the snapshot window was increased so that it does not go up so fast
-    // that the storage engine does not have time to improve snapshot availability.
-    static Date_t _snapshotWindowLastIncreasedAt{Date_t::min()};
-
     if (_snapshotWindowLastIncreasedAt >
         (Date_t::now() -
          Milliseconds(snapshotWindowParams.minMillisBetweenSnapshotWindowInc.load()))) {
@@ -165,6 +173,87 @@ void decreaseTargetSnapshotWindowSize(OperationContext* opCtx) {
     }
 }
 
+void preWidenSnapshotWindowForSnapshotRead(OperationContext* opCtx) {
+    if (MONGO_unlikely(preventDynamicSnapshotHistoryWindowTargetAdjustments.shouldFail())) {
+        return;
+    }
+
+    // Cheap atomic checks first, before the mutex: most snapshot reads should find nothing to do.
+    // On an idle or trickle-write system the commit point barely advances, so the window is not
+    // being consumed underneath readers and widening it would only hold more history.
+    if (snapshotWindowParams.observedCommitPointAdvancementRate.load() <
+        kMinCommitPointRateForPreemptiveIncrease) {
+        return;
+    }
+
+    if (snapshotWindowParams.targetSnapshotHistoryWindowInSeconds.load() >=
+        snapshotWindowParams.maxTargetSnapshotHistoryWindowInSeconds.load()) {
+        return;
+    }
+
+    stdx::unique_lock<Latch> lock(snapshotWindowMutex, stdx::try_to_lock);
+    if (!lock.owns_lock()) {
+        // Another thread is already adjusting the window; its adjustment covers this reader too.
+        return;
+    }
+
+    if (_snapshotWindowLastIncreasedAt >
+        (Date_t::now() -
+         Milliseconds(snapshotWindowParams.minMillisBetweenSnapshotWindowInc.load()))) {
+        // We have already increased the window size in the last minMillisBetweenSnapshotWindowInc
+        // milliseconds.
+        return;
+    }
+
+    // Unlike increaseTargetSnapshotWindowSize(), quietly leave the window alone under cache
+    // pressure rather than logging or shrinking it: no error has occurred yet on this path, and the
+    // periodic cache pressure task handles any shrinking that is needed.
+    StorageEngine* engine = opCtx->getServiceContext()->getStorageEngine();
+    if (engine && engine->isCacheUnderPressure(opCtx)) {
+        return;
+    }
+
+    int increasedSnapshotWindow = snapshotWindowParams.targetSnapshotHistoryWindowInSeconds.load() +
+        snapshotWindowParams.snapshotWindowAdditiveIncreaseSeconds.load();
+    snapshotWindowParams.targetSnapshotHistoryWindowInSeconds.store(
+        std::min(increasedSnapshotWindow,
+                 snapshotWindowParams.maxTargetSnapshotHistoryWindowInSeconds.load()));
+    snapshotWindowParams.preemptiveSnapshotWindowIncreaseCount.addAndFetch(1);
+
+    _snapshotWindowLastIncreasedAt = Date_t::now();
+}
+
+void recordCommitPointAdvancement(OperationContext* opCtx) {
+    auto replCoord = repl::ReplicationCoordinator::get(opCtx);
+    if (!replCoord ||
+        replCoord->getReplicationMode() != repl::ReplicationCoordinator::modeReplSet) {
+        return;
+    }
+
+    const Timestamp commitPoint = replCoord->getLastCommittedOpTime().getTimestamp();
+    const Date_t now = Date_t::now();
+
+    // Guards the sampling state below. Only the periodic cache pressure task calls this function,
+    // but take the mutex for consistency with the rest of the window adjustment machinery.
+    stdx::unique_lock<Latch> lock(snapshotWindowMutex);
+
+    static Timestamp _lastSampledCommitPoint;
+    static Date_t _lastSampledAt{Date_t::min()};
+
+    if (_lastSampledAt == Date_t::min() || commitPoint < _lastSampledCommitPoint) {
+        // First sample, or the commit point moved backwards (e.g. after a rollback): restart
+        // sampling rather than report a garbage rate.
+        snapshotWindowParams.observedCommitPointAdvancementRate.store(0.0);
+    } else if (now > _lastSampledAt) {
+        double wallSeconds = durationCount<Milliseconds>(now - _lastSampledAt) / 1000.0;
+        double commitSeconds = commitPoint.getSecs() - _lastSampledCommitPoint.getSecs();
+        snapshotWindowParams.observedCommitPointAdvancementRate.store(commitSeconds / wallSeconds);
+    }
+
+    _lastSampledCommitPoint = commitPoint;
+    _lastSampledAt = now;
+}
+
 void incrementSnapshotTooOldErrorCount() {
     snapshotWindowParams.snapshotTooOldErrorCount.addAndFetch(1);
 }
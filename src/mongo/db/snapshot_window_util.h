@@ -74,6 +74,30 @@ void increaseTargetSnapshotWindowSize(OperationContext* opCtx);
  */
 void decreaseTargetSnapshotWindowSize(OperationContext* opCtx);
 
+/**
+ * Attempts to widen the snapshot window ahead of a point-in-time read, so that a long-running scan
+ * does not have to fail with SnapshotTooOld before the window grows. Called when a plan executor
+ * is constructed for a readConcern level 'snapshot' operation.
+ *
+ * The window is only widened when the majority commit point has recently been advancing at close
+ * to wall-clock rate (per recordCommitPointAdvancement() below), which is when a snapshot ages out
+ * of a fixed-size window while a scan is still using it; on an idle or trickle-write system the
+ * window does not move and widening it would only hold more history. The attempt is further
+ * subject to the same cache pressure and rate limits as increaseTargetSnapshotWindowSize(), but
+ * never decreases the window and never logs: failing to pre-widen is not an error, it just leaves
+ * the reactive path to deal with any SnapshotTooOld errors. Designed to be cheap enough to call
+ * on every snapshot read.
+ */
+void preWidenSnapshotWindowForSnapshotRead(OperationContext* opCtx);
+
+/**
+ * Samples the majority commit point and updates the observed advancement rate that
+ * preWidenSnapshotWindowForSnapshotRead() consults. Called from the periodic task that also checks
+ * for cache pressure. A no-op when the node is not a replica set member. The rate resets to zero
+ * on the first sample and whenever the commit point moves backwards (e.g. after a rollback).
+ */
+void recordCommitPointAdvancement(OperationContext* opCtx);
+
 /**
  * Increments a counter of SnapshotTooOld errors encountered in the command layer. Used for
  * statistics purposes. Continuing SnapshotTooOld errors can indicate cache pressure.
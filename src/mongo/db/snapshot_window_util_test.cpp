@@ -162,6 +162,71 @@ TEST_F(SnapshotWindowTest, DecreaseAndIncreaseSnapshotWindow) {
     ASSERT_EQ(snapshotWindowSecondsFive, maxTargetSnapshotWindowSeconds);
 }
 
+TEST_F(SnapshotWindowTest, PreemptiveWindowIncreaseRequiresCommitPointAdvancement) {
+    auto engine = getServiceContext()->getStorageEngine();
+    invariant(engine);
+
+    snapshotWindowParams.maxTargetSnapshotHistoryWindowInSeconds.store(100);
+    snapshotWindowParams.targetSnapshotHistoryWindowInSeconds.store(50);
+    snapshotWindowParams.snapshotWindowAdditiveIncreaseSeconds.store(2);
+    snapshotWindowParams.minMillisBetweenSnapshotWindowInc.store(100);
+
+    auto cachePressureThreshold = snapshotWindowParams.cachePressureThreshold.load();
+    auto minTimeBetweenInc = snapshotWindowParams.minMillisBetweenSnapshotWindowInc.load();
+    auto windowAdditiveIncrease = snapshotWindowParams.snapshotWindowAdditiveIncreaseSeconds.load();
+
+    engine->setCachePressureForTest(cachePressureThreshold - 5);
+
+    /**
+     * Test that no increase occurs when the commit point is not advancing.
+     */
+
+    snapshotWindowParams.observedCommitPointAdvancementRate.store(0.0);
+
+    sleepmillis(2 * minTimeBetweenInc);
+    auto snapshotWindowSeconds = snapshotWindowParams.targetSnapshotHistoryWindowInSeconds.load();
+    auto preemptiveIncreaseCount =
+        snapshotWindowParams.preemptiveSnapshotWindowIncreaseCount.load();
+
+    preWidenSnapshotWindowForSnapshotRead(_opCtx.get());
+
+    ASSERT_EQ(snapshotWindowSeconds,
+              snapshotWindowParams.targetSnapshotHistoryWindowInSeconds.load());
+    ASSERT_EQ(preemptiveIncreaseCount,
+              snapshotWindowParams.preemptiveSnapshotWindowIncreaseCount.load());
+
+    /**
+     * Test that the window increases when the commit point tracks the wall clock.
+     */
+
+    snapshotWindowParams.observedCommitPointAdvancementRate.store(1.0);
+
+    sleepmillis(2 * minTimeBetweenInc);
+    preWidenSnapshotWindowForSnapshotRead(_opCtx.get());
+
+    ASSERT_EQ(snapshotWindowSeconds + windowAdditiveIncrease,
+              snapshotWindowParams.targetSnapshotHistoryWindowInSeconds.load());
+    ASSERT_EQ(preemptiveIncreaseCount + 1,
+              snapshotWindowParams.preemptiveSnapshotWindowIncreaseCount.load());
+
+    /**
+     * Test that no increase occurs under cache pressure, even when the commit point is advancing.
+     */
+
+    engine->setCachePressureForTest(cachePressureThreshold + 5);
+
+    sleepmillis(2 * minTimeBetweenInc);
+    preWidenSnapshotWindowForSnapshotRead(_opCtx.get());
+
+    ASSERT_EQ(snapshotWindowSeconds + windowAdditiveIncrease,
+              snapshotWindowParams.targetSnapshotHistoryWindowInSeconds.load());
+    ASSERT_EQ(preemptiveIncreaseCount + 1,
+              snapshotWindowParams.preemptiveSnapshotWindowIncreaseCount.load());
+
+    engine->setCachePressureForTest(0);
+    snapshotWindowParams.observedCommitPointAdvancementRate.store(0.0);
+}
+
 TEST_F(SnapshotWindowTest, IncrementSnapshotTooOldErrorCount) {
     auto beforeCount = snapshotWindowParams.snapshotTooOldErrorCount.load();
     incrementSnapshotTooOldErrorCount();
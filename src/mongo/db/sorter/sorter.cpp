@@ -51,6 +51,7 @@
 #include <boost/filesystem/operations.hpp>
 #include <snappy.h>
 #include <vector>
+#include <zstd.h>
 
 #include "mongo/base/string_data.h"
 #include "mongo/config.h"
@@ -59,9 +60,13 @@
 #include "mongo/db/storage/encryption_hooks.h"
 #include "mongo/db/storage/storage_options.h"
 #include "mongo/platform/atomic_word.h"
+#include "mongo/platform/mutex.h"
 #include "mongo/platform/overflow_arithmetic.h"
 #include "mongo/s/is_mongos.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/concurrency/thread_name.h"
 #include "mongo/util/destructor_guard.h"
 #include "mongo/util/str.h"
 #include "mongo/util/unowned_ptr.h"
@@ -172,8 +177,10 @@ public:
                  std::streampos fileStartOffset,
                  std::streampos fileEndOffset,
                  const Settings& settings,
-                 const uint32_t checksum)
+                 const uint32_t checksum,
+                 SorterCompressionCodec codec)
         : _settings(settings),
+          _codec(codec),
           _done(false),
           _fileName(fileName),
           _fileStartOffset(fileStartOffset),
@@ -195,6 +202,10 @@ public:
                 str::stream() << "error seeking starting offset of '" << _fileStartOffset
                               << "' in file \"" << _fileName << "\": " << myErrnoWithDescription(),
                 _file.good());
+
+        // Any previously buffered raw data is from a prior open and must be fetched again.
+        _readAheadPos = 0;
+        _readAheadLen = 0;
     }
 
     void closeSource() {
@@ -297,6 +308,26 @@ private:
             return;
         }
 
+        if (_codec == SorterCompressionCodec::kZstd) {
+            const unsigned long long uncompressedSize =
+                ZSTD_getFrameContentSize(_buffer.get(), blockSize);
+            uassert(31643,
+                    "couldn't get uncompressed length",
+                    uncompressedSize != ZSTD_CONTENTSIZE_UNKNOWN &&
+                        uncompressedSize != ZSTD_CONTENTSIZE_ERROR);
+
+            std::unique_ptr<char[]> decompressionBuffer(new char[uncompressedSize]);
+            const size_t ret = ZSTD_decompress(
+                decompressionBuffer.get(), uncompressedSize, _buffer.get(), blockSize);
+            uassert(31644,
+                    str::stream() << "decompression failed: " << ZSTD_getErrorName(ret),
+                    !ZSTD_isError(ret) && ret == uncompressedSize);
+
+            _buffer.swap(decompressionBuffer);
+            _bufferReader.reset(new BufReader(_buffer.get(), uncompressedSize));
+            return;
+        }
+
         dassert(snappy::IsValidCompressedBuffer(_buffer.get(), blockSize));
 
         size_t uncompressedSize;
@@ -317,11 +348,38 @@ private:
     /**
      * Attempts to read data from disk. Sets _done to true when file offset reaches _fileEndOffset.
      *
+     * Reads are served from a read-ahead buffer that is refilled with one large sequential read,
+     * so that the small block-size and block-payload reads issued while merging do not each pay
+     * for a separate seek and read of the underlying file.
+     *
      * Masserts on any file errors
      */
     void read(void* out, size_t size) {
         invariant(_file.is_open());
 
+        char* dest = static_cast<char*>(out);
+        while (size > 0) {
+            if (_readAheadPos == _readAheadLen && !fillReadAheadBuffer()) {
+                // The sorted range is exhausted. Block reads never straddle the end of the range,
+                // so we must not have copied out a partial result.
+                invariant(dest == static_cast<char*>(out));
+                _done = true;
+                return;
+            }
+
+            const size_t toCopy = std::min(size, _readAheadLen - _readAheadPos);
+            memcpy(dest, _readAhead.get() + _readAheadPos, toCopy);
+            _readAheadPos += toCopy;
+            dest += toCopy;
+            size -= toCopy;
+        }
+    }
+
+    /**
+     * Refills the read-ahead buffer from disk. Returns false without reading if the file offset
+     * has reached _fileEndOffset.
+     */
+    bool fillReadAheadBuffer() {
         const std::streampos offset = _file.tellg();
         uassert(51049,
                 str::stream() << "error reading file \"" << _fileName
@@ -330,23 +388,47 @@ private:
 
         if (offset >= _fileEndOffset) {
             invariant(offset == _fileEndOffset);
-            _done = true;
-            return;
+            return false;
         }
 
-        _file.read(reinterpret_cast<char*>(out), size);
+        const size_t toRead = std::min(static_cast<size_t>(kReadAheadBufferSize),
+                                       static_cast<size_t>(_fileEndOffset - offset));
+        if (!_readAhead)
+            _readAhead.reset(new char[kReadAheadBufferSize]);
+
+        _file.read(_readAhead.get(), toRead);
         uassert(16817,
                 str::stream() << "error reading file \"" << _fileName
                               << "\": " << myErrnoWithDescription(),
                 _file.good());
-        verify(_file.gcount() == static_cast<std::streamsize>(size));
+        verify(_file.gcount() == static_cast<std::streamsize>(toRead));
+
+        _readAheadPos = 0;
+        _readAheadLen = toRead;
+        return true;
     }
 
+    // Sized to match the uncompressed block size used by SortedFileWriter, so a refill typically
+    // pulls in at least the next compressed block in a single read.
+    enum { kReadAheadBufferSize = 64 * 1024 };
+
     const Settings _settings;
+
+    // Codec the SortedFileWriter used for compressed blocks in this range. Recorded at write time
+    // rather than sniffed from the data, since both codecs' framing is just raw bytes to us.
+    const SorterCompressionCodec _codec;
+
     bool _done;
 
     std::unique_ptr<char[]> _buffer;
     std::unique_ptr<BufReader> _bufferReader;
+
+    // Raw bytes fetched ahead of the block currently being deserialized. _readAheadPos and
+    // _readAheadLen delimit the portion of _readAhead that has not yet been handed out by read().
+    std::unique_ptr<char[]> _readAhead;
+    size_t _readAheadPos = 0;
+    size_t _readAheadLen = 0;
+
     std::string _fileName;            // File containing the sorted data range.
     std::streampos _fileStartOffset;  // File offset at which the sorted data range starts.
     std::streampos _fileEndOffset;    // File offset at which the sorted data range ends.
@@ -532,6 +614,7 @@ public:
     }
 
     ~NoLimitSorter() {
+        DESTRUCTOR_GUARD(killSpillWorker());
         if (!_done) {
             // If done() was never called to return a MergeIterator, then this Sorter still owns
             // file deletion.
@@ -547,13 +630,19 @@ public:
         _memUsed += key.memUsageForSorter();
         _memUsed += val.memUsageForSorter();
 
-        if (_memUsed > _opts.maxMemoryUsageBytes)
+        if (_memUsed > _opts.memoryLimit(_memUsed))
             spill();
     }
 
+    size_t memUsed() const {
+        return _memUsed;
+    }
+
     Iterator* done() {
         invariant(!_done);
 
+        finishSpillWorker();
+
         if (_iters.empty()) {
             sort();
             return new InMemIterator<Key, Value>(_data);
@@ -604,19 +693,132 @@ private:
                                     << " bytes, but did not opt in to external sorting.");
         }
 
-        sort();
+        if (_opts.backgroundSpill && !_shutdownSpillWorker) {
+            enqueueSpill();
+            return;
+        }
+
+        spillRun(_data);
+        _memUsed = 0;
+    }
+
+    /**
+     * Sorts 'data' and appends it to the spill file as a new run. In background mode this runs on
+     * the spill worker thread; the file offset and iterator bookkeeping is safe because at most
+     * one spillRun() executes at a time.
+     */
+    void spillRun(std::deque<Data>& data) {
+        STLComparator less(_comp);
+        std::stable_sort(data.begin(), data.end(), less);
 
         SortedFileWriter<Key, Value> writer(
             _opts, _fileName, _nextSortedFileWriterOffset, _settings);
-        for (; !_data.empty(); _data.pop_front()) {
-            writer.addAlreadySorted(_data.front().first, _data.front().second);
+        for (; !data.empty(); data.pop_front()) {
+            writer.addAlreadySorted(data.front().first, data.front().second);
         }
         Iterator* iteratorPtr = writer.done();
         _nextSortedFileWriterOffset = writer.getFileEndOffset();
 
         _iters.push_back(std::shared_ptr<Iterator>(iteratorPtr));
+    }
 
+    /**
+     * Hands the current in-memory data to the spill worker, starting it on first use. The
+     * producer waits if a previous batch has not been picked up yet, so it stays at most one
+     * spill ahead of the worker.
+     */
+    void enqueueSpill() {
+        stdx::unique_lock<Latch> lk(_spillMutex);
+        if (!_spillWorker.joinable()) {
+            _spillWorker = stdx::thread([this] { spillWorkerLoop(); });
+        }
+
+        _spillStateChanged.wait(lk, [&] { return !_havePendingSpill || _spillException; });
+        if (_spillException) {
+            std::rethrow_exception(_spillException);
+        }
+
+        _pendingSpill = std::move(_data);
+        _havePendingSpill = true;
+        _data.clear();
         _memUsed = 0;
+        _spillStateChanged.notify_all();
+    }
+
+    void spillWorkerLoop() {
+        setThreadName("SorterSpillWorker");
+
+        stdx::unique_lock<Latch> lk(_spillMutex);
+        while (true) {
+            _spillStateChanged.wait(lk,
+                                    [&] { return _havePendingSpill || _shutdownSpillWorker; });
+            if (_havePendingSpill) {
+                auto batch = std::move(_pendingSpill);
+                _pendingSpill.clear();
+                _havePendingSpill = false;
+                _spillInProgress = true;
+                _spillStateChanged.notify_all();
+                lk.unlock();
+
+                try {
+                    spillRun(batch);
+                } catch (...) {
+                    lk.lock();
+                    _spillException = std::current_exception();
+                    _spillInProgress = false;
+                    _spillStateChanged.notify_all();
+                    continue;
+                }
+
+                lk.lock();
+                _spillInProgress = false;
+                _spillStateChanged.notify_all();
+                continue;
+            }
+            if (_shutdownSpillWorker) {
+                return;
+            }
+        }
+    }
+
+    /**
+     * Waits for all queued background spills to reach disk and stops the worker. Rethrows any
+     * exception the worker hit so that errors surface on the producer thread. Later spills (the
+     * final partial batch in done()) are written inline.
+     */
+    void finishSpillWorker() {
+        if (!_spillWorker.joinable())
+            return;
+
+        stdx::unique_lock<Latch> lk(_spillMutex);
+        _spillStateChanged.wait(
+            lk, [&] { return (!_havePendingSpill && !_spillInProgress) || _spillException; });
+        _shutdownSpillWorker = true;
+        _spillStateChanged.notify_all();
+        lk.unlock();
+
+        _spillWorker.join();
+        if (_spillException) {
+            std::rethrow_exception(_spillException);
+        }
+    }
+
+    /**
+     * Stops the spill worker without draining queued work. Used on destruction, where the
+     * spilled data is about to be thrown away anyway.
+     */
+    void killSpillWorker() {
+        if (!_spillWorker.joinable())
+            return;
+
+        {
+            stdx::lock_guard<Latch> lk(_spillMutex);
+            _pendingSpill.clear();
+            _havePendingSpill = false;
+            _shutdownSpillWorker = true;
+            _spillStateChanged.notify_all();
+        }
+        _spillWorker.join();
     }
 
     const Comparator _comp;
@@ -628,6 +830,18 @@ private:
     size_t _memUsed;
     std::deque<Data> _data;                         // the "current" data
     std::vector<std::shared_ptr<Iterator>> _iters;  // data that has already been spilled
+
+    // Background spilling state; only used when '_opts.backgroundSpill' is set. All fields below
+    // are guarded by '_spillMutex'. The worker owns '_iters' and the file offset while a run is
+    // in flight; the producer only touches them again once the worker has been drained.
+    Mutex _spillMutex = MONGO_MAKE_LATCH("NoLimitSorter::_spillMutex");
+    stdx::condition_variable _spillStateChanged;
+    stdx::thread _spillWorker;
+    std::deque<Data> _pendingSpill;
+    bool _havePendingSpill = false;
+    bool _spillInProgress = false;
+    bool _shutdownSpillWorker = false;
+    std::exception_ptr _spillException;
 };
 
 template <typename Key, typename Value, typename Comparator>
@@ -657,6 +871,12 @@ public:
         _best = {contender.first.getOwned(), contender.second.getOwned()};
     }
 
+    size_t memUsed() const {
+        if (!_haveData)
+            return 0;
+        return _best.first.memUsageForSorter() + _best.second.memUsageForSorter();
+    }
+
     Iterator* done() {
         if (_haveData) {
             return new InMemIterator<Key, Value>(_best);
@@ -732,7 +952,7 @@ public:
             if (_data.size() == _opts.limit)
                 std::make_heap(_data.begin(), _data.end(), less);
 
-            if (_memUsed > _opts.maxMemoryUsageBytes)
+            if (_memUsed > _opts.memoryLimit(_memUsed))
                 spill();
 
             return;
@@ -755,10 +975,14 @@ public:
         _data.back() = {contender.first.getOwned(), contender.second.getOwned()};
         std::push_heap(_data.begin(), _data.end(), less);
 
-        if (_memUsed > _opts.maxMemoryUsageBytes)
+        if (_memUsed > _opts.memoryLimit(_memUsed))
             spill();
     }
 
+    size_t memUsed() const {
+        return _memUsed;
+    }
+
     Iterator* done() {
         if (_iters.empty()) {
             sort();
@@ -942,7 +1166,7 @@ SortedFileWriter<Key, Value>::SortedFileWriter(const SortOptions& opts,
                                                const std::string& fileName,
                                                const std::streampos fileStartOffset,
                                                const Settings& settings)
-    : _settings(settings) {
+    : _settings(settings), _codec(opts.spillCompressionCodec) {
 
     // This should be checked by consumers, but if we get here don't allow writes.
     uassert(
@@ -1001,7 +1225,17 @@ void SortedFileWriter<Key, Value>::spill() {
         return;
 
     std::string compressed;
-    snappy::Compress(outBuffer, size, &compressed);
+    if (_codec == SorterCompressionCodec::kZstd) {
+        compressed.resize(ZSTD_compressBound(size));
+        const size_t ret =
+            ZSTD_compress(&compressed[0], compressed.size(), outBuffer, size, 1 /* level */);
+        uassert(31645,
+                str::stream() << "compression failed: " << ZSTD_getErrorName(ret),
+                !ZSTD_isError(ret));
+        compressed.resize(ret);
+    } else {
+        snappy::Compress(outBuffer, size, &compressed);
+    }
     verify(compressed.size() <= size_t(std::numeric_limits<int32_t>::max()));
 
     const bool shouldCompress = compressed.size() < size_t(_buffer.len() / 10 * 9);
@@ -1057,7 +1291,7 @@ SortIteratorInterface<Key, Value>* SortedFileWriter<Key, Value>::done() {
     _file.close();
 
     return new sorter::FileIterator<Key, Value>(
-        _fileName, _fileStartOffset, _fileEndOffset, _settings, _checksum);
+        _fileName, _fileStartOffset, _fileEndOffset, _settings, _checksum, _codec);
 }
 
 //
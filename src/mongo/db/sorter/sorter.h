@@ -33,6 +33,7 @@
 
 #include <deque>
 #include <fstream>
+#include <functional>
 #include <memory>
 #include <string>
 #include <utility>
@@ -89,6 +90,14 @@
 
 namespace mongo {
 
+/**
+ * Block compression codec applied to runs spilled to disk.
+ */
+enum class SorterCompressionCodec {
+    kSnappy,  // Fastest; the historical default.
+    kZstd,    // Smaller spill files at a modest CPU cost. Best paired with backgroundSpill.
+};
+
 /**
  * Runtime options that control the Sorter's behavior
  */
@@ -107,7 +116,23 @@ struct SortOptions {
     // extSortAllowed is true.
     std::string tempDir;
 
-    SortOptions() : limit(0), maxMemoryUsageBytes(64 * 1024 * 1024), extSortAllowed(false) {}
+    // Whether spilled runs may be sorted, compressed and written by a background thread so that
+    // run generation overlaps with the production of more data. Only honored by sorters without
+    // a limit.
+    bool backgroundSpill;
+
+    // Codec used to compress blocks spilled to disk. Spill files are written and read back within
+    // a single sort, so this never needs to match what another node or version would choose.
+    SorterCompressionCodec spillCompressionCodec;
+
+    // Optional callback consulted in place of maxMemoryUsageBytes at each spill check, given the
+    // sorter's current in-memory usage. Lets callers vary the limit while the sort runs, e.g. to
+    // lease memory from a server-wide pool. Unset means maxMemoryUsageBytes applies unchanged.
+    std::function<size_t(size_t memUsed)> dynamicMemoryLimit;
+
+    SortOptions()
+        : limit(0), maxMemoryUsageBytes(64 * 1024 * 1024), extSortAllowed(false),
+          backgroundSpill(false), spillCompressionCodec(SorterCompressionCodec::kSnappy) {}
 
     // Fluent API to support expressions like SortOptions().Limit(1000).ExtSortAllowed(true)
 
@@ -130,6 +155,26 @@ struct SortOptions {
         tempDir = newTempDir;
         return *this;
     }
+
+    SortOptions& BackgroundSpill(bool newBackgroundSpill = true) {
+        backgroundSpill = newBackgroundSpill;
+        return *this;
+    }
+
+    SortOptions& SpillCompressionCodec(SorterCompressionCodec newCodec) {
+        spillCompressionCodec = newCodec;
+        return *this;
+    }
+
+    SortOptions& DynamicMemoryLimit(std::function<size_t(size_t memUsed)> newDynamicMemoryLimit) {
+        dynamicMemoryLimit = std::move(newDynamicMemoryLimit);
+        return *this;
+    }
+
+    // The number of bytes the sorter may hold in memory before spilling, given its current usage.
+    size_t memoryLimit(size_t memUsed) const {
+        return dynamicMemoryLimit ? dynamicMemoryLimit(memUsed) : maxMemoryUsageBytes;
+    }
 };
 
 /**
@@ -233,6 +278,13 @@ public:
         return _usedDisk;
     }
 
+    /**
+     * Returns the number of bytes of data currently buffered in memory by this sorter. For a
+     * limited (top-k) sort this stays bounded by the retained top k items regardless of how much
+     * data is added; callers can sample it after each add() to report peak memory usage.
+     */
+    virtual size_t memUsed() const = 0;
+
 protected:
     Sorter() {}  // can only be constructed as a base
 
@@ -281,6 +333,7 @@ private:
     void spill();
 
     const Settings _settings;
+    const SorterCompressionCodec _codec;
     std::string _fileName;
     std::ofstream _file;
     BufBuilder _buffer;
@@ -309,6 +309,20 @@ public:
 
             ASSERT_TRUE(boost::filesystem::remove(fileName));
         }
+        {  // big enough to compress, with zstd spill blocks
+            std::string fileName = opts.tempDir + "/" + nextFileName();
+            SortedFileWriter<IntWrapper, IntWrapper> sorter(
+                SortOptions(opts).SpillCompressionCodec(SorterCompressionCodec::kZstd),
+                fileName,
+                0);
+            for (int i = 0; i < 1000 * 1000; i++)
+                sorter.addAlreadySorted(i, -i);
+
+            ASSERT_ITERATORS_EQUIVALENT(std::shared_ptr<IWIterator>(sorter.done()),
+                                        make_shared<IntIterator>(0, 1000 * 1000));
+
+            ASSERT_TRUE(boost::filesystem::remove(fileName));
+        }
 
         ASSERT(boost::filesystem::is_empty(tempDir.path()));
     }
@@ -518,6 +532,43 @@ class Dupes : public Basic {
     }
 };
 
+class MemUsage : public ScopedGlobalServiceContextForTest {
+public:
+    void run() {
+        {  // no limit: memory grows with each item added
+            std::shared_ptr<IWSorter> sorter(IWSorter::make(SortOptions(), IWComparator(ASC)));
+            ASSERT_EQUALS(sorter->memUsed(), 0u);
+            sorter->add(1, -1);
+            const size_t oneItem = sorter->memUsed();
+            ASSERT_GREATER_THAN(oneItem, 0u);
+            sorter->add(2, -2);
+            ASSERT_GREATER_THAN(sorter->memUsed(), oneItem);
+        }
+        {  // limit 1: retains at most the single best item
+            std::shared_ptr<IWSorter> sorter(
+                IWSorter::make(SortOptions().Limit(1), IWComparator(ASC)));
+            ASSERT_EQUALS(sorter->memUsed(), 0u);
+            sorter->add(100, -100);
+            const size_t oneItem = sorter->memUsed();
+            ASSERT_GREATER_THAN(oneItem, 0u);
+            for (int i = 0; i < 100; i++)
+                sorter->add(i, -i);
+            ASSERT_EQUALS(sorter->memUsed(), oneItem);
+        }
+        {  // top-k: memory stays bounded by the retained k items no matter how much is added
+            std::shared_ptr<IWSorter> sorter(
+                IWSorter::make(SortOptions().Limit(3), IWComparator(ASC)));
+            for (int i = 0; i < 3; i++)
+                sorter->add(i, -i);
+            const size_t threeItems = sorter->memUsed();
+            ASSERT_GREATER_THAN(threeItems, 0u);
+            for (int i = 3; i < 1000; i++)
+                sorter->add(i, -i);
+            ASSERT_EQUALS(sorter->memUsed(), threeItems);
+        }
+    }
+};
+
 template <bool Random = true>
 class LotsOfDataLittleMemory : public Basic {
 public:
@@ -597,6 +648,7 @@ public:
         add<SorterTests::Basic>();
         add<SorterTests::Limit>();
         add<SorterTests::Dupes>();
+        add<SorterTests::MemUsage>();
         add<SorterTests::LotsOfDataLittleMemory</*random=*/false>>();
         add<SorterTests::LotsOfDataLittleMemory</*random=*/true>>();
         add<SorterTests::LotsOfDataWithLimit<1, /*random=*/false>>();     // limit=1 is special case
@@ -155,6 +155,20 @@ void OperationLatencyHistogram::_incrementData(uint64_t latency, int bucket, His
     data->sum += latency;
 }
 
+void OperationLatencyHistogram::add(const OperationLatencyHistogram& other) {
+    auto addData = [](const HistogramData& from, HistogramData* to) {
+        for (int i = 0; i < kMaxBuckets; i++) {
+            to->buckets[i] += from.buckets[i];
+        }
+        to->entryCount += from.entryCount;
+        to->sum += from.sum;
+    };
+    addData(other._reads, &_reads);
+    addData(other._writes, &_writes);
+    addData(other._commands, &_commands);
+    addData(other._transactions, &_transactions);
+}
+
 void OperationLatencyHistogram::increment(uint64_t latency, Command::ReadWriteType type) {
     int bucket = _getBucket(latency);
     switch (type) {
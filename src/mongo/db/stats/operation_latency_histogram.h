@@ -54,6 +54,12 @@ public:
      */
     void increment(uint64_t latency, Command::ReadWriteType type);
 
+    /**
+     * Folds the counts of 'other' into this histogram. Used to combine per-shard histograms into
+     * a single result at read time.
+     */
+    void add(const OperationLatencyHistogram& other);
+
     /**
      * Appends the four histograms with latency totals and operation counts.
      */
@@ -0,0 +1,83 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/stats/operation_latency_phases.h"
+
+#include "mongo/platform/atomic_word.h"
+
+namespace mongo {
+
+namespace {
+
+const auto getOperationLatencyPhases =
+    OperationContext::declareDecoration<OperationLatencyPhases>();
+
+constexpr StringData kPhaseFieldNames[OperationLatencyPhases::kNumPhases] = {
+    "lockWaitMicros"_sd,
+    "journalCommitWaitMicros"_sd,
+    "replicationWaitMicros"_sd,
+};
+
+// Server-wide cumulative totals, reported by the 'opLatencyPhases' serverStatus section.
+AtomicWord<long long> gCumulativeMicros[OperationLatencyPhases::kNumPhases];
+
+}  // namespace
+
+OperationLatencyPhases& OperationLatencyPhases::get(OperationContext* opCtx) {
+    return getOperationLatencyPhases(opCtx);
+}
+
+void OperationLatencyPhases::add(Phase phase, Microseconds duration) {
+    const auto micros = durationCount<Microseconds>(duration);
+    if (micros <= 0) {
+        return;
+    }
+    _micros[phase] += micros;
+    gCumulativeMicros[phase].fetchAndAdd(micros);
+}
+
+BSONObj OperationLatencyPhases::toBSON() const {
+    BSONObjBuilder builder;
+    for (int i = 0; i < kNumPhases; i++) {
+        if (_micros[i] > 0) {
+            builder.append(kPhaseFieldNames[i], _micros[i]);
+        }
+    }
+    return builder.obj();
+}
+
+void OperationLatencyPhases::appendCumulativeTotals(BSONObjBuilder* builder) {
+    for (int i = 0; i < kNumPhases; i++) {
+        builder->append(kPhaseFieldNames[i], gCumulativeMicros[i].load());
+    }
+}
+
+}  // namespace mongo
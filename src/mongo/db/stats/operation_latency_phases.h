@@ -0,0 +1,87 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/util/duration.h"
+
+namespace mongo {
+
+/**
+ * A fixed-slot breakdown of where an operation spent its time blocked. Decorates every
+ * OperationContext, so recording a span is a single array addition with no allocation and no
+ * locking. Spans are recorded at the existing wait points (lock grants, journal commits,
+ * write concern waits) and surface in the slow-op log line, the profiler, and the
+ * 'opLatencyPhases' serverStatus section, which FTDC samples.
+ */
+class OperationLatencyPhases {
+public:
+    enum Phase {
+        // Blocked in LockerImpl waiting for a lock grant.
+        kLockWait = 0,
+
+        // Waiting for the storage engine to make writes durable.
+        kJournalCommitWait,
+
+        // Waiting for a write concern to be satisfied by other members of the replica set.
+        kReplicationWait,
+
+        kNumPhases,
+    };
+
+    static OperationLatencyPhases& get(OperationContext* opCtx);
+
+    /**
+     * Adds a span to 'phase' for this operation and to the server-wide cumulative totals.
+     * Negative and zero durations are ignored.
+     */
+    void add(Phase phase, Microseconds duration);
+
+    Microseconds total(Phase phase) const {
+        return Microseconds{_micros[phase]};
+    }
+
+    /**
+     * Returns the per-phase totals of this operation as {<phase>Micros: <total>, ...}, omitting
+     * phases the operation never waited in. Returns an empty object when nothing was recorded.
+     */
+    BSONObj toBSON() const;
+
+    /**
+     * Appends the server-wide cumulative per-phase totals, for serverStatus.
+     */
+    static void appendCumulativeTotals(BSONObjBuilder* builder);
+
+private:
+    long long _micros[kNumPhases] = {};
+};
+
+}  // namespace mongo
@@ -0,0 +1,90 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/stats/operation_latency_phases.h"
+
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+TEST(OperationLatencyPhasesTest, SpansAccumulatePerPhase) {
+    OperationLatencyPhases phases;
+
+    phases.add(OperationLatencyPhases::kLockWait, Microseconds(100));
+    phases.add(OperationLatencyPhases::kLockWait, Microseconds(50));
+    phases.add(OperationLatencyPhases::kReplicationWait, Microseconds(2000));
+
+    ASSERT_EQ(Microseconds(150), phases.total(OperationLatencyPhases::kLockWait));
+    ASSERT_EQ(Microseconds(2000), phases.total(OperationLatencyPhases::kReplicationWait));
+    ASSERT_EQ(Microseconds(0), phases.total(OperationLatencyPhases::kJournalCommitWait));
+
+    BSONObj obj = phases.toBSON();
+    ASSERT_EQ(150, obj["lockWaitMicros"].numberLong());
+    ASSERT_EQ(2000, obj["replicationWaitMicros"].numberLong());
+
+    // Phases the operation never waited in are omitted.
+    ASSERT_FALSE(obj.hasField("journalCommitWaitMicros"));
+}
+
+TEST(OperationLatencyPhasesTest, EmptyWhenNothingRecorded) {
+    OperationLatencyPhases phases;
+    ASSERT_TRUE(phases.toBSON().isEmpty());
+}
+
+TEST(OperationLatencyPhasesTest, NonPositiveDurationsAreIgnored) {
+    OperationLatencyPhases phases;
+
+    phases.add(OperationLatencyPhases::kLockWait, Microseconds(0));
+    phases.add(OperationLatencyPhases::kLockWait, Microseconds(-25));
+
+    ASSERT_EQ(Microseconds(0), phases.total(OperationLatencyPhases::kLockWait));
+    ASSERT_TRUE(phases.toBSON().isEmpty());
+}
+
+TEST(OperationLatencyPhasesTest, CumulativeTotalsGrowWithRecordedSpans) {
+    BSONObjBuilder beforeBuilder;
+    OperationLatencyPhases::appendCumulativeTotals(&beforeBuilder);
+    BSONObj before = beforeBuilder.obj();
+
+    OperationLatencyPhases phases;
+    phases.add(OperationLatencyPhases::kJournalCommitWait, Microseconds(500));
+
+    BSONObjBuilder afterBuilder;
+    OperationLatencyPhases::appendCumulativeTotals(&afterBuilder);
+    BSONObj after = afterBuilder.obj();
+
+    ASSERT_EQ(before["journalCommitWaitMicros"].numberLong() + 500,
+              after["journalCommitWaitMicros"].numberLong());
+}
+
+}  // namespace
+}  // namespace mongo
@@ -0,0 +1,98 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/stats/prepare_conflict_metrics.h"
+
+#include "mongo/db/commands/server_status.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/service_context.h"
+
+namespace mongo {
+namespace {
+const auto PrepareConflictMetricsDecoration =
+    ServiceContext::declareDecoration<PrepareConflictMetrics>();
+}  // namespace
+
+PrepareConflictMetrics* PrepareConflictMetrics::get(ServiceContext* service) {
+    return &PrepareConflictMetricsDecoration(service);
+}
+
+PrepareConflictMetrics* PrepareConflictMetrics::get(OperationContext* opCtx) {
+    return get(opCtx->getServiceContext());
+}
+
+void PrepareConflictMetrics::recordConflictWait(StringData ns, Microseconds waited) {
+    stdx::lock_guard<Latch> lk(_mutex);
+    _totals.conflicts++;
+    _totals.waitTime += waited;
+    if (!ns.empty()) {
+        auto& stats = _statsByNs[ns];
+        stats.conflicts++;
+        stats.waitTime += waited;
+    }
+}
+
+void PrepareConflictMetrics::report(BSONObjBuilder* builder) const {
+    stdx::lock_guard<Latch> lk(_mutex);
+    builder->append("conflicts", _totals.conflicts);
+    builder->append("waitMicros", durationCount<Microseconds>(_totals.waitTime));
+    BSONObjBuilder perNsBuilder(builder->subobjStart("perNamespace"));
+    for (const auto& entry : _statsByNs) {
+        BSONObjBuilder nsBuilder(perNsBuilder.subobjStart(entry.first));
+        nsBuilder.append("conflicts", entry.second.conflicts);
+        nsBuilder.append("waitMicros", durationCount<Microseconds>(entry.second.waitTime));
+        nsBuilder.done();
+    }
+    perNsBuilder.done();
+}
+
+namespace {
+class PrepareConflictsSSS : public ServerStatusSection {
+public:
+    PrepareConflictsSSS() : ServerStatusSection("prepareConflicts") {}
+
+    ~PrepareConflictsSSS() override = default;
+
+    bool includeByDefault() const override {
+        return true;
+    }
+
+    BSONObj generateSection(OperationContext* opCtx,
+                            const BSONElement& configElement) const override {
+        BSONObjBuilder builder;
+        PrepareConflictMetrics::get(opCtx)->report(&builder);
+        return builder.obj();
+    }
+
+} prepareConflictsSSS;
+}  // namespace
+
+}  // namespace mongo
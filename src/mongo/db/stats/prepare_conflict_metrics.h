@@ -0,0 +1,78 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include "mongo/base/string_data.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/util/duration.h"
+#include "mongo/util/string_map.h"
+
+namespace mongo {
+
+class OperationContext;
+class ServiceContext;
+
+/**
+ * Aggregates, per namespace, how often read operations have blocked behind prepared
+ * transactions and for how long. Reported through the 'prepareConflicts' serverStatus
+ * section, so the collections suffering prepare conflict stalls can be identified without
+ * waiting for tail latencies to degrade.
+ */
+class PrepareConflictMetrics {
+public:
+    static PrepareConflictMetrics* get(ServiceContext* service);
+    static PrepareConflictMetrics* get(OperationContext* opCtx);
+
+    PrepareConflictMetrics() = default;
+
+    /**
+     * Records that an operation on 'ns' was blocked behind a prepared transaction for
+     * 'waited'. An empty namespace is accounted against the totals only.
+     */
+    void recordConflictWait(StringData ns, Microseconds waited);
+
+    /**
+     * Appends the accumulated totals and the per-namespace breakdown to 'builder'.
+     */
+    void report(BSONObjBuilder* builder) const;
+
+private:
+    struct Stats {
+        long long conflicts = 0;
+        Microseconds waitTime{0};
+    };
+
+    mutable Mutex _mutex = MONGO_MAKE_LATCH("PrepareConflictMetrics::_mutex");
+    Stats _totals;
+    StringMap<Stats> _statsByNs;
+};
+
+}  // namespace mongo
@@ -0,0 +1,169 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/stats/query_shape_stats.h"
+
+#include "mongo/db/commands/server_status.h"
+#include "mongo/util/hex.h"
+
+namespace mongo {
+
+namespace {
+
+void atomicStoreMax(AtomicWord<long long>* word, long long value) {
+    auto current = word->load();
+    while (value > current && !word->compareAndSwap(&current, value)) {
+    }
+}
+
+}  // namespace
+
+void QueryShapeStats::_fold(Slot* slot,
+                            long long executionMicros,
+                            long long keysExamined,
+                            long long docsExamined,
+                            long long nreturned,
+                            const StorageMetrics& storage) {
+    slot->ops.fetchAndAdd(1);
+    slot->totalMicros.fetchAndAdd(executionMicros);
+    atomicStoreMax(&slot->maxMicros, executionMicros);
+    slot->keysExamined.fetchAndAdd(keysExamined);
+    slot->docsExamined.fetchAndAdd(docsExamined);
+    slot->returned.fetchAndAdd(nreturned);
+    if (storage.any()) {
+        slot->storageOps.fetchAndAdd(1);
+        slot->bytesRead.fetchAndAdd(storage.bytesRead);
+        slot->readTimeMicros.fetchAndAdd(storage.readTimeMicros);
+        slot->cacheWaitMicros.fetchAndAdd(storage.cacheWaitMicros);
+    }
+}
+
+void QueryShapeStats::record(uint32_t queryHash,
+                             long long executionMicros,
+                             long long keysExamined,
+                             long long docsExamined,
+                             long long nreturned,
+                             const StorageMetrics& storage) {
+    static_assert((kNumSlots & (kNumSlots - 1)) == 0, "slot count must be a power of two");
+    const unsigned long long key = static_cast<unsigned long long>(queryHash) + 1;
+
+    for (size_t probe = 0; probe < kMaxProbes; ++probe) {
+        auto& slot = _slots[(queryHash + probe) & (kNumSlots - 1)];
+        auto current = slot.key.load();
+        // Claim an empty slot for this shape, or lose the race to a concurrent claimer and
+        // re-examine what it stored.
+        if (current == 0 && !slot.key.compareAndSwap(&current, key)) {
+            current = slot.key.load();
+        }
+        if (current == 0 || current == key) {
+            _fold(&slot, executionMicros, keysExamined, docsExamined, nreturned, storage);
+            return;
+        }
+    }
+
+    _fold(&_overflow, executionMicros, keysExamined, docsExamined, nreturned, storage);
+}
+
+void QueryShapeStats::append(BSONObjBuilder* bob, bool includeShapes) const {
+    long long shapesTracked = 0;
+    long long opsRecorded = 0;
+
+    boost::optional<BSONArrayBuilder> shapes;
+    if (includeShapes) {
+        shapes.emplace(bob->subarrayStart("shapes"));
+    }
+
+    for (auto&& slot : _slots) {
+        auto key = slot.key.load();
+        if (key == 0) {
+            continue;
+        }
+        ++shapesTracked;
+        opsRecorded += slot.ops.load();
+
+        if (includeShapes) {
+            BSONObjBuilder shape(shapes->subobjStart());
+            shape.append("queryHash",
+                         unsignedIntToFixedLengthHex(static_cast<uint32_t>(key - 1)));
+            shape.append("ops", slot.ops.load());
+            shape.append("totalMicros", slot.totalMicros.load());
+            shape.append("maxMicros", slot.maxMicros.load());
+            shape.append("keysExamined", slot.keysExamined.load());
+            shape.append("docsExamined", slot.docsExamined.load());
+            shape.append("returned", slot.returned.load());
+            // Storage metrics are gathered only for slow or profiled operations, so they are
+            // reported with their own operation count rather than implied by 'ops'.
+            if (auto storageOps = slot.storageOps.load()) {
+                BSONObjBuilder storage(shape.subobjStart("storage"));
+                storage.append("ops", storageOps);
+                storage.append("bytesRead", slot.bytesRead.load());
+                storage.append("timeReadingMicros", slot.readTimeMicros.load());
+                storage.append("cacheWaitMicros", slot.cacheWaitMicros.load());
+            }
+        }
+    }
+    if (includeShapes) {
+        shapes->done();
+    }
+
+    bob->append("shapesTracked", shapesTracked);
+    bob->append("opsRecorded", opsRecorded);
+    bob->append("overflowOps", _overflow.ops.load());
+}
+
+QueryShapeStats globalQueryShapeStats;
+
+namespace {
+
+class QueryShapeStatsSSS : public ServerStatusSection {
+public:
+    QueryShapeStatsSSS() : ServerStatusSection("queryShapeStats") {}
+
+    bool includeByDefault() const override {
+        return true;
+    }
+
+    BSONObj generateSection(OperationContext* opCtx,
+                            const BSONElement& configElement) const override {
+        // The summary counters are cheap enough for FTDC's periodic serverStatus sample. The
+        // per-shape table is only emitted when asked for explicitly, e.g.
+        // db.serverStatus({queryShapeStats: {shapes: true}}).
+        const bool includeShapes =
+            configElement.isABSONObj() && configElement.Obj()["shapes"].trueValue();
+        BSONObjBuilder bob;
+        globalQueryShapeStats.append(&bob, includeShapes);
+        return bob.obj();
+    }
+} queryShapeStatsSSS;
+
+}  // namespace
+
+}  // namespace mongo
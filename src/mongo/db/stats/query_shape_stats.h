@@ -0,0 +1,120 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/platform/atomic_word.h"
+
+namespace mongo {
+
+/**
+ * An always-on registry of per-query-shape execution statistics, keyed by the planner's query
+ * hash. Operations fold their latency and work counters into a fixed-size table of slots so that
+ * recording is lock-free, allocation-free and cheap enough to run on every operation.
+ *
+ * A shape claims a slot the first time it is seen and keeps it until shutdown. When the table (or
+ * a slot's probe neighborhood) is full, new shapes fold into a shared overflow slot instead, so
+ * the registry degrades to coarser attribution rather than growing or blocking.
+ */
+class QueryShapeStats {
+public:
+    // The table size bounds memory use; the probe limit bounds per-record work when many shapes
+    // collide in one neighborhood. Both are deliberately small: the registry targets the handful
+    // of hot shapes a workload actually runs, not an exhaustive shape catalog.
+    static constexpr size_t kNumSlots = 1024;
+    static constexpr size_t kMaxProbes = 8;
+
+    /**
+     * Storage-level read cost of one operation. Only populated for operations whose storage
+     * statistics were gathered (slow or profiled operations); 'storageOps' in the shape entry
+     * counts how many operations contributed, so the totals can be averaged meaningfully.
+     */
+    struct StorageMetrics {
+        long long bytesRead = 0;
+        long long readTimeMicros = 0;
+        long long cacheWaitMicros = 0;
+
+        bool any() const {
+            return bytesRead || readTimeMicros || cacheWaitMicros;
+        }
+    };
+
+    /**
+     * Folds one completed operation into the shape's slot.
+     */
+    void record(uint32_t queryHash,
+                long long executionMicros,
+                long long keysExamined,
+                long long docsExamined,
+                long long nreturned,
+                const StorageMetrics& storage = {});
+
+    /**
+     * Appends summary counters to 'bob'. When 'includeShapes' is set, also appends a 'shapes'
+     * array with one entry per tracked shape.
+     */
+    void append(BSONObjBuilder* bob, bool includeShapes) const;
+
+private:
+    struct Slot {
+        // The shape's query hash plus one, so that zero means "unclaimed".
+        AtomicWord<unsigned long long> key{0};
+        AtomicWord<long long> ops{0};
+        AtomicWord<long long> totalMicros{0};
+        AtomicWord<long long> maxMicros{0};
+        AtomicWord<long long> keysExamined{0};
+        AtomicWord<long long> docsExamined{0};
+        AtomicWord<long long> returned{0};
+        // Storage-level read cost, folded in only for the subset of operations that gathered
+        // storage statistics and counted by 'storageOps'.
+        AtomicWord<long long> storageOps{0};
+        AtomicWord<long long> bytesRead{0};
+        AtomicWord<long long> readTimeMicros{0};
+        AtomicWord<long long> cacheWaitMicros{0};
+    };
+
+    static void _fold(Slot* slot,
+                      long long executionMicros,
+                      long long keysExamined,
+                      long long docsExamined,
+                      long long nreturned,
+                      const StorageMetrics& storage);
+
+    Slot _slots[kNumSlots];
+
+    // Receives operations whose shape could not claim a slot.
+    Slot _overflow;
+};
+
+extern QueryShapeStats globalQueryShapeStats;
+
+}  // namespace mongo
@@ -0,0 +1,135 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/stats/query_shape_stats.h"
+
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+BSONObj shapeEntry(const BSONObj& section, StringData queryHash) {
+    for (auto&& elt : section["shapes"].Obj()) {
+        if (elt.Obj()["queryHash"].valueStringData() == queryHash) {
+            return elt.Obj().getOwned();
+        }
+    }
+    return BSONObj();
+}
+
+TEST(QueryShapeStatsTest, AggregatesOperationsPerShape) {
+    QueryShapeStats stats;
+    stats.record(0xabc, 100, 5, 3, 2);
+    stats.record(0xabc, 300, 7, 1, 4);
+    stats.record(0xdef, 50, 1, 1, 1);
+
+    BSONObjBuilder bob;
+    stats.append(&bob, true /* includeShapes */);
+    auto section = bob.obj();
+
+    ASSERT_EQ(section["shapesTracked"].numberLong(), 2);
+    ASSERT_EQ(section["opsRecorded"].numberLong(), 3);
+    ASSERT_EQ(section["overflowOps"].numberLong(), 0);
+
+    auto shape = shapeEntry(section, "00000ABC");
+    ASSERT_FALSE(shape.isEmpty());
+    ASSERT_EQ(shape["ops"].numberLong(), 2);
+    ASSERT_EQ(shape["totalMicros"].numberLong(), 400);
+    ASSERT_EQ(shape["maxMicros"].numberLong(), 300);
+    ASSERT_EQ(shape["keysExamined"].numberLong(), 12);
+    ASSERT_EQ(shape["docsExamined"].numberLong(), 4);
+    ASSERT_EQ(shape["returned"].numberLong(), 6);
+}
+
+TEST(QueryShapeStatsTest, StorageMetricsAggregateWithTheirOwnOperationCount) {
+    QueryShapeStats stats;
+    QueryShapeStats::StorageMetrics storage;
+    storage.bytesRead = 4096;
+    storage.readTimeMicros = 150;
+    storage.cacheWaitMicros = 25;
+
+    // Only the second operation gathered storage statistics.
+    stats.record(0xabc, 100, 5, 3, 2);
+    stats.record(0xabc, 300, 7, 1, 4, storage);
+
+    BSONObjBuilder bob;
+    stats.append(&bob, true /* includeShapes */);
+    auto shape = shapeEntry(bob.obj(), "00000ABC");
+    ASSERT_FALSE(shape.isEmpty());
+    ASSERT_EQ(shape["ops"].numberLong(), 2);
+
+    auto storageSection = shape["storage"].Obj();
+    ASSERT_EQ(storageSection["ops"].numberLong(), 1);
+    ASSERT_EQ(storageSection["bytesRead"].numberLong(), 4096);
+    ASSERT_EQ(storageSection["timeReadingMicros"].numberLong(), 150);
+    ASSERT_EQ(storageSection["cacheWaitMicros"].numberLong(), 25);
+}
+
+TEST(QueryShapeStatsTest, ShapeWithoutStorageMetricsOmitsStorageSection) {
+    QueryShapeStats stats;
+    stats.record(1, 10, 0, 0, 0);
+
+    BSONObjBuilder bob;
+    stats.append(&bob, true /* includeShapes */);
+    auto shape = shapeEntry(bob.obj(), "00000001");
+    ASSERT_FALSE(shape.isEmpty());
+    ASSERT_FALSE(shape.hasField("storage"));
+}
+
+TEST(QueryShapeStatsTest, SummaryOmitsShapeArrayUnlessRequested) {
+    QueryShapeStats stats;
+    stats.record(1, 10, 0, 0, 0);
+
+    BSONObjBuilder bob;
+    stats.append(&bob, false /* includeShapes */);
+    auto section = bob.obj();
+    ASSERT_FALSE(section.hasField("shapes"));
+    ASSERT_EQ(section["shapesTracked"].numberLong(), 1);
+}
+
+TEST(QueryShapeStatsTest, CollidingShapesBeyondProbeLimitFoldIntoOverflow) {
+    QueryShapeStats stats;
+    // All of these hashes map to the same slot neighborhood; one more shape than the probe limit
+    // allows must land in the overflow slot rather than evicting a tracked shape.
+    for (size_t i = 0; i <= QueryShapeStats::kMaxProbes; ++i) {
+        stats.record(static_cast<uint32_t>(i * QueryShapeStats::kNumSlots), 10, 0, 0, 0);
+    }
+
+    BSONObjBuilder bob;
+    stats.append(&bob, false /* includeShapes */);
+    auto section = bob.obj();
+    ASSERT_EQ(section["shapesTracked"].numberLong(),
+              static_cast<long long>(QueryShapeStats::kMaxProbes));
+    ASSERT_EQ(section["overflowOps"].numberLong(), 1);
+}
+
+}  // namespace
+}  // namespace mongo
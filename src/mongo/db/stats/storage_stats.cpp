@@ -34,11 +34,50 @@
 #include "mongo/db/db_raii.h"
 #include "mongo/db/index/index_access_method.h"
 #include "mongo/db/index/index_descriptor.h"
+#include "mongo/db/stats/storage_stats_gen.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/util/lru_cache.h"
 
 #include "mongo/db/stats/storage_stats.h"
 
 namespace mongo {
 
+namespace {
+
+/**
+ * Cache of recently computed collStats storage sections. Computing the stats walks every table
+ * and index in the storage engine, and monitoring agents hit every namespace on a short period,
+ * so a reply computed moments ago is almost always good enough. Entries are keyed by namespace
+ * plus the request options that change the reply shape, and are served only while younger than
+ * 'collStatsCacheSeconds' (0, the default, bypasses the cache entirely).
+ */
+struct CachedStorageStats {
+    Date_t computedAt;
+    BSONObj stats;
+};
+
+constexpr std::size_t kStorageStatsCacheMaxEntries = 4096;
+
+Mutex storageStatsCacheMutex = MONGO_MAKE_LATCH("StorageStatsCache::mutex");
+LRUCache<std::string, CachedStorageStats>& storageStatsCache() {
+    static LRUCache<std::string, CachedStorageStats> cache(kStorageStatsCacheMaxEntries);
+    return cache;
+}
+
+std::string makeStorageStatsCacheKey(const NamespaceString& nss, int scale, bool verbose) {
+    str::stream key;
+    key << nss.ns() << "|" << scale << (verbose ? "|v" : "");
+    return key;
+}
+
+Status appendUncachedCollectionStorageStats(OperationContext* opCtx,
+                                            const NamespaceString& nss,
+                                            int scale,
+                                            bool verbose,
+                                            BSONObjBuilder* result);
+
+}  // namespace
+
 Status appendCollectionStorageStats(OperationContext* opCtx,
                                     const NamespaceString& nss,
                                     const BSONObj& param,
@@ -55,6 +94,48 @@ Status appendCollectionStorageStats(OperationContext* opCtx,
 
     bool verbose = param["verbose"].trueValue();
 
+    const auto cacheSeconds = gCollStatsCacheSeconds.load();
+    if (cacheSeconds <= 0) {
+        return appendUncachedCollectionStorageStats(opCtx, nss, scale, verbose, result);
+    }
+
+    const auto key = makeStorageStatsCacheKey(nss, scale, verbose);
+    const auto now = opCtx->getServiceContext()->getFastClockSource()->now();
+    {
+        stdx::lock_guard<Latch> lk(storageStatsCacheMutex);
+        auto it = storageStatsCache().find(key);
+        if (it != storageStatsCache().end() &&
+            now - it->second.computedAt <= Seconds(cacheSeconds)) {
+            result->appendElements(it->second.stats);
+            result->appendDate("statsCachedAt", it->second.computedAt);
+            return Status::OK();
+        }
+    }
+
+    BSONObjBuilder statsBob;
+    auto status = appendUncachedCollectionStorageStats(opCtx, nss, scale, verbose, &statsBob);
+    if (!status.isOK()) {
+        // Don't cache error replies (e.g. a dropped namespace may reappear at any time).
+        result->appendElements(statsBob.obj());
+        return status;
+    }
+
+    auto stats = statsBob.obj();
+    result->appendElements(stats);
+    result->appendDate("statsCachedAt", now);
+
+    stdx::lock_guard<Latch> lk(storageStatsCacheMutex);
+    storageStatsCache().add(key, {now, std::move(stats)});
+    return Status::OK();
+}
+
+namespace {
+
+Status appendUncachedCollectionStorageStats(OperationContext* opCtx,
+                                            const NamespaceString& nss,
+                                            int scale,
+                                            bool verbose,
+                                            BSONObjBuilder* result) {
     AutoGetCollectionForReadCommand ctx(opCtx, nss);
     Collection* collection = ctx.getCollection();  // Will be set if present
     if (!ctx.getDb() || !collection) {
@@ -130,6 +211,8 @@ Status appendCollectionStorageStats(OperationContext* opCtx,
     return Status::OK();
 }
 
+}  // namespace
+
 Status appendCollectionRecordCount(OperationContext* opCtx,
                                    const NamespaceString& nss,
                                    BSONObjBuilder* result) {
@@ -33,8 +33,12 @@
 
 #include "mongo/db/stats/top.h"
 
+#include <functional>
+
 #include "mongo/db/jsobj.h"
 #include "mongo/db/service_context.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/util/processinfo.h"
 
 namespace mongo {
 
@@ -47,6 +51,18 @@ namespace {
 
 const auto getTop = ServiceContext::declareDecoration<Top>();
 
+// Computes the shard count as the smallest power of two covering the available cores, with a
+// floor so that small machines still spread recording across a few mutexes.
+unsigned numUsageShards() {
+    unsigned target =
+        std::max(8u, static_cast<unsigned>(ProcessInfo::getNumAvailableCores()));
+    unsigned size = 1;
+    while (size < target) {
+        size <<= 1;
+    }
+    return size;
+}
+
 }  // namespace
 
 Top::UsageData::UsageData(const UsageData& older, const UsageData& newer) {
@@ -66,11 +82,43 @@ Top::CollectionData::CollectionData(const CollectionData& older, const Collectio
       remove(older.remove, newer.remove),
       commands(older.commands, newer.commands) {}
 
+void Top::CollectionData::add(const CollectionData& other) {
+    total.add(other.total);
+    readLock.add(other.readLock);
+    writeLock.add(other.writeLock);
+    queries.add(other.queries);
+    getmore.add(other.getmore);
+    insert.add(other.insert);
+    update.add(other.update);
+    remove.add(other.remove);
+    commands.add(other.commands);
+    opLatencyHistogram.add(other.opLatencyHistogram);
+}
+
 // static
 Top& Top::get(ServiceContext* service) {
     return getTop(service);
 }
 
+Top::Top() : _numShards(numUsageShards()), _shards(std::make_unique<Shard[]>(_numShards)) {}
+
+Top::Shard& Top::_shard() {
+    // Threads stick to a shard for their lifetime, so a given operation never contends with
+    // operations running on other threads unless their thread ids happen to collide.
+    return _shards[std::hash<stdx::thread::id>{}(stdx::this_thread::get_id()) & (_numShards - 1)];
+}
+
+Top::UsageMap Top::_fold() const {
+    UsageMap folded;
+    for (unsigned i = 0; i < _numShards; i++) {
+        stdx::lock_guard<SimpleMutex> lk(_shards[i].mutex);
+        for (const auto& entry : _shards[i].usage) {
+            folded[entry.first].add(entry.second);
+        }
+    }
+    return folded;
+}
+
 void Top::record(OperationContext* opCtx,
                  StringData ns,
                  LogicalOp logicalOp,
@@ -82,9 +130,10 @@ void Top::record(OperationContext* opCtx,
         return;
 
     auto hashedNs = UsageMap::hasher().hashed_key(ns);
-    stdx::lock_guard<SimpleMutex> lk(_lock);
+    Shard& shard = _shard();
+    stdx::lock_guard<SimpleMutex> lk(shard.mutex);
 
-    CollectionData& coll = _usage[hashedNs];
+    CollectionData& coll = shard.usage[hashedNs];
     _record(opCtx, coll, logicalOp, lockType, micros, readWriteType);
 }
 
@@ -134,18 +183,18 @@ void Top::_record(OperationContext* opCtx,
 }
 
 void Top::collectionDropped(const NamespaceString& nss) {
-    stdx::lock_guard<SimpleMutex> lk(_lock);
-    _usage.erase(nss.ns());
+    for (unsigned i = 0; i < _numShards; i++) {
+        stdx::lock_guard<SimpleMutex> lk(_shards[i].mutex);
+        _shards[i].usage.erase(nss.ns());
+    }
 }
 
 void Top::cloneMap(Top::UsageMap& out) const {
-    stdx::lock_guard<SimpleMutex> lk(_lock);
-    out = _usage;
+    out = _fold();
 }
 
 void Top::append(BSONObjBuilder& b) {
-    stdx::lock_guard<SimpleMutex> lk(_lock);
-    _appendToUsageMap(b, _usage);
+    _appendToUsageMap(b, _fold());
 }
 
 void Top::_appendToUsageMap(BSONObjBuilder& b, const UsageMap& map) const {
@@ -189,10 +238,16 @@ void Top::_appendStatsEntry(BSONObjBuilder& b, const char* statsName, const Usag
 void Top::appendLatencyStats(const NamespaceString& nss,
                              bool includeHistograms,
                              BSONObjBuilder* builder) {
-    auto hashedNs = UsageMap::hasher().hashed_key(nss.ns());
-    stdx::lock_guard<SimpleMutex> lk(_lock);
+    OperationLatencyHistogram folded;
+    for (unsigned i = 0; i < _numShards; i++) {
+        stdx::lock_guard<SimpleMutex> lk(_shards[i].mutex);
+        auto it = _shards[i].usage.find(nss.ns());
+        if (it != _shards[i].usage.end()) {
+            folded.add(it->second.opLatencyHistogram);
+        }
+    }
     BSONObjBuilder latencyStatsBuilder;
-    _usage[hashedNs].opLatencyHistogram.append(includeHistograms, &latencyStatsBuilder);
+    folded.append(includeHistograms, &latencyStatsBuilder);
     builder->append("ns", nss.ns());
     builder->append("latencyStats", latencyStatsBuilder.obj());
 }
@@ -200,18 +255,24 @@ void Top::appendLatencyStats(const NamespaceString& nss,
 void Top::incrementGlobalLatencyStats(OperationContext* opCtx,
                                       uint64_t latency,
                                       Command::ReadWriteType readWriteType) {
-    stdx::lock_guard<SimpleMutex> guard(_lock);
-    _incrementHistogram(opCtx, latency, &_globalHistogramStats, readWriteType);
+    Shard& shard = _shard();
+    stdx::lock_guard<SimpleMutex> guard(shard.mutex);
+    _incrementHistogram(opCtx, latency, &shard.globalHistogramStats, readWriteType);
 }
 
 void Top::appendGlobalLatencyStats(bool includeHistograms, BSONObjBuilder* builder) {
-    stdx::lock_guard<SimpleMutex> guard(_lock);
-    _globalHistogramStats.append(includeHistograms, builder);
+    OperationLatencyHistogram folded;
+    for (unsigned i = 0; i < _numShards; i++) {
+        stdx::lock_guard<SimpleMutex> guard(_shards[i].mutex);
+        folded.add(_shards[i].globalHistogramStats);
+    }
+    folded.append(includeHistograms, builder);
 }
 
 void Top::incrementGlobalTransactionLatencyStats(uint64_t latency) {
-    stdx::lock_guard<SimpleMutex> guard(_lock);
-    _globalHistogramStats.increment(latency, Command::ReadWriteType::kTransaction);
+    Shard& shard = _shard();
+    stdx::lock_guard<SimpleMutex> guard(shard.mutex);
+    shard.globalHistogramStats.increment(latency, Command::ReadWriteType::kTransaction);
 }
 
 void Top::_incrementHistogram(OperationContext* opCtx,
@@ -33,11 +33,14 @@
  * DB usage monitor.
  */
 
+#include <memory>
+
 #include <boost/date_time/posix_time/posix_time.hpp>
 
 #include "mongo/db/commands.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/stats/operation_latency_histogram.h"
+#include "mongo/stdx/new.h"
 #include "mongo/util/concurrency/mutex.h"
 #include "mongo/util/string_map.h"
 
@@ -52,7 +55,7 @@ class Top {
 public:
     static Top& get(ServiceContext* service);
 
-    Top() = default;
+    Top();
 
     struct UsageData {
         UsageData() : time(0), count(0) {}
@@ -64,6 +67,11 @@ public:
             count++;
             time += micros;
         }
+
+        void add(const UsageData& other) {
+            time += other.time;
+            count += other.count;
+        }
     };
 
     struct CollectionData {
@@ -73,6 +81,11 @@ public:
         CollectionData() {}
         CollectionData(const CollectionData& older, const CollectionData& newer);
 
+        /**
+         * Folds the counts of 'other' into this entry.
+         */
+        void add(const CollectionData& other);
+
         UsageData total;
 
         UsageData readLock;
@@ -135,6 +148,28 @@ public:
     void appendGlobalLatencyStats(bool includeHistograms, BSONObjBuilder* builder);
 
 private:
+    /**
+     * Usage is accumulated into per-shard maps, each behind its own mutex, so concurrent
+     * operations on different cores do not serialize on (or bounce) a single lock and cache
+     * line. Readers fold the shards together, which is cheap relative to how rarely the stats
+     * are reported.
+     */
+    struct alignas(stdx::hardware_destructive_interference_size) Shard {
+        mutable SimpleMutex mutex;
+        UsageMap usage;
+        OperationLatencyHistogram globalHistogramStats;
+    };
+
+    /**
+     * Returns the shard the calling thread should record into.
+     */
+    Shard& _shard();
+
+    /**
+     * Folds all shards' per-collection usage into a single map.
+     */
+    UsageMap _fold() const;
+
     void _appendToUsageMap(BSONObjBuilder& b, const UsageMap& map) const;
 
     void _appendStatsEntry(BSONObjBuilder& b, const char* statsName, const UsageData& map) const;
@@ -151,9 +186,8 @@ private:
                              OperationLatencyHistogram* histogram,
                              Command::ReadWriteType readWriteType);
 
-    mutable SimpleMutex _lock;
-    OperationLatencyHistogram _globalHistogramStats;
-    UsageMap _usage;
+    const unsigned _numShards;  // always a power of two
+    std::unique_ptr<Shard[]> _shards;
 };
 
 }  // namespace mongo
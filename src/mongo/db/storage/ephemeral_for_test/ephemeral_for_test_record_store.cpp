@@ -484,26 +484,26 @@ StatusWith<RecordData> EphemeralForTestRecordStore::updateWithDamages(
     EphemeralForTestRecord* oldRecord = recordFor(lock, loc);
     const int len = oldRecord->size;
 
-    EphemeralForTestRecord newRecord(len);
-    memcpy(newRecord.data.get(), oldRecord->data.get(), len);
-
-    opCtx->recoveryUnit()->registerChange(
-        std::make_unique<RemoveChange>(opCtx, _data, loc, *oldRecord));
-    *oldRecord = newRecord;
-
-    cappedDeleteAsNeeded(lock, opCtx);
-
-    char* root = newRecord.data.get();
+    // Damage events are applied in order and may change the record's size, so build the new
+    // record contents in a resizable buffer.
+    std::string newData(oldRecord->data.get(), len);
     mutablebson::DamageVector::const_iterator where = damages.begin();
     const mutablebson::DamageVector::const_iterator end = damages.end();
     for (; where != end; ++where) {
-        const char* sourcePtr = damageSource + where->sourceOffset;
-        char* targetPtr = root + where->targetOffset;
-        std::memcpy(targetPtr, sourcePtr, where->size);
+        newData.replace(
+            where->targetOffset, where->targetSize, damageSource + where->sourceOffset, where->size);
     }
 
+    EphemeralForTestRecord newRecord(newData.size());
+    memcpy(newRecord.data.get(), newData.data(), newData.size());
+
+    opCtx->recoveryUnit()->registerChange(
+        std::make_unique<RemoveChange>(opCtx, _data, loc, *oldRecord));
+    _data->dataSize += static_cast<int64_t>(newData.size()) - len;
     *oldRecord = newRecord;
 
+    cappedDeleteAsNeeded(lock, opCtx);
+
     return newRecord.toRecordData();
 }
 
@@ -144,7 +144,11 @@ FlowControl::FlowControl(ServiceContext* service, repl::ReplicationCoordinator*
     _jobAnchor = service->getPeriodicRunner()->makeJob(
         {"FlowControlRefresher",
          [this](Client* client) {
-             FlowControlTicketholder::get(client->getServiceContext())->refreshTo(getNumTickets());
+             const int numTickets = getNumTickets();
+             const int lowPriorityReserve = static_cast<int>(
+                 numTickets * gFlowControlNormalPriorityReservePercentage.load());
+             FlowControlTicketholder::get(client->getServiceContext())
+                 ->refreshTo(numTickets, lowPriorityReserve);
          },
          Seconds(1)});
     _jobAnchor.start();
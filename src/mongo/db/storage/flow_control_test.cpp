@@ -245,4 +245,39 @@ TEST_F(FlowControlTest, CalculatingTickets) {
                                                       currLag,
                                                       thresholdLag));
 }
+
+TEST_F(FlowControlTest, LowPriorityOperationsRespectTheNormalPriorityReserve) {
+    auto ticketholder = FlowControlTicketholder::get(getServiceContext());
+    FlowControlTicketholder::CurOp stats;
+
+    // Seven tickets for this period, the last five reserved for normal-priority operations.
+    ticketholder->refreshTo(7, 5);
+
+    {
+        ScopedAdmissionPriority lowPriority(opCtx.get(), AdmissionPriority::kLow);
+
+        // A low-priority operation may take the two tickets above the reserve without waiting.
+        ticketholder->getTicket(opCtx.get(), &stats);
+        ticketholder->getTicket(opCtx.get(), &stats);
+        ASSERT_EQ(2, stats.ticketsAcquired);
+        ASSERT_EQ(0, stats.acquireWaitCount);
+
+        // With the pool drained to the reserve, a low-priority operation must wait for the next
+        // refresh even though five tickets remain.
+        opCtx->setDeadlineByDate(Date_t::now() + Milliseconds(100), ErrorCodes::MaxTimeMSExpired);
+        ASSERT_THROWS_CODE(ticketholder->getTicket(opCtx.get(), &stats),
+                           DBException,
+                           ErrorCodes::MaxTimeMSExpired);
+        ASSERT_EQ(1, stats.acquireWaitCount);
+    }
+
+    // A normal-priority operation can drain the reserve without waiting.
+    opCtx.reset();
+    opCtx = client->makeOperationContext();
+    for (int idx = 0; idx < 5; ++idx) {
+        ticketholder->getTicket(opCtx.get(), &stats);
+    }
+    ASSERT_EQ(7, stats.ticketsAcquired);
+    ASSERT_EQ(1, stats.acquireWaitCount);
+}
 }  // namespace mongo
@@ -47,6 +47,10 @@ public:
     double cacheSizeGB;
     size_t statisticsLogDelaySecs;
 
+    // Snapshot file written on clean shutdown and loaded on startup;
+    // empty value disables snapshots.
+    std::string snapshotFile;
+
     std::string engineConfig;
     std::string collectionConfig;
     std::string indexConfig;
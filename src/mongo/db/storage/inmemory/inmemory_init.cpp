@@ -31,13 +31,18 @@ Copyright (C) 2018-present Percona and/or its affiliates. All rights reserved.
     it in the license file.
 ======= */
 
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kStorage
+
 #include "mongo/platform/basic.h"
 
+#include <boost/filesystem/operations.hpp>
+
 #include "mongo/base/init.h"
 #include "mongo/db/catalog/collection_options.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/storage/inmemory/inmemory_global_options.h"
+#include "mongo/db/storage/inmemory/inmemory_snapshot.h"
 #include "mongo/db/storage/storage_engine_init.h"
 #include "mongo/db/storage/storage_engine_impl.h"
 #include "mongo/db/storage/storage_engine_lock_file.h"
@@ -49,6 +54,7 @@ Copyright (C) 2018-present Percona and/or its affiliates. All rights reserved.
 #include "mongo/db/storage/wiredtiger/wiredtiger_record_store.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_server_status.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_util.h"
+#include "mongo/logv2/log.h"
 
 #if __has_feature(address_sanitizer)
 #include <sanitizer/lsan_interface.h>
@@ -83,6 +89,33 @@ public:
         kv->setRecordStoreExtraOptions(wiredTigerGlobalOptions.collectionConfig);
         kv->setSortedDataInterfaceExtraOptions(wiredTigerGlobalOptions.indexConfig);
 
+        if (!inMemoryGlobalOptions.snapshotFile.empty()) {
+            const std::string snapshotFile = inMemoryGlobalOptions.snapshotFile;
+            kv->setPreShutdownHook([snapshotFile](WT_CONNECTION* conn) {
+                auto status = saveInMemorySnapshot(conn, snapshotFile);
+                if (!status.isOK()) {
+                    LOGV2_WARNING(29058,
+                                  "Failed to save inMemory snapshot",
+                                  "path"_attr = snapshotFile,
+                                  "error"_attr = status);
+                }
+            });
+            if (boost::filesystem::exists(snapshotFile)) {
+                uassertStatusOKWithContext(
+                    loadInMemorySnapshot(kv->getConnection(), snapshotFile),
+                    str::stream() << "Failed to load inMemory snapshot '" << snapshotFile
+                                  << "'; remove the file to start with an empty engine");
+                // The snapshot is only valid right after the clean shutdown
+                // that wrote it; remove it so a later crash cannot resurrect
+                // stale data. A new one is written on the next clean shutdown.
+                boost::filesystem::remove(snapshotFile);
+            } else {
+                LOGV2(29059,
+                      "No inMemory snapshot to load, starting with an empty engine",
+                      "path"_attr = snapshotFile);
+            }
+        }
+
         // We must only add the server parameters to the global registry once during unit testing.
         static int setupCountForUnitTests = 0;
         if (setupCountForUnitTests == 0) {
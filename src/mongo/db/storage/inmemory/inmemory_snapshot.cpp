@@ -0,0 +1,363 @@
+// inmemory_snapshot.cpp
+
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2018-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kStorage
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/storage/inmemory/inmemory_snapshot.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#include <boost/filesystem/operations.hpp>
+
+#include "mongo/db/storage/wiredtiger/wiredtiger_util.h"
+#include "mongo/logv2/log.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/util/processinfo.h"
+#include "mongo/util/scopeguard.h"
+#include "mongo/util/str.h"
+
+namespace mongo {
+
+namespace {
+
+constexpr char kSnapshotMagic[8] = {'P', 'S', 'M', 'D', 'B', 'I', 'M', 'S'};
+constexpr uint32_t kSnapshotVersion = 1;
+
+// Loading is I/O and insert bound; a few readers saturate it.
+constexpr size_t kMaxLoadThreads = 4;
+
+struct SnapshotTable {
+    std::string uri;
+    std::string config;
+    uint64_t dataOffset = 0;
+    uint64_t entryCount = 0;
+};
+
+// The snapshot is host-private, values are stored in native byte order.
+template <typename T>
+void writeScalar(std::ofstream& out, T value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+T readScalar(std::ifstream& in) {
+    T value;
+    in.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return value;
+}
+
+void writeString(std::ofstream& out, const std::string& str) {
+    writeScalar<uint32_t>(out, str.size());
+    out.write(str.data(), str.size());
+}
+
+std::string readString(std::ifstream& in) {
+    std::string str(readScalar<uint32_t>(in), '\0');
+    in.read(&str[0], str.size());
+    return str;
+}
+
+// Closes a WT_SESSION (and thus its cursors) on scope exit.
+class SessionGuard {
+public:
+    explicit SessionGuard(WT_SESSION* session) : _session(session) {}
+    ~SessionGuard() {
+        _session->close(_session, nullptr);
+    }
+
+private:
+    WT_SESSION* _session;
+};
+
+}  // namespace
+
+Status saveInMemorySnapshot(WT_CONNECTION* conn, const std::string& path) try {
+    WT_SESSION* session = nullptr;
+    int ret = conn->open_session(conn, nullptr, nullptr, &session);
+    if (ret != 0) {
+        return wtRCToStatus(ret);
+    }
+    SessionGuard sessionGuard{session};
+
+    // Collect the uri and create configuration of every table.
+    std::vector<SnapshotTable> tables;
+    {
+        WT_CURSOR* md = nullptr;
+        ret = session->open_cursor(session, "metadata:create", nullptr, nullptr, &md);
+        if (ret != 0) {
+            return wtRCToStatus(ret);
+        }
+        const char* uri = nullptr;
+        const char* config = nullptr;
+        while ((ret = md->next(md)) == 0 && (ret = md->get_key(md, &uri)) == 0 &&
+               (ret = md->get_value(md, &config)) == 0) {
+            if (StringData(uri).startsWith("table:")) {
+                SnapshotTable table;
+                table.uri = uri;
+                table.config = config;
+                tables.push_back(std::move(table));
+            }
+        }
+        md->close(md);
+        if (ret != WT_NOTFOUND) {
+            return wtRCToStatus(ret);
+        }
+    }
+
+    const std::string tmpPath = path + ".tmp";
+    std::ofstream out{};
+    out.exceptions(std::ios::failbit | std::ios::badbit);
+    out.open(tmpPath, std::ios::binary | std::ios::trunc);
+
+    out.write(kSnapshotMagic, sizeof(kSnapshotMagic));
+    writeScalar<uint32_t>(out, kSnapshotVersion);
+    writeScalar<uint32_t>(out, 0);  // reserved
+
+    // Stream each table's raw key/value pairs.
+    uint64_t totalEntries = 0;
+    for (auto&& table : tables) {
+        table.dataOffset = out.tellp();
+
+        WT_CURSOR* c = nullptr;
+        ret = session->open_cursor(session, table.uri.c_str(), nullptr, "raw", &c);
+        if (ret != 0) {
+            return wtRCToStatus(ret);
+        }
+        WT_ITEM key, value;
+        while ((ret = c->next(c)) == 0 && (ret = c->get_key(c, &key)) == 0 &&
+               (ret = c->get_value(c, &value)) == 0) {
+            writeScalar<uint32_t>(out, key.size);
+            out.write(static_cast<const char*>(key.data), key.size);
+            writeScalar<uint32_t>(out, value.size);
+            out.write(static_cast<const char*>(value.data), value.size);
+            ++table.entryCount;
+        }
+        c->close(c);
+        if (ret != WT_NOTFOUND) {
+            return wtRCToStatus(ret);
+        }
+        totalEntries += table.entryCount;
+    }
+
+    // Table index goes last so the data can be streamed in a single pass;
+    // the final 8 bytes point back at it.
+    const uint64_t indexOffset = out.tellp();
+    writeScalar<uint32_t>(out, tables.size());
+    for (auto&& table : tables) {
+        writeString(out, table.uri);
+        writeString(out, table.config);
+        writeScalar<uint64_t>(out, table.dataOffset);
+        writeScalar<uint64_t>(out, table.entryCount);
+    }
+    writeScalar<uint64_t>(out, indexOffset);
+    out.close();
+
+    boost::filesystem::rename(tmpPath, path);
+
+    LOGV2(29061,
+          "Saved inMemory snapshot",
+          "path"_attr = path,
+          "tables"_attr = tables.size(),
+          "entries"_attr = totalEntries);
+    return Status::OK();
+} catch (const std::exception& ex) {
+    return Status(ErrorCodes::InternalError,
+                  str::stream() << "Failed to write inMemory snapshot: " << ex.what());
+}
+
+Status loadInMemorySnapshot(WT_CONNECTION* conn, const std::string& path) try {
+    std::vector<SnapshotTable> tables;
+    {
+        std::ifstream in{};
+        in.exceptions(std::ios::failbit | std::ios::badbit);
+        in.open(path, std::ios::binary);
+
+        char magic[sizeof(kSnapshotMagic)];
+        in.read(magic, sizeof(magic));
+        if (std::memcmp(magic, kSnapshotMagic, sizeof(magic)) != 0) {
+            return Status(ErrorCodes::BadValue, "inMemory snapshot file has invalid header");
+        }
+        const auto version = readScalar<uint32_t>(in);
+        if (version != kSnapshotVersion) {
+            return Status(ErrorCodes::BadValue,
+                          str::stream() << "inMemory snapshot file has unsupported version "
+                                        << version);
+        }
+
+        in.seekg(-static_cast<std::streamoff>(sizeof(uint64_t)), std::ios::end);
+        const auto indexOffset = readScalar<uint64_t>(in);
+        in.seekg(indexOffset);
+        const auto tableCount = readScalar<uint32_t>(in);
+        tables.reserve(tableCount);
+        for (uint32_t i = 0; i < tableCount; ++i) {
+            SnapshotTable table;
+            table.uri = readString(in);
+            table.config = readString(in);
+            table.dataOffset = readScalar<uint64_t>(in);
+            table.entryCount = readScalar<uint64_t>(in);
+            tables.push_back(std::move(table));
+        }
+    }
+
+    // Create all tables up front (cheap metadata operations), then load the
+    // data with parallel readers, a whole table per reader at a time.
+    {
+        WT_SESSION* session = nullptr;
+        int ret = conn->open_session(conn, nullptr, nullptr, &session);
+        if (ret != 0) {
+            return wtRCToStatus(ret);
+        }
+        SessionGuard sessionGuard{session};
+        for (auto&& table : tables) {
+            ret = session->create(session, table.uri.c_str(), table.config.c_str());
+            if (ret != 0) {
+                return wtRCToStatus(ret);
+            }
+        }
+    }
+
+    AtomicWord<unsigned> nextTable{0};
+    Mutex statusMutex = MONGO_MAKE_LATCH("loadInMemorySnapshot::statusMutex");
+    Status loadStatus = Status::OK();
+    auto recordError = [&](Status status) {
+        stdx::lock_guard<Latch> lk(statusMutex);
+        if (loadStatus.isOK()) {
+            loadStatus = std::move(status);
+        }
+    };
+
+    auto loadWorker = [&] {
+        try {
+            std::ifstream in{};
+            in.exceptions(std::ios::failbit | std::ios::badbit);
+            in.open(path, std::ios::binary);
+
+            WT_SESSION* session = nullptr;
+            int ret = conn->open_session(conn, nullptr, nullptr, &session);
+            if (ret != 0) {
+                recordError(wtRCToStatus(ret));
+                return;
+            }
+            SessionGuard sessionGuard{session};
+
+            std::vector<char> keyBuf, valueBuf;
+            for (;;) {
+                const auto i = nextTable.fetchAndAdd(1);
+                if (i >= tables.size()) {
+                    return;
+                }
+                const auto& table = tables[i];
+
+                // Bulk cursors are the fastest way to fill the freshly
+                // created, still-empty table and the snapshot was written in
+                // key order; fall back to a plain cursor if one cannot be
+                // opened.
+                WT_CURSOR* c = nullptr;
+                ret = session->open_cursor(session, table.uri.c_str(), nullptr, "bulk,raw", &c);
+                if (ret != 0) {
+                    ret = session->open_cursor(session, table.uri.c_str(), nullptr, "raw", &c);
+                }
+                if (ret != 0) {
+                    recordError(wtRCToStatus(ret));
+                    return;
+                }
+
+                in.seekg(table.dataOffset);
+                for (uint64_t n = 0; n < table.entryCount; ++n) {
+                    keyBuf.resize(readScalar<uint32_t>(in));
+                    in.read(keyBuf.data(), keyBuf.size());
+                    valueBuf.resize(readScalar<uint32_t>(in));
+                    in.read(valueBuf.data(), valueBuf.size());
+
+                    WT_ITEM key{}, value{};
+                    key.data = keyBuf.data();
+                    key.size = keyBuf.size();
+                    value.data = valueBuf.data();
+                    value.size = valueBuf.size();
+                    c->set_key(c, &key);
+                    c->set_value(c, &value);
+                    ret = c->insert(c);
+                    if (ret != 0) {
+                        c->close(c);
+                        recordError(wtRCToStatus(ret));
+                        return;
+                    }
+                }
+                ret = c->close(c);
+                if (ret != 0) {
+                    recordError(wtRCToStatus(ret));
+                    return;
+                }
+            }
+        } catch (const std::exception& ex) {
+            recordError(Status(ErrorCodes::InternalError,
+                               str::stream()
+                                   << "Failed to read inMemory snapshot: " << ex.what()));
+        }
+    };
+
+    const size_t numThreads = std::max<size_t>(
+        1,
+        std::min({tables.size(),
+                  kMaxLoadThreads,
+                  static_cast<size_t>(ProcessInfo::getNumAvailableCores())}));
+    std::vector<stdx::thread> threads;
+    threads.reserve(numThreads);
+    for (size_t i = 0; i < numThreads; ++i) {
+        threads.emplace_back(loadWorker);
+    }
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+
+    if (loadStatus.isOK()) {
+        LOGV2(29062,
+              "Loaded inMemory snapshot",
+              "path"_attr = path,
+              "tables"_attr = tables.size(),
+              "threads"_attr = numThreads);
+    }
+    return loadStatus;
+} catch (const std::exception& ex) {
+    return Status(ErrorCodes::InternalError,
+                  str::stream() << "Failed to read inMemory snapshot: " << ex.what());
+}
+
+}  // namespace mongo
@@ -0,0 +1,66 @@
+// inmemory_snapshot.h
+
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2018-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+#pragma once
+
+#include <string>
+
+#include <wiredtiger.h>
+
+#include "mongo/base/status.h"
+
+namespace mongo {
+
+/**
+ * Streams every table of the (otherwise ephemeral) inMemory engine into a
+ * compact binary snapshot file: a header, the raw key/value pairs of each
+ * table, and a trailing index with each table's create configuration and
+ * data offset. The file is written to '<path>.tmp' and atomically renamed,
+ * so an interrupted shutdown never leaves a truncated snapshot behind.
+ *
+ * The snapshot is host-private (native byte order) and only intended to be
+ * loaded by the same binary version that wrote it.
+ */
+Status saveInMemorySnapshot(WT_CONNECTION* conn, const std::string& path);
+
+/**
+ * Re-creates the tables recorded in the snapshot file and bulk-loads their
+ * contents with several parallel reader threads, each with its own session
+ * and file stream positioned via the snapshot's table index.
+ *
+ * Must be called on a freshly opened, still-empty connection before the
+ * catalog is opened.
+ */
+Status loadInMemorySnapshot(WT_CONNECTION* conn, const std::string& path);
+
+}  // namespace mongo
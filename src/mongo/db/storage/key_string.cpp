@@ -33,6 +33,7 @@
 
 #include "mongo/db/storage/key_string.h"
 
+#include <array>
 #include <cmath>
 #include <type_traits>
 
@@ -1276,6 +1277,88 @@ Decimal128 readDecimalContinuation(BufReader* reader, bool inverted, Decimal128
     return num;
 }
 
+/**
+ * Reconstructs a V0 double from its shifted integer part and the fractional bytes that follow it
+ * in the buffer. Shared by toBsonValue() and the fast decoder below.
+ */
+double readV0DoubleWithFraction(int64_t integerPart,
+                                bool isNegative,
+                                BufReader* reader,
+                                bool inverted) {
+    keyStringAssert(31209, "Integer part is too big to be a double.", integerPart < kMaxIntForDouble);
+
+    const uint64_t exponent = (64 - countLeadingZeros64(integerPart)) - 1;
+    const size_t fractionalBits = (52 - exponent);
+    const size_t fractionalBytes = (fractionalBits + 7) / 8;
+
+    // build up the bits of a double here.
+    uint64_t doubleBits = integerPart << fractionalBits;
+    doubleBits &= ~(1ULL << 52);  // clear implicit leading 1
+    doubleBits |= (exponent + 1023 /*bias*/) << 52;
+    if (isNegative) {
+        doubleBits |= (1ULL << 63);  // sign bit
+    }
+    for (size_t i = 0; i < fractionalBytes; i++) {
+        // fold in the fractional bytes
+        const uint64_t byte = readType<uint8_t>(reader, inverted);
+        doubleBits |= (byte << ((fractionalBytes - i - 1) * 8));
+    }
+
+    double number;
+    memcpy(&number, &doubleBits, sizeof(number));
+    return number;
+}
+
+/**
+ * Reads the 'fracBytes' fraction bytes of a V1 numeric value and combines them with the integer
+ * part into a full 8 bytes worth of data. Shared by toBsonValue() and the fast decoder below.
+ */
+uint64_t readV1EncodedFraction(size_t fracBytes,
+                               uint64_t integerPart,
+                               BufReader* reader,
+                               bool inverted) {
+    uint64_t encodedFraction = integerPart;
+
+    for (int fracBytesRemaining = fracBytes; fracBytesRemaining; fracBytesRemaining--)
+        encodedFraction = (encodedFraction << 8) | readType<uint8_t>(reader, inverted);
+
+    return encodedFraction;
+}
+
+/**
+ * Converts the encoded fraction of a V1 decimal into its original Decimal128 value, reading a
+ * decimal continuation if the continuation marker calls for one. The caller applies the sign and
+ * the stored exponent adjustment. Shared by toBsonValue() and the fast decoder below.
+ */
+Decimal128 readV1FractionalDecimal(uint64_t encodedFraction,
+                                   size_t fracBytes,
+                                   double bin,
+                                   int64_t integerPart,
+                                   BufReader* reader,
+                                   bool inverted) {
+    // The two lsb's are the DCM, except for the 8-byte case, where it's already known
+    DecimalContinuationMarker dcm = fracBytes
+        ? static_cast<DecimalContinuationMarker>(encodedFraction & 3)
+        : kDCMHasContinuationLargerThanDoubleRoundedUpTo15Digits;
+
+    Decimal128 dec;
+    switch (dcm) {
+        case kDCMEqualToDoubleRoundedUpTo15Digits:
+            dec = Decimal128(bin, Decimal128::kRoundTo15Digits, Decimal128::kRoundTowardPositive);
+            break;
+        case kDCMEqualToDouble:
+            dec = Decimal128(bin, Decimal128::kRoundTo34Digits, Decimal128::kRoundTowardPositive);
+            break;
+        default:
+            // Deal with decimal continuation
+            dec = integerPart > kMaxIntForDouble
+                ? Decimal128(integerPart)
+                : Decimal128(bin, Decimal128::kRoundTo34Digits, Decimal128::kRoundTowardPositive);
+            dec = readDecimalContinuation(reader, inverted, dec);
+    }
+    return dec;
+}
+
 void toBsonValue(uint8_t ctype,
                  BufReader* reader,
                  TypeBits::Reader* typeBits,
@@ -1755,40 +1838,15 @@ void toBsonValue(uint8_t ctype,
                 keyStringAssert(50832,
                                 "Expected type double for fractional part.",
                                 originalType == TypeBits::kDouble);
-                keyStringAssert(31209,
-                                "Integer part is too big to be a double.",
-                                integerPart < kMaxIntForDouble);
-
-                const uint64_t exponent = (64 - countLeadingZeros64(integerPart)) - 1;
-                const size_t fractionalBits = (52 - exponent);
-                const size_t fractionalBytes = (fractionalBits + 7) / 8;
-
-                // build up the bits of a double here.
-                uint64_t doubleBits = integerPart << fractionalBits;
-                doubleBits &= ~(1ULL << 52);  // clear implicit leading 1
-                doubleBits |= (exponent + 1023 /*bias*/) << 52;
-                if (isNegative) {
-                    doubleBits |= (1ULL << 63);  // sign bit
-                }
-                for (size_t i = 0; i < fractionalBytes; i++) {
-                    // fold in the fractional bytes
-                    const uint64_t byte = readType<uint8_t>(reader, inverted);
-                    doubleBits |= (byte << ((fractionalBytes - i - 1) * 8));
-                }
-
-                double number;
-                memcpy(&number, &doubleBits, sizeof(number));
-                *stream << number;
+                *stream << readV0DoubleWithFraction(integerPart, isNegative, reader, inverted);
                 break;
             }
 
             // KeyString V1: all numeric values with fractions have at least 8 bytes.
             // Start with integer part, and read until we have a full 8 bytes worth of data.
             const size_t fracBytes = 8 - CType::numBytesForInt(ctype);
-            uint64_t encodedFraction = integerPart;
-
-            for (int fracBytesRemaining = fracBytes; fracBytesRemaining; fracBytesRemaining--)
-                encodedFraction = (encodedFraction << 8) | readType<uint8_t>(reader, inverted);
+            const uint64_t encodedFraction =
+                readV1EncodedFraction(fracBytes, integerPart, reader, inverted);
 
             // Zero out the DCM and convert the whole binary fraction
             double bin = static_cast<double>(encodedFraction & ~3ULL) * kInvPow256[fracBytes];
@@ -1797,31 +1855,10 @@ void toBsonValue(uint8_t ctype,
                 break;
             }
 
-            // The two lsb's are the DCM, except for the 8-byte case, where it's already known
-            DecimalContinuationMarker dcm = fracBytes
-                ? static_cast<DecimalContinuationMarker>(encodedFraction & 3)
-                : kDCMHasContinuationLargerThanDoubleRoundedUpTo15Digits;
-
             // Deal with decimal cases
             keyStringAssert(50810, "Expected type Decimal.", originalType == TypeBits::kDecimal);
-            Decimal128 dec;
-            switch (dcm) {
-                case kDCMEqualToDoubleRoundedUpTo15Digits:
-                    dec = Decimal128(
-                        bin, Decimal128::kRoundTo15Digits, Decimal128::kRoundTowardPositive);
-                    break;
-                case kDCMEqualToDouble:
-                    dec = Decimal128(
-                        bin, Decimal128::kRoundTo34Digits, Decimal128::kRoundTowardPositive);
-                    break;
-                default:
-                    // Deal with decimal continuation
-                    dec = integerPart > kMaxIntForDouble
-                        ? Decimal128(integerPart)
-                        : Decimal128(
-                              bin, Decimal128::kRoundTo34Digits, Decimal128::kRoundTowardPositive);
-                    dec = readDecimalContinuation(reader, inverted, dec);
-            }
+            Decimal128 dec = readV1FractionalDecimal(
+                encodedFraction, fracBytes, bin, integerPart, reader, inverted);
             *stream << adjustDecimalExponent(typeBits, isNegative ? dec.negate() : dec);
             break;
         }
@@ -1830,6 +1867,182 @@ void toBsonValue(uint8_t ctype,
     }
 }
 
+/**
+ * Classification of ctype bytes for the table-driven fast decoder. Only ctypes whose decoding is
+ * completely handled by fastAppendValue() are classified; everything else falls back to the
+ * generic toBsonValue() switch. A fast handler must fully consume its value, including its type
+ * bits, since there is no way to rewind and retry the generic path partway through an element.
+ */
+enum class FastDecode : uint8_t {
+    kGeneric = 0,  // no fast path; use toBsonValue()
+    kSimple,       // types with no payload or a fixed-size payload
+    kStringLike,   // kStringLike: the common string (or symbol) encoding
+    kInt,          // the kNumeric...ByteInt formats: ints, longs and integer-prefixed doubles
+};
+
+constexpr std::array<FastDecode, 256> buildFastDecodeTable() {
+    std::array<FastDecode, 256> table{};
+    table[CType::kMinKey] = FastDecode::kSimple;
+    table[CType::kMaxKey] = FastDecode::kSimple;
+    table[CType::kNullish] = FastDecode::kSimple;
+    table[CType::kUndefined] = FastDecode::kSimple;
+    table[CType::kBoolTrue] = FastDecode::kSimple;
+    table[CType::kBoolFalse] = FastDecode::kSimple;
+    table[CType::kDate] = FastDecode::kSimple;
+    table[CType::kTimestamp] = FastDecode::kSimple;
+    table[CType::kOID] = FastDecode::kSimple;
+    table[CType::kStringLike] = FastDecode::kStringLike;
+    for (uint8_t ctype = CType::kNumericNegative8ByteInt; ctype <= CType::kNumericNegative1ByteInt;
+         ctype++) {
+        table[ctype] = FastDecode::kInt;
+    }
+    for (uint8_t ctype = CType::kNumericPositive1ByteInt; ctype <= CType::kNumericPositive8ByteInt;
+         ctype++) {
+        table[ctype] = FastDecode::kInt;
+    }
+    return table;
+}
+
+constexpr std::array<FastDecode, 256> kFastDecodeTable = buildFastDecodeTable();
+
+/**
+ * Unrolled decoder for the value types that dominate real index keys: strings, numbers and
+ * ObjectIds, plus the trivial fixed-size types. Appends the value directly to 'builder' under
+ * 'name', bypassing the BSONObjBuilderValueStream used by the generic path. Only called for
+ * non-inverted fields whose ctype is classified in kFastDecodeTable.
+ */
+void fastAppendValue(uint8_t ctype,
+                     BufReader* reader,
+                     TypeBits::Reader* typeBits,
+                     Version version,
+                     BSONObjBuilder* builder,
+                     StringData name) {
+    switch (ctype) {
+        case CType::kMinKey:
+            builder->appendMinKey(name);
+            return;
+        case CType::kMaxKey:
+            builder->appendMaxKey(name);
+            return;
+        case CType::kNullish:
+            builder->appendNull(name);
+            return;
+        case CType::kUndefined:
+            builder->appendUndefined(name);
+            return;
+        case CType::kBoolTrue:
+            builder->appendBool(name, true);
+            return;
+        case CType::kBoolFalse:
+            builder->appendBool(name, false);
+            return;
+        case CType::kDate:
+            builder->appendDate(name,
+                                Date_t::fromMillisSinceEpoch(
+                                    endian::bigToNative(readType<uint64_t>(reader, false)) ^
+                                    (1LL << 63)));
+            return;
+        case CType::kTimestamp:
+            builder->append(name, Timestamp(endian::bigToNative(readType<uint64_t>(reader, false))));
+            return;
+        case CType::kOID:
+            builder->append(name, OID::from(reader->skip(OID::kOIDSize)));
+            return;
+
+        case CType::kStringLike: {
+            const uint8_t originalType = typeBits->readStringLike();
+            std::string scratch;
+            StringData str = readCStringWithNuls(reader, &scratch);
+            if (originalType == TypeBits::kString) {
+                builder->append(name, str);
+            } else {
+                keyStringAssert(5347800,
+                                "Expected original type to be Symbol.",
+                                originalType == TypeBits::kSymbol);
+                builder->appendSymbol(name, str);
+            }
+            return;
+        }
+
+        default: {
+            dassert(kFastDecodeTable[ctype] == FastDecode::kInt);
+
+            bool inverted = false;
+            bool isNegative = false;
+            if (ctype <= CType::kNumericNegative1ByteInt) {
+                // Negative ints use the same format as positive ones, but with inverted bytes.
+                inverted = true;
+                isNegative = true;
+            }
+
+            const uint8_t originalType = typeBits->readNumeric();
+
+            uint64_t encodedIntegerPart = 0;
+            {
+                size_t intBytesRemaining = CType::numBytesForInt(ctype);
+                while (intBytesRemaining--) {
+                    encodedIntegerPart =
+                        (encodedIntegerPart << 8) | readType<uint8_t>(reader, inverted);
+                }
+            }
+
+            const bool haveFractionalPart = (encodedIntegerPart & 1);
+            int64_t integerPart = encodedIntegerPart >> 1;
+
+            if (!haveFractionalPart) {
+                if (isNegative)
+                    integerPart = -integerPart;
+
+                switch (originalType) {
+                    case TypeBits::kDouble:
+                        builder->append(name, double(integerPart));
+                        return;
+                    case TypeBits::kInt:
+                        builder->append(name, int(integerPart));
+                        return;
+                    case TypeBits::kLong:
+                        builder->append(name, static_cast<long long>(integerPart));
+                        return;
+                    case TypeBits::kDecimal:
+                        builder->append(name,
+                                        adjustDecimalExponent(typeBits, Decimal128(integerPart)));
+                        return;
+                    default:
+                        keyStringAsserted(5347801, "Unexpected type for positive int.");
+                }
+            }
+
+            // KeyString V0: anything fractional is a double
+            if (version == Version::V0) {
+                keyStringAssert(5347802,
+                                "Expected type double for fractional part.",
+                                originalType == TypeBits::kDouble);
+                builder->append(name,
+                                readV0DoubleWithFraction(integerPart, isNegative, reader, inverted));
+                return;
+            }
+
+            // KeyString V1: all numeric values with fractions have at least 8 bytes.
+            const size_t fracBytes = 8 - CType::numBytesForInt(ctype);
+            const uint64_t encodedFraction =
+                readV1EncodedFraction(fracBytes, integerPart, reader, inverted);
+
+            // Zero out the DCM and convert the whole binary fraction
+            double bin = static_cast<double>(encodedFraction & ~3ULL) * kInvPow256[fracBytes];
+            if (originalType == TypeBits::kDouble) {
+                builder->append(name, isNegative ? -bin : bin);
+                return;
+            }
+
+            keyStringAssert(5347803, "Expected type Decimal.", originalType == TypeBits::kDecimal);
+            Decimal128 dec = readV1FractionalDecimal(
+                encodedFraction, fracBytes, bin, integerPart, reader, inverted);
+            builder->append(name, adjustDecimalExponent(typeBits, isNegative ? dec.negate() : dec));
+            return;
+        }
+    }
+}
+
 void filterKeyFromKeyString(uint8_t ctype, BufReader* reader, bool inverted, Version version);
 
 void readBson(BufReader* reader, bool inverted, Version version) {
@@ -2475,8 +2688,13 @@ Discriminator decodeDiscriminator(const char* buffer,
     return Discriminator::kInclusive;
 }
 
-BSONObj toBsonSafe(const char* buffer, size_t len, Ordering ord, const TypeBits& typeBits) {
-    BSONObjBuilder builder;
+namespace {
+
+void toBsonInto(const char* buffer,
+                size_t len,
+                Ordering ord,
+                const TypeBits& typeBits,
+                BSONObjBuilder* builder) {
     BufReader reader(buffer, len);
     TypeBits::Reader typeBitsReader(typeBits);
     for (int i = 0; reader.remaining(); i++) {
@@ -2492,11 +2710,38 @@ BSONObj toBsonSafe(const char* buffer, size_t len, Ordering ord, const TypeBits&
 
         if (ctype == kEnd)
             break;
-        toBsonValue(ctype, &reader, &typeBitsReader, invert, typeBits.version, &(builder << ""), 1);
+
+        if (!invert && kFastDecodeTable[ctype] != FastDecode::kGeneric) {
+            fastAppendValue(ctype, &reader, &typeBitsReader, typeBits.version, builder, ""_sd);
+            continue;
+        }
+        toBsonValue(ctype, &reader, &typeBitsReader, invert, typeBits.version, &(*builder << ""), 1);
     }
+}
+
+}  // namespace
+
+BSONObj toBsonSafe(const char* buffer, size_t len, Ordering ord, const TypeBits& typeBits) {
+    BSONObjBuilder builder;
+    toBsonInto(buffer, len, ord, typeBits, &builder);
     return builder.obj();
 }
 
+void toBsonSafeRun(const std::vector<StringData>& keys,
+                   Ordering ord,
+                   const TypeBits& typeBits,
+                   const std::function<void(const BSONObj&)>& onKey) {
+    // Reuse one output buffer across the whole run; per-key BSONObjBuilder allocations are a
+    // significant fraction of the cost of decoding small keys one at a time.
+    BufBuilder buffer;
+    for (StringData key : keys) {
+        buffer.reset();
+        BSONObjBuilder builder(buffer);
+        toBsonInto(key.rawData(), key.size(), ord, typeBits, &builder);
+        onKey(builder.done());
+    }
+}
+
 BSONObj toBson(const char* buffer, size_t len, Ordering ord, const TypeBits& typeBits) noexcept {
     return toBsonSafe(buffer, len, ord, typeBits);
 }
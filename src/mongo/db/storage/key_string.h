@@ -29,7 +29,9 @@
 
 #pragma once
 
+#include <functional>
 #include <limits>
+#include <vector>
 
 #include <absl/hash/hash.h>
 
@@ -920,6 +922,19 @@ size_t getKeySize(const char* buffer, size_t len, Ordering ord, const TypeBits&
 BSONObj toBson(StringData data, Ordering ord, const TypeBits& types);
 BSONObj toBson(const char* buffer, size_t len, Ordering ord, const TypeBits& types) noexcept;
 BSONObj toBsonSafe(const char* buffer, size_t len, Ordering ord, const TypeBits& types);
+
+/**
+ * Decodes a run of KeyString buffers that share a single TypeBits pattern, as adjacent keys in an
+ * index over a homogeneous collection commonly do, and passes each decoded object to 'onKey'. The
+ * BSONObj handed to the callback does not own its buffer and must not be retained beyond the
+ * callback; copy it with BSONObj::getOwned() if it needs to outlive the call. Cheaper than calling
+ * toBsonSafe() once per key because one output buffer is reused across the whole run.
+ */
+void toBsonSafeRun(const std::vector<StringData>& keys,
+                   Ordering ord,
+                   const TypeBits& typeBits,
+                   const std::function<void(const BSONObj&)>& onKey);
+
 BSONObj toBsonSafeWithDiscriminator(const char* buffer,
                                     size_t len,
                                     Ordering ord,
@@ -63,6 +63,7 @@ enum BsonValueType {
     INT,
     DOUBLE,
     STRING,
+    OBJECTID,
     ARRAY,
     DECIMAL,
 };
@@ -79,6 +80,8 @@ BSONObj generateBson(BsonValueType bsonValueType) {
             return BSON("" << expReal(gen));
         case STRING:
             return BSON("" << std::string(expDist(gen) * kStrLenMultiplier, 'x'));
+        case OBJECTID:
+            return BSON("" << OID::gen());
         case ARRAY: {
             const int arrLen = expDist(gen) * kArrLenMultiplier;
             BSONArrayBuilder bab;
@@ -152,6 +155,30 @@ void BM_KeyStringToBSON(benchmark::State& state,
     state.SetItemsProcessed(state.iterations() * kSampleSize);
 }
 
+void BM_KeyStringToBSONRun(benchmark::State& state,
+                           const KeyString::Version version,
+                           BsonValueType bsonType) {
+    const BsonsAndKeyStrings bsonsAndKeyStrings = generateBsonsAndKeyStrings(bsonType, version);
+
+    // All samples of a homogeneous value type produce the same TypeBits pattern, so the whole
+    // sample set forms a single run.
+    std::vector<StringData> keys;
+    for (size_t i = 0; i < kSampleSize; i++) {
+        keys.push_back(
+            StringData(bsonsAndKeyStrings.keystrings[i].get(), bsonsAndKeyStrings.keystringLens[i]));
+    }
+    BufReader buf(bsonsAndKeyStrings.typebits[0].get(), bsonsAndKeyStrings.typebitsLens[0]);
+    const auto typeBits = KeyString::TypeBits::fromBuffer(version, &buf);
+
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        KeyString::toBsonSafeRun(
+            keys, ALL_ASCENDING, typeBits, [](const BSONObj& obj) { benchmark::DoNotOptimize(obj); });
+    }
+    state.SetBytesProcessed(state.iterations() * bsonsAndKeyStrings.bsonSize);
+    state.SetItemsProcessed(state.iterations() * kSampleSize);
+}
+
 void BM_KeyStringValueAssign(benchmark::State& state, BsonValueType bsonType) {
     // The KeyString version does not matter for this test.
     const auto version = KeyString::Version::V1;
@@ -242,8 +269,19 @@ BENCHMARK_CAPTURE(BM_KeyStringToBSON, V1_Double, KeyString::Version::V1, DOUBLE)
 BENCHMARK_CAPTURE(BM_KeyStringToBSON, V1_Decimal, KeyString::Version::V1, DECIMAL);
 BENCHMARK_CAPTURE(BM_KeyStringToBSON, V0_String, KeyString::Version::V0, STRING);
 BENCHMARK_CAPTURE(BM_KeyStringToBSON, V1_String, KeyString::Version::V1, STRING);
+BENCHMARK_CAPTURE(BM_KeyStringToBSON, V0_ObjectId, KeyString::Version::V0, OBJECTID);
+BENCHMARK_CAPTURE(BM_KeyStringToBSON, V1_ObjectId, KeyString::Version::V1, OBJECTID);
 BENCHMARK_CAPTURE(BM_KeyStringToBSON, V0_Array, KeyString::Version::V0, ARRAY);
 BENCHMARK_CAPTURE(BM_KeyStringToBSON, V1_Array, KeyString::Version::V1, ARRAY);
 
+BENCHMARK_CAPTURE(BM_KeyStringToBSONRun, V0_Int, KeyString::Version::V0, INT);
+BENCHMARK_CAPTURE(BM_KeyStringToBSONRun, V1_Int, KeyString::Version::V1, INT);
+BENCHMARK_CAPTURE(BM_KeyStringToBSONRun, V0_Double, KeyString::Version::V0, DOUBLE);
+BENCHMARK_CAPTURE(BM_KeyStringToBSONRun, V1_Double, KeyString::Version::V1, DOUBLE);
+BENCHMARK_CAPTURE(BM_KeyStringToBSONRun, V0_String, KeyString::Version::V0, STRING);
+BENCHMARK_CAPTURE(BM_KeyStringToBSONRun, V1_String, KeyString::Version::V1, STRING);
+BENCHMARK_CAPTURE(BM_KeyStringToBSONRun, V0_ObjectId, KeyString::Version::V0, OBJECTID);
+BENCHMARK_CAPTURE(BM_KeyStringToBSONRun, V1_ObjectId, KeyString::Version::V1, OBJECTID);
+
 }  // namespace
 }  // namespace mongo
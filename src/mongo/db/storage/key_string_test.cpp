@@ -307,6 +307,34 @@ TEST_F(KeyStringBuilderTest, Simple1) {
                      KeyString::Builder(version, b, ALL_ASCENDING, RecordId()));
 }
 
+TEST_F(KeyStringBuilderTest, ToBsonSafeRun) {
+    // Keys of a homogeneous value type all share one TypeBits pattern, so they can be decoded as
+    // a single run.
+    const BSONObj originals[] = {BSON("" << 5 << ""
+                                         << "five"),
+                                 BSON("" << 6 << ""
+                                         << "six"),
+                                 BSON("" << 7 << ""
+                                         << "seven")};
+
+    std::vector<KeyString::Builder> builders;
+    builders.reserve(std::size(originals));  // keys point into the builders' buffers.
+    std::vector<StringData> keys;
+    for (const BSONObj& orig : originals) {
+        builders.emplace_back(version, orig, ALL_ASCENDING);
+        keys.push_back(StringData(builders.back().getBuffer(), builders.back().getSize()));
+    }
+
+    size_t numDecoded = 0;
+    KeyString::toBsonSafeRun(
+        keys, ALL_ASCENDING, builders[0].getTypeBits(), [&](const BSONObj& converted) {
+            ASSERT_BSONOBJ_EQ(converted, originals[numDecoded]);
+            ASSERT(converted.binaryEqual(originals[numDecoded]));
+            numDecoded++;
+        });
+    ASSERT_EQ(numDecoded, keys.size());
+}
+
 #define ROUNDTRIP_ORDER(version, x, order)                            \
     do {                                                              \
         const BSONObj _orig = x;                                      \
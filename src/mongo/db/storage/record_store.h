@@ -349,7 +349,9 @@ public:
     /**
      * Updates the record positioned at 'loc' in-place using the deltas described by 'damages'. The
      * 'damages' vector describes contiguous ranges of 'damageSource' from which to copy and apply
-     * byte-level changes to the data. Behavior is undefined for calling this on a non-existant loc.
+     * byte-level changes to the data. Events may grow or shrink the record (see the comments on
+     * DamageEvent); they are applied in order and their target offsets must account for the size
+     * changes made by earlier events. Behavior is undefined for calling this on a non-existant loc.
      *
      * @return the updated version of the record. If unowned data is returned, then it is valid
      * until the next modification of this Record or the lock on the collection has been released.
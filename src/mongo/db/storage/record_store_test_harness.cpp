@@ -286,6 +286,7 @@ TEST(RecordStoreTestHarness, UpdateInPlace1) {
             dv[0].sourceOffset = 0;
             dv[0].targetOffset = 3;
             dv[0].size = 3;
+            dv[0].targetSize = 3;
 
             auto newRecStatus = rs->updateWithDamages(opCtx.get(), loc, s1Rec, damageSource, dv);
             ASSERT_OK(newRecStatus.getStatus());
@@ -298,6 +299,33 @@ TEST(RecordStoreTestHarness, UpdateInPlace1) {
         ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
         ASSERT_EQUALS(s2, rs->dataFor(opCtx.get(), loc).data());
     }
+
+    // A damage event whose target size is zero splices the source bytes in, growing the record.
+    std::string s3 = "aaa222ccc333bbb";
+    {
+        ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+        {
+            WriteUnitOfWork uow(opCtx.get());
+            const char* damageSource = "ccc333";
+            mutablebson::DamageVector dv;
+            dv.push_back(mutablebson::DamageEvent());
+            dv[0].sourceOffset = 0;
+            dv[0].targetOffset = 6;
+            dv[0].size = 6;
+            dv[0].targetSize = 0;
+
+            const RecordData s2Rec(s2.c_str(), s2.size() + 1);
+            auto newRecStatus = rs->updateWithDamages(opCtx.get(), loc, s2Rec, damageSource, dv);
+            ASSERT_OK(newRecStatus.getStatus());
+            ASSERT_EQUALS(s3, newRecStatus.getValue().data());
+            uow.commit();
+        }
+    }
+
+    {
+        ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+        ASSERT_EQUALS(s3, rs->dataFor(opCtx.get(), loc).data());
+    }
 }
 
 
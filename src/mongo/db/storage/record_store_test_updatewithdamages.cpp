@@ -84,12 +84,15 @@ TEST(RecordStoreTestHarness, UpdateWithDamages) {
             dv[0].sourceOffset = 5;
             dv[0].targetOffset = 0;
             dv[0].size = 2;
+            dv[0].targetSize = 2;
             dv[1].sourceOffset = 3;
             dv[1].targetOffset = 2;
             dv[1].size = 3;
+            dv[1].targetSize = 3;
             dv[2].sourceOffset = 0;
             dv[2].targetOffset = 5;
             dv[2].size = 3;
+            dv[2].targetSize = 3;
 
             WriteUnitOfWork uow(opCtx.get());
             auto newRecStatus = rs->updateWithDamages(opCtx.get(), loc, rec, data.c_str(), dv);
@@ -150,9 +153,11 @@ TEST(RecordStoreTestHarness, UpdateWithOverlappingDamageEvents) {
             dv[0].sourceOffset = 3;
             dv[0].targetOffset = 0;
             dv[0].size = 5;
+            dv[0].targetSize = 5;
             dv[1].sourceOffset = 0;
             dv[1].targetOffset = 3;
             dv[1].size = 5;
+            dv[1].targetSize = 5;
 
             WriteUnitOfWork uow(opCtx.get());
             auto newRecStatus = rs->updateWithDamages(opCtx.get(), loc, rec, data.c_str(), dv);
@@ -214,9 +219,11 @@ TEST(RecordStoreTestHarness, UpdateWithOverlappingDamageEventsReversed) {
             dv[0].sourceOffset = 0;
             dv[0].targetOffset = 3;
             dv[0].size = 5;
+            dv[0].targetSize = 5;
             dv[1].sourceOffset = 3;
             dv[1].targetOffset = 0;
             dv[1].size = 5;
+            dv[1].targetSize = 5;
 
             WriteUnitOfWork uow(opCtx.get());
             auto newRecStatus = rs->updateWithDamages(opCtx.get(), loc, rec, data.c_str(), dv);
@@ -235,6 +242,75 @@ TEST(RecordStoreTestHarness, UpdateWithOverlappingDamageEventsReversed) {
     }
 }
 
+// Insert a record and try to perform an in-place update on it with a DamageVector
+// whose events change the record's size. Size-changing events shift the offsets of
+// all later events, so each targetOffset addresses the partially-updated record.
+TEST(RecordStoreTestHarness, UpdateWithResizingDamageEvents) {
+    const auto harnessHelper(newRecordStoreHarnessHelper());
+    unique_ptr<RecordStore> rs(harnessHelper->newNonCappedRecordStore());
+
+    if (!rs->updateWithDamagesSupported())
+        return;
+
+    {
+        ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+        ASSERT_EQUALS(0, rs->numRecords(opCtx.get()));
+    }
+
+    string data = "abcdef";
+    RecordId loc;
+    const RecordData rec(data.c_str(), data.size() + 1);
+    {
+        ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+        {
+            WriteUnitOfWork uow(opCtx.get());
+            StatusWith<RecordId> res =
+                rs->insertRecord(opCtx.get(), rec.data(), rec.size(), Timestamp());
+            ASSERT_OK(res.getStatus());
+            loc = res.getValue();
+            uow.commit();
+        }
+    }
+
+    {
+        ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+        ASSERT_EQUALS(1, rs->numRecords(opCtx.get()));
+    }
+
+    string modifiedData = "aWXYZdf";
+    {
+        ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+        {
+            const char* damageSource = "WXYZ";
+            mutablebson::DamageVector dv(2);
+            // Replace the two bytes "bc" with the four bytes "WXYZ".
+            dv[0].sourceOffset = 0;
+            dv[0].targetOffset = 1;
+            dv[0].size = 4;
+            dv[0].targetSize = 2;
+            // Delete the byte "e", addressed relative to the grown record.
+            dv[1].sourceOffset = 0;
+            dv[1].targetOffset = 6;
+            dv[1].size = 0;
+            dv[1].targetSize = 1;
+
+            WriteUnitOfWork uow(opCtx.get());
+            auto newRecStatus = rs->updateWithDamages(opCtx.get(), loc, rec, damageSource, dv);
+            ASSERT_OK(newRecStatus.getStatus());
+            ASSERT_EQUALS(modifiedData, newRecStatus.getValue().data());
+            uow.commit();
+        }
+    }
+
+    {
+        ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+        {
+            RecordData record = rs->dataFor(opCtx.get(), loc);
+            ASSERT_EQUALS(modifiedData, record.data());
+        }
+    }
+}
+
 // Insert a record and try to call updateWithDamages() with an empty DamageVector.
 TEST(RecordStoreTestHarness, UpdateWithNoDamages) {
     const auto harnessHelper(newRecordStoreHarnessHelper());
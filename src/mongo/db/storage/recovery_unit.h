@@ -102,6 +102,20 @@ public:
      * layer.
      */
     virtual std::shared_ptr<StorageStats> getCopy() = 0;
+
+    /**
+     * Storage-level read cost of the operation, used to attribute cache pressure to individual
+     * operations and query shapes. Engines that do not track these return zero.
+     */
+    virtual long long bytesRead() const {
+        return 0;
+    }
+    virtual long long readTimeMicros() const {
+        return 0;
+    }
+    virtual long long cacheWaitMicros() const {
+        return 0;
+    }
 };
 
 
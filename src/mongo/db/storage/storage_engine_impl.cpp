@@ -71,6 +71,11 @@ Status StorageEngineImpl::hotBackup(OperationContext* opCtx, const std::string&
     return _engine->hotBackup(opCtx, path);
 }
 
+Status StorageEngineImpl::hotBackup(OperationContext* opCtx,
+                                    const percona::DirectoryBackupParameters& params) {
+    return _engine->hotBackup(opCtx, params);
+}
+
 Status StorageEngineImpl::hotBackupTar(OperationContext* opCtx, const std::string& path) {
     return _engine->hotBackupTar(opCtx, path);
 }
@@ -243,9 +248,11 @@ void StorageEngineImpl::loadCatalog(OperationContext* opCtx) {
             }
         }
 
-        _initCollection(opCtx, entry.catalogId, entry.nss, _options.forRepair);
-        auto maxPrefixForCollection = _catalog->getMetaData(opCtx, entry.catalogId).getMaxPrefix();
-        maxSeenPrefix = std::max(maxSeenPrefix, maxPrefixForCollection);
+        // Read each collection's catalog metadata once and share the parsed copy between
+        // collection initialization and the prefix scan below.
+        BSONCollectionCatalogEntry::MetaData md = _catalog->getMetaData(opCtx, entry.catalogId);
+        _initCollection(opCtx, entry.catalogId, entry.nss, md, _options.forRepair);
+        maxSeenPrefix = std::max(maxSeenPrefix, md.getMaxPrefix());
 
         if (entry.nss.isOrphanCollection()) {
             LOGV2(22248, "Orphaned collection found: {entry_nss}", "entry_nss"_attr = entry.nss);
@@ -263,8 +270,8 @@ void StorageEngineImpl::loadCatalog(OperationContext* opCtx) {
 void StorageEngineImpl::_initCollection(OperationContext* opCtx,
                                         RecordId catalogId,
                                         const NamespaceString& nss,
+                                        const BSONCollectionCatalogEntry::MetaData& md,
                                         bool forRepair) {
-    BSONCollectionCatalogEntry::MetaData md = _catalog->getMetaData(opCtx, catalogId);
     uassert(ErrorCodes::MustDowngrade,
             str::stream() << "Collection does not have UUID in KVCatalog. Collection: " << nss,
             md.options.uuid);
@@ -281,7 +288,7 @@ void StorageEngineImpl::_initCollection(OperationContext* opCtx,
         invariant(rs);
     }
 
-    auto uuid = _catalog->getCollectionOptions(opCtx, catalogId).uuid.get();
+    auto uuid = md.options.uuid.get();
 
     auto collectionFactory = Collection::Factory::get(getGlobalServiceContext());
     auto collection = collectionFactory->make(opCtx, nss, catalogId, uuid, std::move(rs));
@@ -763,7 +770,7 @@ Status StorageEngineImpl::repairRecordStore(OperationContext* opCtx,
     auto& collectionCatalog = CollectionCatalog::get(getGlobalServiceContext());
     auto uuid = collectionCatalog.lookupUUIDByNSS(opCtx, nss).get();
     collectionCatalog.deregisterCollection(uuid);
-    _initCollection(opCtx, catalogId, nss, false);
+    _initCollection(opCtx, catalogId, nss, _catalog->getMetaData(opCtx, catalogId), false);
 
     return status;
 }
@@ -63,6 +63,8 @@ struct StorageEngineOptions {
 class StorageEngineImpl final : public StorageEngineInterface, public StorageEngine {
     // percona::EngineExtension implementaion
     Status hotBackup(OperationContext* opCtx, const std::string& path) override;
+    Status hotBackup(OperationContext* opCtx,
+                     const percona::DirectoryBackupParameters& params) override;
     Status hotBackupTar(OperationContext* opCtx, const std::string& path) override;
     Status hotBackup(OperationContext* opCtx, const percona::S3BackupParameters& s3params) override;
     void keydbDropDatabase(const std::string& db) override;
@@ -382,9 +384,15 @@ public:
 private:
     using CollIter = std::list<std::string>::iterator;
 
+    /**
+     * 'md' is the collection's catalog metadata. It is passed in rather than re-read from the
+     * catalog so that callers iterating many collections at startup parse each catalog record
+     * only once.
+     */
     void _initCollection(OperationContext* opCtx,
                          RecordId catalogId,
                          const NamespaceString& nss,
+                         const BSONCollectionCatalogEntry::MetaData& md,
                          bool forRepair);
 
     Status _dropCollectionsNoTimestamp(OperationContext* opCtx,
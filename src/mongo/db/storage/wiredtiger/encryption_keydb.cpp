@@ -288,6 +288,10 @@ void EncryptionKeyDB::init() {
                 throw std::runtime_error(std::string("error reading parameters: ") + wiredtiger_strerror(res));
             }
         }
+
+        // preload per-database keys so that the encryption extension's key lookups during
+        // WT recovery of the main DB are served from memory instead of the keys DB
+        load_key_cache();
     } catch (std::exception& e) {
         LOGV2_ERROR(29038, "Exception in EncryptionKeyDB::init: {e}", "e"_attr = e.what());
         throw;
@@ -337,6 +341,35 @@ void EncryptionKeyDB::clone(EncryptionKeyDB *old) {
     }
 }
 
+void EncryptionKeyDB::load_key_cache() {
+    WT_CURSOR *cursor;
+    int res = _sess->open_cursor(_sess, "table:key", nullptr, nullptr, &cursor);
+    if (res) {
+        throw std::runtime_error(std::string("load_key_cache: error opening cursor: ") + wiredtiger_strerror(res));
+    }
+    std::unique_ptr<WT_CURSOR, std::function<void(WT_CURSOR*)>> cursor_guard(cursor, [](WT_CURSOR* c)
+        {
+            c->close(c);
+        });
+
+    stdx::lock_guard<Latch> lk(_lock_key);
+    while ((res = cursor->next(cursor)) == 0) {
+        char* k;
+        WT_ITEM v;
+        if ((res = cursor->get_key(cursor, &k))
+            || (res = cursor->get_value(cursor, &v)))
+            throw std::runtime_error(std::string("load_key_cache: error getting key/value from the key table: ") + wiredtiger_strerror(res));
+        invariant(v.size == _key_len);
+        auto& entry = _key_cache[std::string(k)];
+        memcpy(entry.data(), v.data, _key_len);
+    }
+    if (res != WT_NOTFOUND) {
+        throw std::runtime_error(std::string("load_key_cache: error reading key table: ") + wiredtiger_strerror(res));
+    }
+    LOGV2(29055, "Preloaded {count} encryption key(s) from the keys DB",
+          "count"_attr = _key_cache.size());
+}
+
 void EncryptionKeyDB::store_masterkey() {
     vaultWriteKey(base64::encode(StringData{(const char*)_masterkey, _key_len}));
 }
@@ -350,6 +383,20 @@ int EncryptionKeyDB::get_key_by_id(const char *keyid, size_t len, unsigned char
         return 0;
     }
 
+    // serve the key from the preloaded cache if possible; this keeps key lookups made
+    // while the main DB runs recovery off the keys DB entirely
+    {
+        std::string c_str(keyid, len);
+        stdx::lock_guard<Latch> lk(_lock_key);
+        auto it = _key_cache.find(c_str);
+        if (it != _key_cache.end()) {
+            memcpy(key, it->second.data(), _key_len);
+            if (kDebugBuild) dump_key(key, _key_len, "loaded key from key cache");
+            _encryptors[c_str] = pe;
+            return 0;
+        }
+    }
+
     int res;
     // open cursor
     WT_CURSOR *cursor;
@@ -381,6 +428,7 @@ int EncryptionKeyDB::get_key_by_id(const char *keyid, size_t len, unsigned char
         invariant(v.size == _key_len);
         memcpy(key, v.data, _key_len);
         if (kDebugBuild) dump_key(key, _key_len, "loaded key from key DB");
+        memcpy(_key_cache[c_str].data(), key, _key_len);
         _encryptors[c_str] = pe;
         return 0;
     }
@@ -406,6 +454,7 @@ int EncryptionKeyDB::get_key_by_id(const char *keyid, size_t len, unsigned char
     }
 
     if (kDebugBuild) dump_key(key, _key_len, "generated and stored key");
+    memcpy(_key_cache[c_str].data(), key, _key_len);
     _encryptors[c_str] = pe;
     return 0;
 }
@@ -432,8 +481,12 @@ int EncryptionKeyDB::delete_key_by_id(const std::string&  keyid) {
         });
 
     // delete key
-    cursor->set_key(cursor, keyid.c_str());
-    res = cursor->remove(cursor);
+    {
+        stdx::lock_guard<Latch> lk(_lock_key);
+        _key_cache.erase(keyid);
+        cursor->set_key(cursor, keyid.c_str());
+        res = cursor->remove(cursor);
+    }
     if (res) {
         LOGV2_ERROR(29046, "cursor->remove error {code}: {desc}",
                     "code"_attr = res, "desc"_attr = wiredtiger_strerror(res));
@@ -31,6 +31,7 @@ Copyright (C) 2018-present Percona and/or its affiliates. All rights reserved.
 
 #pragma once
 
+#include <array>
 #include <map>
 #include <string>
 #include <boost/multiprecision/cpp_int.hpp>
@@ -89,6 +90,10 @@ private:
 
     void init_masterkey();
 
+    // loads all per-database keys into _key_cache with a single cursor scan
+    // so that get_key_by_id calls during WT recovery do not touch the keys DB
+    void load_key_cache();
+
     static constexpr int _key_len = 32;
     const bool _just_created;
     const bool _rotation;
@@ -108,6 +113,9 @@ private:
     // get_key_by_id creates entry
     // delete_key_by_it lets encryptor know that DB was deleted and deletes entry
     std::map<std::string, void*> _encryptors;
+    // in-memory copy of the key table, preloaded by init() and kept in sync by
+    // get_key_by_id/delete_key_by_id; protected by _lock_key
+    std::map<std::string, std::array<unsigned char, _key_len>> _key_cache;
 };
 
 }  // namespace mongo
@@ -47,6 +47,9 @@ Copyright (C) 2018-present Percona and/or its affiliates. All rights reserved.
 namespace mongo {
 
 namespace {
+    // RAII wrapper around EVP_CIPHER_CTX. The protect/unprotect paths keep one
+    // instance per thread and fully re-initialize it with EVP_*Init_ex on each
+    // call, which avoids allocating and freeing a context per buffer.
     class EVPCipherCtx {
     public:
         EVPCipherCtx() {
@@ -128,7 +131,7 @@ Status WiredTigerEncryptionHooksCBC::protectTmpData(
                       "encryption output buffer not big enough");
 
     *resultLen = 0;
-    EVPCipherCtx ctx;
+    thread_local EVPCipherCtx ctx;
 
     *(uint32_t*)(out + *resultLen) = wiredtiger_checksum_crc32c(in, inLen);
     *resultLen += _chksum_len;
@@ -156,7 +159,7 @@ Status WiredTigerEncryptionHooksCBC::unprotectTmpData(
     const uint8_t* in, size_t inLen, uint8_t* out, size_t outLen, size_t* resultLen) {
 
     *resultLen = 0;
-    EVPCipherCtx ctx;
+    thread_local EVPCipherCtx ctx;
 
     uint32_t crc32c = *(uint32_t*)in;
     in += _chksum_len;
@@ -214,7 +217,7 @@ Status WiredTigerEncryptionHooksGCM::protectTmpData(
                       "encryption output buffer not big enough");
 
     *resultLen = 0;
-    EVPCipherCtx ctx;
+    thread_local EVPCipherCtx ctx;
 
     // reserve space for GCM tag
     *resultLen += _gcm_tag_len;
@@ -251,7 +254,7 @@ Status WiredTigerEncryptionHooksGCM::unprotectTmpData(
     const uint8_t* in, size_t inLen, uint8_t* out, size_t outLen, size_t* resultLen) {
 
     *resultLen = 0;
-    EVPCipherCtx ctx;
+    thread_local EVPCipherCtx ctx;
 
     // skip GCM tag
     uint8_t* gcm_tag = const_cast<uint8_t*>(in);
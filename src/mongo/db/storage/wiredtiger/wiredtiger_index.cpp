@@ -36,6 +36,8 @@
 #include <memory>
 #include <set>
 
+#include <third_party/murmurhash3/MurmurHash3.h>
+
 #include "mongo/base/checked_cast.h"
 #include "mongo/db/catalog/index_catalog_entry.h"
 #include "mongo/db/concurrency/write_conflict_exception.h"
@@ -48,6 +50,7 @@
 #include "mongo/db/storage/storage_options.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_customization_hooks.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_global_options.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_parameters_gen.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_record_store.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_util.h"
@@ -663,10 +666,7 @@ public:
                       OperationContext* opCtx,
                       bool dupsAllowed,
                       KVPrefix prefix)
-        : BulkBuilder(idx, opCtx, prefix),
-          _idx(idx),
-          _dupsAllowed(dupsAllowed),
-          _previousKeyString(idx->getKeyStringVersion()) {}
+        : BulkBuilder(idx, opCtx, prefix), _idx(idx), _dupsAllowed(dupsAllowed) {}
 
     Status addKey(const KeyString::Value& newKeyString) override {
         dassert(KeyString::decodeRecordIdAtEnd(newKeyString.getBuffer(), newKeyString.getSize())
@@ -721,9 +721,10 @@ private:
 
         invariantWTOK(_cursor->insert(_cursor));
 
-        // Don't copy the key again if dups are allowed.
+        // Don't remember the key if dups are allowed. This copy only shares the underlying
+        // buffer, so streaming duplicate detection does not re-copy every key.
         if (!_dupsAllowed)
-            _previousKeyString.resetFromBuffer(newKeyString.getBuffer(), newKeyString.getSize());
+            _previousKeyString = newKeyString;
 
         return Status::OK();
     }
@@ -757,7 +758,7 @@ private:
         RecordId id =
             KeyString::decodeRecordIdAtEnd(newKeyString.getBuffer(), newKeyString.getSize());
         _records.push_back(std::make_pair(id, newKeyString.getTypeBits()));
-        _previousKeyString.resetFromBuffer(newKeyString.getBuffer(), newKeyString.getSize());
+        _previousKeyString = newKeyString;
 
         return Status::OK();
     }
@@ -790,7 +791,9 @@ private:
 
     WiredTigerIndex* _idx;
     const bool _dupsAllowed;
-    KeyString::Builder _previousKeyString;
+    // Shares the buffer of the last key passed to addKey(); Value copies are refcounted, so
+    // tracking the previous key for duplicate detection does not copy key bytes.
+    KeyString::Value _previousKeyString;
     std::vector<std::pair<RecordId, KeyString::TypeBits>> _records;
 };
 
@@ -1352,6 +1355,75 @@ private:
 
 }  // namespace
 
+namespace {
+/**
+ * Derives the two independent 64-bit hashes used for double hashing the filter's bit positions.
+ */
+std::pair<uint64_t, uint64_t> hashUniqueKey(const char* buffer, size_t size) {
+    uint64_t hashes[2];
+    MurmurHash3_x64_128(buffer, static_cast<int>(size), 0, &hashes);
+    return {hashes[0], hashes[1]};
+}
+}  // namespace
+
+void WiredTigerUniqueKeyFilter::initializeOnce(const std::function<bool()>& isEmptyFn) {
+    if (_state.load() != kUninitialized) {
+        return;
+    }
+
+    stdx::lock_guard<Latch> lk(_initMutex);
+    if (_state.load() != kUninitialized) {
+        return;
+    }
+
+    if (!gWiredTigerUniqueIndexBloomFilter.load() || !isEmptyFn()) {
+        _state.store(kDisabled);
+        return;
+    }
+
+    _words = std::make_unique<AtomicWord<uint64_t>[]>(kNumWords);
+    _state.store(kActive);
+}
+
+bool WiredTigerUniqueKeyFilter::isDefinitelyAbsent(const char* buffer, size_t size) const {
+    if (_state.load() != kActive) {
+        return false;
+    }
+
+    auto hashes = hashUniqueKey(buffer, size);
+    for (int i = 0; i < kNumHashes; ++i) {
+        const uint64_t bit = (hashes.first + i * hashes.second) % kNumBits;
+        if (!(_words[bit / 64].load() & (uint64_t{1} << (bit % 64)))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void WiredTigerUniqueKeyFilter::recordKey(const char* buffer, size_t size) {
+    if (_state.load() != kActive) {
+        return;
+    }
+
+    if (_recordedKeys.fetchAndAdd(1) >= kMaxRecordedKeys) {
+        disable();
+        return;
+    }
+
+    auto hashes = hashUniqueKey(buffer, size);
+    for (int i = 0; i < kNumHashes; ++i) {
+        const uint64_t bit = (hashes.first + i * hashes.second) % kNumBits;
+        _words[bit / 64].fetchAndBitOr(uint64_t{1} << (bit % 64));
+    }
+}
+
+void WiredTigerUniqueKeyFilter::disableIfUninitialized() {
+    stdx::lock_guard<Latch> lk(_initMutex);
+    if (_state.load() == kUninitialized) {
+        _state.store(kDisabled);
+    }
+}
+
 WiredTigerIndexUnique::WiredTigerIndexUnique(OperationContext* ctx,
                                              const std::string& uri,
                                              const IndexDescriptor* desc,
@@ -1366,6 +1438,8 @@ std::unique_ptr<SortedDataInterface::Cursor> WiredTigerIndexUnique::newCursor(
 
 SortedDataBuilderInterface* WiredTigerIndexUnique::getBulkBuilder(OperationContext* opCtx,
                                                                   bool dupsAllowed) {
+    // Bulk-built keys bypass _insert() and would never be recorded in the key filter.
+    _keyFilter.disable();
     return new UniqueBulkBuilder(this, opCtx, dupsAllowed, _prefix);
 }
 
@@ -1564,6 +1638,8 @@ Status WiredTigerIndexUnique::_insertTimestampSafe(OperationContext* opCtx,
             KeyString::sizeWithoutRecordIdAtEnd(keyString.getBuffer(), keyString.getSize());
         WiredTigerItem prefixKeyItem(keyString.getBuffer(), sizeWithoutRecordId);
 
+        _keyFilter.initializeOnce([&] { return isEmpty(opCtx); });
+
         // First phase inserts the prefix key to prohibit concurrent insertions of same key
         setKey(c, prefixKeyItem.Get());
         c->set_value(c, emptyItem.Get());
@@ -1586,13 +1662,20 @@ Status WiredTigerIndexUnique::_insertTimestampSafe(OperationContext* opCtx,
         ret = WT_OP_CHECK(c->remove(c));
         invariantWTOK(ret);
 
-        // Second phase looks up for existence of key to avoid insertion of duplicate key
-        if (_keyExists(opCtx, c, keyString.getBuffer(), sizeWithoutRecordId)) {
+        // Second phase looks up for existence of key to avoid insertion of duplicate key. The
+        // key filter can prove the key absent without searching; concurrent insertions of the
+        // same key are still serialized by the prefix key conflict above.
+        if (!_keyFilter.isDefinitelyAbsent(keyString.getBuffer(), sizeWithoutRecordId) &&
+            _keyExists(opCtx, c, keyString.getBuffer(), sizeWithoutRecordId)) {
             auto key = KeyString::toBson(
                 keyString.getBuffer(), sizeWithoutRecordId, _ordering, keyString.getTypeBits());
             return buildDupKeyErrorStatus(
                 key, _collectionNamespace, _indexName, _keyPattern, _collation);
         }
+    } else {
+        // Inserts that allow duplicates (e.g. oplog application) may add keys before the filter
+        // has had a chance to observe the index empty; those keys could never be recorded.
+        _keyFilter.disableIfUninitialized();
     }
 
     // Now create the table key/value, the actual data record.
@@ -1610,6 +1693,14 @@ Status WiredTigerIndexUnique::_insertTimestampSafe(OperationContext* opCtx,
     if (ret != WT_DUPLICATE_KEY)
         invariantWTOK(ret);
 
+    if (_keyFilter.isActive()) {
+        // Recording the key even if the enclosing transaction later rolls back is safe: a stale
+        // bit can only cause a false positive, which falls back to the search.
+        auto sizeWithoutRecordId =
+            KeyString::sizeWithoutRecordIdAtEnd(keyString.getBuffer(), keyString.getSize());
+        _keyFilter.recordKey(keyString.getBuffer(), sizeWithoutRecordId);
+    }
+
     return Status::OK();
 }
 
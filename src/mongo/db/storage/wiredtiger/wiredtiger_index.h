@@ -29,6 +29,9 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
+
 #include <wiredtiger.h>
 
 #include "mongo/base/status_with.h"
@@ -38,6 +41,8 @@
 #include "mongo/db/storage/sorted_data_interface.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_prepare_conflict.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_recovery_unit.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/platform/mutex.h"
 
 namespace mongo {
 
@@ -188,6 +193,69 @@ protected:
     bool _isIdIndex;
 };
 
+/**
+ * An in-memory Bloom filter over the prefix keys of a timestamp-safe unique index. It answers
+ * "definitely absent" so that inserts can skip the duplicate-check search in the common case
+ * where the key has never been used before.
+ *
+ * The filter is conservative by construction. It only activates for an index that is observed to
+ * be empty, every inserted key is recorded before the insert returns, and keys are never removed,
+ * so deletions and rolled-back inserts can only produce false positives (an unnecessary search),
+ * never false negatives. This also means no invalidation is required on transaction rollback.
+ * Once the filter saturates it disables itself and every probe falls back to the search.
+ */
+class WiredTigerUniqueKeyFilter {
+public:
+    /**
+     * Decides once whether the filter can be used for this index. 'isEmptyFn' is only invoked on
+     * the first call; activation requires the index to be empty since keys inserted before this
+     * process started cannot be represented.
+     */
+    void initializeOnce(const std::function<bool()>& isEmptyFn);
+
+    bool isActive() const {
+        return _state.load() == kActive;
+    }
+
+    /**
+     * Returns true when the key is guaranteed not to be present in the index. A false return
+     * means the key may or may not be present.
+     */
+    bool isDefinitelyAbsent(const char* buffer, size_t size) const;
+
+    /**
+     * Records an inserted key. Must be called for every key inserted while the filter is active.
+     */
+    void recordKey(const char* buffer, size_t size);
+
+    void disable() {
+        _state.store(kDisabled);
+    }
+
+    /**
+     * Permanently disables the filter unless it has already been activated. Used by insert paths
+     * that may add keys before the filter gets a chance to observe the index empty.
+     */
+    void disableIfUninitialized();
+
+private:
+    enum State : int { kUninitialized, kActive, kDisabled };
+
+    // 2^23 bits (1MB) per index; with three hash functions the false-positive rate stays below a
+    // few percent until roughly a million keys have been recorded.
+    static constexpr size_t kNumBits = size_t{1} << 23;
+    static constexpr size_t kNumWords = kNumBits / 64;
+    static constexpr int kNumHashes = 3;
+
+    // Past this point the filter is saturated enough that probing it is no longer worthwhile.
+    static constexpr long long kMaxRecordedKeys = kNumBits / 8;
+
+    AtomicWord<int> _state{kUninitialized};
+    Mutex _initMutex = MONGO_MAKE_LATCH("WiredTigerUniqueKeyFilter::_initMutex");
+    std::unique_ptr<AtomicWord<uint64_t>[]> _words;
+    AtomicWord<long long> _recordedKeys{0};
+};
+
 class WiredTigerIndexUnique : public WiredTigerIndex {
 public:
     WiredTigerIndexUnique(OperationContext* ctx,
@@ -246,6 +314,7 @@ private:
     bool _keyExists(OperationContext* opCtx, WT_CURSOR* c, const char* buffer, size_t size);
 
     bool _partial;
+    WiredTigerUniqueKeyFilter _keyFilter;
 };
 
 class WiredTigerIndexStandard : public WiredTigerIndex {
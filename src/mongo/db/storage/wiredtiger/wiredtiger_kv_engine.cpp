@@ -42,10 +42,19 @@
 #endif
 
 #include <fmt/format.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
 #include <iomanip>
 #include <memory>
 #include <regex>
 
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 #include "mongo/db/storage/wiredtiger/wiredtiger_kv_engine.h"
 
 #include <boost/filesystem.hpp>
@@ -102,6 +111,7 @@
 #include "mongo/db/storage/wiredtiger/wiredtiger_size_storer.h"
 #include "mongo/logv2/log.h"
 #include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/background.h"
 #include "mongo/util/concurrency/idle_thread_block.h"
 #include "mongo/util/concurrency/ticketholder.h"
@@ -111,6 +121,7 @@
 #include "mongo/util/quick_exit.h"
 #include "mongo/util/scopeguard.h"
 #include "mongo/util/time_support.h"
+#include "mongo/util/timer.h"
 
 #if !defined(__has_feature)
 #define __has_feature(x) 0
@@ -253,6 +264,270 @@ private:
     stdx::condition_variable _condvar;
 };
 
+class WiredTigerKVEngine::WiredTigerEvictionMonitor : public BackgroundJob {
+public:
+    WiredTigerEvictionMonitor(WiredTigerKVEngine* engine, WiredTigerSessionCache* sessionCache)
+        : BackgroundJob(false /* deleteSelf */), _engine(engine), _sessionCache(sessionCache) {}
+
+    virtual string name() const {
+        return "WTEvictionMonitor";
+    }
+
+    virtual void run() {
+        ThreadClient tc(name(), getGlobalServiceContext());
+        LOGV2_DEBUG(31615, 1, "starting {name} thread", "name"_attr = name());
+
+        while (!_shuttingDown.load()) {
+            {
+                stdx::unique_lock<Latch> lock(_mutex);
+                MONGO_IDLE_THREAD_BLOCK;
+                _condvar.wait_for(lock, stdx::chrono::seconds(1));
+            }
+            if (_shuttingDown.load()) {
+                break;
+            }
+
+            _applyApplicationEvictionCap();
+            _scaleEvictionThreads();
+            _paceCheckpointDirtyWrites();
+        }
+        LOGV2_DEBUG(31616, 1, "stopping {name} thread", "name"_attr = name());
+    }
+
+    void shutdown() {
+        _shuttingDown.store(true);
+        {
+            stdx::unique_lock<Latch> lock(_mutex);
+            // Wake up the eviction monitor thread early, we do not want the shutdown
+            // to wait for us too long.
+            _condvar.notify_one();
+        }
+        wait();
+    }
+
+private:
+    // Matches the threads_min/threads_max baseline in the connection open configuration.
+    static constexpr int32_t kEvictionThreadsFloor = 4;
+
+    // WiredTiger's default eviction targets and triggers: eviction workers start at the target
+    // ratios and application threads get drafted at the trigger ratios. We scale the worker count
+    // across that band so extra workers are running before application threads are pulled in.
+    static constexpr double kCacheFillTarget = 0.80;
+    static constexpr double kCacheFillTrigger = 0.95;
+    static constexpr double kCacheDirtyTarget = 0.05;
+    static constexpr double kCacheDirtyTrigger = 0.20;
+
+    // Bounds for the dirty eviction target adjusted by the checkpoint pacing controller. The
+    // default matches kCacheDirtyTarget, WiredTiger's out-of-the-box eviction_dirty_target.
+    static constexpr int32_t kDefaultDirtyTargetPct = 5;
+    static constexpr int32_t kMinDirtyTargetPct = 1;
+
+    /**
+     * Applies runtime changes to the bound on application-thread eviction waits.
+     */
+    void _applyApplicationEvictionCap() {
+        const int32_t maxWaitMillis = gWiredTigerApplicationEvictionMaxWaitMillis.load();
+        if (maxWaitMillis == _lastAppliedMaxWaitMillis) {
+            return;
+        }
+
+        const std::string config = str::stream() << "cache_max_wait_ms=" << maxWaitMillis;
+        if (_engine->reconfigure(config.c_str()) == 0) {
+            _lastAppliedMaxWaitMillis = maxWaitMillis;
+        }
+    }
+
+    /**
+     * Samples the cache fill and dirty ratios and reconfigures the number of eviction worker
+     * threads WiredTiger may run: the full configured range under pressure, backing off one
+     * worker at a time as the pressure subsides.
+     */
+    void _scaleEvictionThreads() {
+        const int32_t threadsCap = gWiredTigerEvictionAssistThreadsMax.load();
+        if (threadsCap <= kEvictionThreadsFloor && _lastAppliedThreadsMax <= kEvictionThreadsFloor) {
+            return;
+        }
+
+        double fillRatio = 0.0;
+        double dirtyRatio = 0.0;
+        {
+            auto session = _sessionCache->getSession();
+            WT_SESSION* s = session->getSession();
+
+            auto bytesMax = WiredTigerUtil::getStatisticsValue(
+                s, "statistics:", "", WT_STAT_CONN_CACHE_BYTES_MAX);
+            auto bytesInUse = WiredTigerUtil::getStatisticsValue(
+                s, "statistics:", "", WT_STAT_CONN_CACHE_BYTES_INUSE);
+            auto bytesDirty = WiredTigerUtil::getStatisticsValue(
+                s, "statistics:", "", WT_STAT_CONN_CACHE_BYTES_DIRTY);
+            if (!bytesMax.isOK() || !bytesInUse.isOK() || !bytesDirty.isOK() ||
+                bytesMax.getValue() <= 0) {
+                return;
+            }
+
+            fillRatio = static_cast<double>(bytesInUse.getValue()) / bytesMax.getValue();
+            dirtyRatio = static_cast<double>(bytesDirty.getValue()) / bytesMax.getValue();
+        }
+
+        // 0.0 at the eviction targets, 1.0 at the triggers where application threads get drafted.
+        const double pressure = std::max(
+            (fillRatio - kCacheFillTarget) / (kCacheFillTrigger - kCacheFillTarget),
+            (dirtyRatio - kCacheDirtyTarget) / (kCacheDirtyTrigger - kCacheDirtyTarget));
+
+        int32_t target = kEvictionThreadsFloor;
+        if (pressure > 0.0) {
+            target += std::lround(std::min(pressure, 1.0) * (threadsCap - kEvictionThreadsFloor));
+            target = std::min(target, threadsCap);
+        }
+
+        // Ramp up immediately, but back off one worker per sampling interval so a short dip in
+        // pressure does not discard threads we are about to need again.
+        if (target < _lastAppliedThreadsMax) {
+            target = _lastAppliedThreadsMax - 1;
+        }
+        if (target == _lastAppliedThreadsMax) {
+            return;
+        }
+
+        const std::string config = str::stream() << "eviction=(threads_max=" << target << ")";
+        if (_engine->reconfigure(config.c_str()) == 0) {
+            LOGV2_DEBUG(31617,
+                        2,
+                        "adjusted WiredTiger eviction worker thread cap",
+                        "threadsMax"_attr = target,
+                        "cacheFillRatio"_attr = fillRatio,
+                        "cacheDirtyRatio"_attr = dirtyRatio);
+            _lastAppliedThreadsMax = target;
+        }
+    }
+
+    /**
+     * Paces dirty-page writes between checkpoints. Tracks the dirty-bytes accumulation rate and,
+     * when the cache is on course to reach the dirty eviction trigger before the next checkpoint,
+     * lowers WiredTiger's dirty eviction target one point per sample so eviction workers trickle
+     * page writes continuously instead of leaving the bulk of the write work — and the resulting
+     * I/O spike — to the checkpoint. The target is relaxed back to the default at the same rate
+     * once the projection clears the default target.
+     */
+    void _paceCheckpointDirtyWrites() {
+        auto& state = _engine->_checkpointPacingState;
+
+        if (!gWiredTigerCheckpointPacing.load()) {
+            if (_lastAppliedDirtyTargetPct != kDefaultDirtyTargetPct &&
+                _applyDirtyTarget(kDefaultDirtyTargetPct)) {
+                _lastAppliedDirtyTargetPct = kDefaultDirtyTargetPct;
+            }
+            state.active.store(false);
+            return;
+        }
+
+        int64_t bytesMax = 0;
+        int64_t bytesDirty = 0;
+        bool checkpointRunning = false;
+        {
+            auto session = _sessionCache->getSession();
+            WT_SESSION* s = session->getSession();
+
+            auto maxResult = WiredTigerUtil::getStatisticsValue(
+                s, "statistics:", "", WT_STAT_CONN_CACHE_BYTES_MAX);
+            auto dirtyResult = WiredTigerUtil::getStatisticsValue(
+                s, "statistics:", "", WT_STAT_CONN_CACHE_BYTES_DIRTY);
+            auto runningResult = WiredTigerUtil::getStatisticsValue(
+                s, "statistics:", "", WT_STAT_CONN_TXN_CHECKPOINT_RUNNING);
+            if (!maxResult.isOK() || !dirtyResult.isOK() || !runningResult.isOK() ||
+                maxResult.getValue() <= 0) {
+                return;
+            }
+            bytesMax = maxResult.getValue();
+            bytesDirty = dirtyResult.getValue();
+            checkpointRunning = runningResult.getValue() != 0;
+        }
+
+        const auto now = Date_t::now();
+
+        // Checkpoint completion resets the pacing interval.
+        if (_checkpointWasRunning && !checkpointRunning) {
+            _lastCheckpointEnd = now;
+        }
+        _checkpointWasRunning = checkpointRunning;
+
+        // Track the accumulation rate with an exponential moving average of the positive
+        // dirty-bytes deltas; negative deltas mean eviction or the checkpoint already retired
+        // writes and say nothing about how fast the workload dirties pages.
+        if (_lastDirtyBytes >= 0) {
+            const double deltaSecs =
+                durationCount<Milliseconds>(now - _lastDirtySampleTime) / 1000.0;
+            if (deltaSecs > 0) {
+                const double rate = std::max<double>(bytesDirty - _lastDirtyBytes, 0) / deltaSecs;
+                _dirtyRateBytesPerSec = 0.8 * _dirtyRateBytesPerSec + 0.2 * rate;
+            }
+        }
+        _lastDirtyBytes = bytesDirty;
+        _lastDirtySampleTime = now;
+
+        const auto checkpointDelay = Seconds(wiredTigerGlobalOptions.checkpointDelaySecs);
+        auto sinceCheckpoint = _lastCheckpointEnd != Date_t()
+            ? duration_cast<Seconds>(now - _lastCheckpointEnd)
+            : Seconds(0);
+        const double remainingSecs = std::max<double>(
+            durationCount<Seconds>(checkpointDelay) - durationCount<Seconds>(sinceCheckpoint), 1);
+
+        const double projectedDirtyPct =
+            100.0 * (bytesDirty + _dirtyRateBytesPerSec * remainingSecs) / bytesMax;
+
+        // Ratchet the dirty target one point per sample: down while the projection reaches the
+        // trigger ratio (where application threads get drafted into eviction), back up once it
+        // clears the default target.
+        int32_t desired = _lastAppliedDirtyTargetPct;
+        if (projectedDirtyPct >= kCacheDirtyTrigger * 100) {
+            desired = std::max(kMinDirtyTargetPct, desired - 1);
+        } else if (projectedDirtyPct <= kCacheDirtyTarget * 100) {
+            desired = std::min(kDefaultDirtyTargetPct, desired + 1);
+        }
+
+        if (desired != _lastAppliedDirtyTargetPct && _applyDirtyTarget(desired)) {
+            LOGV2_DEBUG(31618,
+                        2,
+                        "adjusted WiredTiger dirty eviction target for checkpoint pacing",
+                        "dirtyTargetPct"_attr = desired,
+                        "projectedDirtyPct"_attr = projectedDirtyPct,
+                        "dirtyRateBytesPerSec"_attr =
+                            static_cast<long long>(_dirtyRateBytesPerSec));
+            _lastAppliedDirtyTargetPct = desired;
+        }
+
+        state.active.store(true);
+        state.dirtyTargetPct.store(_lastAppliedDirtyTargetPct);
+        state.dirtyRateBytesPerSec.store(static_cast<long long>(_dirtyRateBytesPerSec));
+        state.projectedDirtyPct.store(static_cast<int32_t>(projectedDirtyPct));
+    }
+
+    bool _applyDirtyTarget(int32_t pct) {
+        const std::string config = str::stream() << "eviction_dirty_target=" << pct;
+        return _engine->reconfigure(config.c_str()) == 0;
+    }
+
+    WiredTigerKVEngine* _engine;
+    WiredTigerSessionCache* _sessionCache;
+    AtomicWord<bool> _shuttingDown{false};
+
+    int32_t _lastAppliedThreadsMax = kEvictionThreadsFloor;
+    int32_t _lastAppliedMaxWaitMillis = 0;
+
+    // Checkpoint pacing controller state.
+    int64_t _lastDirtyBytes = -1;
+    Date_t _lastDirtySampleTime;
+    double _dirtyRateBytesPerSec = 0.0;
+    bool _checkpointWasRunning = false;
+    Date_t _lastCheckpointEnd;
+    int32_t _lastAppliedDirtyTargetPct = kDefaultDirtyTargetPct;
+
+    Mutex _mutex = MONGO_MAKE_LATCH("WiredTigerEvictionMonitor::_mutex");  // protects _condvar
+    // The eviction monitor thread idles on this condition variable between samples of the cache
+    // pressure statistics. It can be triggered early to expedite shutdown.
+    stdx::condition_variable _condvar;
+};
+
 namespace {
 
 /**
@@ -294,6 +569,239 @@ std::string toString(const StorageEngine::OldestActiveTransactionTimestampResult
     }
 }
 
+class WiredTigerKVEngine::WiredTigerCacheWarmer : public BackgroundJob {
+public:
+    WiredTigerCacheWarmer(WiredTigerKVEngine* engine, WiredTigerSessionCache* sessionCache)
+        : BackgroundJob(false /* deleteSelf */), _engine(engine), _sessionCache(sessionCache) {}
+
+    virtual string name() const {
+        return "WTCacheWarmer";
+    }
+
+    virtual void run() {
+        ThreadClient tc(name(), getGlobalServiceContext());
+        LOGV2_DEBUG(4957907, 1, "starting {name} thread", "name"_attr = name());
+
+        if (gWiredTigerWorkingSetManifestIntervalSecs.load() > 0) {
+            _warmCacheFromManifest();
+        }
+
+        while (!_shuttingDown.load()) {
+            {
+                stdx::unique_lock<Latch> lock(_mutex);
+                MONGO_IDLE_THREAD_BLOCK;
+                _condvar.wait_for(lock, stdx::chrono::seconds(1));
+            }
+            if (_shuttingDown.load()) {
+                break;
+            }
+
+            // The interval is re-read every second so runtime changes take effect without
+            // waiting out a previously configured long interval.
+            const int32_t intervalSecs = gWiredTigerWorkingSetManifestIntervalSecs.load();
+            if (intervalSecs == 0 || ++_secondsSinceSample < intervalSecs) {
+                continue;
+            }
+            _secondsSinceSample = 0;
+            _writeManifest();
+        }
+        LOGV2_DEBUG(4957908, 1, "stopping {name} thread", "name"_attr = name());
+    }
+
+    void shutdown() {
+        _shuttingDown.store(true);
+        {
+            stdx::unique_lock<Latch> lock(_mutex);
+            // Wake up the cache warmer thread early, we do not want the shutdown
+            // to wait for us too long.
+            _condvar.notify_one();
+        }
+        wait();
+    }
+
+private:
+    static constexpr auto kManifestFilename = "WiredTiger.working_set";
+
+    // Tables holding less than this much cache are not worth recording; pre-reading them would
+    // spend the warm-up budget on data the workload barely touches.
+    static constexpr int64_t kManifestMinBytesPerTable = 1024 * 1024;
+    static constexpr size_t kManifestMaxEntries = 1024;
+
+    // How many cursor advances to make between checks of the read budget and the shutdown flag
+    // while pre-reading a table.
+    static constexpr int64_t kRowsPerBudgetCheck = 4096;
+
+    boost::filesystem::path _manifestPath() const {
+        return boost::filesystem::path(_engine->_path) / kManifestFilename;
+    }
+
+    /**
+     * Samples the per-table cache residency and saves the heaviest tables, ordered by resident
+     * bytes, to the working-set manifest. The manifest is written to a temporary file first so a
+     * crash mid-write cannot leave a truncated manifest behind.
+     */
+    void _writeManifest() {
+        UniqueWiredTigerSession session = _sessionCache->getSession();
+        WT_SESSION* s = session->getSession();
+
+        std::vector<std::pair<std::string, int64_t>> tables;
+        {
+            WT_CURSOR* c = nullptr;
+            // No need for a metadata:create cursor, since it gathers extra information and is
+            // slower.
+            int ret = s->open_cursor(s, "metadata:", nullptr, nullptr, &c);
+            if (ret != 0) {
+                return;
+            }
+            ON_BLOCK_EXIT([&] { c->close(c); });
+
+            while ((ret = c->next(c)) == 0) {
+                const char* raw;
+                c->get_key(c, &raw);
+                StringData key(raw);
+                if (!key.startsWith("table:")) {
+                    continue;
+                }
+
+                auto uri = key.toString();
+                auto bytesInCache = WiredTigerUtil::getStatisticsValue(
+                    s, "statistics:" + uri, "statistics=(fast)", WT_STAT_DSRC_CACHE_BYTES_INUSE);
+                // Tables dropped while we iterate simply fail the statistics read and are skipped.
+                if (bytesInCache.isOK() && bytesInCache.getValue() >= kManifestMinBytesPerTable) {
+                    tables.emplace_back(std::move(uri), bytesInCache.getValue());
+                }
+            }
+        }
+
+        std::sort(tables.begin(), tables.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.second > rhs.second;
+        });
+        if (tables.size() > kManifestMaxEntries) {
+            tables.resize(kManifestMaxEntries);
+        }
+
+        auto manifestPath = _manifestPath();
+        auto tmpPath = manifestPath;
+        tmpPath += ".tmp";
+        {
+            std::ofstream out(tmpPath.string());
+            for (auto&& [uri, bytes] : tables) {
+                out << uri << " " << bytes << "\n";
+            }
+            if (!out) {
+                LOGV2_WARNING(4957909,
+                              "Failed to write the WiredTiger working-set manifest",
+                              "path"_attr = tmpPath.string());
+                return;
+            }
+        }
+        boost::system::error_code ec;
+        boost::filesystem::rename(tmpPath, manifestPath, ec);
+        if (ec) {
+            LOGV2_WARNING(4957910,
+                          "Failed to install the WiredTiger working-set manifest",
+                          "path"_attr = manifestPath.string(),
+                          "error"_attr = ec.message());
+        }
+    }
+
+    /**
+     * Pre-reads the tables recorded in the working-set manifest, heaviest first, until each
+     * table's recorded residency or the global warm-up budget is reached. Runs asynchronously;
+     * the node serves traffic while the cache fills.
+     */
+    void _warmCacheFromManifest() {
+        const auto manifestPath = _manifestPath();
+        const int64_t budgetBytes =
+            static_cast<int64_t>(gWiredTigerCacheWarmupBudgetMB.load()) * 1024 * 1024;
+        if (budgetBytes == 0 || !boost::filesystem::exists(manifestPath)) {
+            return;
+        }
+
+        std::vector<std::pair<std::string, int64_t>> entries;
+        {
+            std::ifstream in(manifestPath.string());
+            std::string uri;
+            int64_t bytes;
+            while (in >> uri >> bytes) {
+                if (StringData(uri).startsWith("table:") && bytes > 0) {
+                    entries.emplace_back(std::move(uri), bytes);
+                }
+            }
+        }
+        if (entries.empty()) {
+            return;
+        }
+
+        UniqueWiredTigerSession session = _sessionCache->getSession();
+        WT_SESSION* s = session->getSession();
+
+        // The read budget is enforced against the connection-wide "bytes read into cache"
+        // statistic rather than per-row accounting, so it reflects actual I/O including
+        // internal pages.
+        auto bytesReadIntoCache = [&]() -> int64_t {
+            auto res = WiredTigerUtil::getStatisticsValue(
+                s, "statistics:", "statistics=(fast)", WT_STAT_CONN_CACHE_BYTES_READ);
+            return res.isOK() ? res.getValue() : 0;
+        };
+
+        Timer timer;
+        const int64_t startBytes = bytesReadIntoCache();
+        LOGV2(4957911,
+              "Pre-warming the WiredTiger cache from the saved working-set manifest",
+              "tables"_attr = entries.size(),
+              "budgetBytes"_attr = budgetBytes);
+
+        size_t tablesWarmed = 0;
+        for (auto&& [uri, manifestBytes] : entries) {
+            if (_shuttingDown.load() || bytesReadIntoCache() - startBytes >= budgetBytes) {
+                break;
+            }
+
+            WT_CURSOR* c = nullptr;
+            if (s->open_cursor(s, uri.c_str(), nullptr, nullptr, &c) != 0) {
+                // Dropped since the manifest was written.
+                continue;
+            }
+
+            const int64_t tableStartBytes = bytesReadIntoCache();
+            int64_t rowsSinceCheck = 0;
+            while (c->next(c) == 0) {
+                if (++rowsSinceCheck < kRowsPerBudgetCheck) {
+                    continue;
+                }
+                rowsSinceCheck = 0;
+                if (_shuttingDown.load()) {
+                    break;
+                }
+                const int64_t readSoFar = bytesReadIntoCache();
+                if (readSoFar - tableStartBytes >= manifestBytes ||
+                    readSoFar - startBytes >= budgetBytes) {
+                    break;
+                }
+            }
+            c->close(c);
+            tablesWarmed++;
+        }
+
+        LOGV2(4957912,
+              "Finished pre-warming the WiredTiger cache",
+              "tables"_attr = tablesWarmed,
+              "bytesRead"_attr = bytesReadIntoCache() - startBytes,
+              "durationMillis"_attr = timer.millis());
+    }
+
+    WiredTigerKVEngine* _engine;
+    WiredTigerSessionCache* _sessionCache;
+    AtomicWord<bool> _shuttingDown{false};
+    int32_t _secondsSinceSample = 0;
+
+    Mutex _mutex = MONGO_MAKE_LATCH("WiredTigerCacheWarmer::_mutex");  // protects _condvar
+    // The cache warmer thread idles on this condition variable between working-set samples. It
+    // can be triggered early to expedite shutdown.
+    stdx::condition_variable _condvar;
+};
+
 class WiredTigerKVEngine::WiredTigerCheckpointThread : public BackgroundJob {
 public:
     explicit WiredTigerCheckpointThread(WiredTigerKVEngine* wiredTigerKVEngine,
@@ -558,6 +1066,170 @@ Status OpenReadTransactionParam::setFromString(const std::string& str) {
     return _data->resize(num);
 }
 
+class WiredTigerKVEngine::WiredTigerTicketMonitor : public BackgroundJob {
+public:
+    explicit WiredTigerTicketMonitor(WiredTigerSessionCache* sessionCache)
+        : BackgroundJob(false /* deleteSelf */), _sessionCache(sessionCache) {}
+
+    virtual string name() const {
+        return "WTTicketMonitor";
+    }
+
+    virtual void run() {
+        ThreadClient tc(name(), getGlobalServiceContext());
+        LOGV2_DEBUG(31619, 1, "starting {name} thread", "name"_attr = name());
+
+        while (!_shuttingDown.load()) {
+            {
+                stdx::unique_lock<Latch> lock(_mutex);
+                MONGO_IDLE_THREAD_BLOCK;
+                _condvar.wait_for(lock, stdx::chrono::seconds(1));
+            }
+            if (_shuttingDown.load()) {
+                break;
+            }
+
+            if (!gWiredTigerAdaptiveTicketing.load()) {
+                // Invalidate the baselines so re-enabling starts with a fresh sample rather
+                // than a delta spanning the disabled period.
+                _readSample.valid = false;
+                _writeSample.valid = false;
+                continue;
+            }
+
+            _sampleAndAdjust();
+        }
+        LOGV2_DEBUG(31620, 1, "stopping {name} thread", "name"_attr = name());
+    }
+
+    void shutdown() {
+        _shuttingDown.store(true);
+        {
+            stdx::unique_lock<Latch> lock(_mutex);
+            // Wake up the ticket monitor thread early, we do not want the shutdown
+            // to wait for us too long.
+            _condvar.notify_one();
+        }
+        wait();
+    }
+
+private:
+    static constexpr size_t kNumHistBuckets = 5;
+
+    // Tickets are added a few at a time while the storage keeps up, and removed geometrically
+    // (20% of the pool per interval) when latency degrades, so the controller backs off faster
+    // than it ramps up.
+    static constexpr int kTicketGrowthStep = 8;
+
+    // WiredTiger's operation latency histograms only sample operations taking at least 100us, so
+    // the fractions below are relative to those; the top bucket (>= 10ms inside the storage
+    // engine) counts as slow. Shrink when slow operations exceed the trigger, and only grow while
+    // they are below the clear fraction and the pool is saturated.
+    static constexpr double kSlowOpFractionTrigger = 0.05;
+    static constexpr double kSlowOpFractionClear = 0.01;
+
+    // Do not react to intervals with too few sampled operations to be meaningful.
+    static constexpr int64_t kMinSampledOps = 100;
+
+    struct PoolSample {
+        bool valid = false;
+        int64_t histCounts[kNumHistBuckets];  // Cumulative bucket counters at the last sample.
+    };
+
+    void _sampleAndAdjust() {
+        static const int kReadStatKeys[kNumHistBuckets] = {
+            WT_STAT_CONN_PERF_HIST_OPREAD_LATENCY_LT250,
+            WT_STAT_CONN_PERF_HIST_OPREAD_LATENCY_LT500,
+            WT_STAT_CONN_PERF_HIST_OPREAD_LATENCY_LT1000,
+            WT_STAT_CONN_PERF_HIST_OPREAD_LATENCY_LT10000,
+            WT_STAT_CONN_PERF_HIST_OPREAD_LATENCY_GT10000};
+        static const int kWriteStatKeys[kNumHistBuckets] = {
+            WT_STAT_CONN_PERF_HIST_OPWRITE_LATENCY_LT250,
+            WT_STAT_CONN_PERF_HIST_OPWRITE_LATENCY_LT500,
+            WT_STAT_CONN_PERF_HIST_OPWRITE_LATENCY_LT1000,
+            WT_STAT_CONN_PERF_HIST_OPWRITE_LATENCY_LT10000,
+            WT_STAT_CONN_PERF_HIST_OPWRITE_LATENCY_GT10000};
+
+        auto session = _sessionCache->getSession();
+        WT_SESSION* s = session->getSession();
+
+        _adjustPool(s, kReadStatKeys, &_readSample, &openReadTransaction, "read");
+        _adjustPool(s, kWriteStatKeys, &_writeSample, &openWriteTransaction, "write");
+    }
+
+    void _adjustPool(WT_SESSION* s,
+                     const int* statKeys,
+                     PoolSample* sample,
+                     TicketHolder* pool,
+                     StringData poolName) {
+        int64_t counts[kNumHistBuckets];
+        for (size_t i = 0; i < kNumHistBuckets; i++) {
+            auto count = WiredTigerUtil::getStatisticsValue(s, "statistics:", "", statKeys[i]);
+            if (!count.isOK()) {
+                sample->valid = false;
+                return;
+            }
+            counts[i] = count.getValue();
+        }
+
+        int64_t sampledOps = 0;
+        int64_t slowOps = 0;
+        const bool haveBaseline = sample->valid;
+        if (haveBaseline) {
+            for (size_t i = 0; i < kNumHistBuckets; i++) {
+                sampledOps += counts[i] - sample->histCounts[i];
+            }
+            slowOps = counts[kNumHistBuckets - 1] - sample->histCounts[kNumHistBuckets - 1];
+        }
+        std::copy(counts, counts + kNumHistBuckets, sample->histCounts);
+        sample->valid = true;
+
+        if (!haveBaseline || sampledOps < kMinSampledOps) {
+            return;
+        }
+
+        const double slowFraction = static_cast<double>(slowOps) / sampledOps;
+        const int floor = gWiredTigerAdaptiveTicketingFloor.load();
+        const int ceiling = std::max(floor, gWiredTigerAdaptiveTicketingCeiling.load());
+        const int current = pool->outof();
+
+        int target = current;
+        if (slowFraction >= kSlowOpFractionTrigger) {
+            target = current - std::max(1, current / 5);
+        } else if (slowFraction <= kSlowOpFractionClear && pool->available() == 0) {
+            // The pool is the bottleneck and the storage is keeping up; admit more.
+            target = current + kTicketGrowthStep;
+        }
+        target = std::min(std::max(target, floor), ceiling);
+
+        if (target == current) {
+            return;
+        }
+
+        // Note that shrinking waits for outstanding tickets to be released, which is why the
+        // pool is never reduced by more than a fifth per interval.
+        if (pool->resize(target).isOK()) {
+            LOGV2_DEBUG(31621,
+                        2,
+                        "adjusted WiredTiger concurrent transaction tickets",
+                        "pool"_attr = poolName,
+                        "tickets"_attr = target,
+                        "slowOpFraction"_attr = slowFraction);
+        }
+    }
+
+    WiredTigerSessionCache* _sessionCache;
+    AtomicWord<bool> _shuttingDown{false};
+
+    PoolSample _readSample;
+    PoolSample _writeSample;
+
+    Mutex _mutex = MONGO_MAKE_LATCH("WiredTigerTicketMonitor::_mutex");  // protects _condvar
+    // The ticket monitor thread idles on this condition variable between samples of the
+    // operation latency statistics. It can be triggered early to expedite shutdown.
+    stdx::condition_variable _condvar;
+};
+
 namespace {
 
 StatusWith<StorageEngine::BackupInformation> getBackupInformationFromBackupCursor(
@@ -839,6 +1511,10 @@ WiredTigerKVEngine::WiredTigerKVEngine(const std::string& canonicalName,
     ss << "cache_overflow=(file_max=" << maxCacheOverflowFileSizeMB << "M),";
     ss << "session_max=33000,";
     ss << "eviction=(threads_min=4,threads_max=4),";
+    if (auto maxWaitMillis = gWiredTigerApplicationEvictionMaxWaitMillis.load()) {
+        // Bound the time an application thread may be drafted into cache eviction.
+        ss << "cache_max_wait_ms=" << maxWaitMillis << ",";
+    }
     ss << "config_base=false,";
     ss << "statistics=(fast),";
 
@@ -929,6 +1605,16 @@ WiredTigerKVEngine::WiredTigerKVEngine(const std::string& canonicalName,
         ss << ",log=(enabled=false),";
     }
 
+    if (_readOnly) {
+        // A read-only engine serves frozen data (queryable backups, analytics replicas). Open
+        // the connection in WiredTiger's read-only mode so every write path — logging,
+        // checkpoints, eviction of dirty pages — is disabled outright, and memory-map the data
+        // files so scans read directly from the OS page cache rather than copying pages into
+        // the WiredTiger cache first. This must come after the journal-to-nojournal transition
+        // above, which may still need a transient writable open to run log recovery.
+        ss << ",readonly=true,mmap_all=true,";
+    }
+
     string config = ss.str();
     LOGV2(22315, "wiredtiger_open config", "config"_attr = config);
     _openWiredTiger(path, config);
@@ -953,6 +1639,17 @@ WiredTigerKVEngine::WiredTigerKVEngine(const std::string& canonicalName,
     _sessionSweeper = std::make_unique<WiredTigerSessionSweeper>(_sessionCache.get());
     _sessionSweeper->go();
 
+    _evictionMonitor = std::make_unique<WiredTigerEvictionMonitor>(this, _sessionCache.get());
+    _evictionMonitor->go();
+
+    _ticketMonitor = std::make_unique<WiredTigerTicketMonitor>(_sessionCache.get());
+    _ticketMonitor->go();
+
+    if (!_readOnly && !_ephemeral) {
+        _cacheWarmer = std::make_unique<WiredTigerCacheWarmer>(this, _sessionCache.get());
+        _cacheWarmer->go();
+    }
+
     // Until the Replication layer installs a real callback, prevent truncating the oplog.
     setOldestActiveTransactionTimestampCallback(
         [](Timestamp) { return StatusWith(boost::make_optional(Timestamp::min())); });
@@ -1120,7 +1817,23 @@ void WiredTigerKVEngine::cleanShutdown() {
         return;
     }
 
+    if (_preShutdownHook) {
+        _preShutdownHook(_conn);
+    }
+
     // these must be the last things we do before _conn->close();
+    if (_cacheWarmer) {
+        LOGV2_DEBUG(4957913, 1, "Shutting down cache warmer thread");
+        _cacheWarmer->shutdown();
+    }
+    if (_ticketMonitor) {
+        LOGV2_DEBUG(31622, 1, "Shutting down ticket monitor thread");
+        _ticketMonitor->shutdown();
+    }
+    if (_evictionMonitor) {
+        LOGV2_DEBUG(31618, 1, "Shutting down eviction monitor thread");
+        _evictionMonitor->shutdown();
+    }
     if (_sessionSweeper) {
         LOGV2(22318, "Shutting down session sweeper thread");
         _sessionSweeper->shutdown();
@@ -1490,8 +2203,60 @@ StatusWith<std::vector<std::string>> WiredTigerKVEngine::extendBackupCursor(
     return {filenames};
 }
 
+// Block granularity WiredTiger uses to track changes for incremental backups.
+static constexpr int kIncrementalBackupGranularityMB = 16;
+
+// Token bucket limiting backup read bandwidth. The bucket holds up to one
+// second worth of tokens so short bursts are allowed but the sustained copy
+// rate stays at the configured limit and leaves disk bandwidth for foreground
+// operations.
+class BackupThrottle {
+public:
+    explicit BackupThrottle(int mbPerSec)
+        : _bytesPerSec(static_cast<double>(mbPerSec) * 1024 * 1024),
+          _tokens(_bytesPerSec),
+          _lastRefill(std::chrono::steady_clock::now()) {}
+
+    // Blocks until 'bytes' tokens are available; no-op when unlimited.
+    void awaitTokens(boost::uintmax_t bytes) {
+        if (_bytesPerSec <= 0)
+            return;
+        for (;;) {
+            auto now = std::chrono::steady_clock::now();
+            _tokens += _bytesPerSec * std::chrono::duration<double>(now - _lastRefill).count();
+            if (_tokens > _bytesPerSec)
+                _tokens = _bytesPerSec;
+            _lastRefill = now;
+            if (_tokens >= static_cast<double>(bytes)) {
+                _tokens -= static_cast<double>(bytes);
+                return;
+            }
+            stdx::this_thread::sleep_for(Milliseconds(10).toSystemDuration());
+        }
+    }
+
+private:
+    const double _bytesPerSec;  // <= 0 means unlimited
+    double _tokens;
+    std::chrono::steady_clock::time_point _lastRefill;
+};
+
+// Advise the OS to drop the just-read source file from the page cache so a
+// large backup doesn't evict the working set (Linux only; no-op elsewhere).
+static void drop_file_cache(const boost::filesystem::path& file) {
+#ifdef __linux__
+    int fd = ::open(file.string().c_str(), O_RDONLY);
+    if (fd >= 0) {
+        (void)::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        ::close(fd);
+    }
+#else
+    (void)file;
+#endif
+}
+
 // Can throw standard exceptions
-static void copy_file_size(const boost::filesystem::path& srcFile, const boost::filesystem::path& destFile, boost::uintmax_t fsize) {
+static void copy_file_size(const boost::filesystem::path& srcFile, const boost::filesystem::path& destFile, boost::uintmax_t fsize, BackupThrottle* throttle = nullptr) {
     constexpr int bufsize = 8 * 1024;
     auto buf = std::make_unique<char[]>(bufsize);
     auto bufptr = buf.get();
@@ -1508,13 +2273,58 @@ static void copy_file_size(const boost::filesystem::path& srcFile, const boost::
         boost::uintmax_t cnt = bufsize;
         if (fsize < bufsize)
             cnt = fsize;
+        if (throttle)
+            throttle->awaitTokens(cnt);
         src.read(bufptr, cnt);
         dst.write(bufptr, cnt);
         fsize -= cnt;
     }
 }
 
-Status WiredTigerKVEngine::_hotBackupPopulateLists(OperationContext* opCtx, const std::string& path, std::vector<DBTuple>& dbList, std::vector<FileTuple>& filesList) {
+// Copies only the changed blocks of a file into the same offsets of the
+// destination file; the rest of the destination stays sparse and is filled in
+// from the source backup at restore time.
+// Can throw standard exceptions
+static void copy_file_blocks(const boost::filesystem::path& srcFile,
+                             const boost::filesystem::path& destFile,
+                             boost::uintmax_t fsize,
+                             const std::vector<std::pair<boost::uintmax_t, boost::uintmax_t>>& blocks,
+                             BackupThrottle* throttle) {
+    constexpr int bufsize = 8 * 1024;
+    auto buf = std::make_unique<char[]>(bufsize);
+    auto bufptr = buf.get();
+
+    std::ifstream src{};
+    src.exceptions(std::ios::failbit | std::ios::badbit);
+    src.open(srcFile.string(), std::ios::binary);
+
+    std::ofstream dst{};
+    dst.exceptions(std::ios::failbit | std::ios::badbit);
+    dst.open(destFile.string(), std::ios::binary);
+
+    for (auto&& block : blocks) {
+        boost::uintmax_t offset = block.first;
+        if (offset >= fsize)
+            continue;
+        // The last block may extend past the end of a file which shrank since
+        // the changes were recorded.
+        boost::uintmax_t len = std::min(block.second, fsize - offset);
+        src.seekg(offset);
+        dst.seekp(offset);
+        while (len > 0) {
+            boost::uintmax_t cnt = bufsize;
+            if (len < bufsize)
+                cnt = len;
+            if (throttle)
+                throttle->awaitTokens(cnt);
+            src.read(bufptr, cnt);
+            dst.write(bufptr, cnt);
+            len -= cnt;
+        }
+    }
+}
+
+Status WiredTigerKVEngine::_hotBackupPopulateLists(OperationContext* opCtx, const std::string& path, std::vector<DBTuple>& dbList, std::vector<FileTuple>& filesList, const percona::DirectoryBackupParameters* dirParams) {
     // Nothing to backup for non-durable engine.
     if (!_durable) {
         return EngineExtension::hotBackup(opCtx, path);
@@ -1526,6 +2336,11 @@ Status WiredTigerKVEngine::_hotBackupPopulateLists(OperationContext* opCtx, cons
     const char* journalDir = "journal";
     fs::path destPath{path};
 
+    const bool incremental = dirParams && dirParams->incremental;
+    // Changed blocks are only collected when there is a source backup to diff against;
+    // the first incremental backup takes a full copy while WiredTiger starts tracking.
+    const bool collectBlocks = incremental && !dirParams->srcBackupName.empty();
+
     // Prevent any DB writes between two backup cursors
     std::unique_ptr<Lock::GlobalRead> global;
     if (_encryptionKeyDB) {
@@ -1541,8 +2356,20 @@ Status WiredTigerKVEngine::_hotBackupPopulateLists(OperationContext* opCtx, cons
         if (ret != 0) {
             return wtRCToStatus(ret);
         }
+        std::string config;
+        if (incremental) {
+            std::stringstream ss;
+            ss << "incremental=(enabled=true,force_stop=false,";
+            ss << "granularity=" << kIncrementalBackupGranularityMB << "MB,";
+            ss << "this_id=" << std::quoted(str::escape(dirParams->thisBackupName)) << ",";
+            if (collectBlocks) {
+                ss << "src_id=" << std::quoted(str::escape(dirParams->srcBackupName)) << ",";
+            }
+            ss << ")";
+            config = ss.str();
+        }
         WT_CURSOR* c = nullptr;
-        ret = s->open_cursor(s, "backup:", nullptr, nullptr, &c);
+        ret = s->open_cursor(s, "backup:", nullptr, config.empty() ? nullptr : config.c_str(), &c);
         if (ret != 0) {
             return wtRCToStatus(ret);
         }
@@ -1569,26 +2396,82 @@ Status WiredTigerKVEngine::_hotBackupPopulateLists(OperationContext* opCtx, cons
     for (auto&& db : dbList) {
         fs::path srcPath = std::get<0>(db);
         fs::path destPath = std::get<1>(db);
+        WT_SESSION* s = std::get<std::shared_ptr<WiredTigerSession>>(db)->getSession();
         WT_CURSOR* c = std::get<WT_CURSOR*>(db);
 
+        // Only the main DB's backup cursor is opened in incremental mode;
+        // the keyDB is small and is always copied in full.
+        const bool incrementalDb = collectBlocks && &db == &dbList.front();
+
         const char* filename = NULL;
         while ((ret = c->next(c)) == 0 && (ret = c->get_key(c, &filename)) == 0) {
             fs::path srcFile{srcPath / filename};
             fs::path destFile{destPath / filename};
 
-            if (fs::exists(srcFile)) {
-                filesList.emplace_back(srcFile, destFile, fs::file_size(srcFile), fs::last_write_time(srcFile));
-            } else {
+            if (!fs::exists(srcFile)) {
                 // WT-999: check journal folder.
                 srcFile = srcPath / journalDir / filename;
                 destFile = destPath / journalDir / filename;
-                if (fs::exists(srcFile)) {
-                    filesList.emplace_back(srcFile, destFile, fs::file_size(srcFile), fs::last_write_time(srcFile));
-                } else {
+                if (!fs::exists(srcFile)) {
                     return Status(ErrorCodes::InvalidPath,
                                   str::stream() << "Cannot find source file for backup :" << filename << ", source path: " << srcPath.string());
                 }
             }
+
+            FileBlocksToCopy blocks;
+            bool unchanged = false;
+            if (incrementalDb) {
+                // For each file listed, open a duplicate backup cursor and get the blocks
+                // to copy. A file with no blocks has not changed since the source backup
+                // and does not need to be copied at all; a WT_BACKUP_FILE entry means
+                // WiredTiger wants the whole file copied (e.g. log files).
+                std::stringstream ss;
+                ss << "incremental=(file=" << filename << ")";
+                const std::string config = ss.str();
+                WT_CURSOR* dupCursor = nullptr;
+                ret = s->open_cursor(s, nullptr, c, config.c_str(), &dupCursor);
+                if (ret != 0) {
+                    return wtRCToStatus(ret);
+                }
+                bool wholeFile = false;
+                while ((ret = dupCursor->next(dupCursor)) == 0) {
+                    uint64_t offset, size, type;
+                    ret = dupCursor->get_key(dupCursor, &offset, &size, &type);
+                    if (ret != 0)
+                        break;
+                    LOGV2_DEBUG(29056, 2,
+                                "Block to copy for incremental backup: filename: {filename}, "
+                                "offset: {offset}, size: {size}, type: {type}",
+                                "filename"_attr = filename,
+                                "offset"_attr = offset,
+                                "size"_attr = size,
+                                "type"_attr = type);
+                    if (type == WT_BACKUP_FILE)
+                        wholeFile = true;
+                    else
+                        blocks.emplace_back(offset, size);
+                }
+                if (ret != WT_NOTFOUND) {
+                    dupCursor->close(dupCursor);
+                    return wtRCToStatus(ret);
+                }
+                ret = dupCursor->close(dupCursor);
+                if (ret != 0) {
+                    return wtRCToStatus(ret);
+                }
+                if (wholeFile)
+                    blocks.clear();
+                else if (blocks.empty())
+                    unchanged = true;
+            }
+
+            if (unchanged) {
+                LOGV2_DEBUG(29057, 2,
+                            "Skipping unchanged file for incremental backup: {srcFile}",
+                            "srcFile"_attr = srcFile.string());
+                continue;
+            }
+            filesList.emplace_back(srcFile, destFile, fs::file_size(srcFile), fs::last_write_time(srcFile), std::move(blocks));
         }
         if (ret == WT_NOTFOUND)
             ret = 0;
@@ -1600,7 +2483,7 @@ Status WiredTigerKVEngine::_hotBackupPopulateLists(OperationContext* opCtx, cons
         const char* storageMetadata = "storage.bson";
         fs::path srcFile{fs::path{_path} / storageMetadata};
         fs::path destFile{destPath / storageMetadata};
-        filesList.emplace_back(srcFile, destFile, fs::file_size(srcFile), fs::last_write_time(srcFile));
+        filesList.emplace_back(srcFile, destFile, fs::file_size(srcFile), fs::last_write_time(srcFile), FileBlocksToCopy{});
     }
 
     // Release global lock (if it was created)
@@ -1767,6 +2650,13 @@ Status WiredTigerKVEngine::hotBackup(OperationContext* opCtx, const percona::S3B
 }
 
 Status WiredTigerKVEngine::hotBackup(OperationContext* opCtx, const std::string& path) {
+    percona::DirectoryBackupParameters params;
+    params.path = path;
+    return hotBackup(opCtx, params);
+}
+
+Status WiredTigerKVEngine::hotBackup(OperationContext* opCtx,
+                                     const percona::DirectoryBackupParameters& params) {
     namespace fs = boost::filesystem;
 
     // list of DBs to backup
@@ -1774,13 +2664,15 @@ Status WiredTigerKVEngine::hotBackup(OperationContext* opCtx, const std::string&
     // list of files to backup
     std::vector<FileTuple> filesList;
 
-    auto status = _hotBackupPopulateLists(opCtx, path, dbList, filesList);
+    auto status = _hotBackupPopulateLists(opCtx, params.path, dbList, filesList, &params);
     if (!status.isOK()) {
         return status;
     }
 
+    BackupThrottle throttle{params.rateLimitMBps};
+
     // We assume destination dir exists - it is created during command validation
-    fs::path destPath{path};
+    fs::path destPath{params.path};
     std::set<fs::path> existDirs{destPath};
 
     // Do copy files
@@ -1788,6 +2680,7 @@ Status WiredTigerKVEngine::hotBackup(OperationContext* opCtx, const std::string&
         fs::path srcFile{std::get<0>(file)};
         fs::path destFile{std::get<1>(file)};
         auto fsize{std::get<2>(file)};
+        auto&& blocks{std::get<FileBlocksToCopy>(file)};
 
         try {
             // Try creating destination directories if needed.
@@ -1799,7 +2692,13 @@ Status WiredTigerKVEngine::hotBackup(OperationContext* opCtx, const std::string&
             // fs::copy_file(srcFile, destFile, fs::copy_option::none);
             // copy_file cannot copy part of file so we need to use
             // more fine-grained copy
-            copy_file_size(srcFile, destFile, fsize);
+            if (blocks.empty())
+                copy_file_size(srcFile, destFile, fsize, &throttle);
+            else
+                copy_file_blocks(srcFile, destFile, fsize, blocks, &throttle);
+            // Backup reads are sequential and never re-read, keep them from
+            // pushing the working set out of the OS page cache.
+            drop_file_cache(srcFile);
         } catch (const fs::filesystem_error& ex) {
             return Status(ErrorCodes::InvalidPath, ex.what());
         } catch (const std::exception& ex) {
@@ -196,6 +196,8 @@ public:
         OperationContext* opCtx) override;
 
     Status hotBackup(OperationContext* opCtx, const std::string& path) override;
+    Status hotBackup(OperationContext* opCtx,
+                     const percona::DirectoryBackupParameters& params) override;
     Status hotBackupTar(OperationContext* opCtx, const std::string& path) override;
     Status hotBackup(OperationContext* opCtx, const percona::S3BackupParameters& s3params) override;
 
@@ -275,6 +277,14 @@ public:
     WT_CONNECTION* getConnection() {
         return _conn;
     }
+
+    // Invoked at the start of cleanShutdown() while the connection is still
+    // usable; the inMemory engine uses it to snapshot an otherwise ephemeral
+    // connection before it goes away.
+    void setPreShutdownHook(std::function<void(WT_CONNECTION*)> hook) {
+        _preShutdownHook = std::move(hook);
+    }
+
     void dropSomeQueuedIdents();
     std::list<WiredTigerCachedCursor> filterCursorsWithQueuedDrops(
         std::list<WiredTigerCachedCursor>* cache);
@@ -317,6 +327,21 @@ public:
 
     static void appendGlobalStats(BSONObjBuilder& b);
 
+    /**
+     * Point-in-time state of the checkpoint pacing controller. Updated by the eviction monitor
+     * and reported in the storage engine's serverStatus section.
+     */
+    struct CheckpointPacingState {
+        AtomicWord<bool> active{false};
+        AtomicWord<int32_t> dirtyTargetPct{0};
+        AtomicWord<long long> dirtyRateBytesPerSec{0};
+        AtomicWord<int32_t> projectedDirtyPct{0};
+    };
+
+    const CheckpointPacingState& checkpointPacingState() const {
+        return _checkpointPacingState;
+    }
+
     Timestamp getStableTimestamp() const override;
     Timestamp getOldestTimestamp() const override;
     Timestamp getCheckpointTimestamp() const override;
@@ -380,14 +405,19 @@ public:
 
 private:
     class WiredTigerSessionSweeper;
+    class WiredTigerEvictionMonitor;
+    class WiredTigerTicketMonitor;
+    class WiredTigerCacheWarmer;
     class WiredTigerCheckpointThread;
 
     // srcPath, destPath, session, cursor
     typedef std::tuple<boost::filesystem::path, boost::filesystem::path, std::shared_ptr<WiredTigerSession>, WT_CURSOR*> DBTuple;
-    // srcPath, destPath, filename, size to copy
-    typedef std::tuple<boost::filesystem::path, boost::filesystem::path, boost::uintmax_t, std::time_t> FileTuple;
+    // (offset, length) of a block changed since the source incremental backup
+    typedef std::vector<std::pair<boost::uintmax_t, boost::uintmax_t>> FileBlocksToCopy;
+    // srcPath, destPath, size to copy, mtime, changed blocks (empty means copy the whole file)
+    typedef std::tuple<boost::filesystem::path, boost::filesystem::path, boost::uintmax_t, std::time_t, FileBlocksToCopy> FileTuple;
 
-    Status _hotBackupPopulateLists(OperationContext* opCtx, const std::string& path, std::vector<DBTuple>& dbList, std::vector<FileTuple>& filesList);
+    Status _hotBackupPopulateLists(OperationContext* opCtx, const std::string& path, std::vector<DBTuple>& dbList, std::vector<FileTuple>& filesList, const percona::DirectoryBackupParameters* dirParams = nullptr);
 
     /**
      * Opens a connection on the WiredTiger database 'path' with the configuration 'wtOpenConfig'.
@@ -446,6 +476,7 @@ private:
 
     std::unique_ptr<EncryptionKeyDB> _encryptionKeyDB;
     WT_CONNECTION* _conn;
+    std::function<void(WT_CONNECTION*)> _preShutdownHook;
     WiredTigerFileVersion _fileVersion;
     WiredTigerEventHandler _eventHandler;
     std::unique_ptr<WiredTigerSessionCache> _sessionCache;
@@ -477,6 +508,10 @@ private:
     const bool _keepDataHistory = true;
 
     std::unique_ptr<WiredTigerSessionSweeper> _sessionSweeper;
+    std::unique_ptr<WiredTigerEvictionMonitor> _evictionMonitor;
+    CheckpointPacingState _checkpointPacingState;
+    std::unique_ptr<WiredTigerTicketMonitor> _ticketMonitor;
+    std::unique_ptr<WiredTigerCacheWarmer> _cacheWarmer;
     std::unique_ptr<WiredTigerCheckpointThread> _checkpointThread;
 
     std::string _rsOptions;
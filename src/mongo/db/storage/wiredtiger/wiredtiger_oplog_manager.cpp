@@ -34,6 +34,7 @@
 #include <cstring>
 
 #include "mongo/db/concurrency/lock_state.h"
+#include "mongo/db/operation_context.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_kv_engine.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_oplog_manager.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_util.h"
@@ -41,6 +42,8 @@
 #include "mongo/platform/mutex.h"
 #include "mongo/util/concurrency/idle_thread_block.h"
 #include "mongo/util/scopeguard.h"
+#include "mongo/util/time_support.h"
+#include "mongo/util/timer.h"
 
 namespace mongo {
 
@@ -101,13 +104,39 @@ void WiredTigerOplogManager::haltVisibilityThread() {
 }
 
 void WiredTigerOplogManager::triggerOplogVisibilityUpdate() {
+    // Every committed oplog write triggers a visibility update, so this doubles as the activity
+    // signal behind waitForIdleOplogWindow().
+    _lastOplogWriteActivityMicros.store(curTimeMicros64());
+
+    // Avoid the mutex entirely when an update is already pending: a true load here is ordered
+    // before the visibility thread's reset of the flag, which in turn precedes its all_durable
+    // fetch, so this commit is guaranteed to be covered by the pending update. At high insert
+    // rates this leaves only the first commit after each visibility round taking the lock.
+    if (_opsWaitingForOplogVisibility.load()) {
+        return;
+    }
+
     stdx::lock_guard<Latch> lk(_oplogVisibilityStateMutex);
-    if (!_opsWaitingForOplogVisibility) {
-        _opsWaitingForOplogVisibility = true;
+    if (!_opsWaitingForOplogVisibility.swap(true)) {
         _oplogVisibilityThreadCV.notify_one();
     }
 }
 
+void WiredTigerOplogManager::waitForIdleOplogWindow(OperationContext* opCtx,
+                                                    Milliseconds idleWindow,
+                                                    Milliseconds maxWait) {
+    Timer timer;
+    while (Milliseconds(timer.millis()) < maxWait) {
+        const auto lastActivityMicros = _lastOplogWriteActivityMicros.load();
+        const auto sinceLastWrite = Microseconds(
+            static_cast<long long>(curTimeMicros64() - lastActivityMicros));
+        if (sinceLastWrite >= idleWindow) {
+            return;
+        }
+        opCtx->sleepFor(std::min(idleWindow, maxWait - Milliseconds(timer.millis())));
+    }
+}
+
 void WiredTigerOplogManager::waitForAllEarlierOplogWritesToBeVisible(
     const WiredTigerRecordStore* oplogRecordStore, OperationContext* opCtx) {
     invariant(opCtx->lockState()->isNoop() || !opCtx->lockState()->inAWriteUnitOfWork());
@@ -132,7 +161,7 @@ void WiredTigerOplogManager::waitForAllEarlierOplogWritesToBeVisible(
     // Close transaction before we wait.
     opCtx->recoveryUnit()->abandonSnapshot();
 
-    stdx::unique_lock<Latch> lk(_oplogVisibilityStateMutex);
+    stdx::unique_lock<Latch> lk(_oplogVisibilityWaiterMutex);
 
     // Out of order writes to the oplog always call triggerOplogVisibilityUpdate() on commit to
     // prompt the OplogVisibilityThread to run and update the oplog visibility. We simply need to
@@ -180,7 +209,7 @@ void WiredTigerOplogManager::_updateOplogVisibilityLoop(WiredTigerSessionCache*
         {
             MONGO_IDLE_THREAD_BLOCK;
             _oplogVisibilityThreadCV.wait(
-                lk, [&] { return _shuttingDown || _opsWaitingForOplogVisibility; });
+                lk, [&] { return _shuttingDown || _opsWaitingForOplogVisibility.load(); });
 
             // If we are not shutting down and nobody is actively waiting for the oplog to become
             // visible, delay a bit to batch more requests into one update and reduce system load.
@@ -188,7 +217,7 @@ void WiredTigerOplogManager::_updateOplogVisibilityLoop(WiredTigerSessionCache*
             auto deadline = now + Milliseconds(kDelayMillis);
 
             auto wakeUpEarlyForWaitersPredicate = [&] {
-                return _shuttingDown || _opsWaitingForOplogVisibility ||
+                return _shuttingDown || _opsWaitingForOplogVisibility.load() ||
                     oplogRecordStore->haveCappedWaiters();
             };
 
@@ -212,8 +241,8 @@ void WiredTigerOplogManager::_updateOplogVisibilityLoop(WiredTigerSessionCache*
             return;
         }
 
-        invariant(_opsWaitingForOplogVisibility);
-        _opsWaitingForOplogVisibility = false;
+        invariant(_opsWaitingForOplogVisibility.load());
+        _opsWaitingForOplogVisibility.store(false);
 
         lk.unlock();
 
@@ -260,7 +289,12 @@ void WiredTigerOplogManager::setOplogReadTimestamp(Timestamp ts) {
 
 void WiredTigerOplogManager::_setOplogReadTimestamp(WithLock, uint64_t newTimestamp) {
     _oplogReadTimestamp.store(newTimestamp);
-    _oplogEntriesBecameVisibleCV.notify_all();
+    {
+        // Taking the waiter mutex orders this publication after any waiter's predicate check, so
+        // a reader that saw the old timestamp is guaranteed to be blocked and get the wakeup.
+        stdx::lock_guard<Latch> lk(_oplogVisibilityWaiterMutex);
+        _oplogEntriesBecameVisibleCV.notify_all();
+    }
     LOGV2_DEBUG(22374,
                 2,
                 "Updating the oplogReadTimestamp.",
@@ -108,6 +108,16 @@ public:
      */
     uint64_t fetchAllDurableValue(WT_CONNECTION* conn);
 
+    /**
+     * Waits until no oplog write has committed for 'idleWindow', or until 'maxWait' has elapsed,
+     * whichever comes first. Background maintenance (such as oplog truncation) uses this to
+     * schedule its work into lulls in oplog ingest rather than competing with it; the bound
+     * guarantees progress even under sustained load. Throws if 'opCtx' is interrupted.
+     */
+    void waitForIdleOplogWindow(OperationContext* opCtx,
+                                Milliseconds idleWindow,
+                                Milliseconds maxWait);
+
 private:
     /**
      * Runs the oplog visibility updates when signaled by triggerOplogVisibilityUpdate() until
@@ -120,20 +130,36 @@ private:
 
     AtomicWord<unsigned long long> _oplogReadTimestamp{0};
 
+    // Time of the most recent committed oplog write, as reported by curTimeMicros64(). Zero until
+    // the first write; read by waitForIdleOplogWindow() to find lulls in oplog ingest.
+    AtomicWord<unsigned long long> _lastOplogWriteActivityMicros{0};
+
     stdx::thread _oplogVisibilityThread;
 
     // Signaled to trigger the oplog visibility thread to run.
     mutable stdx::condition_variable _oplogVisibilityThreadCV;
 
-    // Signaled when oplog visibility has been updated.
+    // Signaled when oplog visibility has been updated. Paired with '_oplogVisibilityWaiterMutex'
+    // rather than the state mutex so that waiting readers never contend with committing writers
+    // or the visibility thread's own state handling.
     mutable stdx::condition_variable _oplogEntriesBecameVisibleCV;
 
-    // Protects the state below.
+    // Serializes waiters on '_oplogEntriesBecameVisibleCV'. The timestamp itself is published
+    // through the '_oplogReadTimestamp' atomic; this mutex only exists to make the wait/notify
+    // handshake race-free.
+    mutable Mutex _oplogVisibilityWaiterMutex =
+        MONGO_MAKE_LATCH("WiredTigerOplogManager::_oplogVisibilityWaiterMutex");
+
+    // Protects the visibility thread state below.
     mutable Mutex _oplogVisibilityStateMutex =
         MONGO_MAKE_LATCH("WiredTigerOplogManager::_oplogVisibilityStateMutex");
 
     bool _isRunning = false;
     bool _shuttingDown = false;
-    bool _opsWaitingForOplogVisibility = false;
+
+    // Set when a committed oplog write is waiting on the visibility thread to run. Checked
+    // lock-free by committing writers so that only the first commit after a visibility update
+    // pays for the mutex and wakeup; reset by the visibility thread under the state mutex.
+    AtomicWord<bool> _opsWaitingForOplogVisibility{false};
 };
 }  // namespace mongo
@@ -57,4 +57,14 @@ void wiredTigerPrepareConflictFailPointLog() {
     LOGV2(22380, "WTPrintPrepareConflictLog fail point enabled.");
 }
 
+void wiredTigerPrepareConflictWaitLimitLog(int attempts, int maxWaitMillis) {
+    LOGV2_DEBUG(5274701,
+                1,
+                "Giving up waiting on WT_PREPARE_CONFLICT after attempt {attempts}, "
+                "wiredTigerPrepareConflictMaxWaitMillis ({maxWaitMillis}) passed. Rolling the "
+                "operation back to retry at a newer snapshot.",
+                "attempts"_attr = attempts,
+                "maxWaitMillis"_attr = maxWaitMillis);
+}
+
 }  // namespace mongo
@@ -31,6 +31,8 @@
 
 #include "mongo/db/curop.h"
 #include "mongo/db/prepare_conflict_tracker.h"
+#include "mongo/db/stats/prepare_conflict_metrics.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_parameters_gen.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_record_store.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_recovery_unit.h"
 #include "mongo/util/fail_point.h"
@@ -55,6 +57,12 @@ void wiredTigerPrepareConflictLog(int attempt);
  */
 void wiredTigerPrepareConflictFailPointLog();
 
+/**
+ * Logs a message when an operation gives up waiting for a prepared transaction because
+ * wiredTigerPrepareConflictMaxWaitMillis passed.
+ */
+void wiredTigerPrepareConflictWaitLimitLog(int attempts, int maxWaitMillis);
+
 /**
  * Runs the argument function f as many times as needed for f to return an error other than
  * WT_PREPARE_CONFLICT. Each time f returns WT_PREPARE_CONFLICT we wait until the current unit of
@@ -75,10 +83,26 @@ int wiredTigerPrepareConflictRetry(OperationContext* opCtx, F&& f) {
     auto recoveryUnit = WiredTigerRecoveryUnit::get(opCtx);
     int attempts = 1;
     // If we return from this function, we have either returned successfully or we've returned an
-    // error other than WT_PREPARE_CONFLICT. Reset PrepareConflictTracker accordingly.
-    ON_BLOCK_EXIT([opCtx] { PrepareConflictTracker::get(opCtx).endPrepareConflict(opCtx); });
+    // error other than WT_PREPARE_CONFLICT. Reset PrepareConflictTracker accordingly, and charge
+    // the time this operation spent blocked to the current namespace in the global metrics.
+    const auto priorConflictDuration =
+        PrepareConflictTracker::get(opCtx).getPrepareConflictDuration();
+    ON_BLOCK_EXIT([opCtx, priorConflictDuration] {
+        auto& tracker = PrepareConflictTracker::get(opCtx);
+        tracker.endPrepareConflict(opCtx);
+        PrepareConflictMetrics::get(opCtx)->recordConflictWait(
+            CurOp::get(opCtx)->getNS(),
+            tracker.getPrepareConflictDuration() - priorConflictDuration);
+    });
     PrepareConflictTracker::get(opCtx).beginPrepareConflict(opCtx);
 
+    // When a limit is configured, stop waiting at this deadline and roll back the operation so
+    // that it retries at a newer snapshot instead of stalling behind prepared transactions.
+    const int maxWaitMillis = gWiredTigerPrepareConflictMaxWaitMillis.load();
+    const Date_t waitDeadline = maxWaitMillis > 0
+        ? opCtx->getServiceContext()->getFastClockSource()->now() + Milliseconds(maxWaitMillis)
+        : Date_t::max();
+
     auto client = opCtx->getClient();
     if (client->isFromSystemConnection()) {
         // System (internal) connections that hit a prepare conflict should be killable to prevent
@@ -140,9 +164,18 @@ int wiredTigerPrepareConflictRetry(OperationContext* opCtx, F&& f) {
         CurOp::get(opCtx)->debug().additiveMetrics.incrementPrepareReadConflicts(1);
         wiredTigerPrepareConflictLog(attempts);
 
+        if (maxWaitMillis > 0 &&
+            opCtx->getServiceContext()->getFastClockSource()->now() >= waitDeadline) {
+            // As with the WTSkipPrepareConflictRetries failpoint, WT_ROLLBACK bubbles up as a
+            // WriteConflictException, so the operation is retried from scratch at a newer
+            // snapshot rather than blocking here indefinitely.
+            wiredTigerPrepareConflictWaitLimitLog(attempts, maxWaitMillis);
+            return WT_ROLLBACK;
+        }
+
         // Wait on the session cache to signal that a unit of work has been committed or aborted.
-        recoveryUnit->getSessionCache()->waitUntilPreparedUnitOfWorkCommitsOrAborts(opCtx,
-                                                                                    lastCount);
+        recoveryUnit->getSessionCache()->waitUntilPreparedUnitOfWorkCommitsOrAborts(
+            opCtx, lastCount, waitDeadline);
     }
 }
 }  // namespace mongo
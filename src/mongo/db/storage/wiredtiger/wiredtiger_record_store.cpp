@@ -1339,7 +1339,14 @@ void WiredTigerRecordStore::reclaimOplog(OperationContext* opCtx) {
 }
 
 void WiredTigerRecordStore::reclaimOplog(OperationContext* opCtx, Timestamp mayTruncateUpTo) {
+    // How long a write lull must last to count as an idle window, and the upper bound on waiting
+    // for one, so truncation always makes progress even under sustained ingest.
+    static constexpr auto kTruncationIdleWindow = Milliseconds(10);
+    static constexpr auto kTruncationMaxIdleWait = Milliseconds(1000);
+
     Timer timer;
+    Timer sliceTimer;
+    int64_t idleWaitMicros = 0;
     while (auto stone = _oplogStones->peekOldestStoneIfNeeded()) {
         invariant(stone->lastRecord.isValid());
 
@@ -1348,6 +1355,18 @@ void WiredTigerRecordStore::reclaimOplog(OperationContext* opCtx, Timestamp mayT
             return;
         }
 
+        // Pace the truncation into time-boxed slices: once the slice budget is spent, wait for a
+        // lull in oplog writes before the next slice so truncation does not compete with peak
+        // ingest.
+        const auto sliceMillis = gOplogTruncationSliceMillis.load();
+        if (sliceMillis > 0 && sliceTimer.millis() >= sliceMillis) {
+            Timer idleTimer;
+            _kvEngine->getOplogManager()->waitForIdleOplogWindow(
+                opCtx, kTruncationIdleWindow, kTruncationMaxIdleWait);
+            idleWaitMicros += idleTimer.micros();
+            sliceTimer.reset();
+        }
+
         LOGV2_DEBUG(
             22399,
             1,
@@ -1405,13 +1424,16 @@ void WiredTigerRecordStore::reclaimOplog(OperationContext* opCtx, Timestamp mayT
                 "{sizeInfo_numRecords_load} records totaling to {sizeInfo_dataSize_load} bytes",
                 "sizeInfo_numRecords_load"_attr = _sizeInfo->numRecords.load(),
                 "sizeInfo_dataSize_load"_attr = _sizeInfo->dataSize.load());
-    auto elapsedMicros = timer.micros();
+    // Report time spent truncating separately from time spent waiting for idle windows between
+    // slices.
+    auto elapsedMicros = timer.micros() - idleWaitMicros;
     auto elapsedMillis = elapsedMicros / 1000;
     _totalTimeTruncating.fetchAndAdd(elapsedMicros);
     _truncateCount.fetchAndAdd(1);
     LOGV2(22402,
           "WiredTiger record store oplog truncation finished in: {elapsedMillis}ms",
-          "elapsedMillis"_attr = elapsedMillis);
+          "elapsedMillis"_attr = elapsedMillis,
+          "idleWaitMillis"_attr = idleWaitMicros / 1000);
 }
 
 Status WiredTigerRecordStore::insertRecords(OperationContext* opCtx,
@@ -1459,6 +1481,11 @@ Status WiredTigerRecordStore::_insertRecords(OperationContext* opCtx,
         highestIdRecord = record;
     }
 
+    // Tracks the last timestamp handed to the recovery unit so a batch carrying one timestamp
+    // (the common case for vectored inserts and oplog application) makes a single setTimestamp
+    // call rather than one per record; the timestamp applies to all subsequent writes in the
+    // unit of work anyway.
+    Timestamp lastAppliedTimestamp;
     for (size_t i = 0; i < nRecords; i++) {
         auto& record = records[i];
         Timestamp ts;
@@ -1474,9 +1501,10 @@ Status WiredTigerRecordStore::_insertRecords(OperationContext* opCtx,
         } else {
             ts = timestamps[i];
         }
-        if (!ts.isNull()) {
+        if (!ts.isNull() && ts != lastAppliedTimestamp) {
             LOGV2_DEBUG(22403, 4, "inserting record with timestamp {ts}", "ts"_attr = ts);
             fassert(39001, opCtx->recoveryUnit()->setTimestamp(ts));
+            lastAppliedTimestamp = ts;
         }
         setKey(c, record.id);
         WiredTigerItem value(record.data.data(), record.data.size());
@@ -1651,11 +1679,14 @@ StatusWith<RecordData> WiredTigerRecordStore::updateWithDamages(
     mutablebson::DamageVector::const_iterator where = damages.begin();
     const mutablebson::DamageVector::const_iterator end = damages.cend();
     std::vector<WT_MODIFY> entries(nentries);
+    int64_t sizeDelta = 0;
     for (u_int i = 0; where != end; ++i, ++where) {
         entries[i].data.data = damageSource + where->sourceOffset;
         entries[i].data.size = where->size;
         entries[i].offset = where->targetOffset;
-        entries[i].size = where->size;
+        // A 'targetSize' smaller than the replacement data grows the record in place.
+        entries[i].size = where->targetSize;
+        sizeDelta += static_cast<int64_t>(where->size) - static_cast<int64_t>(where->targetSize);
     }
 
     WiredTigerCursor curwrap(_uri, _tableId, true, opCtx);
@@ -1670,6 +1701,9 @@ StatusWith<RecordData> WiredTigerRecordStore::updateWithDamages(
     else
         invariantWTOK(WT_OP_CHECK(c->modify(c, entries.data(), nentries)));
 
+    if (sizeDelta != 0)
+        _increaseDataSize(opCtx, sizeDelta);
+
     WT_ITEM value;
     invariantWTOK(c->get_value(c, &value));
 
@@ -35,6 +35,7 @@
 
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/db/server_options.h"
+#include "mongo/db/stats/operation_latency_phases.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_begin_transaction_block.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_kv_engine.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_prepare_conflict.h"
@@ -156,6 +157,23 @@ StorageStats& WiredTigerOperationStats::operator+=(const StorageStats& other) {
     return (*this);
 }
 
+long long WiredTigerOperationStats::_getStat(int statKey) const {
+    auto it = _stats.find(statKey);
+    return it == _stats.end() ? 0 : it->second;
+}
+
+long long WiredTigerOperationStats::bytesRead() const {
+    return _getStat(WT_STAT_SESSION_BYTES_READ);
+}
+
+long long WiredTigerOperationStats::readTimeMicros() const {
+    return _getStat(WT_STAT_SESSION_READ_TIME);
+}
+
+long long WiredTigerOperationStats::cacheWaitMicros() const {
+    return _getStat(WT_STAT_SESSION_CACHE_TIME);
+}
+
 WiredTigerRecoveryUnit::WiredTigerRecoveryUnit(WiredTigerSessionCache* sc)
     : WiredTigerRecoveryUnit(sc, sc->getKVEngine()->getOplogManager()) {}
 
@@ -254,9 +272,12 @@ bool WiredTigerRecoveryUnit::waitUntilDurable(OperationContext* opCtx) {
     invariant(!opCtx->lockState()->isLocked() || storageGlobalParams.repair);
 
     // Flushes the journal log to disk. Checkpoints all data if journaling is disabled.
+    Timer timer;
     _sessionCache->waitUntilDurable(opCtx,
                                     WiredTigerSessionCache::Fsync::kJournal,
                                     WiredTigerSessionCache::UseJournalListener::kUpdate);
+    OperationLatencyPhases::get(opCtx).add(OperationLatencyPhases::kJournalCommitWait,
+                                           Microseconds(timer.micros()));
 
     return true;
 }
@@ -275,8 +296,11 @@ bool WiredTigerRecoveryUnit::waitUntilUnjournaledWritesDurable(OperationContext*
     WiredTigerSessionCache::Fsync fsyncType = stableCheckpoint
         ? WiredTigerSessionCache::Fsync::kCheckpointStableTimestamp
         : WiredTigerSessionCache::Fsync::kCheckpointAll;
+    Timer timer;
     _sessionCache->waitUntilDurable(
         opCtx, fsyncType, WiredTigerSessionCache::UseJournalListener::kUpdate);
+    OperationLatencyPhases::get(opCtx).add(OperationLatencyPhases::kJournalCommitWait,
+                                           Microseconds(timer.micros()));
 
     return true;
 }
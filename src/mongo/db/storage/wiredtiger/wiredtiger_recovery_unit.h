@@ -73,7 +73,17 @@ public:
 
     std::shared_ptr<StorageStats> getCopy() final;
 
+    long long bytesRead() const final;
+    long long readTimeMicros() const final;
+    long long cacheWaitMicros() const final;
+
 private:
+    /**
+     * Returns the value recorded for 'statKey', or zero if the statistic was not returned by the
+     * statistics cursor.
+     */
+    long long _getStat(int statKey) const;
+
     /**
      * Each statistic in WiredTiger has an integer key, which this map associates with a section
      * (either DATA or WAIT) and user-readable name.
@@ -88,6 +88,15 @@ BSONObj WiredTigerServerStatusSection::generateSection(OperationContext* opCtx,
                           Timestamp(_engine->getOplogManager()->getOplogReadTimestamp()));
     }
 
+    {
+        const auto& pacing = _engine->checkpointPacingState();
+        BSONObjBuilder subsection(bob.subobjStart("checkpointPacing"));
+        subsection.append("active", pacing.active.load());
+        subsection.append("dirtyTargetPct", pacing.dirtyTargetPct.load());
+        subsection.append("dirtyRateBytesPerSec", pacing.dirtyRateBytesPerSec.load());
+        subsection.append("projectedDirtyPct", pacing.projectedDirtyPct.load());
+    }
+
     return bob.obj();
 }
 
@@ -33,6 +33,8 @@
 
 #include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
 
+#include <algorithm>
+#include <functional>
 #include <memory>
 
 #include "mongo/base/error_codes.h"
@@ -46,6 +48,7 @@
 #include "mongo/logv2/log.h"
 #include "mongo/stdx/thread.h"
 #include "mongo/util/scopeguard.h"
+#include "mongo/util/time_support.h"
 
 namespace mongo {
 
@@ -110,17 +113,42 @@ void _openCursor(WT_SESSION* session,
 }
 }  // namespace
 
+void WiredTigerSession::_eraseCursorFromIndex(CursorCache::iterator position) {
+    auto indexIt = _cursorIndex.find(position->_id);
+    invariant(indexIt != _cursorIndex.end());
+    auto& positions = indexIt->second;
+    auto posIt = std::find(positions.begin(), positions.end(), position);
+    invariant(posIt != positions.end());
+    *posIt = positions.back();
+    positions.pop_back();
+    if (positions.empty()) {
+        _cursorIndex.erase(indexIt);
+    }
+}
+
+void WiredTigerSession::_rebuildCursorIndex() {
+    _cursorIndex.clear();
+    for (auto i = _cursors.begin(); i != _cursors.end(); ++i) {
+        _cursorIndex[i->_id].push_back(i);
+    }
+}
+
 WT_CURSOR* WiredTigerSession::getCachedCursor(const std::string& uri,
                                               uint64_t id,
                                               const char* config) {
-    // Find the most recently used cursor
-    for (CursorCache::iterator i = _cursors.begin(); i != _cursors.end(); ++i) {
-        if (i->_id == id) {
-            WT_CURSOR* c = i->_cursor;
-            _cursors.erase(i);
-            _cursorsOut++;
-            return c;
+    auto indexIt = _cursorIndex.find(id);
+    if (indexIt != _cursorIndex.end()) {
+        auto& positions = indexIt->second;
+        invariant(!positions.empty());
+        CursorCache::iterator i = positions.back();
+        positions.pop_back();
+        if (positions.empty()) {
+            _cursorIndex.erase(indexIt);
         }
+        WT_CURSOR* c = i->_cursor;
+        _cursors.erase(i);
+        _cursorsOut++;
+        return c;
     }
 
     WT_CURSOR* cursor = nullptr;
@@ -145,11 +173,13 @@ void WiredTigerSession::releaseCursor(uint64_t id, WT_CURSOR* cursor) {
 
     // Cursors are pushed to the front of the list and removed from the back
     _cursors.push_front(WiredTigerCachedCursor(id, _cursorGen++, cursor));
+    _cursorIndex[id].push_back(_cursors.begin());
 
     // A negative value for wiredTigercursorCacheSize means to use hybrid caching.
     std::uint32_t cacheSize = abs(gWiredTigerCursorCacheSize.load());
 
     while (!_cursors.empty() && _cursorGen - _cursors.back()._gen > cacheSize) {
+        _eraseCursorFromIndex(std::prev(_cursors.end()));
         cursor = _cursors.back()._cursor;
         _cursors.pop_back();
         invariantWTOK(cursor->close(cursor));
@@ -172,6 +202,7 @@ void WiredTigerSession::closeAllCursors(const std::string& uri) {
         WT_CURSOR* cursor = i->_cursor;
         if (cursor && (all || uri == cursor->uri)) {
             invariantWTOK(cursor->close(cursor));
+            _eraseCursorFromIndex(i);
             i = _cursors.erase(i);
         } else
             ++i;
@@ -183,6 +214,11 @@ void WiredTigerSession::closeCursorsForQueuedDrops(WiredTigerKVEngine* engine) {
 
     _cursorEpoch = _cache->getCursorEpoch();
     auto toDrop = engine->filterCursorsWithQueuedDrops(&_cursors);
+    if (!toDrop.empty()) {
+        // The engine erased the dropped cursors from the cache list directly; re-derive the
+        // by-table-id index from what is left.
+        _rebuildCursorIndex();
+    }
 
     for (auto i = toDrop.begin(); i != toDrop.end(); i++) {
         WT_CURSOR* cursor = i->_cursor;
@@ -335,6 +371,13 @@ void WiredTigerSessionCache::waitUntilDurable(OperationContext* opCtx,
 
     // Nobody has synched yet, so we have to sync ourselves.
 
+    // Group commit: linger briefly so writers committing nearly back-to-back are covered by this
+    // flush rather than each triggering their own. Anything that commits during the window is
+    // flushed below, and its waiter returns as soon as we release '_lastSyncMutex'.
+    if (auto groupingMicros = gWiredTigerJournalFlushGroupingMicros.load()) {
+        sleepmicros(groupingMicros);
+    }
+
     // Update a value that tracks the latest write that is safe across startup recovery (in the repl
     // layer) and then report the time of that write as durable after we flush in-memory to disk.
     auto journalListener = [&]() -> JournalListener* {
@@ -385,11 +428,12 @@ void WiredTigerSessionCache::waitUntilDurable(OperationContext* opCtx,
 }
 
 void WiredTigerSessionCache::waitUntilPreparedUnitOfWorkCommitsOrAborts(OperationContext* opCtx,
-                                                                        std::uint64_t lastCount) {
+                                                                        std::uint64_t lastCount,
+                                                                        Date_t deadline) {
     invariant(opCtx);
     stdx::unique_lock<Latch> lk(_prepareCommittedOrAbortedMutex);
     if (lastCount == _prepareCommitOrAbortCounter.loadRelaxed()) {
-        opCtx->waitForConditionOrInterrupt(_prepareCommittedOrAbortedCond, lk, [&] {
+        opCtx->waitForConditionOrInterruptUntil(_prepareCommittedOrAbortedCond, lk, deadline, [&] {
             return _prepareCommitOrAbortCounter.loadRelaxed() > lastCount;
         });
     }
@@ -402,10 +446,20 @@ void WiredTigerSessionCache::notifyPreparedUnitOfWorkHasCommittedOrAborted() {
 }
 
 
+WiredTigerSessionCache::SessionCacheShard& WiredTigerSessionCache::_homeShard() {
+    // Hashing the thread id spreads threads evenly across the shards without requiring CPU
+    // affinity information. The index is computed once per thread and then reused.
+    static thread_local const size_t shardIndex =
+        std::hash<stdx::thread::id>()(stdx::this_thread::get_id()) % kNumShards;
+    return _shards[shardIndex];
+}
+
 void WiredTigerSessionCache::closeAllCursors(const std::string& uri) {
-    stdx::lock_guard<Latch> lock(_cacheLock);
-    for (SessionCache::iterator i = _sessions.begin(); i != _sessions.end(); i++) {
-        (*i)->closeAllCursors(uri);
+    for (auto& shard : _shards) {
+        stdx::lock_guard<Latch> lock(shard.lock);
+        for (auto session : shard.sessions) {
+            session->closeAllCursors(uri);
+        }
     }
 }
 
@@ -413,15 +467,21 @@ void WiredTigerSessionCache::closeCursorsForQueuedDrops() {
     // Increment the cursor epoch so that all cursors from this epoch are closed.
     _cursorEpoch.fetchAndAdd(1);
 
-    stdx::lock_guard<Latch> lock(_cacheLock);
-    for (SessionCache::iterator i = _sessions.begin(); i != _sessions.end(); i++) {
-        (*i)->closeCursorsForQueuedDrops(_engine);
+    for (auto& shard : _shards) {
+        stdx::lock_guard<Latch> lock(shard.lock);
+        for (auto session : shard.sessions) {
+            session->closeCursorsForQueuedDrops(_engine);
+        }
     }
 }
 
 size_t WiredTigerSessionCache::getIdleSessionsCount() {
-    stdx::lock_guard<Latch> lock(_cacheLock);
-    return _sessions.size();
+    size_t count = 0;
+    for (auto& shard : _shards) {
+        stdx::lock_guard<Latch> lock(shard.lock);
+        count += shard.sessions.size();
+    }
+    return count;
 }
 
 void WiredTigerSessionCache::closeExpiredIdleSessions(int64_t idleTimeMillis) {
@@ -431,30 +491,41 @@ void WiredTigerSessionCache::closeExpiredIdleSessions(int64_t idleTimeMillis) {
     }
 
     auto cutoffTime = _clockSource->now() - Milliseconds(idleTimeMillis);
-    {
-        stdx::lock_guard<Latch> lock(_cacheLock);
-        // Discard all sessions that became idle before the cutoff time
-        for (auto it = _sessions.begin(); it != _sessions.end();) {
-            auto session = *it;
-            invariant(session->getIdleExpireTime() != Date_t::min());
-            if (session->getIdleExpireTime() < cutoffTime) {
-                it = _sessions.erase(it);
-                delete (session);
-            } else {
-                ++it;
+    for (auto& shard : _shards) {
+        // Collect the expired sessions under the shard lock, but close them (which makes a call
+        // into WiredTiger) only after it has been released.
+        SessionCache expired;
+        {
+            stdx::lock_guard<Latch> lock(shard.lock);
+            for (auto it = shard.sessions.begin(); it != shard.sessions.end();) {
+                auto session = *it;
+                invariant(session->getIdleExpireTime() != Date_t::min());
+                if (session->getIdleExpireTime() < cutoffTime) {
+                    it = shard.sessions.erase(it);
+                    expired.push_back(session);
+                } else {
+                    ++it;
+                }
             }
         }
+
+        for (auto session : expired) {
+            delete (session);
+        }
     }
 }
 
 void WiredTigerSessionCache::closeAll() {
-    // Increment the epoch as we are now closing all sessions with this epoch.
-    SessionCache swap;
+    // Increment the epoch as we are now closing all sessions with this epoch. Once the epoch has
+    // been bumped, releaseSession will delete rather than cache any session from an older epoch,
+    // so sessions released while we drain the shards cannot be missed.
+    _epoch.fetchAndAdd(1);
 
-    {
-        stdx::lock_guard<Latch> lock(_cacheLock);
-        _epoch.fetchAndAdd(1);
-        _sessions.swap(swap);
+    SessionCache swap;
+    for (auto& shard : _shards) {
+        stdx::lock_guard<Latch> lock(shard.lock);
+        swap.insert(swap.end(), shard.sessions.begin(), shard.sessions.end());
+        shard.sessions.clear();
     }
 
     for (SessionCache::iterator i = swap.begin(); i != swap.end(); i++) {
@@ -471,20 +542,35 @@ UniqueWiredTigerSession WiredTigerSessionCache::getSession() {
     // operations should be allowed to start.
     invariant(!(_shuttingDown.loadRelaxed() & kShuttingDownMask));
 
-    {
-        stdx::lock_guard<Latch> lock(_cacheLock);
-        if (!_sessions.empty()) {
-            // Get the most recently used session so that if we discard sessions, we're
-            // discarding older ones
-            WiredTigerSession* cachedSession = _sessions.back();
-            _sessions.pop_back();
-            // Reset the idle time
-            cachedSession->setIdleExpireTime(Date_t::min());
-            return UniqueWiredTigerSession(cachedSession);
+    auto tryPop = [](SessionCacheShard& shard) -> WiredTigerSession* {
+        stdx::lock_guard<Latch> lock(shard.lock);
+        if (shard.sessions.empty()) {
+            return nullptr;
         }
+        // Get the most recently used session so that if we discard sessions, we're
+        // discarding older ones
+        WiredTigerSession* cachedSession = shard.sessions.back();
+        shard.sessions.pop_back();
+        return cachedSession;
+    };
+
+    SessionCacheShard& home = _homeShard();
+    WiredTigerSession* cachedSession = tryPop(home);
+
+    // Steal from the other shards before paying for opening a new WT_SESSION.
+    for (size_t i = 0; !cachedSession && i < kNumShards; i++) {
+        if (&_shards[i] != &home) {
+            cachedSession = tryPop(_shards[i]);
+        }
+    }
+
+    if (cachedSession) {
+        // Reset the idle time
+        cachedSession->setIdleExpireTime(Date_t::min());
+        return UniqueWiredTigerSession(cachedSession);
     }
 
-    // Outside of the cache partition lock, but on release will be put back on the cache
+    // Outside of the shard locks, but on release will be put back on the cache
     return UniqueWiredTigerSession(
         new WiredTigerSession(_conn, this, _epoch.load(), _cursorEpoch.load()));
 }
@@ -539,10 +625,11 @@ void WiredTigerSessionCache::releaseSession(WiredTigerSession* session) {
     session->setIdleExpireTime(_clockSource->now());
 
     if (session->_getEpoch() == currentEpoch) {  // check outside of lock to reduce contention
-        stdx::lock_guard<Latch> lock(_cacheLock);
+        SessionCacheShard& shard = _homeShard();
+        stdx::lock_guard<Latch> lock(shard.lock);
         if (session->_getEpoch() == _epoch.load()) {  // recheck inside the lock for correctness
             returnedToCache = true;
-            _sessions.push_back(session);
+            shard.sessions.push_back(session);
         }
     } else
         invariant(session->_getEpoch() < currentEpoch);
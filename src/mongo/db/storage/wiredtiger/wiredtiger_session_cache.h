@@ -31,6 +31,7 @@
 
 #include <list>
 #include <string>
+#include <vector>
 
 #include <wiredtiger.h>
 
@@ -38,7 +39,9 @@
 #include "mongo/db/storage/wiredtiger/wiredtiger_snapshot_manager.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
+#include "mongo/stdx/unordered_map.h"
 #include "mongo/util/concurrency/spin_lock.h"
+#include "mongo/util/time_support.h"
 
 namespace mongo {
 
@@ -180,6 +183,18 @@ private:
     // The cursor cache is a list of pairs that contain an ID and cursor
     typedef std::list<WiredTigerCachedCursor> CursorCache;
 
+    /**
+     * Removes the index entry pointing at the given cache position. Must be called before the
+     * position is erased from '_cursors'.
+     */
+    void _eraseCursorFromIndex(CursorCache::iterator position);
+
+    /**
+     * Rebuilds '_cursorIndex' from '_cursors'. Used after the cache list has been modified without
+     * going through this class, e.g. by WiredTigerKVEngine::filterCursorsWithQueuedDrops().
+     */
+    void _rebuildCursorIndex();
+
     // Used internally by WiredTigerSessionCache
     uint64_t _getEpoch() const {
         return _epoch;
@@ -195,6 +210,13 @@ private:
     WiredTigerSessionCache* _cache;  // not owned
     WT_SESSION* _session;            // owned
     CursorCache _cursors;            // owned
+
+    // Index into '_cursors' by table id so that a workload touching many tables does not pay a
+    // linear scan of the cache on every cursor open. A table id may have several cached cursors,
+    // hence the vector of list positions. Entries must be maintained across any mutation of
+    // '_cursors'.
+    stdx::unordered_map<uint64_t, std::vector<CursorCache::iterator>> _cursorIndex;
+
     uint64_t _cursorGen;
     int _cursorsOut;
     bool _dropQueuedIdentsAtSessionEnd = true;
@@ -323,12 +345,15 @@ public:
      * the conflicting transaction has ended, only that one prepared unit of work in the process has
      * signaled that it has ended.
      * Accepts an OperationContext that will throw an AssertionException when interrupted.
+     * Returns without any unit of work having ended if 'deadline' passes first.
      *
      * This method is provided in WiredTigerSessionCache and not RecoveryUnit because all recovery
      * units share the same session cache, and we want a recovery unit on one thread to signal all
      * recovery units waiting for prepare conflicts across all other threads.
      */
-    void waitUntilPreparedUnitOfWorkCommitsOrAborts(OperationContext* opCtx, uint64_t lastCount);
+    void waitUntilPreparedUnitOfWorkCommitsOrAborts(OperationContext* opCtx,
+                                                    uint64_t lastCount,
+                                                    Date_t deadline = Date_t::max());
 
     /**
      * Notifies waiters that the caller's perpared unit of work has ended (either committed or
@@ -373,9 +398,26 @@ private:
     AtomicWord<unsigned> _shuttingDown;
     static const uint32_t kShuttingDownMask = 1 << 31;
 
-    Mutex _cacheLock = MONGO_MAKE_LATCH("WiredTigerSessionCache::_cacheLock");
     typedef std::vector<WiredTigerSession*> SessionCache;
-    SessionCache _sessions;
+
+    // The cache of idle sessions is sharded to reduce mutex contention: every operation acquires
+    // and releases a session, so a single cache-wide mutex becomes a hot spot under concurrent
+    // load. Each shard has its own lock and session vector. Threads hash to a home shard and
+    // steal from the other shards when their home shard is empty, so sessions are still shared
+    // across the whole process before we pay for opening a new WT_SESSION.
+    static constexpr size_t kNumShards = 8;
+
+    struct SessionCacheShard {
+        Mutex lock = MONGO_MAKE_LATCH("WiredTigerSessionCache::SessionCacheShard::lock");
+        SessionCache sessions;
+    };
+    SessionCacheShard _shards[kNumShards];
+
+    /**
+     * Returns the shard this thread preferentially operates on. The assignment is stable for the
+     * lifetime of the thread.
+     */
+    SessionCacheShard& _homeShard();
 
     // Bumped when all open sessions need to be closed
     AtomicWord<unsigned long long> _epoch;  // atomic so we can check it outside of the lock
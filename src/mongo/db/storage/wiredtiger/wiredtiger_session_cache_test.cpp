@@ -113,4 +113,34 @@ TEST(WiredTigerSessionCacheTest, CheckSessionCacheCleanup) {
     ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 0U);
 }
 
+TEST(WiredTigerSessionCacheTest, CachedCursorsAreServedByTableId) {
+    WiredTigerSessionCacheHarnessHelper harnessHelper("");
+    WiredTigerSessionCache* sessionCache = harnessHelper.getSessionCache();
+
+    UniqueWiredTigerSession session = sessionCache->getSession();
+    const char* uri = "table:cursor_cache_test";
+    ASSERT_EQUALS(session->getSession()->create(session->getSession(), uri, nullptr), 0);
+
+    const uint64_t tableIdA = WiredTigerSession::genTableId();
+    const uint64_t tableIdB = WiredTigerSession::genTableId();
+
+    WT_CURSOR* cursorA = session->getCachedCursor(uri, tableIdA, nullptr);
+    WT_CURSOR* cursorB = session->getCachedCursor(uri, tableIdB, nullptr);
+    ASSERT_EQUALS(session->cursorsOut(), 2);
+
+    session->releaseCursor(tableIdA, cursorA);
+    session->releaseCursor(tableIdB, cursorB);
+    ASSERT_EQUALS(session->cachedCursors(), 2);
+
+    // A request for a cached table id must be served by the cached cursor, not a new one.
+    WT_CURSOR* again = session->getCachedCursor(uri, tableIdB, nullptr);
+    ASSERT_EQUALS(again, cursorB);
+    ASSERT_EQUALS(session->cachedCursors(), 1);
+    session->releaseCursor(tableIdB, again);
+
+    // Closing all cursors for the uri must empty the cache so subsequent requests open afresh.
+    session->closeAllCursors(uri);
+    ASSERT_EQUALS(session->cachedCursors(), 0);
+}
+
 }  // namespace mongo
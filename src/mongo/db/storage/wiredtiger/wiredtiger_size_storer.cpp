@@ -68,20 +68,26 @@ WiredTigerSizeStorer::~WiredTigerSizeStorer() {
     _cursor->close(_cursor);
 }
 
+WiredTigerSizeStorer::BufferShard& WiredTigerSizeStorer::_shardFor(StringData uri) const {
+    return _shards[StringMapHasher()(uri) % kNumShards];
+}
+
 void WiredTigerSizeStorer::store(StringData uri, std::shared_ptr<SizeInfo> sizeInfo) {
     // If the SizeInfo is still dirty, we're done.
     if (sizeInfo->_dirty.load() || _readOnly)
         return;
 
     // Ordering is important: as the entry may be flushed concurrently, set the dirty flag last.
-    stdx::lock_guard<Latch> lk(_bufferMutex);
-    auto& entry = _buffer[uri];
+    BufferShard& shard = _shardFor(uri);
+    stdx::lock_guard<Latch> lk(shard.mutex);
+    auto& entry = shard.buffer[uri];
     // During rollback it is possible to get a new SizeInfo. In that case clear the dirty flag,
     // so the SizeInfo can be destructed without triggering the dirty check invariant.
     if (entry && entry.get() != sizeInfo.get())
         entry->_dirty.store(false);
     entry = sizeInfo;
     entry->_dirty.store(true);
+    shard.dirty.store(true);
     LOGV2_DEBUG(
         22423,
         2,
@@ -96,9 +102,10 @@ void WiredTigerSizeStorer::store(StringData uri, std::shared_ptr<SizeInfo> sizeI
 std::shared_ptr<WiredTigerSizeStorer::SizeInfo> WiredTigerSizeStorer::load(StringData uri) const {
     {
         // Check if we can satisfy the read from the buffer.
-        stdx::lock_guard<Latch> bufferLock(_bufferMutex);
-        Buffer::const_iterator it = _buffer.find(uri);
-        if (it != _buffer.end())
+        BufferShard& shard = _shardFor(uri);
+        stdx::lock_guard<Latch> bufferLock(shard.mutex);
+        Buffer::const_iterator it = shard.buffer.find(uri);
+        if (it != shard.buffer.end())
             return it->second;
     }
 
@@ -131,25 +138,39 @@ std::shared_ptr<WiredTigerSizeStorer::SizeInfo> WiredTigerSizeStorer::load(Strin
 }
 
 void WiredTigerSizeStorer::flush(bool syncToDisk) {
-    Buffer buffer;
-    {
-        stdx::lock_guard<Latch> bufferLock(_bufferMutex);
-        _buffer.swap(buffer);
-    }
+    Timer t;
+    bool flushedAnything = false;
+
+    // Drain the shards round-robin, each in its own transaction, so concurrent store() calls only
+    // contend with the flush on the single shard currently being swapped out. Rotating the
+    // starting shard keeps any one shard from being favored between flushes.
+    const size_t startShard = _nextFlushShard.fetchAndAdd(1) % kNumShards;
+    for (size_t i = 0; i < kNumShards; i++) {
+        BufferShard& shard = _shards[(startShard + i) % kNumShards];
+        if (!shard.dirty.load())
+            continue;
+
+        Buffer buffer;
+        {
+            stdx::lock_guard<Latch> bufferLock(shard.mutex);
+            shard.buffer.swap(buffer);
+            shard.dirty.store(false);
+        }
 
-    if (buffer.empty())
-        return;  // Nothing to do.
+        if (buffer.empty())
+            continue;
+        flushedAnything = true;
+
+        stdx::lock_guard<Latch> cursorLock(_cursorMutex);
 
-    Timer t;
-    stdx::lock_guard<Latch> cursorLock(_cursorMutex);
-    {
         // On failure, place entries back into the map, unless a newer value already exists.
-        ON_BLOCK_EXIT([this, &buffer]() {
+        ON_BLOCK_EXIT([this, &shard, &buffer]() {
             this->_cursor->reset(this->_cursor);
             if (!buffer.empty()) {
-                stdx::lock_guard<Latch> bufferLock(this->_bufferMutex);
+                stdx::lock_guard<Latch> bufferLock(shard.mutex);
                 for (auto& it : buffer)
-                    this->_buffer.try_emplace(it.first, it.second);
+                    shard.buffer.try_emplace(it.first, it.second);
+                shard.dirty.store(true);
             }
         });
 
@@ -183,6 +204,9 @@ void WiredTigerSizeStorer::flush(bool syncToDisk) {
         buffer.clear();
     }
 
+    if (!flushedAnything)
+        return;  // Nothing to do.
+
     auto micros = t.micros();
     LOGV2_DEBUG(22426, 2, "WiredTigerSizeStorer flush took {micros} µs", "micros"_attr = micros);
 }
@@ -90,21 +90,40 @@ public:
     std::shared_ptr<SizeInfo> load(StringData uri) const;
 
     /**
-     * Writes all changes to the underlying table.
+     * Writes all changes to the underlying table. Dirty shards of the buffer are written back one
+     * at a time, each in its own transaction, so concurrent store() calls are only briefly blocked
+     * on the single shard currently being drained.
      */
     void flush(bool syncToDisk);
 
 private:
+    using Buffer = StringMap<std::shared_ptr<SizeInfo>>;
+
+    /**
+     * The buffer is sharded by URI hash so that the periodic flush can drain it incrementally:
+     * store() calls against other shards proceed while one shard's entries are written back. Each
+     * shard tracks whether it holds dirty entries so flush() can skip clean shards without taking
+     * their mutexes.
+     */
+    struct BufferShard {
+        mutable Mutex mutex = MONGO_MAKE_LATCH("WiredTigerSizeStorer::BufferShard::mutex");
+        Buffer buffer;
+        AtomicWord<bool> dirty{false};
+    };
+
+    BufferShard& _shardFor(StringData uri) const;
+
     const WiredTigerSession _session;
     const bool _readOnly;
-    // Guards _cursor. Acquire *before* _bufferMutex.
+    // Guards _cursor. Acquire *before* any BufferShard::mutex.
     mutable Mutex _cursorMutex = MONGO_MAKE_LATCH("WiredTigerSessionStorer::_cursorMutex");
     WT_CURSOR* _cursor;  // pointer is const after constructor
 
-    using Buffer = StringMap<std::shared_ptr<SizeInfo>>;
+    static constexpr size_t kNumShards = 16;
+    mutable BufferShard _shards[kNumShards];
 
-    mutable Mutex _bufferMutex =
-        MONGO_MAKE_LATCH("WiredTigerSessionStorer::_bufferMutex");  // Guards _buffer
-    Buffer _buffer;
+    // Index of the shard where the next flush starts draining, so no shard is persistently
+    // favored or starved by flushes that stop early on error.
+    AtomicWord<unsigned> _nextFlushShard{0};
 };
 }  // namespace mongo
@@ -49,16 +49,14 @@ void WiredTigerSnapshotManager::setCommittedSnapshot(const Timestamp& timestamp)
 }
 
 void WiredTigerSnapshotManager::setLocalSnapshot(const Timestamp& timestamp) {
-    stdx::lock_guard<Latch> lock(_localSnapshotMutex);
-    if (timestamp.isNull())
-        _localSnapshot = boost::none;
-    else
-        _localSnapshot = timestamp;
+    _localSnapshot.store(timestamp.asULL());
 }
 
 boost::optional<Timestamp> WiredTigerSnapshotManager::getLocalSnapshot() {
-    stdx::lock_guard<Latch> lock(_localSnapshotMutex);
-    return _localSnapshot;
+    auto localSnapshot = _localSnapshot.load();
+    if (!localSnapshot)
+        return boost::none;
+    return Timestamp(localSnapshot);
 }
 
 void WiredTigerSnapshotManager::dropAllSnapshots() {
@@ -99,17 +97,19 @@ Timestamp WiredTigerSnapshotManager::beginTransactionOnLocalSnapshot(
     RoundUpPreparedTimestamps roundUpPreparedTimestamps) const {
     WiredTigerBeginTxnBlock txnOpen(session, prepareConflictBehavior, roundUpPreparedTimestamps);
 
-    stdx::lock_guard<Latch> lock(_localSnapshotMutex);
-    invariant(_localSnapshot);
+    // Read the published snapshot once so the timestamp we open the transaction at is the one we
+    // return, even if a new snapshot is published concurrently.
+    Timestamp localSnapshot{_localSnapshot.load()};
+    invariant(!localSnapshot.isNull());
     LOGV2_DEBUG(22427,
                 3,
                 "begin_transaction on local snapshot {localSnapshot_get}",
-                "localSnapshot_get"_attr = _localSnapshot.get().toString());
-    auto status = txnOpen.setReadSnapshot(_localSnapshot.get());
+                "localSnapshot_get"_attr = localSnapshot.toString());
+    auto status = txnOpen.setReadSnapshot(localSnapshot);
     fassert(50775, status);
 
     txnOpen.done();
-    return *_localSnapshot;
+    return localSnapshot;
 }
 
 }  // namespace mongo
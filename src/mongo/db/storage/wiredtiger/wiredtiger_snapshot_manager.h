@@ -35,6 +35,7 @@
 #include "mongo/bson/timestamp.h"
 #include "mongo/db/storage/snapshot_manager.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_begin_transaction_block.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
 
 namespace mongo {
@@ -95,9 +96,10 @@ private:
         MONGO_MAKE_LATCH("WiredTigerSnapshotManager::_committedSnapshotMutex");
     boost::optional<Timestamp> _committedSnapshot;
 
-    // Snapshot to use for reads at a local stable timestamp.
-    mutable Mutex _localSnapshotMutex =  // Guards _localSnapshot.
-        MONGO_MAKE_LATCH("WiredTigerSnapshotManager::_localSnapshotMutex");
-    boost::optional<Timestamp> _localSnapshot;
+    // Snapshot to use for reads at a local stable timestamp, stored as Timestamp::asULL() with
+    // zero meaning "not set". This is read on every transaction opened at the last applied
+    // timestamp, so it is kept lock-free to avoid serializing secondary reads against the batch
+    // applier thread that publishes a new snapshot after every batch.
+    AtomicWord<unsigned long long> _localSnapshot{0};
 };
 }  // namespace mongo
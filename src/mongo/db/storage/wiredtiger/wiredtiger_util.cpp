@@ -748,6 +748,10 @@ void WiredTigerUtil::appendSnapshotWindowSettings(WiredTigerKVEngine* engine,
                     snapshotWindowParams.cachePressureThreshold.load());
     settings.append("current cache pressure percentage", score);
     settings.append("total number of SnapshotTooOld errors", totalNumberOfSnapshotTooOldErrors);
+    settings.append("total number of preemptive snapshot window increases",
+                    snapshotWindowParams.preemptiveSnapshotWindowIncreaseCount.load());
+    settings.append("observed majority commit point advancement rate",
+                    snapshotWindowParams.observedCommitPointAdvancementRate.load());
     settings.append("max target available snapshots window size in seconds",
                     snapshotWindowParams.maxTargetSnapshotHistoryWindowInSeconds.load());
     settings.append("target available snapshots window size in seconds",
@@ -32,8 +32,11 @@
 #include "mongo/db/traffic_recorder.h"
 #include "mongo/db/traffic_recorder_gen.h"
 
+#include <atomic>
 #include <boost/filesystem/operations.hpp>
+#include <deque>
 #include <fstream>
+#include <memory>
 
 #include "mongo/base/data_builder.h"
 #include "mongo/base/data_type_terminated.h"
@@ -42,8 +45,8 @@
 #include "mongo/db/commands/server_status.h"
 #include "mongo/db/service_context.h"
 #include "mongo/rpc/factory.h"
+#include "mongo/stdx/condition_variable.h"
 #include "mongo/stdx/thread.h"
-#include "mongo/util/producer_consumer_queue.h"
 #include "mongo/util/str.h"
 
 namespace mongo {
@@ -82,52 +85,81 @@ MONGO_INITIALIZER(ShouldAlwaysRecordTraffic)(InitializerContext*) {
 class TrafficRecorder::Recording {
 public:
     Recording(const StartRecordingTraffic& options)
-        : _path(_getPath(options.getFilename().toString())), _maxLogSize(options.getMaxFileSize()) {
-
-        MultiProducerSingleConsumerQueue<TrafficRecordingPacket, CostFunction>::Options
-            queueOptions;
-        queueOptions.maxQueueDepth = options.getBufferSize();
-        if (!shouldAlwaysRecordTraffic) {
-            queueOptions.maxProducerQueueDepth = 0;
-        }
-        _pcqPipe = MultiProducerSingleConsumerQueue<TrafficRecordingPacket, CostFunction>::Pipe(
-            queueOptions);
+        : _path(_getPath(options.getFilename().toString())),
+          _maxLogSize(options.getMaxFileSize()),
+          _maxBufferSize(options.getBufferSize()),
+          _sampleRate(options.getSampleRate().value_or(gTrafficRecordingSampleRate.load())) {
+        uassert(ErrorCodes::BadValue,
+                "Traffic recording sample rate must be at least 1",
+                _sampleRate >= 1);
 
         _trafficStats.setRunning(true);
-        _trafficStats.setBufferSize(options.getBufferSize());
+        _trafficStats.setBufferSize(_maxBufferSize);
         _trafficStats.setRecordingFile(_path);
         _trafficStats.setMaxFileSize(_maxLogSize);
+        _trafficStats.setSampleRate(_sampleRate);
+    }
+
+    ~Recording() {
+        // Free anything the consumer thread never got to.
+        auto* node = _head.exchange(nullptr);
+        while (node) {
+            auto* next = node->next;
+            delete node;
+            node = next;
+        }
     }
 
     void run() {
-        _thread = stdx::thread([consumer = std::move(_pcqPipe.consumer), this] {
+        _thread = stdx::thread([this] {
             try {
                 DataBuilder db;
                 std::fstream out(_path,
                                  std::ios_base::binary | std::ios_base::trunc | std::ios_base::out);
 
+                bool draining = false;
                 while (true) {
-                    std::deque<TrafficRecordingPacket> storage;
-                    size_t bytes;
+                    PacketNode* chain = _head.exchange(nullptr);
 
-                    std::tie(storage, bytes) = consumer.popManyUpTo(MaxMessageSizeBytes);
+                    if (!chain) {
+                        if (draining) {
+                            break;
+                        }
 
-                    // if this fired... somehow we got a message bigger than a message
-                    invariant(bytes);
+                        stdx::unique_lock<Latch> lk(_mutex);
+                        if (_inShutdown) {
+                            // Go around once more to drain anything racing with shutdown.
+                            draining = true;
+                            continue;
+                        }
+                        _notEmpty.wait_for(lk, Milliseconds(100).toSystemDuration());
+                        continue;
+                    }
+
+                    // The chain comes off the stack in LIFO order; reverse it so packets are
+                    // written in push order. Owning the nodes through unique_ptrs keeps them from
+                    // leaking if a write below throws.
+                    std::deque<std::unique_ptr<PacketNode>> storage;
+                    while (chain) {
+                        auto* next = chain->next;
+                        storage.emplace_front(chain);
+                        chain = next;
+                    }
 
                     for (const auto& packet : storage) {
                         db.clear();
-                        Message toWrite = packet.message;
+                        const Message& toWrite = packet->message;
 
                         uassertStatusOK(db.writeAndAdvance<LittleEndian<uint32_t>>(0));
-                        uassertStatusOK(db.writeAndAdvance<LittleEndian<uint64_t>>(packet.id));
+                        uassertStatusOK(
+                            db.writeAndAdvance<LittleEndian<uint64_t>>(packet->session->id()));
                         uassertStatusOK(db.writeAndAdvance<Terminated<'\0', StringData>>(
-                            StringData(packet.local)));
+                            StringData(packet->session->local().toString())));
                         uassertStatusOK(db.writeAndAdvance<Terminated<'\0', StringData>>(
-                            StringData(packet.remote)));
+                            StringData(packet->session->remote().toString())));
                         uassertStatusOK(db.writeAndAdvance<LittleEndian<uint64_t>>(
-                            packet.now.toMillisSinceEpoch()));
-                        uassertStatusOK(db.writeAndAdvance<LittleEndian<uint64_t>>(packet.order));
+                            packet->now.toMillisSinceEpoch()));
+                        uassertStatusOK(db.writeAndAdvance<LittleEndian<uint64_t>>(packet->order));
 
                         auto size = db.size() + toWrite.size();
                         db.getCursor().write<LittleEndian<uint32_t>>(size);
@@ -143,13 +175,15 @@ public:
 
                         out.write(db.getCursor().data(), db.size());
                         out.write(toWrite.buf(), toWrite.size());
+
+                        _bufferedBytes.subtractAndFetch(toWrite.size());
                     }
                 }
-            } catch (const ExceptionFor<ErrorCodes::ProducerConsumerQueueConsumed>&) {
-                // Close naturally
             } catch (...) {
                 auto status = exceptionToStatus();
 
+                _failed.store(true);
+
                 stdx::lock_guard<Latch> lk(_mutex);
                 _result = status;
             }
@@ -157,33 +191,48 @@ public:
     }
 
     /**
-     * pushRecord returns false if the queue was full.  This is ultimately fatal to the recording
+     * Returns whether this session falls within the recording's 1-in-sampleRate session sample.
+     */
+    bool shouldSample(const transport::SessionHandle& ts) const {
+        return _sampleRate == 1 || (ts->id() % static_cast<uint64_t>(_sampleRate)) == 0;
+    }
+
+    /**
+     * pushRecord returns false if the recording has failed.  This is ultimately fatal to the
+     * recording.  A full buffer is not: the packet is dropped and counted instead, so recording
+     * live traffic never blocks or kills the recording when the flush thread falls behind.
      */
     bool pushRecord(const transport::SessionHandle& ts,
                     Date_t now,
                     const uint64_t order,
                     const Message& message) {
-        try {
-            _pcqPipe.producer.push(
-                {ts->id(), ts->local().toString(), ts->remote().toString(), now, order, message});
+        if (_failed.load()) {
+            return false;
+        }
+
+        if (_bufferedBytes.addAndFetch(message.size()) > _maxBufferSize &&
+            !shouldAlwaysRecordTraffic) {
+            _bufferedBytes.subtractAndFetch(message.size());
+            _droppedPackets.addAndFetch(1);
             return true;
-        } catch (const ExceptionFor<ErrorCodes::ProducerConsumerQueueProducerQueueDepthExceeded>&) {
-            invariant(!shouldAlwaysRecordTraffic);
+        }
 
-            // If we couldn't push our packet begin the process of failing the recording
-            _pcqPipe.producer.close();
+        // The message only bumps a reference on its underlying SharedBuffer and the session is
+        // held by handle, so the enqueue itself copies no payload bytes.
+        auto* node = new PacketNode{nullptr, ts, now, order, message};
 
-            stdx::lock_guard<Latch> lk(_mutex);
+        PacketNode* prev = _head.load();
+        do {
+            node->next = prev;
+        } while (!_head.compare_exchange_weak(prev, node));
 
-            // If the result was otherwise okay, mark it as failed due to the queue blocking.  If
-            // it failed for another reason, don't overwrite that.
-            if (_result.isOK()) {
-                _result = Status(ErrorCodes::Error(51061), "queue was blocked in traffic recorder");
-            }
-        } catch (const ExceptionFor<ErrorCodes::ProducerConsumerQueueEndClosed>&) {
+        if (!prev) {
+            // The stack was empty, so the consumer may be waiting.
+            stdx::lock_guard<Latch> lk(_mutex);
+            _notEmpty.notify_one();
         }
 
-        return false;
+        return true;
     }
 
     Status shutdown() {
@@ -191,9 +240,9 @@ public:
 
         if (!_inShutdown) {
             _inShutdown = true;
+            _notEmpty.notify_one();
             lk.unlock();
 
-            _pcqPipe.producer.close();
             _thread.join();
 
             lk.lock();
@@ -204,29 +253,23 @@ public:
 
     BSONObj getStats() {
         stdx::lock_guard<Latch> lk(_mutex);
-        _trafficStats.setBufferedBytes(_pcqPipe.controller.getStats().queueDepth);
+        _trafficStats.setBufferedBytes(static_cast<long long>(_bufferedBytes.load()));
         _trafficStats.setCurrentFileSize(_written);
+        _trafficStats.setDroppedPackets(static_cast<long long>(_droppedPackets.load()));
         return _trafficStats.toBSON();
     }
 
     AtomicWord<uint64_t> order{0};
 
 private:
-    struct TrafficRecordingPacket {
-        const uint64_t id;
-        const std::string local;
-        const std::string remote;
+    struct PacketNode {
+        PacketNode* next;
+        const transport::SessionHandle session;
         const Date_t now;
         const uint64_t order;
         const Message message;
     };
 
-    struct CostFunction {
-        size_t operator()(const TrafficRecordingPacket& packet) const {
-            return packet.message.size();
-        }
-    };
-
     static std::string _getPath(const std::string& filename) {
         uassert(ErrorCodes::BadValue,
                 "Traffic recording filename must not be empty",
@@ -247,11 +290,20 @@ private:
 
     const std::string _path;
     const size_t _maxLogSize;
+    const size_t _maxBufferSize;
+    const int64_t _sampleRate;
+
+    // Lock-free multi-producer single-consumer stack of pending packets. Producers push with a
+    // CAS; the consumer thread takes the whole chain with an exchange and reverses it.
+    std::atomic<PacketNode*> _head{nullptr};  // NOLINT
+    AtomicWord<size_t> _bufferedBytes{0};
+    AtomicWord<uint64_t> _droppedPackets{0};
+    AtomicWord<bool> _failed{false};
 
-    MultiProducerSingleConsumerQueue<TrafficRecordingPacket, CostFunction>::Pipe _pcqPipe;
     stdx::thread _thread;
 
     Mutex _mutex = MONGO_MAKE_LATCH("Recording::_mutex");
+    stdx::condition_variable _notEmpty;
     bool _inShutdown = false;
     TrafficRecorderStats _trafficStats;
     size_t _written = 0;
@@ -326,6 +378,10 @@ void TrafficRecorder::observe(const transport::SessionHandle& ts,
             }
         }
 
+        if (!_recording->shouldSample(ts)) {
+            return;
+        }
+
         invariant(_recording->pushRecord(ts, now, _recording->order.addAndFetch(1), message));
         return;
     }
@@ -341,7 +397,13 @@ void TrafficRecorder::observe(const transport::SessionHandle& ts,
         return;
     }
 
-    // Try to record the message
+    // Only 1 in sampleRate sessions is captured
+    if (!recording->shouldSample(ts)) {
+        return;
+    }
+
+    // Try to record the message.  A full buffer drops the message and counts it; push only fails
+    // when the recording itself has failed.
     if (recording->pushRecord(ts, now, recording->order.addAndFetch(1), message)) {
         return;
     }
@@ -47,6 +47,7 @@
 #include "mongo/db/exec/delete.h"
 #include "mongo/db/index/index_descriptor.h"
 #include "mongo/db/namespace_string.h"
+#include "mongo/db/operation_context.h"
 #include "mongo/db/ops/insert.h"
 #include "mongo/db/query/internal_plans.h"
 #include "mongo/db/repl/replication_coordinator.h"
@@ -57,6 +58,7 @@
 #include "mongo/logv2/log.h"
 #include "mongo/util/background.h"
 #include "mongo/util/concurrency/idle_thread_block.h"
+#include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/exit.h"
 
 namespace mongo {
@@ -186,6 +188,13 @@ private:
             ttlIndexes.push_back(std::make_pair(*nss, spec.getOwned()));
         }
 
+        const size_t concurrency =
+            std::min(static_cast<size_t>(ttlMonitorConcurrency.load()), ttlIndexes.size());
+        if (concurrency > 1) {
+            doTTLForIndexesInParallel(ttlIndexes, concurrency);
+            return;
+        }
+
         for (const auto& it : ttlIndexes) {
             try {
                 doTTLForIndex(&opCtx, it.first, it.second);
@@ -206,6 +215,47 @@ private:
         }
     }
 
+    /**
+     * Processes the given TTL indexes on a pool of 'concurrency' worker threads, each with its
+     * own OperationContext, so that expiry of one large collection does not starve the others.
+     */
+    void doTTLForIndexesInParallel(
+        const std::vector<std::pair<NamespaceString, BSONObj>>& ttlIndexes, size_t concurrency) {
+        ThreadPool::Options options;
+        options.poolName = "TTLMonitorWorker";
+        options.minThreads = 0;
+        options.maxThreads = concurrency;
+        options.onCreateThread = [](const std::string& threadName) {
+            Client::initThread(threadName.c_str());
+            stdx::lock_guard<Client> lk(cc());
+            cc().setSystemOperationKillable(lk);
+        };
+        ThreadPool pool(options);
+        pool.startup();
+
+        for (const auto& it : ttlIndexes) {
+            pool.schedule([this, ttlIndex = it](Status scheduleStatus) {
+                invariant(scheduleStatus);
+                const ServiceContext::UniqueOperationContext opCtxPtr = cc().makeOperationContext();
+                try {
+                    doTTLForIndex(opCtxPtr.get(), ttlIndex.first, ttlIndex.second);
+                } catch (const ExceptionForCat<ErrorCategory::Interruption>& interruption) {
+                    LOGV2_DEBUG(4915305,
+                                1,
+                                "TTL worker was interrupted",
+                                "interruption"_attr = interruption);
+                } catch (const DBException& dbex) {
+                    LOGV2_ERROR(4915306,
+                                "Error processing ttl index: {it_second} -- {dbex}",
+                                "it_second"_attr = ttlIndex.second,
+                                "dbex"_attr = dbex.toString());
+                }
+            });
+        }
+        pool.shutdown();
+        pool.join();
+    }
+
     /**
      * Remove documents from the collection using the specified TTL index after a sufficient amount
      * of time has passed according to its expiry specification.
@@ -239,6 +289,10 @@ private:
                     "key"_attr = key,
                     "name"_attr = name);
 
+        // TTL deletes are background work: when flow control or the storage engine is handing out
+        // tickets under backpressure, user operations should be admitted ahead of them.
+        ScopedAdmissionPriority admissionPriority(opCtx, AdmissionPriority::kLow);
+
         AutoGetCollection autoGetCollection(opCtx, collectionNSS, MODE_IX);
         if (MONGO_unlikely(hangTTLMonitorWithLock.shouldFail())) {
             LOGV2(22534, "Hanging due to hangTTLMonitorWithLock fail point");
@@ -315,6 +369,12 @@ private:
         params->isMulti = true;
         params->canonicalQuery = canonicalQuery.getValue().get();
 
+        const long long batchSize = ttlMonitorBatchSize.load();
+        // When deleting in batches, deleted documents are returned from the plan so deletions can
+        // be counted and paced. The documents were already fetched to be deleted, so this does
+        // not add reads.
+        params->returnDeleted = batchSize > 0;
+
         auto exec =
             InternalPlanner::deleteWithIndexScan(opCtx,
                                                  collection,
@@ -326,7 +386,8 @@ private:
                                                  PlanExecutor::YIELD_AUTO,
                                                  direction);
 
-        Status result = exec->executePlan();
+        Status result =
+            batchSize > 0 ? executePlanInBatches(opCtx, exec.get(), batchSize) : exec->executePlan();
         if (!result.isOK()) {
             LOGV2_ERROR(22543,
                         "ttl query execution for index {idx} failed with status: {result}",
@@ -340,6 +401,66 @@ private:
         LOGV2_DEBUG(22536, 1, "deleted: {numDeleted}", "numDeleted"_attr = numDeleted);
     }
 
+    /**
+     * Drives 'exec', a multi-delete plan with returnDeleted set, to completion while pacing the
+     * deletions in batches of 'batchSize' documents, so that expiry bursts do not overwhelm
+     * foreground traffic or secondaries. Between batches the monitor optionally sleeps for
+     * ttlMonitorBatchDelayMS, and ends the pass for this index early if the majority commit
+     * point lags by more than ttlMonitorMaxReplicationLagSecs, since every deletion must also be
+     * replicated and applied. Any remaining expired documents are picked up by the next pass.
+     */
+    Status executePlanInBatches(OperationContext* opCtx, PlanExecutor* exec, long long batchSize) {
+        long long docsInBatch = 0;
+        BSONObj deletedDoc;
+        PlanExecutor::ExecState state;
+        while (PlanExecutor::ADVANCED == (state = exec->getNext(&deletedDoc, nullptr))) {
+            if (++docsInBatch < batchSize) {
+                continue;
+            }
+            docsInBatch = 0;
+
+            const long long maxLagSecs = ttlMonitorMaxReplicationLagSecs.load();
+            if (maxLagSecs > 0) {
+                const long long lagSecs = majorityReplicationLagSecs(opCtx);
+                if (lagSecs > maxLagSecs) {
+                    LOGV2_DEBUG(4915307,
+                                1,
+                                "Ending TTL deletion pass early because the majority commit point "
+                                "is lagging",
+                                "lagSecs"_attr = lagSecs,
+                                "maxLagSecs"_attr = maxLagSecs);
+                    return Status::OK();
+                }
+            }
+
+            const long long delayMS = ttlMonitorBatchDelayMS.load();
+            if (delayMS > 0) {
+                opCtx->sleepFor(Milliseconds(delayMS));
+            }
+        }
+        if (PlanExecutor::IS_EOF != state) {
+            return exec->getMemberObjectStatus(deletedDoc);
+        }
+        return Status::OK();
+    }
+
+    /**
+     * Returns how far, in seconds of wall clock time, the majority commit point lags behind this
+     * node's last applied optime. Returns 0 when not in a replica set.
+     */
+    long long majorityReplicationLagSecs(OperationContext* opCtx) const {
+        auto replCoord = repl::ReplicationCoordinator::get(opCtx);
+        if (replCoord->getReplicationMode() != repl::ReplicationCoordinator::modeReplSet) {
+            return 0;
+        }
+        const Date_t lastApplied = replCoord->getMyLastAppliedOpTimeAndWallTime().wallTime;
+        const Date_t lastCommitted = replCoord->getLastCommittedOpTimeAndWallTime().wallTime;
+        if (lastCommitted >= lastApplied) {
+            return 0;
+        }
+        return durationCount<Seconds>(lastApplied - lastCommitted);
+    }
+
     ServiceContext* _serviceContext;
 };
 
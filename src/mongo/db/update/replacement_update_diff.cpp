@@ -0,0 +1,148 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/update/replacement_update_diff.h"
+
+#include <vector>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/update/log_builder.h"
+#include "mongo/util/string_map.h"
+
+namespace mongo {
+namespace update {
+
+namespace {
+
+/**
+ * Returns true if 'name' can be used as a path in a $set or $unset. A top-level field name that
+ * is empty, starts with '$' or contains a dot would not round-trip through the modifier-update
+ * parser as a single top-level component.
+ */
+bool isDiffableFieldName(StringData name) {
+    return !name.empty() && name[0] != '$' && name.find('.') == std::string::npos;
+}
+
+}  // namespace
+
+boost::optional<BSONObj> makeReplacementOplogDiff(const BSONObj& preImage,
+                                                  const BSONObj& postImage) {
+    StringMap<BSONElement> preByName;
+    for (auto&& elt : preImage) {
+        if (!preByName.emplace(elt.fieldNameStringData().toString(), elt).second) {
+            // Duplicate field names cannot be addressed by a modifier path.
+            return boost::none;
+        }
+    }
+
+    // Walk the post-image, classifying each field as shared with the pre-image or new. Shared
+    // fields are updated in place by a $set, so their relative order is whatever the pre-image
+    // had; new fields are appended at the end of the document in lexicographic order by the
+    // update executor. The diff is therefore only equivalent to the replacement when the
+    // post-image consists of the shared fields (in pre-image order, checked below) followed by
+    // the new fields in lexicographic order.
+    std::vector<BSONElement> setElems;
+    std::vector<StringData> sharedPostOrder;
+    StringSet postNames;
+    StringData prevNewField;
+    bool seenNewField = false;
+    for (auto&& elt : postImage) {
+        StringData name = elt.fieldNameStringData();
+        if (!isDiffableFieldName(name)) {
+            return boost::none;
+        }
+        postNames.insert(name.toString());
+        auto preIt = preByName.find(name);
+        if (preIt != preByName.end()) {
+            if (seenNewField) {
+                return boost::none;
+            }
+            sharedPostOrder.push_back(name);
+            if (!preIt->second.binaryEqualValues(elt)) {
+                setElems.push_back(elt);
+            }
+        } else {
+            if (seenNewField && prevNewField >= name) {
+                return boost::none;
+            }
+            seenNewField = true;
+            prevNewField = name;
+            setElems.push_back(elt);
+        }
+    }
+
+    std::vector<StringData> unsetNames;
+    std::vector<StringData> sharedPreOrder;
+    for (auto&& elt : preImage) {
+        StringData name = elt.fieldNameStringData();
+        if (postNames.count(name)) {
+            sharedPreOrder.push_back(name);
+        } else {
+            if (!isDiffableFieldName(name)) {
+                return boost::none;
+            }
+            unsetNames.push_back(name);
+        }
+    }
+
+    if (sharedPreOrder != sharedPostOrder) {
+        return boost::none;
+    }
+    if (setElems.empty() && unsetNames.empty()) {
+        // The images are identical; there is nothing worth logging as a diff.
+        return boost::none;
+    }
+
+    BSONObjBuilder diff;
+    diff.append(LogBuilder::kUpdateSemanticsFieldName,
+                static_cast<int>(UpdateSemantics::kUpdateNode));
+    if (!setElems.empty()) {
+        BSONObjBuilder setBuilder(diff.subobjStart("$set"));
+        for (auto&& elt : setElems) {
+            setBuilder.append(elt);
+        }
+    }
+    if (!unsetNames.empty()) {
+        BSONObjBuilder unsetBuilder(diff.subobjStart("$unset"));
+        for (auto&& name : unsetNames) {
+            unsetBuilder.append(name, true);
+        }
+    }
+
+    auto diffObj = diff.obj();
+    if (diffObj.objsize() >= postImage.objsize()) {
+        return boost::none;
+    }
+    return diffObj;
+}
+
+}  // namespace update
+}  // namespace mongo
@@ -0,0 +1,55 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <boost/optional.hpp>
+
+#include "mongo/bson/bsonobj.h"
+
+namespace mongo {
+namespace update {
+
+/**
+ * Computes a modifier-style oplog entry of the form {$v: 1, $set: {...}, $unset: {...}} that is
+ * equivalent to replacing 'preImage' with 'postImage', diffing at top-level field granularity.
+ *
+ * Returns boost::none when no equivalent modifier entry exists or when the modifier form would
+ * not be smaller than logging 'postImage' itself. "Equivalent" is strict: applying the returned
+ * entry to 'preImage' through the ordinary modifier-update path must reproduce 'postImage' byte
+ * for byte, including field order, so that replica set members converge on identical documents.
+ * In particular the diff is abandoned when the replacement reorders fields that both images
+ * share, or when it inserts new fields anywhere other than where the update executor would
+ * append them (at the end of the document, in lexicographic order).
+ */
+boost::optional<BSONObj> makeReplacementOplogDiff(const BSONObj& preImage,
+                                                  const BSONObj& postImage);
+
+}  // namespace update
+}  // namespace mongo
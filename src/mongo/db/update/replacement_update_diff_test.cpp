@@ -0,0 +1,114 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/update/replacement_update_diff.h"
+
+#include "mongo/bson/json.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+TEST(ReplacementUpdateDiffTest, ChangedFieldProducesSet) {
+    auto diff = update::makeReplacementOplogDiff(
+        fromjson("{_id: 1, a: 'some long enough string', b: 2}"),
+        fromjson("{_id: 1, a: 'some long enough string', b: 3}"));
+    ASSERT(diff);
+    ASSERT_BSONOBJ_EQ(*diff, fromjson("{$v: 1, $set: {b: 3}}"));
+}
+
+TEST(ReplacementUpdateDiffTest, RemovedFieldProducesUnset) {
+    auto diff = update::makeReplacementOplogDiff(
+        fromjson("{_id: 1, a: 'some long enough string', b: 2}"),
+        fromjson("{_id: 1, a: 'some long enough string'}"));
+    ASSERT(diff);
+    ASSERT_BSONOBJ_EQ(*diff, fromjson("{$v: 1, $unset: {b: true}}"));
+}
+
+TEST(ReplacementUpdateDiffTest, NewTrailingFieldsProduceSetInLexicographicOrder) {
+    auto diff = update::makeReplacementOplogDiff(
+        fromjson("{_id: 1, a: 'some long enough string'}"),
+        fromjson("{_id: 1, a: 'some long enough string', b: 2, c: 3}"));
+    ASSERT(diff);
+    ASSERT_BSONOBJ_EQ(*diff, fromjson("{$v: 1, $set: {b: 2, c: 3}}"));
+}
+
+TEST(ReplacementUpdateDiffTest, CombinesSetAndUnset) {
+    auto diff = update::makeReplacementOplogDiff(
+        fromjson("{_id: 1, a: 'some long enough string', b: 2}"),
+        fromjson("{_id: 1, a: 'some long enough string', c: 3}"));
+    ASSERT(diff);
+    ASSERT_BSONOBJ_EQ(*diff, fromjson("{$v: 1, $set: {c: 3}, $unset: {b: true}}"));
+}
+
+TEST(ReplacementUpdateDiffTest, NoDiffWhenSharedFieldsAreReordered) {
+    ASSERT_FALSE(update::makeReplacementOplogDiff(
+        fromjson("{_id: 1, a: 'some long enough string', b: 2}"),
+        fromjson("{_id: 1, b: 2, a: 'some long enough string'}")));
+}
+
+TEST(ReplacementUpdateDiffTest, NoDiffWhenNewFieldPrecedesSharedField) {
+    // A $set cannot insert 'b' in front of 'z'; it would be appended at the end.
+    ASSERT_FALSE(update::makeReplacementOplogDiff(
+        fromjson("{_id: 1, a: 'some long enough string', z: 2}"),
+        fromjson("{_id: 1, a: 'some long enough string', b: 3, z: 2}")));
+}
+
+TEST(ReplacementUpdateDiffTest, NoDiffWhenNewFieldsAreNotLexicographicallyOrdered) {
+    // The update executor appends new fields in lexicographic order, so applying {$set: {c: ...,
+    // b: ...}} would yield 'b' before 'c' and not reproduce this post-image.
+    ASSERT_FALSE(update::makeReplacementOplogDiff(
+        fromjson("{_id: 1, a: 'some long enough string'}"),
+        fromjson("{_id: 1, a: 'some long enough string', c: 3, b: 2}")));
+}
+
+TEST(ReplacementUpdateDiffTest, NoDiffForFieldNamesUnusableAsModifierPaths) {
+    ASSERT_FALSE(update::makeReplacementOplogDiff(
+        fromjson("{_id: 1, a: 'some long enough string', 'b.c': 1}"),
+        fromjson("{_id: 1, a: 'some long enough string', 'b.c': 2}")));
+    ASSERT_FALSE(update::makeReplacementOplogDiff(
+        fromjson("{_id: 1, a: 'some long enough string'}"),
+        fromjson("{_id: 1, a: 'some long enough string', '$b': 2}")));
+}
+
+TEST(ReplacementUpdateDiffTest, NoDiffForIdenticalImages) {
+    ASSERT_FALSE(update::makeReplacementOplogDiff(fromjson("{_id: 1, a: 2}"),
+                                                  fromjson("{_id: 1, a: 2}")));
+}
+
+TEST(ReplacementUpdateDiffTest, NoDiffWhenModifierFormIsNotSmaller) {
+    // Every field changed; the $set form carries the same payload plus modifier overhead.
+    ASSERT_FALSE(
+        update::makeReplacementOplogDiff(fromjson("{a: 1, b: 2}"), fromjson("{a: 3, b: 4}")));
+}
+
+}  // namespace
+}  // namespace mongo
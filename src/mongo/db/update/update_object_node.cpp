@@ -39,6 +39,7 @@
 #include "mongo/db/update/update_array_node.h"
 #include "mongo/db/update/update_leaf_node.h"
 #include "mongo/util/str.h"
+#include "mongo/util/string_map.h"
 
 namespace mongo {
 
@@ -80,6 +81,38 @@ StatusWith<std::string> parseArrayFilterIdentifier(
     return identifier.toString();
 }
 
+/**
+ * Maps the field names targeted by an UpdateObjectNode's children to the corresponding child
+ * elements of the document element being updated. Built with a single walk over the document
+ * element's children, replacing the per-modifier left-to-right scans that make applying an
+ * update quadratic in the number of document fields. Names with no entry do not exist in the
+ * document. The field names are copied because an update can grow the document's field name
+ * heap, which would invalidate StringData keys pointing into it.
+ */
+using ChildLookupTable = StringMap<mutablebson::Element>;
+
+// Only build a lookup table when the update has at least this many modifiers at one level.
+// Updates touching a handful of fields do as well with the plain scans and skip the table's
+// construction cost.
+constexpr size_t kMinChildrenForLookupTable = 8;
+
+/**
+ * Walks the children of 'element' once, recording the first child whose field name appears in
+ * 'targets'. Stops early once every target has been found.
+ */
+ChildLookupTable buildChildLookupTable(mutablebson::Element element,
+                                       const StringDataSet& targets) {
+    ChildLookupTable table;
+    for (auto child = element.leftChild(); child.ok() && table.size() < targets.size();
+         child = child.rightSibling()) {
+        auto fieldName = child.getFieldName();
+        if (targets.count(fieldName)) {
+            table.try_emplace(fieldName, child);
+        }
+    }
+    return table;
+}
+
 /**
  * Gets the child of 'element' named 'field', if it exists. Otherwise returns a non-ok element.
  */
@@ -106,7 +139,8 @@ void applyChild(const UpdateNode& child,
                 StringData field,
                 UpdateExecutor::ApplyParams* applyParams,
                 UpdateNode::UpdateNodeApplyParams* updateNodeApplyParams,
-                UpdateExecutor::ApplyResult* applyResult) {
+                UpdateExecutor::ApplyResult* applyResult,
+                const ChildLookupTable* childLookup) {
 
     auto pathTakenSizeBefore = updateNodeApplyParams->pathTaken->numParts();
 
@@ -117,6 +151,10 @@ void applyChild(const UpdateNode& child,
     if (!updateNodeApplyParams->pathToCreate->empty()) {
         // We're already traversing a path with elements that don't exist yet, so we will definitely
         // need to append.
+    } else if (childLookup) {
+        if (auto it = childLookup->find(field); it != childLookup->end()) {
+            childElement = it->second;
+        }
     } else {
         childElement = getChild(applyParams->element, field);
     }
@@ -404,6 +442,25 @@ UpdateExecutor::ApplyResult UpdateObjectNode::apply(
 
     auto applyResult = ApplyResult::noopResult();
 
+    // When this update has many children, locate all of their target fields with one walk over
+    // the document element instead of one left-to-right scan per child. Only object elements
+    // with no pending 'pathToCreate' resolve children by name.
+    boost::optional<ChildLookupTable> childLookup;
+    if (_children.size() >= kMinChildrenForLookupTable &&
+        updateNodeApplyParams.pathToCreate->empty() &&
+        applyParams.element.getType() == BSONType::Object) {
+        StringDataSet targets;
+        targets.reserve(_children.size() + 1);
+        for (const auto& pair : _children) {
+            targets.insert(pair.first);
+        }
+        if (applyPositional) {
+            targets.insert(applyParams.matchedField);
+        }
+        childLookup = buildChildLookupTable(applyParams.element, targets);
+    }
+    const ChildLookupTable* childLookupPtr = childLookup ? childLookup.get_ptr() : nullptr;
+
     for (const auto& pair : _children) {
 
         // If this child has the same field name as the positional child, they must be merged and
@@ -436,7 +493,8 @@ UpdateExecutor::ApplyResult UpdateObjectNode::apply(
                        pair.first,
                        &applyParams,
                        &updateNodeApplyParams,
-                       &applyResult);
+                       &applyResult,
+                       childLookupPtr);
 
             applyPositional = false;
             continue;
@@ -449,12 +507,14 @@ UpdateExecutor::ApplyResult UpdateObjectNode::apply(
                        applyParams.matchedField,
                        &applyParams,
                        &updateNodeApplyParams,
-                       &applyResult);
+                       &applyResult,
+                       childLookupPtr);
             applyPositional = false;
         }
 
         // Apply the current child.
-        applyChild(*pair.second, pair.first, &applyParams, &updateNodeApplyParams, &applyResult);
+        applyChild(
+            *pair.second, pair.first, &applyParams, &updateNodeApplyParams, &applyResult, childLookupPtr);
     }
 
     // 'matchedField' is alphabetically after all children, so we apply it now.
@@ -463,7 +523,8 @@ UpdateExecutor::ApplyResult UpdateObjectNode::apply(
                    applyParams.matchedField,
                    &applyParams,
                    &updateNodeApplyParams,
-                   &applyResult);
+                   &applyResult,
+                   childLookupPtr);
     }
 
     return applyResult;
@@ -1844,6 +1844,37 @@ TEST_F(UpdateObjectNodeTest, ApplyExistingAndNonexistingFields) {
     ASSERT_EQUALS(getModifiedPaths(), "{a, b, c, d}");
 }
 
+TEST_F(UpdateObjectNodeTest, ApplyManyFieldsUsesSinglePassChildLookup) {
+    // Updates with at least eight children locate their target fields with a single walk over the
+    // document instead of one scan per child; results must be identical.
+    auto setUpdate = fromjson("{$set: {a: 1, b: 2, c: 3, d: 4, e: 5, f: 6, g: 7, h: 8, i: 9}}");
+    boost::intrusive_ptr<ExpressionContextForTest> expCtx(new ExpressionContextForTest());
+    std::map<StringData, std::unique_ptr<ExpressionWithPlaceholder>> arrayFilters;
+    std::set<std::string> foundIdentifiers;
+    UpdateObjectNode root;
+    for (auto&& field : setUpdate["$set"].embeddedObject()) {
+        ASSERT_OK(UpdateObjectNode::parseAndMerge(&root,
+                                                  modifiertable::ModifierType::MOD_SET,
+                                                  field,
+                                                  expCtx,
+                                                  arrayFilters,
+                                                  foundIdentifiers));
+    }
+
+    mutablebson::Document doc(fromjson("{i: 0, x: 0, e: 0, a: 0, c: 0, g: 0}"));
+    addIndexedPath("a");
+    auto result = root.apply(getApplyParams(doc.root()), getUpdateNodeApplyParams());
+    ASSERT_TRUE(result.indexesAffected);
+    ASSERT_FALSE(result.noop);
+    ASSERT_BSONOBJ_EQ(fromjson("{i: 9, x: 0, e: 5, a: 1, c: 3, g: 7, b: 2, d: 4, f: 6, h: 8}"),
+                      doc.getObject());
+    ASSERT_FALSE(doc.isInPlaceModeEnabled());
+    ASSERT_BSONOBJ_EQ(
+        fromjson("{$set: {a: 1, b: 2, c: 3, d: 4, e: 5, f: 6, g: 7, h: 8, i: 9}}"),
+        getLogDoc().getObject());
+    ASSERT_EQUALS(getModifiedPaths(), "{a, b, c, d, e, f, g, h, i}");
+}
+
 TEST_F(UpdateObjectNodeTest, ApplyExistingNestedPaths) {
     auto setUpdate = fromjson("{$set: {'a.b': 6, 'a.c': 7, 'b.d': 8, 'b.e': 9}}");
     boost::intrusive_ptr<ExpressionContextForTest> expCtx(new ExpressionContextForTest());
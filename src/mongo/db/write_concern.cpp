@@ -44,6 +44,7 @@
 #include "mongo/db/repl/storage_interface.h"
 #include "mongo/db/server_options.h"
 #include "mongo/db/service_context.h"
+#include "mongo/db/stats/operation_latency_phases.h"
 #include "mongo/db/stats/timer_stats.h"
 #include "mongo/db/storage/control/storage_control.h"
 #include "mongo/db/storage/storage_engine.h"
@@ -345,6 +346,8 @@ Status waitForWriteConcern(OperationContext* opCtx,
     // Replica set stepdowns and gle mode changes are thrown as errors
     repl::ReplicationCoordinator::StatusAndDuration replStatus =
         replCoord->awaitReplication(opCtx, replOpTime, writeConcernWithPopulatedSyncMode);
+    OperationLatencyPhases::get(opCtx).add(OperationLatencyPhases::kReplicationWait,
+                                           duration_cast<Microseconds>(replStatus.duration));
     if (replStatus.status == ErrorCodes::WriteConcernFailed) {
         gleWtimeouts.increment();
         if (!writeConcern.getProvenance().isClientSupplied()) {
@@ -38,6 +38,7 @@
 #include "mongo/db/clientcursor.h"
 #include "mongo/db/cursor_manager.h"
 #include "mongo/db/cursor_server_params.h"
+#include "mongo/db/cursor_server_params_gen.h"
 #include "mongo/db/exec/queued_data_stage.h"
 #include "mongo/db/exec/working_set.h"
 #include "mongo/db/exec/working_set_common.h"
@@ -244,6 +245,73 @@ TEST_F(CursorManagerTest, InactiveCursorShouldTimeout) {
     ASSERT_EQ(0UL, cursorManager->numCursors());
 }
 
+/**
+ * Test that when open cursors exceed the configured memory limit, the heaviest idle cursors are
+ * evicted first and eviction stops once the total drops back under the limit.
+ */
+TEST_F(CursorManagerTest, EvictsHeaviestIdleCursorsWhenOverMemoryLimit) {
+    CursorManager* cursorManager = useCursorManager();
+
+    gCursorMemoryLimitMB.store(1);
+    ON_BLOCK_EXIT([] { gCursorMemoryLimitMB.store(0); });
+
+    auto registerCursorWithCommand = [&](BSONObj originatingCommand) {
+        auto cursorPin = cursorManager->registerCursor(
+            _opCtx.get(),
+            {
+                makeFakePlanExecutor(),
+                kTestNss,
+                {},
+                {},
+                repl::ReadConcernArgs(repl::ReadConcernLevel::kLocalReadConcern),
+                originatingCommand,
+                ClientCursorParams::LockPolicy::kLocksInternally,
+                PrivilegeVector(),
+                false  // needsMerge
+            });
+        auto cursorId = cursorPin.getCursor()->cursorid();
+        cursorPin.release();
+        return cursorId;
+    };
+
+    auto lightCursorId = registerCursorWithCommand(BSON("find" << kTestNss.coll()));
+    registerCursorWithCommand(BSON("find" << kTestNss.coll() << "padding"
+                                          << std::string(2 * 1024 * 1024, 'x')));
+
+    // Evicting the heavy cursor alone brings the total back under the limit, so the light cursor
+    // survives.
+    ASSERT_EQ(1UL, cursorManager->evictCursorsOverMemoryLimit(_opCtx.get()));
+    ASSERT_EQ(1UL, cursorManager->numCursors());
+    ASSERT_OK(cursorManager->pinCursor(_opCtx.get(), lightCursorId).getStatus());
+}
+
+/**
+ * Test that pinned cursors are never evicted, even when open cursors exceed the memory limit.
+ */
+TEST_F(CursorManagerTest, PinnedCursorsAreNotEvictedUnderMemoryPressure) {
+    CursorManager* cursorManager = useCursorManager();
+
+    gCursorMemoryLimitMB.store(1);
+    ON_BLOCK_EXIT([] { gCursorMemoryLimitMB.store(0); });
+
+    auto cursorPin = cursorManager->registerCursor(
+        _opCtx.get(),
+        {
+            makeFakePlanExecutor(),
+            kTestNss,
+            {},
+            {},
+            repl::ReadConcernArgs(repl::ReadConcernLevel::kLocalReadConcern),
+            BSON("find" << kTestNss.coll() << "padding" << std::string(2 * 1024 * 1024, 'x')),
+            ClientCursorParams::LockPolicy::kLocksInternally,
+            PrivilegeVector(),
+            false  // needsMerge
+        });
+
+    ASSERT_EQ(0UL, cursorManager->evictCursorsOverMemoryLimit(_opCtx.get()));
+    ASSERT_EQ(1UL, cursorManager->numCursors());
+}
+
 /**
  * Test that pinned cursors do not get timed out.
  */
@@ -179,6 +179,39 @@ TEST_F(QueryStageCollectionScanTest, QueryStageCollscanBasicBackwardWithMatch) {
     ASSERT_EQUALS(25, countResults(CollectionScanParams::BACKWARD, obj));
 }
 
+// Drive the scan through the batched protocol and make sure it returns the same documents in the
+// same order as the single-result protocol.
+TEST_F(QueryStageCollectionScanTest, QueryStageCollscanWorkBatchBasicForward) {
+    AutoGetCollectionForReadCommand ctx(&_opCtx, nss);
+    auto collection = ctx.getCollection();
+
+    // Configure the scan.
+    CollectionScanParams params;
+    params.direction = CollectionScanParams::FORWARD;
+    params.tailable = false;
+
+    WorkingSet ws;
+    unique_ptr<CollectionScan> scan(
+        new CollectionScan(_expCtx.get(), collection, params, &ws, nullptr));
+
+    int count = 0;
+    PlanStage::StageState state = PlanStage::NEED_TIME;
+    while (PlanStage::IS_EOF != state) {
+        vector<WorkingSetID> batch;
+        WorkingSetID terminalId = WorkingSet::INVALID_ID;
+        state = scan->workBatch(16, &batch, &terminalId);
+        ASSERT(PlanStage::ADVANCED == state || PlanStage::IS_EOF == state);
+        for (WorkingSetID id : batch) {
+            WorkingSetMember* member = ws.get(id);
+            ASSERT(member->hasObj());
+            ASSERT_EQUALS(count, member->doc.value().toBson()["foo"].numberInt());
+            ++count;
+            ws.free(id);
+        }
+    }
+    ASSERT_EQUALS(numObj(), count);
+}
+
 // Get objects in the order we inserted them.
 TEST_F(QueryStageCollectionScanTest, QueryStageCollscanObjectsInOrderForward) {
     AutoGetCollectionForReadCommand ctx(&_opCtx, nss);
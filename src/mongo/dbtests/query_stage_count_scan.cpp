@@ -38,6 +38,7 @@
 #include "mongo/db/db_raii.h"
 #include "mongo/db/dbdirectclient.h"
 #include "mongo/db/exec/collection_scan.h"
+#include "mongo/db/exec/count.h"
 #include "mongo/db/exec/count_scan.h"
 #include "mongo/db/exec/working_set.h"
 #include "mongo/db/json.h"
@@ -579,6 +580,53 @@ public:
     }
 };
 
+//
+// A non-multikey count scan under a CountStage counts keys in batches rather than surfacing one
+// key per work cycle, while still honoring skip and limit.
+//
+class QueryStageCountScanBatchedCount : public CountBase {
+public:
+    void run() {
+        dbtests::WriteContextForTests ctx(&_opCtx, ns());
+
+        const int numDocs = 20;
+        for (int i = 0; i < numDocs; ++i) {
+            insert(BSON("a" << i));
+        }
+        addIndex(BSON("a" << 1));
+
+        auto params = makeCountScanParams(&_opCtx, getIndex(ctx.db(), BSON("a" << 1)));
+        params.startKey = BSON("" << 0);
+        params.startKeyInclusive = true;
+        params.endKey = BSON("" << numDocs);
+        params.endKeyInclusive = true;
+
+        WorkingSet ws;
+        // Owned by the CountStage.
+        auto countScan = new CountScan(_expCtx.get(), params, &ws);
+        ASSERT(countScan->supportsBatchCounting());
+
+        Collection* collection = CollectionCatalog::get(&_opCtx).lookupCollectionByNamespace(
+            &_opCtx, NamespaceString(ns()));
+        CountStage countStage(
+            _expCtx.get(), collection, 10 /* limit */, 3 /* skip */, &ws, countScan);
+
+        int workCycles = 0;
+        WorkingSetID wsid;
+        while (!countStage.isEOF()) {
+            PlanStage::StageState state = countStage.work(&wsid);
+            ASSERT_NOT_EQUALS(PlanStage::FAILURE, state);
+            ++workCycles;
+        }
+
+        const CountStats* stats = static_cast<const CountStats*>(countStage.getSpecificStats());
+        ASSERT_EQUALS(10, stats->nCounted);
+        ASSERT_EQUALS(3, stats->nSkipped);
+        // Batching consumes the whole range in far fewer work cycles than there are keys.
+        ASSERT_LESS_THAN(workCycles, numDocs - 3);
+    }
+};
+
 class All : public OldStyleSuiteSpecification {
 public:
     All() : OldStyleSuiteSpecification("query_stage_count_scan") {}
@@ -594,6 +642,7 @@ public:
         add<QueryStageCountScanDeleteDuringYield>();
         add<QueryStageCountScanInsertNewDocsDuringYield>();
         add<QueryStageCountScanUnusedKeys>();
+        add<QueryStageCountScanBatchedCount>();
     }
 };
 
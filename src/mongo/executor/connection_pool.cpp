@@ -33,10 +33,13 @@
 
 #include "mongo/executor/connection_pool.h"
 
+#include <cmath>
+
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
 #include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/executor/connection_pool_parameters_gen.h"
 #include "mongo/executor/connection_pool_stats.h"
 #include "mongo/executor/remote_command_request.h"
 #include "mongo/logv2/log.h"
@@ -135,8 +138,9 @@ std::string ConnectionPool::ConnectionControls::toString() const {
 }
 
 std::string ConnectionPool::HostState::toString() const {
-    return "{{ requests: {}, ready: {}, pending: {}, active: {}, isExpired: {} }}"_format(
-        requests, ready, pending, active, health.isExpired);
+    return "{{ requests: {}, ready: {}, pending: {}, active: {}, "
+           "forecast: {}, isExpired: {} }}"_format(
+               requests, ready, pending, active, forecastedDemand, health.isExpired);
 }
 
 /**
@@ -161,6 +165,9 @@ public:
         const auto maxConns = getPool()->_options.maxConnections;
 
         data.target = stats.requests + stats.active;
+        if (data.target < stats.forecastedDemand) {
+            data.target = stats.forecastedDemand;
+        }
         if (data.target < minConns) {
             data.target = minConns;
         } else if (data.target > maxConns) {
@@ -320,6 +327,14 @@ public:
      */
     size_t requestsPending() const;
 
+    /**
+     * Returns the histogram of how long callers have waited to acquire connections from this
+     * pool.
+     */
+    const ConnectionWaitTimeHistogram& acquisitionWaitTimes() const {
+        return _acquisitionWaitTimes;
+    }
+
     /**
      * Returns the HostAndPort for this pool.
      */
@@ -352,10 +367,14 @@ private:
     using OwnedConnection = std::shared_ptr<ConnectionInterface>;
     using OwnershipPool = stdx::unordered_map<ConnectionInterface*, OwnedConnection>;
     using LRUOwnershipPool = LRUCache<OwnershipPool::key_type, OwnershipPool::mapped_type>;
-    using Request = std::pair<Date_t, Promise<ConnectionHandle>>;
+    struct Request {
+        Date_t expiration;
+        Date_t started;
+        Promise<ConnectionHandle> promise;
+    };
     struct RequestComparator {
         bool operator()(const Request& a, const Request& b) {
-            return a.first > b.first;
+            return a.expiration > b.expiration;
         }
     };
 
@@ -409,6 +428,22 @@ private:
     std::vector<Request> _requests;
     Date_t _lastActiveTime;
 
+    // The last time any connection to this host completed a successful round trip: a finished
+    // setup or refresh, or a freshly used connection returned in good standing. When
+    // 'connectionPoolShareHostLiveness' is enabled, an idle connection whose refresh comes due
+    // within the refresh window of this time skips its individual refresh ping, so liveness
+    // traffic collapses to at most one probe per host per window.
+    Date_t _lastKnownLive;
+
+    ConnectionWaitTimeHistogram _acquisitionWaitTimes;
+
+    // A decaying estimate of the concurrent connection demand on this pool, maintained only when
+    // Options::forecastConnectionDemand is set. The estimate rises immediately to match observed
+    // demand and decays geometrically as demand falls, so the controller keeps connections
+    // established through brief troughs instead of cold-starting the pool on the next burst.
+    double _demandEstimate = 0.0;
+    static constexpr double kDemandEstimateDecay = 0.9;
+
     std::shared_ptr<TimerInterface> _eventTimer;
     Date_t _eventTimerExpiration;
     Date_t _hostExpiration;
@@ -576,6 +611,7 @@ void ConnectionPool::appendConnectionStats(ConnectionPoolStats* stats) const {
                                      pool->availableConnections(),
                                      pool->createdConnections(),
                                      pool->refreshingConnections()};
+        hostStats.acquisitionWaitTimes = pool->acquisitionWaitTimes();
         stats->updateStatsForHost(_name, host, hostStats);
     }
 }
@@ -652,6 +688,7 @@ Future<ConnectionPool::ConnectionHandle> ConnectionPool::SpecificPool::getConnec
                         "Using existing idle connection to {hostAndPort}",
                         "Using existing idle connection",
                         "hostAndPort"_attr = _hostAndPort);
+            _acquisitionWaitTimes.increment(Milliseconds{0});
             return Future<ConnectionPool::ConnectionHandle>::makeReady(std::move(conn));
         }
     }
@@ -670,7 +707,7 @@ Future<ConnectionPool::ConnectionHandle> ConnectionPool::SpecificPool::getConnec
     const auto expiration = now + timeout;
     auto pf = makePromiseFuture<ConnectionHandle>();
 
-    _requests.push_back(make_pair(expiration, std::move(pf.promise)));
+    _requests.push_back({expiration, now, std::move(pf.promise)});
     std::push_heap(begin(_requests), end(_requests), RequestComparator{});
 
     return std::move(pf.future);
@@ -773,6 +810,9 @@ void ConnectionPool::SpecificPool::finishRefresh(ConnectionInterface* connPtr, S
                 "Finishing connection refresh",
                 "hostAndPort"_attr = _hostAndPort);
 
+    // A completed setup or refresh is a successful round trip to the host.
+    _lastKnownLive = _parent->_factory->now();
+
     // If the connection refreshed successfully, throw it back in the ready pool
     addToReady(std::move(conn));
 
@@ -808,6 +848,13 @@ void ConnectionPool::SpecificPool::returnConnection(ConnectionInterface* connPtr
     }
 
     auto now = _parent->_factory->now();
+
+    // A connection returned in good standing that was used within the refresh window proves the
+    // host is up, on top of the proof recorded when setups and refreshes complete.
+    if (now - conn->getLastUsed() < _parent->_controller->toRefreshTimeout()) {
+        _lastKnownLive = std::max(_lastKnownLive, conn->getLastUsed());
+    }
+
     if (needsRefreshTP <= now) {
         // If we need to refresh this connection
 
@@ -824,6 +871,22 @@ void ConnectionPool::SpecificPool::returnConnection(ConnectionInterface* connPtr
             return;
         }
 
+        if (gConnectionPoolShareHostLiveness.load() &&
+            now - _lastKnownLive < _parent->_controller->toRefreshTimeout()) {
+            // Another connection to this host completed a successful round trip within the
+            // refresh window, so the host's liveness is already established; skip this
+            // connection's refresh ping and make it available again.
+            LOGV2_DEBUG(4957917,
+                        kDiagnosticLogLevel,
+                        "Skipping refresh of idle connection because the host was recently "
+                        "proven live by other traffic",
+                        "hostAndPort"_attr = _hostAndPort);
+            conn->indicateUsed();
+            addToReady(std::move(conn));
+            fulfillRequests();
+            return;
+        }
+
         _processingPool[connPtr] = std::move(conn);
 
         LOGV2_DEBUG(22568,
@@ -947,7 +1010,7 @@ void ConnectionPool::SpecificPool::processFailure(const Status& status) {
     }
 
     for (auto& request : _requests) {
-        request.second.setError(status);
+        request.promise.setError(status);
     }
 
     LOGV2_DEBUG(22573,
@@ -976,11 +1039,12 @@ void ConnectionPool::SpecificPool::fulfillRequests() {
         }
 
         // Grab the request and callback
-        auto promise = std::move(_requests.front().second);
+        auto request = std::move(_requests.front());
         std::pop_heap(begin(_requests), end(_requests), RequestComparator{});
         _requests.pop_back();
 
-        promise.emplaceValue(std::move(conn));
+        _acquisitionWaitTimes.increment(_lastActiveTime - request.started);
+        request.promise.emplaceValue(std::move(conn));
     }
 }
 
@@ -1108,8 +1172,8 @@ void ConnectionPool::SpecificPool::updateEventTimer() {
     }
 
     // If a request would timeout before the next event, then it is the next event
-    if (_requests.size() && (_requests.front().first < nextEventTime)) {
-        nextEventTime = _requests.front().first;
+    if (_requests.size() && (_requests.front().expiration < nextEventTime)) {
+        nextEventTime = _requests.front().expiration;
     }
 
     // If our timer is already set to the next event, then we're done
@@ -1129,11 +1193,12 @@ void ConnectionPool::SpecificPool::updateEventTimer() {
 
         _health.isFailed = false;
 
-        while (_requests.size() && (_requests.front().first <= now)) {
+        while (_requests.size() && (_requests.front().expiration <= now)) {
             std::pop_heap(begin(_requests), end(_requests), RequestComparator{});
 
             auto& request = _requests.back();
-            request.second.setError(Status(
+            _acquisitionWaitTimes.increment(now - request.started);
+            request.promise.setError(Status(
                 ErrorCodes::NetworkInterfaceExceededTimeLimit,
                 fmt::format("Couldn't get a connection within the time limit of {}", timeout)));
             _requests.pop_back();
@@ -1152,6 +1217,20 @@ void ConnectionPool::SpecificPool::updateController() {
 
     auto& controller = *_parent->_controller;
 
+    // When demand forecasting is enabled, fold the current demand into our decaying estimate so
+    // the controller can size the pool for the load we expect rather than only the load we have.
+    size_t forecastedDemand = 0;
+    if (_parent->_options.forecastConnectionDemand) {
+        const auto demand = requestsPending() + inUseConnections();
+        if (demand >= _demandEstimate) {
+            _demandEstimate = demand;
+        } else {
+            _demandEstimate = kDemandEstimateDecay * _demandEstimate +
+                (1 - kDemandEstimateDecay) * demand;
+        }
+        forecastedDemand = static_cast<size_t>(std::ceil(_demandEstimate));
+    }
+
     // Update our own state
     HostState state{
         _health,
@@ -1159,6 +1238,7 @@ void ConnectionPool::SpecificPool::updateController() {
         refreshingConnections(),
         availableConnections(),
         inUseConnections(),
+        forecastedDemand,
     };
     LOGV2_DEBUG(22578,
                 kDiagnosticLogLevel,
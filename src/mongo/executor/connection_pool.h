@@ -150,6 +150,15 @@ public:
          */
         bool skipAuthentication = false;
 
+        /**
+         * When true, each host pool maintains a decaying estimate of its concurrent connection
+         * demand and keeps enough connections established to satisfy that estimate, rather than
+         * only reacting to presently queued requests. This pre-warms pools ahead of recurring
+         * load so bursts after a trough do not pay connection setup latency, at the cost of
+         * holding more connections open during the troughs.
+         */
+        bool forecastConnectionDemand = false;
+
         std::function<std::shared_ptr<ControllerInterface>(void)> controllerFactory =
             &ConnectionPool::makeLimitController;
     };
@@ -201,6 +210,10 @@ public:
         size_t ready = 0;
         size_t active = 0;
 
+        // The pool's current forecast of concurrent connection demand. Zero unless
+        // Options::forecastConnectionDemand is set.
+        size_t forecastedDemand = 0;
+
         std::string toString() const;
     };
 
@@ -31,12 +31,53 @@
 
 #include "mongo/executor/connection_pool_stats.h"
 
+#include <algorithm>
+#include <string>
+
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/util/map_util.h"
 
 namespace mongo {
 namespace executor {
 
+constexpr std::array<Milliseconds, 6> ConnectionWaitTimeHistogram::kBucketBounds;
+
+void ConnectionWaitTimeHistogram::increment(Milliseconds waitTime) {
+    auto bucket = std::upper_bound(kBucketBounds.begin(), kBucketBounds.end(), waitTime) -
+        kBucketBounds.begin();
+    ++_counts[bucket];
+}
+
+ConnectionWaitTimeHistogram& ConnectionWaitTimeHistogram::operator+=(
+    const ConnectionWaitTimeHistogram& other) {
+    for (size_t i = 0; i < _counts.size(); ++i) {
+        _counts[i] += other._counts[i];
+    }
+
+    return *this;
+}
+
+void ConnectionWaitTimeHistogram::appendToBSON(BSONObjBuilder& result) const {
+    BSONObjBuilder waitTimes(result.subobjStart("acquisitionWaitTimes"));
+
+    long long total = 0;
+    for (size_t i = 0; i < _counts.size(); ++i) {
+        auto label = [&]() -> std::string {
+            if (i == kBucketBounds.size()) {
+                return std::to_string(kBucketBounds.back().count()) + "ms+";
+            }
+
+            auto lower = i ? kBucketBounds[i - 1].count() : 0;
+            return std::to_string(lower) + "-" + std::to_string(kBucketBounds[i].count() - 1) +
+                "ms";
+        }();
+
+        waitTimes.appendNumber(label, _counts[i]);
+        total += _counts[i];
+    }
+    waitTimes.appendNumber("totalCount", total);
+}
+
 ConnectionStatsPer::ConnectionStatsPer(size_t nInUse,
                                        size_t nAvailable,
                                        size_t nCreated,
@@ -50,6 +91,7 @@ ConnectionStatsPer& ConnectionStatsPer::operator+=(const ConnectionStatsPer& oth
     available += other.available;
     created += other.created;
     refreshing += other.refreshing;
+    acquisitionWaitTimes += other.acquisitionWaitTimes;
 
     return *this;
 }
@@ -115,6 +157,7 @@ void ConnectionPoolStats::appendToBSON(mongo::BSONObjBuilder& result, bool forFT
                 hostInfo.appendNumber("available", hostStats.available);
                 hostInfo.appendNumber("created", hostStats.created);
                 hostInfo.appendNumber("refreshing", hostStats.refreshing);
+                hostStats.acquisitionWaitTimes.appendToBSON(hostInfo);
             }
         }
     }
@@ -127,6 +170,7 @@ void ConnectionPoolStats::appendToBSON(mongo::BSONObjBuilder& result, bool forFT
             hostInfo.appendNumber("available", hostStats.available);
             hostInfo.appendNumber("created", hostStats.created);
             hostInfo.appendNumber("refreshing", hostStats.refreshing);
+            hostStats.acquisitionWaitTimes.appendToBSON(hostInfo);
         }
     }
 }
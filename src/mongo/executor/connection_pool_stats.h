@@ -29,12 +29,46 @@
 
 #pragma once
 
+#include <array>
+
 #include "mongo/stdx/unordered_map.h"
+#include "mongo/util/duration.h"
 #include "mongo/util/net/hostandport.h"
 
 namespace mongo {
+
+class BSONObjBuilder;
+
 namespace executor {
 
+/**
+ * A fixed-bucket histogram of how long callers waited to acquire a connection. A wait is counted
+ * in the first bucket whose upper bound exceeds it; the final bucket is unbounded. Requests
+ * fulfilled from an idle connection record a zero wait.
+ */
+class ConnectionWaitTimeHistogram {
+public:
+    void increment(Milliseconds waitTime);
+
+    ConnectionWaitTimeHistogram& operator+=(const ConnectionWaitTimeHistogram& other);
+
+    /**
+     * Appends the bucket counts as an "acquisitionWaitTimes" subdocument of result.
+     */
+    void appendToBSON(BSONObjBuilder& result) const;
+
+private:
+    // Exclusive upper bounds of each bucket, save for the implicit unbounded last bucket.
+    static constexpr std::array<Milliseconds, 6> kBucketBounds{Milliseconds(10),
+                                                               Milliseconds(50),
+                                                               Milliseconds(100),
+                                                               Milliseconds(250),
+                                                               Milliseconds(500),
+                                                               Milliseconds(1000)};
+
+    std::array<long long, kBucketBounds.size() + 1> _counts{};
+};
+
 /**
  * Holds connection information for a specific pool or remote host. These objects are maintained by
  * a parent ConnectionPoolStats object and should not need to be created directly.
@@ -50,6 +84,8 @@ struct ConnectionStatsPer {
     size_t available = 0u;
     size_t created = 0u;
     size_t refreshing = 0u;
+
+    ConnectionWaitTimeHistogram acquisitionWaitTimes;
 };
 
 /**
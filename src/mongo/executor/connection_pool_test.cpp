@@ -40,7 +40,10 @@
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
+#include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/executor/connection_pool.h"
+#include "mongo/executor/connection_pool_parameters_gen.h"
+#include "mongo/executor/connection_pool_stats.h"
 #include "mongo/stdx/future.h"
 #include "mongo/unittest/unittest.h"
 #include "mongo/util/scopeguard.h"
@@ -488,6 +491,56 @@ TEST_F(ConnectionPoolTest, refreshHappens) {
     ASSERT(refreshedB);
 }
 
+/**
+ * Verify that with connectionPoolShareHostLiveness enabled, an idle connection whose refresh
+ * comes due skips its refresh ping when another connection to the host completed a successful
+ * round trip within the refresh window.
+ */
+TEST_F(ConnectionPoolTest, sharedHostLivenessSkipsRedundantRefreshes) {
+    gConnectionPoolShareHostLiveness.store(true);
+    ON_BLOCK_EXIT([] { gConnectionPoolShareHostLiveness.store(false); });
+
+    size_t refreshes = 0;
+    for (int i = 0; i < 2; ++i) {
+        ConnectionImpl::pushRefresh([&]() {
+            ++refreshes;
+            return Status::OK();
+        });
+    }
+
+    ConnectionPool::Options options;
+    options.refreshRequirement = Milliseconds(1000);
+    auto pool = makePool(options);
+
+    auto now = Date_t::now();
+    PoolImpl::setNow(now);
+
+    // Check out two connections to the same host at once, then return them both.
+    ConnectionImpl::pushSetup(Status::OK());
+    ConnectionImpl::pushSetup(Status::OK());
+    ConnectionPool::ConnectionHandle conn1;
+    ConnectionPool::ConnectionHandle conn2;
+    pool->get_forTest(HostAndPort(),
+                      Milliseconds(5000),
+                      [&](StatusWith<ConnectionPool::ConnectionHandle> swConn) {
+                          ASSERT(swConn.isOK());
+                          conn1 = std::move(swConn.getValue());
+                      });
+    pool->get_forTest(HostAndPort(),
+                      Milliseconds(5000),
+                      [&](StatusWith<ConnectionPool::ConnectionHandle> swConn) {
+                          ASSERT(swConn.isOK());
+                          conn2 = std::move(swConn.getValue());
+                      });
+    doneWith(conn1);
+    doneWith(conn2);
+
+    // When both connections' refreshes come due, whichever runs first proves the host live and
+    // the other connection's refresh ping is skipped.
+    PoolImpl::setNow(now + Milliseconds(1000));
+    ASSERT_EQ(1U, refreshes);
+}
+
 /**
  * Verify that refresh can timeout.
  */
@@ -961,6 +1014,51 @@ TEST_F(ConnectionPoolTest, minPoolRespected) {
     ASSERT(!reachedC);
 }
 
+/**
+ * Verify that the time spent waiting to acquire a connection is reported in the per-host
+ * connection stats.
+ */
+TEST_F(ConnectionPoolTest, AcquisitionWaitTimesReported) {
+    auto pool = makePool();
+
+    auto now = Date_t::now();
+
+    PoolImpl::setNow(now);
+
+    // The first get has to wait on a connection setup, the second is fulfilled from the ready
+    // pool immediately
+    bool reachedA = false;
+    bool reachedB = false;
+    ConnectionImpl::pushSetup(Status::OK());
+    pool->get_forTest(HostAndPort(),
+                      Milliseconds(5000),
+                      [&](StatusWith<ConnectionPool::ConnectionHandle> swConn) {
+                          ASSERT(swConn.isOK());
+                          reachedA = true;
+                          doneWith(swConn.getValue());
+                      });
+    pool->get_forTest(HostAndPort(),
+                      Milliseconds(5000),
+                      [&](StatusWith<ConnectionPool::ConnectionHandle> swConn) {
+                          ASSERT(swConn.isOK());
+                          reachedB = true;
+                          doneWith(swConn.getValue());
+                      });
+
+    ASSERT(reachedA);
+    ASSERT(reachedB);
+
+    ConnectionPoolStats stats;
+    pool->appendConnectionStats(&stats);
+
+    BSONObjBuilder bob;
+    stats.appendToBSON(bob);
+
+    auto waitTimes =
+        bob.obj()["hosts"][HostAndPort().toString()]["acquisitionWaitTimes"].Obj().getOwned();
+    ASSERT_EQ(waitTimes["totalCount"].numberLong(), 2);
+}
+
 
 /**
  * Verify that the hostTimeout is respected. This implies that an idle
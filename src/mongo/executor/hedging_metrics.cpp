@@ -67,12 +67,30 @@ void HedgingMetrics::incrementNumAdvantageouslyHedgedOperations() {
     _numAdvantageouslyHedgedOperations.fetchAndAdd(1);
 }
 
+long long HedgingMetrics::getNumDeferredHedgedOperations() const {
+    return _numDeferredHedgedOperations.load();
+}
+
+void HedgingMetrics::incrementNumDeferredHedgedOperations() {
+    _numDeferredHedgedOperations.fetchAndAdd(1);
+}
+
+long long HedgingMetrics::getNumSkippedHedgedOperations() const {
+    return _numSkippedHedgedOperations.load();
+}
+
+void HedgingMetrics::incrementNumSkippedHedgedOperations() {
+    _numSkippedHedgedOperations.fetchAndAdd(1);
+}
+
 BSONObj HedgingMetrics::toBSON() const {
     BSONObjBuilder builder;
 
     builder.append("numTotalOperations", _numTotalOperations.load());
     builder.append("numTotalHedgedOperations", _numTotalHedgedOperations.load());
     builder.append("numAdvantageouslyHedgedOperations", _numAdvantageouslyHedgedOperations.load());
+    builder.append("numDeferredHedgedOperations", _numDeferredHedgedOperations.load());
+    builder.append("numSkippedHedgedOperations", _numSkippedHedgedOperations.load());
 
     return builder.obj();
 }
@@ -56,6 +56,12 @@ public:
     long long getNumAdvantageouslyHedgedOperations() const;
     void incrementNumAdvantageouslyHedgedOperations();
 
+    long long getNumDeferredHedgedOperations() const;
+    void incrementNumDeferredHedgedOperations();
+
+    long long getNumSkippedHedgedOperations() const;
+    void incrementNumSkippedHedgedOperations();
+
     BSONObj toBSON() const;
 
 private:
@@ -68,6 +74,13 @@ private:
     // The number of all operations where a rpc other than the first one fulfilled the client
     // request.
     AtomicWord<long long> _numAdvantageouslyHedgedOperations{0};
+
+    // The number of additional rpcs whose dispatch was delayed by the per-target latency model.
+    AtomicWord<long long> _numDeferredHedgedOperations{0};
+
+    // The number of additional rpcs that were never dispatched because the operation completed
+    // within the first target's expected latency.
+    AtomicWord<long long> _numSkippedHedgedOperations{0};
 };
 
 }  // namespace mongo
@@ -37,6 +37,7 @@
 #include "mongo/db/server_options.h"
 #include "mongo/executor/connection_pool_tl.h"
 #include "mongo/executor/hedging_metrics.h"
+#include "mongo/executor/network_interface_tl_parameters_gen.h"
 #include "mongo/logv2/log.h"
 #include "mongo/rpc/get_status_from_command_result.h"
 #include "mongo/transport/transport_layer_manager.h"
@@ -98,6 +99,51 @@ private:
 namespace {
 const Status kNetworkInterfaceShutdownInProgress = {ErrorCodes::ShutdownInProgress,
                                                     "NetworkInterface shutdown in progress"};
+
+}  // namespace
+
+void NetworkInterfaceTL::TargetLatencyTracker::recordLatency(const HostAndPort& target,
+                                                             Milliseconds latency) {
+    auto ms = std::max<int64_t>(latency.count(), 0);
+    size_t bucket = 0;
+    while (ms > 1 && bucket + 1 < kNumBuckets) {
+        ms >>= 1;
+        ++bucket;
+    }
+
+    stdx::lock_guard<Latch> lk(_mutex);
+    auto& buckets = _buckets[target];
+    ++buckets.counts[bucket];
+
+    if (++buckets.total >= kDecayThreshold) {
+        buckets.total = 0;
+        for (auto& count : buckets.counts) {
+            count /= 2;
+            buckets.total += count;
+        }
+    }
+}
+
+boost::optional<Milliseconds> NetworkInterfaceTL::TargetLatencyTracker::estimatePercentile(
+    const HostAndPort& target, double percentile) const {
+    stdx::lock_guard<Latch> lk(_mutex);
+
+    auto it = _buckets.find(target);
+    if (it == _buckets.end() || it->second.total < kMinSamples) {
+        return boost::none;
+    }
+
+    const auto& buckets = it->second;
+    const auto rank = static_cast<long long>(percentile * buckets.total);
+    long long seen = 0;
+    for (size_t i = 0; i < buckets.counts.size(); ++i) {
+        seen += buckets.counts[i];
+        if (seen > rank) {
+            return Milliseconds(1LL << (i + 1));
+        }
+    }
+
+    return Milliseconds(1LL << buckets.counts.size());
 }
 
 NetworkInterfaceTL::NetworkInterfaceTL(std::string instanceName,
@@ -423,6 +469,11 @@ void NetworkInterfaceTL::CommandStateBase::tryFinish(Status status) noexcept {
 }
 
 void NetworkInterfaceTL::RequestState::cancel() noexcept {
+    if (hedgeTimer) {
+        // If this hedge was being held back by the latency model, stop it from being sent.
+        hedgeTimer->cancel(cmdState->baton);
+    }
+
     auto connToCancel = weakConn.lock();
     if (auto clientPtr = getClient(connToCancel)) {
         // If we have a client, cancel it
@@ -495,7 +546,7 @@ Status NetworkInterfaceTL::startCommand(const TaskExecutor::CallbackHandle& cbHa
      * 1.  There are available connections to all nodes but they're all bad. This path is inline so
      *     it then schedules onto the reactor to finish.
      * 2.  All nodes are bad but some needed new connections. The reaction to the new connection
-     *     needs to be scheduled onto the reactor.
+     *     needs to be scheduled onto the baton when one was provided, otherwise the reactor.
      * 3.  The timer in sendRequest() fires and the operation times out. ASIO timers run on the
      *     reactor.
      * 4.  AsyncDBClient::runCommandRequest() concludes. This path is sadly indeterminate since
@@ -549,10 +600,15 @@ Status NetworkInterfaceTL::startCommand(const TaskExecutor::CallbackHandle& cbHa
             continue;
         }
 
-        // Otherwise, schedule the request.
-        std::move(connFuture).thenRunOn(_reactor).getAsync([requestStates, rm, idx](auto swConn) {
-            rm->trySend(std::move(swConn), idx);
-        });
+        // Otherwise, schedule the request. When the caller runs on a baton, react to the new
+        // connection there as well: for single-target operations this keeps the entire
+        // request/response chain on the originating connection's baton, with no reactor handoff
+        // on either side of the network round trip.
+        std::move(connFuture)
+            .thenRunOn(makeGuaranteedExecutor(baton, _reactor))
+            .getAsync([requestStates, rm, idx](auto swConn) {
+                rm->trySend(std::move(swConn), idx);
+            });
     }
 
     return Status::OK();
@@ -776,14 +832,82 @@ void NetworkInterfaceTL::RequestManager::trySend(
                     "maxTime"_attr = Milliseconds(maxTimeMS),
                     "requestId"_attr = cmdStatePtr->requestOnAny.id,
                     "target"_attr = cmdStatePtr->requestOnAny.target[idx]);
+    } else {
+        // Remember when and where the first request was dispatched; hedged requests may be held
+        // back relative to this dispatch when latency-driven hedging is enabled.
+        stdx::lock_guard<Latch> lk(mutex);
+        firstSentTarget = request.target;
+        firstSentAt = cmdStatePtr->interface->now();
+    }
 
-        if (cmdStatePtr->interface->_svcCtx) {
-            auto hm = HedgingMetrics::get(cmdStatePtr->interface->_svcCtx);
-            invariant(hm);
-            hm->incrementNumTotalHedgedOperations();
+    if (requestState->isHedge && networkInterfaceLatencyDrivenHedging.load()) {
+        auto interface = cmdStatePtr->interface;
+
+        auto [baselineTarget, baselineSentAt] = [&] {
+            stdx::lock_guard<Latch> lk(mutex);
+            return std::make_pair(firstSentTarget, firstSentAt);
+        }();
+
+        const auto percentile = networkInterfaceHedgingLatencyPercentile.load() / 100.0;
+        auto estimate = interface->_targetLatencies.estimatePercentile(baselineTarget, percentile);
+        if (estimate && baselineSentAt + *estimate > interface->now()) {
+            const auto sendAt = baselineSentAt + *estimate;
+
+            LOGV2_DEBUG(31623,
+                        2,
+                        "Holding back hedged request until the first target's expected response "
+                        "time",
+                        "requestId"_attr = cmdStatePtr->requestOnAny.id,
+                        "target"_attr = request.target,
+                        "firstTarget"_attr = baselineTarget,
+                        "sendAt"_attr = sendAt);
+
+            if (interface->_svcCtx) {
+                auto hm = HedgingMetrics::get(interface->_svcCtx);
+                invariant(hm);
+                hm->incrementNumDeferredHedgedOperations();
+            }
+
+            requestState->hedgeTimer = interface->_reactor->makeTimer();
+            requestState->hedgeTimer->waitUntil(sendAt, cmdStatePtr->baton)
+                .getAsync([this,
+                           cmdStatePtr,
+                           requestState,
+                           request,
+                           conn = std::move(swConn.getValue())](Status status) mutable {
+                    {
+                        stdx::lock_guard<Latch> lk(mutex);
+                        if (!status.isOK() || cmdStatePtr->finishLine.isReady() || isLocked) {
+                            // The operation finished within the first target's latency budget,
+                            // so this hedge never needs to go out.
+                            if (cmdStatePtr->interface->_svcCtx) {
+                                auto hm = HedgingMetrics::get(cmdStatePtr->interface->_svcCtx);
+                                invariant(hm);
+                                hm->incrementNumSkippedHedgedOperations();
+                            }
+                            conn->indicateSuccess();
+                            return;
+                        }
+                    }
+
+                    if (cmdStatePtr->interface->_svcCtx) {
+                        auto hm = HedgingMetrics::get(cmdStatePtr->interface->_svcCtx);
+                        invariant(hm);
+                        hm->incrementNumTotalHedgedOperations();
+                    }
+
+                    requestState->send(std::move(conn), request);
+                });
+            return;
         }
     }
 
+    if (requestState->isHedge && cmdStatePtr->interface->_svcCtx) {
+        auto hm = HedgingMetrics::get(cmdStatePtr->interface->_svcCtx);
+        invariant(hm);
+        hm->incrementNumTotalHedgedOperations();
+    }
+
     requestState->send(std::move(swConn), request);
 }
 
@@ -825,6 +949,12 @@ void NetworkInterfaceTL::RequestState::resolve(Future<RemoteCommandResponse> fut
     auto anyFuture =
         std::move(future)
             .then([this, anchor = shared_from_this()](RemoteCommandResponse response) {
+                // Feed successful response latencies into the per-target latency model used to
+                // pace hedged requests.
+                if (response.status.isOK() && response.elapsedMillis) {
+                    interface()->_targetLatencies.recordLatency(host, *response.elapsedMillis);
+                }
+
                 // The RCRq ran successfully, wrap the result with the host in question
                 return RemoteCommandOnAnyResponse(host, std::move(response));
             })
@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <array>
 #include <deque>
 
 #include "mongo/client/async_client.h"
@@ -105,6 +106,50 @@ private:
     struct RequestState;
     struct RequestManager;
 
+    /**
+     * Tracks each target's command latencies in logarithmic buckets so that hedged requests can
+     * be held back until the configured percentile of the first target's latency distribution
+     * has elapsed, rather than being dispatched immediately.
+     */
+    class TargetLatencyTracker {
+    public:
+        /**
+         * Folds a successful command response latency for the given target into its
+         * distribution.
+         */
+        void recordLatency(const HostAndPort& target, Milliseconds latency);
+
+        /**
+         * Returns a conservative estimate (the bucket upper bound) of the given latency
+         * percentile for the target, or boost::none until enough responses have been observed
+         * to make the estimate useful.
+         */
+        boost::optional<Milliseconds> estimatePercentile(const HostAndPort& target,
+                                                         double percentile) const;
+
+    private:
+        // Bucket i counts responses that took [2^i, 2^(i+1)) milliseconds, except the first
+        // bucket which extends down to zero. The last bucket tops out around 70 minutes.
+        static constexpr size_t kNumBuckets = 22;
+
+        // The number of responses required from a target before estimates are produced.
+        static constexpr long long kMinSamples = 32;
+
+        // All of a target's counts are halved once it accumulates this many responses, so the
+        // distribution tracks recent behavior rather than the full process lifetime.
+        static constexpr long long kDecayThreshold = 1024;
+
+        struct Buckets {
+            std::array<long long, kNumBuckets> counts{};
+            long long total = 0;
+        };
+
+        mutable Mutex _mutex =
+            MONGO_MAKE_LATCH(HierarchicalAcquisitionLevel(0),
+                             "NetworkInterfaceTL::TargetLatencyTracker::_mutex");
+        stdx::unordered_map<HostAndPort, Buckets> _buckets;
+    };
+
     struct CommandStateBase : public std::enable_shared_from_this<CommandStateBase> {
         CommandStateBase(NetworkInterfaceTL* interface_,
                          RemoteCommandRequestOnAny request_,
@@ -248,6 +293,11 @@ private:
         // Set to true when the command finishes or is canceled to block remaining requests.
         bool isLocked{false};
 
+        // The target and dispatch time of the first sent request, used to decide how long to
+        // hold back hedged requests when latency-driven hedging is enabled.
+        HostAndPort firstSentTarget;
+        Date_t firstSentAt;
+
         Mutex mutex = MONGO_MAKE_LATCH("NetworkInterfaceTL::RequestManager::mutex");
     };
 
@@ -307,6 +357,10 @@ private:
         // Internal id of this request as tracked by the RequestManager.
         size_t reqId;
 
+        // Delays dispatch of a hedged request while latency-driven hedging is enabled. Canceled
+        // when the command finishes first, in which case the hedge is never sent.
+        std::unique_ptr<transport::ReactorTimer> hedgeTimer;
+
         // True if this request is an additional request sent to hedge the operation.
         bool isHedge{false};
 
@@ -357,6 +411,8 @@ private:
     class SynchronizedCounters;
     std::shared_ptr<SynchronizedCounters> _counters;
 
+    TargetLatencyTracker _targetLatencies;
+
     std::unique_ptr<rpc::EgressMetadataHook> _metadataHook;
 
     // We start in kDefault, transition to kStarted after startup() is complete and enter kStopped
@@ -53,6 +53,27 @@ void LogDomainGlobal::ConfigurationOptions::makeDisabled() {
     consoleEnabled = false;
 }
 
+namespace {
+
+Counter64 asyncQueueDropped;
+
+// boost::log overflow strategy: like sinks::drop_on_overflow, but counts the
+// records it discards so the loss is visible to operators.
+class CountingDropOnOverflow {
+public:
+    template <typename LockT>
+    static bool on_overflow(boost::log::record_view const&, LockT&) {
+        asyncQueueDropped.increment();
+        return false;  // discard the record
+    }
+
+    static void on_queue_space_available() {}
+
+    static void interrupt() {}
+};
+
+}  // namespace
+
 struct LogDomainGlobal::Impl {
     typedef CompositeBackend<boost::log::sinks::text_ostream_backend,
                              RamLogSink,
@@ -69,6 +90,18 @@ struct LogDomainGlobal::Impl {
     typedef CompositeBackend<FileRotateSink, RamLogSink, RamLogSink, UserAssertSink>
         RotatableFileBackend;
 
+    // Capacity of the asynchronous file sink's record queue. Records emitted
+    // while it is full are handled according to
+    // ConfigurationOptions::fileAsyncBlockOnFull.
+    static constexpr std::size_t kAsyncQueueSize = 16384;
+
+    // Frontend that enqueues records and formats/writes them on a dedicated
+    // thread, parameterized over what to do when the queue overflows.
+    template <typename OverflowPolicy>
+    using AsyncFileSink = boost::log::sinks::asynchronous_sink<
+        RotatableFileBackend,
+        boost::log::sinks::bounded_fifo_queue<kAsyncQueueSize, OverflowPolicy>>;
+
     Impl(LogDomainGlobal& parent);
     Status configure(LogDomainGlobal::ConfigurationOptions const& options);
     Status rotate(bool rename, StringData renameSuffix);
@@ -81,7 +114,11 @@ struct LogDomainGlobal::Impl {
     LogComponentSettings _settings;
     ConfigurationOptions _config;
     boost::shared_ptr<boost::log::sinks::unlocked_sink<ConsoleBackend>> _consoleSink;
+    // The file backend is shared by whichever of the frontends below is active.
+    boost::shared_ptr<RotatableFileBackend> _rotatableFileBackend;
     boost::shared_ptr<boost::log::sinks::unlocked_sink<RotatableFileBackend>> _rotatableFileSink;
+    boost::shared_ptr<AsyncFileSink<CountingDropOnOverflow>> _asyncDropFileSink;
+    boost::shared_ptr<AsyncFileSink<boost::log::sinks::block_on_overflow>> _asyncBlockFileSink;
 #ifndef _WIN32
     boost::shared_ptr<boost::log::sinks::unlocked_sink<SyslogBackend>> _syslogSink;
 #endif
@@ -165,7 +202,29 @@ Status LogDomainGlobal::Impl::configure(LogDomainGlobal::ConfigurationOptions co
         boost::log::core::get()->remove_sink(_consoleSink);
     }
 
+    auto removeFileSinks = [this] {
+        if (_rotatableFileSink) {
+            boost::log::core::get()->remove_sink(_rotatableFileSink);
+            _rotatableFileSink.reset();
+        }
+        if (_asyncDropFileSink) {
+            boost::log::core::get()->remove_sink(_asyncDropFileSink);
+            // Stop the feeding thread and drain records already queued.
+            _asyncDropFileSink->stop();
+            _asyncDropFileSink->flush();
+            _asyncDropFileSink.reset();
+        }
+        if (_asyncBlockFileSink) {
+            boost::log::core::get()->remove_sink(_asyncBlockFileSink);
+            _asyncBlockFileSink->stop();
+            _asyncBlockFileSink->flush();
+            _asyncBlockFileSink.reset();
+        }
+        _rotatableFileBackend.reset();
+    };
+
     if (options.fileEnabled) {
+        removeFileSinks();
         auto backend = boost::make_shared<RotatableFileBackend>(
             boost::make_shared<FileRotateSink>(options.timestampFormat),
             boost::make_shared<RamLogSink>(RamLog::get("global")),
@@ -180,20 +239,44 @@ Status LogDomainGlobal::Impl::configure(LogDomainGlobal::ConfigurationOptions co
         backend->setFilter<2>(
             TaggedSeverityFilter(_parent, {LogTag::kStartupWarnings}, LogSeverity::Log()));
 
-        _rotatableFileSink =
-            boost::make_shared<boost::log::sinks::unlocked_sink<RotatableFileBackend>>(backend);
-        _rotatableFileSink->set_filter(ComponentSettingsFilter(_parent, _settings));
+        _rotatableFileBackend = backend;
+
+        if (options.fileAsync) {
+            // Formatting and file I/O run on the sink's dedicated thread; the
+            // emitting thread only enqueues the record. Note that records
+            // still queued when the process aborts are lost.
+            if (options.fileAsyncBlockOnFull) {
+                auto sink =
+                    boost::make_shared<AsyncFileSink<boost::log::sinks::block_on_overflow>>(
+                        backend);
+                sink->set_filter(ComponentSettingsFilter(_parent, _settings));
+                _asyncBlockFileSink = std::move(sink);
+                boost::log::core::get()->add_sink(_asyncBlockFileSink);
+            } else {
+                auto sink = boost::make_shared<AsyncFileSink<CountingDropOnOverflow>>(backend);
+                sink->set_filter(ComponentSettingsFilter(_parent, _settings));
+                _asyncDropFileSink = std::move(sink);
+                boost::log::core::get()->add_sink(_asyncDropFileSink);
+            }
+        } else {
+            _rotatableFileSink =
+                boost::make_shared<boost::log::sinks::unlocked_sink<RotatableFileBackend>>(backend);
+            _rotatableFileSink->set_filter(ComponentSettingsFilter(_parent, _settings));
 
-        boost::log::core::get()->add_sink(_rotatableFileSink);
-    } else if (_rotatableFileSink) {
-        boost::log::core::get()->remove_sink(_rotatableFileSink);
-        _rotatableFileSink.reset();
+            boost::log::core::get()->add_sink(_rotatableFileSink);
+        }
+    } else {
+        removeFileSinks();
     }
 
     auto setFormatters = [this](auto&& mkFmt) {
         _consoleSink->set_formatter(mkFmt());
         if (_rotatableFileSink)
             _rotatableFileSink->set_formatter(mkFmt());
+        if (_asyncDropFileSink)
+            _asyncDropFileSink->set_formatter(mkFmt());
+        if (_asyncBlockFileSink)
+            _asyncBlockFileSink->set_formatter(mkFmt());
 #ifndef _WIN32
         if (_syslogSink)
             _syslogSink->set_formatter(mkFmt());
@@ -221,8 +304,8 @@ const LogDomainGlobal::ConfigurationOptions& LogDomainGlobal::Impl::config() con
 }
 
 Status LogDomainGlobal::Impl::rotate(bool rename, StringData renameSuffix) {
-    if (_rotatableFileSink) {
-        auto backend = _rotatableFileSink->locked_backend()->lockedBackend<0>();
+    if (_rotatableFileBackend) {
+        auto backend = _rotatableFileBackend->lockedBackend<0>();
         return backend->rotate(rename, renameSuffix);
     }
     return Status::OK();
@@ -285,4 +368,8 @@ LogComponentSettings& LogDomainGlobal::settings() {
     return _impl->_settings;
 }
 
+Counter64& LogDomainGlobal::asyncQueueDroppedRecords() {
+    return asyncQueueDropped;
+}
+
 }  // namespace mongo::logv2
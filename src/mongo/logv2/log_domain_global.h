@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include "mongo/base/counter.h"
 #include "mongo/logv2/constants.h"
 #include "mongo/logv2/log_domain_internal.h"
 #include "mongo/logv2/log_format.h"
@@ -45,6 +46,13 @@ public:
         std::string filePath;
         RotationMode fileRotationMode{RotationMode::kRename};
         OpenMode fileOpenMode{OpenMode::kTruncate};
+        // Write the log file through a bounded queue serviced by a dedicated
+        // formatter/writer thread, so the emitting thread only enqueues the
+        // record. Only applies to the file sink.
+        bool fileAsync{false};
+        // When the asynchronous queue is full: block the emitting thread
+        // until space is available instead of dropping the record.
+        bool fileAsyncBlockOnFull{false};
         LogTimestampFormat timestampFormat{LogTimestampFormat::kISO8601UTC};
         bool syslogEnabled{false};
         int syslogFacility{-1};  // invalid facility by default, must be set
@@ -66,6 +74,12 @@ public:
 
     LogComponentSettings& settings();
 
+    /**
+     * Number of records dropped by the asynchronous file sink because its
+     * queue was full.
+     */
+    static Counter64& asyncQueueDroppedRecords();
+
 private:
     struct Impl;
     std::unique_ptr<Impl> _impl;
@@ -82,9 +82,13 @@ OpMsgRequest opMsgRequestFromAnyProtocol(const Message& unownedMessage) {
     }
 }
 
-std::unique_ptr<ReplyBuilderInterface> makeReplyBuilder(Protocol protocol) {
+std::unique_ptr<ReplyBuilderInterface> makeReplyBuilder(Protocol protocol,
+                                                        std::size_t replySizeHint) {
     switch (protocol) {
         case Protocol::kOpMsg:
+            if (replySizeHint) {
+                return std::make_unique<OpMsgReplyBuilder>(replySizeHint);
+            }
             return std::make_unique<OpMsgReplyBuilder>();
         case Protocol::kOpQuery:
             return std::make_unique<LegacyReplyBuilder>();
@@ -68,8 +68,12 @@ OpMsgRequest opMsgRequestFromAnyProtocol(const Message& unownedMessage);
 
 /**
  * Returns the appropriate concrete ReplyBuilder.
+ *
+ * 'replySizeHint', when non-zero, pre-sizes the reply buffer for protocols that support it so hot
+ * reply paths don't pay a realloc-and-copy cascade growing from the default buffer size.
  */
-std::unique_ptr<ReplyBuilderInterface> makeReplyBuilder(Protocol protocol);
+std::unique_ptr<ReplyBuilderInterface> makeReplyBuilder(Protocol protocol,
+                                                        std::size_t replySizeHint = 0);
 
 }  // namespace rpc
 }  // namespace mongo
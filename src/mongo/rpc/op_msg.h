@@ -209,6 +209,15 @@ public:
         skipHeaderAndFlags();
     }
 
+    /**
+     * Pre-sizes the internal buffer to 'initCapacity' bytes. Callers that know the approximate
+     * size of the message they are about to build (e.g. reply paths that track a high-water mark
+     * per client) can use this to avoid the realloc-and-copy doubling from the default capacity.
+     */
+    explicit OpMsgBuilder(std::size_t initCapacity) : _buf(initCapacity) {
+        skipHeaderAndFlags();
+    }
+
     /**
      * See the documentation for DocSequenceBuilder below.
      */
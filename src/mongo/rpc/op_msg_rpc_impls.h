@@ -53,6 +53,13 @@ private:
 
 class OpMsgReplyBuilder final : public rpc::ReplyBuilderInterface {
 public:
+    OpMsgReplyBuilder() = default;
+
+    /**
+     * Pre-sizes the reply buffer. See OpMsgBuilder(std::size_t).
+     */
+    explicit OpMsgReplyBuilder(std::size_t initCapacity) : _builder(initCapacity) {}
+
     ReplyBuilderInterface& setRawCommandReply(const BSONObj& reply) override {
         _builder.beginBody().appendElements(reply);
         return *this;
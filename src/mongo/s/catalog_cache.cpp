@@ -301,6 +301,19 @@ CatalogCache::RefreshResult CatalogCache::_getCollectionRoutingInfoAt(
             continue;
         }
 
+        if (collEntry->needsRefresh && collEntry->routingInfo) {
+            // The entry is stale, but this operation is allowed to use the last known routing
+            // information (stale-while-revalidate). Make sure a single background refresh is in
+            // flight so the cache converges without any request thread having to block on it. The
+            // refresh itself runs on the catalog cache loader's thread pool.
+            if (!collEntry->refreshCompletionNotification) {
+                collEntry->refreshCompletionNotification =
+                    std::make_shared<Notification<Status>>();
+                _scheduleCollectionRefresh(ul, collEntry, nss, 1);
+            }
+            _stats.countStaleRoutingInfoServed.addAndFetch(1);
+        }
+
         auto cm = std::make_shared<ChunkManager>(collEntry->routingInfo, atClusterTime);
 
         return {CachedCollectionRoutingInfo(nss, dbInfo, std::move(cm)), refreshActionTaken};
@@ -730,6 +743,10 @@ void CatalogCache::_scheduleCollectionRefresh(WithLock lk,
             _stats.numActiveFullRefreshes.subtractAndFetch(1);
         }
 
+        // Time from when the refresh was scheduled until it completed, including any time spent
+        // queued behind other refreshes on the catalog cache loader's thread pool
+        _stats.totalRefreshLatencyMicros.addAndFetch(t.micros());
+
         if (!status.isOK()) {
             _stats.countFailedRefreshes.addAndFetch(1);
 
@@ -924,6 +941,9 @@ void CatalogCache::Stats::report(BSONObjBuilder* builder) const {
 
     builder->append("countFailedRefreshes", countFailedRefreshes.load());
 
+    builder->append("totalRefreshLatencyMicros", totalRefreshLatencyMicros.load());
+    builder->append("countStaleRoutingInfoServed", countStaleRoutingInfoServed.load());
+
     if (isMongos()) {
         BSONObjBuilder operationsBlockedByRefreshBuilder(
             builder->subobjStart("operationsBlockedByRefresh"));
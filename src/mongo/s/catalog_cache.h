@@ -468,6 +468,14 @@ private:
         // for whatever reason
         AtomicWord<long long> countFailedRefreshes{0};
 
+        // Cumulative, always-increasing counter of how long refreshes took, measured from when
+        // they were scheduled to when they completed (successfully or not)
+        AtomicWord<long long> totalRefreshLatencyMicros{0};
+
+        // Cumulative, always-increasing counter of how many times stale routing information was
+        // returned to an operation while a background refresh was left to catch the cache up
+        AtomicWord<long long> countStaleRoutingInfoServed{0};
+
         // Cumulative, always-increasing counter of how many operations have been blocked by a
         // catalog cache refresh. Broken down by operation type to match the operations tracked
         // by the OpCounters class.
@@ -67,6 +67,24 @@ void checkAllElementsAreOfType(BSONType type, const BSONObj& o) {
             allElementsAreOfType(type, o));
 }
 
+void checkChunksAreContiguous(const ChunkInfo& left, const ChunkInfo& right) {
+    if (SimpleBSONObjComparator::kInstance.evaluate(left.getMax() == right.getMin())) {
+        return;
+    }
+
+    if (SimpleBSONObjComparator::kInstance.evaluate(left.getMax() < right.getMin())) {
+        uasserted(ErrorCodes::ConflictingOperationInProgress,
+                  str::stream() << "Gap exists in the routing table between chunks "
+                                << left.getRange().toString() << " and "
+                                << right.getRange().toString());
+    } else {
+        uasserted(ErrorCodes::ConflictingOperationInProgress,
+                  str::stream() << "Overlap exists in the routing table between chunks "
+                                << left.getRange().toString() << " and "
+                                << right.getRange().toString());
+    }
+}
+
 std::string extractKeyStringInternal(const BSONObj& shardKeyValue, Ordering ordering) {
     BSONObjBuilder strippedKeyValue;
     for (const auto& elem : shardKeyValue) {
@@ -88,6 +106,7 @@ RoutingTableHistory::RoutingTableHistory(NamespaceString nss,
                                          std::unique_ptr<CollatorInterface> defaultCollator,
                                          bool unique,
                                          ChunkInfoMap chunkMap,
+                                         ShardVersionMap shardVersions,
                                          ChunkVersion collectionVersion)
     : _sequenceNumber(nextCMSequenceNumber.addAndFetch(1)),
       _nss(std::move(nss)),
@@ -98,7 +117,7 @@ RoutingTableHistory::RoutingTableHistory(NamespaceString nss,
       _unique(unique),
       _chunkMap(std::move(chunkMap)),
       _collectionVersion(collectionVersion),
-      _shardVersions(_constructShardVersionMap()) {}
+      _shardVersions(std::move(shardVersions)) {}
 
 void RoutingTableHistory::setShardStale(const ShardId& shardId) {
     if (gEnableFinerGrainedCatalogCacheRefresh) {
@@ -589,6 +608,7 @@ std::shared_ptr<RoutingTableHistory> RoutingTableHistory::makeNew(
                                std::move(defaultCollator),
                                std::move(unique),
                                {},
+                               {},
                                {0, 0, epoch})
         .makeUpdated(chunks);
 }
@@ -597,8 +617,10 @@ std::shared_ptr<RoutingTableHistory> RoutingTableHistory::makeUpdated(
     const std::vector<ChunkType>& changedChunks) {
 
     const auto startingCollectionVersion = getVersion();
-    auto chunkMap = _chunkMap;
 
+    // Validate the diff and compute the resulting collection version before making any copies, so
+    // that a diff which does not change the metadata (which is common when multiple threads race
+    // to refresh) does not pay for duplicating a potentially very large chunk map.
     ChunkVersion collectionVersion = startingCollectionVersion;
     for (const auto& chunk : changedChunks) {
         const auto& chunkVersion = chunk.getVersion();
@@ -613,7 +635,38 @@ std::shared_ptr<RoutingTableHistory> RoutingTableHistory::makeUpdated(
         // Chunks must always come in incrementally sorted order
         invariant(chunkVersion >= collectionVersion);
         collectionVersion = chunkVersion;
+    }
 
+    // If at least one diff was applied, the metadata is correct, but it might not have changed so
+    // in this case there is no need to recreate the chunk manager.
+    //
+    // NOTE: In addition to the above statement, it is also important that we return the same chunk
+    // manager object, because the write commands' code relies on changes of the chunk manager's
+    // sequence number to detect batch writes not making progress because of chunks moving across
+    // shards too frequently.
+    if (collectionVersion == startingCollectionVersion) {
+        return shared_from_this();
+    }
+
+    auto chunkMap = _chunkMap;
+
+    // Carry the shard versions over from the current routing table and update them incrementally
+    // as the diff is applied, rather than reconstructing them with a full pass over the new chunk
+    // map. Note that this resets all staleness indicators, same as a full reconstruction would.
+    const auto& epoch = startingCollectionVersion.epoch();
+    ShardVersionMap shardVersions;
+    for (const auto& [shardId, targetingInfo] : _shardVersions) {
+        shardVersions.emplace(shardId, epoch).first->second.shardVersion =
+            targetingInfo.shardVersion;
+    }
+
+    // Shards whose last interaction with the diff was losing a chunk. The highest remaining chunk
+    // version of such a shard cannot be derived incrementally (the removed chunk may have carried
+    // its max version, or may have been its only chunk), so these entries are recomputed from the
+    // chunk map at the end.
+    std::set<ShardId> shardsWithUnknownVersion;
+
+    for (const auto& chunk : changedChunks) {
         const auto chunkMinKeyString = _extractKeyString(chunk.getMin());
         const auto chunkMaxKeyString = _extractKeyString(chunk.getMax());
 
@@ -647,32 +700,98 @@ std::shared_ptr<RoutingTableHistory> RoutingTableHistory::makeUpdated(
             newChunk->getWritesTracker()->addBytesWritten(bytesInReplacedChunk);
         }
 
+        for (auto it = low; it != high; ++it) {
+            shardsWithUnknownVersion.insert(it->second->getShardIdAt(boost::none));
+        }
+
         // Erase all chunks from the map, which overlap the chunk we got from the persistent store
         chunkMap.erase(low, high);
 
         // Insert only the chunk itself
         chunkMap.insert(std::make_pair(chunkMaxKeyString, newChunk));
+
+        // The new chunk's version is no lower than that of any chunk already in the routing table,
+        // so it becomes the max shard version for the shard which received it
+        const auto& chunkShardId = chunk.getShard();
+        auto shardVersionIt = shardVersions.find(chunkShardId);
+        if (shardVersionIt == shardVersions.end()) {
+            shardVersionIt = shardVersions.emplace(chunkShardId, epoch).first;
+        }
+        shardVersionIt->second.shardVersion = chunk.getVersion();
+        shardsWithUnknownVersion.erase(chunkShardId);
     }
 
-    // If at least one diff was applied, the metadata is correct, but it might not have changed so
-    // in this case there is no need to recreate the chunk manager.
-    //
-    // NOTE: In addition to the above statement, it is also important that we return the same chunk
-    // manager object, because the write commands' code relies on changes of the chunk manager's
-    // sequence number to detect batch writes not making progress because of chunks moving across
-    // shards too frequently.
-    if (collectionVersion == startingCollectionVersion) {
-        return shared_from_this();
+    // Recompute the entries of shards which only had chunks taken away by the diff. In practice
+    // this only happens when a shard donates its last chunk, because otherwise the migration
+    // protocol bumps a remaining chunk on the donor as part of the same diff.
+    if (!shardsWithUnknownVersion.empty()) {
+        for (const auto& shardId : shardsWithUnknownVersion) {
+            shardVersions.erase(shardId);
+        }
+
+        for (const auto& entry : chunkMap) {
+            const auto& chunkShardId = entry.second->getShardIdAt(boost::none);
+            if (!shardsWithUnknownVersion.count(chunkShardId))
+                continue;
+
+            auto shardVersionIt = shardVersions.find(chunkShardId);
+            if (shardVersionIt == shardVersions.end()) {
+                shardVersionIt = shardVersions.emplace(chunkShardId, epoch).first;
+            }
+
+            auto& maxShardVersion = shardVersionIt->second.shardVersion;
+            if (entry.second->getLastmod() > maxShardVersion)
+                maxShardVersion = entry.second->getLastmod();
+        }
     }
 
-    return std::shared_ptr<RoutingTableHistory>(
+    // The diff only touched the ranges of the changed chunks, so it suffices to re-check the
+    // continuity of the routing table around each of them; the untouched portions of the map were
+    // validated when they were originally constructed.
+    for (const auto& chunk : changedChunks) {
+        const auto it = chunkMap.find(_extractKeyString(chunk.getMax()));
+        if (it == chunkMap.end()) {
+            // The chunk was itself replaced by a later entry in the diff
+            continue;
+        }
+
+        if (it == chunkMap.begin()) {
+            checkAllElementsAreOfType(MinKey, it->second->getMin());
+        } else {
+            checkChunksAreContiguous(*std::prev(it)->second, *it->second);
+        }
+
+        const auto next = std::next(it);
+        if (next == chunkMap.end()) {
+            checkAllElementsAreOfType(MaxKey, it->second->getMax());
+        } else {
+            checkChunksAreContiguous(*it->second, *next->second);
+        }
+    }
+
+    auto newRoutingTable = std::shared_ptr<RoutingTableHistory>(
         new RoutingTableHistory(_nss,
                                 _uuid,
                                 KeyPattern(getShardKeyPattern().getKeyPattern()),
                                 CollatorInterface::cloneCollator(getDefaultCollator()),
                                 isUnique(),
                                 std::move(chunkMap),
+                                std::move(shardVersions),
                                 collectionVersion));
+
+    if (kDebugBuild) {
+        // Cross-check the incrementally maintained shard versions against a full reconstruction,
+        // which also re-runs the whole-table continuity validation
+        const auto expectedShardVersions = newRoutingTable->_constructShardVersionMap();
+        invariant(expectedShardVersions.size() == newRoutingTable->_shardVersions.size());
+        for (const auto& [shardId, targetingInfo] : expectedShardVersions) {
+            auto shardVersionIt = newRoutingTable->_shardVersions.find(shardId);
+            invariant(shardVersionIt != newRoutingTable->_shardVersions.end());
+            invariant(shardVersionIt->second.shardVersion == targetingInfo.shardVersion);
+        }
+    }
+
+    return newRoutingTable;
 }
 
 }  // namespace mongo
@@ -102,6 +102,12 @@ public:
      *
      * The changes in "changedChunks" must be sorted in ascending order by chunk version, and adhere
      * to the requirements of the routing table update algorithm.
+     *
+     * The update is applied incrementally: the shard versions are carried over from this instance
+     * and only the portions of the routing table overlapping the changed chunks are revisited, so
+     * the cost of a refresh is proportional to the size of the diff rather than to the total
+     * number of chunks. A diff which does not advance the collection version returns this same
+     * instance without copying the chunk map at all.
      */
     std::shared_ptr<RoutingTableHistory> makeUpdated(const std::vector<ChunkType>& changedChunks);
 
@@ -197,10 +203,12 @@ private:
                         std::unique_ptr<CollatorInterface> defaultCollator,
                         bool unique,
                         ChunkInfoMap chunkMap,
+                        ShardVersionMap shardVersions,
                         ChunkVersion collectionVersion);
 
     /**
-     * Does a single pass over the chunkMap and constructs the ShardVersionMap object.
+     * Does a single pass over the chunkMap and constructs the ShardVersionMap object. Only used to
+     * cross-check the incrementally maintained shard versions in debug builds.
      */
     ShardVersionMap _constructShardVersionMap() const;
 
@@ -336,7 +336,7 @@ bool ShardRegistry::reload(OperationContext* opCtx) {
         _inReloadCV.notify_all();
     });
 
-    ShardRegistryData currData(opCtx, _shardFactory.get());
+    ShardRegistryData currData(opCtx, _shardFactory.get(), &_data);
     currData.addConfigShard(_data.getConfigShard());
     _data.swapAndMerge(currData);
 
@@ -413,7 +413,9 @@ void ShardRegistry::updateReplicaSetOnConfigServer(ServiceContext* serviceContex
 
 ////////////// ShardRegistryData //////////////////
 
-ShardRegistryData::ShardRegistryData(OperationContext* opCtx, ShardFactory* shardFactory) {
+ShardRegistryData::ShardRegistryData(OperationContext* opCtx,
+                                     ShardFactory* shardFactory,
+                                     const ShardRegistryData* existingData) {
     auto const catalogClient = Grid::get(opCtx)->catalogClient();
 
     auto readConcern = repl::ReadConcernLevel::kMajorityReadConcern;
@@ -465,6 +467,19 @@ ShardRegistryData::ShardRegistryData(OperationContext* opCtx, ShardFactory* shar
             continue;
         }
 
+        // Reuse the existing Shard object (and with it, its targeter and replica set monitor
+        // state) when the connection string recorded in the catalog has not changed, so a
+        // steady-state reload only constructs Shard objects for shards that actually changed.
+        if (existingData) {
+            auto existingShard = existingData->findByShardId(ShardId(std::get<0>(shardInfo)));
+            if (existingShard &&
+                existingShard->originalConnString().toString() ==
+                    std::get<1>(shardInfo).toString()) {
+                _addShard(WithLock::withoutLock(), std::move(existingShard), false);
+                continue;
+            }
+        }
+
         auto shard = shardFactory->createShard(std::move(std::get<0>(shardInfo)),
                                                std::move(std::get<1>(shardInfo)));
 
@@ -56,9 +56,14 @@ class ShardType;
 class ShardRegistryData {
 public:
     /**
-     * Reads shards docs from the catalog client and fills in maps.
-     */
-    ShardRegistryData(OperationContext* opCtx, ShardFactory* shardFactory);
+     * Reads shards docs from the catalog client and fills in maps. When 'existingData' is
+     * provided, Shard objects whose connection string in the catalog has not changed are reused
+     * from it rather than recreated, so unchanged shards keep their targeter state and a
+     * steady-state reload costs O(changed shards).
+     */
+    ShardRegistryData(OperationContext* opCtx,
+                      ShardFactory* shardFactory,
+                      const ShardRegistryData* existingData = nullptr);
     ShardRegistryData() = default;
     ~ShardRegistryData() = default;
 
@@ -336,6 +336,12 @@ void runCommand(OperationContext* opCtx,
 
     CommandHelpers::uassertShouldAttemptParse(opCtx, command, request);
 
+    // Pre-size the reply buffer to this command's learned reply size so typical replies don't pay
+    // repeated realloc-and-copy growth from the builder's default allocation.
+    if (const auto replySizeHint = command->replySizeHint()) {
+        replyBuilder->reserveBytes(replySizeHint);
+    }
+
     // Parse the 'maxTimeMS' command option, and use it to set a deadline for the operation on
     // the OperationContext. Be sure to do this as soon as possible so that further processing by
     // subsequent code has the deadline available. The 'maxTimeMS' option unfortunately has a
@@ -1070,6 +1076,11 @@ DbResponse Strategy::clientCommand(OperationContext* opCtx, const Message& m) {
     }
     dbResponse.response = reply->done();
 
+    if (auto invocation = CommandInvocation::get(opCtx)) {
+        invocation->definition()->recordReplySize(
+            static_cast<std::size_t>(dbResponse.response.size()));
+    }
+
     return dbResponse;
 }
 
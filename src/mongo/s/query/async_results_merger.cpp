@@ -33,6 +33,8 @@
 
 #include "mongo/s/query/async_results_merger.h"
 
+#include <algorithm>
+
 #include "mongo/bson/simple_bsonobj_comparator.h"
 #include "mongo/client/remote_command_targeter.h"
 #include "mongo/db/pipeline/change_stream_constants.h"
@@ -104,8 +106,7 @@ AsyncResultsMerger::AsyncResultsMerger(OperationContext* opCtx,
       // since that is not supported we treat boost::none (unspecified) to mean 'kNormal'.
       _tailableMode(params.getTailableMode().value_or(TailableModeEnum::kNormal)),
       _params(std::move(params)),
-      _mergeQueue(MergingComparator(
-          _remotes, _params.getSort().value_or(BSONObj()), _params.getCompareWholeSortKey())),
+      _mergeQueueComparator(_remotes, _params.getSort().value_or(BSONObj())),
       _promisedMinSortKeys(PromisedMinSortKeyComparator(_params.getSort().value_or(BSONObj()))) {
     if (params.getTxnNumber()) {
         invariant(params.getSessionId());
@@ -290,10 +291,8 @@ bool AsyncResultsMerger::_readySortedTailable(WithLock lk) {
         return false;
     }
 
-    auto smallestRemote = _mergeQueue.top();
-    auto smallestResult = _remotes[smallestRemote].docBuffer.front();
-    auto keyWeWantToReturn =
-        extractSortKey(*smallestResult.getResult(), _params.getCompareWholeSortKey());
+    auto smallestRemote = _mergeQueue.front();
+    auto keyWeWantToReturn = _remotes[smallestRemote].frontSortKey;
     // We should always have a minPromisedSortKey from every shard in the sorted tailable case.
     auto minPromisedSortKey = _getMinPromisedSortKey(lk);
     invariant(!minPromisedSortKey.isEmpty());
@@ -334,7 +333,43 @@ StatusWith<ClusterQueryResult> AsyncResultsMerger::nextReady() {
     return _params.getSort() ? _nextReadySorted(lk) : _nextReadyUnsorted(lk);
 }
 
-ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock) {
+StatusWith<std::vector<ClusterQueryResult>> AsyncResultsMerger::takeReadyResults(
+    size_t maxResults) {
+    stdx::lock_guard<Latch> lk(_mutex);
+    std::vector<ClusterQueryResult> results;
+
+    while (results.size() < maxResults && _ready(lk)) {
+        if (_lifecycleState != kAlive) {
+            if (results.empty()) {
+                return Status(ErrorCodes::IllegalOperation, "AsyncResultsMerger killed");
+            }
+            break;
+        }
+
+        if (!_status.isOK()) {
+            if (results.empty()) {
+                return _status;
+            }
+            // Surface the error via the next call rather than dropping the results drained so far.
+            break;
+        }
+
+        if (_eofNext) {
+            // Stop at the tailable batch boundary and let nextReady() report it.
+            break;
+        }
+
+        auto next = _params.getSort() ? _nextReadySorted(lk) : _nextReadyUnsorted(lk);
+        if (next.isEOF()) {
+            break;
+        }
+        results.push_back(std::move(next));
+    }
+
+    return results;
+}
+
+ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock lk) {
     // Tailable non-awaitData cursors cannot have a sort.
     invariant(_tailableMode != TailableModeEnum::kTailable);
 
@@ -342,8 +377,7 @@ ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock) {
         return {};
     }
 
-    size_t smallestRemote = _mergeQueue.top();
-    _mergeQueue.pop();
+    size_t smallestRemote = _mergeQueue.front();
 
     invariant(!_remotes[smallestRemote].docBuffer.empty());
     invariant(_remotes[smallestRemote].status.isOK());
@@ -351,10 +385,16 @@ ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock) {
     ClusterQueryResult front = _remotes[smallestRemote].docBuffer.front();
     _remotes[smallestRemote].docBuffer.pop();
 
-    // Re-populate the merging queue with the next result from 'smallestRemote', if it has a
-    // next result.
+    // Re-position 'smallestRemote' within the merging heap. If it has a next result, refresh its
+    // cached sort key and sift it down in place; otherwise remove it from the heap entirely.
     if (!_remotes[smallestRemote].docBuffer.empty()) {
-        _mergeQueue.push(smallestRemote);
+        _remotes[smallestRemote].frontSortKey =
+            extractSortKey(*_remotes[smallestRemote].docBuffer.front().getResult(),
+                           _params.getCompareWholeSortKey());
+        _mergeQueueReplaceTop(lk);
+    } else {
+        std::pop_heap(_mergeQueue.begin(), _mergeQueue.end(), _mergeQueueComparator);
+        _mergeQueue.pop_back();
     }
 
     // For sorted tailable awaitData cursors, update the high water mark to the document's sort key.
@@ -363,10 +403,12 @@ ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock) {
             extractSortKey(*front.getResult(), _params.getCompareWholeSortKey()).getOwned();
     }
 
+    _prefetchNextBatch(lk, smallestRemote);
+
     return front;
 }
 
-ClusterQueryResult AsyncResultsMerger::_nextReadyUnsorted(WithLock) {
+ClusterQueryResult AsyncResultsMerger::_nextReadyUnsorted(WithLock lk) {
     size_t remotesAttempted = 0;
     while (remotesAttempted < _remotes.size()) {
         // It is illegal to call this method if there is an error received from any shard.
@@ -384,6 +426,8 @@ ClusterQueryResult AsyncResultsMerger::_nextReadyUnsorted(WithLock) {
                 _eofNext = true;
             }
 
+            _prefetchNextBatch(lk, _gettingFromRemote);
+
             return front;
         }
 
@@ -397,6 +441,54 @@ ClusterQueryResult AsyncResultsMerger::_nextReadyUnsorted(WithLock) {
     return {};
 }
 
+void AsyncResultsMerger::_mergeQueueReplaceTop(WithLock) {
+    // Sift the front element down to its new position. This is the standard binary-heap sift-down,
+    // written out explicitly because the standard library offers no replace-top operation.
+    size_t ix = 0;
+    while (true) {
+        size_t child = 2 * ix + 1;
+        if (child >= _mergeQueue.size()) {
+            break;
+        }
+        if (child + 1 < _mergeQueue.size() &&
+            _mergeQueueComparator(_mergeQueue[child], _mergeQueue[child + 1])) {
+            ++child;
+        }
+        if (!_mergeQueueComparator(_mergeQueue[ix], _mergeQueue[child])) {
+            break;
+        }
+        std::swap(_mergeQueue[ix], _mergeQueue[child]);
+        ix = child;
+    }
+}
+
+void AsyncResultsMerger::_prefetchNextBatch(WithLock lk, size_t remoteIndex) {
+    auto& remote = _remotes[remoteIndex];
+
+    // Prefetching is only appropriate for normal cursors. Batches from tailable cursors must be
+    // passed through to the client as-is, and an early getMore on a tailable awaitData cursor
+    // could block on the remote for up to the awaitData timeout even though we still have results
+    // buffered locally.
+    if (_tailableMode != TailableModeEnum::kNormal) {
+        return;
+    }
+
+    // There can be at most one request in flight per remote cursor, and we cannot schedule remote
+    // work without an OperationContext or while the ARM is shutting down.
+    if (!_opCtx || _lifecycleState != kAlive || remote.exhausted() || remote.cbHandle.isValid() ||
+        !remote.status.isOK()) {
+        return;
+    }
+
+    // Only ask for the next batch once the buffer has drained to the halfway watermark, so that
+    // the network round trip overlaps with the caller consuming the results we already have.
+    if (remote.docBuffer.size() > remote.lastReceivedBatchSize / 2) {
+        return;
+    }
+
+    remote.status = _askForNextBatch(lk, remoteIndex);
+}
+
 Status AsyncResultsMerger::_askForNextBatch(WithLock, size_t remoteIndex) {
     invariant(_opCtx, "Cannot schedule a getMore without an OperationContext");
     auto& remote = _remotes[remoteIndex];
@@ -623,10 +715,10 @@ void AsyncResultsMerger::_cleanUpFailedBatch(WithLock lk, Status status, size_t
     // the error to the user. In order to avoid polluting the user's error message, we ignore such
     // errors with the expectation that all outstanding cursors will be closed promptly.
     if (_params.getAllowPartialResults() || remote.status == ErrorCodes::ExchangePassthrough) {
-        // Clear the results buffer and cursor id, and set 'partialResultsReturned' if appropriate.
+        // Reset the cursor id, and set 'partialResultsReturned' if appropriate. Results which were
+        // already buffered (e.g. by a prefetched batch) remain eligible for return; the merging
+        // heap may still reference them.
         remote.partialResultsReturned = (remote.status != ErrorCodes::ExchangePassthrough);
-        std::queue<ClusterQueryResult> emptyBuffer;
-        std::swap(remote.docBuffer, emptyBuffer);
         remote.status = Status::OK();
         remote.cursorId = 0;
     }
@@ -681,7 +773,9 @@ bool AsyncResultsMerger::_addBatchToBuffer(WithLock lk,
                                            size_t remoteIndex,
                                            const CursorResponse& response) {
     auto& remote = _remotes[remoteIndex];
+    const bool hadBufferedResults = remote.hasNext();
     _updateRemoteMetadata(lk, remoteIndex, response);
+    remote.lastReceivedBatchSize = response.getBatch().size();
     for (const auto& obj : response.getBatch()) {
         // If there's a sort, we're expecting the remote node to have given us back a sort key.
         if (_params.getSort()) {
@@ -707,9 +801,13 @@ bool AsyncResultsMerger::_addBatchToBuffer(WithLock lk,
     }
 
     // If we're doing a sorted merge, then we have to make sure to put this remote onto the merge
-    // queue.
-    if (_params.getSort() && !response.getBatch().empty()) {
-        _mergeQueue.push(remoteIndex);
+    // queue. A prefetched batch may arrive while the remote still has buffered results, in which
+    // case it is already on the queue and its front document is unchanged.
+    if (_params.getSort() && !response.getBatch().empty() && !hadBufferedResults) {
+        remote.frontSortKey = extractSortKey(*remote.docBuffer.front().getResult(),
+                                             _params.getCompareWholeSortKey());
+        _mergeQueue.push_back(remoteIndex);
+        std::push_heap(_mergeQueue.begin(), _mergeQueue.end(), _mergeQueueComparator);
     }
     return true;
 }
@@ -826,12 +924,11 @@ bool AsyncResultsMerger::RemoteCursorData::exhausted() const {
 //
 
 bool AsyncResultsMerger::MergingComparator::operator()(const size_t& lhs, const size_t& rhs) {
-    const ClusterQueryResult& leftDoc = _remotes[lhs].docBuffer.front();
-    const ClusterQueryResult& rightDoc = _remotes[rhs].docBuffer.front();
-
-    return compareSortKeys(extractSortKey(*leftDoc.getResult(), _compareWholeSortKey),
-                           extractSortKey(*rightDoc.getResult(), _compareWholeSortKey),
-                           _sort) > 0;
+    // The heap keeps the remote with the *smallest* sort key at the front, so this comparator
+    // reports "less than" when 'lhs' sorts after 'rhs'. Each remote's sort key is extracted once,
+    // when the corresponding document reaches the front of the remote's buffer, rather than on
+    // every comparison.
+    return compareSortKeys(_remotes[lhs].frontSortKey, _remotes[rhs].frontSortKey, _sort) > 0;
 }
 
 bool AsyncResultsMerger::PromisedMinSortKeyComparator::operator()(
@@ -67,6 +67,10 @@ class CursorResponse;
  * This requires waiting until we have a response from every remote before returning results.
  * Without a sort, we are ready to return results as soon as we have *any* response from a remote.
  *
+ * To hide the latency of the shards' round trips, the ARM prefetches: as buffered results are
+ * consumed, it requests the next batch from a remote before that remote's buffer runs empty, so
+ * that the getMore is in flight while the caller drains the results already on hand.
+ *
  * On any error, the caller is responsible for shutting down the ARM using the kill() method.
  *
  * Does not throw exceptions.
@@ -167,6 +171,17 @@ public:
      */
     StatusWith<ClusterQueryResult> nextReady();
 
+    /**
+     * Returns up to 'maxResults' already-buffered result documents under a single mutex
+     * acquisition, in the same order repeated nextReady() calls would have produced them. Never
+     * blocks and never schedules remote work; the drain stops early at a tailable batch boundary
+     * or when the merger has nothing further buffered.
+     *
+     * An error status is returned only when no results could be drained; an error encountered
+     * after some results have been collected is left to surface via the next call.
+     */
+    StatusWith<std::vector<ClusterQueryResult>> takeReadyResults(size_t maxResults);
+
     /**
      * Schedules remote work as required in order to make further results available. If there is an
      * error in scheduling this work, returns a non-ok status. On success, returns an event handle.
@@ -315,14 +330,21 @@ private:
         // Count of fetched docs during ARM processing of the current batch. Used to reduce the
         // batchSize in getMore when mongod returned less docs than the requested batchSize.
         long long fetchedCount = 0;
+
+        // The sort key of the first result in 'docBuffer', kept in sync with the buffer so that
+        // the merging heap can compare remotes without re-extracting $sortKey from the documents
+        // on every comparison. Only maintained when there is a sort and the buffer is non-empty.
+        BSONObj frontSortKey;
+
+        // The number of documents in the most recently received batch. Used to decide when the
+        // buffer has drained far enough that the next batch should be prefetched.
+        size_t lastReceivedBatchSize = 0;
     };
 
     class MergingComparator {
     public:
-        MergingComparator(const std::vector<RemoteCursorData>& remotes,
-                          const BSONObj& sort,
-                          bool compareWholeSortKey)
-            : _remotes(remotes), _sort(sort), _compareWholeSortKey(compareWholeSortKey) {}
+        MergingComparator(const std::vector<RemoteCursorData>& remotes, const BSONObj& sort)
+            : _remotes(remotes), _sort(sort) {}
 
         bool operator()(const size_t& lhs, const size_t& rhs);
 
@@ -330,11 +352,6 @@ private:
         const std::vector<RemoteCursorData>& _remotes;
 
         const BSONObj _sort;
-
-        // When '_compareWholeSortKey' is true, $sortKey is a scalar value, rather than an object.
-        // We extract the sort key {$sortKey: <value>}. The sort key pattern '_sort' is verified to
-        // be {$sortKey: 1}.
-        const bool _compareWholeSortKey;
     };
 
     using MinSortKeyRemoteIdPair = std::pair<BSONObj, size_t>;
@@ -390,6 +407,22 @@ private:
     ClusterQueryResult _nextReadySorted(WithLock);
     ClusterQueryResult _nextReadyUnsorted(WithLock);
 
+    /**
+     * Restores the heap property of '_mergeQueue' after the front remote's next buffered result
+     * (and therefore its cached sort key) has changed. Equivalent to popping and re-pushing the
+     * front element, but performs a single sift-down instead of two heap traversals.
+     */
+    void _mergeQueueReplaceTop(WithLock);
+
+    /**
+     * Requests the next batch from the given remote before its buffer runs empty, so that the
+     * network round trip overlaps with consumption of the results already buffered. Called as
+     * results are popped from the remote's buffer; issues the getMore once the buffer has drained
+     * to half of the most recently received batch. A no-op for tailable cursors, if a request is
+     * already outstanding for the remote, or if the ARM is not attached to an OperationContext.
+     */
+    void _prefetchNextBatch(WithLock, size_t remoteIndex);
+
     using CbData = executor::TaskExecutor::RemoteCommandCallbackArgs;
     using CbResponse = executor::TaskExecutor::ResponseStatus;
 
@@ -469,9 +502,16 @@ private:
     // Data tracking the state of our communication with each of the remote nodes.
     std::vector<RemoteCursorData> _remotes;
 
-    // The top of this priority queue is the index into '_remotes' for the remote host that has the
-    // next document to return, according to the sort order. Used only if there is a sort.
-    std::priority_queue<size_t, std::vector<size_t>, MergingComparator> _mergeQueue;
+    // Compares indexes into '_remotes' by the cached sort key of each remote's next buffered
+    // result. Used to maintain '_mergeQueue' as a heap. Used only if there is a sort.
+    MergingComparator _mergeQueueComparator;
+
+    // A binary heap of indexes into '_remotes' whose front element is the remote host that has the
+    // next document to return, according to the sort order. Maintained with std::push_heap() and
+    // std::pop_heap(), plus a single sift-down when the front remote's next document changes, so
+    // that consuming one document costs one heap traversal rather than a pop followed by a push.
+    // Used only if there is a sort.
+    std::vector<size_t> _mergeQueue;
 
     // The index into '_remotes' for the remote from which we are currently retrieving results.
     // Used only if there is *not* a sort.
@@ -52,6 +52,14 @@ public:
      */
     StatusWith<ClusterQueryResult> next(OperationContext*, RouterExecStage::ExecContext);
 
+    /**
+     * Drains up to 'maxResults' results that the underlying merger has already buffered, without
+     * blocking or scheduling remote work.
+     */
+    StatusWith<std::vector<ClusterQueryResult>> takeReadyResults(size_t maxResults) {
+        return _arm.takeReadyResults(maxResults);
+    }
+
     Status setAwaitDataTimeout(Milliseconds awaitDataTimeout) {
         return _arm.setAwaitDataTimeout(awaitDataTimeout);
     }
@@ -72,6 +72,16 @@ public:
      */
     virtual StatusWith<ClusterQueryResult> next(RouterExecStage::ExecContext) = 0;
 
+    /**
+     * Returns up to 'maxResults' result documents that are already buffered, without blocking for
+     * further results from the remote nodes. May return fewer (including none); callers fetch any
+     * remainder through next(). Used to avoid per-document synchronization when a shard's batch
+     * has already arrived.
+     */
+    virtual StatusWith<std::vector<ClusterQueryResult>> takeReadyResults(size_t maxResults) {
+        return std::vector<ClusterQueryResult>();
+    }
+
     /**
      * Must be called before destruction to abandon a not-yet-exhausted cursor. If next() has
      * already returned boost::none, then the cursor is exhausted and is safe to destroy.
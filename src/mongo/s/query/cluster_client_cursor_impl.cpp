@@ -31,6 +31,7 @@
 
 #include "mongo/s/query/cluster_client_cursor_impl.h"
 
+#include <iterator>
 #include <memory>
 
 #include "mongo/s/query/router_stage_limit.h"
@@ -111,6 +112,34 @@ StatusWith<ClusterQueryResult> ClusterClientCursorImpl::next(
     return next;
 }
 
+StatusWith<std::vector<ClusterQueryResult>> ClusterClientCursorImpl::takeReadyResults(
+    size_t maxResults) {
+    invariant(_opCtx);
+
+    std::vector<ClusterQueryResult> results;
+    while (!_stash.empty() && results.size() < maxResults) {
+        results.push_back(std::move(_stash.front()));
+        _stash.pop();
+    }
+
+    if (results.size() < maxResults) {
+        auto readyResults = _root->takeReadyResults(maxResults - results.size());
+        if (!readyResults.isOK()) {
+            // An error is only reported when nothing was drained; if we already have stashed
+            // results, return those and let the error surface through the next call.
+            if (results.empty()) {
+                return readyResults.getStatus();
+            }
+        } else {
+            auto& batch = readyResults.getValue();
+            std::move(batch.begin(), batch.end(), std::back_inserter(results));
+        }
+    }
+
+    _numReturnedSoFar += results.size();
+    return results;
+}
+
 void ClusterClientCursorImpl::kill(OperationContext* opCtx) {
     _root->kill(opCtx);
 }
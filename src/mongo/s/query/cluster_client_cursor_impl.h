@@ -67,6 +67,8 @@ public:
 
     StatusWith<ClusterQueryResult> next(RouterExecStage::ExecContext) final;
 
+    StatusWith<std::vector<ClusterQueryResult>> takeReadyResults(size_t maxResults) final;
+
     void kill(OperationContext* opCtx) final;
 
     void reattachToOperationContext(OperationContext* opCtx) final;
@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -38,6 +39,7 @@
 #include "mongo/db/kill_sessions.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/session_killer.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/platform/random.h"
 #include "mongo/s/query/cluster_client_cursor.h"
@@ -379,11 +381,11 @@ public:
     boost::optional<NamespaceString> getNamespaceForCursorId(CursorId cursorId) const;
 
     void incrementCursorsTimedOut(size_t inc) {
-        _cursorsTimedOut += inc;
+        _cursorsTimedOut.fetchAndAdd(inc);
     }
 
     size_t cursorsTimedOut() const {
-        return _cursorsTimedOut;
+        return _cursorsTimedOut.load();
     }
 
 private:
@@ -408,32 +410,39 @@ private:
                        CursorId cursorId,
                        CursorState cursorState);
 
+    struct CursorPartition;
+
     /**
-     * Will detach a cursor, release the lock and then call kill() on it.
+     * Will detach a cursor from the given partition, release the lock and then call kill() on it.
      */
     void detachAndKillCursor(stdx::unique_lock<Latch> lk,
+                             CursorPartition& partition,
                              OperationContext* opCtx,
                              const NamespaceString& nss,
                              CursorId cursorId);
 
     /**
-     * Returns a pointer to the CursorEntry for the given cursor.  If the given cursor is not
-     * registered, returns null.
+     * Returns a pointer to the CursorEntry for the given cursor within the given partition.  If
+     * the given cursor is not registered, returns null.
      *
-     * Not thread-safe.
+     * Not thread-safe; the partition's mutex must be held.
      */
-    CursorEntry* _getEntry(WithLock, NamespaceString const& nss, CursorId cursorId);
+    CursorEntry* _getEntry(WithLock,
+                           CursorPartition& partition,
+                           NamespaceString const& nss,
+                           CursorId cursorId);
 
     /**
-     * De-registers the given cursor, and returns an owned pointer to the underlying
-     * ClusterClientCursor object.
+     * De-registers the given cursor from the given partition, and returns an owned pointer to the
+     * underlying ClusterClientCursor object.
      *
      * If the given cursor is pinned, returns an error Status with code CursorInUse.  If the given
      * cursor is not registered, returns an error Status with code CursorNotFound.
      *
-     * Not thread-safe.
+     * Not thread-safe; the partition's mutex must be held.
      */
     StatusWith<ClusterClientCursorGuard> _detachCursor(WithLock,
+                                                       CursorPartition& partition,
                                                        OperationContext* opCtx,
                                                        const NamespaceString& nss,
                                                        CursorId cursorId);
@@ -444,12 +453,11 @@ private:
     void killOperationUsingCursor(WithLock, CursorEntry* entry);
 
     /**
-     * Kill the cursors satisfying the given predicate. Assumes that 'lk' is held upon entry.
+     * Kill the cursors satisfying the given predicate, visiting one partition at a time.
      *
      * Returns the number of cursors killed.
      */
-    std::size_t killCursorsSatisfying(stdx::unique_lock<Latch> lk,
-                                      OperationContext* opCtx,
+    std::size_t killCursorsSatisfying(OperationContext* opCtx,
                                       std::function<bool(CursorId, const CursorEntry&)> pred);
 
     /**
@@ -600,43 +608,72 @@ private:
         CursorEntryMap entryMap;
     };
 
+    /**
+     * A slice of the manager's cursors, protected by its own mutex. The manager is partitioned by
+     * bits of the cursor id (mirroring the partitioned cursor map the mongod CursorManager uses),
+     * so that cursor check-in/check-out on different partitions does not contend on a single
+     * manager-wide mutex.
+     *
+     * A CursorId is a 64-bit type, made up of a 32-bit prefix and a 32-bit suffix.  When a cursor
+     * is registered, its container is given a prefix whose low bits encode the partition it
+     * belongs to, and cursors registered into that container share the prefix.  A namespace may
+     * therefore own a container (with a distinct prefix) in several partitions at once.
+     */
+    struct CursorPartition {
+        // Synchronizes access to the maps below.
+        mutable Mutex mutex = MONGO_MAKE_LATCH("ClusterCursorManager::CursorPartition::mutex");
+
+        // Map from cursor id prefix to associated namespace.  Exists only to provide namespace
+        // lookup for the (deprecated) getNamespaceForCursorId() method.
+        //
+        // Entries are added when the first cursor on the given container is registered, and
+        // removed when the container's last cursor is destroyed.
+        stdx::unordered_map<uint32_t, NamespaceString> cursorIdPrefixToNamespaceMap;
+
+        // Map from namespace to this partition's CursorEntryContainer for that namespace.
+        //
+        // Entries are added when the first cursor on the given container is registered, and
+        // removed when the container's last cursor is destroyed.
+        NssToCursorContainerMap namespaceToContainerMap;
+    };
+
     /**
      * Erase the container that 'it' points to and return an iterator to the next one. Assumes 'it'
-     * is an iterator in '_namespaceToContainerMap'.
+     * is an iterator in the partition's 'namespaceToContainerMap' and that the partition's mutex
+     * is held.
      */
-    NssToCursorContainerMap::iterator eraseContainer(NssToCursorContainerMap::iterator it);
+    NssToCursorContainerMap::iterator eraseContainer(CursorPartition& partition,
+                                                     NssToCursorContainerMap::iterator it);
+
+    /**
+     * Returns the partition that owns cursor ids with the given prefix.
+     */
+    CursorPartition& _partitionForPrefix(uint32_t prefix) {
+        return _partitions[prefix % kNumPartitions];
+    }
+
+    const CursorPartition& _partitionForPrefix(uint32_t prefix) const {
+        return _partitions[prefix % kNumPartitions];
+    }
 
     // Clock source.  Used when the 'last active' time for a cursor needs to be set/updated.  May be
     // concurrently accessed by multiple threads.
     ClockSource* _clockSource;
 
-    // Synchronizes access to all private state variables below.
-    mutable Mutex _mutex = MONGO_MAKE_LATCH("ClusterCursorManager::_mutex");
-
-    bool _inShutdown{false};
+    // Set by shutdown(), after which no new cursors may be registered. Checked under the relevant
+    // partition's mutex, so registrations racing with shutdown() are either refused or swept by
+    // the subsequent killAllCursors().
+    AtomicWord<bool> _inShutdown{false};
 
-    // Randomness source.  Used for cursor id generation.
+    // Randomness source.  Used for cursor id generation.  Protected by '_randomMutex', which may
+    // be acquired while holding a partition mutex but never the other way around.
+    mutable Mutex _randomMutex = MONGO_MAKE_LATCH("ClusterCursorManager::_randomMutex");
     PseudoRandom _pseudoRandom;
 
-    // Map from cursor id prefix to associated namespace.  Exists only to provide namespace lookup
-    // for (deprecated) getNamespaceForCursorId() method.
-    //
-    // A CursorId is a 64-bit type, made up of a 32-bit prefix and a 32-bit suffix.  When the first
-    // cursor on a given namespace is registered, it is given a CursorId with a prefix that is
-    // unique to that namespace, and an arbitrary suffix.  Cursors subsequently registered on that
-    // namespace will all share the same prefix.
-    //
-    // Entries are added when the first cursor on the given namespace is registered, and removed
-    // when the last cursor on the given namespace is destroyed.
-    stdx::unordered_map<uint32_t, NamespaceString> _cursorIdPrefixToNamespaceMap;
-
-    // Map from namespace to the CursorEntryContainer for that namespace.
-    //
-    // Entries are added when the first cursor on the given namespace is registered, and removed
-    // when the last cursor on the given namespace is destroyed.
-    NssToCursorContainerMap _namespaceToContainerMap;
+    static constexpr std::size_t kNumPartitions = 16;
+    std::array<CursorPartition, kNumPartitions> _partitions;
 
-    size_t _cursorsTimedOut = 0;
+    AtomicWord<size_t> _cursorsTimedOut{0};
 };
 
 }  // namespace mongo
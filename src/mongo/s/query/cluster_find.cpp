@@ -368,6 +368,32 @@ CursorId runQueryWithoutRetrying(OperationContext* opCtx,
         // inside a BSON array.
         bytesBuffered += (nextObj.objsize() + kPerDocumentOverheadBytesUpperBound);
         results->push_back(std::move(nextObj));
+
+        // The merger usually has the rest of the shard's batch buffered already, so drain it in
+        // bulk rather than paying next()'s per-document synchronization for each result. Results
+        // that do not fit in this batch are stashed, in order, for the first getMore.
+        const auto batchSize = query.getQueryRequest().getEffectiveBatchSize().value_or(
+            QueryRequest::kDefaultBatchSize);
+        if (batchSize <= static_cast<long long>(results->size())) {
+            continue;
+        }
+        auto readyResults =
+            uassertStatusOK(ccc->takeReadyResults(batchSize - results->size()));
+        bool batchIsFull = false;
+        for (auto& readyResult : readyResults) {
+            auto readyObj = *readyResult.getResult();
+            if (batchIsFull ||
+                !FindCommon::haveSpaceForNext(readyObj, results->size(), bytesBuffered)) {
+                ccc->queueResult(readyObj);
+                batchIsFull = true;
+                continue;
+            }
+            bytesBuffered += (readyObj.objsize() + kPerDocumentOverheadBytesUpperBound);
+            results->push_back(std::move(readyObj));
+        }
+        if (batchIsFull) {
+            break;
+        }
     }
 
     ccc->detachFromOperationContext();
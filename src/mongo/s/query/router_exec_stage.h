@@ -76,6 +76,16 @@ public:
      */
     virtual StatusWith<ClusterQueryResult> next(ExecContext) = 0;
 
+    /**
+     * Returns up to 'maxResults' results that are already buffered in this stage's pipeline,
+     * without blocking or scheduling remote work. The default implementation returns no results,
+     * which callers must treat as "drain one at a time via next()"; only stages that pass results
+     * through unmodified may override this.
+     */
+    virtual StatusWith<std::vector<ClusterQueryResult>> takeReadyResults(size_t maxResults) {
+        return std::vector<ClusterQueryResult>();
+    }
+
     /**
      * Must be called before destruction to abandon a not-yet-exhausted plan. May block waiting for
      * responses from remote hosts.
@@ -55,6 +55,10 @@ public:
         return _resultsMerger.next(getOpCtx(), execCtx);
     }
 
+    StatusWith<std::vector<ClusterQueryResult>> takeReadyResults(size_t maxResults) final {
+        return _resultsMerger.takeReadyResults(maxResults);
+    }
+
     void kill(OperationContext* opCtx) final {
         _resultsMerger.kill(opCtx);
     }
@@ -50,6 +50,7 @@ namespace mongo {
 namespace {
 
 const ShardId kThisShard("thisShard");
+const ShardId kOtherShard("otherShard");
 const NamespaceString kNss("TestDB", "TestColl");
 
 /**
@@ -318,5 +319,81 @@ TEST_F(RoutingTableHistoryTestThreeInitialChunks,
                               expectedBytesInChunksNotSplit);
 }
 
+TEST_F(RoutingTableHistoryTest, ApplyingDiffWhichDoesNotAdvanceVersionReturnsSameInstance) {
+    auto rt = getInitialRoutingTable();
+
+    ASSERT_EQ(rt.get(), rt->makeUpdated({}).get());
+
+    // Re-delivering a chunk at the current collection version must not produce a new instance
+    // either, because the write commands' code relies on the sequence number staying the same
+    auto sameChunk =
+        ChunkType{kNss,
+                  ChunkRange{getShardKeyPattern().globalMin(), getShardKeyPattern().globalMax()},
+                  rt->getVersion(),
+                  kThisShard};
+    ASSERT_EQ(rt.get(), rt->makeUpdated({sameChunk}).get());
+}
+
+TEST_F(RoutingTableHistoryTestThreeInitialChunks, MigrationWithControlChunkUpdatesShardVersions) {
+    auto rt = getInitialRoutingTable();
+    auto boundaries = getInitialChunkBoundaryPoints();
+
+    auto migratedChunkVersion = rt->getVersion();
+    migratedChunkVersion.incMajor();
+    auto controlChunkVersion = migratedChunkVersion;
+    controlChunkVersion.incMinor();
+
+    // Migrate the middle chunk to the other shard; the donor's remaining first chunk gets bumped
+    // as the control chunk of the same migration
+    auto migratedChunk = ChunkType{
+        kNss, ChunkRange{boundaries[1], boundaries[2]}, migratedChunkVersion, kOtherShard};
+    auto controlChunk =
+        ChunkType{kNss, ChunkRange{boundaries[0], boundaries[1]}, controlChunkVersion, kThisShard};
+
+    auto newRt = rt->makeUpdated({migratedChunk, controlChunk});
+
+    ASSERT_EQ(newRt->getChunkMap().size(), 3ull);
+    ASSERT_EQ(newRt->getVersion(), controlChunkVersion);
+    ASSERT_EQ(newRt->getVersion(kThisShard), controlChunkVersion);
+    ASSERT_EQ(newRt->getVersion(kOtherShard), migratedChunkVersion);
+    ASSERT_EQ(newRt->getNShardsOwningChunks(), 2);
+}
+
+TEST_F(RoutingTableHistoryTest, ShardDonatingItsLastChunkLosesItsShardVersionEntry) {
+    auto rt = getInitialRoutingTable();
+
+    auto migratedChunkVersion = rt->getVersion();
+    migratedChunkVersion.incMajor();
+
+    auto migratedChunk =
+        ChunkType{kNss,
+                  ChunkRange{getShardKeyPattern().globalMin(), getShardKeyPattern().globalMax()},
+                  migratedChunkVersion,
+                  kOtherShard};
+
+    auto newRt = rt->makeUpdated({migratedChunk});
+
+    ASSERT_EQ(newRt->getNShardsOwningChunks(), 1);
+    ASSERT_EQ(newRt->getVersion(kOtherShard), migratedChunkVersion);
+    ASSERT_EQ(newRt->getVersion(kThisShard),
+              ChunkVersion(0, 0, migratedChunkVersion.epoch()));
+}
+
+TEST_F(RoutingTableHistoryTestThreeInitialChunks, ApplyingDiffWhichLeavesGapThrows) {
+    auto rt = getInitialRoutingTable();
+    auto boundaries = getInitialChunkBoundaryPoints();
+
+    auto badChunkVersion = rt->getVersion();
+    badChunkVersion.incMajor();
+
+    // Replaces the chunk [10, 20) with [15, 20), which leaves the range [10, 15) uncovered
+    auto badChunk =
+        ChunkType{kNss, ChunkRange{BSON("a" << 15), boundaries[2]}, badChunkVersion, kThisShard};
+
+    ASSERT_THROWS_CODE(rt->makeUpdated({badChunk}),
+                       AssertionException,
+                       ErrorCodes::ConflictingOperationInProgress);
+}
+
 }  // namespace
 }  // namespace mongo
@@ -639,7 +639,7 @@ ExitCode runMongosServer(ServiceContext* serviceContext) {
     startMongoSFTDC();
 
     if (mongosGlobalParams.scriptingEnabled) {
-        ScriptEngine::setup();
+        ScriptEngine::setupDeferred();
     }
 
     Status status = AuthorizationManager::get(serviceContext)->initialize(opCtx);
@@ -740,7 +740,7 @@ std::unique_ptr<AuthzManagerExternalState> createAuthzManagerExternalStateMongos
 }
 
 ExitCode main(ServiceContext* serviceContext) {
-    serviceContext->setFastClockSource(FastClockSourceFactory::create(Milliseconds{10}));
+    serviceContext->setFastClockSource(FastClockSourceFactory::create(Milliseconds{1}));
 
     auto const shardingContext = Grid::get(serviceContext);
 
@@ -128,11 +128,15 @@ bool isValidShardKeyElementForStorage(const BSONElement& element) {
     return true;
 }
 
-BSONElement extractKeyElementFromDoc(const BSONObj& obj, StringData pathStr) {
+BSONElement extractKeyElementFromDoc(const BSONObj& obj, const FieldRef& path) {
     // Any arrays found get immediately returned. We are equipped up the call stack to specifically
     // deal with array values.
     size_t idxPath;
-    return getFieldDottedOrArray(obj, FieldRef(pathStr), &idxPath);
+    return getFieldDottedOrArray(obj, path, &idxPath);
+}
+
+BSONElement extractKeyElementFromDoc(const BSONObj& obj, StringData pathStr) {
+    return extractKeyElementFromDoc(obj, FieldRef(pathStr));
 }
 
 BSONElement findEqualityElement(const EqualityMatches& equalities, const FieldRef& path) {
@@ -334,8 +338,11 @@ BSONObj ShardKeyPattern::extractShardKeyFromIndexKeyData(
 
 BSONObj ShardKeyPattern::extractShardKeyFromDoc(const BSONObj& doc) const {
     BSONObjBuilder keyBuilder;
+    auto pathIt = _keyPatternPaths.begin();
     for (auto&& patternEl : _keyPattern.toBSON()) {
-        BSONElement matchEl = extractKeyElementFromDoc(doc, patternEl.fieldNameStringData());
+        // Use the field paths parsed at construction time rather than re-parsing a FieldRef from
+        // the pattern element for every document.
+        BSONElement matchEl = extractKeyElementFromDoc(doc, **pathIt++);
 
         if (matchEl.eoo()) {
             matchEl = kNullObj.firstElement();
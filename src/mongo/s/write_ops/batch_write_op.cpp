@@ -301,6 +301,10 @@ Status BatchWriteOp::targetBatch(const NSTargeter& targeter,
     TargetedBatchMap batchMap;
     std::set<ShardId> targetedShards;
 
+    // Shards whose batch for this round is known to be full. Used by unordered targeting to decide
+    // when scanning the remaining write ops can no longer add anything to this round.
+    std::set<ShardId> fullShards;
+
     const size_t numWriteOps = _clientRequest.sizeWriteOps();
 
     for (size_t i = 0; i < numWriteOps; ++i) {
@@ -396,13 +400,35 @@ Status BatchWriteOp::targetBatch(const NSTargeter& targeter,
                 writes, std::max(writeSizeBytes, errorResponsePotentialSizeBytes), batchMap)) {
             invariant(!batchMap.empty());
             writeOp.cancelWrites(nullptr);
-            break;
+            if (ordered)
+                break;
+
+            // One of this op's target shards already has a full batch. Unordered writes have no
+            // cross-op dependencies, so skip just this op and keep filling the other shards'
+            // batches; the op stays ready and is targeted again in the next round. Breaking out
+            // here instead would leave the other shards idle for the rest of the round.
+            if (writes.size() == 1u) {
+                fullShards.insert(writes.front()->endpoint.shardName);
+            }
+
+            // Once every shard owning chunks has a batch and all of them are full, the remaining
+            // ops cannot be placed anywhere this round, so stop scanning them.
+            const int nShardsOwningChunks = targeter.getNShardsOwningChunks();
+            if (nShardsOwningChunks > 0 &&
+                static_cast<int>(targetedShards.size()) >= nShardsOwningChunks &&
+                fullShards.size() >= targetedShards.size()) {
+                break;
+            }
+            continue;
         }
 
         if (!ordered && !batchMap.empty() &&
             isNewBatchRequiredUnordered(writes, batchMap, targetedShards)) {
+            // This write targets a shard that is already targeted under a different shardVersion
+            // and cannot join that batch. Skip only this op so later ops can still fill other
+            // shards' batches in this round.
             writeOp.cancelWrites(nullptr);
-            break;
+            continue;
         }
 
         //
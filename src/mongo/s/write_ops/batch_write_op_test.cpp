@@ -1537,6 +1537,60 @@ TEST_F(BatchWriteOpLimitTests, OneBigOneSmall) {
     ASSERT(batchOp.isFinished());
 }
 
+// One shard's batch filling up must not prevent writes for other shards from being dispatched in
+// the same round when the batch is unordered.
+TEST_F(BatchWriteOpLimitTests, UnorderedFullShardBatchDoesNotStallOtherShards) {
+    NamespaceString nss("foo.bar");
+    ShardEndpoint endpointA(ShardId("shardA"), ChunkVersion::IGNORED());
+    ShardEndpoint endpointB(ShardId("shardB"), ChunkVersion::IGNORED());
+
+    auto targeter = initTargeterSplitRange(nss, endpointA, endpointB);
+
+    const std::string bigString(BSONObjMaxUserSize, 'x');
+
+    // Two writes for shard A, of which only the first fits in a single batch, followed by a write
+    // for shard B.
+    BatchedCommandRequest request([&] {
+        write_ops::Update updateOp(nss);
+        updateOp.setWriteCommandBase([] {
+            write_ops::WriteCommandBase wcb;
+            wcb.setOrdered(false);
+            return wcb;
+        }());
+        updateOp.setUpdates({buildUpdate(BSON("x" << -2), BSON("data" << bigString), false),
+                             buildUpdate(BSON("x" << -1), BSONObj(), false),
+                             buildUpdate(BSON("x" << 1), BSONObj(), false)});
+        return updateOp;
+    }());
+
+    BatchWriteOp batchOp(_opCtx, request);
+
+    // The first round must target both shards even though shard A's batch is full after the first
+    // write.
+    OwnedPointerMap<ShardId, TargetedWriteBatch> targetedOwned;
+    std::map<ShardId, TargetedWriteBatch*>& targeted = targetedOwned.mutableMap();
+    ASSERT_OK(batchOp.targetBatch(targeter, false, &targeted));
+    ASSERT_EQUALS(targeted.size(), 2u);
+    verifyTargetedBatches({{endpointA.shardName, 1u}, {endpointB.shardName, 1u}}, targeted);
+
+    BatchedCommandResponse response;
+    buildResponse(1, &response);
+
+    for (auto it = targeted.begin(); it != targeted.end(); ++it) {
+        batchOp.noteBatchResponse(*it->second, response, nullptr);
+    }
+    ASSERT(!batchOp.isFinished());
+
+    // The second round carries the write that did not fit in shard A's first batch.
+    targetedOwned.clear();
+    ASSERT_OK(batchOp.targetBatch(targeter, false, &targeted));
+    ASSERT_EQUALS(targeted.size(), 1u);
+    ASSERT_EQUALS(targeted.begin()->second->getWrites().size(), 1u);
+
+    batchOp.noteBatchResponse(*targeted.begin()->second, response, nullptr);
+    ASSERT(batchOp.isFinished());
+}
+
 class BatchWriteOpTransactionTest : public ShardingTestFixture {
 public:
     const TxnNumber kTxnNumber = 5;
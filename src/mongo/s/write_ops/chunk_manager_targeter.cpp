@@ -357,6 +357,9 @@ ChunkManagerTargeter::ChunkManagerTargeter(OperationContext* opCtx,
 }
 
 void ChunkManagerTargeter::_init(OperationContext* opCtx) {
+    // The routing info is about to change, so any memoized targeting decisions no longer hold.
+    _shardKeyEndpointCache.clear();
+
     createShardDatabase(opCtx, _nss.db());
     _routingInfo = uassertStatusOK(getCollectionRoutingInfoForTxnCmd(opCtx, _nss));
 
@@ -563,9 +566,31 @@ StatusWith<std::vector<ShardEndpoint>> ChunkManagerTargeter::_targetQuery(
 StatusWith<ShardEndpoint> ChunkManagerTargeter::_targetShardKey(const BSONObj& shardKey,
                                                                 const BSONObj& collation,
                                                                 long long estDataSize) const {
+    // If no element of the shard key is sensitive to collation, the chunk lookup is a pure
+    // function of the routing info and its result can be memoized across the writes of a batch.
+    bool cacheable = true;
+    for (const auto& elt : shardKey) {
+        if (CollationIndexKey::isCollatableType(elt.type())) {
+            cacheable = false;
+            break;
+        }
+    }
+
+    if (cacheable) {
+        auto it = _shardKeyEndpointCache.find(shardKey);
+        if (it != _shardKeyEndpointCache.end()) {
+            return it->second;
+        }
+    }
+
     try {
         auto chunk = _routingInfo->cm()->findIntersectingChunk(shardKey, collation);
-        return {{chunk.getShardId(), _routingInfo->cm()->getVersion(chunk.getShardId())}};
+        ShardEndpoint endpoint(chunk.getShardId(),
+                               _routingInfo->cm()->getVersion(chunk.getShardId()));
+        if (cacheable) {
+            _shardKeyEndpointCache.emplace(shardKey.getOwned(), endpoint);
+        }
+        return endpoint;
     } catch (const DBException& ex) {
         return ex.toStatus();
     }
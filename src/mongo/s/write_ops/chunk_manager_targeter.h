@@ -151,6 +151,14 @@ private:
     // The latest loaded routing cache entry
     boost::optional<CachedCollectionRoutingInfo> _routingInfo;
 
+    // Memoizes shard key -> endpoint lookups against the currently loaded routing info. Bulk
+    // writes repeatedly resolve keys through the same chunk map, so _targetShardKey() serves
+    // repeated keys from here instead of walking the chunk map again. Only keys without
+    // collation-sensitive elements are cached, so that an entry is valid regardless of the
+    // collation an individual write specifies. Cleared whenever the routing info is reloaded.
+    mutable BSONObjIndexedMap<ShardEndpoint> _shardKeyEndpointCache{
+        SimpleBSONObjComparator::kInstance.makeBSONObjIndexedMap<ShardEndpoint>()};
+
     // Set to the epoch of the namespace we are targeting. If we ever refresh the catalog cache and
     // find a new epoch, we immediately throw a StaleEpoch exception.
     boost::optional<OID> _targetEpoch;
@@ -180,6 +180,34 @@ TEST_F(ChunkManagerTargeterTest, TargetInsertsWithConstantHashedPrefixAndVarying
     ASSERT_EQUALS(res.shardName, "1");
 }
 
+TEST_F(ChunkManagerTargeterTest, RepeatedKeysWithinBatchTargetConsistently) {
+    // Create 4 chunks and 4 shards such that shardId '0' has chunk [MinKey, null), '1' has chunk
+    // [null, 0), '2' has chunk [0, 100) and '3' has chunk [100, MaxKey).
+    std::vector<BSONObj> splitPoints = {BSON("a" << BSONNULL), BSON("a" << 0), BSON("a" << 100)};
+    auto cmTargeter = prepare(BSON("a" << 1), splitPoints);
+
+    // Repeatedly targeting the same shard keys must keep routing to the same chunks; from the
+    // second pass onwards the endpoints are served from the targeter's memo cache and have to
+    // agree with the initial chunk map lookups.
+    for (int pass = 0; pass < 3; pass++) {
+        auto res = cmTargeter.targetInsert(operationContext(), BSON("a" << -5));
+        ASSERT_EQUALS(res.shardName, "1");
+        res = cmTargeter.targetInsert(operationContext(), BSON("a" << 5));
+        ASSERT_EQUALS(res.shardName, "2");
+        res = cmTargeter.targetInsert(operationContext(), BSON("a" << 500));
+        ASSERT_EQUALS(res.shardName, "3");
+    }
+
+    // Collation-sensitive (string) shard keys bypass the memo cache and must also route
+    // consistently on repeat.
+    for (int pass = 0; pass < 2; pass++) {
+        auto res = cmTargeter.targetInsert(operationContext(),
+                                           BSON("a"
+                                                << "x"));
+        ASSERT_EQUALS(res.shardName, "3");
+    }
+}
+
 TEST_F(ChunkManagerTargeterTest, TargetUpdateWithRangePrefixHashedShardKey) {
     // Create 5 chunks and 5 shards such that shardId '0' has chunk [MinKey, null), '1' has chunk
     // [null, -100), '2' has chunk [-100, 0), '3' has chunk ['0', 100) and '4' has chunk
@@ -41,6 +41,8 @@
 #include "mongo/db/operation_context.h"
 #include "mongo/db/service_context.h"
 #include "mongo/logv2/log.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/platform/mutex.h"
 #include "mongo/scripting/dbdirectclient_factory.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/file.h"
@@ -66,6 +68,14 @@ const ServiceContext::Decoration<std::unique_ptr<ScriptEngine>> forService =
     ServiceContext::declareDecoration<std::unique_ptr<ScriptEngine>>();
 static std::unique_ptr<ScriptEngine> globalScriptEngine;
 
+// State for ScriptEngine::setupDeferred(). The flag is checked on every call to
+// getGlobalScriptEngine(), so it is an atomic to keep the common no-deferred-setup path
+// lock-free; the mutex serializes the one-time construction itself.
+Mutex deferredSetupMutex = MONGO_MAKE_LATCH("ScriptEngine::deferredSetupMutex");
+AtomicWord<bool> deferredSetupPending{false};
+void (*deferredSetup)(bool) = nullptr;
+bool deferredSetupDisableLoadStored = true;
+
 }  // namespace
 
 ScriptEngine::ScriptEngine(bool disableLoadStored)
@@ -579,7 +589,23 @@ unique_ptr<Scope> ScriptEngine::getPooledScope(OperationContext* opCtx,
 
 void (*ScriptEngine::_connectCallback)(DBClientBase&) = nullptr;
 
+void setGlobalScriptEngineDeferredSetup(void (*setup)(bool), bool disableLoadStored) {
+    stdx::lock_guard<Latch> lk(deferredSetupMutex);
+    deferredSetup = setup;
+    deferredSetupDisableLoadStored = disableLoadStored;
+    deferredSetupPending.store(true);
+}
+
 ScriptEngine* getGlobalScriptEngine() {
+    if (MONGO_unlikely(deferredSetupPending.load())) {
+        stdx::lock_guard<Latch> lk(deferredSetupMutex);
+        // Clear the flag before running the deferred setup, which itself calls
+        // getGlobalScriptEngine() to check for an existing engine.
+        if (deferredSetupPending.swap(false)) {
+            deferredSetup(deferredSetupDisableLoadStored);
+        }
+    }
+
     if (hasGlobalServiceContext())
         return forService(getGlobalServiceContext()).get();
     else
@@ -244,6 +244,14 @@ public:
      * ignored.
      */
     static void setup(bool disableLoadStored = true);
+
+    /**
+     * Arranges for setup() to run the first time getGlobalScriptEngine() is called rather than
+     * immediately. Servers that never execute JavaScript then never pay for the interpreter's
+     * startup time or resident memory. Has no effect if a global ScriptEngine already exists.
+     */
+    static void setupDeferred(bool disableLoadStored = true);
+
     static void dropScopeCache();
 
     /** gets a scope from the pool or a new one if pool is empty
@@ -288,6 +296,17 @@ void installGlobalUtils(Scope& scope);
 bool hasJSReturn(const std::string& s);
 const char* jsSkipWhiteSpace(const char* raw);
 
+/**
+ * Returns the global ScriptEngine, constructing it first if initialization was deferred with
+ * ScriptEngine::setupDeferred(). Returns nullptr when scripting is disabled.
+ */
 ScriptEngine* getGlobalScriptEngine();
 void setGlobalScriptEngine(ScriptEngine* impl);
+
+/**
+ * Stashes a constructor for the global ScriptEngine to be run on the first call to
+ * getGlobalScriptEngine(). Called by ScriptEngine::setupDeferred() implementations; not for
+ * general use.
+ */
+void setGlobalScriptEngineDeferredSetup(void (*setup)(bool), bool disableLoadStored);
 }  // namespace mongo
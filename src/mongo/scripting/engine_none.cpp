@@ -34,6 +34,10 @@ void ScriptEngine::setup(bool disableLoadStored) {
     // noop
 }
 
+void ScriptEngine::setupDeferred(bool disableLoadStored) {
+    // noop
+}
+
 std::string ScriptEngine::getInterpreterVersionString() {
     return "";
 }
@@ -58,6 +58,13 @@ void ScriptEngine::setup(bool disableLoadStored) {
     }
 }
 
+void ScriptEngine::setupDeferred(bool disableLoadStored) {
+    if (getGlobalScriptEngine())
+        return;
+
+    setGlobalScriptEngineDeferredSetup(&ScriptEngine::setup, disableLoadStored);
+}
+
 std::string ScriptEngine::getInterpreterVersionString() {
     return "MozJS-" BOOST_PP_STRINGIZE(MOZJS_MAJOR_VERSION);
 }
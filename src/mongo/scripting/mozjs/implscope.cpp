@@ -35,6 +35,7 @@
 
 #include <iostream>
 #include <memory>
+#include <vector>
 
 #include <js/CharacterEncoding.h>
 #include <jscustomallocator.h>
@@ -48,10 +49,12 @@
 #include "mongo/platform/mutex.h"
 #include "mongo/platform/stack_locator.h"
 #include "mongo/scripting/jsexception.h"
+#include "mongo/scripting/mozjs/engine_gen.h"
 #include "mongo/scripting/mozjs/objectwrapper.h"
 #include "mongo/scripting/mozjs/valuereader.h"
 #include "mongo/scripting/mozjs/valuewriter.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/lru_cache.h"
 #include "mongo/util/scopeguard.h"
 
 #if !defined(__has_feature)
@@ -102,6 +105,35 @@ bool gFirstRuntimeCreated = false;
 bool closeToMaxMemory() {
     return mongo::sm::get_total_bytes() > (kInterruptGCThreshold * mongo::sm::get_max_bytes());
 }
+
+/**
+ * Process-global cache of XDR-serialized script bytecode, keyed by source text. Identical
+ * $where/$function bodies are recompiled by every fresh scope otherwise; decoding cached
+ * bytecode skips the SpiderMonkey frontend entirely. XDR buffers are position independent and
+ * tied only to the build id, so entries can be shared freely across scopes and threads.
+ */
+Mutex gBytecodeCacheMutex;
+LRUCache<std::string, std::shared_ptr<const std::vector<uint8_t>>>& bytecodeCache() {
+    static LRUCache<std::string, std::shared_ptr<const std::vector<uint8_t>>> cache(
+        static_cast<std::size_t>(gJSScriptBytecodeCacheEntries));
+    return cache;
+}
+
+std::shared_ptr<const std::vector<uint8_t>> lookupCachedBytecode(const std::string& code) {
+    if (gJSScriptBytecodeCacheEntries == 0)
+        return nullptr;
+    stdx::lock_guard<Latch> lk(gBytecodeCacheMutex);
+    auto it = bytecodeCache().find(code);
+    return it == bytecodeCache().end() ? nullptr : it->second;
+}
+
+void storeCachedBytecode(const std::string& code, const JS::TranscodeBuffer& buffer) {
+    if (gJSScriptBytecodeCacheEntries == 0)
+        return;
+    auto entry = std::make_shared<const std::vector<uint8_t>>(buffer.begin(), buffer.end());
+    stdx::lock_guard<Latch> lk(gBytecodeCacheMutex);
+    bytecodeCache().add(code, std::move(entry));
+}
 }  // namespace
 
 thread_local MozJSImplScope::ASANHandles* kCurrentASANHandles = nullptr;
@@ -569,7 +601,29 @@ void MozJSImplScope::_MozJSCreateFunction(StringData raw, JS::MutableHandleValue
     JS::CompileOptions co(_context);
     setCompileOptions(&co);
 
-    _checkErrorState(JS::Evaluate(_context, co, code.c_str(), code.length(), fun));
+    // Decode cached bytecode for this source if we have it; otherwise compile and cache the
+    // result. The script still runs once per scope to instantiate the function object, but the
+    // decode path never touches the SpiderMonkey frontend.
+    JS::RootedScript script(_context);
+    if (auto cached = lookupCachedBytecode(code)) {
+        JS::TranscodeRange range(const_cast<uint8_t*>(cached->data()), cached->size());
+        if (JS::DecodeScript(_context, range, &script) != JS::TranscodeResult_Ok) {
+            // Decode failures (e.g. mismatched compile options) just fall back to compiling.
+            JS_ClearPendingException(_context);
+            script.set(nullptr);
+        }
+    }
+    if (!script) {
+        _checkErrorState(JS::Compile(_context, co, code.c_str(), code.length(), &script));
+        JS::TranscodeBuffer buffer;
+        if (JS::EncodeScript(_context, buffer, script) == JS::TranscodeResult_Ok) {
+            storeCachedBytecode(code, buffer);
+        } else {
+            JS_ClearPendingException(_context);
+        }
+    }
+
+    _checkErrorState(JS_ExecuteScript(_context, script, fun));
     uassert(10232,
             "not a function",
             fun.isObject() && JS_ObjectIsFunction(_context, fun.toObjectOrNull()));
@@ -39,11 +39,13 @@
 #include "mongo/rpc/message.h"
 #include "mongo/transport/message_compressor_manager.h"
 #include "mongo/transport/message_compressor_noop.h"
+#include "mongo/transport/message_compressor_parameters_gen.h"
 #include "mongo/transport/message_compressor_registry.h"
 #include "mongo/transport/message_compressor_snappy.h"
 #include "mongo/transport/message_compressor_zlib.h"
 #include "mongo/transport/message_compressor_zstd.h"
 #include "mongo/unittest/unittest.h"
+#include "mongo/util/scopeguard.h"
 
 namespace mongo {
 namespace {
@@ -240,6 +242,15 @@ TEST(ZstdMessageCompressor, Fidelity) {
     checkFidelity(testMessage, std::make_unique<ZstdMessageCompressor>());
 }
 
+TEST(ZstdMessageCompressor, FidelityAtNonDefaultLevel) {
+    const auto savedLevel = gNetworkMessageCompressionZstdLevel.load();
+    gNetworkMessageCompressionZstdLevel.store(19);
+    ON_BLOCK_EXIT([&] { gNetworkMessageCompressionZstdLevel.store(savedLevel); });
+
+    auto testMessage = buildMessage();
+    checkFidelity(testMessage, std::make_unique<ZstdMessageCompressor>());
+}
+
 TEST(SnappyMessageCompressor, Overflow) {
     checkOverflow(std::make_unique<SnappyMessageCompressor>());
 }
@@ -36,6 +36,7 @@
 #include <zstd.h>
 
 #include "mongo/base/init.h"
+#include "mongo/transport/message_compressor_parameters_gen.h"
 #include "mongo/transport/message_compressor_registry.h"
 #include "mongo/transport/message_compressor_zstd.h"
 
@@ -53,7 +54,7 @@ StatusWith<std::size_t> ZstdMessageCompressor::compressData(ConstDataRange input
                                output.length(),
                                input.data(),
                                input.length(),
-                               ZSTD_CLEVEL_DEFAULT);
+                               gNetworkMessageCompressionZstdLevel.load());
 
     if (ZSTD_isError(ret)) {
         return Status{ErrorCodes::BadValue,
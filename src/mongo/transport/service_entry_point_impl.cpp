@@ -39,6 +39,7 @@
 #include "mongo/db/service_context.h"
 #include "mongo/logv2/log.h"
 #include "mongo/transport/ismaster_metrics.h"
+#include "mongo/transport/service_entry_point_utils.h"
 #include "mongo/transport/service_state_machine.h"
 #include "mongo/transport/session.h"
 #include "mongo/util/processinfo.h"
@@ -269,6 +270,8 @@ void ServiceEntryPointImpl::appendStats(BSONObjBuilder* bob) const {
                     static_cast<int>(IsMasterMetrics::get(sc)->getNumAwaitingTopologyChanges()));
     }
 
+    appendServiceWorkerNumaPlacement(bob);
+
     if (_adminInternalPool) {
         BSONObjBuilder section(bob->subobjStart("adminConnections"));
         _adminInternalPool->appendStats(&section);
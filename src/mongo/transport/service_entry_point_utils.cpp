@@ -37,15 +37,23 @@
 #include <memory>
 
 #include "mongo/logv2/log.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/stdx/thread.h"
+#include "mongo/transport/service_worker_options_gen.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/debug_util.h"
+#include "mongo/util/numa_topology.h"
+#include "mongo/util/scopeguard.h"
 #include "mongo/util/thread_safety_context.h"
 
 #if !defined(_WIN32)
 #include <sys/resource.h>
 #endif
 
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
 #if !defined(__has_feature)
 #define __has_feature(x) 0
 #endif
@@ -59,6 +67,48 @@ void* runFunc(void* ctx) {
 
     return nullptr;
 }
+
+#if defined(__linux__)
+struct NumaPlacementState {
+    const std::vector<NumaNode>& topology = getNumaTopology();
+    AtomicWord<unsigned> nextNode{0};
+    // One counter per NUMA node; sized once at construction, so plain array of atomics.
+    std::unique_ptr<AtomicWord<long long>[]> workersPerNode{
+        new AtomicWord<long long>[topology.size()]()};
+};
+
+NumaPlacementState& numaPlacementState() {
+    static auto state = new NumaPlacementState();
+    return *state;
+}
+
+/**
+ * Pins the calling worker thread to the CPUs of the next NUMA node in round-robin order. Returns
+ * the index of the chosen node, or -1 if the thread was not pinned.
+ */
+int pinServiceWorkerToNumaNode() {
+    auto& state = numaPlacementState();
+    if (state.topology.size() < 2) {
+        return -1;
+    }
+    auto nodeIndex = state.nextNode.fetchAndAdd(1) % state.topology.size();
+    const auto& node = state.topology[nodeIndex];
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    for (int cpu : node.cpus) {
+        CPU_SET(cpu, &cpus);
+    }
+    if (sched_setaffinity(0, sizeof(cpus), &cpus) != 0) {
+        LOGV2_WARNING(4915301,
+                      "Failed to pin service worker thread to NUMA node",
+                      "node"_attr = node.id,
+                      "error"_attr = errnoWithDescription());
+        return -1;
+    }
+    state.workersPerNode[nodeIndex].fetchAndAdd(1);
+    return nodeIndex;
+}
+#endif  // defined(__linux__)
 }  // namespace
 
 Status launchServiceWorkerThread(std::function<void()> task) {
@@ -71,8 +121,8 @@ Status launchServiceWorkerThread(std::function<void()> task) {
         pthread_attr_init(&attrs);
         pthread_attr_setdetachstate(&attrs, PTHREAD_CREATE_DETACHED);
 
-        static const rlim_t kStackSize =
-            1024 * 1024;  // if we change this we need to update the warning
+        const rlim_t kStackSize =
+            static_cast<rlim_t>(transport::serviceWorkerStackSizeKB.load()) * 1024;
 
         struct rlimit limits;
         invariant(getrlimit(RLIMIT_STACK, &limits) == 0);
@@ -100,6 +150,20 @@ Status launchServiceWorkerThread(std::function<void()> task) {
             f();
         };
 
+#if defined(__linux__)
+        if (transport::serviceWorkerNumaInterleave) {
+            task = [f = std::move(task)] {
+                auto nodeIndex = pinServiceWorkerToNumaNode();
+                ON_BLOCK_EXIT([&] {
+                    if (nodeIndex >= 0) {
+                        numaPlacementState().workersPerNode[nodeIndex].fetchAndSubtract(1);
+                    }
+                });
+                f();
+            };
+        }
+#endif
+
         pthread_t thread;
         auto ctx = std::make_unique<std::function<void()>>(std::move(task));
         ThreadSafetyContext::getThreadSafetyContext()->onThreadCreate();
@@ -125,4 +189,25 @@ Status launchServiceWorkerThread(std::function<void()> task) {
     return Status::OK();
 }
 
+void appendServiceWorkerNumaPlacement(BSONObjBuilder* bob) {
+#if defined(__linux__)
+    if (!transport::serviceWorkerNumaInterleave) {
+        return;
+    }
+    auto& state = numaPlacementState();
+    if (state.topology.size() < 2) {
+        return;
+    }
+    BSONObjBuilder section(bob->subobjStart("numaPlacement"));
+    BSONArrayBuilder nodes(section.subarrayStart("nodes"));
+    for (size_t i = 0; i < state.topology.size(); i++) {
+        BSONObjBuilder node(nodes.subobjStart());
+        node.append("node", state.topology[i].id);
+        node.append("cpus", static_cast<int>(state.topology[i].cpus.size()));
+        node.appendNumber(
+            "workers", static_cast<long long>(state.workersPerNode[i].loadRelaxed()));
+    }
+#endif
+}
+
 }  // namespace mongo
@@ -31,10 +31,18 @@
 
 #include <functional>
 
+#include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/transport/session.h"
 
 namespace mongo {
 
 Status launchServiceWorkerThread(std::function<void()> task);
 
+/**
+ * Appends a "numaPlacement" subdocument describing how many service worker threads are currently
+ * pinned to each NUMA node. Appends nothing unless serviceWorkerNumaInterleave is enabled and the
+ * host has multiple NUMA nodes.
+ */
+void appendServiceWorkerNumaPlacement(BSONObjBuilder* bob);
+
 }  // namespace mongo
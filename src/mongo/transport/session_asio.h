@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <array>
 #include <utility>
 
 #include "mongo/base/system_error.h"
@@ -170,6 +171,9 @@ public:
                 if (_isIngressSession) {
                     networkCounter.hitPhysicalOut(message.size());
                 }
+                auto buffer = message.sharedBuffer();
+                message.reset();
+                recycleBuffer(std::move(buffer));
             })
             .getNoThrow();
     }
@@ -177,10 +181,13 @@ public:
     Future<void> asyncSinkMessage(Message message, const BatonHandle& baton = nullptr) override {
         ensureAsync();
         return write(asio::buffer(message.buf(), message.size()), baton)
-            .then([this, message /*keep the buffer alive*/]() {
+            .then([this, message /*keep the buffer alive*/]() mutable {
                 if (_isIngressSession) {
                     networkCounter.hitPhysicalOut(message.size());
                 }
+                auto buffer = message.sharedBuffer();
+                message.reset();
+                recycleBuffer(std::move(buffer));
             });
     }
 
@@ -253,6 +260,7 @@ protected:
 
         _sslSocket.emplace(
             std::move(_socket), *_tl->_egressSSLContext, removeFQDNRoot(target.host()));
+        getSSLManager()->attachEgressSession(_sslSocket->native_handle(), target);
         lk.unlock();
 
         auto doHandshake = [&] {
@@ -378,7 +386,13 @@ private:
     Future<Message> sourceMessageImpl(const BatonHandle& baton = nullptr) {
         static constexpr auto kHeaderSize = sizeof(MSGHEADER::Value);
 
-        auto headerBuffer = SharedBuffer::allocate(kHeaderSize);
+        // Take enough up front to hold a typical command message, so most messages are received
+        // into a single buffer and with no header copy. Only the header is read into it before
+        // the message length is known, so this never consumes bytes of a following pipelined
+        // message.
+        static constexpr size_t kInitialMessageBufferSize = kBufferPoolMinSize;
+
+        auto headerBuffer = takePooledBuffer(kInitialMessageBufferSize);
         auto ptr = headerBuffer.get();
         return read(asio::buffer(ptr, kHeaderSize), baton)
             .then([headerBuffer = std::move(headerBuffer), this, baton]() mutable {
@@ -409,8 +423,16 @@ private:
                     return Future<Message>::makeReady(Message(std::move(headerBuffer)));
                 }
 
-                auto buffer = SharedBuffer::allocate(msgLen);
-                memcpy(buffer.get(), headerBuffer.get(), kHeaderSize);
+                // Reuse the initial buffer when the whole message fits in it; otherwise take a
+                // larger buffer and splice the header in, returning the initial one to the pool.
+                SharedBuffer buffer;
+                if (msgLen <= kInitialMessageBufferSize) {
+                    buffer = std::move(headerBuffer);
+                } else {
+                    buffer = takePooledBuffer(msgLen);
+                    memcpy(buffer.get(), headerBuffer.get(), kHeaderSize);
+                    recycleBuffer(std::move(headerBuffer));
+                }
 
                 MsgData::View msgView(buffer.get());
                 return read(asio::buffer(msgView.data(), msgView.dataLen()), baton)
@@ -746,6 +768,57 @@ private:
             });
     }
 
+    /**
+     * Returns the index of the pool size class whose buffers are exactly 'size' bytes, or -1 if
+     * 'size' is not a pool class size.
+     */
+    static int bufferPoolClassIndex(size_t size) {
+        size_t classSize = kBufferPoolMinSize;
+        for (size_t i = 0; i < kBufferPoolClasses; ++i, classSize <<= 1) {
+            if (size == classSize) {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    /**
+     * Returns a buffer of at least 'size' bytes, reusing a pooled buffer when one of the right
+     * size class is available. Pool misses allocate the full class size so the buffer can be
+     * recycled later; sizes above the largest class are allocated exactly and never pooled.
+     */
+    SharedBuffer takePooledBuffer(size_t size) {
+        size_t classSize = kBufferPoolMinSize;
+        for (size_t i = 0; i < kBufferPoolClasses; ++i, classSize <<= 1) {
+            if (size > classSize) {
+                continue;
+            }
+            if (_bufferPool[i]) {
+                return std::move(_bufferPool[i]);
+            }
+            return SharedBuffer::allocate(classSize);
+        }
+        return SharedBuffer::allocate(size);
+    }
+
+    /**
+     * Returns 'buffer' to the pool if it is uniquely owned and exactly a pool class size. Buffers
+     * still referenced elsewhere (e.g. a command retaining its reply) and odd-sized buffers are
+     * simply dropped.
+     */
+    void recycleBuffer(SharedBuffer buffer) {
+        if (!buffer || buffer.isShared()) {
+            return;
+        }
+        const auto idx = bufferPoolClassIndex(buffer.capacity());
+        if (idx < 0) {
+            return;
+        }
+        if (!_bufferPool[idx]) {
+            _bufferPool[idx] = std::move(buffer);
+        }
+    }
+
     enum BlockingMode {
         Unknown,
         Sync,
@@ -771,6 +844,16 @@ private:
 
     TransportLayerASIO* const _tl;
     bool _isIngressSession;
+
+    // Per-session message buffer pool, one slot per power-of-two size class from
+    // kBufferPoolMinSize up to kBufferPoolMinSize << (kBufferPoolClasses - 1). Sourcing a message
+    // draws from the pool and sinking a reply returns its buffer, so a steady request/reply
+    // workload runs without per-operation message allocations. The pool is unsynchronized:
+    // source/sink for a session are serialized by the service state machine, like the rest of the
+    // mutable session state.
+    static constexpr size_t kBufferPoolMinSize = 1024;
+    static constexpr size_t kBufferPoolClasses = 7;  // 1KB through 64KB.
+    std::array<SharedBuffer, kBufferPoolClasses> _bufferPool;
 };
 
 }  // namespace transport
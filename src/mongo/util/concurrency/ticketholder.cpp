@@ -99,6 +99,10 @@ bool TicketHolder::waitForTicketUntil(OperationContext* opCtx, Date_t until) {
         return true;
     }
 
+    if (opCtx && opCtx->getAdmissionPriority() == AdmissionPriority::kLow) {
+        return _waitForTicketUntilLowPriority(opCtx, until);
+    }
+
     const Milliseconds intervalMs(500);
     struct timespec ts;
 
@@ -185,6 +189,11 @@ bool TicketHolder::tryAcquire() {
 }
 
 void TicketHolder::waitForTicket(OperationContext* opCtx) {
+    if (opCtx && opCtx->getAdmissionPriority() == AdmissionPriority::kLow) {
+        invariant(_waitForTicketUntilLowPriority(opCtx, Date_t::max()));
+        return;
+    }
+
     stdx::unique_lock<Latch> lk(_mutex);
 
     if (opCtx) {
@@ -195,6 +204,10 @@ void TicketHolder::waitForTicket(OperationContext* opCtx) {
 }
 
 bool TicketHolder::waitForTicketUntil(OperationContext* opCtx, Date_t until) {
+    if (opCtx && opCtx->getAdmissionPriority() == AdmissionPriority::kLow) {
+        return _waitForTicketUntilLowPriority(opCtx, until);
+    }
+
     stdx::unique_lock<Latch> lk(_mutex);
 
     if (opCtx) {
@@ -259,4 +272,17 @@ bool TicketHolder::_tryAcquire() {
     return true;
 }
 #endif
+
+bool TicketHolder::_waitForTicketUntilLowPriority(OperationContext* opCtx, Date_t until) {
+    // Sleeping between attempts, instead of blocking on the ticket pool, means a released ticket
+    // goes to a blocked normal-priority waiter before a low-priority operation can race for it.
+    const Milliseconds intervalMs(100);
+    while (!tryAcquire()) {
+        if (Date_t::now() >= until) {
+            return false;
+        }
+        opCtx->sleepUntil(std::min(until, Date_t::now() + intervalMs));
+    }
+    return true;
+}
 }  // namespace mongo
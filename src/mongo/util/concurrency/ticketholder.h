@@ -83,6 +83,14 @@ public:
     int outof() const;
 
 private:
+    /**
+     * Acquisition path for operations running at AdmissionPriority::kLow. Rather than queueing
+     * alongside normal-priority waiters, low-priority operations poll tryAcquire() with an
+     * interruptible sleep in between, so contested tickets go to blocked normal-priority waiters
+     * first.
+     */
+    bool _waitForTicketUntilLowPriority(OperationContext* opCtx, Date_t until);
+
 #if defined(__linux__)
     mutable sem_t _sem;
 
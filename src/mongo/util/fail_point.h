@@ -38,6 +38,7 @@
 #include "mongo/db/operation_context.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
+#include "mongo/stdx/new.h"
 #include "mongo/stdx/unordered_map.h"
 #include "mongo/util/duration.h"
 
@@ -103,8 +104,13 @@ namespace mongo {
  * A FailPoint can be configured remotely by a database command.
  * See `src/mongo/db/commands/fail_point_cmd.cpp`.
  *
+ * A disabled FailPoint's `shouldFail` is a single relaxed load with no write traffic, so checks
+ * on hot paths only cost a predictable branch. The class is cache-line aligned so that an active
+ * fail point's reference counting can never bounce the line holding a neighboring (disabled)
+ * fail point's state; fail points are defined as adjacent globals, which would otherwise put
+ * several of them on one line.
  */
-class FailPoint {
+class alignas(stdx::hardware_destructive_interference_size) FailPoint {
 private:
     enum RetCode { fastOff = 0, slowOff, slowOn, userIgnored };
 
@@ -417,6 +423,9 @@ private:
     // Bit layout:
     // 31: tells whether this fail point is active.
     // 0~30: unsigned ref counter for active dynamic instances.
+    //
+    // The disabled-path check in _shouldFailOpenBlock() is a relaxed load of this word and
+    // nothing else; all mutation happens on the enabled slow path or in setMode().
     AtomicWord<std::uint32_t> _fpInfo{0};
 
     // Total number of times the fail point has been entered.
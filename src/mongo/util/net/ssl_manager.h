@@ -275,6 +275,16 @@ public:
      * SSL_CTX obect.
      */
     virtual Status stapleOCSPResponse(SSLContextType context) = 0;
+
+    /**
+     * Prepares an outgoing connection for TLS session resumption before its handshake begins.
+     * If a session negotiated with 'target' earlier has been cached, it is offered to the peer so
+     * the handshake can complete in fewer round trips and without asymmetric crypto; the target is
+     * also recorded so the session negotiated on this connection gets cached for later reuse.
+     * No-op unless the provider supports egress session caching and the
+     * tlsEgressSessionResumption parameter is enabled.
+     */
+    virtual void attachEgressSession(SSLConnectionType ssl, const HostAndPort& target) {}
 };
 
 // Access SSL functions through this instance.
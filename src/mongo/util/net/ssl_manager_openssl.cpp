@@ -438,6 +438,40 @@ using UniqueOCSPResponse =
 using UniqueCertId =
     std::unique_ptr<OCSP_CERTID, OpenSSLDeleter<decltype(OCSP_CERTID_free), ::OCSP_CERTID_free>>;
 
+using UniqueSSLSession =
+    std::unique_ptr<SSL_SESSION,
+                    OpenSSLDeleter<decltype(SSL_SESSION_free), ::SSL_SESSION_free>>;
+
+/**
+ * Application-data slot on each egress SSL object holding the target "host:port" string, so the
+ * new-session callback can file the negotiated session under the right target. The string is
+ * owned by the slot and freed by OpenSSL when the SSL object is destroyed.
+ */
+int egressSessionTargetIndex() {
+    static const int index = SSL_get_ex_new_index(
+        0,
+        nullptr,
+        nullptr,
+        nullptr,
+        [](void* parent, void* ptr, CRYPTO_EX_DATA* ad, int idx, long argl, void* argp) {
+            delete static_cast<std::string*>(ptr);
+        });
+    return index;
+}
+
+/**
+ * Application-data slot on each egress SSL_CTX pointing back at the owning SSLManagerOpenSSL,
+ * which holds the per-target session cache.
+ */
+int egressSessionManagerIndex() {
+    static const int index = SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+    return index;
+}
+
+// Upper bound on the number of egress targets with a cached TLS session. A mongos talks to every
+// shard host plus config servers, so this is generous; overflow evicts an arbitrary entry.
+constexpr size_t kMaxEgressSessionCacheSize = 1024;
+
 Status getSSLFailure(ErrorCodes::Error code, StringData errorMsg) {
     return Status(code,
                   str::stream() << "SSL peer certificate revocation status checking failed: "
@@ -1020,6 +1054,8 @@ public:
 
     int SSL_shutdown(SSLConnectionInterface* conn) final;
 
+    void attachEgressSession(SSL* ssl, const HostAndPort& target) final;
+
     Future<void> ocspClientVerification(SSL* ssl, const ExecutorPtr& reactor);
 
 private:
@@ -1038,6 +1074,22 @@ private:
     Mutex _staplingMutex = MONGO_MAKE_LATCH("OCSPStaplingJobRunner::_mutex");
     PeriodicRunner::JobAnchor _ocspStaplingAnchor;
 
+    // Most recently negotiated TLS session for each egress target, offered on later connections
+    // to the same target so the handshake can be abbreviated. Only populated when
+    // tlsEgressSessionResumption is enabled.
+    Mutex _egressSessionCacheMutex =
+        MONGO_MAKE_LATCH("SSLManagerOpenSSL::_egressSessionCacheMutex");
+    std::map<std::string, UniqueSSLSession> _egressSessionCache;
+
+    /**
+     * Invoked by OpenSSL whenever a session is negotiated on an egress SSL_CTX with session
+     * caching enabled, including tickets that arrive after a TLS 1.3 handshake completes.
+     * Returning 1 transfers ownership of the session reference to the cache.
+     */
+    static int _newEgressSessionCallback(SSL* ssl, SSL_SESSION* session);
+
+    void _cacheEgressSession(const std::string& target, UniqueSSLSession session);
+
     /** Password caching helper class.
      * Objects of this type will remember the config provided password they had access to at
      * construction.
@@ -1843,6 +1895,20 @@ Status SSLManagerOpenSSL::initSSLContext(SSL_CTX* context,
     options |= SSL_OP_NO_RENEGOTIATION;
 #endif
 
+    if (params.tlsKernelOffload) {
+#ifdef SSL_OP_ENABLE_KTLS
+        // Once the handshake completes, OpenSSL programs the negotiated keys into the socket and
+        // SSL_read/SSL_write become plain kernel I/O, skipping userspace crypto. OpenSSL silently
+        // keeps the userspace path whenever the kernel lacks TLS offload for the negotiated
+        // cipher, so no fallback handling is needed here.
+        options |= SSL_OP_ENABLE_KTLS;
+#else
+        LOGV2_WARNING(4915302,
+                      "tlsKernelOffload was requested, but this build's OpenSSL library has no "
+                      "kernel TLS support; continuing with userspace TLS");
+#endif
+    }
+
     ::SSL_CTX_set_options(context, options);
 
     // HIGH - Enable strong ciphers
@@ -1871,6 +1937,16 @@ Status SSLManagerOpenSSL::initSSLContext(SSL_CTX* context,
                                     << getSSLErrorMessage(ERR_get_error()));
     }
 
+    if (direction == ConnectionDirection::kOutgoing && params.tlsEgressSessionResumption) {
+        // Cache negotiated egress sessions keyed by target host. OpenSSL's internal client cache
+        // is not indexed by peer, so it is disabled and sessions are stored in this manager via
+        // the new-session callback, which also captures tickets issued after a TLS 1.3 handshake.
+        SSL_CTX_set_session_cache_mode(context,
+                                       SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+        SSL_CTX_sess_set_new_cb(context, &SSLManagerOpenSSL::_newEgressSessionCallback);
+        SSL_CTX_set_ex_data(context, egressSessionManagerIndex(), this);
+    }
+
     if (direction == ConnectionDirection::kOutgoing && params.tlsWithholdClientCertificate) {
         // Do not send a client certificate if they have been suppressed.
 
@@ -1964,6 +2040,57 @@ Status SSLManagerOpenSSL::initSSLContext(SSL_CTX* context,
     return Status::OK();
 }
 
+void SSLManagerOpenSSL::attachEgressSession(SSL* ssl, const HostAndPort& target) {
+    if (!sslGlobalParams.tlsEgressSessionResumption) {
+        return;
+    }
+
+    auto targetKey = target.toString();
+
+    // Record the target on the connection so _newEgressSessionCallback can file the session
+    // negotiated on this connection under the right host. The string is freed by the ex-data
+    // free routine when the SSL object is destroyed.
+    SSL_set_ex_data(ssl, egressSessionTargetIndex(), new std::string(targetKey));
+
+    stdx::lock_guard<Latch> lock(_egressSessionCacheMutex);
+    auto it = _egressSessionCache.find(targetKey);
+    if (it == _egressSessionCache.end()) {
+        return;
+    }
+
+    // Offering a cached session is best effort: if the peer no longer accepts it, the handshake
+    // silently proceeds as a full one and the replacement session gets cached.
+    SSL_set_session(ssl, it->second.get());
+    LOGV2_DEBUG(4957914,
+                3,
+                "Offering cached TLS session for egress connection",
+                "target"_attr = targetKey);
+}
+
+int SSLManagerOpenSSL::_newEgressSessionCallback(SSL* ssl, SSL_SESSION* session) {
+    auto* manager = static_cast<SSLManagerOpenSSL*>(
+        SSL_CTX_get_ex_data(::SSL_get_SSL_CTX(ssl), egressSessionManagerIndex()));
+    auto* target = static_cast<std::string*>(SSL_get_ex_data(ssl, egressSessionTargetIndex()));
+    if (!manager || !target) {
+        // A connection which never went through attachEgressSession, e.g. on the synchronous
+        // client path. Declining the session lets OpenSSL release its reference.
+        return 0;
+    }
+
+    manager->_cacheEgressSession(*target, UniqueSSLSession(session));
+    return 1;
+}
+
+void SSLManagerOpenSSL::_cacheEgressSession(const std::string& target, UniqueSSLSession session) {
+    stdx::lock_guard<Latch> lock(_egressSessionCacheMutex);
+    if (_egressSessionCache.size() >= kMaxEgressSessionCacheSize &&
+        _egressSessionCache.count(target) == 0) {
+        _egressSessionCache.erase(_egressSessionCache.begin());
+    }
+    _egressSessionCache[target] = std::move(session);
+    LOGV2_DEBUG(4957915, 3, "Cached TLS session for egress target", "target"_attr = target);
+}
+
 bool SSLManagerOpenSSL::_initSynchronousSSLContext(UniqueSSLContext* contextPtr,
                                                    const SSLParams& params,
                                                    ConnectionDirection direction) {
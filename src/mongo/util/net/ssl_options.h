@@ -95,6 +95,8 @@ struct SSLParams {
     bool suppressNoTLSPeerCertificateWarning =
         false;  // --setParameter suppressNoTLSPeerCertificateWarning
     bool tlsWithholdClientCertificate = false;  // --setParameter tlsWithholdClientCertificate
+    bool tlsKernelOffload = false;              // --setParameter tlsKernelOffload
+    bool tlsEgressSessionResumption = false;    // --setParameter tlsEgressSessionResumption
 
     SSLParams() {
         sslMode.store(SSLMode_disabled);
@@ -0,0 +1,121 @@
+/**
+ *    Copyright (C) 2020-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/util/numa_topology.h"
+
+#ifdef __linux__
+
+#include <boost/filesystem.hpp>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+#endif
+
+namespace mongo {
+
+#ifdef __linux__
+namespace {
+
+/**
+ * Parses a sysfs cpulist such as "0-7,16-23" into individual CPU numbers. Returns an empty vector
+ * if the list cannot be parsed.
+ */
+std::vector<int> parseCpuList(const std::string& cpuList) {
+    std::vector<int> cpus;
+    const char* p = cpuList.c_str();
+    while (*p && *p != '\n') {
+        char* end;
+        long first = strtol(p, &end, 10);
+        if (end == p) {
+            return {};
+        }
+        long last = first;
+        if (*end == '-') {
+            p = end + 1;
+            last = strtol(p, &end, 10);
+            if (end == p) {
+                return {};
+            }
+        }
+        for (long cpu = first; cpu <= last; cpu++) {
+            cpus.push_back(static_cast<int>(cpu));
+        }
+        p = end;
+        if (*p == ',') {
+            p++;
+        }
+    }
+    return cpus;
+}
+
+std::vector<NumaNode> discoverNumaTopology() {
+    std::vector<NumaNode> nodes;
+    try {
+        for (int nodeId = 0;; nodeId++) {
+            auto nodeDir = "/sys/devices/system/node/node" + std::to_string(nodeId);
+            if (!boost::filesystem::exists(nodeDir)) {
+                break;
+            }
+            std::ifstream cpuListFile(nodeDir + "/cpulist");
+            std::string cpuList;
+            if (!std::getline(cpuListFile, cpuList)) {
+                return {};
+            }
+            auto cpus = parseCpuList(cpuList);
+            if (cpus.empty()) {
+                return {};
+            }
+            nodes.push_back({nodeId, std::move(cpus)});
+        }
+    } catch (const boost::filesystem::filesystem_error&) {
+        return {};
+    }
+    return nodes;
+}
+
+}  // namespace
+
+const std::vector<NumaNode>& getNumaTopology() {
+    static const auto* nodes = new std::vector<NumaNode>(discoverNumaTopology());
+    return *nodes;
+}
+
+#else
+
+const std::vector<NumaNode>& getNumaTopology() {
+    static const auto* nodes = new std::vector<NumaNode>();
+    return *nodes;
+}
+
+#endif
+
+}  // namespace mongo
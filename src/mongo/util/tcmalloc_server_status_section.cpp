@@ -191,5 +191,69 @@ private:
     }
 #endif
 } tcmallocServerStatusSection;
+
+// A focused companion to the "tcmalloc" section above: per-size-class allocator statistics for
+// chasing fragmentation and cache contention. Excluded by default because the size-class array is
+// large; setting allocatorStatsEnabled includes it in serverStatus and therefore streams it
+// through FTDC. The size-class list is fixed for the life of the process, so the emitted schema is
+// stable and compresses well.
+class AllocatorStatsServerStatusSection : public ServerStatusSection {
+public:
+    AllocatorStatsServerStatusSection() : ServerStatusSection("allocatorStats") {}
+
+    bool includeByDefault() const override {
+        return gAllocatorStatsEnabled.load();
+    }
+
+    BSONObj generateSection(OperationContext* opCtx,
+                            const BSONElement& configElement) const override {
+        BSONObjBuilder builder;
+
+        appendNumericPropertyIfAvailable(
+            builder, "current_allocated_bytes", "generic.current_allocated_bytes");
+        appendNumericPropertyIfAvailable(builder, "heap_size", "generic.heap_size");
+        appendNumericPropertyIfAvailable(
+            builder, "central_cache_free_bytes", "tcmalloc.central_cache_free_bytes");
+        appendNumericPropertyIfAvailable(
+            builder, "transfer_cache_free_bytes", "tcmalloc.transfer_cache_free_bytes");
+        appendNumericPropertyIfAvailable(
+            builder, "thread_cache_free_bytes", "tcmalloc.thread_cache_free_bytes");
+
+#if MONGO_HAVE_GPERFTOOLS_SIZE_CLASS_STATS
+        BSONArrayBuilder arr;
+        MallocExtension::instance()->SizeClasses(&arr, appendSizeClassInfo);
+        builder.append("size_classes", arr.arr());
+#endif
+
+        return builder.obj();
+    }
+
+private:
+    static void appendNumericPropertyIfAvailable(BSONObjBuilder& builder,
+                                                 StringData bsonName,
+                                                 const char* property) {
+        size_t value;
+        if (MallocExtension::instance()->GetNumericProperty(property, &value))
+            builder.appendNumber(bsonName, value);
+    }
+
+#if MONGO_HAVE_GPERFTOOLS_SIZE_CLASS_STATS
+    static void appendSizeClassInfo(void* bsonarr_builder, const base::MallocSizeClass* stats) {
+        BSONArrayBuilder* builder = reinterpret_cast<BSONArrayBuilder*>(bsonarr_builder);
+        BSONObjBuilder doc;
+
+        doc.appendNumber("bytes_per_object", stats->bytes_per_obj);
+        doc.appendNumber("pages_per_span", stats->pages_per_span);
+        doc.appendNumber("num_spans", stats->num_spans);
+        doc.appendNumber("num_thread_objs", stats->num_thread_objs);
+        doc.appendNumber("num_central_objs", stats->num_central_objs);
+        doc.appendNumber("num_transfer_objs", stats->num_transfer_objs);
+        doc.appendNumber("free_bytes", stats->free_bytes);
+        doc.appendNumber("allocated_bytes", stats->alloc_bytes);
+
+        builder->append(doc.obj());
+    }
+#endif
+} allocatorStatsServerStatusSection;
 }  // namespace
 }  // namespace mongo
@@ -36,6 +36,10 @@ Copyright (C) 2018-present Percona and/or its affiliates. All rights reserved.
 #include <time.h>
 //#include <assert>
 
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
 #include <openssl/conf.h>
 #include <openssl/evp.h>
 #include <openssl/err.h>
@@ -135,6 +139,144 @@ static int handleErrors(PERCONA_ENCRYPTOR *pe, WT_SESSION *session, int *pret) {
     return 0;
 }
 
+// Reusable per-thread cipher contexts.
+//
+// wiredTiger invokes the encrypt/decrypt callbacks concurrently from many
+// threads (application threads, eviction and checkpoint servers), so the
+// crypto work is already parallel. What shows up in profiles during
+// checkpoint write storms is the per-page overhead around it: every call
+// allocated a fresh EVP_CIPHER_CTX and re-derived the AES key schedule even
+// though consecutive pages from one thread almost always use the same key.
+// Keep one encrypt and one decrypt context per thread and re-key them only
+// when the caller's cipher or key actually changes, so the steady-state call
+// just sets the IV and runs the AES-NI code path.
+//
+// On Windows there is no thread-exit destructor available here, so fall back
+// to the previous allocate-per-call behavior to avoid leaking contexts when
+// connection threads exit.
+
+typedef struct {
+    EVP_CIPHER_CTX *ctx;
+    const EVP_CIPHER *cipher;
+    unsigned char key[KEY_LEN];
+} CIPHER_CTX_CACHE;
+
+typedef struct {
+    CIPHER_CTX_CACHE enc;
+    CIPHER_CTX_CACHE dec;
+} THREAD_CIPHER_CTX;
+
+static EVP_CIPHER_CTX *alloc_cipher_ctx(void)
+{
+#if OPENSSL_VERSION_NUMBER < 0x10100000L
+    EVP_CIPHER_CTX *ctx = malloc(sizeof(EVP_CIPHER_CTX));
+    if (ctx != NULL)
+        EVP_CIPHER_CTX_init(ctx);
+    return ctx;
+#else
+    return EVP_CIPHER_CTX_new();
+#endif
+}
+
+static void free_cipher_ctx(EVP_CIPHER_CTX *ctx)
+{
+    if (ctx == NULL)
+        return;
+#if OPENSSL_VERSION_NUMBER < 0x10100000L
+    EVP_CIPHER_CTX_cleanup(ctx);
+    free(ctx);
+#else
+    EVP_CIPHER_CTX_free(ctx);
+#endif
+}
+
+#ifndef _WIN32
+
+static pthread_key_t thread_cipher_ctx_key;
+static pthread_once_t thread_cipher_ctx_once = PTHREAD_ONCE_INIT;
+
+static void thread_cipher_ctx_destroy(void *vp)
+{
+    THREAD_CIPHER_CTX *t = vp;
+    free_cipher_ctx(t->enc.ctx);
+    free_cipher_ctx(t->dec.ctx);
+    free(t);
+}
+
+static void thread_cipher_ctx_make_key(void)
+{
+    (void)pthread_key_create(&thread_cipher_ctx_key, thread_cipher_ctx_destroy);
+}
+
+// Returns this thread's cached context initialized with pe's cipher and key
+// for the requested direction (enc != 0 for encryption) and the provided IV.
+// Skips the key schedule setup when the cached context already holds the same
+// cipher and key. Returns NULL on failure; the caller reports the error.
+static EVP_CIPHER_CTX *acquire_cipher_ctx(PERCONA_ENCRYPTOR *pe, int enc, const uint8_t *iv)
+{
+    (void)pthread_once(&thread_cipher_ctx_once, thread_cipher_ctx_make_key);
+    THREAD_CIPHER_CTX *t = pthread_getspecific(thread_cipher_ctx_key);
+    if (t == NULL) {
+        if ((t = calloc(1, sizeof(THREAD_CIPHER_CTX))) == NULL)
+            return NULL;
+        if (pthread_setspecific(thread_cipher_ctx_key, t) != 0) {
+            free(t);
+            return NULL;
+        }
+    }
+    CIPHER_CTX_CACHE *c = enc ? &t->enc : &t->dec;
+    if (c->ctx == NULL && (c->ctx = alloc_cipher_ctx()) == NULL)
+        return NULL;
+    if (c->cipher == pe->cipher && memcmp(c->key, pe->key, KEY_LEN) == 0) {
+        // Same cipher and key as the previous call on this thread: only the IV changes.
+        if (1 == EVP_CipherInit_ex(c->ctx, NULL, NULL, NULL, iv, enc))
+            return c->ctx;
+        // fall through and retry with a full initialization
+    }
+    c->cipher = NULL;
+    if (1 != EVP_CipherInit_ex(c->ctx, pe->cipher, NULL, pe->key, iv, enc))
+        return NULL;
+    c->cipher = pe->cipher;
+    memcpy(c->key, pe->key, KEY_LEN);
+    return c->ctx;
+}
+
+// A failed operation can leave the context in an undefined state, so on error
+// the callbacks release it as dirty and the next call re-initializes in full.
+static void release_cipher_ctx(EVP_CIPHER_CTX *ctx, int enc, int failed)
+{
+    (void)ctx;
+    if (!failed)
+        return;
+    (void)pthread_once(&thread_cipher_ctx_once, thread_cipher_ctx_make_key);
+    THREAD_CIPHER_CTX *t = pthread_getspecific(thread_cipher_ctx_key);
+    if (t != NULL)
+        (enc ? &t->enc : &t->dec)->cipher = NULL;
+}
+
+#else  // _WIN32
+
+static EVP_CIPHER_CTX *acquire_cipher_ctx(PERCONA_ENCRYPTOR *pe, int enc, const uint8_t *iv)
+{
+    EVP_CIPHER_CTX *ctx = alloc_cipher_ctx();
+    if (ctx == NULL)
+        return NULL;
+    if (1 != EVP_CipherInit_ex(ctx, pe->cipher, NULL, pe->key, iv, enc)) {
+        free_cipher_ctx(ctx);
+        return NULL;
+    }
+    return ctx;
+}
+
+static void release_cipher_ctx(EVP_CIPHER_CTX *ctx, int enc, int failed)
+{
+    (void)enc;
+    (void)failed;
+    free_cipher_ctx(ctx);
+}
+
+#endif  // _WIN32
+
 static char value_type_char(int type)
 {
     switch (type) {
@@ -223,6 +365,7 @@ static int percona_encrypt_cbc(WT_ENCRYPTOR *encryptor, WT_SESSION *session,
 {
     int ret = EINVAL;
     int encrypted_len = 0;
+    EVP_CIPHER_CTX *ctx = NULL;
     PERCONA_ENCRYPTOR *pe = (PERCONA_ENCRYPTOR*)encryptor;
     DBG_MSG("entering encrypt %lu %lu", src_len, dst_len);
     if (dst_len < pe->iv_len + src_len + EVP_CIPHER_block_size(pe->cipher))
@@ -230,15 +373,6 @@ static int percona_encrypt_cbc(WT_ENCRYPTOR *encryptor, WT_SESSION *session,
                 ENOMEM, "encrypt buffer not big enough"));
 
     *result_lenp = 0;
-#if OPENSSL_VERSION_NUMBER < 0x10100000L
-    EVP_CIPHER_CTX ctx_value;
-    EVP_CIPHER_CTX *ctx= &ctx_value;
-    EVP_CIPHER_CTX_init(ctx);
-#else
-    EVP_CIPHER_CTX *ctx= EVP_CIPHER_CTX_new();
-    if (!ctx)
-        goto err;
-#endif
 
 #ifdef DBG_ENC_EXT
     DEBUG_DATA *dbg_data = (DEBUG_DATA*)dst;
@@ -256,7 +390,7 @@ static int percona_encrypt_cbc(WT_ENCRYPTOR *encryptor, WT_SESSION *session,
     store_IV(pe, iv);
     *result_lenp += pe->iv_len;
 
-    if(1 != EVP_EncryptInit_ex(ctx, pe->cipher, NULL, pe->key, iv))
+    if((ctx = acquire_cipher_ctx(pe, 1, iv)) == NULL)
         goto err;
 
     if(1 != EVP_EncryptUpdate(ctx, dst + *result_lenp, &encrypted_len, src, src_len))
@@ -274,11 +408,7 @@ err:
     handleErrors(pe, session, &ret);
 
 cleanup:
-#if OPENSSL_VERSION_NUMBER < 0x10100000L
-    EVP_CIPHER_CTX_cleanup(ctx);
-#else
-    EVP_CIPHER_CTX_free(ctx);
-#endif
+    release_cipher_ctx(ctx, 1, ret != 0);
     DBG_MSG("exiting encrypt %lu", *result_lenp);
 #ifdef DBG_ENC_EXT
     dbg_data->result_len = *result_lenp;
@@ -293,6 +423,7 @@ static int percona_encrypt_gcm(WT_ENCRYPTOR *encryptor, WT_SESSION *session,
 {
     int ret = EINVAL;
     int encrypted_len = 0;
+    EVP_CIPHER_CTX *ctx = NULL;
     PERCONA_ENCRYPTOR *pe = (PERCONA_ENCRYPTOR*)encryptor;
     DBG_MSG("entering encrypt %lu %lu", src_len, dst_len);
     if (dst_len < pe->iv_len + src_len + GCM_TAG_LEN)
@@ -300,15 +431,6 @@ static int percona_encrypt_gcm(WT_ENCRYPTOR *encryptor, WT_SESSION *session,
                 ENOMEM, "encrypt buffer not big enough"));
 
     *result_lenp = 0;
-#if OPENSSL_VERSION_NUMBER < 0x10100000L
-    EVP_CIPHER_CTX ctx_value;
-    EVP_CIPHER_CTX *ctx= &ctx_value;
-    EVP_CIPHER_CTX_init(ctx);
-#else
-    EVP_CIPHER_CTX *ctx= EVP_CIPHER_CTX_new();
-    if (!ctx)
-        goto err;
-#endif
 
     if (0 != (pe->get_iv_gcm)(dst, pe->iv_len)) {
         ret = report_error(pe, session, EINVAL, "failed generating IV for GCM");
@@ -316,7 +438,7 @@ static int percona_encrypt_gcm(WT_ENCRYPTOR *encryptor, WT_SESSION *session,
     }
     *result_lenp += pe->iv_len;
 
-    if(1 != EVP_EncryptInit_ex(ctx, pe->cipher, NULL, pe->key, dst))
+    if((ctx = acquire_cipher_ctx(pe, 1, dst)) == NULL)
         goto err;
 
     // we don't provide any AAD data yet
@@ -341,11 +463,7 @@ err:
     handleErrors(pe, session, &ret);
 
 cleanup:
-#if OPENSSL_VERSION_NUMBER < 0x10100000L
-    EVP_CIPHER_CTX_cleanup(ctx);
-#else
-    EVP_CIPHER_CTX_free(ctx);
-#endif
+    release_cipher_ctx(ctx, 1, ret != 0);
     DBG_MSG("exiting encrypt %lu", *result_lenp);
     return ret;
 }
@@ -357,20 +475,12 @@ static int percona_decrypt_cbc(WT_ENCRYPTOR *encryptor, WT_SESSION *session,
 {
     int ret = EINVAL;
     int decrypted_len = 0;
+    EVP_CIPHER_CTX *ctx = NULL;
     PERCONA_ENCRYPTOR *pe = (PERCONA_ENCRYPTOR*)encryptor;
     uint32_t crc32c = 0;
     DBG_MSG("entering decrypt %lu %lu", src_len, dst_len);
 
     *result_lenp = 0;
-#if OPENSSL_VERSION_NUMBER < 0x10100000L
-    EVP_CIPHER_CTX ctx_value;
-    EVP_CIPHER_CTX *ctx= &ctx_value;
-    EVP_CIPHER_CTX_init(ctx);
-#else
-    EVP_CIPHER_CTX *ctx= EVP_CIPHER_CTX_new();
-    if (!ctx)
-        goto err;
-#endif
 
 #ifdef DBG_ENC_EXT
     DEBUG_DATA *dbg_data = (DEBUG_DATA*)src;
@@ -389,7 +499,7 @@ static int percona_decrypt_cbc(WT_ENCRYPTOR *encryptor, WT_SESSION *session,
     src += CHKSUM_LEN;
     src_len -= CHKSUM_LEN;
 
-    if(1 != EVP_DecryptInit_ex(ctx, pe->cipher, NULL, pe->key, src))
+    if((ctx = acquire_cipher_ctx(pe, 0, src)) == NULL)
         goto err;
     src += pe->iv_len;
     src_len -= pe->iv_len;
@@ -419,11 +529,7 @@ err:
     }
 
 cleanup:
-#if OPENSSL_VERSION_NUMBER < 0x10100000L
-    EVP_CIPHER_CTX_cleanup(ctx);
-#else
-    EVP_CIPHER_CTX_free(ctx);
-#endif
+    release_cipher_ctx(ctx, 0, ret != 0);
     DBG_MSG("exiting decrypt %lu", *result_lenp);
     return ret;
 }
@@ -435,21 +541,13 @@ static int percona_decrypt_gcm(WT_ENCRYPTOR *encryptor, WT_SESSION *session,
 {
     int ret = EINVAL;
     int decrypted_len = 0;
+    EVP_CIPHER_CTX *ctx = NULL;
     PERCONA_ENCRYPTOR *pe = (PERCONA_ENCRYPTOR*)encryptor;
     DBG_MSG("entering decrypt %lu %lu", src_len, dst_len);
 
     *result_lenp = 0;
-#if OPENSSL_VERSION_NUMBER < 0x10100000L
-    EVP_CIPHER_CTX ctx_value;
-    EVP_CIPHER_CTX *ctx= &ctx_value;
-    EVP_CIPHER_CTX_init(ctx);
-#else
-    EVP_CIPHER_CTX *ctx= EVP_CIPHER_CTX_new();
-    if (!ctx)
-        goto err;
-#endif
 
-    if(1 != EVP_DecryptInit_ex(ctx, pe->cipher, NULL, pe->key, src))
+    if((ctx = acquire_cipher_ctx(pe, 0, src)) == NULL)
         goto err;
     src += pe->iv_len;
     src_len -= pe->iv_len;
@@ -482,11 +580,7 @@ err:
     }
 
 cleanup:
-#if OPENSSL_VERSION_NUMBER < 0x10100000L
-    EVP_CIPHER_CTX_cleanup(ctx);
-#else
-    EVP_CIPHER_CTX_free(ctx);
-#endif
+    release_cipher_ctx(ctx, 0, ret != 0);
     DBG_MSG("exiting decrypt %lu", *result_lenp);
     return ret;
 }